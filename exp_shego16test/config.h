@@ -62,6 +62,62 @@
 #define SPI_HEIGHT 128
 #endif
 
+// ST7735 bus clock (display.c, SPI0 + DMA). The RP2040 rounds it to a
+// divider of clk_peri; most modules are fine past 30 MHz, lower this if
+// the picture tears or shifts.
+#define TFT_SPI_HZ 32000000
+
+// Drive the display from a PIO state machine on pio1 instead of SPI0: one
+// DMA chain sends the window commands and then the frame from flash, the
+// CPU only drops and raises CS around it.
+// #define TFT_PIO_BUS
+
+// Most time the GIF animation may take from one housekeeping pass, in us;
+// a frame in flight is polled, never waited for
+#define DISPLAY_TASK_BUDGET_US 100
+
+// Hall-sensor acquisition: free-running ADC round-robin + DMA in the
+// background (hall_engine.c). Comment out for the blocking mux scan.
+#define HALL_DMA_ENGINE
+
+// Run the mux/ADC loop and all key state on core 1 so display, UART and
+// keymap stalls on core 0 can't delay sensing. Works with or without the
+// DMA engine in the host simulator only: on the keyboard core 1 would run
+// from flash while core 0 writes it, so shego_adc.c refuses it until the
+// scan path is in RAM or core 1 is parked around flash writes.
+// #define HALL_CORE1_SCAN
+
+// Run the scan at a fixed rate (a ChibiOS thread, or core 1's own loop)
+// instead of from the QMK main loop; transitions reach matrix_scan_custom() through a
+// timestamped event queue. Needs HALL_DMA_ENGINE or HALL_CORE1_SCAN.
+#define HALL_SCAN_RATE_HZ 4000
+
+// EEPROM kb datablock: kb_config_t (calibration, SOCD, analog axes,
+// Dynamic Keystroke slots, ADC DNL widths).
+// Bump the version whenever the stored layout changes.
+#define EECONFIG_KB_DATA_SIZE 222
+#define EECONFIG_KB_DATA_VERSION 5
+
+// Switch/magnet profile for the travel tables (hall_travel_lut.h) and the
+// actuation point in 0.01 mm of travel
+#define HALL_TRAVEL_PROFILE HALL_PROFILE_DIPOLE_4MM
+#define HALL_ACTUATION_TRAVEL 150
+#define HALL_HYSTERESIS_TRAVEL 20
+
 // Debounce and performance
-#define DEBOUNCE 5
+// Keys are debounced by hysteresis in shego_adc.c
+#define DEBOUNCE 0
 #define USB_POLLING_INTERVAL_MS 1
+
+// Key depth as a gamepad (hall_analog.c): virtual axes only, set from the
+// scanner's depth snapshots
+#define JOYSTICK_AXIS_COUNT 4
+#define JOYSTICK_BUTTON_COUNT 0
+#define JOYSTICK_AXIS_RESOLUTION 10
+
+// With MIDI_ENABLE (rules.mk), keys mapped to MIDI notes send note on with
+// a velocity from how fast they travel between HALL_VELOCITY_START_TRAVEL
+// and HALL_VELOCITY_NOTE_TRAVEL (hall_velocity.h), plus polyphonic
+// aftertouch from depth past the note.
+// Needs the fixed-rate scan for evenly spaced, timestamped samples.
+#define HALL_MIDI_AFTERTOUCH
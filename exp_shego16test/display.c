@@ -1,6 +1,22 @@
 // Direct ST7735 display driver for QMK (ported from Arduino Adafruit_ST7735)
 #include "config.h"
 #include "display.h"
+#include "gif_codec.h"
+
+// DMA channels come from the ChibiOS allocator; they and SPI0 are
+// programmed through the pico-sdk struct headers, since the hardware_dma
+// and hardware_spi libraries are not part of the QMK build
+#include <hal.h>
+#include "hardware/clocks.h"
+#include "hardware/gpio.h"
+#include "hardware/structs/dma.h"
+#include "hardware/timer.h"
+#ifdef TFT_PIO_BUS
+#include "hardware/pio.h"
+#else
+#include "hardware/resets.h"
+#include "hardware/structs/spi.h"
+#endif
 
 // Build-time switch: set to 0 to omit large GIF asset headers (helps avoid flash overflow)
 #ifndef BUILD_WITH_GIFS
@@ -8,50 +24,355 @@
 #endif
 
 #if BUILD_WITH_GIFS
+// Frames packed by gif2_pack.py when present: a third of the flash or less
+#if __has_include("gif/gif_packed.h")
+#include "gif/gif_packed.h"
+#else
 #include "gif/gif.h"  // Include the generated gif frames
 #endif
+#endif
 
 // Animation speed multiplier (in hundredths)
 // 100 = 1.0x (normal speed), 125 = 1.25x, 50 = 0.5x (half speed), 200 = 2.0x (double speed)
 #define ANIMATION_SPEED_MULTIPLIER 75  // 0.75x speed (25% slower)
 
+// Longest one display_update_animation() call may run, in microseconds
+#ifndef DISPLAY_TASK_BUDGET_US
+#define DISPLAY_TASK_BUDGET_US 100
+#endif
+
+// Packed frames are decoded into two buffers of this many rows: one
+// streams to the panel while the next rows are decoded into the other
+#ifndef DISPLAY_DECODE_ROWS
+#define DISPLAY_DECODE_ROWS 4
+#endif
+
 static bool display_initialized = false;
 static bool animation_playing = false;
 static uint16_t current_frame = 0;
 static uint32_t last_frame_time = 0;
 
-// Low-level SPI functions
-static void spi_write_byte(uint8_t data) {
-    // Bit-bang SPI for now since we removed quantum_painter
-    for (int i = 7; i >= 0; i--) {
-        writePin(TFT_SCLK, false);
-        writePin(TFT_MOSI, (data >> i) & 1);
-        writePin(TFT_SCLK, true);
+#ifndef TFT_SPI_HZ
+#define TFT_SPI_HZ 32000000
+#endif
+
+// Memory access control: rotation, plus the BGR bit for frames stored with
+// red and blue swapped (the panel reorders them, no per-pixel work)
+#define TFT_MADCTL 0xA0
+
+static bool tft_in_flight = false;  // window DMA running, CS still low
+static uint8_t tft_madctl = TFT_MADCTL;
+static uint16_t tft_fill_color;     // DMA source for fills, must outlive the transfer
+
+#define DMA_CTRL_SIZE(size) (DMA_CH0_CTRL_TRIG_DATA_SIZE_VALUE_SIZE_##size << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB)
+#define DMA_CTRL_TREQ(treq) ((uint32_t)(treq) << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)
+#define DMA_CTRL_CHAIN_TO(ch) ((uint32_t)(ch) << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)
+
+// A channel of our own from the ChibiOS allocator, so the WS2812 driver's
+// is never shared. No IRQ: completion is polled.
+static bool tft_dma_alloc(uint8_t *ch) {
+    const rp_dma_channel_t *dma = dmaChannelAlloc(RP_DMA_CHANNEL_ID_ANY, RP_IRQ_DMA0_PRIORITY, NULL, NULL);
+    if (!dma) return false;
+    *ch = dma->chnidx;
+    return true;
+}
+
+// Program a transfer; writing CTRL through the trigger alias starts it
+static void tft_dma_setup(uint8_t ch, volatile void *dst, const void *src, uint32_t count, uint32_t ctrl, bool start) {
+    dma_channel_hw_t *hw = &dma_hw->ch[ch];
+    hw->read_addr = (uintptr_t)src;
+    hw->write_addr = (uintptr_t)dst;
+    hw->transfer_count = count;
+    if (start) {
+        hw->ctrl_trig = ctrl;
+    } else {
+        hw->al1_ctrl = ctrl;
     }
 }
 
-static void st7735_write_command(uint8_t cmd) {
-    writePin(TFT_DC, false);  // Command mode
+static bool tft_dma_busy(uint8_t ch) {
+    return dma_hw->ch[ch].ctrl_trig & DMA_CH0_CTRL_TRIG_BUSY_BITS;
+}
+
+#ifdef TFT_PIO_BUS
+// PIO bus: SCLK (side-set), MOSI (out) and DC (set) from one state machine.
+// CS (GP24) isn't next to the other pins, so it stays a GPIO held low for
+// a whole window. The TX FIFO takes 16-bit units, MSB first, so RGB565
+// words go out high byte first without any swapping. Each run of units
+// starts with a header unit:
+//   bit 15     DC level for the run
+//   bit 14     1 = only the top byte of each unit is sent (commands, params)
+//   bits 13..0 units in the run - 1 (16384 units = one full 128x128 frame)
+#ifndef TFT_PIO
+#define TFT_PIO pio1  // pio0 is the WS2812 driver's
+#endif
+#define TFT_PIO_HEADER(dc, bytes, units) (((dc) << 15) | ((bytes) << 14) | ((units) - 1))
+#define TFT_PIO_MAX_UNITS 16384
+
+// Hand-assembled (QMK has no pioasm step), side-set 1 = SCLK:
+//  0: out x, 1        side 0   ; DC bit
+//  1: jmp !x, 4       side 0
+//  2: set pins, 1     side 0
+//  3: jmp 5           side 0
+//  4: set pins, 0     side 0
+//  5: out x, 1        side 0   ; byte units?
+//  6: out y, 14       side 0   ; units - 1
+//  7: jmp x--, 13     side 0
+//  8: set x, 15       side 0   ; 16-bit units
+//  9: out pins, 1     side 0
+// 10: jmp x--, 9      side 1
+// 11: jmp y--, 8      side 0
+// 12: jmp 0           side 0
+// 13: set x, 7        side 0   ; 8-bit units
+// 14: out pins, 1     side 0
+// 15: jmp x--, 14     side 1
+// 16: out null, 8     side 0   ; drop the unused low byte
+// 17: jmp y--, 13     side 0   ; wraps to 0
+// Autopull at 16 bits stalls the next header read with SCLK low.
+static const uint16_t tft_pio_instructions[] = {
+    0x6021, 0x0024, 0xE001, 0x0005, 0xE000, 0x6021, 0x604E, 0x004D, 0xE02F,
+    0x6001, 0x1049, 0x0088, 0x0000, 0xE027, 0x6001, 0x104E, 0x6068, 0x008D,
+};
+
+static const struct pio_program tft_pio_program = {
+    .instructions = tft_pio_instructions,
+    .length = sizeof(tft_pio_instructions) / sizeof(tft_pio_instructions[0]),
+    .origin = -1,
+};
+
+static uint tft_sm;
+static uint8_t tft_dma_chan[2];     // window commands, chained to pixels
+static uint32_t tft_dma_ctrl;       // CTRL bits both channels share
+static uint16_t tft_preamble[13];   // CASET/RASET/RAMWR runs, read by DMA
+
+static bool tft_bus_init(void) {
+    if (!tft_dma_alloc(&tft_dma_chan[0]) || !tft_dma_alloc(&tft_dma_chan[1])) return false;
+    tft_sm = pio_claim_unused_sm(TFT_PIO, true);
+    uint offset = pio_add_program(TFT_PIO, &tft_pio_program);
+
+    pio_gpio_init(TFT_PIO, TFT_SCLK);
+    pio_gpio_init(TFT_PIO, TFT_MOSI);
+    pio_gpio_init(TFT_PIO, TFT_DC);
+    pio_sm_set_consecutive_pindirs(TFT_PIO, tft_sm, TFT_SCLK, 1, true);
+    pio_sm_set_consecutive_pindirs(TFT_PIO, tft_sm, TFT_MOSI, 1, true);
+    pio_sm_set_consecutive_pindirs(TFT_PIO, tft_sm, TFT_DC, 1, true);
+
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset, offset + tft_pio_program.length - 1);
+    sm_config_set_sideset(&c, 1, false, false);
+    sm_config_set_sideset_pins(&c, TFT_SCLK);
+    sm_config_set_out_pins(&c, TFT_MOSI, 1);
+    sm_config_set_set_pins(&c, TFT_DC, 1);
+    sm_config_set_out_shift(&c, false, true, 16);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    // Two PIO cycles per bit
+    float div = (float)clock_get_hz(clk_sys) / (2.0f * TFT_SPI_HZ);
+    sm_config_set_clkdiv(&c, div < 1.0f ? 1.0f : div);
+    pio_sm_init(TFT_PIO, tft_sm, offset, &c);
+    pio_sm_set_enabled(TFT_PIO, tft_sm, true);
+
+    // Both channels write 16-bit units into the FIFO; the bus replicates a
+    // halfword write across the word, so the PIO sees it in the top half
+    tft_dma_ctrl = DMA_CH0_CTRL_TRIG_EN_BITS | DMA_CTRL_SIZE(HALFWORD) | DMA_CTRL_TREQ(pio_get_dreq(TFT_PIO, tft_sm, true));
+
+    uprintf("ST7735 display_init: PIO bus at %lu Hz\n", (unsigned long)(clock_get_hz(clk_sys) / (2.0f * div)));
+    return true;
+}
+
+// Block until the state machine has shifted out everything it was given
+static void tft_bus_wait_idle(void) {
+    uint32_t stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + tft_sm);
+    TFT_PIO->fdebug = stall;
+    while (!(TFT_PIO->fdebug & stall)) {}
+}
+
+// Wait out a window started by tft_write_window() and release the bus.
+// Every command goes through here, so callers never see a half-sent window.
+static void tft_finish(void) {
+    if (!tft_in_flight) return;
+    while (tft_dma_busy(tft_dma_chan[0])) {}
+    while (tft_dma_busy(tft_dma_chan[1])) {}
+    tft_bus_wait_idle();
+    writePin(TFT_CS, true);
+    tft_in_flight = false;
+}
+
+// True while a window is still streaming. Once false, tft_finish() only
+// waits for the unit left in the shift register.
+static bool tft_busy(void) {
+    return tft_in_flight && (tft_dma_busy(tft_dma_chan[0]) || tft_dma_busy(tft_dma_chan[1]) ||
+                             !pio_sm_is_tx_fifo_empty(TFT_PIO, tft_sm));
+}
+
+// Blocking command or parameter bytes, one CS cycle
+static void tft_write(bool dc, const uint8_t *data, uint8_t len) {
+    tft_finish();
+    writePin(TFT_CS, false);
+    pio_sm_put_blocking(TFT_PIO, tft_sm, (uint32_t)TFT_PIO_HEADER(dc, 1, len) << 16);
+    for (uint8_t i = 0; i < len; i++) {
+        pio_sm_put_blocking(TFT_PIO, tft_sm, (uint32_t)data[i] << 24);
+    }
+    tft_bus_wait_idle();
+    writePin(TFT_CS, true);
+}
+
+// Set the window and stream its pixels as one DMA chain: the preamble
+// channel sends CASET/RASET/RAMWR with their parameters, then triggers the
+// pixel channel, which reads straight from flash. Returns as soon as the
+// chain is running; increment false repeats *pixels.
+static void tft_write_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, const uint16_t *pixels, bool increment) {
+    uint32_t count = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+    if (count > TFT_PIO_MAX_UNITS) return;
+    tft_finish();
+
+    uint16_t *p = tft_preamble;
+    *p++ = TFT_PIO_HEADER(0, 1, 1);
+    *p++ = ST7735_CASET << 8;
+    *p++ = TFT_PIO_HEADER(1, 0, 2);
+    *p++ = x0;
+    *p++ = x1;
+    *p++ = TFT_PIO_HEADER(0, 1, 1);
+    *p++ = ST7735_RASET << 8;
+    *p++ = TFT_PIO_HEADER(1, 0, 2);
+    *p++ = y0;
+    *p++ = y1;
+    *p++ = TFT_PIO_HEADER(0, 1, 1);
+    *p++ = ST7735_RAMWR << 8;
+    *p++ = TFT_PIO_HEADER(1, 0, count);
+
+    writePin(TFT_CS, false);
+    tft_in_flight = true;
+    tft_dma_setup(tft_dma_chan[1], &TFT_PIO->txf[tft_sm], pixels, count,
+                  tft_dma_ctrl | (increment ? DMA_CH0_CTRL_TRIG_INCR_READ_BITS : 0) | DMA_CTRL_CHAIN_TO(tft_dma_chan[1]), false);
+    tft_dma_setup(tft_dma_chan[0], &TFT_PIO->txf[tft_sm], tft_preamble, p - tft_preamble,
+                  tft_dma_ctrl | DMA_CH0_CTRL_TRIG_INCR_READ_BITS | DMA_CTRL_CHAIN_TO(tft_dma_chan[1]), true);
+}
+#else
+// SPI0 (PL022) on GP2/GP3, mode 0, driven by register; CS and DC stay
+// plain GPIOs
+#define TFT_SPI spi0_hw
+
+static uint8_t tft_dma_chan;
+
+// Frame size, changed with the SSP disabled
+static void tft_spi_frame_bits(uint8_t bits) {
+    TFT_SPI->cr1 &= ~SPI_SSPCR1_SSE_BITS;
+    TFT_SPI->cr0 = (TFT_SPI->cr0 & ~SPI_SSPCR0_DSS_BITS) | ((uint32_t)(bits - 1) << SPI_SSPCR0_DSS_LSB);
+    TFT_SPI->cr1 |= SPI_SSPCR1_SSE_BITS;
+}
+
+// Wait until the last frame has left the shifter. Sending only leaves the
+// RX FIFO full and overrun, so drain it and clear the flag.
+static void tft_spi_drain(void) {
+    while (TFT_SPI->sr & SPI_SSPSR_BSY_BITS) {}
+    while (TFT_SPI->sr & SPI_SSPSR_RNE_BITS) (void)TFT_SPI->dr;
+    TFT_SPI->icr = SPI_SSPICR_RORIC_BITS;
+}
+
+static bool tft_bus_init(void) {
+    if (!tft_dma_alloc(&tft_dma_chan)) return false;
+
+    // Fastest clk_peri / (prescale * postdiv) not above TFT_SPI_HZ;
+    // prescale is even, 2..254, postdiv 1..256
+    uint32_t freq_in = clock_get_hz(clk_peri);
+    uint32_t prescale, postdiv;
+    for (prescale = 2; prescale < 254; prescale += 2) {
+        if (freq_in < (prescale + 2) * 256 * (uint64_t)TFT_SPI_HZ) break;
+    }
+    for (postdiv = 256; postdiv > 1; postdiv--) {
+        if (freq_in / (prescale * (postdiv - 1)) > TFT_SPI_HZ) break;
+    }
+
+    reset_block(RESETS_RESET_SPI0_BITS);
+    unreset_block_wait(RESETS_RESET_SPI0_BITS);
+    TFT_SPI->cpsr = prescale;
+    TFT_SPI->cr0 = (postdiv - 1) << SPI_SSPCR0_SCR_LSB;
+    TFT_SPI->dmacr = SPI_SSPDMACR_TXDMAE_BITS;
+    // 8-bit frames for commands
+    tft_spi_frame_bits(8);
+
+    // SCLK/MOSI to the SPI block
+    setPinOutput(TFT_DC);
+    gpio_set_function(TFT_SCLK, GPIO_FUNC_SPI);
+    gpio_set_function(TFT_MOSI, GPIO_FUNC_SPI);
+    uprintf("ST7735 display_init: SPI at %lu Hz\n", (unsigned long)(freq_in / (prescale * postdiv)));
+    return true;
+}
+
+// Wait out a window started by tft_write_window() and release the bus.
+// Every command goes through here, so callers never see a half-sent window.
+static void tft_finish(void) {
+    if (!tft_in_flight) return;
+    while (tft_dma_busy(tft_dma_chan)) {}
+    tft_spi_drain();
+    writePin(TFT_CS, true);
+    tft_spi_frame_bits(8);
+    tft_in_flight = false;
+}
+
+// True while a window is still streaming. Once false, tft_finish() only
+// waits for the few frames left in the SPI FIFO.
+static bool tft_busy(void) {
+    return tft_in_flight && tft_dma_busy(tft_dma_chan);
+}
+
+// Blocking command or parameter bytes, one CS cycle
+static void tft_write(bool dc, const uint8_t *data, uint8_t len) {
+    tft_finish();
+    writePin(TFT_DC, dc);
     writePin(TFT_CS, false);  // Select display
-    spi_write_byte(cmd);
+    for (uint8_t i = 0; i < len; i++) {
+        while (!(TFT_SPI->sr & SPI_SSPSR_TNF_BITS)) {}
+        TFT_SPI->dr = data[i];
+    }
+    tft_spi_drain();
     writePin(TFT_CS, true);   // Deselect
 }
 
-static void st7735_write_data(uint8_t data) {
+static void st7735_set_addr_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+
+// Set the window, then stream its pixels with 16-bit SPI frames (high byte
+// first on the wire, as the panel wants). Returns as soon as the DMA is
+// running; increment false repeats *pixels.
+static void tft_write_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, const uint16_t *pixels, bool increment) {
+    uint32_t count = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+    st7735_set_addr_window(x0, y0, x1, y1);
+
     writePin(TFT_DC, true);   // Data mode
     writePin(TFT_CS, false);  // Select display
-    spi_write_byte(data);
-    writePin(TFT_CS, true);   // Deselect
+    tft_spi_frame_bits(16);
+
+    tft_in_flight = true;
+    tft_dma_setup(tft_dma_chan, &TFT_SPI->dr, pixels, count,
+                  DMA_CH0_CTRL_TRIG_EN_BITS | DMA_CTRL_SIZE(HALFWORD) | (increment ? DMA_CH0_CTRL_TRIG_INCR_READ_BITS : 0) |
+                      DMA_CTRL_TREQ(DREQ_SPI0_TX) | DMA_CTRL_CHAIN_TO(tft_dma_chan),
+                  true);
+}
+#endif
+
+static void st7735_write_command(uint8_t cmd) {
+    tft_write(false, &cmd, 1);  // Command mode
+}
+
+static void st7735_write_data(uint8_t data) {
+    tft_write(true, &data, 1);  // Data mode
 }
 
 static void st7735_write_data_16(uint16_t data) {
-    writePin(TFT_DC, true);   // Data mode
-    writePin(TFT_CS, false);  // Select display
-    spi_write_byte(data >> 8);    // High byte
-    spi_write_byte(data & 0xFF);  // Low byte
-    writePin(TFT_CS, true);   // Deselect
+    uint8_t bytes[2] = {data >> 8, data & 0xFF};  // High byte first
+    tft_write(true, bytes, 2);
+}
+
+// Switch the panel's RGB/BGR order; only costs a command when it changes
+static void st7735_set_bgr(bool bgr) {
+    uint8_t madctl = bgr ? (TFT_MADCTL | ST7735_MADCTL_BGR) : TFT_MADCTL;
+    if (madctl == tft_madctl) return;
+    st7735_write_command(ST7735_MADCTL);
+    st7735_write_data(madctl);
+    tft_madctl = madctl;
 }
 
+#ifndef TFT_PIO_BUS
 static void st7735_set_addr_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
     st7735_write_command(ST7735_CASET); // Column addr set
     st7735_write_data_16(x0);
@@ -63,6 +384,7 @@ static void st7735_set_addr_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y
 
     st7735_write_command(ST7735_RAMWR); // Write to RAM
 }
+#endif
 
 // ST7735R initialization sequence (144 GREEN TAB)
 static void st7735_init_r_144_green(void) {
@@ -127,7 +449,8 @@ static void st7735_init_r_144_green(void) {
     // 0x60 -> 90° clockwise (MV | MX)
     // 0xC0 -> 180° (MX | MY) 
     // 0xA0 -> 270° clockwise / 90° counter-clockwise (MV | MY)
-    st7735_write_data(0xA0);  // Currently 270° clockwise
+    st7735_write_data(TFT_MADCTL);  // Currently 270° clockwise
+    tft_madctl = TFT_MADCTL;
 
     // Color mode - 16-bit color
     st7735_write_command(ST7735_COLMOD);
@@ -165,15 +488,16 @@ bool display_init(void) {
     
     // Configure pins
     setPinOutput(TFT_CS);
-    setPinOutput(TFT_DC);
     setPinOutput(TFT_RST);
-    setPinOutput(TFT_SCLK);
-    setPinOutput(TFT_MOSI);
     
     // Initial pin states
     writePin(TFT_CS, true);   // Deselect
-    writePin(TFT_SCLK, false);
-    writePin(TFT_MOSI, false);
+
+    // SCLK/MOSI/DC to the SPI block or the PIO state machine
+    if (!tft_bus_init()) {
+        uprintf("ST7735 display_init: no free DMA channel\n");
+        return false;
+    }
     
     // Hardware reset
     writePin(TFT_RST, true);
@@ -193,19 +517,7 @@ bool display_init(void) {
 }
 
 void display_clear(void) {
-    if (!display_initialized) return;
-    
-    st7735_set_addr_window(0, 0, TFT_WIDTH-1, TFT_HEIGHT-1);
-    
-    writePin(TFT_DC, true);   // Data mode
-    writePin(TFT_CS, false);  // Select display
-    
-    for (uint16_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
-        spi_write_byte(0x00); // Black - high byte
-        spi_write_byte(0x00); // Black - low byte
-    }
-    
-    writePin(TFT_CS, true);   // Deselect
+    display_fill_rgb(0, 0, 0);
 }
 
 void display_fill_rgb(uint8_t r, uint8_t g, uint8_t b) {
@@ -213,62 +525,27 @@ void display_fill_rgb(uint8_t r, uint8_t g, uint8_t b) {
     
     uint16_t color = RGB565(r, g, b);
     
-    st7735_set_addr_window(0, 0, TFT_WIDTH-1, TFT_HEIGHT-1);
-    
-    writePin(TFT_DC, true);   // Data mode
-    writePin(TFT_CS, false);  // Select display
-    
-    for (uint16_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
-        spi_write_byte(color >> 8);     // High byte
-        spi_write_byte(color & 0xFF);   // Low byte
-    }
-    
-    writePin(TFT_CS, true);   // Deselect
-}
-
-// Function to swap red and blue channels in RGB565
-static uint16_t swap_rb_rgb565(uint16_t color) {
-    // Extract R, G, B components
-    uint8_t r = (color >> 11) & 0x1F;  // 5 bits red
-    uint8_t g = (color >> 5) & 0x3F;   // 6 bits green
-    uint8_t b = color & 0x1F;          // 5 bits blue
-    
-    // Swap red and blue channels
-    return (b << 11) | (g << 5) | r;   // BGR565 -> RGB565
+    st7735_set_bgr(false);
+    tft_finish();
+    tft_fill_color = color;
+    tft_write_window(0, 0, TFT_WIDTH-1, TFT_HEIGHT-1, &tft_fill_color, false);
 }
 
+// Frames go out by DMA straight from flash; these return while the pixels
+// are still streaming and the next command waits for them
 void display_draw_rgb565_frame(const uint16_t *pixels, uint16_t w, uint16_t h) {
     if (!display_initialized || !pixels) return;
     
-    st7735_set_addr_window(0, 0, w-1, h-1);
-    
-    writePin(TFT_DC, true);   // Data mode
-    writePin(TFT_CS, false);  // Select display
-    
-    for (uint16_t i = 0; i < w * h; i++) {
-        uint16_t pixel = pixels[i];
-        spi_write_byte(pixel >> 8);     // High byte
-        spi_write_byte(pixel & 0xFF);   // Low byte
-    }
-    
-    writePin(TFT_CS, true);   // Deselect
+    st7735_set_bgr(false);
+    tft_write_window(0, 0, w-1, h-1, pixels, true);
 }
 
+// Frames stored BGR565: the panel swaps red and blue via MADCTL
 void display_draw_rgb565_frame_rb_swapped(const uint16_t *pixels, uint16_t w, uint16_t h) {
     if (!display_initialized || !pixels) return;
     
-    st7735_set_addr_window(0, 0, w-1, h-1);
-    
-    writePin(TFT_DC, true);   // Data mode
-    writePin(TFT_CS, false);  // Select display
-    
-    for (uint16_t i = 0; i < w * h; i++) {
-        uint16_t pixel = swap_rb_rgb565(pixels[i]);  // Swap red and blue channels
-        spi_write_byte(pixel >> 8);     // High byte
-        spi_write_byte(pixel & 0xFF);   // Low byte
-    }
-    
-    writePin(TFT_CS, true);   // Deselect
+    st7735_set_bgr(true);
+    tft_write_window(0, 0, w-1, h-1, pixels, true);
 }
 
 void display_test_pattern(void) {
@@ -284,7 +561,10 @@ void display_test_pattern(void) {
 }
 
 // Optional init GIF support: check if init header exists
-#if __has_include("gif/init.h")
+#if __has_include("gif/init_packed.h")
+#define HAVE_INIT_GIF_FILE 1
+#include "gif/init_packed.h"
+#elif __has_include("gif/init.h")
 #define HAVE_INIT_GIF_FILE 1
 #include "gif/init.h"
 #else
@@ -294,6 +574,10 @@ void display_test_pattern(void) {
 // Simple container for a GIF dataset
 typedef struct {
     const uint16_t *pixels;
+    const uint8_t *packed;     // gif_codec.h frames instead of pixels; offsets are then in bytes
+    const uint8_t (*rects)[4]; // packed: changed rectangles (x0, y0, x1, y1) since the previous frame
+    const uint16_t *rect_index; // packed: first rect of each frame
+    bool wrap;                 // packed: entry [frames] takes the last frame back to frame 0
     const uint32_t *offsets;
     const uint16_t *delays;
     uint32_t frames;
@@ -305,8 +589,16 @@ typedef struct {
 #if BUILD_WITH_GIFS
     #if defined(GIF_FRAMES)
     static const gif_set_t main_gif = {
+        #if defined(GIF_PACKED)
+        .packed = gif_packed,
+        .rects = gif_rects,
+        .rect_index = gif_rect_index,
+        .wrap = GIF_WRAP,
+        .offsets = gif_packed_offsets,
+        #else
         .pixels = gif_pixels,
         .offsets = gif_offsets,
+        #endif
         .delays = gif_delays,
         .frames = GIF_FRAMES,
         .width = GIF_W,
@@ -318,8 +610,16 @@ typedef struct {
 
     #if defined(INIT_GIF_FRAMES)
     static const gif_set_t init_gif = {
+        #if defined(INIT_GIF_PACKED)
+        .packed = init_gif_packed,
+        .rects = init_gif_rects,
+        .rect_index = init_gif_rect_index,
+        .wrap = INIT_GIF_WRAP,
+        .offsets = init_gif_packed_offsets,
+        #else
         .pixels = init_gif_pixels,
         .offsets = init_gif_offsets,
+        #endif
         .delays = init_gif_delays,
         .frames = INIT_GIF_FRAMES,
         .width = INIT_GIF_W,
@@ -339,28 +639,61 @@ static const gif_set_t *cur_gif = NULL;
 static bool cur_loop = false;
 static bool init_phase = false; // true while playing init gif
 
-// Helper: switch current gif and draw first frame
+// Frame being sent: the window open on the panel and its next row. Raw
+// frames are one full window. Packed frames only send what changed since
+// the previous frame (the screen must still show it): windows for rects
+// rect_next up to rect_end are still to come, and a frame without any
+// costs nothing.
+static const uint16_t *frame_pixels = NULL;
+static struct {
+    uint8_t x0, y0, x1, y1;
+} win;
+static uint16_t frame_row = 0;
+static uint16_t rect_next = 0;
+static uint16_t rect_end = 0;
+
+// Packed frames: decoder position and the ping-pong row buffers. Rows
+// [frame_row, frame_row + decode_rows) are decoded into decode_buf[decode_half].
+static gif_codec_t decoder;
+static uint16_t decode_buf[2][DISPLAY_DECODE_ROWS * TFT_WIDTH];
+static uint8_t decode_half = 0;
+static uint8_t decode_rows = 0;
+
+// Queue frame n of the current gif; display_update_animation() sends it.
+// wrap: frame 0 after the last one, sent as a delta when the gif has one.
+static void anim_begin_frame(uint16_t n, bool wrap) {
+    current_frame = n;
+    if (cur_gif->packed) {
+        uint16_t entry = (wrap && cur_gif->wrap) ? cur_gif->frames : n;
+        gif_codec_begin(&decoder, &cur_gif->packed[cur_gif->offsets[entry]]);
+        rect_next = cur_gif->rect_index[entry];
+        rect_end = cur_gif->rect_index[entry + 1];
+        win.y1 = 0;
+        frame_row = 1;  // no window open yet
+        decode_rows = 0;
+    } else {
+        frame_pixels = &cur_gif->pixels[cur_gif->offsets[n]];
+        win.x0 = 0;
+        win.y0 = 0;
+        win.x1 = cur_gif->width - 1;
+        win.y1 = cur_gif->height - 1;
+        frame_row = 0;
+        rect_next = rect_end = 0;
+    }
+    last_frame_time = timer_read32();
+}
+
+// Helper: switch current gif and queue its first frame
 static void set_current_gif(const gif_set_t *gif, bool loop) {
 #if BUILD_WITH_GIFS
-    if (!gif || gif->frames == 0) {
+    if (!gif || gif->frames == 0 || (gif->packed && gif->width > TFT_WIDTH)) {
         cur_gif = NULL;
         cur_loop = false;
         return;
     }
     cur_gif = gif;
     cur_loop = loop;
-    current_frame = 0;
-    last_frame_time = timer_read32();
-    // Draw first frame immediately with appropriate color handling
-    const uint16_t *pixels = &cur_gif->pixels[cur_gif->offsets[0]];
-    
-    if (init_phase) {
-        // Init gif - normal colors
-        display_draw_rgb565_frame(pixels, cur_gif->width, cur_gif->height);
-    } else {
-        // Main gif - swap red and blue channels
-        display_draw_rgb565_frame_rb_swapped(pixels, cur_gif->width, cur_gif->height);
-    }
+    anim_begin_frame(0, false);
 #else
     // GIFs disabled: no-op
     (void)gif;
@@ -409,6 +742,86 @@ void display_stop_animation(void) {
     uprintf("ST7735: animation stopped\n");
 }
 
+// Open the next changed rect once the current window is sent; false when
+// the frame is complete
+static bool anim_next_window(void) {
+    if (frame_row <= win.y1) return true;
+    if (rect_next == rect_end) return false;
+
+    const uint8_t *r = cur_gif->rects[rect_next++];
+    win.x0 = r[0];
+    win.y0 = r[1];
+    win.x1 = r[2];
+    win.y1 = r[3];
+    frame_row = win.y0;
+    return true;
+}
+
+// One step of sending the window; false when it has to wait for the bus.
+// Raw frames go out whole from flash. Packed frames decode one row per
+// step into the free buffer, then send the buffer once the bus is free.
+// Init gif - normal colors, main gif - red and blue swapped by the panel.
+static bool anim_send_slice(void) {
+    uint16_t w = win.x1 - win.x0 + 1;
+    uint16_t rows = win.y1 + 1 - frame_row;
+    const uint16_t *pixels;
+
+    if (cur_gif->packed) {
+        if (rows > DISPLAY_DECODE_ROWS) rows = DISPLAY_DECODE_ROWS;
+        uint16_t *buf = decode_buf[decode_half];
+        if (decode_rows < rows) {
+            gif_codec_decode(&decoder, &buf[decode_rows * w], w);
+            decode_rows++;
+            return true;
+        }
+        pixels = buf;
+    } else {
+        pixels = &frame_pixels[(uint32_t)frame_row * cur_gif->width + win.x0];
+    }
+
+    if (tft_busy()) return false;
+    st7735_set_bgr(!init_phase);
+    tft_write_window(win.x0, frame_row, win.x1, frame_row + rows - 1, pixels, true);
+    frame_row += rows;
+    decode_half ^= 1;
+    decode_rows = 0;
+    return true;
+}
+
+// Queue the next frame once the current one has been up for its delay;
+// false when there is nothing (more) to send
+static bool anim_advance(void) {
+    if (cur_gif->frames <= 1 && cur_loop) return false; // nothing to do
+
+    uint16_t frame_delay = cur_gif->delays[current_frame];
+    if (frame_delay == 0) frame_delay = 100; // Default 100ms
+    
+    // Apply speed multiplier (100 = normal speed, 50 = half speed, 200 = double speed)
+    frame_delay = (frame_delay * 100) / ANIMATION_SPEED_MULTIPLIER;
+    if (TIMER_DIFF_32(timer_read32(), last_frame_time) < frame_delay) return false;
+
+    uint16_t next = current_frame + 1;
+    bool wrap = false;
+    if (next >= cur_gif->frames) {
+        if (cur_loop) {
+            next = 0;
+            wrap = true;
+        } else if (init_phase) {
+            // non-looping init gif finished: switch to main gif and loop
+            init_phase = false;
+            set_current_gif(&main_gif, true);
+            return cur_gif != NULL;
+        } else {
+            animation_playing = false;
+            return false;
+        }
+    }
+    anim_begin_frame(next, wrap);
+    return true;
+}
+
+// Resumable: each call picks up where the last one stopped, never waits on
+// the bus and gives up after DISPLAY_TASK_BUDGET_US (checked between rows)
 void display_update_animation(void) {
 #if !BUILD_WITH_GIFS
     // GIFs disabled at build time
@@ -419,45 +832,13 @@ void display_update_animation(void) {
 #endif
     if (!animation_playing || !display_initialized || !cur_gif) return;
 
-    if (cur_gif->frames <= 1 && cur_loop) return; // nothing to do
-
-    uint32_t now = timer_read32();
-    uint16_t frame_delay = cur_gif->delays[current_frame];
-    if (frame_delay == 0) frame_delay = 100; // Default 100ms
-    
-    // Apply speed multiplier (100 = normal speed, 50 = half speed, 200 = double speed)
-    frame_delay = (frame_delay * 100) / ANIMATION_SPEED_MULTIPLIER;
-
-    if (TIMER_DIFF_32(now, last_frame_time) >= frame_delay) {
-        // advance frame
-        current_frame++;
-        if (current_frame >= cur_gif->frames) {
-            if (cur_loop) {
-                current_frame = 0;
-            } else {
-                // non-looping gif finished
-                if (init_phase) {
-                    // switch to main gif and loop
-                    init_phase = false;
-                    set_current_gif(&main_gif, true);
-                    return;
-                } else {
-                    animation_playing = false;
-                    return;
-                }
-            }
-        }
-        const uint16_t *pixels = &cur_gif->pixels[cur_gif->offsets[current_frame]];
-        
-        // Use red-blue channel swap for main gif, normal colors for init gif
-        if (init_phase) {
-            // Init gif - normal colors
-            display_draw_rgb565_frame(pixels, cur_gif->width, cur_gif->height);
-        } else {
-            // Main gif - swap red and blue channels
-            display_draw_rgb565_frame_rb_swapped(pixels, cur_gif->width, cur_gif->height);
+    uint32_t start_us = time_us_32();
+    do {
+        if (anim_next_window()) {
+            // Window still streaming and nothing to decode: next pass
+            if (!anim_send_slice()) return;
+        } else if (!anim_advance()) {
+            return;
         }
-        
-        last_frame_time = now;
-    }
+    } while (time_us_32() - start_us < DISPLAY_TASK_BUDGET_US);
 }
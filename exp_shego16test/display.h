@@ -32,6 +32,7 @@
 #define ST7735_PTLAR   0x30
 #define ST7735_COLMOD  0x3A
 #define ST7735_MADCTL  0x36
+#define ST7735_MADCTL_BGR 0x08
 #define ST7735_FRMCTR1 0xB1
 #define ST7735_FRMCTR2 0xB2
 #define ST7735_FRMCTR3 0xB3
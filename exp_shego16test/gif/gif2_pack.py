@@ -0,0 +1,264 @@
+# gif2_pack.py
+# Packs animation frames into the gif_codec.h format (QOI-style RGB565 byte
+# stream per frame) and writes a header display.c plays instead of the raw
+# frames: gif_packed.h for the main gif, init_packed.h for the init gif.
+#
+# Frame 0 is stored whole. Every later frame only stores the rectangles
+# that changed since the frame before it, one codec stream across all of
+# them, so identical frames store (and send) nothing. A looping gif also
+# gets a last entry that takes the last frame back to frame 0 (unless that
+# is no smaller than frame 0); --once leaves it out for gifs played once.
+#
+# Input is either a .gif (resized like gif2_shrink.py, needs PIL) or an
+# already generated raw header (gif.h, init.h, lick.h), so existing assets
+# pack without re-quantising. --check replays every frame with a port of
+# gif_codec.c and compares it with the input.
+#
+# Usage: python gif2_pack.py gif.h gif_packed.h
+#        python gif2_pack.py init.h init_packed.h --prefix init_gif --once
+#        python gif2_pack.py anim.gif gif_packed.h --size 128 128 [--max-frames 30]
+import argparse
+import re
+import sys
+
+OP_DIFF, OP_LUMA, OP_RUN, OP_RGB = 0x40, 0x80, 0xC0, 0xFE
+MAX_RUN = 62
+# What one more display window costs (commands, DMA set-up) in pixels
+WINDOW_COST = 32
+
+
+def slot(c):
+    return ((c >> 11) * 3 + ((c >> 5) & 63) * 5 + (c & 31) * 7) & 63
+
+
+def split(c):
+    return c >> 11, (c >> 5) & 63, c & 31
+
+
+def encode(frame):
+    out = bytearray()
+    table = [0] * 64
+    prev = run = 0
+    for c in frame:
+        if c == prev:
+            run += 1
+            if run == MAX_RUN:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+
+        i = slot(c)
+        if table[i] == c:
+            out.append(i)
+        else:
+            table[i] = c
+            r, g, b = split(c)
+            pr, pg, pb = split(prev)
+            dr, dg, db = r - pr, g - pg, b - pb
+            # Green has one more bit than red and blue, so they follow g/2
+            dr_dg, db_dg = dr - (dg >> 1), db - (dg >> 1)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out += bytes([OP_LUMA | (dg + 32), (dr_dg + 8) << 4 | (db_dg + 8)])
+            else:
+                out += bytes([OP_RGB, c >> 8, c & 0xFF])
+        prev = c
+    if run:
+        out.append(OP_RUN | (run - 1))
+    return bytes(out)
+
+
+def decode(data, count):
+    """Port of gif_codec_decode() for --check."""
+    out = []
+    table = [0] * 64
+    px = pos = 0
+    while len(out) < count:
+        op = data[pos]
+        pos += 1
+        if op < OP_DIFF:
+            px = table[op]
+        elif op < OP_LUMA:
+            r, g, b = split(px)
+            px = ((r + (op >> 4 & 3) - 2) & 31) << 11 | ((g + (op >> 2 & 3) - 2) & 63) << 5 | ((b + (op & 3) - 2) & 31)
+        elif op < OP_RUN:
+            dg = (op & 63) - 32
+            rb = data[pos]
+            pos += 1
+            r, g, b = split(px)
+            px = ((r + (rb >> 4) - 8 + (dg >> 1)) & 31) << 11 | ((g + dg) & 63) << 5 | ((b + (rb & 15) - 8 + (dg >> 1)) & 31)
+        elif op == OP_RGB:
+            px = data[pos] << 8 | data[pos + 1]
+            pos += 2
+        else:
+            out += [px] * ((op & 63) + 1)
+            continue
+        table[slot(px)] = px
+        out.append(px)
+    return out[:count], pos
+
+
+def dirty_rects(prev, cur, w, h):
+    """Changed rows' spans, merged downwards while one bounding box costs
+    less than a new window. Rects are (x0, y0, x1, y1), inclusive."""
+    def area(r):
+        return (r[2] - r[0] + 1) * (r[3] - r[1] + 1)
+
+    rects, open_rect = [], None
+    for y in range(h):
+        xs = [x for x in range(w) if prev[y * w + x] != cur[y * w + x]]
+        if not xs:
+            continue
+        span = (xs[0], y, xs[-1], y)
+        if open_rect:
+            merged = (min(open_rect[0], xs[0]), open_rect[1], max(open_rect[2], xs[-1]), y)
+            if area(merged) <= area(open_rect) + area(span) + WINDOW_COST:
+                open_rect = merged
+                continue
+            rects.append(open_rect)
+        open_rect = span
+    if open_rect:
+        rects.append(open_rect)
+    return rects
+
+
+def rect_pixels(frame, w, rects):
+    out = []
+    for x0, y0, x1, y1 in rects:
+        for y in range(y0, y1 + 1):
+            out += frame[y * w + x0:y * w + x1 + 1]
+    return out
+
+
+def pack(frames, w, h, loop):
+    """[(rects, data)] per frame, plus the wrap to frame 0 when looping. A
+    delta that doesn't pack smaller than the whole frame is sent whole; a
+    whole wrap is dropped, frame 0 itself does the same job."""
+    full = [(0, 0, w - 1, h - 1)]
+    entries = [(full, encode(frames[0]))]
+    steps = list(zip(frames, frames[1:]))
+    if loop and len(frames) > 1:
+        steps.append((frames[-1], frames[0]))
+    for prev, cur in steps:
+        rects = dirty_rects(prev, cur, w, h)
+        data = encode(rect_pixels(cur, w, rects))
+        whole = encode(cur)
+        entries.append((rects, data) if len(data) <= len(whole) else (full, whole))
+    if len(entries) > len(frames) and entries[-1][0] == full:
+        entries.pop()
+    return entries
+
+
+def load_header(path):
+    text = open(path).read()
+    w = int(re.search(r"#define \w*_W (\d+)", text).group(1))
+    h = int(re.search(r"#define \w*_H (\d+)", text).group(1))
+    delays = [int(v) for v in re.search(r"_delays\[[^\]]*\] = \{([^}]*)\}", text).group(1).split(",")]
+    body = text[text.index("_pixels["):]
+    pixels = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{4})", body)]
+    n = w * h
+    return w, h, [pixels[i:i + n] for i in range(0, len(pixels), n)], delays
+
+
+def load_gif(path, w, h, max_frames):
+    from PIL import Image, ImageSequence
+
+    frames, delays = [], []
+    for f in ImageSequence.Iterator(Image.open(path)):
+        if max_frames is not None and len(frames) >= max_frames:
+            break
+        rgb = f.convert("RGB").resize((w, h))
+        delays.append(int(f.info.get("duration", 100)))  # ms per frame
+        frames.append([((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3) for r, g, b in rgb.getdata()])
+    return w, h, frames, delays
+
+
+def write_header(path, prefix, w, h, frames, entries, delays):
+    macro = prefix.upper()
+    offsets, index, rects = [0], [0], []
+    for entry_rects, data in entries:
+        offsets.append(offsets[-1] + len(data))
+        rects += entry_rects
+        index.append(len(rects))
+    wrap = len(entries) > frames
+    with open(path, "w") as out:
+        out.write("// Auto-generated by gif2_pack.py (gif_codec.h format)\n")
+        out.write("#pragma once\n#include <stdint.h>\n\n")
+        out.write(f"#define {macro}_W {w}\n#define {macro}_H {h}\n#define {macro}_FRAMES {frames}\n")
+        out.write(f"#define {macro}_PACKED 1\n")
+        out.write(f"#define {macro}_WRAP {int(wrap)}  // entry {macro}_FRAMES goes from the last frame to frame 0\n")
+        out.write(f"#define {macro}_RECTS {len(rects)}\n\n")
+        # One more entry than frames with the wrap, plus the end
+        count = f"{macro}_FRAMES+{macro}_WRAP+1"
+        out.write(f"static const uint32_t {prefix}_packed_offsets[{count}] = {{")
+        out.write(",".join(map(str, offsets)))
+        out.write("};\n")
+        out.write(f"static const uint16_t {prefix}_rect_index[{count}] = {{")
+        out.write(",".join(map(str, index)))
+        out.write("};\n")
+        out.write(f"static const uint8_t {prefix}_rects[{macro}_RECTS][4] = {{")
+        out.write(",".join("{%d,%d,%d,%d}" % r for r in rects))
+        out.write("};\n")
+        out.write(f"static const uint16_t {prefix}_delays[{macro}_FRAMES] = {{")
+        out.write(",".join(map(str, delays)))
+        out.write("};\n")
+        out.write(f"static const uint8_t {prefix}_packed[{offsets[-1]}] = {{\n")
+        flat = b"".join(data for _, data in entries)
+        for i in range(0, len(flat), 32):
+            out.write(",".join(f"0x{v:02X}" for v in flat[i:i + 32]) + ",\n")
+        out.write("};\n")
+    return offsets[-1], len(rects)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="pack animation frames for gif_codec.c")
+    ap.add_argument("input", help=".gif, or a raw header from gif2*.py")
+    ap.add_argument("output", help="header to write, e.g. gif_packed.h")
+    ap.add_argument("--prefix", default="gif", help="symbol prefix: gif (main) or init_gif")
+    ap.add_argument("--size", nargs=2, type=int, default=(128, 128), metavar=("W", "H"),
+                    help="frame size for .gif input")
+    ap.add_argument("--max-frames", type=int)
+    ap.add_argument("--once", action="store_true", help="played once: no wrap back to frame 0")
+    ap.add_argument("--check", action="store_true", help="decode again and compare")
+    args = ap.parse_args()
+
+    if args.input.endswith(".h"):
+        w, h, frames, delays = load_header(args.input)
+    else:
+        w, h, frames, delays = load_gif(args.input, *args.size, args.max_frames)
+    if w > 128:
+        raise SystemExit(f"{w} px wide frames don't fit the display line buffer (128)")
+
+    entries = pack(frames, w, h, not args.once)
+    size, rect_count = write_header(args.output, args.prefix, w, h, len(frames), entries, delays)
+    raw = len(frames) * w * h * 2
+    sent = sum(len(rect_pixels(frames[0], w, rects)) for rects, _ in entries[1:])
+    print(f"Wrote {args.output} ({len(frames)} frames, {w}x{h}, {size} bytes packed, "
+          f"{raw} raw, {raw / size:.2f}x; largest frame {max(len(d) for _, d in entries)} bytes)")
+    if len(entries) > 1:
+        print(f"after frame 0: {rect_count - 1} rects, {sent / ((len(entries) - 1) * w * h):.1%} of the pixels sent")
+
+    if args.check:
+        # Replay like display.c: each entry's rects onto the previous screen
+        screen = [0] * (w * h)
+        expect = frames + [frames[0]] * (len(entries) - len(frames))
+        for n, ((rects, data), frame) in enumerate(zip(entries, expect)):
+            pixels, used = decode(data, len(rect_pixels(screen, w, rects)))
+            if used != len(data):
+                raise SystemExit(f"entry {n}: stream length mismatch")
+            for x0, y0, x1, y1 in rects:
+                for y in range(y0, y1 + 1):
+                    screen[y * w + x0:y * w + x1 + 1] = pixels[:x1 - x0 + 1]
+                    pixels = pixels[x1 - x0 + 1:]
+            if screen != frame:
+                raise SystemExit(f"entry {n}: round trip mismatch")
+        print(f"round trip OK ({len(entries)} entries)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
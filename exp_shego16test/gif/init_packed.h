@@ -0,0 +1,5072 @@
+// Auto-generated by gif2_pack.py (gif_codec.h format)
+#pragma once
+#include <stdint.h>
+
+#define INIT_GIF_W 128
+#define INIT_GIF_H 128
+#define INIT_GIF_FRAMES 35
+#define INIT_GIF_PACKED 1
+#define INIT_GIF_WRAP 0  // entry INIT_GIF_FRAMES goes from the last frame to frame 0
+#define INIT_GIF_RECTS 1406
+
+static const uint32_t init_gif_packed_offsets[INIT_GIF_FRAMES+INIT_GIF_WRAP+1] = {0,10235,16717,20058,22908,33241,34543,37474,46121,53728,61071,67111,70679,73534,79268,85182,91657,95175,97051,100748,106898,112594,115081,122102,123611,127265,133423,139207,140692,146279,149803,152468,158926,160209,161291,161756};
+static const uint16_t init_gif_rect_index[INIT_GIF_FRAMES+INIT_GIF_WRAP+1] = {0,1,81,164,248,256,315,380,386,392,398,404,471,552,558,565,572,655,720,805,816,830,885,896,950,1022,1034,1048,1118,1127,1196,1264,1275,1327,1378,1406};
+static const uint8_t init_gif_rects[INIT_GIF_RECTS][4] = {{0,0,127,127},{60,0,60,0},{61,1,108,1},{99,3,121,3},{61,4,125,4},{99,5,123,5},{95,7,95,7},{39,8,126,9},{0,10,121,10},{7,11,87,11},{46,12,127,12},{15,13,60,14},{41,16,116,16},{29,17,74,20},{63,21,127,22},{27,23,127,27},{74,28,121,28},{42,29,123,29},{84,30,86,30},{27,31,127,33},{41,34,91,34},{10,35,125,36},{41,37,120,38},{7,39,121,40},{80,41,127,41},{0,42,121,46},{9,47,127,51},{21,52,106,53},{127,54,127,54},{20,55,127,56},{48,57,113,57},{2,58,127,59},{42,60,114,60},{8,61,102,62},{8,63,127,63},{7,64,91,65},{45,66,99,66},{7,67,127,69},{9,70,87,72},{7,73,125,73},{7,74,69,75},{16,76,125,77},{36,78,78,79},{58,80,58,80},{14,81,68,81},{46,82,123,82},{14,83,58,83},{52,84,92,84},{58,85,122,85},{42,86,72,86},{57,88,57,88},{28,89,123,90},{7,91,80,91},{36,92,84,92},{7,93,68,93},{31,94,93,94},{15,95,54,95},{35,96,120,96},{43,97,91,97},{9,98,53,98},{9,99,125,99},{6,100,54,101},{13,102,91,103},{29,104,126,105},{8,106,68,106},{8,107,127,107},{20,108,127,109},{9,110,70,111},{23,112,126,113},{26,114,61,114},{8,115,125,116},{87,117,123,117},{29,118,64,118},{59,119,116,119},{29,120,77,120},{66,121,122,121},{9,122,123,122},{8,123,63,123},{61,124,75,124},{28,126,65,126},{88,127,88,127},{103,2,125,3},{6,9,6,9},{6,11,87,11},{78,12,78,12},{8,13,10,13},{52,14,52,14},{41,16,74,16},{31,17,62,19},{30,20,30,20},{28,21,69,22},{67,23,124,23},{121,24,126,24},{71,25,71,25},{103,26,127,28},{42,29,127,29},{40,30,86,31},{46,32,118,32},{79,33,120,33},{41,34,51,34},{8,35,116,35},{42,36,125,36},{19,37,102,37},{116,38,120,38},{53,39,127,39},{127,40,127,40},{60,41,60,41},{23,42,127,42},{8,43,23,43},{21,44,120,45},{63,46,117,46},{0,47,117,47},{85,48,127,49},{21,50,117,50},{56,51,82,51},{52,52,53,52},{42,53,82,53},{53,54,56,54},{41,55,82,55},{53,57,104,57},{41,58,48,58},{15,59,127,60},{15,61,94,61},{41,62,82,62},{8,63,97,64},{49,65,80,66},{17,67,74,67},{64,68,64,68},{95,69,95,69},{7,72,78,73},{88,74,127,74},{69,75,69,75},{36,76,98,77},{58,78,80,79},{39,80,95,80},{74,81,77,81},{46,82,46,82},{38,83,91,84},{53,85,122,85},{60,86,94,86},{16,88,75,88},{51,89,76,91},{68,92,84,93},{15,94,72,95},{18,96,42,96},{91,98,91,98},{37,99,54,99},{29,100,53,101},{11,102,70,103},{8,104,43,104},{8,105,89,105},{11,106,43,106},{89,107,127,107},{40,108,51,108},{43,110,62,110},{9,111,126,112},{36,113,87,113},{22,114,70,116},{58,117,61,120},{63,121,72,121},{47,122,47,122},{47,124,70,124},{122,125,122,125},{30,127,49,127},{107,3,113,3},{127,6,127,6},{89,7,90,8},{0,9,0,9},{85,10,90,10},{8,13,24,14},{25,16,62,18},{31,19,32,19},{61,20,61,20},{28,21,65,21},{28,22,28,22},{67,23,67,23},{27,24,126,24},{71,25,72,25},{127,26,127,26},{27,27,27,27},{27,28,127,29},{77,30,103,30},{27,31,83,33},{40,35,126,35},{51,36,51,36},{41,37,78,37},{18,38,116,38},{47,39,127,40},{48,41,48,41},{54,42,125,42},{23,43,23,43},{23,44,116,44},{44,45,59,45},{23,46,114,46},{98,47,98,47},{23,48,84,48},{62,49,94,49},{43,51,113,51},{52,52,89,52},{41,53,64,53},{42,54,113,55},{127,56,127,56},{42,58,127,60},{55,61,60,61},{10,62,91,63},{62,64,77,64},{43,65,50,66},{17,67,50,68},{16,69,79,70},{65,71,77,71},{16,72,80,73},{37,76,37,76},{92,77,92,77},{38,78,38,78},{54,79,80,80},{56,81,123,81},{16,83,16,83},{36,84,74,84},{68,85,122,85},{14,86,72,86},{36,87,52,88},{52,89,123,90},{52,91,52,91},{84,92,84,92},{16,93,79,93},{35,94,44,94},{72,95,72,95},{32,96,32,96},{11,97,73,97},{47,98,49,98},{50,99,82,99},{31,101,31,101},{11,102,70,103},{54,104,54,104},{118,105,118,105},{20,106,66,106},{29,107,29,107},{50,108,56,108},{17,109,62,112},{22,113,36,114},{24,115,66,115},{36,116,87,116},{58,117,70,118},{47,119,116,119},{29,120,63,120},{34,121,63,122},{47,124,47,124},{28,127,28,127},{60,0,63,0},{60,1,127,3},{0,4,127,4},{60,5,127,5},{31,6,127,8},{0,9,127,16},{26,17,127,34},{0,35,127,127},{113,1,113,1},{51,14,51,14},{69,23,69,23},{90,30,90,30},{42,32,52,34},{23,35,26,39},{122,41,122,41},{48,42,48,42},{23,43,23,43},{85,44,85,44},{102,47,121,48},{22,50,22,50},{119,52,119,52},{53,53,53,53},{42,54,97,54},{43,55,53,55},{117,57,117,57},{66,58,66,58},{47,59,111,59},{54,60,54,60},{102,61,102,61},{52,62,101,62},{18,63,18,63},{61,64,100,64},{11,65,11,65},{5,66,104,66},{103,67,103,67},{77,68,77,68},{17,69,77,69},{33,71,66,71},{80,72,80,72},{61,73,70,75},{16,78,66,78},{36,80,79,81},{14,84,14,84},{40,85,40,85},{70,87,70,87},{56,89,56,89},{38,90,71,90},{52,91,78,92},{36,95,50,97},{7,98,7,98},{8,99,74,99},{15,101,53,101},{31,102,33,102},{51,103,124,103},{7,105,12,106},{18,109,18,109},{67,111,67,111},{50,112,91,113},{13,114,66,114},{22,115,55,116},{37,117,64,118},{36,120,36,120},{60,121,61,121},{61,124,127,124},{26,125,45,125},{60,126,64,126},{29,127,61,127},{91,7,91,7},{44,16,55,17},{33,18,33,18},{67,22,67,22},{127,26,127,26},{76,28,126,28},{44,30,79,30},{89,31,89,31},{25,34,25,34},{49,35,50,35},{8,36,82,37},{24,38,58,40},{42,41,48,43},{85,44,86,44},{44,46,104,46},{0,47,121,47},{18,48,18,48},{65,49,65,49},{22,50,22,50},{97,51,119,51},{20,53,86,53},{42,55,120,55},{51,56,57,57},{106,58,117,58},{44,59,117,60},{81,62,81,62},{39,63,39,63},{12,64,100,64},{52,65,104,65},{127,66,127,66},{5,68,59,69},{5,70,17,70},{5,71,66,71},{5,72,15,72},{5,73,61,73},{9,74,16,74},{7,75,71,76},{45,77,98,77},{65,78,65,78},{6,79,15,80},{47,81,47,81},{6,82,14,83},{7,84,38,84},{58,85,79,86},{5,87,75,90},{5,91,16,91},{5,92,56,93},{4,94,74,98},{8,99,8,99},{6,100,84,102},{47,103,47,103},{39,104,82,104},{7,105,80,106},{43,107,55,107},{18,108,71,108},{52,109,53,109},{39,110,122,110},{27,111,27,111},{55,112,73,113},{15,114,75,116},{27,117,82,117},{58,118,82,121},{35,122,70,124},{26,125,127,125},{46,126,65,127},{62,0,67,0},{62,1,127,1},{0,2,127,15},{24,16,122,24},{24,25,127,32},{0,33,127,127},{66,0,71,0},{66,1,127,1},{0,2,127,15},{24,16,121,24},{24,25,127,32},{0,33,127,127},{70,0,76,1},{69,2,127,7},{0,8,127,15},{24,16,122,31},{22,32,127,39},{0,40,127,127},{75,0,83,4},{74,5,127,6},{0,7,127,15},{22,16,122,31},{19,32,127,43},{0,44,127,127},{82,2,82,2},{9,9,9,9},{121,10,125,13},{114,16,114,16},{60,17,114,18},{44,19,109,19},{100,20,104,23},{89,28,93,29},{21,30,94,30},{23,31,23,31},{21,37,100,37},{46,38,56,39},{44,40,104,41},{19,42,105,42},{46,43,58,44},{123,45,123,45},{58,46,126,47},{0,48,67,48},{14,49,113,49},{47,50,109,51},{17,53,127,53},{47,54,76,54},{17,55,47,55},{66,56,77,56},{16,57,70,57},{51,58,114,58},{6,59,76,59},{46,60,79,61},{14,62,69,63},{47,64,75,64},{45,65,116,66},{47,67,74,67},{47,68,116,68},{81,71,117,71},{64,72,83,72},{79,74,116,74},{10,75,47,75},{64,76,119,76},{8,77,48,77},{49,78,127,79},{8,80,116,80},{46,81,124,86},{6,87,65,87},{44,88,112,88},{5,89,111,89},{3,90,5,90},{60,91,110,91},{43,92,59,92},{61,93,106,93},{47,94,47,94},{1,95,73,95},{31,96,71,97},{32,98,103,99},{3,100,42,100},{2,101,123,102},{44,103,127,104},{0,105,127,109},{30,110,123,110},{64,111,123,111},{47,112,127,114},{31,115,75,115},{32,116,124,117},{48,118,48,118},{32,119,89,119},{32,120,126,123},{36,124,74,124},{34,125,118,127},{122,10,125,11},{22,13,123,13},{78,14,120,14},{26,15,32,16},{40,17,114,18},{43,19,74,19},{35,20,35,20},{24,22,79,22},{23,23,23,23},{80,24,87,24},{24,26,99,26},{22,27,22,27},{89,29,96,30},{21,31,21,31},{93,32,100,36},{21,37,44,38},{45,39,102,39},{21,41,103,41},{57,42,57,42},{18,43,106,43},{50,44,58,44},{51,45,126,46},{60,48,68,48},{17,49,59,49},{52,50,67,50},{51,51,112,53},{48,54,48,54},{17,55,17,55},{52,56,114,56},{55,57,75,57},{16,58,114,58},{53,59,78,59},{58,60,114,60},{45,61,76,65},{45,66,116,66},{47,67,78,67},{83,68,83,68},{64,69,117,69},{45,71,118,71},{64,72,83,72},{47,73,116,73},{47,74,47,74},{66,75,79,76},{9,78,43,78},{60,79,126,79},{44,80,67,80},{45,81,121,84},{5,85,124,86},{4,87,68,87},{44,88,110,88},{5,89,107,89},{44,90,60,91},{59,92,109,92},{0,93,1,93},{64,94,106,94},{3,95,104,95},{32,96,60,97},{46,98,103,98},{1,99,127,99},{31,100,56,100},{29,101,125,101},{64,102,118,102},{30,103,76,103},{0,104,111,104},{29,105,104,107},{29,108,47,108},{29,109,105,109},{67,110,103,110},{64,111,64,111},{102,112,108,112},{49,113,106,114},{31,115,85,115},{80,116,106,117},{49,118,116,118},{72,119,116,120},{81,122,86,122},{33,123,106,123},{87,124,87,124},{33,125,79,125},{72,126,91,126},{34,127,92,127},{81,0,91,6},{0,7,89,9},{6,10,127,17},{0,18,127,35},{16,36,127,47},{0,48,127,127},{84,0,91,6},{0,7,89,10},{1,11,127,18},{37,19,127,19},{0,20,127,35},{15,36,127,52},{0,53,127,127},{82,0,86,8},{82,9,127,9},{0,10,127,16},{24,17,117,32},{22,33,112,44},{20,45,127,51},{0,52,127,127},{82,1,84,6},{126,9,126,9},{0,11,12,12},{20,14,123,14},{25,15,80,15},{121,16,121,16},{29,17,39,17},{36,19,77,20},{38,21,38,21},{27,24,105,25},{90,26,103,28},{25,29,95,30},{26,31,26,31},{95,32,99,32},{26,34,100,34},{99,35,104,37},{25,38,25,38},{108,39,108,39},{50,40,50,40},{48,41,109,41},{23,43,56,44},{47,45,119,47},{55,48,67,48},{53,49,118,49},{21,50,69,50},{62,51,76,51},{5,52,75,53},{55,54,115,54},{52,55,76,55},{21,56,79,56},{20,57,118,57},{59,58,71,58},{1,59,83,60},{20,61,120,61},{5,62,85,65},{16,66,85,68},{0,70,122,70},{70,71,72,71},{16,72,84,72},{71,73,120,73},{13,74,81,74},{80,75,80,75},{122,76,122,76},{53,77,68,77},{12,78,124,78},{70,79,120,79},{14,80,118,80},{53,81,78,81},{79,82,124,82},{13,83,75,83},{12,84,123,84},{54,85,62,85},{48,86,127,86},{11,87,115,87},{59,88,114,88},{50,89,50,89},{11,90,86,90},{12,91,50,91},{9,92,111,92},{63,93,63,93},{10,94,109,94},{62,95,108,95},{40,96,79,97},{3,98,78,98},{5,99,126,101},{66,102,122,102},{36,103,110,103},{7,104,117,105},{57,106,110,106},{3,107,84,107},{37,108,108,108},{6,109,86,109},{70,110,70,110},{75,111,108,111},{6,112,110,112},{36,113,36,113},{2,114,78,116},{4,117,111,118},{38,119,111,119},{4,120,88,120},{55,121,111,122},{78,123,124,126},{1,127,89,127},{15,14,122,14},{24,16,24,16},{43,19,43,19},{34,21,77,21},{81,23,81,23},{27,24,104,24},{96,28,100,36},{23,40,108,41},{52,43,52,43},{24,44,67,44},{47,45,109,45},{54,46,66,47},{21,48,72,48},{54,49,118,49},{60,50,73,52},{114,53,114,53},{6,54,6,54},{122,55,122,55},{64,56,74,56},{20,57,118,57},{78,58,80,58},{60,60,60,60},{62,61,82,62},{118,63,118,63},{19,64,84,64},{80,65,80,65},{16,67,81,68},{120,70,120,70},{18,71,70,71},{50,72,121,72},{16,75,16,75},{68,76,126,77},{12,78,49,78},{72,79,120,79},{51,80,51,80},{14,83,127,83},{54,84,123,84},{59,85,72,86},{61,87,115,90},{50,91,50,91},{10,92,113,92},{48,94,48,94},{61,95,74,98},{43,99,43,99},{105,100,127,100},{37,101,82,101},{49,102,108,102},{6,104,117,105},{8,106,78,106},{36,107,55,107},{6,108,111,108},{64,109,79,109},{7,110,7,110},{108,111,108,111},{6,112,107,112},{4,114,6,116},{37,117,114,117},{82,118,82,118},{38,119,95,119},{38,120,54,120},{86,121,94,122},{40,123,77,123},{84,124,110,125},{5,126,110,126},{92,127,110,127},{84,3,85,7},{126,10,126,10},{0,11,82,11},{7,12,125,12},{124,13,125,13},{15,14,125,17},{36,18,115,20},{33,21,70,21},{37,22,37,22},{27,23,85,23},{27,24,30,24},{89,25,102,25},{26,26,90,26},{92,27,102,28},{25,29,98,30},{98,31,98,31},{24,32,98,32},{97,33,98,33},{23,34,100,34},{102,36,105,37},{22,40,50,40},{22,41,108,42},{49,43,111,43},{22,44,64,44},{47,45,119,46},{22,47,112,47},{49,48,63,48},{55,49,114,50},{12,51,72,51},{1,52,48,52},{8,53,127,54},{20,55,78,57},{55,58,80,58},{44,59,118,59},{56,60,73,60},{4,61,82,62},{9,63,119,64},{66,65,75,65},{1,66,87,66},{61,67,85,67},{16,68,122,69},{85,70,122,70},{84,71,87,71},{121,72,121,72},{49,73,88,73},{53,74,53,74},{72,75,122,76},{15,77,126,77},{119,78,119,78},{80,79,120,79},{15,80,68,80},{11,81,120,81},{10,83,127,83},{11,84,73,85},{50,86,114,86},{11,87,115,87},{52,88,114,88},{50,89,70,91},{47,92,110,92},{10,93,111,93},{48,95,110,96},{0,97,46,97},{0,98,80,98},{55,99,107,99},{0,100,120,102},{59,103,110,103},{6,104,82,104},{35,105,106,105},{54,106,84,106},{7,107,116,107},{6,109,113,110},{56,111,108,111},{3,112,87,112},{80,114,111,114},{38,115,90,115},{4,116,114,116},{38,117,88,117},{4,118,111,119},{87,120,87,120},{38,121,87,121},{3,122,96,122},{89,123,122,123},{0,124,125,124},{39,125,94,125},{2,126,97,127},{82,4,85,8},{126,9,126,9},{0,10,126,10},{82,11,83,11},{0,12,127,12},{124,13,126,13},{12,14,122,18},{22,19,112,45},{21,46,125,50},{0,51,126,85},{0,86,127,127},{15,15,117,15},{24,16,39,18},{39,19,107,21},{28,22,84,24},{26,25,102,36},{23,37,111,45},{19,46,125,54},{15,55,123,64},{16,65,122,69},{49,70,127,70},{14,71,124,75},{6,76,127,92},{1,93,111,96},{0,97,127,127},{110,18,110,18},{38,19,38,19},{53,21,76,22},{81,23,81,23},{104,24,104,24},{98,33,106,40},{52,42,108,43},{107,44,107,44},{24,45,108,46},{55,47,122,47},{110,48,112,48},{21,49,111,50},{19,51,71,52},{54,53,126,54},{54,55,72,55},{20,56,72,56},{117,57,117,57},{52,58,78,64},{70,65,120,65},{63,66,77,66},{16,67,77,68},{50,69,79,70},{50,71,122,71},{16,72,77,72},{49,73,78,74},{13,75,49,75},{49,76,120,76},{14,77,119,77},{48,78,70,78},{68,79,121,79},{11,80,119,80},{69,82,121,82},{10,84,48,84},{48,85,70,85},{10,87,70,87},{56,88,114,89},{7,90,70,92},{48,93,79,96},{3,97,66,97},{66,98,108,98},{8,99,106,99},{40,100,106,101},{51,102,126,102},{62,103,104,103},{5,104,81,104},{35,105,107,105},{51,106,87,107},{67,108,105,109},{70,111,88,115},{88,116,93,118},{78,119,110,120},{2,121,95,122},{85,123,110,123},{41,124,110,126},{84,127,87,127},{30,17,41,18},{27,19,81,25},{24,26,108,43},{23,44,111,47},{1,48,116,53},{18,54,124,62},{3,63,122,69},{9,70,127,88},{1,89,127,117},{36,118,111,118},{1,119,113,127},{65,19,81,22},{90,30,96,30},{49,36,99,36},{98,37,98,37},{52,38,53,38},{24,46,24,46},{23,49,110,49},{109,50,110,50},{3,52,76,53},{114,54,114,54},{53,55,53,55},{18,56,19,56},{56,58,114,58},{49,60,80,60},{19,61,60,62},{59,63,70,65},{16,67,55,67},{51,68,74,69},{73,70,119,70},{50,71,50,71},{67,72,67,72},{14,75,119,75},{120,76,120,76},{79,77,120,77},{79,78,79,78},{117,79,117,79},{47,80,50,81},{121,82,121,82},{51,83,115,83},{52,84,85,85},{56,86,116,86},{48,87,73,89},{50,91,112,91},{65,92,69,93},{9,94,10,96},{65,97,65,97},{0,98,0,98},{7,99,78,100},{104,101,122,101},{6,102,6,102},{34,106,61,106},{55,107,104,107},{55,108,67,110},{103,111,103,111},{38,114,38,114},{4,115,87,115},{74,116,74,116},{56,118,94,119},{108,120,108,120},{38,121,109,121},{3,122,79,122},{82,124,110,125},{77,126,77,126},{41,127,106,127},{85,3,85,4},{7,12,7,12},{123,13,125,13},{80,15,82,15},{38,17,47,18},{36,19,81,19},{32,21,78,22},{72,23,80,23},{31,24,82,24},{82,26,101,29},{29,31,97,31},{91,33,98,35},{24,36,49,36},{51,38,51,38},{103,39,103,39},{24,40,24,40},{57,41,103,41},{24,42,60,43},{23,44,23,44},{25,45,109,45},{24,46,51,46},{22,47,111,48},{64,49,115,51},{2,52,75,56},{52,57,74,57},{49,58,117,59},{21,60,73,60},{18,61,18,61},{9,62,81,62},{57,63,82,66},{16,67,55,67},{52,68,119,68},{48,69,81,71},{17,72,72,72},{51,73,85,74},{69,75,120,78},{64,79,76,79},{118,80,118,80},{10,81,118,81},{51,82,121,83},{55,84,86,84},{11,85,117,85},{10,86,72,86},{10,87,116,87},{5,88,84,89},{49,90,69,91},{82,92,82,92},{8,93,58,93},{9,94,110,94},{50,95,69,95},{0,96,67,98},{5,99,126,100},{57,101,120,101},{7,102,123,102},{51,103,119,103},{72,104,103,105},{3,106,104,107},{54,108,62,108},{65,109,116,109},{36,110,102,110},{6,111,71,111},{79,112,79,112},{37,113,105,113},{79,114,106,114},{36,115,107,115},{85,116,109,117},{4,118,96,119},{56,120,96,121},{3,122,88,122},{118,123,118,123},{56,124,108,126},{42,127,94,127},{7,12,7,12},{10,14,121,14},{33,16,112,16},{36,17,49,18},{26,19,86,25},{24,26,106,43},{20,44,126,50},{2,51,116,57},{10,58,120,87},{5,88,114,99},{1,100,113,109},{0,110,122,127},{85,3,85,4},{81,10,81,10},{0,12,7,12},{123,13,123,13},{11,14,116,14},{80,15,80,15},{29,17,66,19},{24,20,88,28},{21,29,111,47},{17,48,116,57},{9,58,119,85},{2,86,114,100},{2,101,119,106},{1,107,127,127},{84,9,126,9},{125,12,127,12},{5,13,5,13},{30,16,112,16},{114,18,115,18},{52,20,52,20},{34,22,77,22},{81,24,85,27},{92,30,93,31},{24,32,25,32},{97,33,97,33},{60,34,97,34},{46,35,46,35},{96,36,96,36},{62,39,62,39},{61,41,103,41},{103,42,105,42},{24,43,55,43},{54,44,108,44},{63,45,72,46},{47,47,122,47},{48,48,67,48},{110,49,113,50},{4,52,5,52},{126,53,126,53},{72,58,114,58},{54,61,115,61},{9,62,61,62},{60,63,70,64},{62,65,116,65},{58,66,74,68},{81,69,81,69},{15,70,118,70},{118,71,118,71},{48,73,117,74},{70,78,70,78},{13,79,67,79},{82,80,83,80},{84,81,119,82},{51,83,118,83},{54,85,110,85},{108,88,112,89},{59,92,107,92},{105,93,105,93},{47,95,105,95},{73,97,105,97},{6,98,57,98},{39,99,76,99},{5,100,106,100},{78,101,78,101},{5,102,112,102},{49,103,109,103},{105,104,106,104},{59,105,69,105},{4,106,83,107},{54,108,107,108},{84,109,85,109},{54,110,54,110},{68,111,77,111},{107,112,111,112},{71,113,88,114},{95,115,111,117},{2,118,89,118},{38,119,95,119},{86,120,95,120},{3,121,95,121},{79,122,88,122},{40,124,97,125},{97,126,97,126},{65,127,92,127},{126,12,126,12},{29,17,61,19},{24,20,82,24},{22,25,106,41},{21,42,112,47},{18,48,120,51},{2,52,120,81},{6,82,121,93},{0,94,112,127},{33,17,33,17},{30,19,81,24},{23,25,102,30},{24,31,24,31},{24,32,98,34},{23,35,55,37},{51,38,60,38},{23,39,105,41},{47,42,68,42},{22,43,110,47},{20,48,61,48},{23,49,116,50},{66,51,67,51},{51,52,113,52},{19,53,70,54},{63,55,115,55},{56,56,79,57},{19,58,117,58},{19,59,79,59},{55,60,117,60},{16,61,70,61},{81,62,81,62},{81,63,117,63},{67,64,67,64},{46,65,118,65},{65,66,82,66},{11,67,76,67},{46,68,74,68},{15,69,83,69},{14,70,116,70},{52,71,52,71},{13,72,71,72},{49,73,77,73},{11,74,69,74},{12,75,116,76},{11,77,76,77},{10,78,115,79},{49,80,66,80},{11,81,117,81},{46,82,121,82},{7,83,73,84},{48,85,83,85},{6,86,6,86},{6,87,66,87},{61,88,67,88},{5,89,107,89},{5,90,63,92},{47,93,106,93},{55,94,55,94},{1,96,64,96},{49,97,71,97},{4,98,106,98},{40,99,77,101},{65,102,104,102},{103,103,110,103},{3,104,110,104},{34,105,65,105},{4,106,106,106},{51,107,86,109},{2,110,108,111},{37,112,87,112},{1,113,110,113},{35,114,111,114},{55,115,97,116},{37,117,98,118},{84,119,96,119},{38,120,111,121},{2,122,112,124},{39,125,108,127},{34,17,34,17},{46,18,82,18},{40,19,59,20},{33,21,77,24},{79,25,103,28},{89,31,98,34},{44,35,101,35},{23,37,98,37},{103,39,103,39},{24,41,104,41},{22,42,63,44},{53,45,108,45},{48,46,67,47},{54,48,113,48},{56,49,56,49},{23,50,111,50},{50,51,67,51},{4,52,72,53},{57,54,78,54},{46,55,115,55},{58,56,80,57},{72,58,115,58},{70,59,70,59},{16,60,71,60},{55,61,66,62},{64,63,83,64},{46,65,46,65},{61,66,79,67},{14,68,83,70},{77,71,77,71},{14,72,116,72},{48,73,66,73},{78,74,117,74},{11,75,76,75},{66,76,83,77},{10,78,75,79},{66,80,113,80},{117,81,117,81},{55,82,65,82},{9,83,69,83},{51,84,56,84},{7,85,7,85},{48,86,60,88},{7,89,109,89},{48,90,106,90},{5,91,48,91},{45,92,60,93},{6,94,48,94},{8,95,105,95},{46,96,104,97},{51,98,74,98},{5,99,74,99},{47,100,77,101},{4,102,112,102},{75,104,75,104},{34,105,105,105},{3,106,109,106},{51,107,86,108},{52,109,108,109},{1,110,112,110},{68,111,112,112},{79,114,112,116},{37,117,110,118},{78,119,107,120},{1,121,95,122},{56,124,95,125},{4,126,89,126},{55,127,106,127},{84,2,85,6},{84,9,126,9},{0,10,83,11},{0,12,126,15},{0,16,120,17},{24,18,125,25},{23,26,100,27},{21,28,121,44},{21,45,126,47},{1,48,119,52},{0,53,127,127},{102,25,102,25},{88,30,88,30},{50,40,58,42},{22,43,110,43},{21,45,21,45},{65,47,65,47},{116,54,116,54},{55,56,79,58},{74,60,74,60},{17,62,70,62},{75,63,75,63},{54,64,118,64},{46,65,77,66},{13,67,117,67},{76,68,76,68},{47,69,48,70},{78,71,78,71},{45,72,45,73},{66,74,69,75},{63,76,122,76},{69,77,83,77},{62,79,74,79},{75,80,113,80},{66,81,66,81},{9,83,71,83},{60,84,60,84},{48,85,107,85},{70,86,70,86},{8,89,8,89},{47,90,48,92},{52,93,105,94},{4,95,104,95},{103,96,103,96},{49,97,69,98},{66,99,79,99},{37,100,71,100},{35,101,112,104},{70,105,84,106},{61,107,61,107},{35,108,51,108},{52,110,85,110},{78,113,85,113},{36,114,36,114},{3,115,91,115},{35,116,53,116},{87,117,91,117},{36,118,90,118},{76,120,92,122},{38,123,91,123},{83,124,92,124},{2,126,91,126},{65,127,96,127},{57,21,57,21},{28,25,28,26},{96,30,97,31},{23,36,101,36},{58,39,58,39},{56,44,65,44},{110,45,110,45},{46,46,46,46},{65,47,65,47},{114,49,114,49},{45,50,45,50},{54,51,113,51},{68,52,75,52},{73,53,115,53},{52,54,72,55},{45,56,45,56},{55,57,78,58},{46,59,58,59},{46,61,79,63},{69,64,118,64},{77,65,82,65},{15,66,15,66},{116,68,116,68},{47,69,67,69},{78,71,78,71},{113,74,114,75},{13,76,75,76},{71,77,83,78},{48,81,69,85},{56,87,69,88},{64,89,106,89},{48,92,48,92},{7,93,52,93},{50,94,106,95},{61,96,61,96},{1,97,1,97},{63,98,63,98},{79,99,104,99},{37,100,78,101},{34,102,34,102},{46,103,110,103},{75,104,75,104},{52,107,52,107},{75,110,84,111},{34,112,70,112},{85,113,112,113},{36,114,53,115},{53,117,94,117},{108,118,108,118},{78,119,91,123},{91,124,106,126},{70,22,70,22},{102,34,102,34},{51,45,51,45},{111,46,117,50},{66,52,75,56},{79,61,79,61},{17,62,70,62},{72,63,75,64},{117,67,117,67},{69,68,83,69},{114,72,114,72},{66,75,116,75},{84,76,84,76},{110,77,115,82},{68,83,68,83},{108,84,109,84},{56,89,106,89},{60,92,60,94},{45,101,106,101},{36,103,36,103},{85,111,85,111},{55,113,55,115},{35,116,87,116},{108,118,109,118},{78,120,83,121},{4,123,87,123},{96,125,96,125},{56,126,57,126}};
+static const uint16_t init_gif_delays[INIT_GIF_FRAMES] = {30,40,30,30,40,30,30,40,30,30,40,30,30,40,30,30,40,30,30,40,30,30,40,30,30,40,30,30,40,30,30,40,30,30,30};
+static const uint8_t init_gif_packed[161756] = {
+0xBC,0x56,0xFA,0x9C,0x88,0x7F,0x01,0xFD,0xFD,0xC0,0x99,0x99,0xA6,0x78,0x01,0xFD,0xFD,0xC0,0x00,0x39,0x01,0xE9,0x28,0x19,0x00,0xC0,0x9D,0x99,0x55,0xC6,0x00,0xC0,
+0x19,0x28,0xC0,0x01,0x66,0x01,0xFD,0x00,0x39,0x01,0xE5,0x19,0x27,0x18,0x61,0x5F,0xC4,0xA2,0x87,0xC4,0x10,0xC1,0x1D,0x10,0xC1,0x1D,0x10,0x27,0x00,0x39,0x01,0xF9,
+0x00,0x39,0x01,0xE1,0x19,0x27,0x07,0x10,0xC2,0x1D,0x10,0x27,0x1D,0xD0,0x5A,0x1D,0xC0,0x01,0xFA,0x19,0x28,0x01,0xDD,0x39,0x19,0x27,0x07,0x10,0xC1,0x1D,0x10,0x27,
+0x1D,0xC5,0x1A,0x1D,0xC4,0x1A,0x1D,0xC6,0x1A,0x1D,0x01,0xDD,0x39,0x01,0xD9,0x19,0x28,0x01,0xDD,0x00,0x27,0x07,0x10,0xC0,0x1D,0xC4,0x1A,0x1D,0xC6,0x1A,0x1D,0xC7,
+0x1A,0x1D,0xC3,0x01,0xDD,0x39,0x01,0xD9,0x00,0x39,0x01,0xDA,0x19,0x27,0x07,0x10,0x1D,0xC0,0x10,0x1D,0xC4,0x1A,0x1D,0xCB,0x1A,0x1D,0xC9,0x01,0xDD,0x39,0x01,0xD9,
+0x00,0x39,0x01,0xD8,0x00,0x07,0x10,0xC0,0x1D,0xC5,0x1A,0x1D,0xCB,0x1A,0x1D,0xCC,0x1A,0x01,0xDD,0x39,0x01,0xD9,0x19,0x3C,0x01,0xD6,0x00,0x27,0x07,0x1D,0xC0,0x10,
+0x1D,0x1A,0x1D,0xC5,0x1A,0x1D,0xCD,0x1A,0x1D,0xC9,0x01,0xDD,0x39,0x01,0xD9,0x00,0x39,0x01,0xD4,0x00,0x98,0xA9,0x10,0xC1,0x1D,0x10,0x27,0x1D,0xC6,0x1A,0x1D,0xCF,
+0x1A,0x1D,0xCA,0x00,0xC0,0x19,0x39,0x01,0x3C,0x01,0xDE,0x39,0x01,0xD0,0x19,0x28,0x01,0xD2,0x00,0x27,0x07,0x1D,0xC1,0x10,0x1D,0x1A,0x1D,0xC4,0x1A,0x1D,0xD0,0x1A,
+0x1D,0xCA,0x3C,0x01,0x28,0x19,0x00,0x27,0x07,0x1D,0x00,0xC0,0x19,0x39,0xC0,0x01,0x3C,0x01,0xDD,0x39,0x01,0xC9,0x19,0x28,0x01,0x3C,0x01,0xCF,0x19,0x27,0x07,0x10,
+0x1D,0xC5,0x1A,0x1D,0xD4,0x1A,0x1D,0xCC,0x01,0xC7,0x19,0x28,0x00,0x27,0x07,0x1D,0x00,0x19,0x28,0x01,0xE0,0x39,0x01,0xC3,0x00,0x39,0x01,0xCF,0x00,0x18,0xC2,0x1D,
+0xC4,0x1A,0x1D,0xD6,0x1A,0x1D,0xCC,0x01,0xCD,0x19,0x28,0x00,0x27,0x18,0x27,0x00,0x19,0x28,0x01,0xE0,0x00,0x01,0xCF,0x27,0x18,0x07,0x1D,0xC4,0x1A,0x1D,0xD8,0x1A,
+0x1D,0xCD,0x01,0xD3,0x28,0x19,0x00,0x27,0x18,0x27,0x00,0xC0,0x19,0x39,0xC0,0x01,0xD8,0x00,0x01,0xCD,0x19,0x3D,0x10,0x1D,0xCA,0x1A,0x1D,0xD4,0x1A,0x1D,0xCD,0x01,
+0xD9,0x28,0x19,0x00,0xC0,0x27,0x07,0x1D,0x00,0x19,0xC0,0x28,0x01,0xC0,0x69,0xCD,0x3C,0x01,0x28,0x19,0x28,0x01,0xCB,0x27,0x18,0x07,0x1D,0xC5,0x1A,0x1D,0xDE,0x1A,
+0x1D,0xC8,0x1A,0x01,0xDD,0x39,0x01,0xC0,0x60,0xC0,0x9A,0x97,0x9D,0xA9,0xC1,0x44,0x9C,0x8A,0x9C,0x87,0x53,0x65,0x56,0xC1,0x2B,0x7F,0xA3,0x86,0xA5,0x99,0x13,0xA7,
+0x67,0xA2,0x98,0xA3,0x68,0xA0,0xA9,0x00,0x39,0x01,0xCB,0x93,0xA9,0x10,0xC0,0x1D,0xC6,0x1A,0x1D,0xD8,0x1A,0x1D,0xC4,0x1A,0x1D,0xC8,0x01,0xDD,0x39,0x01,0x9C,0x95,
+0x99,0x99,0x99,0xAB,0x1F,0x17,0x9D,0x9A,0xC1,0x6B,0x05,0xC9,0x0C,0x7E,0xA6,0x74,0x06,0xA5,0x98,0x1E,0xA3,0x68,0x9F,0x9B,0xC1,0x67,0x01,0xC5,0x93,0xA9,0x10,0xC1,
+0x1D,0x10,0x27,0x1D,0xC9,0x1A,0x1D,0xC7,0x1A,0x1D,0xC6,0x1A,0x1D,0xD1,0x01,0xDB,0x60,0x9A,0x97,0x9C,0x8A,0x96,0x89,0x05,0xC5,0x0C,0x14,0x05,0xCE,0x32,0xAA,0x84,
+0xA8,0x78,0x1E,0x3E,0x3C,0x01,0x28,0x01,0xC1,0x19,0x3D,0x10,0x1D,0xC5,0x1A,0x1D,0xD9,0x1A,0x1D,0xC9,0x1A,0x1D,0xC6,0x01,0xDA,0x06,0x97,0x99,0x05,0xDC,0x14,0xA9,
+0x66,0xA9,0xA6,0xA8,0x87,0x3E,0x3C,0x01,0xC0,0x19,0x3D,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC5,0x1A,0x1D,0xDA,0x1A,0x1D,0xC9,0x1A,0x1D,0xC2,0x01,0xD9,0x19,0x8B,0xA9,
+0x05,0xC8,0x14,0x05,0xC7,0x14,0x05,0xC8,0x14,0x05,0xC0,0xA6,0x87,0x29,0x3E,0x3C,0x28,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xC7,0x1A,0x1D,0xDB,0x1A,0x1D,0xCC,0x3D,0x01,
+0xD9,0x19,0x0F,0x05,0xC9,0x14,0x05,0xC9,0x14,0x05,0xCA,0x15,0x07,0x9D,0x97,0x18,0xC2,0x1D,0xC5,0x1A,0x1D,0xDC,0x1A,0x1D,0xCD,0xFE,0x51,0x42,0xA1,0xE8,0x01,0xD9,
+0x07,0x0F,0x05,0xC8,0x14,0x05,0xCB,0x14,0x05,0xCB,0xAF,0x84,0x07,0x13,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC6,0x1A,0x1D,0xDD,0x1A,0x1D,0xC6,0x9D,0xB7,0xFE,0x71,0x00,
+0xA3,0xC8,0xC0,0x01,0xD9,0x07,0x0F,0x05,0xC9,0x14,0x05,0xCD,0x14,0x05,0xC9,0xA9,0x85,0x07,0x29,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC7,0x1A,0x1D,0xDE,0x1A,0x1D,0xC2,
+0x1E,0x35,0xA0,0xC7,0xC0,0x9F,0x68,0x01,0xD9,0x19,0x0F,0x62,0xC8,0x14,0x05,0xCF,0x14,0x05,0xC9,0xA5,0x87,0x22,0x29,0x1D,0xC1,0x10,0x1D,0x1A,0x1D,0xC8,0x1A,0x1D,
+0xDF,0x98,0xEA,0x37,0xC0,0x71,0x37,0x9D,0x4A,0x01,0xD9,0x07,0x0F,0x05,0xCB,0x14,0x05,0xD1,0x14,0x05,0xC6,0x06,0x36,0x18,0xC2,0x1D,0xC6,0x1A,0x1D,0xDE,0x1A,0x1D,
+0xC1,0x12,0x37,0x3A,0xC0,0x12,0x56,0x01,0xD9,0x13,0x91,0x7B,0x05,0xCC,0x14,0x05,0xD7,0x14,0x05,0xC0,0x3C,0x07,0x18,0xC2,0x1D,0xC9,0x1A,0x1D,0xC5,0x10,0xC1,0x1D,
+0x10,0x27,0x1D,0xCA,0x1A,0x1D,0xC3,0x2D,0x37,0x3A,0xC0,0x35,0x9C,0x78,0xC0,0x01,0xD9,0x94,0xA8,0x05,0xC7,0x14,0x05,0xC0,0xA6,0x87,0x05,0xCD,0x14,0x05,0xCE,0x3C,
+0x07,0x18,0xC2,0x1D,0xCA,0x3D,0x41,0xC1,0x3D,0x10,0x71,0xC1,0x3D,0x26,0x10,0xC1,0x1D,0x10,0x27,0x1D,0xCB,0x16,0xA3,0xE6,0x6B,0x25,0x16,0x0A,0xC0,0x01,0xD9,0x90,
+0xA7,0x05,0xC7,0x14,0x05,0x2B,0xB8,0x74,0x9C,0x99,0x31,0x05,0xC0,0x0C,0x14,0x2B,0x1F,0x05,0xC7,0x14,0x05,0xCD,0xAE,0x85,0x07,0x18,0x1D,0xC4,0x1A,0x1D,0xC2,0x26,
+0xC0,0x3D,0xA4,0x88,0xC8,0x02,0xC0,0x3D,0x1D,0xC4,0x1A,0x1D,0xC7,0x9B,0xB9,0xFE,0x89,0x40,0x3A,0x37,0x16,0x0A,0xC1,0x01,0xD9,0x8F,0x96,0x05,0xCA,0xFE,0x9C,0xF1,
+0xB4,0x73,0x93,0xAA,0x8A,0x69,0x2B,0x05,0xC0,0x36,0xAC,0x74,0x91,0x9A,0x97,0x9C,0xCF,0x14,0x05,0xC5,0x06,0xA5,0x98,0x18,0x1D,0xC4,0x1A,0x26,0xC0,0x3D,0xA4,0x88,
+0xCC,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xC4,0x1A,0x1D,0xC4,0xFE,0x51,0x42,0x37,0xC0,0x35,0x0A,0xC2,0x01,0xD9,0x32,0x05,0xC8,0x14,0x05,0xFE,0x7C,0x2B,0xBC,0x98,0xA2,
+0x88,0x15,0x8E,0x88,0x20,0x05,0x6E,0x1F,0xB0,0x86,0x0F,0x2B,0x05,0xC8,0x14,0x05,0xCB,0xB3,0x85,0xA4,0x74,0x18,0xC2,0x3D,0x26,0x10,0x25,0xCF,0x3D,0x10,0x1D,0xC0,
+0x1A,0x1D,0xC7,0x1A,0x1D,0xC1,0x12,0x37,0x45,0x16,0x65,0xC2,0x01,0xD8,0x60,0x17,0xC0,0x05,0x0C,0x14,0x05,0xC6,0x36,0x3A,0x0E,0xC0,0x59,0x93,0x8A,0x88,0x98,0x17,
+0xA6,0x98,0xFE,0xC6,0x97,0x15,0x21,0x83,0x9B,0x05,0xCD,0x14,0x05,0xC6,0x36,0x51,0x1D,0x3D,0x10,0x02,0xA3,0x99,0xD1,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xC8,0x1A,0x1D,
+0x9B,0xB9,0xFE,0x89,0x40,0x37,0x9D,0x4A,0x0A,0xC3,0x01,0xD8,0x00,0x8E,0x98,0x05,0xCA,0x36,0xFE,0xE7,0x38,0xA6,0x77,0x0E,0x04,0x0B,0x9D,0x98,0x87,0x99,0x17,0xB9,
+0x99,0x0B,0x3A,0x31,0x13,0x91,0x7B,0xC0,0x05,0xC8,0x14,0x05,0xC8,0xA6,0x87,0xB2,0x74,0x3C,0xA2,0x8B,0xC6,0x02,0xC0,0x3D,0x25,0xC9,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,
+0xC9,0x1A,0xFE,0x51,0x42,0x37,0x35,0x9C,0x78,0xC4,0x01,0xD8,0x98,0xA6,0x05,0xCB,0xA9,0x85,0xFE,0xD6,0xF5,0x0E,0xC0,0x04,0x0B,0x0E,0x04,0x21,0x20,0x2D,0x0B,0x0E,
+0x34,0x83,0x9A,0x17,0x9D,0x9A,0xC7,0x14,0x05,0xCA,0xAF,0x84,0x07,0x25,0xC3,0x02,0x26,0xC0,0x61,0xC1,0x26,0x25,0xC8,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xCA,0xFE,0x69,
+0x01,0x37,0x16,0x0A,0xC3,0xA3,0xB7,0xFE,0x4B,0x0A,0x28,0x01,0xD6,0x94,0xA8,0x05,0xC8,0x14,0x05,0xC1,0xFE,0xBE,0x54,0x0E,0xC1,0x04,0x6B,0x0E,0x0B,0x8E,0x99,0x36,
+0x04,0x0B,0x61,0x9C,0x89,0x85,0x77,0x17,0xC0,0x05,0xC8,0x14,0x05,0xC8,0xB5,0x84,0x22,0x9D,0x9D,0xC1,0x3D,0x15,0xC0,0x26,0x15,0xC0,0x26,0x15,0x26,0x25,0xC7,0x40,
+0x10,0xC0,0x1D,0xC9,0x1A,0x1D,0x9B,0xB9,0xFE,0x61,0x43,0x9E,0xB6,0x0A,0xC3,0xA3,0xB7,0xA1,0xB9,0x3D,0x10,0x02,0x3D,0x10,0x1D,0xC0,0x00,0xC0,0xA3,0x88,0xC0,0x28,
+0x01,0xCB,0x69,0x8C,0xA7,0x05,0xC9,0x14,0x05,0xC0,0x21,0x0E,0xC0,0x9D,0x88,0x2D,0x97,0x98,0x33,0x21,0xA9,0x89,0x21,0x34,0x21,0x0E,0x0B,0x9C,0x86,0x3C,0x17,0x05,
+0xD3,0xA9,0x85,0xAF,0x87,0x98,0x9D,0xC0,0x9A,0x77,0x62,0xC0,0x26,0x15,0xC1,0x26,0x15,0xC0,0x25,0xC6,0x02,0xC0,0x1D,0xC4,0x1A,0x1D,0xC6,0x98,0xC9,0x9E,0xF6,0x0A,
+0xC3,0x35,0x37,0xC0,0xFE,0x31,0xA6,0x10,0x02,0x3D,0xC0,0x10,0x02,0x3D,0xC1,0x10,0x36,0x3D,0x10,0x02,0x25,0xC1,0x19,0x28,0xC0,0x39,0x01,0x66,0x01,0x60,0x17,0x9D,
+0x9A,0xC9,0x14,0x05,0xC0,0x33,0xB4,0x73,0x33,0x00,0x9F,0xA6,0x3E,0x6B,0x9D,0x89,0x9A,0x97,0xA2,0x87,0x22,0xFE,0xD6,0xD7,0x0B,0xC1,0x11,0x06,0x17,0xC0,0x9D,0x9A,
+0xC9,0x14,0x05,0xC6,0x36,0x29,0x95,0x9C,0xC0,0x26,0x15,0xC2,0x26,0x15,0xC1,0x25,0xC6,0x02,0x18,0xC2,0x1D,0xC9,0x1A,0x98,0xF9,0x9D,0xE7,0x0A,0xC3,0x12,0x0A,0xC0,
+0xFE,0x31,0xA6,0x10,0x02,0x3D,0xC2,0x10,0x02,0x3D,0xC3,0x10,0x02,0x3D,0xC4,0x10,0x02,0x25,0x29,0x05,0xC8,0x14,0x05,0xC2,0x36,0xAD,0x98,0xAF,0x79,0xA9,0x99,0xA2,
+0x97,0xA2,0x88,0xC0,0x5A,0x3A,0x9C,0x89,0xC0,0x0B,0xC1,0x93,0x89,0x8B,0x9A,0x21,0x89,0x88,0x8B,0x9D,0xD2,0x14,0xA6,0x76,0x36,0x15,0xC0,0xA2,0x78,0x15,0xC3,0x26,
+0x15,0x26,0x25,0xC6,0x07,0x18,0xC2,0x1D,0xC9,0x3D,0x9B,0xF6,0x0A,0xC3,0x12,0x0A,0xC1,0x3D,0x10,0x02,0x3D,0xC5,0x10,0x02,0x3D,0xC6,0x26,0x3D,0x26,0x3D,0xA3,0x87,
+0x64,0x05,0xCA,0x14,0x05,0xC0,0xB9,0x76,0x2D,0xA7,0x94,0x3A,0x0E,0xC0,0x5A,0xC2,0x0E,0x04,0x0B,0x2B,0x21,0x0E,0x0B,0x8F,0xA8,0xFE,0x29,0x83,0x05,0x6E,0x05,0xC7,
+0x14,0x05,0xC7,0xB3,0x84,0x3C,0x9A,0x8B,0xC0,0x26,0x15,0xC4,0x02,0x25,0xC6,0x07,0x18,0x1A,0x1D,0xCA,0x1A,0x9B,0xC9,0x13,0x75,0xC4,0x12,0x0A,0x5B,0x3D,0x10,0x02,
+0x3D,0xC7,0x10,0x02,0x3D,0xC8,0xA7,0x85,0x96,0x88,0x97,0x9C,0xC8,0x14,0x05,0xC2,0x0F,0xAD,0x99,0xC1,0x11,0x2A,0xA4,0x98,0x0B,0xC2,0x7A,0x0B,0x34,0x0E,0x0B,0x93,
+0x89,0x88,0x8A,0xA9,0xA6,0x31,0x05,0xCA,0x14,0x05,0xC5,0x20,0x22,0x95,0x9D,0xC0,0x26,0x15,0xC3,0x3D,0x25,0xC7,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xC9,0x98,0xE9,0x13,
+0x0A,0xC0,0x5B,0x0A,0xC4,0x3D,0x10,0x02,0x3D,0xC9,0x10,0x02,0x3D,0xC6,0xA7,0x85,0x05,0xC9,0x14,0x05,0xC2,0x0F,0xFE,0xE7,0x5B,0xA5,0x9A,0x54,0x98,0x86,0x91,0x9A,
+0x21,0xB2,0x78,0x69,0xC2,0x2B,0x19,0x0B,0x8F,0xAB,0x93,0x88,0x2D,0x8D,0x96,0x32,0x05,0xD2,0xA5,0x87,0x22,0x15,0xC0,0xA2,0x78,0x15,0xC3,0x25,0xC8,0x9C,0x88,0x1D,
+0xC6,0x1A,0x1D,0xC4,0xFE,0x51,0x42,0x0E,0x0A,0xC0,0x0E,0x0A,0xC0,0x0E,0x0A,0xC1,0x3D,0x02,0xC0,0x3D,0xC0,0x26,0x3D,0x0F,0x3D,0x10,0x02,0x3D,0xCB,0x06,0x17,0x05,
+0xC7,0x14,0x05,0xC3,0x26,0x2A,0x31,0xC1,0x98,0x85,0x1F,0x33,0x0B,0x3A,0x0B,0xC0,0x34,0xA8,0x99,0x2D,0x11,0xAF,0x9A,0x83,0x66,0x93,0x55,0x06,0x99,0xAB,0x05,0xC7,
+0x14,0x05,0xC8,0xB5,0x84,0x20,0x15,0xC0,0x26,0x15,0xC0,0x3D,0x25,0xC9,0x3D,0x1D,0xC7,0x1A,0x1D,0xC3,0x0D,0x0A,0x5B,0x0A,0xC0,0x0E,0x0A,0x0E,0x0A,0xC0,0x0E,0xA6,
+0x3A,0xC4,0x5A,0xC0,0x02,0xC0,0x3D,0xC6,0x10,0x02,0x3D,0xC3,0x05,0xCB,0x14,0x05,0xC0,0xA6,0x87,0x37,0x1B,0x31,0x2D,0x85,0x44,0x9B,0x9A,0x95,0xBB,0xBE,0xB9,0x0B,
+0xC1,0x34,0x19,0x11,0x1B,0x98,0x86,0x82,0x13,0x99,0xFD,0xFE,0xBE,0x54,0x94,0x97,0x17,0xC0,0x05,0xCA,0x14,0x05,0xC3,0x06,0xA1,0xA7,0x15,0xC0,0x26,0x15,0x26,0x25,
+0xC9,0x9C,0x88,0x18,0xC2,0x1D,0xC9,0x9B,0xB9,0x0D,0x9F,0xC8,0x0E,0xC0,0x0A,0xC0,0x0E,0x35,0x74,0xA1,0xB9,0x5A,0x09,0xC1,0x5A,0xA2,0x98,0x09,0xC1,0x06,0x1D,0x09,
+0xC1,0x06,0x1D,0x09,0x06,0xC1,0x02,0xC1,0x3D,0xA4,0x88,0x97,0x85,0x05,0xCB,0x14,0x05,0xC0,0xA6,0x87,0xFE,0xAD,0x8E,0xA2,0x9D,0x21,0x8D,0x7A,0x32,0x25,0xAC,0x75,
+0x21,0x12,0x69,0x04,0x34,0xA5,0x99,0x96,0x79,0x37,0x21,0xC0,0x2B,0xA3,0x89,0x98,0x9A,0x3C,0x92,0x8B,0xD1,0x16,0xAE,0x63,0x15,0xC0,0x02,0x25,0xCB,0x9C,0x88,0xA5,
+0x67,0xC6,0x1A,0x1D,0xC4,0x98,0xC9,0x9E,0xF6,0xA0,0xA7,0x35,0x74,0xC0,0xA1,0xB9,0x5A,0x79,0x3A,0x33,0x3A,0x09,0xC1,0x06,0xA2,0x98,0x09,0x06,0x09,0xC1,0x06,0x1D,
+0x09,0x06,0x09,0xC2,0x06,0x1D,0x09,0x06,0x09,0xA9,0x44,0x05,0xC8,0x14,0x05,0xC5,0xFE,0xBD,0xD1,0x0B,0xC0,0x2B,0x9D,0x9A,0xA4,0x87,0xA2,0x88,0xC0,0x0B,0xC1,0x34,
+0x0E,0x0B,0xC5,0x1F,0x05,0xD1,0xA6,0x87,0xB2,0x74,0x02,0xA3,0x99,0xCC,0x02,0xC0,0xA4,0x67,0xC7,0x1A,0x1D,0xC3,0x0D,0x37,0xC0,0x71,0xA2,0x78,0x37,0x33,0x3A,0x33,
+0xC0,0x3A,0x33,0x09,0xC1,0x06,0xA2,0x98,0x09,0x06,0x09,0xC0,0x1D,0x09,0x1D,0x09,0x1D,0x09,0xC1,0x06,0x1D,0x09,0x06,0x09,0xC0,0x1D,0x05,0xCC,0x14,0x05,0xC1,0xFE,
+0xAD,0x8E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x0B,0x34,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0x0E,0x2B,0x36,0x90,0x8B,0x05,0xD0,0xA6,0x87,0x0F,0x25,0xCD,0x02,0x18,
+0xC2,0x6E,0xCA,0xFE,0x61,0x43,0x33,0x6B,0x33,0xC1,0x3A,0x33,0xC2,0x3A,0xFE,0x41,0x45,0xC4,0x06,0xC5,0x09,0xC1,0x06,0xA2,0x98,0x09,0x06,0x09,0xC0,0x1D,0x9D,0x46,
+0x05,0x6E,0x05,0xC8,0x14,0x05,0xC3,0x3D,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0x9D,0x98,0xC0,0x0B,0xC3,0x0E,0x93,0x79,0x20,0x15,0x05,0xD1,0x0F,0x3C,0x25,0xCB,
+0x9C,0x88,0xA5,0x67,0xC8,0x1A,0x1D,0xC4,0x12,0x37,0x3A,0x33,0x3A,0x33,0xC3,0x3A,0x33,0xFE,0x41,0x44,0xC1,0x2D,0xC1,0x26,0xC0,0x2D,0xC2,0x26,0x2D,0xC0,0x06,0xC2,
+0x09,0xC1,0xA7,0x77,0x91,0x68,0x17,0x05,0xC8,0x14,0x05,0xC4,0xFE,0xAD,0x8E,0xB3,0x8B,0xC2,0x0E,0x0B,0xC2,0x0E,0x0B,0x34,0x0B,0x0E,0x0B,0xC2,0xFE,0x6B,0xAB,0x89,
+0x9A,0x3C,0x92,0x8B,0xC9,0x14,0x05,0xC4,0xA5,0x88,0x0F,0x3C,0x9E,0x8B,0x10,0x02,0x3D,0xC9,0x1D,0xC4,0x1A,0x1D,0xC7,0x9B,0xB9,0xFE,0x89,0x40,0x3A,0x37,0x33,0xC0,
+0x3A,0x33,0xC4,0x26,0xC0,0x2D,0xC3,0x26,0x2D,0xC2,0x26,0x2D,0xC3,0x26,0x2D,0xC1,0xAA,0x43,0x05,0xD1,0xFE,0x9D,0x2D,0x0B,0x0E,0x0B,0xC4,0x0E,0x0B,0xC0,0x96,0x86,
+0x0B,0xC2,0x0E,0x95,0x7B,0xFE,0x18,0xE2,0x05,0x3C,0x05,0xCA,0x14,0x05,0xC3,0xAA,0x78,0x0F,0x98,0x9D,0x1D,0xC5,0x10,0xC1,0x1D,0x10,0x27,0x1D,0xC4,0x1A,0x1D,0xC8,
+0x98,0xE9,0x37,0xC0,0x29,0xA2,0x78,0x33,0x3A,0x33,0xC4,0x26,0xC0,0x6B,0xC1,0x26,0xC0,0x2D,0xC1,0x26,0x2D,0xC1,0x26,0x2D,0xC4,0x06,0x3C,0x05,0xCB,0x14,0x05,0xC3,
+0xFE,0xAD,0x8E,0x0B,0x0E,0x0B,0xC5,0x9D,0x98,0x19,0x2B,0x0B,0xC0,0x0E,0x04,0x0B,0xFE,0x5B,0x4A,0x17,0x05,0x16,0x97,0x9A,0x05,0xC7,0x14,0x05,0xC5,0x22,0xA4,0x75,
+0x18,0x1D,0xC6,0x1A,0x1D,0xCC,0x1A,0x1D,0xC4,0x1E,0x37,0xC0,0x71,0x3A,0x33,0xC0,0x3A,0x33,0xC3,0x2D,0xC1,0x26,0x2D,0xC5,0x26,0x2D,0xC3,0x26,0xC0,0x2D,0xC0,0xA7,
+0x76,0x99,0x67,0x97,0x9C,0xC9,0x14,0x05,0xC5,0x3D,0x0B,0xC2,0x0E,0x0B,0xC2,0x2B,0x9D,0x9A,0xA4,0x87,0x0B,0xC0,0x0E,0x0B,0x88,0x9B,0x05,0xC1,0x3F,0x51,0x05,0xCA,
+0x14,0x05,0xC2,0x0F,0x3C,0x9E,0x8B,0xA5,0x67,0xC0,0x10,0x1D,0x1A,0x1D,0xC9,0x1A,0x1D,0xCB,0xFE,0x61,0x43,0xFE,0xA1,0x60,0x6B,0xC0,0x33,0x3A,0x33,0xC5,0x26,0x2D,
+0xC1,0x26,0x2D,0xC3,0x26,0x2D,0xC1,0x26,0x2D,0xC3,0x26,0xAC,0x44,0x05,0xC9,0x14,0x05,0xC6,0xFE,0xBD,0xD1,0x0B,0xC0,0x0E,0x0B,0xC3,0x8F,0xAB,0x25,0x95,0x88,0xFE,
+0x9C,0xF1,0x0B,0xC1,0x93,0x89,0xFE,0x18,0xE2,0x05,0xC0,0x6B,0x3A,0xA3,0x86,0x97,0x9C,0xC7,0x14,0x05,0xC4,0x3C,0xA9,0x74,0xFE,0x21,0x65,0xC0,0x15,0x26,0xC0,0x15,
+0x26,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xCC,0x1A,0x1D,0xC3,0x35,0xA0,0xB7,0x7A,0x37,0x79,0x3A,0x37,0x33,0x3A,0x33,0x3A,0x33,0xC0,0x2D,0xC1,0x69,0x2D,0xC3,0x26,0x2D,
+0xC2,0x26,0x2D,0xC3,0x26,0xA7,0x66,0x05,0xD1,0xA6,0x87,0xFE,0xBE,0x31,0xAE,0x8A,0xC0,0x0E,0x0B,0xC1,0x61,0x8A,0x8B,0xFE,0x10,0xC1,0x7F,0x02,0xAC,0x76,0x0B,0x61,
+0x19,0x13,0x0A,0xC0,0x05,0xC0,0xA5,0x88,0x3F,0x05,0xC7,0x14,0x05,0xC3,0x2B,0xAE,0x85,0x9C,0x8B,0x3C,0x3D,0x10,0x02,0x3D,0xC5,0x41,0xC0,0x15,0x26,0x3D,0xC0,0x10,
+0x02,0x3D,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC4,0x3D,0xFE,0x89,0x40,0xA1,0xB9,0x37,0x79,0xC0,0x3A,0x37,0x33,0x3A,0x33,0xC0,0x3A,0x33,0xFE,0x41,0x44,0x2D,0xC1,0x26,
+0x2D,0xC3,0x26,0x2D,0xC3,0x26,0x2D,0xC1,0x22,0x20,0x05,0x0A,0x05,0xC9,0x14,0x05,0xC3,0x3F,0x36,0xFE,0xD6,0xD7,0x0B,0xC3,0x30,0x18,0xB6,0xA7,0x3D,0xA6,0x86,0x98,
+0x7B,0xAB,0x97,0x19,0x36,0x05,0xC3,0xA5,0x87,0x16,0x08,0x05,0xC7,0x14,0x05,0xC2,0x36,0x22,0x3C,0x9E,0x8B,0x10,0x02,0x3D,0xCB,0x10,0x02,0x3D,0xC0,0x41,0xC0,0x15,
+0x26,0x3D,0xC0,0x07,0x10,0xC0,0x1D,0xC0,0x98,0xE9,0x37,0x3A,0x37,0x79,0x3A,0x33,0xC1,0x3A,0x33,0xC2,0xFE,0x41,0x45,0xC1,0x26,0x2D,0xC3,0x26,0x2D,0xC4,0x26,0x2D,
+0xC1,0x22,0x1F,0x17,0x05,0xC9,0x14,0x05,0xC4,0x3C,0x9D,0x87,0xA5,0x9D,0xFE,0xC6,0x97,0x0B,0xC1,0x86,0x87,0xA2,0x9C,0xB4,0x73,0xA4,0x8B,0x0B,0x61,0x0E,0x98,0x8A,
+0x36,0x05,0xC5,0xA6,0x87,0x05,0xCC,0xAF,0x84,0xA8,0x78,0x3D,0x10,0x02,0x3D,0xCC,0x10,0x02,0x3D,0xC9,0x41,0xC0,0x9E,0xB5,0xA1,0xEA,0xFE,0xA1,0x60,0x6B,0xC0,0x37,
+0x33,0x3A,0x33,0xC2,0x3A,0x33,0xC0,0xFE,0x59,0xE7,0x09,0x1D,0x09,0x9D,0x89,0xC1,0x69,0x2D,0xC3,0x26,0x2D,0xC2,0x26,0xC0,0xA7,0x77,0x08,0x05,0xC8,0x14,0x05,0xC6,
+0xB0,0x74,0x9B,0x98,0x05,0xAC,0x87,0xFE,0xBD,0xD4,0x0B,0x61,0x19,0xA6,0x78,0x9D,0x97,0x91,0x9A,0x37,0x2B,0x96,0x79,0x25,0x05,0xC6,0x3F,0x05,0xC8,0x14,0x05,0xC0,
+0xA6,0x87,0xB2,0x74,0x3C,0x3D,0xC0,0x10,0x02,0x3D,0xCD,0x41,0x3D,0xA3,0x87,0x3D,0xC0,0x10,0x02,0x3D,0x9D,0xA8,0xA0,0xA8,0xA0,0xC7,0x9E,0xB6,0x35,0x74,0xA1,0xA9,
+0xC0,0x71,0xA2,0x78,0x33,0xC1,0x3A,0x33,0xC4,0xFE,0x61,0xE7,0xC4,0x9E,0x68,0x2D,0xC1,0x26,0x2D,0xC3,0x26,0x2D,0xC0,0x13,0x69,0x05,0xD2,0xB0,0x74,0x9B,0x69,0x0A,
+0x05,0xA5,0x87,0x30,0x2A,0xA4,0x98,0x59,0xC1,0x61,0x11,0x3F,0x05,0xC7,0x3F,0x05,0xCA,0x14,0xB4,0x73,0x0F,0x3C,0x3D,0xC0,0xA3,0x68,0x02,0x3D,0xD1,0x26,0x1E,0x9D,
+0xC9,0x35,0x25,0x37,0x33,0x6B,0x33,0xC6,0x3A,0x33,0xC5,0x20,0xC4,0x9E,0x68,0x2D,0xC1,0x26,0x2D,0xC3,0x26,0x2D,0xC0,0x36,0x96,0x8A,0x05,0x0A,0x05,0xCA,0x14,0x05,
+0xC3,0xB0,0x74,0x9B,0x69,0xA4,0x54,0x9B,0xAB,0xC1,0x07,0x21,0xB2,0x87,0x0B,0x97,0x9A,0x87,0x89,0x08,0x5A,0xC8,0x32,0x05,0xC7,0x14,0x05,0xC0,0x22,0x6B,0x99,0x9C,
+0xA3,0x68,0x02,0x3D,0xCF,0x26,0x1E,0x9D,0xC9,0x35,0x25,0x3A,0x5A,0x33,0xC0,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x09,
+0xA2,0x98,0xC4,0x2D,0xC1,0x26,0x2D,0xC3,0x26,0x2D,0xC0,0x36,0x92,0x89,0x05,0xCC,0x14,0x05,0xC2,0xA6,0x87,0x3C,0x9D,0x58,0xFE,0x65,0xA7,0xA4,0x76,0xC1,0xA2,0x87,
+0x51,0x9A,0xBE,0x92,0xDF,0x32,0x05,0xC9,0x14,0x05,0xCA,0x16,0x39,0x95,0xAF,0xA3,0x68,0x02,0x3D,0xCC,0x26,0xA0,0xC7,0x70,0x25,0xA1,0xB9,0x37,0x33,0xA1,0xA9,0x9D,
+0x89,0x37,0x29,0x37,0x29,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x20,0xC5,0x2D,0xC2,0x26,0x2D,0xC3,0x26,0x2D,0xAC,0x43,
+0x8B,0x9D,0xCC,0x14,0x05,0xC3,0xAA,0x78,0x9F,0x95,0x32,0xFE,0x65,0xA7,0xA7,0x74,0xC2,0x06,0x1A,0x9A,0x8A,0xFE,0x09,0x81,0x0A,0x66,0xA5,0x87,0xAA,0x34,0x06,0x7B,
+0x0A,0x05,0xC7,0x14,0x05,0xC5,0x22,0x0F,0x3C,0x3D,0xC1,0xA3,0x68,0x02,0x3D,0xC3,0x9D,0xA8,0xA0,0xA8,0x1E,0x0E,0x35,0x25,0x37,0xC0,0x29,0x3A,0x33,0xC0,0x7B,0x65,
+0x29,0x37,0x29,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0xFE,0x61,0xE7,0xC4,0x9E,0x68,0x2D,0xC2,0x26,0x2D,0xC3,
+0x26,0xA7,0x66,0x22,0x05,0xC8,0x14,0x05,0xC5,0xA4,0x66,0x2B,0x3C,0x19,0x2B,0xFE,0x5C,0xE8,0x18,0xC2,0x92,0x9E,0x9C,0xFC,0x1A,0x8C,0xAD,0xFE,0x11,0x82,0xB4,0x53,
+0x36,0x0D,0xFE,0x22,0x84,0x95,0xBB,0xA2,0x99,0x19,0x05,0xCD,0xAC,0x87,0xA7,0x86,0x99,0x9C,0xA3,0x68,0x71,0x3D,0xC3,0x9D,0xA8,0x1E,0x0E,0x35,0x25,0xA1,0xA9,0x71,
+0x37,0x29,0x3A,0xC0,0x9D,0xA9,0x29,0xC1,0xA2,0x88,0x31,0x29,0x37,0x29,0x3A,0xC0,0x24,0x33,0x3A,0x33,0xC6,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0xFE,0x61,0xE7,
+0xC4,0x06,0x2D,0xC2,0x26,0x2D,0xC3,0x06,0xA9,0x54,0x96,0x8A,0x05,0xC7,0x14,0x05,0xC3,0xAB,0x44,0xAE,0x41,0x39,0xA3,0x97,0x95,0x8A,0x06,0x7B,0xC0,0x2C,0x1A,0x51,
+0x18,0xC0,0x39,0xFE,0x6B,0xAB,0xFE,0x76,0x09,0x9D,0x77,0x9E,0x86,0xA9,0x88,0x18,0xC0,0x99,0x9B,0xFE,0x01,0x60,0x17,0xA6,0x98,0x99,0x79,0x62,0xCB,0x14,0x36,0x97,
+0x9D,0xA3,0x68,0x02,0x3D,0x9D,0xA8,0x1E,0xA0,0xA9,0x35,0xA0,0xB7,0x3A,0x7A,0x31,0x56,0xC1,0x3D,0xA2,0x87,0x3D,0x31,0x29,0xC0,0xA3,0x98,0x29,0x05,0xC0,0x29,0x05,
+0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0x3A,0x33,0xC6,0x3A,0x33,0x3A,0x09,0xA2,0x98,0xC4,0x2D,0xC1,0x26,0x2D,0x13,0xC0,0x69,0x13,0xC1,0xA7,0x87,
+0x92,0x79,0x97,0x9C,0xCA,0x14,0x05,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC1,0x9D,0x9B,0xFE,0x23,0x03,0x0F,0x05,0xAA,0x66,0xFE,0x54,0xE7,0x1A,0x06,0x18,0x0D,0xFE,0x4C,
+0x07,0x36,0x18,0x97,0x9A,0x1F,0x18,0xC1,0x3B,0xFE,0x00,0x40,0xA4,0x87,0x65,0x05,0xC8,0x14,0x05,0xC0,0x16,0xAE,0x63,0x2D,0xA0,0xC6,0x9E,0xB6,0x35,0x37,0xC0,0x29,
+0xA4,0x87,0x3D,0x7E,0x29,0x05,0x3A,0x3D,0x65,0x29,0x05,0xC0,0x3D,0x31,0x05,0xC0,0x3D,0x05,0xC0,0x3D,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,
+0x3A,0x33,0xC6,0x3A,0x33,0xC0,0x20,0xC4,0x5A,0x09,0xA4,0x66,0x13,0xC7,0xA8,0x66,0x8D,0x9C,0x9B,0x9A,0xC7,0x14,0x05,0xC2,0x1C,0x18,0xC3,0x99,0x9C,0xFE,0x0A,0x00,
+0x05,0xC0,0xBF,0x20,0xFE,0x55,0x63,0xA9,0x88,0x18,0xC0,0x0D,0xC0,0x1A,0x0A,0x9B,0x9D,0x1F,0x18,0xC0,0x25,0xFE,0x01,0x60,0x05,0xA7,0x78,0x9D,0x87,0x05,0xC8,0x14,
+0x05,0x0C,0xFE,0x89,0x40,0x3A,0x5A,0x33,0xC0,0x3A,0xC0,0xA1,0xA8,0xC0,0x3D,0x05,0x3D,0x31,0x29,0x05,0xC2,0x3D,0x05,0x3D,0x05,0xC0,0x3D,0x05,0x3D,0x05,0x3A,0x37,
+0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x20,0xC4,0x5A,0xA2,0x66,0x59,0xC8,0xA5,0x77,0x8B,0x9D,0xCC,
+0x2B,0xFE,0x65,0xA7,0x18,0xC4,0x0E,0xFE,0x01,0x00,0x05,0xB4,0x42,0x0D,0x9C,0x88,0x6B,0x18,0xC0,0x0D,0x18,0x39,0xFE,0x19,0x61,0x0E,0x18,0xC1,0xFE,0x22,0xC2,0xFE,
+0x00,0x40,0x05,0xAB,0x55,0x0A,0x05,0xC8,0x14,0x1D,0x37,0xC0,0x29,0x3A,0x33,0xA1,0xA9,0x29,0x05,0x6E,0x3D,0x05,0x29,0x37,0x29,0x3A,0xC0,0x24,0x33,0x05,0xC0,0x3D,
+0x05,0x3D,0x05,0xC0,0x29,0x05,0x3A,0x3D,0x33,0x3A,0x33,0xC6,0x3A,0x33,0xC0,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x20,0xC4,0x5A,0xA2,0x66,0x13,0xC3,0xA5,
+0x77,0x13,0xC1,0x36,0x22,0x8D,0x9D,0xCD,0xFE,0x65,0xA7,0x18,0xC5,0xFE,0x23,0x41,0xFE,0x00,0x40,0x2B,0xFE,0x6D,0x69,0x18,0x0D,0x25,0x1A,0x06,0x18,0x15,0x0A,0xAE,
+0x53,0x3D,0x18,0xC0,0x3B,0x0A,0x05,0x32,0xA3,0x66,0x0A,0x05,0xC8,0xB3,0xB7,0xFE,0xA1,0xC1,0x31,0x29,0x31,0x29,0x31,0xA2,0x88,0xC0,0x56,0x05,0x3D,0x05,0xC0,0x29,
+0xA2,0x68,0x29,0x05,0x29,0x05,0x6E,0x29,0x05,0xC0,0x3D,0x05,0x3D,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,
+0x3A,0x33,0x3A,0xC0,0x20,0xC5,0x1D,0x13,0xC0,0x1D,0x13,0xC0,0x1D,0xC0,0x13,0xC0,0xA5,0x77,0x9A,0x86,0x91,0x9F,0xCC,0xA6,0x87,0xFE,0x65,0xA7,0x18,0xC5,0x25,0xFE,
+0x01,0x60,0x05,0x39,0x1F,0x18,0xC0,0x25,0xC0,0x50,0x37,0x99,0xDC,0x05,0xAF,0x54,0x36,0x18,0x39,0xFE,0x00,0x40,0x05,0xC0,0xAA,0x66,0x19,0x05,0xC8,0x00,0x09,0x3D,
+0x65,0x29,0xC0,0xA3,0x98,0x31,0x29,0x31,0x05,0x3D,0x31,0x29,0xC0,0x05,0x31,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC0,0x29,0xC0,0xA2,0x68,0x29,0xA2,0x78,0xC0,0x24,0x33,
+0x05,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0x33,0xC0,0xA5,0x79,0x20,0xC4,0x5A,0xA2,0x66,0x13,0x1D,0x13,0xC0,0x1D,0xC1,
+0x13,0xC0,0xA7,0x87,0x92,0x79,0x97,0x9C,0xCD,0xFE,0x54,0xE7,0x1A,0x18,0xC5,0x3B,0x0A,0xBD,0x20,0x1F,0x18,0xC2,0x39,0x8A,0xCE,0x05,0xC1,0x2A,0xFE,0x55,0x63,0x39,
+0xFE,0x00,0x60,0x05,0xC0,0x2B,0x10,0x96,0xBB,0x05,0xC7,0xAB,0x86,0xA9,0xF5,0x37,0xC0,0xA1,0xB8,0xC0,0x3D,0x05,0x3D,0x3A,0x05,0xC0,0x3D,0x3A,0x29,0x05,0xC1,0x3D,
+0x05,0x3D,0x05,0xC0,0x29,0xC1,0x37,0x29,0x3A,0xC0,0x9D,0xA9,0x33,0x05,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,
+0xA2,0x97,0xFE,0x61,0xE7,0xC4,0x5A,0xA2,0x66,0x59,0x1D,0xC0,0x13,0xC0,0x1D,0xC2,0xA5,0x66,0x8B,0x9D,0xCE,0xBF,0x20,0x18,0xC6,0x97,0x9A,0xFE,0x01,0x60,0xAE,0x76,
+0x1F,0x18,0xC4,0x3B,0x91,0xAE,0x0F,0x05,0xAF,0x33,0xAF,0x64,0x19,0x05,0xC1,0xAB,0x55,0x96,0xBB,0x05,0xC8,0xAB,0x86,0x35,0xFE,0x99,0x61,0xC0,0x29,0x3A,0x33,0xC0,
+0x3D,0xA2,0x87,0x3D,0x7E,0x29,0xC0,0x05,0xC2,0x3D,0x05,0x3D,0x05,0xC0,0x29,0xC1,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,
+0x3A,0x37,0x33,0x3A,0x33,0xC2,0xAA,0x87,0xFE,0x61,0xE7,0xC4,0x5A,0xA2,0x66,0x59,0x1D,0xC0,0x13,0x0C,0x13,0xC2,0x36,0x8B,0x9D,0xCE,0x32,0x1F,0x18,0xC5,0x9D,0x9B,
+0xFE,0x0A,0x00,0xA5,0xBA,0x0D,0x18,0xC5,0x99,0x9C,0x3B,0xFE,0x11,0x82,0x96,0xBB,0x2B,0x10,0x0A,0x05,0xC0,0x2B,0x10,0x0A,0x05,0xC8,0x3F,0x36,0x37,0xC0,0x29,0x3A,
+0x33,0xC0,0x3D,0xA2,0x87,0x66,0xC0,0x3D,0x05,0x3D,0x05,0xC2,0x3D,0x05,0x3D,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,
+0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0xAA,0x86,0x20,0xC5,0x1D,0x59,0x0C,0x13,0xC5,0x36,0x8B,0x9D,0xCE,0xAF,0x44,0xFE,0x76,0x09,0x18,0xC6,0xFE,0x3B,0xE5,0x17,
+0x0D,0x18,0xC7,0x2C,0x8D,0xBD,0xFE,0x00,0x40,0xA4,0x88,0x3F,0x0F,0x05,0xC0,0xAB,0x55,0x9D,0x99,0x28,0x05,0xC8,0xAA,0x66,0xAD,0xB6,0xFE,0x99,0x61,0xC0,0x29,0x3A,
+0x33,0xA1,0xA9,0xC1,0x3D,0x05,0x3D,0x3A,0xC0,0xA2,0x97,0x3D,0x05,0xC1,0x3D,0x3A,0x29,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0x0A,0xA9,0x88,0x20,0xC4,0x5A,0xA2,0x66,0x59,0x1D,0xC0,0x13,0xC3,0xA8,0x66,0x9B,0x97,0x8D,0x9F,0xC7,0x7F,0x05,0xC4,
+0x32,0x0E,0x18,0xC6,0x0E,0xFE,0x22,0x84,0x1A,0x06,0x18,0xC7,0x06,0x8D,0x9D,0xFE,0x00,0x40,0xA7,0x66,0x10,0x0A,0x10,0x37,0xA3,0x77,0x10,0xC0,0x99,0xAA,0x05,0xC7,
+0x13,0xFE,0x8A,0x21,0x31,0x56,0x31,0xA2,0x88,0x3D,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC0,0x29,0x05,0xC0,0x3D,0x3A,0x29,0x3A,0xC1,0x33,0x3A,0xC1,0x5A,0x33,0x3A,0x33,
+0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xA2,0x97,0x1F,0x20,0xC5,0x1D,0x13,0x1D,0x13,0xC0,0x1D,0xC2,0x36,0x96,0x8A,0x95,0x9B,
+0xC8,0x14,0x05,0xC4,0xBF,0x20,0x18,0xC6,0x99,0x9C,0xFE,0x2B,0x24,0xFE,0x76,0x87,0x18,0xC9,0x0E,0x05,0xC0,0x10,0x9D,0x99,0x06,0x37,0x55,0x37,0x28,0x10,0x96,0xBB,
+0x05,0xC6,0xA9,0x85,0x35,0xFE,0x99,0x61,0x31,0x29,0x31,0xA2,0x88,0x3D,0x05,0xC1,0x3D,0x3A,0x29,0x3A,0xC0,0x29,0xC0,0x3D,0x31,0x29,0x31,0x05,0x3D,0x3A,0xC0,0x33,
+0x3A,0xC2,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0xAA,0x87,0x7F,0xFE,0x61,0xE7,0xC5,0x9E,0x68,0x1D,0x13,0xC0,0x1D,0xC3,0x36,
+0x92,0x89,0x99,0x9C,0xCF,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC6,0x8F,0xAD,0xB1,0x75,0x18,0xC9,0x3B,0x0A,0x05,0x03,0x19,0x76,0xA5,0x67,0x28,0x37,0xA3,0x88,0x37,0x2B,
+0x05,0xC6,0x3C,0xA7,0xF6,0xFE,0xB1,0x81,0x29,0x05,0x3A,0x3D,0x33,0x76,0x29,0x31,0x05,0x3D,0x3A,0x29,0xA2,0x68,0x29,0x3A,0xC0,0x9D,0xA9,0x33,0x05,0x3A,0xC1,0x37,
+0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xA2,0x97,0xA9,0x88,0x55,0x20,0xC5,0x1D,0x13,0xC0,0x1D,0xC3,0x13,
+0xA8,0x66,0x2B,0x9B,0x9A,0xC8,0x14,0x05,0xC4,0x32,0x0E,0x18,0xC6,0x0E,0x18,0xC9,0x9D,0x9B,0x0C,0x05,0x03,0x9B,0x98,0x05,0xC1,0x19,0x2B,0xA3,0x67,0xA3,0x88,0x28,
+0x05,0xC6,0x22,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x3D,0x3A,0x29,0x3A,0x05,0xC0,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x37,0x29,0x3A,0xC0,0x24,0x33,0x05,0x3A,0xC2,0x37,0x33,
+0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x0A,0x1F,0x55,0x20,0xC5,0x1D,0x13,0xC0,0x1D,0xC3,0x13,0xA8,0x66,0x88,0x9D,0xD1,
+0xFE,0x43,0xE6,0xFE,0x76,0x87,0x18,0xC5,0x97,0x9A,0x1A,0x51,0x18,0xC7,0x0E,0x28,0x05,0x32,0x05,0xC1,0x2B,0xA6,0x56,0x96,0xBB,0xA7,0x66,0x2E,0x37,0x0A,0x05,0xC4,
+0xA6,0x87,0xAC,0xE4,0x3D,0x31,0xA2,0x88,0xC1,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x29,0x31,0x05,0x3D,0x5A,0x29,0x3A,0x5A,0x33,0x3A,0x33,
+0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0xA2,0x98,0xA9,0x88,0x55,0x20,0xC4,0x5A,0xA2,0x66,0x13,0x1D,0xC0,0x13,0xC0,0x1D,0x13,
+0xC0,0xA5,0x77,0x8B,0x9D,0xCC,0x14,0x05,0xC2,0xAB,0x55,0xFE,0x65,0xA7,0x18,0xC6,0x06,0x18,0xC6,0x06,0x18,0x8A,0x9E,0xFE,0x09,0x81,0x2E,0x99,0xAA,0x06,0x9C,0x99,
+0x05,0x32,0x37,0x28,0x10,0x28,0x10,0x96,0xBB,0x05,0xC4,0x22,0xFE,0x8A,0x21,0x31,0xA2,0x88,0xC0,0x6E,0x3D,0x05,0xC2,0x3D,0x05,0x3D,0x3A,0xC0,0x61,0x31,0x29,0x31,
+0x3A,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0x37,0x33,0x3A,0x33,0xAA,0x87,0x1F,0x10,0x20,0xC5,
+0x9E,0x68,0x1D,0x13,0xC0,0x1D,0xC3,0x22,0x8D,0x9D,0xC9,0x14,0x05,0xC6,0xBF,0x20,0x18,0xC6,0x25,0x18,0xC1,0x9D,0x9A,0x1A,0x25,0x50,0xC0,0x9D,0x8A,0x92,0xBD,0x96,
+0x9C,0x9C,0xBB,0x28,0x7F,0x28,0x37,0xA3,0x88,0xA4,0x66,0x06,0x97,0xCC,0x10,0x37,0x06,0x37,0x05,0xC3,0xAB,0x86,0xA9,0xF5,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x3D,0x05,
+0x6E,0x3D,0x05,0xC1,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x3D,0x3A,0x29,0x3A,0xC0,0x29,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,
+0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x1F,0xC1,0xFE,0x61,0xE7,0xC4,0x5A,0xA2,0x66,0x13,0x1D,0xC0,0x13,0xC0,0x1D,0xC0,0xA5,0x66,0x9E,0x86,0x8D,0x9F,0xD2,0x0C,0x1A,0x18,
+0xC5,0x12,0xA8,0x75,0x25,0x6B,0xC0,0x0D,0xC0,0x1A,0x18,0xC0,0x12,0x0F,0x05,0xC5,0x2B,0x03,0x19,0x10,0x96,0xBB,0x05,0xC4,0xB7,0x94,0x37,0x3D,0x31,0xA2,0x88,0xC2,
+0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x31,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,
+0xC0,0x33,0xC0,0xA2,0x98,0x3A,0x0A,0x1F,0x55,0xC0,0x20,0xC5,0x1D,0x13,0xC0,0x1D,0xC3,0x22,0x60,0x8F,0x8E,0xC7,0x7F,0x05,0xC8,0xA6,0x87,0xFE,0x54,0xE7,0x1A,0x18,
+0xC4,0x25,0x18,0xC7,0x9D,0x9A,0xFE,0x01,0x60,0x17,0x05,0xC7,0x3F,0x9A,0x89,0x05,0xC3,0x1D,0xA0,0xF3,0x31,0xA2,0x88,0xC1,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,
+0x29,0x05,0x6E,0x05,0xC0,0x3D,0x5A,0x29,0x3A,0xC0,0x29,0x3A,0xC0,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,
+0x0A,0x1F,0xC1,0x20,0xC5,0x5A,0xA2,0x66,0x13,0x1D,0xC0,0x13,0xC0,0x1D,0xC0,0x9F,0x66,0x91,0x9D,0xC7,0x14,0x05,0xC9,0xB4,0x42,0xFE,0x6E,0x27,0x18,0xC5,0x25,0x18,
+0xC7,0xFE,0x1A,0xC1,0xFE,0x00,0x40,0x05,0xC7,0xA6,0x87,0x19,0x05,0xC2,0x3C,0xA4,0xE6,0x3D,0x31,0x29,0x31,0xA2,0x88,0x3D,0x05,0xC0,0x6E,0x3D,0x05,0xC1,0x0A,0x05,
+0xC1,0x3D,0x05,0x3D,0x5A,0xC0,0x29,0x31,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x10,0x1F,
+0x10,0xC0,0x20,0xC5,0x1D,0x13,0xC0,0x1D,0xC3,0x22,0x60,0x8F,0x8E,0xC7,0x14,0x05,0xC9,0xA8,0x55,0x0E,0x18,0xC5,0x0E,0xAB,0x75,0x18,0xC6,0x8A,0x9E,0xFE,0x00,0x40,
+0x05,0xC7,0xAA,0x66,0x37,0x0A,0x05,0xC0,0x32,0x28,0x3D,0x31,0x56,0xA3,0x98,0xC0,0x29,0x05,0xC3,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x29,0xA2,0x68,0x29,0x3A,
+0xC0,0x9D,0xA9,0x33,0x05,0x3A,0xC3,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x10,0x7F,0x10,0xC0,0x20,0xC4,0x5A,0xA2,0x66,0x13,0x1D,
+0xC0,0x13,0xC0,0x1D,0xC0,0xA8,0x55,0x3C,0x92,0x8B,0xC7,0x14,0x05,0xC9,0xB8,0x21,0x0E,0x18,0xC4,0x25,0x50,0xC0,0x25,0x18,0xC5,0x3B,0xFE,0x00,0x40,0x05,0xC8,0x15,
+0x05,0xC1,0x36,0x37,0xC0,0x29,0x3A,0x33,0xC0,0x3D,0xA2,0x87,0x66,0xC1,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x29,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,
+0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC0,0x37,0x33,0x3A,0x0A,0x1F,0x10,0xC0,0x1F,0x20,0xC4,0x9E,0x68,0x1D,0x13,0x69,0x13,0xC2,0x0C,
+0x0F,0x91,0x9A,0x97,0x9C,0xC7,0x14,0x05,0xC8,0x2A,0xFE,0x65,0xA7,0x25,0x2C,0x18,0xC7,0x25,0x50,0xA6,0x88,0x1A,0x18,0xC1,0x8F,0xAD,0xFE,0x00,0x60,0x05,0xC7,0x14,
+0x3F,0x9A,0x89,0x05,0x1D,0xA0,0xF3,0xFE,0xB1,0x81,0xC0,0x6E,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x29,0x05,0x3A,0x3D,
+0x33,0x31,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0x1F,0xC0,0x10,0x1F,0x20,0xC4,0x5A,0xA2,
+0x66,0x13,0x1D,0xC0,0x13,0xC0,0x1D,0xC0,0xA8,0x55,0x93,0x99,0x95,0x9D,0xC8,0x14,0x05,0xC7,0xFE,0x54,0xE7,0x2C,0x0D,0x95,0x99,0x1A,0x06,0x18,0xC7,0x25,0x0E,0x2C,
+0x18,0xC0,0x8F,0xAD,0xFE,0x11,0x82,0x9D,0x99,0xA3,0x77,0x97,0xCC,0x05,0xC4,0x37,0x10,0x05,0x3C,0x28,0x3D,0x31,0xA2,0x88,0xC3,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,
+0xC0,0x0A,0xC0,0x3D,0x05,0x29,0xC0,0x05,0x3A,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC1,0x37,
+0xAA,0x96,0x1F,0x10,0xC1,0x20,0xC5,0x1D,0x13,0xC0,0x1D,0xC3,0x22,0x98,0x88,0x95,0x9D,0xC9,0x14,0x05,0xC5,0xAB,0x86,0xFE,0x76,0x09,0x2C,0x0D,0x25,0x50,0xA9,0x88,
+0x18,0xC9,0x25,0x3B,0x0E,0x95,0x8A,0xFE,0x12,0x02,0x06,0x9D,0xAA,0x55,0x37,0xA3,0x88,0x37,0x10,0xC0,0x37,0x06,0x0F,0x20,0x35,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x9D,
+0x89,0x05,0x3A,0x3D,0xA2,0x87,0x3D,0x05,0x29,0xC0,0x05,0x3A,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,0xC0,0x3D,0x31,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,
+0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC0,0xAA,0x86,0x7F,0x10,0xC1,0xFE,0x61,0xE7,0xC4,0x5A,0xA2,0x66,0x13,0x1D,0xC0,0x13,0xC0,0x1D,
+0xC0,0xA8,0x55,0x12,0x95,0x9D,0xD1,0x14,0xFE,0x6D,0x69,0x25,0x2C,0xC0,0x99,0x98,0x1A,0x18,0xC9,0x0E,0xFE,0x0A,0x00,0x9B,0xAB,0x13,0x37,0x05,0xC8,0xA6,0x87,0xAC,
+0xE4,0x09,0x31,0xC0,0x29,0x31,0x5F,0xA1,0xA8,0xC0,0x56,0x05,0x0A,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC1,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x3A,0xC0,0x5A,0x33,0x3A,0x33,
+0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC0,0xA5,0x78,0x10,0x1F,0x10,0xC1,0x20,0xC5,0x5A,0xA2,0x66,0x59,0x1D,0xC0,
+0x13,0xC0,0x1D,0x0F,0x91,0x9A,0x97,0x9C,0xCE,0x14,0x05,0xC1,0xBF,0x20,0xFE,0x55,0x63,0x3B,0x0E,0x0D,0x97,0x89,0x18,0xC8,0x8F,0xAD,0xFE,0x11,0x82,0x06,0xA8,0x77,
+0x95,0xBB,0x05,0xC9,0xB5,0x84,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x3D,0x05,0x3D,0x3A,0xC0,0xA2,0x97,0xC0,0x3D,0x05,0xC1,0x31,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,
+0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x37,0x0A,0x1F,0x55,0xC0,0x1F,0x10,0x20,0xC5,
+0x1D,0x13,0xC5,0xA7,0x87,0x94,0x78,0x95,0x9D,0xCA,0x14,0x05,0xC5,0x2A,0xA9,0x56,0x8C,0xDE,0x28,0xB4,0x51,0xFE,0x0A,0x00,0x36,0x18,0xC5,0x39,0x3E,0xFE,0x00,0x40,
+0xAA,0x55,0xA9,0x32,0x13,0x05,0xC9,0xAC,0x87,0x04,0xFE,0xB1,0x81,0x6E,0x3D,0x05,0x29,0xC0,0x05,0xC1,0x3D,0x05,0x0A,0x05,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,
+0x3A,0x31,0x29,0x31,0x05,0x3D,0x3A,0x29,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x0A,0xA8,0x77,0x1F,
+0x10,0xC1,0x20,0xC6,0x1D,0x59,0x1D,0x13,0x69,0x13,0xC0,0xA5,0x77,0x96,0x8A,0x95,0x9B,0xC9,0x14,0x05,0xC9,0xAF,0x54,0xFE,0x55,0x63,0x8F,0xBF,0x39,0xAB,0x84,0x1A,
+0x18,0xC1,0x25,0x99,0x99,0xFE,0x02,0x00,0x93,0xFF,0x05,0xC0,0xB3,0x33,0x95,0xBB,0x05,0xC8,0x14,0x36,0x09,0x9C,0xB9,0xA3,0x88,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x0A,
+0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0xC0,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x31,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,
+0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0xA8,0x77,0x1F,0xC0,0x10,0x1F,0xC0,0xFE,0x61,0xE7,0xC5,0x9E,0x68,0x1D,0x13,0x69,0x13,0xC2,0x36,0x9A,0x86,0x91,0x9F,0xCE,0x14,0x05,
+0xC3,0x2B,0x28,0x39,0xAE,0x73,0x18,0x0E,0x18,0x9D,0x9A,0x9A,0x88,0x39,0xA7,0x86,0x96,0x99,0x0F,0x05,0xC0,0xAB,0x55,0x9D,0x99,0x2B,0x05,0xC9,0xB2,0xE3,0x3D,0xA2,
+0x87,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x3A,0x0A,0xC0,0x3D,0x05,0x29,0xC0,0x05,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC1,0xAB,0x97,0xC0,0x55,0x1F,0xC1,0x20,0xC5,0x1D,0x13,0xC5,0x0C,0x6D,0x8F,0x8E,0xD3,0xAF,
+0x54,0xB7,0x31,0x1A,0x98,0x88,0xA9,0x88,0x18,0xC0,0x0A,0x25,0xA4,0x88,0x25,0x35,0xFE,0x02,0x00,0x9C,0xBB,0xA8,0x77,0xAB,0x64,0x08,0xFE,0x00,0x40,0x05,0xC7,0x14,
+0x05,0xC0,0x00,0x09,0x3D,0xA2,0x87,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x29,0x3A,0x75,0x29,0x37,0x29,0x05,0xC1,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x31,0x3A,0xC2,0x37,0x33,
+0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xAB,0x97,0xC1,0x55,0x1F,0xC0,0x20,0xC4,0x5A,0xA2,0x66,0x59,0x1D,
+0xC0,0x13,0xC0,0x1D,0xC0,0x22,0x6B,0x8D,0x9C,0xD1,0xA8,0x55,0xB6,0x31,0x0D,0x18,0xC0,0x0D,0x2C,0x18,0xC4,0x2C,0xC0,0x0D,0x1A,0x51,0xFE,0x02,0x00,0x0F,0x05,0xC8,
+0x14,0x05,0xB0,0x94,0xFE,0x99,0x61,0xC0,0x71,0x3A,0x33,0xA1,0xA9,0xC0,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x3A,0x0A,0xC0,0x05,0xC0,0x0A,0x05,0x3D,0x31,0x29,0xC0,0x05,
+0x31,0xC0,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC1,0x1F,0x55,0x1F,0x10,0xC1,0x20,0xC5,
+0x1D,0x59,0xC0,0x0C,0x13,0xC2,0x36,0xA1,0x85,0xFE,0x00,0x20,0xD0,0xAF,0x33,0x0E,0x18,0xC3,0x25,0x18,0xC3,0x25,0x15,0x9F,0xAC,0xB4,0x51,0x18,0x39,0x19,0x05,0xCB,
+0x14,0xB1,0xE3,0x3D,0x31,0x29,0x3D,0x31,0x29,0xC0,0xA3,0x98,0x31,0xC0,0x3A,0x05,0xC0,0x0A,0x05,0x29,0xC0,0x3D,0x31,0x3A,0x05,0xC0,0x0A,0x29,0x37,0x29,0x3A,0xC0,
+0x9D,0xA9,0x33,0x05,0x3A,0xC4,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0x10,0x1F,0x10,0xC1,0x1F,0xC0,0x20,0xC6,0x1D,0x13,0xC1,0x0C,0x13,0xC1,
+0xA7,0x65,0x89,0xAF,0xCF,0xB3,0x33,0x36,0x18,0xC4,0x1A,0x98,0x88,0xA9,0x88,0x18,0xC0,0x0D,0xFE,0x0A,0x00,0x05,0xC0,0xFE,0x43,0xE6,0x1F,0x15,0xFE,0x00,0x40,0x05,
+0xC7,0x14,0x05,0xC2,0xAB,0x86,0xA9,0xF5,0x37,0xA1,0xB8,0xC0,0x6E,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x3A,0x05,0x3A,
+0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x10,0x7F,0x10,0xC0,0x1F,0xC0,0x10,0xFE,0x61,0xE7,
+0xC4,0x5A,0x51,0x9B,0xD6,0x75,0xA3,0x6A,0xC0,0x09,0xA4,0x66,0x59,0xC0,0xA7,0x87,0x8C,0x7B,0xC0,0x9D,0x9A,0xCB,0x14,0x0C,0x36,0xA7,0x75,0x18,0xC5,0x9D,0x9B,0x25,
+0x1A,0x18,0x0D,0xFE,0x0A,0x00,0x9B,0xAB,0xAD,0x65,0x36,0x0D,0x13,0x05,0xCA,0x14,0x05,0xC1,0x00,0xFE,0xA1,0xC1,0x3D,0xA2,0x87,0xC0,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,
+0x0A,0x05,0x0A,0x3D,0x31,0x29,0x31,0x05,0x3D,0x3A,0x29,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,
+0x0A,0x3A,0xC1,0xAB,0x97,0x10,0x1F,0xC0,0x10,0x1F,0xC0,0x20,0xC5,0x5A,0x99,0xD6,0x75,0xC0,0x5B,0xC0,0x0A,0x2B,0xC0,0xAE,0x15,0x92,0x79,0x97,0x9C,0xC8,0x14,0x05,
+0xC1,0x0C,0x36,0xA7,0x75,0x18,0xC6,0x06,0x18,0x25,0x2C,0x18,0x9D,0x9B,0x25,0x1A,0x18,0x2C,0xFE,0x09,0x81,0x05,0xCE,0xB0,0x74,0xFE,0x8A,0x21,0x31,0xA2,0x88,0xC2,
+0x3D,0x05,0x6E,0x05,0x0A,0x05,0xC0,0x3D,0x3A,0x29,0x3A,0x05,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x3A,0xC2,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,
+0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x10,0x7F,0xC1,0x10,0x1F,0xC0,0x20,0xC6,0x13,0x75,0xC0,0x0E,0xC1,0x0A,0xC0,0xAA,0x54,0x9F,0x19,0x91,0x9F,0xC8,0x14,0x05,
+0xC0,0xAB,0x55,0x0C,0xA5,0x76,0xC0,0xA6,0x76,0xAA,0x63,0x18,0xC6,0x9D,0x9A,0x19,0xC0,0x13,0xA4,0x63,0xC0,0x15,0x96,0x9C,0x98,0xCC,0x05,0xCA,0x14,0x05,0xC1,0xAB,
+0x86,0x35,0x37,0xA1,0xB8,0xC0,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0x29,0xC0,0x3D,0x31,0x3A,0x05,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x3A,0xC3,0x37,0x33,0x3A,0x33,0xC2,
+0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x0A,0xA8,0x77,0xC0,0x1F,0x10,0xC1,0x1F,0xFE,0x61,0xE7,0xC4,0x1D,0x51,0x9B,0xD6,0x75,0xC0,0x5B,
+0xC2,0x0A,0xC0,0xAA,0x09,0x90,0x7A,0x5A,0xC7,0x14,0x05,0xA5,0x87,0xA6,0x56,0x96,0xBB,0x05,0xC1,0x2B,0xB3,0x22,0x36,0x18,0xC4,0x3B,0xFE,0x00,0x60,0x05,0xC3,0xA8,
+0x55,0x0A,0x05,0xC9,0x14,0x05,0xC2,0xAB,0x86,0x35,0xFE,0x99,0x61,0x31,0xA3,0x88,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x05,0xC0,0x3D,0x05,0x3D,
+0x3A,0xC0,0x29,0x31,0x3A,0xC3,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0xAA,0x86,0x1F,0x10,0xC1,0x1F,0x10,0x1F,0xFE,
+0x61,0xE7,0xC5,0x5A,0x13,0xC0,0x75,0xC0,0x0E,0xC3,0x00,0x8D,0x6A,0xCA,0xAA,0x66,0x9A,0x88,0x05,0xC4,0xAF,0x54,0xBB,0x41,0x18,0xC2,0x12,0x0F,0x05,0xC4,0x03,0x19,
+0x17,0x05,0xCD,0x22,0x04,0x29,0xC0,0xA4,0x87,0x52,0x7E,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x3D,0x05,0xC1,0x51,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x31,0x10,0x1F,0x10,0xC1,0x1F,0x10,0x1F,0x20,0xC5,0x9B,0xB7,0xC0,0x13,0x75,0xC0,0x0E,
+0xC3,0xAC,0x55,0x95,0x2A,0x99,0x9C,0xC8,0xA8,0x55,0xA3,0x88,0x05,0xC6,0x2E,0x36,0x18,0xC0,0x95,0xAD,0xFE,0x01,0x00,0x05,0xC5,0x3F,0x17,0xC0,0x05,0xCC,0x14,0xBA,
+0x71,0xFE,0x99,0x61,0xC0,0x29,0xA4,0x87,0x66,0x29,0x05,0x3A,0x3D,0x0A,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,0x3A,0x75,0x29,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,
+0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC1,0xA5,0x78,0xA5,0xA7,0x1F,0xC0,0x10,0x1F,0xC2,0x20,0xC5,0x2B,0xC0,0x13,0x66,0x79,
+0xC0,0x11,0x90,0xA5,0x2B,0xC0,0x13,0xAA,0x05,0x8F,0x8E,0xC8,0x3F,0x9A,0x89,0x05,0xC7,0x0C,0x1A,0x9A,0x8A,0xFE,0x0A,0x00,0x05,0xC6,0x3F,0x0A,0x05,0xCD,0xB0,0xA6,
+0x04,0xFE,0xB1,0x81,0x6E,0x29,0x37,0x29,0x05,0xC0,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x29,0x05,0x29,0x05,0x3A,0x3D,0x33,0x31,0x3A,0xC0,0x37,0x33,0x3A,
+0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x10,0x1F,0xC2,0x10,0x1F,0xC0,0x20,0xC5,0x2B,0xC0,0x60,0x0E,0xC0,0xAC,0x55,
+0xFE,0xEF,0xBB,0xA2,0x9B,0x9B,0x87,0x94,0x97,0x93,0xA8,0x97,0x77,0x17,0xC0,0x9D,0x9A,0xC5,0xA5,0x88,0xA3,0x66,0x99,0xBB,0x05,0xC8,0xFE,0x43,0xE6,0x9A,0x89,0x19,
+0x05,0xC7,0xAB,0x44,0x0A,0x05,0xC7,0x14,0x05,0xC1,0xAB,0x86,0x35,0xFE,0x99,0x61,0x9F,0xB8,0xC0,0x29,0x31,0xA2,0x88,0x6E,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,
+0x0A,0x3D,0x31,0x05,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x3A,0xC0,0x37,0x79,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x10,
+0x1F,0x10,0xC0,0x1F,0xC1,0x10,0x1F,0xFE,0x61,0xE7,0xC4,0x5A,0x2B,0xC0,0x13,0x0E,0xC0,0x7E,0xFE,0xEF,0xBB,0xA2,0x9B,0xC2,0x95,0x76,0xFE,0x29,0x43,0x08,0x5A,0xC5,
+0xAB,0x55,0x96,0xBB,0x05,0xC9,0xB4,0x42,0x9B,0x57,0x0F,0x05,0xC7,0x2E,0x0A,0x05,0xCA,0xA5,0x87,0x0D,0x37,0x3D,0x65,0x29,0x31,0xA2,0x88,0x3D,0x05,0xC0,0x6E,0xC0,
+0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x29,0x31,0x29,0x31,0x05,0x3D,0x3A,0x29,0x3A,0xC2,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,
+0xC0,0x3A,0xAA,0x86,0x1F,0x10,0xC0,0x1F,0xC2,0x9E,0x59,0x20,0xC4,0x1D,0x51,0x13,0x0E,0x79,0xC0,0x0E,0xFE,0xE7,0x5B,0xA5,0x9A,0xC2,0x1B,0xFE,0x6B,0xAA,0x84,0x9C,
+0xC6,0xAB,0x55,0x96,0xBB,0x05,0xC8,0xA6,0x87,0xFE,0x65,0xA7,0x12,0x0F,0x05,0xC6,0x32,0x10,0x0A,0x05,0xCA,0xB5,0x84,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0xA2,0x88,0xC0,
+0x29,0x05,0xC2,0x6E,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x29,0x37,0x29,0xA2,0x78,0xC0,0x9D,0xA9,0xA3,0x77,0x05,0x3A,0xC5,0x37,0x33,0x3A,0x33,
+0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xAA,0x86,0xC0,0x1F,0x10,0xC1,0x1F,0x10,0x37,0x09,0x20,0xC4,0x1D,0x13,0xC0,0x0E,0x79,0xC0,0xFE,0xE7,0x5B,0xA5,0x9A,0xC3,
+0x21,0xFE,0x18,0xE2,0x9A,0x89,0xC4,0x03,0x5C,0x99,0xBB,0x05,0xC8,0xFE,0x43,0xE6,0xFE,0x76,0x87,0x2C,0x06,0x05,0xC6,0x37,0x32,0x37,0x05,0xC7,0x14,0x05,0xB0,0x94,
+0x35,0xFE,0x99,0x61,0x9F,0xB8,0xC0,0x29,0xC0,0x3D,0xA2,0x87,0xC0,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x3D,0x5A,0x29,0x3A,0xC0,0x29,
+0x3A,0xC1,0x37,0x79,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x10,0xC0,0x7F,0x10,0xC0,0x1F,0xC1,0x92,0x3A,0x20,0xC4,0x5A,
+0x09,0x13,0x0E,0xC0,0x79,0xC0,0xFE,0xE7,0x5B,0xA5,0x9A,0xC3,0x33,0x36,0x8B,0x9D,0xC4,0xAB,0x55,0x96,0xBB,0x05,0xC8,0xAF,0x54,0xFE,0x76,0x09,0x18,0xC0,0x8A,0x9E,
+0x0A,0x05,0xC4,0x32,0x05,0xC0,0x10,0x97,0xBB,0x05,0xC7,0xB0,0xA6,0x04,0x37,0xC0,0x71,0x3A,0x69,0xA1,0xA9,0xC0,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,
+0x0A,0x3D,0x0A,0x05,0xC0,0x29,0x05,0x3A,0x3D,0x33,0x76,0x3A,0xC1,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x0A,0x1F,
+0x55,0xC0,0x1F,0x10,0x1F,0xC0,0x0A,0x9B,0x2B,0x20,0xC4,0x5A,0x09,0x13,0x0E,0xC0,0x79,0xC0,0xFE,0xDE,0xF8,0xA8,0x8B,0xC4,0x21,0xFE,0x18,0xE2,0x9A,0x89,0xC3,0xAB,
+0x55,0x96,0xBB,0x05,0xC8,0xFE,0x44,0xC5,0xAE,0x73,0x18,0xC0,0x97,0x9A,0xFE,0x00,0xA0,0x05,0xC3,0x03,0x19,0x76,0x05,0x03,0x19,0x17,0x05,0xC5,0xB0,0x95,0x35,0x37,
+0x9F,0xB8,0xC0,0x29,0x31,0x29,0x31,0xA2,0x88,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x46,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x31,0x0A,0xA9,0x88,0x55,0xC0,0x1F,0x10,0x1F,0xC0,0x33,0x0E,0x20,0xC4,0x1D,0x09,0x9B,
+0xD6,0x0E,0xC0,0x79,0xC0,0xFE,0x9C,0xF1,0xAF,0x87,0x2D,0x3D,0x0C,0xA3,0x8A,0xC0,0x3D,0x36,0x8B,0x9D,0xC3,0xAB,0x55,0x96,0xBB,0x05,0xC7,0xAF,0x54,0xFE,0x76,0x09,
+0x18,0xC1,0x9D,0x9B,0xFE,0x22,0x84,0x05,0xC2,0x32,0xA3,0x66,0x05,0xC2,0xA6,0x87,0x05,0xC4,0x2B,0xAE,0x85,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0x29,0xA2,0x68,0x29,0xA3,
+0x98,0xC0,0x6E,0xC0,0x52,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x46,0xC4,0x37,0x79,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0xAA,0x86,0x1F,0xC0,0x10,0x1F,0xC1,0x10,0x96,0x4B,0x9C,0x78,0x20,0xC4,0x1D,0x09,0x13,0x0E,0xC0,0x0A,0xC5,0x0E,
+0x0A,0xC0,0xAC,0x46,0x95,0x2A,0x99,0x9C,0xC2,0x03,0x05,0xC8,0x39,0xAE,0x73,0x18,0xC2,0x3B,0xFE,0x00,0x40,0x05,0xC0,0xA8,0x55,0xA3,0x88,0x05,0xC3,0x37,0x9C,0x99,
+0x05,0xC2,0x3C,0x28,0x0F,0xFE,0xA9,0x40,0xA2,0x88,0xC1,0x29,0xA2,0x68,0x29,0x05,0xC0,0x6E,0xC1,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,
+0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0xAA,0x86,0x7F,0xC0,0x10,0x1F,0xC1,0x0A,
+0x16,0x0E,0x20,0xC4,0x1D,0x09,0x13,0x0E,0xC0,0x79,0xC1,0x0E,0x0A,0xC3,0x0E,0x16,0x28,0x8E,0x2D,0xC2,0x06,0x96,0xCC,0x05,0xC6,0xA8,0x55,0xFE,0x65,0xA7,0x18,0xC3,
+0x97,0x9A,0x19,0x05,0x37,0xA3,0x88,0x05,0xC4,0x37,0x10,0x96,0xBB,0x05,0xC0,0xB0,0x94,0xA4,0xD6,0x95,0xFA,0x3A,0xA2,0x97,0x3D,0x7E,0x29,0xC0,0x05,0x3A,0xC2,0x0A,
+0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,
+0x33,0xC0,0x0A,0x3A,0xC2,0xAA,0x86,0x1F,0xC1,0x10,0x1F,0xC0,0x98,0x68,0x99,0x5B,0xC0,0x20,0xC4,0x1D,0x51,0x13,0x0E,0xC0,0x0A,0xC1,0x0E,0xC0,0x0A,0xC0,0x0E,0x0A,
+0x0E,0xC0,0x0A,0xA3,0x2B,0x97,0x59,0xC1,0xA8,0x55,0x19,0x05,0xC6,0xB8,0x21,0xFE,0x76,0x87,0x18,0xC3,0x0D,0xFE,0x0A,0x00,0x07,0x37,0x99,0xBB,0x05,0xC5,0x15,0x2B,
+0x3C,0x28,0x3D,0x31,0x29,0x3D,0x7E,0xC0,0x3D,0x3A,0x29,0x3A,0xC0,0x29,0x3A,0xC0,0xA2,0x97,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x3A,
+0xC3,0x33,0x3A,0xC3,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0xA9,0x88,0x10,0xC0,0x1F,0x10,0x1F,0xC0,0x25,0x16,0x0E,0x20,
+0xC5,0x1D,0x99,0xD6,0xC0,0x0E,0x79,0xC3,0x0E,0x16,0x0E,0x0A,0xC0,0x0E,0x0A,0x20,0x9A,0x55,0x98,0x6B,0xC0,0xAB,0x44,0x96,0xCC,0x05,0xC6,0x1C,0x18,0xC5,0xFE,0x23,
+0x41,0x0A,0x05,0xC7,0xA5,0x88,0xAF,0x83,0x0F,0x31,0x29,0xC0,0x37,0x29,0x3A,0xC0,0x24,0xA4,0x87,0x29,0xC1,0x3D,0x31,0x3A,0x05,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,
+0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x05,0x3D,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x10,
+0x1F,0xC2,0x10,0x1F,0x12,0x56,0xC0,0xA8,0x3B,0xC4,0x1D,0x09,0x13,0x0E,0xC0,0x0A,0xC1,0x0E,0xC1,0x0A,0xC0,0x0E,0x0A,0x0E,0xC1,0xA3,0x79,0x9B,0x18,0x17,0xA8,0x56,
+0x96,0xBB,0x66,0xC5,0xAA,0x66,0xFE,0x76,0x09,0x18,0xC5,0x8F,0xAD,0xFE,0x00,0x60,0x05,0xC8,0x2A,0x25,0x3A,0x37,0x33,0xC0,0x3A,0x29,0x37,0x29,0x3A,0xC0,0x24,0x33,
+0xA1,0xA9,0x3A,0xC2,0xA2,0x97,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x29,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,
+0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0xAA,0x86,0x7F,0xC3,0x10,0x9B,0x7A,0x97,0x5A,0xC1,0x20,0xC4,0x1D,0x09,0x13,0x0E,0xC0,0x0A,0xC1,0x0E,0xC2,0x0A,0xC0,
+0x0E,0x0A,0x0E,0xC1,0x20,0x96,0x36,0xA7,0x57,0x96,0xBB,0x66,0xC5,0xB8,0x21,0xFE,0x76,0x87,0x18,0xC5,0x95,0xAD,0xFE,0x01,0x00,0x05,0xC8,0x15,0x2B,0x33,0x3A,0xC0,
+0x29,0xC0,0x3D,0x31,0x3A,0xA1,0xA8,0x6E,0x29,0xC0,0x3D,0x0A,0xC0,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC1,0x0A,0xC0,0x3D,0x05,0xC1,0x31,0x3A,0xC0,0x37,0x33,0x3A,0x33,
+0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0xAA,0x86,0x7F,0xC4,0x25,0x16,0x56,0xA1,0xA7,0x20,0xC5,0x1D,0x13,0xC0,
+0x0E,0x79,0x0E,0x0A,0xC0,0x0E,0x0A,0x0E,0xC2,0x0A,0xC0,0x0E,0x0A,0x0E,0x1D,0x2A,0x0F,0x62,0xC5,0x1C,0x18,0xC6,0x99,0x9B,0xFE,0x01,0x60,0x17,0x05,0xC8,0xAF,0x84,
+0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x5F,0x05,0x6E,0x3D,0x05,0xC1,0x31,0x3A,0xC0,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,0x3A,0x31,
+0x29,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC0,0x10,0x1F,0xC0,0x10,0x1F,0xC1,0x12,
+0x56,0xC0,0x37,0x09,0x20,0xC5,0x13,0x0A,0xC0,0x0E,0xC4,0x0A,0xC0,0x0E,0x0A,0x0E,0xC3,0x0A,0x22,0x8D,0x9D,0xC5,0x03,0x36,0x18,0xC4,0x1A,0x18,0x0D,0xFE,0x0A,0x00,
+0x05,0xC7,0x14,0x05,0x07,0xFE,0x7A,0x64,0x3D,0x31,0x29,0x3D,0x7E,0x3D,0x31,0x29,0xC2,0x3D,0xA2,0x87,0xC0,0x05,0x31,0x29,0x31,0x3A,0x31,0x0A,0xC0,0x3D,0x05,0x29,
+0xC0,0x05,0x3A,0xC5,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0x1F,0xC2,0x10,0x1F,0x9E,0x59,0x93,
+0x6A,0xC1,0x10,0x20,0xC6,0x99,0xC6,0x0A,0xC0,0x0E,0xC5,0x0A,0xC0,0x0E,0x0A,0x0E,0xC3,0x1E,0x9F,0x08,0x99,0xBB,0x66,0xC3,0xAF,0x54,0x19,0x18,0xC7,0xFE,0x23,0x03,
+0x0F,0x05,0xC9,0xB0,0x74,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x3D,0xA2,0x87,0x3D,0x05,0x29,0xC2,0x3D,0x65,0x3A,0x05,0x0A,0x29,0x05,0x29,0x05,0x3A,0x3D,0x33,0x31,0x3A,
+0xC1,0x29,0x37,0x29,0x3A,0xC0,0x9D,0xA9,0x33,0x05,0x3A,0xC6,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0x10,0xC1,0x1F,0x10,0xC0,0x37,0x16,0x65,
+0xAA,0x74,0x10,0x20,0xC6,0x13,0x0A,0xC0,0x0E,0xC6,0x0A,0xC0,0x0E,0x0A,0x0E,0xC2,0x2B,0x07,0x96,0xAC,0xC4,0x32,0xFE,0x76,0x87,0x18,0xC7,0x3B,0xFE,0x00,0x40,0x05,
+0xC9,0x15,0xFE,0x7A,0x21,0x31,0x29,0x31,0xA2,0x88,0x3D,0x3A,0x29,0x3A,0x24,0x29,0x24,0x29,0x24,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x3A,0x05,0x6E,0x3D,0x31,0x29,
+0xC0,0x05,0x31,0xC0,0x3A,0xC1,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xAB,0x97,0xC3,0x10,0x12,
+0x56,0xC0,0xAD,0xB7,0x1F,0x20,0xC6,0x13,0x0A,0xC0,0x0E,0xC7,0x0A,0xC0,0x0E,0x0A,0x0E,0xC2,0xFE,0x29,0x81,0x95,0x9D,0xC4,0xFE,0x3C,0x62,0xB1,0x75,0x18,0xC7,0x12,
+0xFE,0x00,0x60,0x05,0xCA,0xAF,0x84,0x37,0xC0,0x29,0xA2,0x78,0x33,0xC1,0x29,0xC0,0x24,0x29,0x24,0x3D,0x7E,0xC0,0x6E,0x05,0x29,0xC0,0x05,0xC2,0x0A,0x29,0x37,0x29,
+0x3A,0xC0,0x24,0x33,0x05,0x3A,0xC7,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0x0A,0xA9,0x88,0x10,0xC0,0x1F,0x10,0x0A,0x16,0x0E,0xA3,0xC6,0x10,
+0x1F,0x20,0xC6,0x13,0x0E,0x79,0xC0,0x0E,0x0A,0x0E,0xC4,0x0A,0xC0,0x0E,0x0A,0x0E,0xC2,0x1E,0x9F,0x08,0x98,0xBB,0xC3,0xFE,0x55,0x25,0x18,0xC8,0x94,0x8B,0xFE,0x00,
+0xA0,0x05,0xCA,0x3F,0xFE,0x7A,0x21,0x31,0xC0,0x29,0x31,0xA2,0x88,0x3D,0x3A,0x29,0x24,0x29,0x24,0x3D,0x29,0x05,0xC0,0x29,0xC1,0xA4,0x87,0xC0,0x3D,0x05,0xC1,0x31,
+0x3A,0xC0,0x0A,0x3A,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x10,0x1F,0xC2,0x33,0x9C,0x2B,
+0x79,0xAD,0xB7,0x1F,0xC0,0x20,0xC6,0x2B,0x0E,0x0A,0xC0,0x0E,0x0A,0x0E,0xC5,0x0A,0xC0,0x0E,0x0A,0x0E,0xC1,0x2B,0x07,0x96,0xAC,0xC2,0x03,0x36,0x18,0xC8,0x97,0x9A,
+0x19,0x05,0xCB,0xB1,0x93,0x33,0xA1,0xA9,0xC0,0x3D,0x3A,0x29,0x3A,0xC0,0x29,0x3A,0xC0,0x24,0x29,0x24,0x3D,0x29,0x3D,0x31,0x05,0xC2,0x6E,0x3D,0x05,0x29,0xC0,0x05,
+0x3A,0xC6,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0x10,0x1F,0xC0,0x10,0x1F,0xC0,0x95,0x4B,0x9C,0x78,0x35,0x10,0x1F,0x10,
+0x20,0xC4,0x1D,0x51,0x13,0x0E,0xC0,0x0A,0xC1,0x0E,0xC3,0x0A,0xC0,0x0E,0x0A,0x0E,0xC4,0xFE,0x29,0x81,0x95,0x9D,0xC2,0xAF,0x33,0x0D,0x18,0xC8,0x99,0x9B,0xFE,0x09,
+0x81,0x96,0xCC,0x05,0xCA,0xAF,0x54,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0xA2,0x88,0xC1,0x29,0xC1,0x3D,0x31,0x3A,0x05,0x9C,0x89,0x29,0x24,0x3D,0x05,0x6E,0x3D,0x05,0xC1,
+0x0A,0x05,0xC0,0x29,0x3A,0x31,0x29,0x3A,0xC1,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x10,0x1F,0xC2,
+0x0A,0x16,0x0E,0xAD,0xC6,0x1F,0xC1,0x20,0xC6,0x13,0x0E,0x79,0xC0,0x0E,0x0A,0x0E,0xC6,0x0A,0xC0,0x0E,0x0A,0x0E,0xC1,0xFE,0x3A,0x01,0x91,0x9F,0xC2,0x32,0xFE,0x76,
+0x87,0x18,0xC9,0xFE,0x0A,0xA0,0x05,0xC7,0x14,0x05,0xC1,0xA5,0x88,0xB3,0x84,0xFE,0xB1,0x81,0xC0,0x6E,0x05,0x3D,0x29,0xC0,0x3D,0x0A,0xC0,0x05,0x31,0x24,0x29,0x05,
+0xC0,0x3D,0x05,0x0A,0x05,0x0A,0x05,0xC1,0x3D,0x3A,0x29,0x3A,0xC0,0x29,0x3A,0xC2,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,
+0xC0,0x10,0x7F,0xC1,0x10,0x9B,0x7A,0x97,0x5A,0x35,0x10,0x1F,0x10,0xC0,0x20,0xC5,0x1D,0x13,0xC0,0x0E,0x0A,0x0E,0x0A,0xC3,0x0E,0x16,0x0E,0xC0,0x0A,0xC0,0x0E,0x0A,
+0x0E,0xC1,0x1E,0x9F,0x08,0x98,0xBB,0xC1,0xBF,0x20,0x18,0xCA,0xFE,0x23,0x03,0x8D,0xEF,0x05,0xCB,0xAF,0x84,0xFE,0x99,0x61,0xA1,0xB8,0x3D,0x31,0x29,0xC1,0x3D,0x31,
+0x05,0xC1,0x29,0xC0,0x3D,0xA2,0x87,0xC0,0x05,0x0A,0x3D,0x05,0xC1,0x31,0x5F,0xC0,0x0A,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,
+0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC0,0x10,0x1F,0xC1,0x10,0x93,0x4B,0x0E,0xA7,0xD5,0x1F,0xC0,0x10,0x1F,0x20,0xC5,0x1D,0x13,0xC0,0x0E,0x79,0x0E,0x0A,0x0E,
+0x0A,0xC0,0x0E,0x0A,0x0E,0xC7,0x0A,0x2B,0x07,0x96,0xAC,0xC1,0xFE,0x3C,0x62,0xB1,0x75,0x18,0xC9,0x8A,0x9E,0xFE,0x29,0x81,0x05,0xCB,0x3F,0xFE,0x7A,0x21,0x31,0xC0,
+0x56,0xC0,0x66,0x29,0x37,0x29,0x3A,0xC0,0x24,0x33,0x31,0xA3,0x88,0xC1,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x29,0x3A,0x31,0x29,0x3A,0xC2,0x37,0x33,0x3A,0x33,0xC2,0x3A,
+0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x10,0x7F,0x10,0xC1,0x93,0x4B,0x56,0x10,0x1F,0x10,0xC0,0x1F,0x20,0xC4,0x1D,0x51,0x2B,0x12,0x0E,
+0x0A,0xC0,0x0E,0x0A,0x0E,0xC8,0x0A,0xC0,0x0E,0x0A,0x0E,0x1E,0x99,0x2A,0x62,0xC0,0x1C,0x18,0xCA,0xFE,0x3B,0xE5,0x2B,0x9B,0x18,0x05,0xC7,0x14,0x05,0xC1,0xB1,0x93,
+0x33,0x29,0xC0,0x24,0x29,0x3D,0x31,0x29,0xC1,0x24,0x29,0x24,0xA5,0x87,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x29,0x31,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x10,0x7F,0xC1,0x98,0x68,0x99,0x5B,0x09,0x1F,0xC1,0x10,0x1F,0xB5,0x67,0xA6,0x88,0x6E,
+0xEC,0x3C,0xC0,0x01,0x9C,0x88,0x9A,0x99,0x9D,0x98,0xC3,0x5F,0xC0,0xA2,0x87,0x5A,0xC1,0x1D,0xC1,0x07,0x10,0xC0,0x1D,0x07,0x3C,0x01,0xE1,0x19,0x27,0x07,0x10,0xC1,
+0x1D,0xC0,0x10,0x27,0x1D,0x07,0x1D,0xC8,0x1A,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0x10,0x27,0x1D,0x1A,0x1D,0xC3,0x1A,0xC0,0x1D,0xC0,0x07,0x1D,0xC0,0x1A,0x1D,0xC3,0x07,
+0x1A,0x3C,0x01,0xC0,0x3C,0x01,0xCE,0x00,0xA6,0x78,0x01,0xD8,0x00,0x07,0x1A,0x10,0x1D,0xC2,0x1A,0x1D,0xC0,0x1A,0x1D,0xC0,0x1A,0x1D,0xC2,0x07,0x1D,0xC3,0x07,0x1D,
+0xC2,0x1A,0x1D,0xC7,0x01,0xD2,0x19,0x01,0xD7,0x00,0x27,0x07,0x1D,0xC0,0x10,0x1D,0xC7,0x1A,0x1D,0xD7,0x07,0x3C,0x01,0xDC,0x39,0x01,0xD9,0x00,0x3C,0x01,0xD4,0x00,
+0x98,0xA9,0x1D,0x10,0xC0,0x1D,0x10,0x1A,0x1D,0xC2,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xC1,0x07,0x1D,0xC5,0x1A,0x1D,0xC3,0x1A,0x1D,0xC1,0x1A,0x01,0xDF,0x39,0x01,0xCF,
+0x19,0xC0,0x01,0xD3,0x00,0x27,0x07,0x1D,0xC1,0x07,0x01,0xC5,0x3C,0x01,0xC2,0x19,0x7F,0x01,0x3C,0x01,0xCE,0x3C,0x19,0x27,0x07,0x10,0x07,0x1D,0xC4,0x1A,0x1D,0xD4,
+0x1A,0x1D,0xCB,0x07,0x00,0x19,0x28,0x01,0xC8,0x3C,0x01,0xD5,0x39,0x01,0xC3,0x00,0x39,0x3C,0x28,0xC0,0x00,0x27,0x55,0x27,0x00,0x19,0x28,0x01,0x3C,0x01,0xCC,0x28,
+0x01,0xC3,0x3C,0x01,0xC3,0x28,0x01,0xC3,0x00,0x01,0xC0,0xA1,0xA6,0x47,0xC0,0x01,0x3A,0xC8,0x3C,0x01,0x28,0x19,0x28,0x01,0xCB,0x27,0x18,0x1D,0xC6,0x1A,0x07,0x1D,
+0xC2,0x07,0x1D,0xD9,0x01,0xC3,0x60,0xC0,0x9A,0x97,0x9D,0xA9,0xC1,0x41,0x9D,0x89,0x9C,0x87,0x53,0x51,0xC2,0x2B,0x7F,0xA3,0x86,0x3C,0x13,0xA7,0x67,0xA2,0x98,0xA3,
+0x68,0x01,0x00,0x39,0x01,0xCB,0x93,0xA9,0x10,0x1D,0x01,0xC0,0x39,0x01,0x9C,0x95,0x13,0x99,0x8A,0x2B,0x17,0x9D,0x9A,0xCD,0x6B,0x7E,0xA6,0x74,0xA9,0x88,0x29,0xA8,
+0x85,0x3E,0x47,0xC1,0x67,0x01,0xC5,0x1D,0xC0,0x10,0xC0,0x01,0x29,0x9B,0x99,0x2B,0x05,0xC6,0x14,0x05,0xCE,0xA5,0x88,0x06,0x07,0x1E,0x3E,0x9E,0x7B,0x01,0xC3,0x19,
+0x3D,0x10,0x1D,0xC1,0x31,0x9B,0x8B,0x05,0xDC,0xA9,0x85,0xAA,0x87,0xA8,0x87,0x3E,0x3C,0x01,0xC0,0x19,0x3D,0x10,0x1D,0x10,0x1D,0x1A,0x96,0xB8,0x22,0xA8,0x88,0x3C,
+0x28,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xC7,0x1A,0x1D,0xDB,0x1A,0x1D,0xCC,0x9B,0xB9,0x94,0x89,0xC0,0x16,0x07,0x22,0x18,0x61,0x18,0xC0,0x1D,0xC5,0x1A,0x1D,0xDC,0x1A,
+0x1D,0xCB,0x1A,0x1D,0xFE,0x51,0x42,0xA1,0xE8,0x19,0x0F,0x05,0xC8,0x14,0x05,0xCB,0x14,0x05,0xCA,0x14,0x06,0xA7,0x88,0x13,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC6,0x1A,
+0x1D,0xDD,0x1A,0x1D,0xC6,0x98,0xE9,0x9E,0xF5,0xA3,0xC8,0x79,0x07,0x05,0xCA,0x14,0x05,0xCD,0x14,0x05,0xC9,0xA9,0x85,0x07,0x29,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC7,
+0x1A,0x1D,0xDE,0x1A,0x1D,0xC0,0x9D,0xA9,0x1D,0x1E,0x35,0xA0,0xC7,0xC0,0x9F,0x68,0xFE,0x53,0x07,0x89,0xAD,0xC9,0x14,0x05,0xCF,0x14,0x05,0xC9,0xA5,0x87,0x22,0x07,
+0x1D,0xC1,0x10,0x1D,0x1A,0x1D,0xC8,0x1A,0x1D,0xDF,0x98,0xEA,0x37,0xC0,0x3A,0x37,0x9D,0x4A,0x07,0x05,0xCC,0x14,0x05,0xD1,0x14,0x05,0xC6,0x06,0xA5,0x98,0x18,0xC2,
+0x1D,0xC6,0x1A,0x1D,0xC9,0x9D,0xA9,0x1D,0xD2,0x1A,0x1D,0xC1,0x12,0x3A,0xC1,0x12,0x47,0x06,0x05,0xCD,0x14,0x05,0xD7,0x14,0x05,0xC0,0xAE,0x85,0xA9,0x77,0x18,0x1D,
+0xC0,0x18,0x1D,0xD1,0x10,0xC1,0x1D,0xC0,0x27,0x9D,0x98,0x1D,0xC5,0x07,0x1D,0xC1,0x1A,0x1D,0xC3,0x26,0x37,0x3A,0xC0,0x35,0x9C,0x78,0x0E,0xFE,0x5B,0x27,0x18,0xC2,
+0x1D,0xC8,0x10,0x1D,0x3D,0x41,0xC1,0x3D,0x10,0x71,0xC1,0x3D,0x26,0x10,0x1D,0x10,0x1D,0x10,0x27,0x1A,0x1D,0xC3,0x07,0x1D,0xC4,0x0E,0xFE,0x21,0x41,0x97,0x9C,0xC2,
+0xA5,0x88,0x64,0x05,0xC7,0x14,0x05,0xCA,0xA2,0x77,0x05,0xC0,0x3C,0xA9,0x77,0x18,0x1D,0xC4,0x1A,0x1D,0xC1,0x3D,0x26,0xC0,0x3D,0xA4,0x88,0xC9,0x02,0x3D,0x1D,0xC4,
+0x1A,0x1D,0xC7,0x9B,0xB9,0xFE,0x89,0x40,0x3A,0x33,0x1D,0x26,0xA4,0x87,0x32,0x05,0xC8,0x14,0x05,0xFE,0x7C,0x2B,0xBE,0x87,0x6B,0x9A,0x99,0x90,0x75,0x20,0x05,0x17,
+0x1F,0xB0,0x86,0x88,0x8A,0x17,0x05,0x6E,0x05,0xC6,0x14,0x05,0xCB,0x29,0xA4,0x74,0x1D,0x1A,0x18,0xC0,0x3D,0x26,0x10,0xA1,0xB9,0xCF,0x3D,0x1D,0xC1,0x07,0x1D,0xC5,
+0x07,0x1D,0xC3,0x12,0x3A,0x9F,0x68,0x16,0x65,0xC0,0x0E,0xC0,0x17,0xC0,0x05,0x0C,0x14,0x05,0xC6,0xB5,0x84,0xFE,0xF7,0xB9,0x0B,0xC1,0x93,0x89,0x88,0x98,0x17,0xA6,
+0x98,0xFE,0xC6,0x97,0xA7,0x94,0x21,0x83,0x9B,0x05,0xCD,0x14,0x05,0xC6,0x0F,0x22,0x1D,0x3D,0x10,0x02,0xA3,0x99,0xD1,0x3D,0x10,0x1D,0xC5,0x1A,0xC0,0x1D,0xC0,0x07,
+0x1D,0xC0,0x1A,0x9B,0xC9,0xFE,0x89,0x40,0x37,0x9D,0x4A,0x0A,0xC2,0x16,0x05,0xCB,0x3C,0x19,0xA6,0x77,0x7A,0x04,0x0B,0x9D,0x98,0x87,0x99,0x83,0x8C,0xB7,0x99,0x0B,
+0x04,0x31,0x13,0x05,0xCA,0x14,0x05,0xC8,0xA6,0x87,0x0F,0x94,0x9C,0xA4,0x89,0xC6,0x02,0xC0,0x3D,0x25,0xC9,0x3D,0x10,0x07,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0xC0,0x1D,
+0xC4,0xFE,0x51,0x42,0x33,0x35,0x0A,0xC2,0x5B,0x0A,0xFE,0xD6,0xD7,0xA9,0x97,0xC0,0x04,0x0B,0xC0,0x04,0x8D,0x97,0x20,0x2D,0x0E,0xC0,0x98,0x77,0x83,0x9A,0x17,0x05,
+0xC7,0x14,0x05,0xCA,0x06,0xA7,0x88,0x25,0xC3,0x02,0x26,0xC0,0x61,0xC1,0xA2,0x77,0xB0,0x78,0x01,0xC1,0x28,0x01,0xC4,0x3C,0x01,0xC2,0x06,0x05,0xC8,0x14,0x05,0xC1,
+0xFE,0xBE,0x54,0x0E,0xC1,0x04,0x6B,0x0E,0x0B,0x8E,0x99,0x96,0x87,0x04,0x0B,0xC0,0x19,0x85,0x77,0x2B,0x05,0xC9,0x14,0x05,0xC8,0xB5,0x84,0x22,0x25,0xC1,0x9C,0x88,
+0x15,0xC0,0x26,0x15,0xC0,0x26,0x15,0x26,0x25,0xC7,0x40,0x10,0xC0,0x1D,0xC9,0x1A,0x1D,0x9B,0xB9,0xFE,0x61,0x01,0xA0,0xA7,0x0A,0xC3,0xFE,0x4B,0x0A,0x28,0x01,0xCB,
+0x66,0x8F,0xA6,0x97,0x9C,0xC9,0x14,0x05,0xC0,0xFE,0xA5,0x72,0x0B,0x6B,0x9D,0x97,0x2D,0x11,0x9C,0x99,0x21,0xA9,0x89,0x21,0x34,0x21,0x04,0x0B,0x9A,0x99,0x85,0x77,
+0x17,0x05,0xD3,0xA9,0x85,0x0F,0x25,0xC0,0x1F,0x15,0xC0,0x26,0x15,0xC1,0x26,0x15,0xC0,0x25,0xC6,0x02,0xC0,0x1D,0xC4,0x1A,0x1D,0xC6,0x98,0xC9,0x13,0x0A,0xC3,0xA3,
+0xB7,0x33,0x19,0x33,0x00,0x29,0x3E,0x6B,0x9D,0x89,0x9A,0x97,0xC0,0xA4,0x77,0x3D,0x0B,0xC1,0x33,0x06,0x90,0x9C,0xCB,0x14,0x05,0xC6,0xB5,0x84,0x22,0x15,0xC0,0x26,
+0x15,0xC2,0x26,0x15,0xC1,0xA8,0x88,0xC6,0x02,0x6E,0xC0,0x18,0xC0,0x1D,0xC9,0x1A,0x98,0xF9,0x9D,0xE7,0xC0,0xFE,0x53,0x07,0xAD,0x97,0xAD,0x8A,0xA9,0x99,0xA2,0x97,
+0xA2,0x88,0xC0,0x5A,0x3A,0x19,0xC0,0x0B,0xC1,0x93,0x89,0x8B,0x9A,0x21,0x36,0x8B,0x9D,0xD2,0x14,0x3F,0x36,0x15,0xC0,0xA2,0x78,0x15,0xC3,0x26,0x15,0x26,0x25,0xC6,
+0x40,0x18,0xC2,0x1D,0xC9,0x9B,0xBA,0x9B,0xF6,0x9F,0xB9,0xC0,0x3D,0xC1,0x10,0x02,0x3D,0xC8,0x26,0x3D,0xA3,0x87,0x64,0x05,0xCA,0x14,0x05,0xA2,0x77,0x1E,0x34,0xA4,
+0x87,0x3A,0xA2,0x88,0x12,0xC0,0x69,0xC1,0x0E,0x0B,0x0E,0x2B,0x21,0x0E,0xC0,0x8F,0x98,0xFE,0x29,0x83,0x05,0x6E,0x05,0xC7,0x14,0x05,0xC7,0xB3,0x84,0x3C,0x9A,0x8B,
+0xC0,0x26,0x15,0xC4,0x25,0xC7,0x07,0x18,0x1D,0xCC,0x9B,0xB9,0x13,0x66,0xC1,0x3C,0x3D,0xC2,0x10,0x02,0x3D,0xC8,0x29,0x96,0x88,0x97,0x9C,0xC8,0x14,0x05,0xC2,0xAF,
+0x87,0x16,0xC1,0x11,0x2A,0xA4,0x98,0x12,0xC0,0x0B,0xC0,0x7A,0x0B,0x34,0x0E,0x0B,0x93,0x89,0x88,0x8A,0xA9,0xA6,0x85,0x8A,0x05,0xCA,0x14,0x05,0xC5,0x06,0x22,0x95,
+0x9D,0xC0,0x26,0x15,0xC3,0x3D,0x25,0xC7,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0xC7,0x1A,0xC0,0x98,0xF9,0x13,0x75,0xC0,0x5B,0xFE,0x00,0x60,0xA3,0x98,0x22,0x15,0xC0,0xA2,
+0x78,0x15,0xC2,0xA4,0x87,0x25,0xC8,0x3D,0x1D,0xC6,0x1A,0x1D,0xC4,0xFE,0x51,0x42,0x0E,0x0A,0xC0,0x0E,0x0A,0xC0,0x0E,0xC0,0x0A,0x0E,0x02,0xC1,0x3D,0xC0,0x26,0x3D,
+0xA3,0x87,0x3D,0x10,0x02,0x3D,0xC5,0x36,0x3D,0xC3,0x06,0x17,0x05,0xC7,0x14,0x05,0xC3,0x20,0x2A,0xA4,0x9C,0xC1,0x98,0x85,0x8A,0x76,0x33,0xB8,0x75,0xC2,0x34,0xA8,
+0x99,0x2D,0x11,0xAF,0x9A,0x83,0x66,0x93,0x55,0x06,0x99,0xAB,0x05,0xC7,0x14,0x05,0xC8,0xB5,0x84,0x20,0x15,0xC0,0x26,0x15,0xC0,0x3D,0x25,0xC9,0x3D,0x1D,0xC7,0x1A,
+0x1D,0xC3,0x0D,0x0A,0x5B,0x0A,0x6F,0xA5,0x3B,0xC2,0x5A,0x09,0x06,0xC0,0x9D,0x99,0x02,0x07,0x02,0xC0,0x3D,0xC3,0x10,0x02,0x3C,0x3D,0xC2,0x05,0xCB,0x14,0x05,0xA2,
+0x77,0xA4,0x98,0xFE,0xBD,0xD4,0xB0,0x79,0x31,0x93,0x74,0x87,0x35,0x9B,0xAB,0x95,0xBB,0xBE,0xB9,0xB8,0x75,0xC1,0x34,0x19,0x11,0x1B,0x98,0x86,0x82,0x13,0x99,0xFD,
+0xFE,0xBE,0x54,0x94,0x97,0x17,0xC0,0x05,0xCA,0x14,0x05,0xC3,0x06,0xA1,0xA7,0x15,0xC0,0x26,0x15,0x26,0x25,0xC9,0x9C,0x88,0x18,0xC2,0x1D,0xC9,0x9B,0xB9,0xFE,0x61,
+0x43,0x9D,0xB7,0x0E,0xC0,0x0A,0x09,0xC1,0x5A,0xA2,0x98,0x09,0xC1,0x06,0x1D,0x09,0xC1,0x06,0x1D,0x09,0x06,0xC1,0x02,0xC0,0x3D,0xC0,0xA4,0x97,0x97,0x76,0x05,0xCB,
+0x14,0x05,0xC0,0x3A,0x11,0xA3,0xA9,0x54,0x8B,0x78,0xA1,0x46,0x25,0xAC,0x75,0x21,0x12,0x69,0x04,0x34,0xA5,0x99,0x96,0x79,0x37,0x21,0xC0,0x2B,0xA3,0x89,0x34,0x3C,
+0x92,0x8B,0xD1,0xA9,0x97,0xAE,0x62,0x15,0xC0,0x02,0x25,0xCB,0x3D,0x27,0x59,0xC5,0x1A,0x1D,0xC4,0x20,0xFE,0x61,0x01,0xA0,0xA7,0x0E,0xA3,0xC6,0xC0,0x09,0xC1,0xA2,
+0x88,0xC0,0x09,0x06,0x09,0xC1,0x06,0x1D,0x09,0x06,0x09,0xC2,0x06,0x1D,0x09,0x06,0xC0,0xA9,0x54,0x05,0xC8,0x14,0x05,0xC5,0xFE,0xBD,0xD1,0x0B,0x04,0x2B,0x9D,0x9A,
+0x0B,0x7A,0x5B,0x0B,0xC1,0x34,0x0E,0x0B,0xC5,0x1F,0x05,0xD1,0x3A,0xB2,0x74,0x02,0xA3,0x99,0xCC,0x02,0xC0,0xA4,0x67,0xC7,0x1A,0x1D,0xC1,0x9D,0xA9,0x1D,0x1E,0xFE,
+0x99,0x61,0xC0,0x79,0x62,0x37,0x09,0xC1,0x06,0xA2,0x98,0x09,0x1D,0x09,0xC0,0x1D,0x09,0x1D,0x09,0x1D,0x09,0xC1,0x06,0x09,0xC0,0x1D,0x09,0xC0,0x1D,0x05,0xCC,0x14,
+0x05,0xC1,0xFE,0xAD,0x8E,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,0x34,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0x0E,0x2B,0x36,0x90,0x8B,0x05,0xD0,0x3A,0x0F,0x25,0xCD,0x9C,0x87,
+0x18,0xC2,0x6E,0xC8,0x07,0x1D,0x0A,0xA4,0xD7,0xC1,0x33,0xC0,0x09,0xC0,0x06,0xC0,0x09,0xC0,0xA2,0x88,0x06,0x1D,0x09,0x06,0x09,0xC1,0x20,0x05,0x6E,0x05,0xC8,0x14,
+0x05,0xC3,0x3D,0x0B,0x04,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0x9D,0x98,0xC0,0x0E,0xC4,0x93,0x79,0x16,0x15,0x05,0xD1,0x0F,0x3C,0x25,0xCB,0x3C,0xA3,0x6A,0xC8,0x1A,0x1D,
+0xC2,0x1A,0x1D,0x35,0x37,0x3A,0x33,0x3A,0x33,0xC3,0x3A,0xC0,0x2D,0xC1,0x69,0x2D,0xC0,0x06,0xC2,0x09,0xC1,0xA7,0x77,0x31,0x17,0x05,0xC8,0x14,0x05,0xC4,0x3D,0xB3,
+0x8B,0xC7,0x0E,0x0B,0x34,0x0B,0x0E,0x0B,0xC2,0xFE,0x6B,0xAB,0x89,0x9A,0x20,0x95,0x9B,0xC9,0x14,0x05,0xC4,0xA6,0x87,0x0F,0x3C,0x36,0xC0,0x02,0x66,0x02,0x3D,0xC7,
+0x1D,0xC4,0x1A,0x1D,0xC7,0x36,0xFE,0x89,0x40,0xA1,0xB9,0x37,0x33,0xC0,0x3A,0x33,0xC3,0x3A,0x2D,0xC1,0x26,0x2D,0xC0,0x26,0x2D,0xC0,0x26,0x2D,0xC1,0xAA,0x43,0x8D,
+0xAD,0x05,0xD0,0xFE,0xAD,0x8E,0x0B,0x0E,0x0B,0xC7,0x96,0x86,0x0B,0xC2,0x0E,0x95,0x7B,0xFE,0x18,0xE2,0x05,0x3C,0x05,0xCA,0x14,0x05,0xC3,0xAA,0x78,0x0F,0x98,0x9D,
+0x1D,0xC5,0x10,0xC1,0x1D,0x10,0x27,0x1D,0xC4,0x1A,0x1D,0xC8,0x98,0xE9,0x37,0xC0,0x29,0xA2,0x78,0x33,0x3A,0x33,0xC3,0x3A,0xFE,0x41,0x45,0x26,0x2D,0xC0,0x26,0xC0,
+0x2D,0xC4,0xA7,0x65,0x3C,0x05,0xCB,0x14,0x05,0xC3,0x3D,0x0B,0x0E,0x0B,0xC5,0x9D,0x98,0x19,0x2B,0x0B,0xC3,0xFE,0x5B,0x4A,0x05,0xC0,0x16,0x08,0x05,0xC7,0x14,0x05,
+0xC5,0x22,0x32,0x18,0x1D,0xC6,0x1A,0x1D,0xCC,0x1A,0x1D,0xC4,0x1E,0x37,0xC0,0x71,0x3A,0x33,0xC0,0x3A,0x33,0xC2,0x3A,0x2D,0xC0,0x26,0x2D,0xC3,0x26,0xC0,0x2D,0xC0,
+0xA7,0x76,0x99,0x67,0x17,0x9D,0x9A,0xC8,0x14,0x05,0xC5,0x3D,0x0B,0xC2,0x0E,0x0B,0xC2,0x2B,0x9D,0x9A,0xA4,0x87,0x0B,0xC0,0x0E,0x0B,0x88,0x9B,0x05,0xC1,0x3F,0x51,
+0x05,0xCA,0x14,0x05,0xC2,0x0F,0x3C,0x9E,0x8B,0xA5,0x67,0xC0,0x10,0x1D,0x1A,0x1D,0xC9,0x1A,0x1D,0xCB,0xFE,0x61,0x43,0xFE,0xA1,0x60,0x6B,0xC0,0x33,0x3A,0x33,0xC4,
+0x3A,0x22,0x05,0xC9,0x14,0x05,0xC6,0xFE,0xBD,0xD1,0x0B,0xC0,0x0E,0x0B,0xC3,0x8F,0xAB,0x86,0x76,0x93,0x9C,0x11,0x0B,0xC0,0x12,0x95,0x8A,0x3A,0x05,0xC1,0x3A,0xA3,
+0x86,0x97,0x9C,0xC7,0x14,0x05,0xC4,0x3C,0x32,0xFE,0x21,0x65,0xC0,0x15,0x26,0xC0,0x36,0xC0,0x07,0x10,0x1D,0xC0,0x1A,0x07,0x1D,0xC8,0x1A,0x13,0x05,0xD1,0xA5,0x87,
+0xFE,0xBE,0x54,0xAD,0x98,0xC0,0x0E,0x0B,0xC1,0x61,0x8A,0x8B,0x2B,0x7F,0xA9,0x88,0xAA,0x77,0x0B,0x61,0x19,0x25,0x0A,0xC0,0x05,0xC0,0xA5,0x88,0x3F,0x05,0xC7,0x14,
+0x05,0xC3,0x2B,0x22,0x3C,0xC0,0x3D,0x10,0x02,0x3D,0xC5,0x26,0xC0,0x15,0xA1,0xC8,0x36,0x3D,0x10,0x02,0x3D,0x1D,0xC2,0xFE,0xA1,0x61,0x22,0x91,0x9B,0x17,0x05,0xC9,
+0x14,0x05,0xC4,0x36,0x16,0x25,0x2D,0x0B,0xC1,0x86,0x87,0x33,0xB4,0x73,0x12,0x9D,0x97,0x7F,0x0B,0x98,0x9A,0xFE,0x52,0xC6,0x05,0xC5,0x16,0x05,0xCC,0xAF,0x84,0xA8,
+0x78,0x3D,0xC0,0x02,0x3D,0xCD,0x02,0x3D,0xC9,0x41,0xC0,0x9E,0xB5,0xA1,0xEA,0xFE,0xA1,0x61,0xC1,0x5A,0x79,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x13,0x05,0xC9,0x14,0x05,
+0xC6,0xB0,0x74,0x9B,0x98,0x05,0xAC,0x87,0xFE,0xBD,0xD4,0x0B,0x0E,0x19,0xA6,0x78,0x9D,0x97,0x37,0xC0,0x0B,0x93,0x89,0x25,0x05,0xC6,0x3F,0x05,0xC8,0x14,0x05,0xC0,
+0x16,0xAF,0x75,0x97,0x9C,0x3D,0xC0,0x10,0x02,0x3D,0xCD,0x26,0x3D,0x0F,0x3D,0xC0,0x10,0x02,0x3D,0x9D,0xA8,0xA0,0xA8,0xA0,0xC7,0x9E,0xB6,0x35,0x74,0xA1,0xA9,0xC0,
+0x71,0x3A,0x33,0xC1,0x3A,0x33,0xC3,0x3A,0xFE,0xF7,0xFA,0xC2,0x61,0x11,0x3F,0x05,0xC7,0x3F,0x05,0xCA,0x14,0xB4,0x73,0x0F,0x3C,0x3D,0xC0,0x10,0x02,0x3D,0xD0,0xA2,
+0x77,0x26,0x1E,0x9D,0xD8,0x35,0x25,0x37,0x33,0x6B,0x33,0x3A,0x09,0xA2,0x98,0xC1,0x9E,0x68,0x9D,0x99,0xC1,0x26,0x2D,0xC3,0x26,0x2D,0xC0,0x36,0x96,0x88,0x05,0x6E,
+0x05,0xCA,0x14,0x05,0xC3,0xAF,0x84,0x9B,0x7B,0xA5,0x43,0x9C,0xAB,0x9D,0xAA,0x06,0xAC,0xB8,0x21,0x0E,0x0B,0x97,0x9A,0x87,0x89,0x84,0x9B,0xC9,0x32,0x17,0x05,0xC6,
+0x14,0x05,0xC0,0x22,0x6B,0x99,0x9C,0x10,0x02,0x3D,0xCE,0x69,0x26,0x1E,0x9D,0xC9,0x35,0x25,0xA1,0xB9,0x5A,0x33,0xC0,0x3A,0xC0,0x37,0x3A,0xC0,0x33,0xC2,0x3A,0x37,
+0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x20,0xC3,0x2D,0xC1,0x26,0x2D,0xC2,0x26,0x2D,0xC1,0x07,0x31,0x05,0xCC,0x14,0x05,0xC2,0xA6,0x87,0x3C,0x15,0xFE,0x65,0xA7,0xA4,
+0x76,0xC1,0xA2,0x87,0x0D,0x9A,0xBD,0x3E,0x32,0x05,0xC9,0x14,0x05,0xCA,0x16,0xAE,0x63,0x95,0xAF,0x10,0x3D,0xCD,0x26,0x2B,0x9E,0xB6,0x25,0xA1,0xB9,0x37,0x33,0xA1,
+0xA9,0x9D,0x89,0x37,0x3A,0x37,0x29,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0xC0,0xFE,0x10,0xC1,0x36,0xA7,0x74,0xC2,0x9D,0x9A,
+0x1A,0x9A,0x89,0xFE,0x09,0x81,0x95,0xDD,0xC0,0xA7,0x55,0xA8,0x66,0x06,0x7B,0x0A,0x05,0xC7,0x14,0x05,0xC5,0x22,0x0F,0x3C,0x3D,0xC1,0xA3,0x68,0x02,0x3D,0xC3,0x69,
+0x26,0x1E,0x0E,0xC0,0xA3,0xC6,0x33,0x37,0x29,0x3A,0x33,0xC1,0x76,0x3A,0x37,0x29,0x3A,0xC0,0x37,0x33,0xC3,0x3A,0x2D,0xC1,0x26,0x2D,0xC0,0x36,0x2D,0x26,0xC0,0xA7,
+0x66,0x22,0x05,0xC8,0x14,0x05,0xC5,0xA4,0x66,0x28,0x3C,0x19,0x05,0xFE,0x5C,0xE8,0x18,0xC2,0x8F,0xAD,0x1C,0x1A,0x8C,0xAD,0x06,0xB4,0x64,0xAD,0x52,0x0D,0xFE,0x22,
+0x84,0x95,0xBB,0x24,0x17,0x0A,0x05,0xCC,0xAC,0x87,0xA7,0x86,0x3D,0x36,0x02,0x3D,0xC0,0x36,0x3D,0xC0,0x9D,0xA8,0x1E,0x0E,0x35,0x25,0xA1,0xA9,0x3A,0x37,0x71,0x66,
+0x3A,0x24,0x29,0xC1,0xA2,0x88,0x31,0x29,0x26,0xC0,0x2D,0x26,0xC0,0x2D,0xC1,0x22,0x9D,0xAC,0xA8,0x64,0x3C,0x05,0xC7,0x14,0x05,0xC3,0x06,0xAE,0x41,0xAC,0x66,0xA3,
+0x97,0x95,0x8A,0x06,0x7B,0xC0,0x2C,0x1A,0x51,0x18,0xC0,0x39,0xFE,0x6B,0xAB,0xFE,0x76,0x09,0x9D,0x77,0x9E,0x86,0xA9,0x88,0x18,0xC0,0x99,0x9B,0xFE,0x01,0x60,0x17,
+0x10,0x97,0xBB,0x62,0xCB,0x14,0xB4,0x73,0x97,0x9C,0xA3,0x69,0x02,0x66,0x20,0x1E,0xA0,0xA9,0x35,0xA0,0xB7,0x3A,0x7A,0x7E,0x9D,0x89,0xC1,0x3D,0xA2,0x87,0x3D,0x31,
+0x29,0xC0,0x05,0xC2,0x3A,0xC0,0x26,0xC1,0x2D,0xC0,0x13,0x69,0x13,0xC1,0xA7,0x87,0x92,0x79,0x97,0x9C,0xCA,0x14,0x05,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC1,0x9D,0x9B,
+0xFE,0x23,0x03,0xFE,0x00,0x40,0xC0,0xAA,0x55,0xBB,0x30,0x1A,0x06,0x18,0x06,0xFE,0x4C,0x07,0x36,0x18,0x97,0x9A,0x1F,0x18,0xC1,0x3B,0xFE,0x00,0x40,0x32,0x64,0x05,
+0xC8,0x14,0x05,0xC0,0x16,0xAE,0x63,0x1E,0x2B,0x9E,0xB6,0x35,0x37,0xC0,0x29,0xA4,0x87,0x3D,0x7E,0x29,0x05,0x3A,0x3D,0x65,0x05,0xC1,0x3D,0x31,0x05,0xC0,0x3D,0x05,
+0xC0,0x3D,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0x33,0xC6,0x3A,0x33,0x3A,0x13,0x7B,0x22,0x21,0x1D,0xC2,0x13,0xC1,0xA8,0x66,0x8D,0x9C,
+0x9B,0x9A,0x17,0x05,0xC5,0x14,0x05,0xC2,0x1C,0xAD,0x51,0x18,0xC2,0x99,0x9C,0xFE,0x12,0x02,0x17,0x05,0xBF,0x20,0xFE,0x55,0x63,0x1F,0x18,0xC0,0x0D,0xC0,0x1A,0x0A,
+0x9B,0x9D,0x1F,0x18,0xC0,0x25,0xFE,0x01,0x60,0x05,0xA7,0x78,0x9D,0x87,0x05,0xC8,0x14,0x05,0x13,0xFE,0x89,0x40,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0xA1,0xA8,0xC0,0x3D,
+0x05,0x3D,0x31,0x29,0x05,0xC1,0x1D,0x13,0xC2,0x1D,0x13,0xC3,0xA5,0x77,0x8B,0x9D,0xCC,0x2B,0xFE,0x65,0xA7,0x18,0xC4,0x0E,0x28,0x05,0xB4,0x42,0x0D,0x9C,0x88,0x0D,
+0x18,0xC0,0x0D,0x18,0xFE,0x54,0xE7,0x10,0x0E,0x18,0xC1,0xFE,0x1A,0xC1,0xFE,0x00,0x40,0x05,0x10,0x0A,0x05,0xC8,0x14,0x1D,0xFE,0x99,0x61,0xC0,0x29,0x3A,0x33,0xA1,
+0xA9,0x29,0x05,0x6E,0x3D,0x05,0x29,0x37,0x29,0x3A,0xC0,0x29,0x36,0x18,0x0D,0x9C,0x89,0x06,0xC0,0x18,0x15,0xFE,0x00,0x40,0xAE,0x53,0x36,0x18,0xC0,0x3B,0x0A,0x66,
+0x32,0xA3,0x66,0x08,0x05,0xC8,0xB3,0xB7,0xFE,0xA1,0xC1,0x31,0x29,0x31,0x3A,0x3D,0x7E,0xC0,0x3D,0x05,0x3D,0x05,0xC0,0x29,0xA2,0x68,0x29,0x05,0x29,0x05,0x6E,0x29,
+0x05,0xC0,0x3D,0x3A,0x1D,0x13,0xC0,0x1D,0x13,0xC0,0x1D,0xC0,0x13,0xC0,0x07,0x98,0x96,0x91,0x9F,0xCC,0xA6,0x87,0x36,0x18,0xC5,0x25,0xFE,0x01,0x60,0x05,0x39,0x18,
+0x06,0x18,0x25,0xC0,0x50,0x37,0x05,0xC0,0xAF,0x54,0x36,0x18,0x39,0xFE,0x00,0x40,0x05,0xC0,0x10,0x19,0x05,0xC8,0x00,0xFE,0xA1,0x61,0x3D,0x65,0x29,0xC0,0xA3,0x98,
+0x29,0xC0,0x31,0x05,0x3D,0x31,0x29,0xC0,0x05,0x31,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC0,0x29,0xC0,0xA2,0x68,0x29,0x3A,0xC0,0x9D,0xA9,0x33,0x05,0x3A,0x37,0x33,0x3A,
+0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC1,0xA2,0x97,0x1D,0x13,0x1D,0x13,0xC0,0x1D,0xC0,0x22,0x13,0x22,0xA4,0x98,0x92,0x79,0x97,0x9C,0xCD,
+0x12,0x1A,0x18,0xC5,0x3B,0xFE,0x00,0x40,0xBD,0x20,0x1F,0x18,0xC2,0x39,0x8A,0xCE,0x05,0xC1,0xAF,0x54,0xFE,0x55,0x63,0x39,0xFE,0x00,0x60,0x05,0xC0,0x2B,0x10,0x96,
+0xBB,0x05,0xC7,0xAB,0x86,0xA7,0xF6,0x33,0x37,0xA1,0xB8,0xC0,0x3D,0x05,0x3D,0x3A,0x05,0xC0,0x3D,0x3A,0x29,0x3A,0x05,0xC0,0x3D,0x05,0x3D,0x29,0x05,0x29,0xC1,0x37,
+0x29,0x3A,0xC0,0x24,0x33,0x05,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0xA2,0x97,0xFE,0x4A,0x25,0xC0,0x7B,0xC0,
+0x13,0xC0,0x1D,0xA0,0x56,0x1D,0x22,0xA2,0x88,0x8B,0x9D,0x6E,0x05,0xCC,0xBF,0x20,0x1F,0x18,0xC5,0x97,0x9A,0xFE,0x01,0x60,0xAE,0x76,0x1F,0x18,0xC3,0x9D,0x9B,0x3B,
+0xFE,0x12,0x02,0x0F,0x05,0x24,0xAF,0x64,0x19,0x05,0xC1,0x10,0x96,0xBB,0x05,0xC8,0x20,0xA9,0xF5,0xFE,0x99,0x61,0xC0,0x29,0x3A,0x33,0xC0,0x3D,0xA2,0x87,0x3D,0x7E,
+0x29,0xC0,0x05,0xC2,0x3D,0x05,0xC2,0x3A,0xC0,0x29,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0x37,0x33,0x3A,0x33,0xC0,
+0x3A,0x33,0xAA,0x87,0xFE,0x4A,0x25,0x1D,0x13,0x0C,0x13,0xC2,0x36,0x8B,0x9D,0xCE,0x32,0x1F,0x18,0xC5,0x0D,0xFE,0x0A,0x00,0x17,0x0D,0x18,0xC5,0x99,0x9C,0x3B,0xFE,
+0x11,0x82,0x96,0xBB,0x2B,0x10,0x05,0xC1,0x2B,0x10,0x05,0xC9,0x3F,0x36,0x37,0x3D,0x29,0x3A,0x33,0xC0,0x3D,0xA2,0x87,0x66,0xC0,0x0C,0x6B,0xC5,0x36,0x8B,0x9D,0xC3,
+0xA3,0x87,0x05,0x6E,0x05,0xC6,0x2A,0x0D,0x18,0xC6,0xFE,0x3B,0xE5,0x96,0xCC,0x0D,0x18,0xC7,0x2C,0x15,0x0A,0xA4,0x88,0x3F,0x0F,0x05,0xC0,0x10,0x44,0x9D,0xAA,0x05,
+0xC8,0xAA,0x66,0xAD,0xB6,0xFE,0x99,0x61,0xC0,0x29,0x3A,0x33,0xA1,0xA9,0xC2,0x1D,0xC0,0x59,0xC3,0x22,0x68,0x8D,0x9F,0xC7,0x7F,0x05,0xC4,0x32,0x0E,0x18,0xC6,0x0E,
+0xFE,0x22,0x84,0x1A,0x51,0x18,0xC7,0x06,0x8D,0x9D,0x05,0xA8,0x55,0x10,0x0A,0x10,0x24,0x9C,0x99,0x10,0xC0,0x19,0x05,0xC7,0x13,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0x56,
+0x31,0xA2,0x88,0x3D,0x05,0xC0,0x3D,0x13,0xC0,0x22,0x13,0xC0,0x1D,0xC1,0xA3,0x67,0x36,0x20,0x95,0x9B,0xC8,0x14,0x05,0xC3,0xA2,0x77,0xBD,0x31,0x18,0xC6,0x99,0x9C,
+0xFE,0x2B,0x24,0x1F,0x18,0xC9,0x0E,0x05,0xC0,0x10,0x37,0x06,0x37,0x32,0x37,0x55,0x10,0x0A,0x05,0xC6,0x16,0x35,0x31,0xC0,0x56,0x31,0x3D,0xA2,0x87,0x66,0xC1,0x3D,
+0x3A,0x29,0x3A,0xC0,0x29,0xC0,0x3D,0x31,0x29,0x31,0x05,0x3D,0x3A,0xC0,0x33,0x3A,0xC2,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x3A,
+0x13,0x1D,0x13,0xC0,0x1D,0xC3,0x36,0x92,0x89,0x99,0x9C,0xCF,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC6,0x8F,0xAD,0x1F,0x18,0xC8,0x9D,0x9A,0x3B,0xFE,0x00,0x40,0x05,0xAB,
+0x44,0x0A,0xA2,0x87,0xA5,0x67,0x28,0x37,0x10,0x37,0x2B,0x1D,0x13,0xC0,0x1D,0xC0,0x22,0x1D,0xC1,0xA8,0x55,0x2B,0x05,0xC8,0x14,0x05,0xC4,0x32,0x0E,0x18,0xC6,0x0E,
+0x18,0xC9,0x9D,0x9B,0x0C,0x05,0x03,0x9B,0x98,0x05,0xC1,0x19,0x2B,0x37,0x10,0x2B,0xB2,0x73,0x05,0xD1,0xFE,0x43,0xE6,0x1F,0x18,0xC5,0x97,0x9A,0x1A,0x51,0x18,0xC7,
+0x0E,0x28,0x05,0x37,0x05,0xC1,0x2B,0x10,0x28,0x37,0xA7,0x77,0x37,0x05,0xC5,0xA6,0x87,0xAC,0xE4,0x3D,0x65,0xA2,0x88,0xC1,0x3D,0xC1,0x05,0xC1,0x3D,0x31,0x29,0xC0,
+0x05,0x31,0xC0,0x29,0x31,0x3D,0xC0,0x5A,0x29,0x3A,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0xAA,0x87,0xFE,
+0x53,0x04,0xFE,0x00,0x20,0xCC,0x14,0x05,0xC2,0xAB,0x55,0x36,0x18,0xC6,0x06,0x18,0xC8,0x8A,0x9E,0xFE,0x09,0x81,0x2E,0x99,0xAA,0x06,0x9C,0x99,0x17,0x28,0x37,0x28,
+0x10,0x28,0x10,0x96,0xBB,0x17,0x05,0xC3,0x22,0xFE,0x8A,0x21,0x31,0xA2,0x88,0xC0,0x6E,0x3D,0x05,0xC2,0x3D,0x05,0x3D,0x3A,0xC0,0x61,0x31,0x29,0x31,0x3A,0x5A,0x3A,
+0xC0,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0x37,0x33,0x3A,0xC0,0xAA,0x86,0xFE,0x00,0x60,0xBD,0x31,0x18,0xC6,
+0x25,0x18,0xC1,0x9D,0x9A,0x1A,0x25,0x50,0xC0,0x9D,0x8A,0x92,0xBD,0x96,0x9C,0x9C,0xBB,0x28,0x7F,0x28,0x37,0x06,0x24,0x9B,0x99,0x0F,0x24,0x99,0xBB,0x06,0x37,0x98,
+0xBB,0xC3,0x20,0xA9,0xF5,0x3A,0x05,0x0C,0x1A,0x18,0xC5,0x12,0x0A,0x25,0x6B,0xC0,0x0D,0xC0,0x1A,0x1F,0x18,0x12,0x0F,0x66,0x05,0xC4,0x2B,0x6B,0x19,0xA7,0x77,0x0A,
+0x05,0xC4,0xB7,0x94,0xFE,0x99,0x61,0x3D,0x05,0x13,0x7B,0x9F,0x66,0x0A,0x05,0xC5,0x17,0x14,0x05,0xC9,0xB4,0x42,0xFE,0x6E,0x27,0x18,0xC5,0x25,0x18,0xC7,0x3E,0x05,
+0xC8,0x10,0x1F,0x0E,0x1F,0x18,0xC6,0x8A,0x9E,0x0A,0x05,0xC7,0xAA,0x66,0x40,0x0A,0x05,0xC0,0x32,0xAD,0xF4,0x3D,0x31,0x5F,0xA1,0xA8,0xC0,0x9D,0x89,0x05,0xC3,0x3D,
+0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x29,0xA2,0x68,0x29,0x3A,0xC0,0x9D,0xA9,0x33,0x05,0x3A,0xC3,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,
+0x3D,0x13,0xA8,0x66,0x3C,0x92,0x8B,0xC7,0x14,0x05,0xC9,0xB8,0x21,0x0E,0x18,0xC4,0x25,0x50,0xC0,0x25,0x18,0x1F,0x18,0xC3,0x3B,0x05,0x0D,0x1F,0x18,0xC1,0x12,0xFE,
+0x00,0x60,0x05,0xC7,0x14,0x3F,0x05,0xC0,0x1D,0xA0,0xF3,0xFE,0xB1,0x81,0xC0,0x29,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x6E,0x3D,0x05,0x29,0x3A,0x06,
+0x9D,0xAA,0x06,0x97,0xCC,0x62,0xC4,0xA6,0x87,0x10,0x05,0x3C,0x28,0x3D,0x31,0xA2,0x88,0x46,0x05,0xC1,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x0A,0xC0,0x3D,0x05,
+0x29,0xC0,0x05,0x3A,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x18,0xCA,0x25,0x3B,0x0E,0x95,
+0x8A,0xFE,0x12,0x02,0x06,0x9D,0xAA,0x55,0x37,0x10,0x37,0x10,0xC0,0x37,0x06,0x0F,0x20,0x35,0x33,0x06,0x98,0xCB,0x9D,0x9A,0xC6,0x2A,0xA9,0x56,0x19,0xFE,0x23,0x41,
+0x36,0xFE,0x0A,0x00,0x36,0x18,0xC5,0x92,0x9E,0x3E,0xFE,0x00,0x40,0x10,0x3E,0x13,0x05,0xC9,0xAC,0x87,0xA9,0xF4,0xFE,0xB1,0x81,0x6E,0x3D,0x05,0x9D,0x89,0xC0,0x05,
+0xC1,0x3D,0x05,0x0A,0x05,0x0A,0x3D,0x05,0xC0,0x3D,0x0A,0x05,0xC0,0x29,0x05,0x31,0x29,0x31,0x05,0x3D,0x3A,0x29,0x3A,0xC0,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,
+0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0x0A,0xA8,0x77,0xFE,0x00,0x20,0xCA,0x2A,0xFE,0x55,0x63,0x15,0x39,0xAB,0x84,0x18,0xC2,0x25,0x99,0x99,0xFE,0x02,
+0x00,0x92,0xFF,0x05,0xC0,0x0C,0x95,0xBB,0x05,0xC8,0x14,0xB4,0x73,0x09,0x9E,0xB9,0x6E,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,
+0xC0,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x31,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0xA8,0x77,
+0xC0,0xFE,0x59,0xE7,0xA2,0x66,0x59,0x69,0x13,0xC2,0x36,0x9A,0x86,0x91,0x9F,0xCE,0x14,0x05,0xC3,0x2B,0x28,0xAF,0x40,0x1F,0x18,0x0E,0x18,0x06,0x9A,0x88,0x39,0xA7,
+0x86,0x12,0x0F,0x05,0xC0,0xAB,0x55,0x9D,0x99,0x05,0xCA,0xB2,0xE3,0x3D,0xA2,0x87,0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x0A,0x3A,0x05,0xFE,0x00,0x40,0x66,0xAF,0x54,0x0E,
+0x1A,0x98,0x88,0x1F,0x18,0xC0,0x0A,0x25,0x0D,0x25,0x35,0x10,0x59,0xA8,0x77,0xAB,0x64,0x97,0xAA,0xFE,0x00,0x40,0x05,0xC7,0x14,0x05,0xC0,0x00,0x09,0x3D,0xA2,0x87,
+0x3D,0x7E,0xC1,0x0A,0x05,0xC0,0x29,0x3A,0x75,0x29,0xA2,0x68,0x3A,0xFE,0x59,0xE7,0xA2,0x55,0x7B,0x13,0xC1,0x1D,0xC0,0x22,0x6B,0x8D,0x9C,0xD1,0xA8,0x55,0xB6,0x31,
+0x0D,0x18,0xC0,0x0D,0x2C,0x18,0xC4,0x2C,0x7B,0x0D,0x1A,0x36,0xFE,0x02,0x00,0x05,0xC9,0x14,0x05,0x22,0x14,0x05,0xC1,0xAF,0x33,0x0E,0x18,0xC3,0x25,0x18,0x1F,0x18,
+0xC1,0x25,0x15,0x9F,0xAC,0x36,0x18,0x39,0x19,0x05,0xCB,0x14,0xB1,0xE3,0x3D,0x31,0x56,0x3D,0x31,0x29,0xC0,0xA3,0x98,0x31,0xC0,0x3A,0x05,0xC0,0x0A,0x05,0x29,0xC0,
+0x3D,0x29,0x3A,0x05,0xC0,0x0A,0x3D,0x1D,0xA7,0x54,0x89,0xAF,0xCF,0x0C,0x36,0x18,0xC4,0x1A,0x98,0x88,0x18,0xC1,0x0D,0xFE,0x0A,0x00,0x05,0xC0,0xBF,0x20,0x1F,0x15,
+0x05,0x18,0xC6,0x0D,0x25,0x18,0xC0,0x0D,0x13,0x9B,0xAB,0xAD,0x65,0x36,0x0D,0x13,0x05,0xCA,0x14,0x05,0xC1,0x00,0x09,0x3D,0xA2,0x87,0xC0,0x3D,0x7E,0xC1,0x0A,0x05,
+0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x29,0x31,0x05,0x3D,0x29,0xC0,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,
+0xC0,0x0A,0x3A,0xC0,0xA5,0x78,0x18,0x0D,0x25,0x6B,0x18,0x0D,0x25,0x1A,0x18,0x25,0x06,0x95,0xDD,0xCE,0xB0,0x74,0xFE,0x8A,0x21,0x31,0x3A,0xA1,0xA8,0xC1,0x3D,0x05,
+0x0A,0x05,0x0A,0x05,0xC0,0x3D,0x3A,0x29,0x05,0xC0,0x0A,0x3D,0x33,0x9D,0x2B,0x75,0x5B,0xC1,0x0A,0xC0,0xAA,0x54,0x3C,0x92,0x8B,0xC6,0x6E,0x05,0x14,0x05,0xC0,0xAB,
+0x55,0x0C,0xA5,0x76,0xC0,0xA6,0x76,0xAA,0x63,0x18,0xC6,0x9D,0x9A,0x19,0x08,0x13,0xA1,0xAA,0x12,0x15,0x96,0x9C,0x05,0xFE,0x60,0xE1,0x79,0x0E,0xC2,0x0A,0xC0,0x1D,
+0x05,0xC5,0x6E,0x05,0xC2,0x2B,0xA6,0x56,0x0A,0x05,0xC1,0x2B,0x28,0x36,0x18,0xC4,0x3B,0xFE,0x00,0x60,0x17,0x05,0xC2,0xA8,0x55,0x17,0x0A,0x05,0xC8,0x14,0x05,0xC2,
+0x20,0xA9,0xF5,0xFE,0xB1,0x81,0x31,0xA3,0x88,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0xC0,0x3D,0x31,0x05,0xC0,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x31,0x3A,0xC3,0x5A,
+0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0xAA,0x86,0x7F,0x10,0xC2,0xFE,0x61,0xE7,0x5A,0x99,0xD6,0xC0,0x75,0xC0,0x0E,0xC3,
+0x00,0x8D,0x6A,0xCA,0xAB,0x55,0x99,0xAA,0x05,0xC4,0xAF,0x54,0xBB,0x41,0x18,0xC2,0x12,0x0F,0x05,0xC4,0x03,0x05,0x17,0x1D,0x9B,0xC7,0xC0,0x0E,0xC0,0x0A,0x0E,0x13,
+0x0E,0xC0,0x0A,0xAC,0x46,0x95,0x2A,0x05,0xC8,0xA8,0x55,0x10,0x05,0xC6,0x2E,0x3D,0x18,0xC0,0x95,0xAD,0xFE,0x01,0x00,0x05,0xC5,0xA5,0x88,0x0F,0x05,0x11,0x90,0xA5,
+0x2B,0x9D,0xA8,0x13,0xAA,0x05,0x05,0xC6,0x17,0x05,0x3F,0x9A,0x89,0x05,0xC7,0x0C,0xFE,0x76,0x09,0x9D,0x77,0xFE,0x0A,0x00,0x05,0x17,0x05,0xC4,0x3F,0x0A,0x05,0xCD,
+0xB0,0xA6,0x04,0xFE,0xB1,0x81,0x6E,0x29,0xA2,0x68,0x29,0x05,0xC0,0x0A,0x52,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x29,0x05,0x29,0x3A,0xFE,0xF7,0xDB,0xA1,0x9C,0x9B,
+0x87,0x94,0x97,0x93,0xA8,0x97,0x77,0x17,0xC0,0x9D,0x9A,0xC5,0x32,0xA3,0x66,0x99,0xBB,0x05,0xC8,0xFE,0x43,0xE6,0x9A,0x89,0xFE,0x08,0x20,0x05,0xC7,0xAB,0x44,0x05,
+0xC8,0x14,0x05,0xC1,0xAB,0x86,0xAE,0xA3,0xFE,0x99,0x61,0x9F,0xB8,0xC0,0x29,0x31,0xA2,0x88,0x6E,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x05,0x3D,
+0x31,0xFE,0x00,0x40,0x66,0xC9,0xB4,0x42,0x9B,0x57,0x0A,0x05,0xC7,0x2E,0x0A,0x05,0xCA,0xA5,0x87,0x0D,0x37,0x3D,0x31,0x29,0x31,0xA2,0x88,0x3D,0x05,0xC0,0x6E,0xC0,
+0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x29,0x31,0x29,0x31,0x05,0x3D,0x3A,0x29,0x3A,0xC2,0x37,0x79,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,
+0xC0,0x3A,0xAA,0x86,0x1F,0x10,0xC0,0x1F,0xC1,0x10,0xFE,0x00,0x20,0xC9,0xA6,0x87,0xFE,0x65,0xA7,0x12,0xFE,0x00,0x60,0x05,0xC6,0x32,0xA6,0x55,0x96,0xBB,0x05,0xCA,
+0xB5,0x84,0xFE,0x8A,0x21,0x31,0xA2,0x88,0xC0,0x29,0x05,0xC2,0x6E,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x29,0x37,0x29,0xA2,0x78,0xC0,0x9D,0xA9,
+0x33,0x05,0x3A,0xC5,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xAA,0x86,0xC4,0x1F,0x10,0x0E,0x6E,0x0E,0x13,0x75,0xFE,0xE7,0x5B,0xA5,0x9A,0xC3,
+0x8E,0x84,0xFE,0x18,0xE2,0x9A,0x89,0xC4,0xAA,0x33,0xC0,0x97,0xDD,0x05,0xC8,0x1D,0xFE,0x76,0x87,0x2C,0x37,0x05,0xC6,0xA8,0x55,0x32,0x37,0x05,0xC7,0x14,0x05,0xB0,
+0x94,0x35,0xFE,0xA1,0x61,0x0E,0xC1,0x79,0xC0,0x33,0x31,0xC3,0x33,0x36,0x05,0xC4,0xAB,0x55,0x96,0xBB,0x05,0xC8,0xAF,0x54,0x19,0x18,0xC0,0x8A,0x9E,0x0A,0x05,0xC4,
+0xAA,0x66,0x05,0xC0,0x10,0x97,0xBB,0x05,0xC7,0xB0,0xA6,0x04,0xFE,0x99,0x61,0xC0,0x71,0x3A,0x69,0xA1,0xA9,0xC0,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,
+0x0A,0x3D,0x0A,0x05,0xC0,0x29,0x05,0x3A,0x3D,0x33,0x76,0x3A,0xC1,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x0A,0xA9,
+0x88,0x55,0xC0,0x1F,0x10,0x1F,0xC0,0x0A,0x9A,0x2A,0x21,0xFE,0x18,0xE2,0x9A,0x89,0xC3,0xAB,0x55,0x96,0xBB,0x05,0xC8,0xFE,0x44,0xC5,0xAE,0x73,0x18,0xC0,0x97,0x9A,
+0xFE,0x01,0x00,0x05,0xC3,0x03,0x3A,0x9D,0x88,0x05,0x06,0x99,0xBB,0x17,0x05,0xC5,0xB0,0x95,0x35,0x37,0x31,0xC0,0x29,0xA2,0x78,0x29,0x31,0xA2,0x88,0x6E,0xC0,0x3D,
+0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,
+0x0A,0x3A,0xC2,0x31,0x0A,0xA9,0x88,0x55,0xC0,0x1F,0x10,0x1F,0xC0,0x98,0x68,0x0E,0xFE,0xDE,0xF8,0x36,0x8B,0x9D,0xC3,0xAB,0x55,0x96,0xBB,0x05,0xC7,0xAF,0x54,0xFE,
+0x76,0x09,0x18,0xC1,0x9D,0x9B,0xFE,0x22,0x84,0x0F,0x05,0xC1,0x32,0xA3,0x66,0x05,0xC2,0x10,0x05,0xC4,0x2B,0xAE,0x85,0xFE,0x8A,0x21,0x3A,0x29,0xA2,0x68,0x29,0xA3,
+0x98,0xC0,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x0A,0x3D,0x05,0x29,0xC0,0x05,0x3A,0xC4,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0xAA,0x86,0x1F,0xC0,0x10,0x1F,0xC1,0x10,0x96,0x4B,0x0E,0x79,0x0E,0x0A,0xC0,0x0E,0xC1,0x0A,0xC0,0x0E,0xC0,0x0A,
+0xAC,0x46,0x95,0x2A,0x99,0x9C,0xC2,0x03,0x05,0xC8,0x39,0xAE,0x73,0x18,0xC2,0x3B,0xFE,0x00,0x40,0x05,0x08,0xA8,0x45,0x06,0x05,0xC3,0x37,0x9C,0x99,0x05,0xC2,0x3C,
+0x28,0x0F,0xFE,0xA9,0x40,0xA2,0x88,0xC1,0x29,0xA2,0x68,0x3A,0x9C,0x39,0x0E,0x0A,0xC0,0x0E,0xC2,0x0A,0xC0,0x0E,0x0A,0x6F,0x00,0x8D,0x6A,0xC1,0x17,0x06,0x96,0xCC,
+0x05,0xC6,0xA8,0x55,0xFE,0x65,0xA7,0x18,0xC3,0x97,0x9A,0x19,0x05,0x37,0xA3,0x88,0x05,0xC4,0x37,0x10,0x96,0xBB,0x05,0xC0,0xB0,0x94,0xA4,0xD6,0x95,0xFA,0x3A,0xA2,
+0x97,0x3D,0x7E,0x3A,0x29,0x3D,0x3A,0xFE,0x31,0xA5,0x95,0x89,0x66,0xC0,0x37,0x14,0x05,0xC6,0xB8,0x21,0x18,0xC4,0x0D,0xFE,0x0A,0x00,0x10,0x37,0x0A,0x05,0xC5,0x15,
+0x2B,0x3C,0x28,0x3D,0x31,0x29,0x3D,0x7E,0xC0,0x3D,0x3A,0x29,0x3A,0xC0,0x29,0x3A,0xC0,0xA2,0x97,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,
+0x3A,0xC3,0x33,0x3A,0xC3,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0xA9,0x88,0x55,0xC0,0x1F,0x10,0x1F,0xC0,0x95,0x4B,0x16,
+0xA7,0x4B,0x9A,0x55,0x98,0x6B,0x6E,0xAA,0x44,0x05,0xC7,0x1C,0x18,0xC5,0xFE,0x23,0x41,0x0A,0x05,0xC7,0xA5,0x88,0xAF,0x83,0x0F,0x31,0x29,0xC0,0x37,0x29,0x3A,0xC0,
+0x24,0xA4,0x87,0x29,0xC1,0x3D,0x29,0x3A,0x05,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x31,0x05,0x3D,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x10,0x1F,0xC2,0x10,0x1F,0x92,0x3A,0x0E,0xFE,0x00,0x20,0xAB,0x55,0x05,0xC6,0xAA,0x66,
+0xFE,0x76,0x09,0x18,0xC5,0x8F,0xAD,0xFE,0x00,0x60,0x05,0xC8,0x2A,0x25,0x3A,0xC0,0x29,0x9E,0x29,0x0E,0xC0,0x0A,0xC1,0x0E,0xC2,0x0A,0xC0,0x0E,0x0A,0x0E,0xC1,0xA6,
+0x3A,0x98,0x46,0x10,0x96,0xBB,0x05,0xC5,0xB8,0x21,0xFE,0x76,0x87,0x18,0xC5,0x94,0x8B,0xFE,0x01,0x00,0x05,0xC8,0x15,0xFE,0x61,0x43,0x33,0x29,0x3D,0x29,0xC0,0x3D,
+0x31,0xA2,0x88,0xC0,0x6E,0x29,0xC0,0x3D,0x0A,0xC0,0x3A,0x05,0x3D,0x05,0x3D,0x05,0xC1,0x0A,0xC0,0x3D,0x05,0xC1,0x31,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,
+0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0xAA,0x86,0x7F,0xC4,0x25,0x0E,0x6E,0xC0,0x0E,0x79,0x0E,0x0A,0xC0,0x0E,0x0A,0x0E,0xC2,
+0x0A,0xC0,0x0E,0x0A,0x0E,0xA8,0x4A,0x2A,0x0F,0x62,0xC4,0x08,0x1C,0x18,0xC6,0x99,0x9B,0xFE,0x01,0x60,0x17,0x05,0xC8,0xAF,0x84,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x3D,
+0x31,0x29,0xC0,0x05,0x31,0xC0,0x5F,0x05,0x6E,0x3D,0x05,0xC1,0x31,0x3A,0xC0,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,0x3A,0x31,0x29,0x3A,0xC0,0x37,0x33,0x3A,0x33,
+0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0x31,0x10,0x1F,0xC0,0x10,0x1F,0xC1,0x92,0x3A,0x56,0x29,0x3A,0xC4,0x37,0x33,
+0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0xA2,0x98,0x3A,0x1F,0xC2,0x10,0x1F,0x9A,0x69,0xFE,0x00,0x20,0xC4,0xAF,0x54,
+0x18,0xC8,0xFE,0x23,0x03,0x05,0xCA,0xB0,0x74,0x37,0xC0,0xA1,0xB8,0x3A,0x05,0xFE,0x19,0x00,0xFE,0x7A,0x21,0x3A,0x29,0x7E,0x05,0x3D,0x3A,0x29,0x3A,0x9D,0xA9,0x29,
+0x24,0x29,0x24,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x3A,0x05,0x0A,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x3A,0xC1,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,
+0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0xC0,0xFE,0x00,0x40,0x66,0xC3,0xFE,0x3C,0x62,0xB1,0x75,0x18,0xC7,0x12,0x0F,0x05,0xCA,0xAF,0x84,0x37,0xC0,0x29,
+0xA2,0x78,0x33,0xC1,0x29,0xC0,0x24,0x29,0x24,0x3A,0xA1,0xA8,0xC0,0x6E,0x3A,0x29,0x3D,0x3A,0x29,0x24,0x29,0xC0,0x3D,0x29,0x05,0x3A,0xC0,0x29,0xC0,0x0A,0xC0,0x3D,
+0x05,0xC1,0x31,0x3A,0xC0,0x0A,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0x10,0x7F,0xC2,
+0x3A,0x9C,0x39,0xC1,0x0E,0x0A,0x0E,0xC5,0x0A,0xC0,0x0E,0x0A,0x0E,0xC1,0x2B,0xFE,0x19,0x61,0x96,0xAC,0xC2,0x03,0xFE,0x65,0xA7,0x18,0xC8,0x97,0x9A,0xFE,0x00,0xA0,
+0x05,0xCB,0xB1,0x93,0x33,0xA1,0xA9,0xC1,0x3A,0x29,0x3A,0xC0,0x29,0x3A,0xC0,0x24,0x29,0x24,0x3D,0x29,0x3D,0x31,0x05,0xC2,0x6E,0x3D,0x05,0x29,0xC0,0x05,0x3A,0xC6,
+0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0x10,0x1F,0xC0,0x10,0x1F,0xC0,0x95,0x4B,0x0E,0x2B,0x0E,0xC0,0x79,0xC1,0x0E,0xC3,
+0x0A,0xC0,0x0E,0x0A,0x0E,0xC4,0xFE,0x29,0x81,0x95,0x9D,0xC2,0x15,0x0D,0x18,0xC8,0x25,0xFE,0x09,0x81,0x96,0xCC,0x05,0xCA,0xAF,0x54,0xFE,0x8A,0x21,0x9C,0xFA,0xFE,
+0x09,0x21,0xB0,0xA6,0xFE,0xB1,0x81,0xC0,0x0A,0x05,0x3D,0x29,0xC0,0x3D,0x0A,0xC0,0x05,0x51,0x29,0x0E,0x2B,0x07,0x96,0xAC,0xC1,0xFE,0x3C,0x62,0xB1,0x75,0x18,0xC8,
+0x1A,0x8B,0x9D,0xFE,0x29,0x81,0x05,0xCB,0x3F,0x09,0x31,0x3A,0x61,0xBB,0x67,0x6E,0x9D,0x99,0x55,0x9D,0x99,0xC0,0x9D,0x99,0x55,0xC6,0x00,0xC0,0x19,0x28,0xC0,0x01,
+0x3C,0xC0,0x94,0x98,0xC3,0x5F,0xC0,0xA2,0x87,0x5A,0xC1,0x1D,0xC1,0x07,0x10,0xC0,0x1D,0x10,0xC1,0x1D,0x10,0x3C,0xC0,0x01,0xDF,0x56,0x01,0xCF,0x19,0xC0,0x01,0xD3,
+0x00,0x27,0x07,0x1D,0xC2,0x01,0x39,0x19,0x00,0x01,0xC0,0x69,0xC0,0x01,0x3A,0xC8,0x3C,0x01,0x28,0x19,0x28,0x01,0xCB,0x27,0x07,0x01,0xC1,0x60,0x19,0x9C,0xA6,0x9D,
+0xA9,0xC1,0x41,0x9D,0x89,0x9B,0x9A,0x55,0x51,0xC2,0x2B,0x3A,0xA3,0x86,0x3C,0x13,0xA7,0x67,0xA2,0x98,0xA3,0x68,0x01,0x00,0x39,0x01,0xC2,0x69,0x01,0x07,0x13,0x20,
+0x2B,0x17,0x9D,0x9A,0xCD,0x6B,0x17,0xA4,0x86,0xA9,0x88,0x29,0xA8,0x85,0xA1,0x6A,0x3A,0xC0,0x01,0x94,0xA5,0x96,0x8C,0x05,0xD7,0x2B,0x06,0x07,0x1E,0xA2,0x6A,0x05,
+0x17,0x05,0xC8,0x7F,0x05,0xC7,0x14,0x05,0xC8,0x14,0x05,0xC0,0xA7,0x87,0xAC,0x85,0x31,0x9E,0x9C,0x28,0x94,0xA9,0x10,0x91,0xC9,0x05,0xC9,0x14,0x05,0xC9,0x14,0x05,
+0xCA,0xA9,0x97,0x07,0x22,0x18,0x1D,0x9E,0xA5,0xA8,0x76,0x06,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC6,0x1A,0x1D,0xDD,0x1A,0x1D,0xC6,0x9D,0xB7,0x1D,0xC0,0xFE,0x51,0x42,
+0xA1,0xE8,0xA0,0xC7,0x69,0xFE,0x52,0xC6,0x1D,0xCD,0x1A,0x1D,0xC1,0xFE,0x71,0x00,0x33,0x3A,0xC0,0x12,0x56,0x1D,0xC6,0x9D,0xA9,0x1D,0xC1,0x1A,0x1D,0xC3,0x98,0xE9,
+0xFE,0x99,0x61,0x3A,0xC0,0x35,0x0A,0xC0,0x1D,0x10,0x1D,0x10,0x27,0x1A,0x1D,0xC3,0x07,0x1D,0xC4,0xFE,0x69,0x01,0x33,0x3A,0x9F,0x68,0x16,0x0A,0xC0,0xFE,0x19,0x00,
+0x05,0xC2,0x32,0x64,0x05,0xC7,0x14,0x05,0xCA,0xA2,0x77,0x05,0xC0,0x3C,0xA9,0x77,0x18,0x1D,0xC4,0x1A,0x1D,0xC1,0x9D,0xA9,0x9C,0x89,0xC0,0x3D,0xA4,0x88,0xC9,0x9D,
+0x88,0x3D,0x1D,0xC4,0x1A,0x1D,0xC7,0x9B,0xB9,0xFE,0x89,0x40,0x3A,0x33,0x16,0x0A,0xC0,0x5B,0xFE,0x9D,0x2D,0xB2,0x88,0x93,0xAA,0x8A,0x69,0x2B,0x05,0xC0,0x36,0xAC,
+0x74,0x91,0x9A,0x97,0x9C,0xCF,0x14,0x05,0xC4,0x08,0x06,0xA5,0x98,0x18,0x1D,0xC4,0x9D,0xA9,0x26,0x3D,0xB4,0x73,0xBE,0x87,0x6B,0x15,0x21,0x20,0x17,0xC0,0x1F,0xB0,
+0x86,0x0F,0x17,0x05,0xC8,0x14,0x05,0xCB,0x29,0xA4,0x74,0x18,0x1A,0x18,0xC0,0x3D,0x20,0x10,0xA1,0xB9,0xC0,0x0F,0x17,0xA6,0x98,0xFE,0xCE,0xB3,0x15,0x21,0x83,0x9B,
+0x05,0xCD,0x14,0x05,0xC6,0x0F,0x9B,0x99,0x1D,0x3D,0x10,0x02,0x25,0xD1,0x3D,0x10,0x1D,0xC5,0x1A,0xC0,0x1D,0xC0,0x07,0x1D,0xC1,0x3C,0x25,0xC6,0x02,0xC0,0x3D,0x25,
+0xC9,0x3D,0x10,0x07,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0xC0,0x1D,0xC4,0x1E,0x37,0xFE,0xD6,0xF5,0x0B,0x7A,0x04,0x0B,0xC0,0x04,0x8C,0x8B,0x20,0xFE,0xC6,0x97,0x0B,0xFE,
+0x5B,0x6C,0x01,0x3C,0x01,0xC1,0x28,0x01,0xC4,0x3C,0x01,0xC2,0x06,0x05,0xC8,0x14,0x05,0xC1,0xFE,0xBE,0x54,0x0E,0xC1,0x04,0x6B,0x0E,0x0B,0x8E,0x99,0x96,0x87,0x04,
+0x0B,0xC0,0x9A,0x99,0x85,0x77,0x17,0x05,0xC9,0x14,0x05,0xC8,0xB5,0x84,0x22,0x25,0xC1,0x3D,0x9C,0x88,0xC0,0x26,0x15,0xC0,0x26,0x15,0x26,0x25,0xC7,0x07,0x10,0xC0,
+0x1D,0xCA,0x0E,0x0B,0x9D,0x98,0x2D,0x11,0x9C,0x99,0x21,0xA9,0x89,0x21,0xA8,0x75,0x21,0x04,0x0B,0x9A,0x99,0x3C,0x17,0x05,0xD3,0xA9,0x85,0x0F,0x25,0xC0,0x9A,0x77,
+0x15,0xC0,0x26,0x15,0xC1,0x26,0x15,0xC0,0x25,0xC6,0x02,0xC0,0x1D,0xC4,0x1A,0x1D,0xC6,0x98,0xC9,0x9E,0xF6,0x0A,0xC3,0x35,0xFE,0x5B,0x6C,0x28,0xA2,0x78,0x01,0x3C,
+0x01,0x60,0x17,0x9D,0x9A,0xC9,0x14,0x05,0xC0,0xFE,0x94,0xCD,0x19,0x33,0x8D,0x87,0xC0,0xA9,0x88,0x6B,0x9D,0x89,0x9A,0x97,0xC0,0x36,0x3D,0x0B,0xC1,0x33,0x06,0x90,
+0x9C,0xCB,0x14,0x05,0xC4,0x08,0x5E,0x36,0x22,0x15,0xC0,0x26,0x15,0xC2,0x26,0x15,0xC1,0x25,0xC6,0x02,0x10,0x07,0x62,0x9B,0xF6,0x9F,0xB9,0x79,0x0B,0x2B,0x21,0xB0,
+0x87,0x0B,0x8F,0xA8,0xFE,0x29,0x83,0x05,0x6E,0x05,0xC7,0x14,0x05,0xC7,0xB3,0x84,0x20,0x15,0xC0,0x26,0x15,0xC4,0x25,0xC7,0x07,0x18,0x1D,0xCB,0x07,0x61,0x13,0x0E,
+0xC1,0x79,0xC1,0x7E,0x0A,0xC0,0x0E,0xFE,0x52,0xE3,0x02,0x06,0x17,0x05,0xC7,0x14,0x05,0xC3,0x20,0xFE,0xE7,0x79,0xA4,0x9C,0xC1,0x98,0x85,0x8A,0x76,0x33,0x0B,0xC2,
+0x34,0xA8,0x99,0x2D,0x11,0xAF,0x9A,0x83,0x66,0x93,0x55,0x06,0x16,0x05,0xC7,0x14,0x05,0xC8,0xB5,0x84,0x20,0x15,0xC0,0xA2,0x78,0x15,0xC0,0x3D,0x25,0xC9,0x3D,0x1D,
+0xC7,0x1A,0x1D,0xC3,0x0D,0x0A,0x5B,0x0A,0x6F,0x0E,0x0A,0x0E,0x0A,0xC0,0x12,0x02,0xC0,0x07,0x02,0xC0,0x3D,0xC3,0x10,0x02,0x7C,0x3D,0xC0,0x10,0x02,0x3D,0x29,0x94,
+0x88,0x05,0xCB,0x14,0x05,0xC0,0xA6,0x87,0xFE,0xAD,0x8E,0xA2,0x9D,0x21,0x8B,0x78,0xA1,0x46,0x25,0xAC,0x75,0x21,0xB2,0x78,0x0B,0x04,0x34,0x2B,0x96,0x79,0x37,0x21,
+0xC0,0x2A,0xA4,0x87,0x0C,0xFE,0x3A,0x03,0x91,0x9D,0xD1,0xA9,0x97,0xAE,0x63,0x15,0xC0,0x02,0x25,0xCB,0x9C,0x88,0x1D,0xC6,0x1A,0x1D,0xC4,0x98,0xC9,0x9E,0xF6,0xA0,
+0xA7,0x0E,0xA3,0xC6,0xFE,0x49,0xA6,0xC0,0x36,0x05,0xC8,0x14,0x05,0xC5,0xFE,0xBD,0xD1,0x0B,0xC0,0x2B,0x19,0x0B,0x7A,0x0B,0xC2,0x34,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,
+0x1F,0x05,0xD1,0xA6,0x87,0xB2,0x74,0x02,0xA3,0x99,0xCC,0x02,0xC0,0x1D,0xC7,0x1A,0x1D,0xC1,0x9D,0xA9,0x1D,0x0D,0xFE,0x99,0x61,0xC0,0x79,0xC0,0xFE,0x10,0xA0,0x05,
+0xD0,0x3A,0x0F,0x25,0xCD,0x3D,0x18,0xC2,0x1D,0xC8,0x07,0x1D,0x0A,0x33,0xFE,0x41,0x44,0x6B,0xC3,0x06,0xC1,0x7A,0xC0,0x06,0xC0,0x09,0xC0,0xA2,0x88,0x06,0x1D,0x09,
+0x06,0x09,0xC1,0x9F,0x46,0x05,0x6E,0x05,0xC8,0x14,0x05,0xC3,0xFE,0xAD,0x8E,0x0B,0x04,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0x2B,0xC0,0x0B,0x0E,0xC3,0x93,0x79,0x16,0x15,
+0x05,0xD0,0xA5,0x87,0x0F,0x3C,0x25,0xCB,0x9C,0x88,0xA5,0x67,0xC8,0x1A,0x1D,0xC2,0x1A,0x1D,0x35,0x33,0xFE,0x31,0xA5,0xC0,0x02,0x3D,0x02,0x3D,0xC7,0x1D,0xC4,0x1A,
+0x1D,0xC6,0x1A,0x36,0xFE,0x89,0x40,0xA1,0xB9,0x37,0x33,0xC0,0x3A,0x33,0xC3,0x62,0x02,0x1D,0xC4,0x10,0xC1,0x1D,0x10,0x27,0x1D,0xC4,0x1A,0x1D,0xC8,0x26,0x37,0xC0,
+0x29,0x3A,0x33,0x3A,0x33,0xC3,0x29,0x06,0x3C,0x05,0xCB,0x14,0x05,0xC3,0xFE,0xAD,0x8E,0xB3,0x8B,0x0E,0x0B,0xC5,0x9D,0x98,0x99,0x87,0x2B,0x0B,0xC3,0xFE,0x5B,0x4A,
+0x05,0xC0,0x16,0x08,0x05,0xC7,0x14,0x05,0xC5,0xB3,0x84,0xA4,0x75,0x1D,0xC7,0x1A,0x1D,0xCC,0x1A,0x1D,0xC4,0x1E,0x37,0x3A,0x0E,0x0B,0xC0,0x88,0x9B,0x05,0xC1,0x3F,
+0x51,0x05,0xCA,0x14,0x05,0xC2,0xB7,0x74,0x00,0x91,0xA9,0xFE,0xBE,0x31,0x0B,0xC0,0x61,0x0B,0xC1,0x3A,0x33,0x2B,0x7F,0xA9,0x88,0x29,0x0B,0x61,0x9C,0x89,0xFE,0x42,
+0x28,0x0A,0xC0,0x05,0xC0,0x32,0xA4,0x85,0x97,0x9C,0xC7,0x14,0x05,0xC3,0x2B,0x39,0x99,0x9B,0x0B,0x95,0x8B,0xAB,0x97,0x0C,0x20,0x16,0x25,0x2D,0x0B,0xC1,0x86,0x87,
+0x33,0xB4,0x73,0x12,0x0B,0x3A,0x0B,0x0C,0xFE,0x52,0xC6,0x17,0x05,0xC4,0x16,0x05,0xCC,0xAF,0x84,0x07,0x95,0xAD,0x18,0x33,0x3F,0x05,0xC7,0x3F,0x05,0xCA,0x14,0x36,
+0x0F,0x3C,0x3D,0xC0,0x10,0x02,0x3D,0xD0,0xA2,0x77,0x9B,0xDA,0x3C,0x9D,0x58,0xA4,0x54,0x9C,0xAB,0x9D,0xAA,0x06,0xAC,0xB8,0xB6,0xA7,0x26,0x2D,0xC1,0xAF,0x43,0x8F,
+0x9A,0x05,0xCC,0x14,0x05,0xC2,0xA6,0x87,0x3C,0x9C,0x69,0xFE,0x65,0xA7,0xA4,0x76,0xC1,0xA2,0x87,0x0D,0x9A,0xBD,0x3E,0x3A,0x05,0xC9,0x14,0x05,0xCA,0x16,0x39,0x95,
+0xAF,0xA3,0x68,0x3D,0xCD,0x26,0x9E,0xB6,0xA0,0xC7,0xA2,0xA7,0xA1,0xB9,0x5A,0x79,0x7B,0x3A,0x37,0x3A,0x37,0x71,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x37,
+0x33,0x3A,0x33,0xC2,0x3A,0xC0,0x26,0x2D,0x26,0x2D,0xAC,0x43,0x05,0xCC,0x14,0x05,0xC3,0xAA,0x78,0x9F,0x95,0x2B,0xFE,0x65,0xA7,0xA7,0x74,0xC2,0x9D,0x9A,0x1A,0x9A,
+0x89,0xFE,0x09,0x81,0x95,0xDD,0xC0,0xA6,0x87,0xA9,0x34,0x06,0x7B,0x9C,0x88,0x05,0xC7,0x14,0x05,0xC5,0xB3,0x84,0x9C,0x8B,0x3C,0x9E,0x8B,0xC1,0xA3,0x68,0x75,0x3D,
+0xC3,0x69,0x9D,0xC9,0x1E,0x9D,0xC9,0xC0,0xA3,0xC6,0x33,0x37,0x29,0xA2,0x78,0x33,0xC0,0x3A,0x75,0x3A,0x37,0x29,0x3A,0xC0,0x37,0x33,0xC3,0x3A,0xC0,0x33,0x3A,0xC0,
+0x37,0x33,0x3A,0x33,0xC2,0x3A,0xC0,0x26,0xC1,0xA7,0x66,0x22,0x05,0xC8,0x14,0x05,0xC5,0xA4,0x66,0x28,0x3C,0x19,0x05,0xFE,0x5C,0xE8,0x18,0xC2,0x8F,0xAD,0x1C,0x1A,
+0x8C,0xAD,0x06,0xB4,0x64,0xAD,0x52,0x59,0xFE,0x22,0x84,0x95,0xBB,0x24,0x17,0x0A,0x05,0xCC,0xAC,0x87,0xA7,0x86,0x3D,0xA4,0x67,0x02,0x3D,0xC0,0x36,0x3D,0xC0,0x9D,
+0xA8,0x1E,0x0E,0x35,0x25,0xA1,0xA9,0x3A,0x37,0x71,0xC0,0xFE,0x01,0x60,0xA1,0xAA,0xB4,0x53,0x1A,0x51,0xA3,0x87,0xC0,0x92,0x9E,0xFE,0x6B,0xAB,0xFE,0x76,0x09,0x9D,
+0x77,0x9E,0x86,0xA9,0x88,0x18,0xC0,0x99,0x9B,0x37,0x17,0x10,0x97,0xBB,0x62,0xCB,0x14,0xB2,0x74,0x36,0xA3,0x69,0x02,0x3D,0x20,0x1E,0x9E,0xC8,0x2D,0xC2,0x13,0xC0,
+0x69,0x13,0xC1,0xA7,0x87,0x92,0x79,0x97,0x9C,0xCA,0x14,0x05,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC1,0x9D,0x9B,0xFE,0x23,0x03,0xFE,0x00,0x40,0xC0,0xAA,0x55,0xBB,0x30,
+0x1A,0x18,0xC0,0x0D,0xFE,0x4C,0x07,0x36,0x1F,0x97,0x99,0x1F,0x18,0xC1,0x3B,0x17,0x32,0x64,0x05,0xC8,0x14,0x05,0xC0,0xA9,0x97,0xAE,0x63,0x2D,0xA0,0xC6,0x9E,0xB6,
+0x35,0xA0,0xB7,0xC0,0x71,0xA4,0x87,0x52,0x7E,0x51,0x05,0x3A,0x3D,0x31,0x3D,0x05,0xC0,0x3D,0x31,0x05,0x0A,0xFE,0x52,0x26,0x22,0x9D,0xAC,0x1D,0xC1,0x13,0xC2,0xA8,
+0x66,0x8D,0x9C,0x9B,0x9A,0x17,0x05,0xC5,0x14,0x05,0xC2,0x1C,0x18,0xC3,0x99,0x9C,0xFE,0x0A,0x00,0x17,0x05,0xBF,0x20,0xFE,0x55,0x63,0xA9,0x88,0x18,0xC0,0x0D,0xC0,
+0x1F,0x0A,0x9B,0x9D,0x1F,0x18,0xC0,0x25,0xFE,0x01,0x60,0x05,0xA7,0x78,0x9D,0x87,0x05,0xC8,0x14,0x05,0xB0,0x95,0xFE,0x89,0x40,0x3A,0xC0,0x29,0x33,0x3A,0xC0,0xA1,
+0xA8,0xC0,0x3D,0x05,0x3D,0x31,0x29,0x05,0xC2,0x3D,0x05,0x3D,0x05,0xC0,0x18,0x0D,0x18,0x39,0x10,0xFE,0x55,0x25,0x18,0xC1,0xFE,0x1A,0xC1,0xFE,0x00,0x40,0x66,0x10,
+0x05,0xC9,0x14,0x1D,0xFE,0x99,0x61,0xC0,0x29,0x3A,0x33,0x3D,0x1A,0x06,0x18,0xFE,0x23,0x41,0x05,0xAF,0x53,0x36,0x18,0xC0,0x3B,0x0A,0x05,0x32,0xA3,0x66,0x08,0x05,
+0xC8,0xB3,0xB7,0xFE,0xA1,0xC1,0x31,0x29,0x31,0x3A,0x3D,0xFE,0x52,0xC6,0x9A,0x86,0x05,0xCC,0xA6,0x87,0xFE,0x65,0xA7,0x18,0xC5,0x99,0x9B,0x37,0x0A,0x39,0x18,0xC1,
+0x25,0xC0,0x50,0xFE,0x01,0x60,0x05,0xC0,0xAF,0x54,0x36,0x18,0x39,0xFE,0x00,0x40,0x05,0xC0,0x10,0x19,0x05,0xC8,0xB5,0x84,0x17,0x3D,0x13,0xC0,0x1D,0xC0,0x13,0xC3,
+0x22,0x68,0x05,0xC7,0x7F,0x05,0xC4,0x32,0x0E,0x18,0xC6,0x0E,0xFE,0x22,0x84,0x1A,0x06,0x18,0xC7,0x06,0x8D,0x9D,0x05,0xA8,0x55,0x10,0x0A,0x10,0x24,0x9C,0x99,0x10,
+0xC0,0x19,0x05,0xC7,0xAF,0x84,0x13,0xC0,0x22,0x13,0xC0,0x1D,0xC1,0xA3,0x67,0x36,0x96,0x8A,0x05,0xC8,0x14,0x05,0xC3,0xA2,0x77,0xBD,0x31,0x1F,0x18,0xC5,0x0D,0xFE,
+0x2B,0x24,0x1F,0x18,0xC9,0x0E,0x05,0xC0,0x10,0x37,0x06,0x37,0xC1,0x55,0x10,0x0A,0x05,0xC6,0xA9,0x85,0xFE,0xA1,0x61,0xA1,0xA8,0x3D,0x3A,0x61,0xA2,0x68,0x29,0x3A,
+0xC0,0x9D,0xA9,0x33,0x05,0x3A,0xC1,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xA2,0x97,0xA9,0x88,0xC0,
+0x28,0xB7,0x53,0x1A,0x18,0xC5,0x97,0x9A,0x1A,0x51,0x18,0xC7,0x0E,0x28,0x99,0xCC,0xA8,0x55,0x05,0xC1,0x2B,0x10,0x28,0x37,0xA7,0x77,0x37,0x05,0xC5,0xA6,0x87,0xAC,
+0xE4,0x3D,0x65,0xA2,0x88,0xC1,0x3D,0xC1,0x05,0xC1,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x29,0xA2,0x78,0xFE,0x19,0x63,0xFE,0x65,0xA7,0x18,0xC6,0x06,0x18,0xC8,0x8A,
+0x9E,0xFE,0x09,0x81,0x2E,0x37,0x06,0x9C,0x99,0x17,0x9D,0x9A,0x37,0x28,0x10,0x28,0x10,0x96,0xBB,0x17,0x05,0xC3,0x22,0xFE,0x8A,0x21,0x31,0xA2,0x88,0xC0,0x6E,0x3D,
+0x05,0xC2,0x3D,0x05,0x3D,0x3A,0x33,0x62,0x31,0x29,0x31,0x3A,0x5A,0x06,0x28,0x7F,0x28,0x06,0x10,0xA4,0x66,0x9B,0x99,0x98,0xCC,0x24,0x99,0xBB,0x06,0x37,0x98,0xBB,
+0xC3,0x20,0xA9,0xF5,0x3A,0xA1,0xA8,0x33,0xFE,0x00,0x20,0xC5,0x32,0xC0,0x19,0x10,0x96,0xBB,0x05,0xC4,0xB7,0x94,0xFE,0x99,0x61,0x3D,0x31,0xA2,0x88,0x18,0xC5,0x25,
+0x18,0xC7,0x9D,0x9A,0xFE,0x01,0x60,0x96,0xDD,0xC8,0x3F,0x05,0xC4,0xB0,0xA6,0xA0,0xF3,0x31,0xA2,0x88,0xC1,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x29,0x05,0x6E,
+0x05,0xC0,0x33,0x20,0xA7,0xF6,0x33,0x3A,0x18,0xFE,0x2B,0x24,0x0E,0x18,0xC4,0x25,0x50,0xC0,0x25,0x18,0x6B,0x18,0xC3,0x3B,0xFE,0x00,0x20,0xC9,0x15,0x05,0xC1,0x00,
+0xFE,0x99,0x61,0xC0,0x29,0x3A,0x33,0xC0,0x3D,0xA2,0x87,0x66,0xC1,0x3D,0x05,0x3D,0x05,0xC1,0x29,0x36,0x59,0xC0,0x18,0xC2,0x06,0x18,0xC2,0x25,0x50,0x18,0xC3,0x8F,
+0xAD,0xFE,0x00,0x60,0x62,0xC7,0x14,0x3F,0x05,0xC0,0x1D,0xA0,0xF3,0x29,0xA3,0x98,0x29,0x05,0xC0,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x6E,0x3D,0x05,0x29,0xFE,
+0x45,0x03,0x2C,0x18,0xC0,0x12,0xFE,0x09,0x81,0x9D,0xAA,0x98,0xBB,0xA2,0x77,0x05,0xC4,0xA7,0x55,0x10,0x05,0x3C,0xA4,0xE6,0x3D,0x31,0xA2,0x88,0x29,0x05,0x0A,0x05,
+0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,0x0A,0xC0,0x3D,0x05,0xC0,0x29,0x05,0x3A,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,
+0xC0,0x33,0xC0,0x0A,0x3A,0xC1,0x29,0x32,0xA2,0x55,0x7F,0x10,0x37,0x10,0xC0,0x37,0x06,0x0F,0x20,0xA9,0xF5,0x33,0x05,0xC0,0x29,0x05,0x3A,0x3D,0x0A,0x3D,0x05,0x29,
+0xC0,0x05,0x3A,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0x3D,0x3A,0x20,0x95,0x9B,0xCE,0x14,0x05,0xC1,0xBF,0x20,0xFE,0x55,0x63,0x3B,0x0E,0xA8,0x76,0x97,0x89,0x18,0xC8,0x12,
+0x10,0x06,0x0C,0x06,0x05,0xC9,0xB5,0x84,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x3D,0x3A,0x29,0x39,0x3E,0xFE,0x00,0x40,0x10,0xA9,0x32,0x9B,0xBB,0xFE,0x00,0x20,0xC9,0xAC,
+0x87,0xA9,0xF4,0xFE,0xB1,0x81,0x6E,0x3D,0x05,0x29,0xC0,0x0A,0x13,0x92,0xEF,0x66,0xC0,0x0C,0x95,0xBB,0x05,0xC8,0x14,0xB4,0x73,0x09,0x9E,0xB9,0x6E,0x3D,0x05,0xC1,
+0x0A,0x0F,0x08,0x5A,0x10,0x37,0x17,0x05,0xC9,0xB2,0xE3,0x3D,0x0A,0x3D,0x7E,0xC1,0x0A,0x05,0x28,0x09,0x3D,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,0x3A,0x31,0x29,
+0xA2,0x68,0x33,0x22,0x37,0xC0,0x29,0x3A,0x33,0x05,0xC0,0x0A,0x3D,0x05,0x3D,0x29,0x05,0x3A,0x0A,0xC0,0x36,0xA1,0x85,0x17,0x9D,0x9A,0xCB,0x14,0x05,0xC1,0x24,0x0E,
+0x18,0xC3,0x25,0x18,0xC2,0x1F,0x25,0x8D,0xBE,0x9E,0x9B,0xB5,0x62,0x18,0x39,0xFE,0x00,0xA0,0x05,0xCB,0x14,0x28,0x3D,0x31,0x3D,0xFE,0x4A,0x25,0xA7,0x65,0x05,0xCF,
+0x0C,0x36,0x18,0xC4,0x1A,0x98,0x88,0x18,0xC1,0x0D,0xFE,0x0A,0x00,0x05,0xC0,0xFE,0x43,0xE6,0x1F,0x15,0x05,0xC8,0x14,0x05,0xC2,0x20,0xA9,0xF5,0x37,0xA1,0xB8,0xFE,
+0x00,0x20,0xCD,0xB5,0x20,0xB7,0x41,0x18,0xC5,0x1F,0x29,0xFE,0x33,0x25,0x36,0x18,0xC4,0x3B,0x0F,0x05,0xC3,0xA8,0x55,0x17,0x05,0x6E,0x10,0x19,0x05,0xC4,0xAF,0x54,
+0xBB,0x41,0x18,0xC2,0x12,0x0F,0x05,0xC4,0x03,0x05,0x37,0xA2,0x66,0x05,0xC6,0x2E,0x36,0xA8,0x64,0x18,0x0E,0xFE,0x01,0x00,0x05,0xC5,0xA5,0x88,0x17,0xFE,0x68,0xE0,
+0xC0,0x11,0x90,0xA5,0x8F,0xFD,0x9D,0xA8,0x6E,0xAA,0x05,0x17,0x05,0xC7,0xAF,0x33,0x92,0xDD,0x05,0xC7,0xB4,0x42,0xBB,0x30,0x18,0xFE,0x0A,0x00,0x05,0xA3,0x87,0x05,
+0xC4,0x3F,0x0A,0x05,0xCD,0xB3,0x84,0x35,0x92,0xCB,0xAC,0x46,0xFE,0xF7,0xDB,0xA1,0x9C,0x9B,0x87,0x94,0x97,0x93,0xA8,0x97,0x77,0x17,0xC0,0x05,0xC5,0xA8,0x55,0xC0,
+0x99,0xBB,0x05,0xC8,0x1D,0x9A,0x89,0xFE,0x08,0x20,0x05,0xC7,0x06,0x05,0xC8,0x14,0x05,0xC1,0x20,0x35,0xFE,0x99,0x61,0x0E,0x6E,0x0E,0xC0,0x7E,0xFE,0xEF,0xBB,0x31,
+0xC2,0x95,0x76,0xFE,0x29,0x43,0x97,0x8A,0xC6,0x10,0x0F,0x05,0xC9,0xB4,0x42,0x9B,0x57,0x05,0x0E,0xC0,0x79,0xC0,0x0E,0x33,0x31,0xC2,0x54,0xFE,0x6B,0xAA,0x05,0xC6,
+0xAB,0x55,0x05,0xC9,0xA6,0x87,0xFE,0x65,0xA7,0x12,0x0F,0x05,0xC6,0xA7,0x85,0x10,0x96,0xBB,0x05,0xCA,0xB5,0x84,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0xA2,0x88,0xC0,0x29,
+0x05,0xC2,0x6E,0x52,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x29,0x9E,0x29,0xC0,0x33,0xA5,0x9A,0xC3,0x8E,0x84,0xFE,0x19,0x00,0x99,0x9C,0xC4,0xAA,0x33,0xC0,
+0x97,0xDD,0x05,0xC8,0x1D,0x1F,0x2C,0x06,0x29,0xC0,0xA3,0x98,0x46,0x3D,0x59,0x76,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,
+0xC0,0x3A,0xC0,0xA2,0x97,0xA9,0x88,0x55,0xC0,0x1F,0x10,0x1F,0xC0,0x0A,0x9B,0x2B,0x18,0xC1,0x97,0x9A,0xFE,0x01,0x00,0x99,0xCC,0xC3,0x03,0x28,0xFE,0x6E,0x26,0x3B,
+0xFE,0x00,0x40,0x05,0x08,0xA8,0x45,0xA3,0x88,0x05,0xC3,0x37,0x9C,0x99,0x05,0xC2,0x3C,0x0D,0x0E,0xC0,0x79,0xC0,0x0E,0xC2,0x0A,0xC0,0x0E,0xA1,0xA7,0x16,0x00,0x05,
+0xC1,0xA3,0x87,0xA8,0x45,0x96,0xCC,0x05,0xC6,0x37,0xFE,0x65,0xA7,0x18,0xC3,0x97,0x9A,0x19,0x05,0x37,0x10,0x05,0xC4,0x37,0x10,0x05,0xC0,0x17,0xAD,0xA6,0x35,0xFE,
+0x99,0x61,0x3A,0xA2,0x97,0x3D,0x7E,0x3A,0x29,0xC0,0x3A,0xC2,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x3D,0x0A,0x05,0xC0,0x3A,0xC1,0x37,0x33,0x3A,0x33,
+0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0xAA,0x86,0x1F,0xC1,0x10,0x1F,0xC0,0x09,0x0E,0xC1,0x79,0xC1,0x0E,0xC0,
+0x0A,0xC0,0x0E,0x0A,0x0E,0xC0,0x0A,0xFE,0x31,0xA5,0x95,0x89,0x66,0xC0,0xA8,0x55,0x05,0xC7,0xB8,0x21,0x18,0xC4,0x9D,0x9B,0xFE,0x0A,0x00,0x9C,0xBC,0x37,0x0A,0x05,
+0xC5,0xAA,0x66,0x9B,0xA9,0x3C,0xA4,0xE6,0x3A,0x31,0x29,0x3D,0x7E,0xC0,0x3D,0x3A,0x29,0x3A,0xC0,0x29,0xC0,0x3A,0xA2,0x97,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,
+0x0A,0x3D,0x0A,0x05,0xC0,0x3A,0xC3,0x33,0x3A,0xC3,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x1F,0x55,0xC0,0x1F,0x10,0x1F,
+0xC0,0x94,0x59,0x0E,0x17,0x1C,0x18,0xC5,0xFE,0x23,0x41,0xFE,0x00,0x40,0x66,0xC7,0xA8,0x55,0xAC,0xA5,0x0F,0x31,0x29,0xC0,0xA2,0x68,0x29,0x3A,0xC0,0x9D,0xA9,0xA4,
+0x87,0x29,0xC1,0x3D,0x29,0x3A,0x05,0x6E,0xC0,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x29,0x9E,0x29,0x0E,0xA3,0x79,0x9D,0x19,0x9A,0x89,0xAB,0x55,0x05,0xC6,
+0x10,0xFE,0x76,0x09,0x18,0xC5,0x8F,0xAD,0xFE,0x00,0x60,0x05,0xC8,0x2A,0x25,0xA1,0xB9,0xC0,0x29,0x33,0x3A,0x29,0x37,0x29,0x3A,0xC0,0x24,0x33,0x0E,0xC0,0x16,0xA7,
+0x4B,0x97,0x37,0x10,0x96,0xBB,0x05,0xC5,0x32,0xFE,0x76,0x87,0x18,0xC5,0x94,0x8B,0xFE,0x01,0x00,0x05,0xC8,0xAA,0x66,0xFE,0x61,0x43,0x33,0x29,0x3D,0x29,0xC0,0x3D,
+0x29,0x3D,0x7E,0x6E,0x29,0xC0,0x9E,0x29,0x0E,0x0A,0x0E,0x20,0x2A,0x0F,0x62,0xC4,0x08,0xFE,0x54,0xE7,0x18,0xC6,0x99,0x9B,0xFE,0x01,0x60,0x17,0x05,0xC8,0xAF,0x84,
+0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x5F,0x29,0x03,0xFE,0x7A,0x64,0x3D,0x31,0xFE,0x00,0x20,0xB0,0x74,0x37,0xC0,0x05,0xA7,0x85,0xFE,
+0x7A,0x21,0x33,0x05,0x14,0xAE,0x73,0x37,0x29,0xC0,0x7E,0x29,0x3D,0x5A,0x29,0x24,0x29,0x3A,0xFE,0x09,0x21,0xAB,0x66,0x05,0xC7,0x14,0x05,0xC1,0x37,0xB0,0xA6,0xFE,
+0xB1,0x81,0xC0,0x6E,0x05,0x3D,0x29,0xC0,0x05,0x9B,0x2A,0xA3,0x2B,0x99,0x48,0x62,0xC0,0x1C,0x1F,0x18,0xC9,0xFE,0x3B,0xE5,0x2B,0x05,0xB0,0x57,0xC1,0xA2,0x87,0x5A,
+0xC0,0x1D,0x1A,0xA6,0x98,0x99,0x99,0x61,0x10,0xAB,0x98,0x10,0xC1,0x1D,0x10,0x1D,0xA7,0x99,0x19,0x9D,0x99,0xC0,0x9D,0x99,0x07,0x1D,0x00,0x19,0x28,0xA3,0x88,0xCC,
+0x28,0xC0,0x00,0x27,0x18,0x27,0x00,0x19,0x28,0xA2,0x78,0x3C,0x01,0x28,0x19,0x00,0xC0,0x27,0x07,0x1D,0x00,0x19,0xC0,0x28,0x01,0xC0,0x69,0x01,0x3A,0xC0,0x01,0xA1,
+0x85,0x3A,0x31,0x3A,0xC5,0x3C,0x01,0x28,0x19,0x28,0x01,0xCA,0x60,0xC0,0x9A,0x97,0x9D,0xA9,0xC1,0x41,0x9D,0x89,0x9B,0x9A,0x55,0x51,0xC2,0x2B,0x3A,0xA3,0x86,0x3C,
+0x13,0xA7,0x67,0xA2,0x98,0x31,0x01,0x00,0x39,0x01,0x66,0x01,0xC6,0x3C,0x01,0x07,0x13,0x9B,0x77,0x2B,0x9B,0x9A,0xCE,0x6B,0x17,0xA4,0x86,0xA9,0x88,0x29,0xA8,0x85,
+0xA1,0x6A,0x9F,0x9B,0xC0,0x3C,0x94,0xA6,0x2B,0xA4,0x98,0x99,0x79,0x05,0xC8,0x7F,0x05,0xC7,0x14,0x05,0xC8,0x14,0x05,0xC0,0xA7,0x87,0xAC,0x85,0xA8,0x88,0x0F,0x06,
+0x00,0x05,0xCA,0x14,0x05,0xCD,0x14,0x05,0xC9,0xA9,0x85,0x07,0x29,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC7,0x1A,0x1D,0xDE,0x1A,0x1D,0xC2,0xFE,0x51,0x42,0xA1,0xE8,0xA0,
+0xC7,0xC0,0xFE,0x53,0x04,0x1A,0xFE,0x60,0xE1,0x13,0x9F,0x59,0x91,0xBB,0xC7,0x14,0x05,0xC0,0xA6,0x87,0x05,0xCD,0x14,0x05,0xCE,0x3C,0xAA,0x76,0x18,0xC2,0x1D,0xCA,
+0x9B,0xBA,0x41,0xC1,0x3D,0x10,0x71,0xC1,0x3D,0x26,0x10,0x1D,0x10,0x1D,0x10,0x27,0x1A,0x1D,0xC3,0x9D,0xA9,0x1D,0xC4,0xFE,0x69,0x01,0xA3,0xE6,0x6B,0x9F,0x68,0x16,
+0x65,0x0E,0x20,0x05,0xC7,0x14,0x05,0x2B,0xB8,0x74,0x9C,0x99,0x8E,0x89,0x05,0xC2,0x2B,0x65,0x05,0xC7,0x14,0x05,0xCD,0xAE,0x85,0xA9,0x77,0x18,0x1D,0xC4,0x1A,0x1D,
+0xC1,0x9D,0xA9,0x26,0xC0,0x3D,0xA4,0x88,0xC9,0x02,0x3D,0x1D,0xC4,0x1A,0x1D,0xC7,0x9B,0xB9,0xFE,0x89,0x40,0x3A,0xC0,0x16,0x0A,0xC1,0x1D,0xC5,0x07,0x26,0x3D,0xC0,
+0xA4,0x88,0xCC,0x3D,0x1D,0x2B,0x05,0xC8,0x14,0x05,0xFE,0x7C,0x2B,0xBE,0x87,0x6B,0x9C,0x86,0x8E,0x88,0x20,0x17,0xC0,0x1F,0xB0,0x86,0x0F,0x17,0x05,0xC8,0x14,0x05,
+0xCB,0x29,0x32,0x18,0x1A,0x18,0xC0,0x3D,0xC0,0x17,0xC0,0x05,0x0C,0x14,0x05,0xC6,0xB5,0x84,0xFE,0xF7,0xB9,0x0B,0x7A,0x0B,0x93,0x89,0x1E,0x17,0xA6,0x98,0xFE,0xCE,
+0xB3,0x15,0x21,0x20,0x05,0xCD,0x14,0x05,0xC6,0x0F,0x22,0x1D,0x3D,0x10,0x25,0xC0,0x92,0x77,0x05,0xCA,0x3C,0xFE,0xE7,0x38,0xA6,0x77,0x0E,0x04,0x0B,0x9D,0x98,0x87,
+0x99,0x83,0x8C,0xB7,0x99,0x0B,0x3A,0x31,0x13,0x05,0xCA,0x14,0x05,0xC8,0xA6,0x87,0xB2,0x74,0x94,0x9C,0x25,0xC2,0x14,0xFE,0xBE,0x54,0x0E,0xC1,0x04,0x6B,0xC1,0x8F,
+0xA8,0x95,0x89,0x04,0x0B,0xC0,0x19,0x85,0x77,0x17,0x05,0xC9,0x14,0x05,0xC8,0xB5,0x84,0x51,0x25,0xC1,0x3D,0x9C,0x88,0xC0,0x26,0x15,0xC0,0x26,0x15,0x26,0x25,0xC7,
+0x07,0x10,0xC0,0x1D,0xCB,0x9B,0xB9,0xFE,0x61,0x01,0xA0,0xA7,0x0A,0xC3,0xA4,0xC7,0xFE,0xD6,0xF5,0x90,0x9C,0x19,0x33,0x29,0xC0,0xA9,0x88,0x6B,0x9D,0x89,0x00,0x9F,
+0xA6,0xA2,0x87,0xFE,0xD6,0xD7,0x0B,0xC1,0x8C,0x8A,0x06,0x90,0x9C,0xCB,0x14,0x05,0xC5,0xAC,0x87,0x6B,0xC1,0x10,0x02,0x25,0x29,0x05,0xC8,0x14,0x05,0xC2,0xB7,0x74,
+0xAD,0x97,0xAD,0x8A,0x19,0xA4,0x87,0x0E,0x5A,0xC0,0x3A,0x19,0xC0,0x0B,0xC1,0x93,0x89,0x8B,0x9A,0xB0,0x97,0x89,0x88,0x8B,0x9D,0xD2,0x14,0x3F,0x36,0x15,0xC0,0x26,
+0x15,0xC3,0x26,0x15,0x26,0x25,0xC6,0x40,0x18,0xC2,0x1D,0xC9,0xFE,0xF7,0xFB,0x0E,0x5A,0xC0,0x0E,0x0B,0xC0,0x9D,0x98,0x21,0x3A,0x0B,0x8F,0xA8,0x20,0x05,0x6E,0x05,
+0xC7,0x14,0x05,0xC7,0xB3,0x84,0x20,0x15,0xC0,0x26,0x15,0xC4,0x25,0xC7,0x07,0x18,0x1D,0xCC,0x9B,0xB9,0x13,0x66,0xC1,0x79,0xC1,0x7E,0x0A,0x0E,0xFE,0xFF,0xFA,0x5B,
+0x0B,0xC1,0x0E,0x0B,0x34,0x0E,0x0B,0x93,0x89,0x88,0x8A,0xA7,0xA8,0x87,0x88,0x05,0xCA,0x14,0x05,0xC5,0x06,0x22,0x15,0xC0,0x26,0x15,0xC3,0x3D,0x25,0xC7,0x36,0x10,
+0x1D,0xC0,0x1A,0x1D,0xC8,0x1A,0x98,0xF9,0x13,0x0A,0xC0,0x5B,0x0A,0xC3,0x0E,0xFE,0xFF,0xFA,0x3A,0x97,0x7B,0x11,0xAF,0x9A,0x83,0x66,0x93,0x55,0xA0,0xEB,0x9A,0x9B,
+0x05,0xC7,0x14,0x05,0xC8,0xB5,0x84,0x20,0x15,0xC0,0xA2,0x78,0x15,0xC0,0x3D,0x25,0xC9,0x3D,0x1D,0xC7,0x1A,0x1D,0xC2,0x9D,0xB7,0x99,0xF9,0x0A,0x5B,0x0A,0x6F,0x0E,
+0x0A,0x0E,0xC0,0x1D,0x9F,0xC9,0x31,0x05,0xCB,0x14,0x05,0xC0,0xA6,0x87,0xFE,0xAD,0x8E,0xA2,0x9D,0x54,0x8B,0x78,0xA1,0x46,0x25,0xAC,0x75,0x21,0x12,0x69,0x04,0x34,
+0x2B,0x96,0x79,0xC0,0x21,0xC0,0x2B,0xA3,0x99,0x98,0x8A,0xFE,0x3A,0x03,0x91,0x9D,0xD1,0xA9,0x97,0xAE,0x63,0x15,0xC0,0x02,0x25,0xCB,0x9C,0x88,0xA2,0x77,0x1D,0xC5,
+0x1A,0x1D,0xC4,0x20,0x04,0x2B,0x19,0xA6,0x77,0x0E,0x0B,0xC2,0x34,0x0E,0x0B,0xC3,0xFE,0x4A,0x25,0x05,0xCC,0x14,0x05,0xC1,0x21,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,
+0x34,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0xC0,0x2B,0x36,0x8F,0x9B,0x05,0xD0,0xA6,0x87,0x0F,0x25,0xCD,0x3D,0x18,0xC2,0x1D,0xC9,0x07,0x1F,0x17,0x05,0xC8,0x14,0x05,0xC4,
+0xFE,0xAD,0x8E,0x0B,0xC7,0x0E,0x0B,0x34,0x0B,0x0E,0x0B,0xC2,0xFE,0x73,0xAD,0x89,0x88,0x20,0x05,0xC9,0x14,0x05,0xC4,0x3A,0x0F,0x94,0x9C,0x95,0x89,0x20,0x05,0xCA,
+0x14,0x05,0xC3,0x26,0x0F,0x25,0x02,0x1D,0xC4,0x10,0xC0,0x07,0xFE,0xF7,0xB9,0x0B,0xC1,0x0E,0x0B,0xC2,0x9D,0x98,0x19,0x3A,0x0B,0xC2,0x88,0x9B,0x05,0xC1,0x3F,0x51,
+0x05,0xCA,0x14,0x05,0xC2,0xB7,0x74,0x3C,0x9E,0x8B,0x1D,0xC0,0x10,0x1D,0x1A,0x1D,0xC9,0x1A,0x1D,0xC9,0x10,0x13,0x95,0x7B,0x11,0x0B,0xC1,0x2D,0xFE,0x18,0xE2,0x05,
+0xC1,0x3A,0xA3,0x86,0x97,0x9C,0xC7,0x14,0x05,0xC4,0x3C,0xA9,0x74,0x26,0xC0,0x15,0x26,0x36,0xC0,0x3D,0x3A,0xFE,0xBE,0x54,0xAD,0x98,0xC0,0x61,0x0B,0xC1,0x3A,0x33,
+0x2B,0x7F,0xA9,0x88,0x29,0x0B,0x61,0x19,0x13,0x0A,0xC0,0x05,0xC0,0xA5,0x88,0x3F,0xAE,0x85,0xFE,0xD6,0xD7,0x0B,0xC3,0x30,0x1D,0x33,0x3D,0x0B,0x2D,0x12,0x19,0x36,
+0x05,0xC3,0x32,0xA4,0x97,0x97,0x9A,0x05,0xC7,0x14,0x05,0xC2,0x36,0x22,0x3C,0x9E,0x8B,0x10,0x02,0x3D,0xCB,0x10,0x02,0x3D,0xC0,0x26,0xC0,0x15,0xA4,0x87,0x3D,0xC0,
+0xA2,0x77,0x10,0xC0,0x1D,0xC0,0x9A,0xA5,0x25,0x2D,0x0B,0xC0,0x04,0x00,0x33,0xB4,0x73,0xA4,0x8B,0x0B,0x3A,0x0B,0x0C,0xFE,0x52,0xC6,0x17,0x05,0xC4,0x16,0x05,0xCC,
+0xAF,0x84,0xA8,0x78,0x3D,0x18,0x02,0x3D,0xCD,0x02,0x3D,0xC9,0x26,0xC0,0x16,0xFE,0xA1,0x60,0xFE,0x11,0x82,0xA4,0x54,0x9C,0xAB,0x55,0xC0,0x07,0xB6,0xA7,0x0E,0x0B,
+0x97,0x9A,0x87,0x89,0x84,0x9B,0xC9,0x32,0x05,0xC7,0x14,0x05,0xC0,0xB3,0x84,0x6B,0x99,0x9C,0xA3,0x68,0x02,0x3D,0xCE,0x69,0x9D,0xC9,0xA0,0xA6,0x9D,0xC9,0x35,0x74,
+0xA1,0xB9,0x5A,0x33,0xC0,0x3A,0xC0,0x37,0x3A,0xC0,0x33,0xC2,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0xC0,0xFE,0x11,0x82,0xFE,0x65,0xA7,0xA4,0x76,0xC1,0xA2,0x87,
+0x0D,0x9A,0xBD,0x3E,0x8A,0x9B,0x05,0xC9,0x14,0x05,0xCA,0x16,0x39,0x95,0xAF,0xA3,0x68,0x3D,0xCD,0x26,0xA0,0xC7,0x9E,0xB6,0x25,0xA1,0xB9,0xC0,0x33,0x7B,0x3A,0x37,
+0x3A,0x37,0x71,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0xFE,0x10,0xC1,0x36,0xA7,0x74,0xC2,0x9D,0x9A,0x1A,0x9A,0x89,0xFE,
+0x09,0x81,0x05,0xC0,0xA6,0x87,0xA9,0x34,0x06,0x7B,0x99,0xAA,0x05,0xC7,0x14,0x05,0xC5,0x22,0x3C,0xC0,0x9E,0x8B,0xC1,0xA3,0x68,0x3D,0xC4,0x69,0x26,0x1E,0x0E,0xC0,
+0xA3,0xC6,0x33,0x6B,0x29,0xC0,0x33,0xC0,0xA1,0xA9,0x51,0x3A,0x37,0x29,0x3A,0xC0,0x37,0x33,0xC3,0x3A,0xC0,0x33,0x3A,0xC0,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0xFE,
+0x65,0xA7,0xFE,0x22,0x84,0x95,0xBB,0x24,0x91,0xEE,0xC0,0x26,0xC1,0x6B,0xC1,0x22,0x9D,0xAA,0xA5,0x77,0x3C,0x05,0xC7,0x14,0x05,0xC3,0x06,0xAE,0x41,0xAC,0x66,0xA3,
+0x97,0x95,0x8A,0x06,0x55,0xA1,0xAA,0xB4,0x53,0x1A,0x51,0x18,0xC0,0x39,0xFE,0x6B,0xAB,0xFE,0x76,0x09,0x9D,0x77,0x9E,0x86,0xA9,0x88,0x18,0xC0,0x99,0x9B,0x37,0x17,
+0x10,0x97,0xBB,0x62,0xCB,0x14,0xB2,0x74,0x99,0x9B,0xA3,0x69,0x02,0x3D,0x9D,0xA8,0x1E,0x9E,0xC8,0x35,0xA0,0xB7,0x3A,0x7A,0x7E,0x31,0x56,0xC0,0x3D,0x2D,0xC1,0x13,
+0x69,0x13,0xC1,0xA7,0x87,0x92,0x79,0x97,0x9C,0xCA,0x14,0x05,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC1,0x9D,0x9B,0xFE,0x23,0x03,0xFE,0x00,0x40,0xC0,0xAA,0x55,0xBB,0x30,
+0x1A,0x18,0xC0,0x06,0xFE,0x4C,0x07,0x36,0x18,0x97,0x9A,0x1F,0x18,0xC1,0x8B,0xBF,0x17,0x32,0x64,0x05,0xC8,0x14,0x05,0xC0,0xA9,0x97,0xAE,0x63,0x2D,0xA0,0xC6,0x9E,
+0xB6,0x35,0x37,0xC0,0x29,0xA4,0x87,0x3D,0x7E,0x51,0x05,0x3A,0x3D,0x31,0x05,0xFE,0x00,0x40,0x66,0xC7,0x14,0x05,0x13,0xFE,0x89,0x40,0x3A,0x3D,0x05,0xB4,0x42,0x0D,
+0x9C,0x89,0x0D,0x18,0xC0,0x0D,0x05,0xA5,0x87,0x36,0x18,0x0D,0x2C,0x06,0x18,0xFE,0x52,0xC6,0x3C,0x05,0xCC,0xA3,0x87,0xFE,0x65,0xA7,0x18,0xC5,0x99,0x9B,0xFE,0x01,
+0x60,0x05,0xFE,0x44,0xC5,0x18,0xC1,0x25,0xC0,0xFE,0x5B,0x27,0x91,0x9A,0x97,0x9C,0xCD,0xFE,0x54,0xE7,0x1A,0x18,0xC5,0x3B,0x0A,0xBD,0x20,0xFE,0x76,0x87,0x18,0xC1,
+0x06,0x22,0xA2,0x88,0x05,0x0A,0x05,0xCC,0xBF,0x20,0x1F,0x18,0xC4,0x06,0x9A,0x88,0x37,0xAE,0x76,0x1F,0x18,0xC3,0x0D,0x3B,0x24,0x93,0xDD,0x05,0x24,0xAF,0x64,0xFE,
+0x00,0xA0,0x05,0xC1,0x10,0x96,0xBB,0x05,0xC8,0xAB,0x86,0xA9,0xF5,0xFE,0x99,0x61,0x3A,0x29,0xFE,0x52,0x26,0x36,0x05,0xCE,0xB8,0x10,0x1F,0x18,0xC5,0x0D,0xFE,0x0A,
+0x00,0xA5,0xBA,0x0D,0x18,0xC5,0x99,0x9C,0x3B,0x10,0x0A,0x2B,0x10,0x05,0xC1,0x2B,0x10,0x05,0xC9,0x3F,0x36,0x37,0x31,0xFE,0x09,0x81,0x9C,0x99,0x05,0xC8,0xA5,0x88,
+0x36,0x9E,0x86,0x05,0xC7,0x7F,0x05,0xC4,0x32,0x0E,0x18,0xC6,0x0E,0xFE,0x22,0x84,0x1A,0x51,0x18,0xC7,0x06,0x8D,0x9D,0x05,0xA8,0x55,0x10,0x0A,0xAA,0x44,0x24,0x06,
+0x10,0xC0,0x19,0x05,0xC7,0xB0,0x74,0xFE,0x8A,0x21,0x31,0x36,0x20,0x05,0xC8,0x14,0x05,0xC3,0xA2,0x77,0xBD,0x31,0x1F,0x18,0xC5,0x99,0x9C,0xFE,0x2B,0x24,0x1F,0x18,
+0xC9,0x0E,0xFE,0x08,0x80,0x05,0x10,0x37,0xA3,0x77,0x37,0xC1,0x55,0x10,0x0A,0x05,0xC6,0xA9,0x85,0x35,0x3D,0x1F,0x3D,0x1F,0x18,0xC0,0x8F,0xAD,0x0F,0x62,0xC5,0x19,
+0x32,0x19,0x06,0x0A,0x05,0xC4,0xB7,0x94,0xFE,0x99,0x61,0x3D,0x31,0xA2,0x88,0x18,0xC0,0x9D,0x9A,0xFE,0x01,0x60,0x96,0xDD,0xC8,0x3F,0x05,0xC3,0x0F,0x1D,0xA0,0xF3,
+0x31,0xA2,0x88,0xC0,0x3D,0x06,0xFE,0x1A,0xC1,0xFE,0x00,0x20,0xC8,0x10,0x19,0x05,0xC2,0x20,0xA7,0xF6,0x33,0x3A,0x61,0x31,0xA2,0x88,0x3D,0x05,0xC0,0x6E,0x3D,0x05,
+0xC1,0x0A,0x05,0xC1,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x31,0x3A,0xC0,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,
+0x3A,0xFE,0x29,0x81,0x96,0x8C,0xAE,0x54,0xFE,0x65,0xA7,0x2C,0xC0,0x18,0xC2,0x06,0x18,0xC2,0x25,0x50,0x18,0xC3,0x8F,0xAD,0xFE,0x00,0x60,0x62,0xC7,0x14,0xAA,0x33,
+0x05,0xC0,0x1D,0xA0,0xF3,0xFE,0xB1,0x81,0xFE,0x09,0x21,0x10,0x95,0xCC,0x3C,0x28,0x3D,0x65,0xA2,0x88,0x29,0x05,0x6E,0x05,0x3D,0x05,0x3D,0x05,0xC1,0x3D,0x05,0xC0,
+0x0A,0xC0,0x3D,0x05,0xC0,0x29,0x05,0x3A,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x3A,0xC2,0xFE,0x4A,
+0x25,0x22,0x98,0x88,0x95,0x9D,0xC9,0x14,0x05,0xC5,0x20,0xFE,0x76,0x09,0x2C,0xA4,0x87,0x25,0x50,0x18,0xCA,0x25,0x3B,0x0E,0x95,0x8A,0x24,0x06,0x32,0xA2,0x55,0x7F,
+0x10,0x37,0x10,0xC0,0x37,0x06,0x97,0xCC,0x20,0x35,0xFE,0xA1,0x00,0x32,0x36,0x25,0x2C,0xC0,0x99,0x98,0x1A,0x18,0xC8,0x05,0xBF,0x20,0x0A,0x3B,0x0E,0x0D,0x97,0x89,
+0x18,0xC7,0x0D,0x3E,0xFE,0x00,0x40,0x10,0x3E,0x9A,0x9A,0x05,0xC9,0xAC,0x87,0xA9,0xF4,0xFE,0xB1,0x81,0x6E,0x3D,0x05,0x9D,0x89,0xC0,0x0A,0x05,0xC0,0x3D,0x05,0x0A,
+0x05,0x0A,0x3D,0x05,0xC0,0x3D,0x0A,0x05,0xC0,0x29,0x05,0x31,0x29,0x31,0x05,0x3D,0x3A,0x29,0x3A,0xC0,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,
+0xC0,0x33,0xC0,0x3A,0xC1,0x0A,0xA8,0x77,0xFE,0x00,0x20,0xC1,0x0C,0x95,0xBB,0x05,0xC8,0x14,0xB4,0x73,0xFE,0xA1,0xC1,0x9E,0xB9,0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,
+0x0A,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x0A,0x05,0xC0,0x3D,0x05,0x3D,0x3A,0xC0,0x29,0x31,0x3A,0xC1,0x5A,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,
+0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x0A,0x10,0x7F,0xFE,0x00,0x20,0x3D,0xFE,0x4A,0xA4,0x05,0xD1,0xA8,0x55,0xB6,0x31,0x0D,0x18,0xC0,0x0D,0x25,0x18,0xC4,0x99,0x9C,0x7B,
+0x0D,0x69,0x36,0xFE,0x02,0x00,0x05,0xC9,0x14,0x05,0x22,0xFE,0x99,0x61,0xC0,0x29,0x3A,0x33,0xA1,0xA9,0xC0,0x0A,0x3D,0x05,0x29,0xFE,0x1A,0x03,0x0E,0xAB,0x75,0x18,
+0xC2,0x25,0x18,0x06,0x0A,0xFE,0x00,0x40,0xFE,0x68,0xE0,0x5B,0x0A,0xA3,0x6A,0xC0,0xAE,0x15,0x92,0x79,0x97,0x9C,0xC8,0x14,0x05,0xC1,0x0C,0x36,0x1F,0x18,0xC7,0x9D,
+0x9B,0x25,0x2C,0x18,0x0D,0x25,0x1A,0x18,0x25,0xFE,0x09,0x81,0x05,0xCE,0xB0,0x74,0xFE,0x8A,0x21,0x31,0xA3,0x88,0xFE,0x23,0x03,0x13,0xA4,0x63,0xFE,0x00,0x40,0x05,
+0xA8,0x55,0x17,0x05,0xC9,0x14,0x05,0xC2,0xAB,0x86,0xA9,0xF5,0xFE,0xB1,0x81,0x31,0xA3,0x88,0x3D,0x05,0xC1,0x0A,0x05,0xC1,0xFE,0x00,0xA0,0x0E,0x79,0x11,0x8F,0xD5,
+0x2B,0x0E,0x6E,0xAA,0x05,0x91,0x7D,0x62,0xC7,0xAF,0x33,0x92,0xDD,0x05,0xC7,0xB4,0x42,0x0D,0x18,0xFE,0x0A,0x00,0x05,0xA3,0x87,0x05,0xC4,0x3F,0x0A,0x05,0xCD,0xB0,
+0x95,0x04,0x91,0xCB,0xAC,0x46,0xFE,0xF7,0xDD,0xA1,0x9A,0x9B,0x87,0x94,0x97,0x93,0xA8,0x97,0x77,0x17,0xC0,0x05,0xC5,0xA8,0x55,0xC0,0x99,0xBB,0x05,0xC8,0xFE,0x43,
+0xE6,0x9A,0x89,0x08,0x05,0xC7,0xAB,0x44,0x05,0xC8,0x14,0x05,0xC1,0x20,0xAE,0xA3,0xFE,0x99,0x61,0x05,0x29,0xFE,0x18,0xE2,0x05,0xC4,0xAA,0x64,0xA0,0x57,0x0A,0x05,
+0xC8,0x1D,0x1F,0x2C,0x06,0x05,0xC6,0xA8,0x55,0x32,0x37,0x05,0xC7,0x14,0x05,0xB0,0xA6,0x0A,0x32,0xA2,0x55,0x17,0x05,0x06,0x19,0x05,0x33,0xC1,0x9D,0x97,0xFE,0x52,
+0xC6,0x8D,0x8C,0x05,0xC2,0xAB,0x55,0x0A,0x05,0xC7,0xB3,0x33,0xFE,0x6E,0x27,0x18,0xC1,0x0D,0x0C,0x0F,0x05,0xC0,0x0A,0x32,0x37,0x05,0xC2,0x06,0x05,0xC4,0xA5,0x87,
+0xFE,0x68,0xE0,0x5F,0x0E,0x0A,0xAC,0x46,0x95,0x2A,0x05,0xC2,0xA7,0x78,0x05,0xC8,0x39,0x1F,0x18,0xC1,0x9D,0x9A,0x3B,0xFE,0x00,0x40,0x05,0x08,0x37,0x10,0x05,0xC3,
+0x37,0x19,0x05,0xC2,0x3C,0x28,0x94,0xCA,0x0E,0xC0,0xA1,0xA7,0x5B,0xAC,0x19,0x05,0xC1,0x17,0xA8,0x45,0x96,0xCC,0x05,0xC6,0x37,0xFE,0x65,0xA7,0x18,0xC3,0x97,0x9A,
+0x19,0x05,0x37,0x10,0x05,0xC4,0x37,0x10,0x96,0xBB,0x05,0x17,0xAD,0xA6,0x35,0xFE,0x99,0x61,0x9C,0x49,0x0E,0x0A,0x0E,0xC0,0x0A,0xFE,0x31,0xA5,0x05,0xC1,0xA8,0x55,
+0x05,0xC7,0xB8,0x21,0x18,0xC4,0x0D,0xFE,0x0A,0x00,0x06,0x37,0x99,0xBB,0x05,0xC5,0xAA,0x66,0x2B,0x3C,0x28,0xFE,0xA1,0x61,0x75,0x29,0x0E,0xA8,0x4A,0x9A,0x55,0x05,
+0x0A,0xAA,0x44,0x05,0xC6,0x17,0x0E,0xC0,0xA3,0x79,0x9B,0x18,0x05,0x10,0x05,0xC6,0x15,0xFE,0x68,0xE0,0xA8,0x2B,0x1F,0x10,0x96,0xBB,0x05,0xC5,0x32,0xFE,0x76,0x87,
+0x18,0xC5,0x94,0x8B,0xFE,0x01,0x00,0x05,0xC8,0x15,0x2B,0xFE,0xA1,0x60,0x29,0x3D,0x29,0xC0,0x3D,0xC0,0x7E,0xFE,0x5C,0xE8,0x18,0xC6,0x25,0xFE,0x01,0x60,0x17,0x9D,
+0x9A,0xC8,0xAF,0x84,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x5F,0xC0,0xA2,0x97,0x3D,0x05,0xC1,0x31,0x3A,0xC0,0x0A,0x3D,0x05,0xC1,0x0A,
+0x05,0xC0,0x3D,0xFE,0x18,0xE2,0xAC,0xE4,0x3D,0x31,0x29,0x3D,0x05,0x3D,0x31,0x29,0xA2,0x78,0x29,0x05,0xFE,0x00,0x20,0xB0,0x74,0x37,0xC0,0x3A,0xC0,0xA1,0xA8,0x3D,
+0x05,0x29,0xC2,0x17,0x9D,0x9A,0xC9,0xA7,0x85,0xFE,0x7A,0x21,0x33,0x29,0x7E,0xA2,0x88,0x3D,0x3A,0x29,0x3A,0x9D,0xA9,0x29,0x24,0x29,0x24,0x3D,0x31,0x29,0xC0,0x05,
+0x31,0xC0,0x3A,0x05,0x0A,0x3D,0x31,0x29,0xC0,0x05,0x31,0xC0,0x3A,0xC1,0x37,0x33,0x3A,0x33,0xC2,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,0xC0,0x3A,0xC0,0x33,
+0xC0,0x0A,0x05,0xFE,0x00,0x20,0xC4,0x39,0x1F,0x18,0xC7,0x8F,0xAD,0x0F,0x05,0xCA,0xAF,0x84,0x37,0xC0,0x7A,0x05,0xFE,0x55,0x25,0x18,0xC8,0x35,0x19,0x05,0xCA,0x3F,
+0x09,0x31,0xA2,0x88,0xFE,0x09,0x21,0xFE,0x65,0xA7,0x18,0xC8,0x97,0x9A,0xFE,0x01,0x00,0x99,0xCC,0xCB,0xB1,0x93,0x3D,0x7E,0x13,0xFE,0x60,0xE1,0xBC,0x56,0xC0,0x99,
+0x99,0xA6,0x88,0x01,0xC0,0x00,0x3C,0xC0,0x01,0xFD,0xC1,0x00,0x3C,0xC0,0x01,0xE9,0x9D,0x99,0x55,0x00,0xC0,0x9D,0x99,0x9D,0x98,0xC7,0x27,0x00,0xC0,0x19,0x00,0x28,
+0x01,0xC0,0x19,0x3C,0x01,0x3C,0x01,0x3C,0x01,0xE1,0x28,0x19,0x27,0x07,0x62,0x07,0xC1,0x27,0x59,0xCB,0x52,0xC1,0x01,0xFB,0x19,0x3C,0x01,0xE3,0x00,0x27,0x07,0x3D,
+0x10,0xC0,0x1D,0xC1,0x10,0xA2,0x77,0xC1,0x1D,0xC2,0x1A,0xC0,0x1D,0xC1,0x1A,0xC0,0x1D,0xC0,0x1A,0xC0,0x01,0x00,0x3C,0xC0,0x01,0xDF,0x19,0x27,0x07,0x3D,0x10,0x1D,
+0xC2,0x1A,0x1D,0xC0,0x1A,0x1D,0xC2,0x1A,0x1D,0xC1,0x1A,0x1D,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xC0,0x1A,0x01,0xDC,0x00,0x3C,0xC0,0x01,0xDD,0x00,0x07,0xC1,0x27,0x1D,
+0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC2,0x1A,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC1,0x1A,0x01,0xDC,0x00,0x3C,0xC0,0x01,0xDA,0x19,0x27,0x07,0xC1,
+0x27,0x1D,0x1A,0x1D,0xC2,0x1A,0x1D,0xC3,0x1A,0x1D,0x1A,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0x1A,0x01,0xDB,0x19,0x00,0x3C,0xC0,0x01,0xD8,0x00,0x27,0x07,
+0xC1,0x27,0x1D,0x1A,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC4,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xC2,0x1A,0x01,0xFA,0x19,0x00,0x01,0xD7,0x19,0x00,
+0x07,0xC1,0x27,0x1D,0x1A,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC1,0x19,0x3C,0x01,0xF8,
+0x00,0x3C,0xC0,0x01,0xD5,0x00,0x3D,0x07,0x1D,0xC2,0x1A,0x1D,0xC4,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC3,0x1A,0x19,0x27,
+0x07,0x27,0x00,0xC1,0x19,0x3C,0xC0,0x01,0xF0,0x00,0x3C,0xC0,0x01,0xD3,0x00,0x3D,0x10,0xC0,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC4,0x1A,0x1D,0x1A,0x1D,
+0xC3,0x1A,0x1D,0xC5,0x1A,0x1D,0x1A,0x1D,0xC1,0x01,0xC2,0x19,0xC0,0x00,0xC0,0x27,0x07,0x27,0x00,0xC0,0x28,0x01,0x3C,0x01,0xEA,0x19,0xC0,0x01,0xD2,0x00,0x07,0xC1,
+0x27,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC6,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC6,0x01,0xC9,0x19,0xC0,0x00,0x27,0x07,0x00,0xC0,0x19,0x3C,
+0xC1,0x01,0xE4,0x00,0x3C,0xC0,0x01,0xCF,0x00,0x07,0xC1,0x27,0x1D,0x1A,0x1D,0xC4,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC8,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC5,
+0x01,0xCF,0x28,0x19,0x27,0xC0,0x07,0x00,0x19,0x3C,0x01,0xC0,0x3C,0x01,0xDD,0x19,0x00,0x01,0xCF,0x19,0x27,0x07,0x27,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,
+0xC9,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCA,0x1A,0x1D,0x1A,0x01,0xD4,0x28,0x19,0x00,0x27,0x07,0x27,0x00,0xC0,0x19,0x3C,0xC1,0x01,0xD7,0x00,0xA6,0x78,0x01,0xCE,
+0x27,0x07,0x3D,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCB,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCC,0x1A,0x01,0xDB,0x19,0x00,0xC0,0x27,0x07,0x00,0xC1,0x19,
+0x3C,0xC1,0x6D,0xC1,0x6C,0xC1,0x3A,0xC0,0x31,0xA0,0xA9,0x3A,0xC0,0x31,0x3E,0x3C,0xC1,0x01,0x00,0x3C,0xC0,0x01,0xCB,0x19,0x27,0x07,0x27,0x1D,0xC1,0x1A,0x1D,0x1A,
+0x1D,0xC3,0x1A,0x1D,0xCD,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCB,0x01,0xC7,0x60,0x9C,0x96,0x9B,0xAA,0x49,0x13,0x06,0x9B,0x9A,0x50,0x9D,0x9B,0x55,0x51,0xC3,0xA4,
+0x88,0x20,0x06,0x13,0xA8,0x66,0xA3,0x98,0x3E,0x47,0xC0,0x00,0x3C,0xC0,0x01,0xCA,0x00,0x3D,0x10,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCE,0x1A,0x1D,0x1A,
+0x1D,0xC3,0x1A,0x1D,0xCD,0x01,0xC4,0x19,0xA0,0x95,0x9C,0x98,0x20,0x05,0x17,0xC1,0x9D,0x9A,0xCD,0x17,0x20,0x06,0x07,0x0F,0x2B,0x3A,0xC0,0x3C,0x01,0xC7,0x27,0x9D,
+0x98,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC4,0x01,0xC1,0x29,0x36,0x06,0x97,0x99,0x9B,0x8B,0x05,
+0xC8,0x17,0x05,0xC4,0x17,0x05,0xC2,0x17,0x05,0xC0,0xA6,0x87,0x06,0xA8,0x87,0x2B,0xA0,0x6B,0x3C,0xC0,0x01,0xC4,0x27,0x07,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,
+0x1D,0xD0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCD,0x01,0xC0,0x06,0x31,0x9B,0x8B,0x05,0xC5,0x17,0x05,0xC3,0x17,0x05,0xC4,0x17,0x05,0xC5,0x17,0x05,0xC0,0xA6,0x87,
+0x22,0x2B,0x3E,0x3C,0xC0,0x01,0xC1,0x95,0x99,0x10,0xC0,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xC3,0x1A,0x1D,0x1A,0x1D,
+0xC3,0x1A,0x1D,0xC3,0x01,0x29,0x0F,0x05,0xC7,0x17,0x05,0xC6,0x17,0x05,0xC7,0x17,0x05,0xC4,0x3A,0xAD,0x86,0x2B,0x3E,0x3C,0x39,0x18,0x10,0x1D,0xC0,0x1A,0x1D,0x1A,
+0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCE,0x01,0x60,0x0F,0x05,0xC4,0x17,0x05,0xC8,0x17,0x05,0xC9,0x17,0x05,0xC5,0x3F,0x36,
+0xA7,0x68,0x18,0x10,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCD,0x01,0x19,0x05,0xC2,0x17,0x05,0xCA,
+0x17,0x05,0xCB,0x17,0x05,0xC6,0xAE,0x85,0xA8,0x73,0x13,0x18,0x10,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,
+0x1D,0xC9,0x01,0x9C,0x95,0x05,0xC3,0x17,0x05,0xCC,0x17,0x05,0xCD,0x17,0x05,0xC2,0x3A,0xAD,0x86,0x36,0x1D,0xC1,0x10,0x1A,0xC1,0x1D,0xC0,0x1A,0x1D,0xC4,0x1A,0x1D,
+0x1A,0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0x1D,0xC3,0x1A,0x1D,0x1A,0x1D,0xC3,0x01,0x07,0x05,0xC6,0x17,0x05,0xCE,0x17,0x05,0xCF,0x13,0x07,0x18,0x10,0x1D,0xC5,0x1A,0x1D,
+0xC8,0x1A,0x1D,0xC7,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCE,0x01,0x29,0x05,0xC4,0x17,0x05,0xD0,0x17,0x05,0xD0,0x20,0x07,0x9C,0x68,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,
+0xC5,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0x1D,0xC4,0x1A,0x1D,0x1A,0x1D,0xC2,0xFE,0x61,0x43,0x01,0x06,0x05,0xC7,0x17,0x05,0xD2,0x17,0x05,0xCC,0x3F,0x36,
+0x29,0x1D,0xC2,0x1A,0x1D,0xC8,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCF,0x1A,0x1D,0xC5,0x1A,0x98,0xD9,0xFE,0x89,0x40,0x01,0x90,0xA7,0x05,0xC1,0x17,0x05,0xD3,0x17,
+0x05,0xD2,0x3A,0x29,0x36,0x1D,0xC1,0x10,0x1A,0xC2,0x1D,0xC0,0x1A,0x1D,0xC6,0x1A,0x1D,0x1A,0x10,0xC0,0x1D,0xC0,0x10,0xC0,0x1D,0xC3,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,
+0x1D,0xC5,0xFE,0x60,0xE1,0xA4,0xE5,0x01,0x8F,0x98,0x97,0xAA,0x05,0xC5,0x17,0x05,0xC1,0x20,0xC0,0x05,0xC2,0x17,0x05,0xD5,0x17,0x05,0xC2,0x3A,0x07,0x22,0x1D,0xC2,
+0x1A,0x1D,0xC7,0x10,0xC0,0x3D,0x41,0xA2,0x97,0x3D,0xA2,0x77,0x66,0xC4,0x3D,0x07,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC4,0x36,0x25,0xA1,0xB9,0x01,0x8C,
+0xA6,0x0F,0x05,0xC6,0x17,0x05,0xC0,0x13,0xFE,0xBE,0x31,0x92,0x9A,0x3C,0x05,0xC2,0x20,0x50,0x17,0x9D,0x9A,0xC1,0x17,0x05,0xD3,0xA6,0x87,0x29,0x19,0x1A,0x1D,0xC2,
+0x1A,0x1D,0xC3,0x26,0xA2,0x97,0x3D,0x02,0xA3,0x99,0xC9,0x36,0x3D,0x1D,0xC2,0x1A,0x1D,0xC7,0x10,0x1D,0xC0,0x1A,0xFE,0x51,0x42,0x33,0x6B,0xFE,0x4B,0x0A,0x8E,0xA8,
+0x17,0x05,0xC7,0x17,0x05,0xA9,0x97,0xFE,0xDE,0xF8,0xA6,0x86,0x98,0x76,0x87,0x9B,0x8B,0x9C,0x05,0xC0,0x3C,0xB2,0x76,0x13,0x17,0xC1,0x05,0xC2,0x17,0x05,0xD0,0x3F,
+0xAE,0x85,0x29,0x1D,0xC2,0x1A,0x1D,0xC1,0x26,0xA2,0x97,0x25,0xCD,0x36,0x18,0x10,0x1D,0xC4,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC0,0xFE,0x71,0x00,0xA3,0xD8,0x5A,
+0xFE,0x4B,0x0A,0x0F,0x05,0xC5,0x17,0x05,0xC2,0xA6,0x87,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x8D,0x96,0x84,0x8B,0x05,0xC0,0xFE,0x8C,0x6C,0xB4,0x77,0x1F,0x89,0x9A,0x97,
+0x9C,0xC5,0x17,0x05,0xCF,0x3C,0xAA,0x76,0x18,0x10,0x1D,0xC1,0x9B,0xBA,0x07,0x02,0x25,0xCF,0x3D,0x02,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC4,0x9B,0xB9,
+0xFE,0x89,0x40,0xA1,0xB9,0xA0,0x49,0x19,0x8B,0xA9,0x05,0xC1,0x17,0x05,0xC7,0xFE,0xB5,0xB2,0x0B,0xC2,0x34,0x87,0x89,0x2B,0x16,0x34,0xA6,0x99,0x91,0x98,0x13,0x17,
+0x05,0xC1,0x17,0x05,0xD2,0x13,0xA7,0x67,0x18,0x10,0x3D,0xA2,0x77,0x02,0xA3,0x99,0xD1,0x02,0xC0,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC4,0x1E,0x33,0x9F,
+0x69,0x9D,0x6A,0x18,0x05,0xC8,0x17,0x05,0xC1,0xFE,0x94,0xCD,0x0B,0xC0,0x7A,0xC1,0x9D,0x88,0x89,0x88,0x81,0x9D,0xB7,0x99,0xFE,0xF7,0xF9,0x0B,0x34,0x83,0x9A,0x17,
+0xC1,0x05,0xC3,0x17,0x05,0xCE,0xB5,0x84,0x13,0x3D,0xA4,0x88,0xC7,0x02,0xC0,0x25,0xC9,0x3D,0x02,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC2,0x3D,0x35,0x37,
+0x12,0x0A,0x01,0xD8,0x94,0x87,0x05,0xC9,0x17,0x05,0xC0,0xBC,0x75,0x04,0x0B,0x0E,0xC3,0x8C,0x7A,0x20,0xFE,0xC6,0x97,0x0B,0xC0,0x9C,0x86,0x88,0x9A,0x84,0x8C,0x9A,
+0x89,0xC2,0x17,0x05,0xD0,0x3F,0x1E,0x25,0xC5,0x3D,0x26,0x61,0xC1,0x26,0x25,0xC8,0x3D,0x6E,0x1D,0xC2,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC1,0x98,0xE9,0x37,0x35,
+0x0A,0x5B,0x27,0xA3,0x88,0xC0,0x28,0xC0,0x01,0x66,0xC0,0x01,0xD0,0x8C,0xA6,0x9B,0x8B,0x05,0xC2,0x17,0x05,0xC6,0xB5,0x84,0xFE,0xF7,0xB9,0x0B,0x7A,0xC1,0x0B,0xC0,
+0x0E,0x21,0x96,0x87,0x04,0x0B,0x0E,0x9D,0x88,0x89,0x88,0x31,0x0F,0x05,0xC3,0x17,0x05,0xCE,0x06,0xA8,0x87,0x25,0xC1,0x02,0x9D,0x89,0x15,0xC0,0x26,0x15,0xC0,0x26,
+0x15,0x3D,0x25,0xC7,0x3D,0x07,0x1D,0xC0,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xC7,0xFE,0x51,0x42,0xA0,0xF6,0x0A,0x5B,0x0A,0x3D,0x07,0x02,0x3D,0x07,0x02,0x3D,0x07,0xC0,
+0xA6,0x78,0xC0,0x19,0x3C,0x28,0x01,0x3C,0xC0,0x01,0xC6,0x28,0x8A,0x98,0x05,0xC6,0x17,0x05,0xC3,0xAF,0x87,0x2B,0x0B,0xC0,0x9A,0x99,0x95,0x9A,0x36,0xC0,0x37,0x0C,
+0x21,0x34,0x21,0x0B,0xC0,0x2B,0x89,0x88,0x80,0x9C,0x05,0xC1,0x17,0x05,0xD1,0xB8,0x73,0x29,0x9D,0x9C,0x3D,0x15,0xC0,0x26,0x15,0xC1,0x26,0x15,0xC0,0xA2,0x77,0x25,
+0xC7,0x02,0x18,0x10,0x1D,0xC5,0x1A,0x1D,0x1A,0x1D,0xC2,0x3D,0x9B,0xF6,0xA0,0xB8,0x0A,0x0E,0x0A,0x3D,0xC0,0x07,0x02,0x3D,0x07,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x69,
+0x3D,0xC0,0x07,0x1D,0xC0,0xA3,0x99,0xC0,0xA3,0x88,0x3C,0xC1,0x6D,0x29,0x05,0xC2,0x17,0x05,0xC8,0xA9,0x97,0x0C,0x9B,0x77,0x8B,0xAC,0x13,0x00,0x3C,0x64,0x19,0x27,
+0x29,0x9C,0x96,0x2D,0xAB,0x96,0xC0,0x7A,0x96,0x76,0xFE,0x4A,0x85,0x92,0x8B,0x17,0x05,0xC2,0x17,0x05,0xCE,0x06,0x0F,0x94,0x9C,0x15,0xC0,0x26,0x15,0xC0,0x1F,0x15,
+0xC0,0x26,0x15,0xC0,0x25,0xC7,0x36,0x3D,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC1,0x98,0xE9,0x9E,0xD6,0x66,0x0A,0xC0,0x0E,0x3D,0x07,0x02,0x3D,0x07,0x3D,
+0x36,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x9E,0xA6,0x05,0xC2,0x17,0x05,0xC8,0xA6,0x87,0xB7,0x74,0x11,0xAB,
+0x98,0xA6,0x86,0x0B,0xC2,0x9C,0x89,0x3D,0x0C,0xA6,0x86,0x0B,0xC0,0x9A,0x99,0x29,0xAB,0x95,0x3C,0x83,0xBE,0x05,0xC1,0x17,0x05,0xD0,0xB7,0x74,0x94,0x98,0x15,0xC0,
+0xA2,0x78,0x15,0xC0,0x1F,0x15,0xC1,0x26,0x15,0x25,0xC7,0x9C,0x88,0xA2,0x77,0x1D,0xC0,0x1A,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0x98,0xE9,0x13,0x0E,0xC0,
+0x0A,0xC0,0x3D,0x02,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC0,0xA7,0x85,0x31,0x9B,0x8B,0x05,
+0xC4,0x17,0x05,0xC5,0xA5,0x87,0x21,0x19,0x3A,0x0B,0xC0,0x7A,0x5B,0x0B,0xC3,0x0E,0x12,0x88,0x9A,0x0C,0x3A,0x34,0xFE,0x52,0xC6,0x05,0xC6,0x17,0x05,0xCB,0xAE,0x85,
+0xA8,0x73,0x15,0xC0,0xA2,0x78,0x15,0xC0,0x1F,0x15,0xC2,0x02,0x25,0xC7,0x9C,0x87,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC3,0x1E,0x0A,0x5B,0x0A,0x0E,0x0A,
+0x3D,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC1,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC0,0x29,0x05,0xC3,0x17,0x05,0xC9,0xB9,0x76,0x42,
+0x29,0x33,0x0C,0xA7,0x88,0x7E,0x12,0x0B,0xC3,0x34,0x3A,0x0B,0x7A,0x84,0x88,0x96,0x78,0x94,0x9C,0x05,0xC1,0x17,0x05,0xCF,0x2B,0x0F,0x3F,0x20,0x9D,0x9B,0xC0,0x26,
+0x15,0xC0,0x1F,0x15,0xC0,0x25,0xC7,0x02,0xC0,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC1,0x3D,0xFE,0x61,0x43,0x0A,0x5B,0x0A,0x0E,0xC0,0x3D,0x07,0x02,0x3D,
+0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC2,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0x06,0x05,0xC1,0x17,0x05,0xCB,0x11,0xB4,0x9B,0x54,0x0C,0x33,0x9A,0x87,
+0xB8,0x87,0xA6,0x88,0x12,0x0B,0x7A,0x12,0x3A,0x98,0x76,0x0B,0x9D,0x98,0x30,0x21,0xA5,0x78,0x0F,0x8D,0x9C,0x17,0x05,0xC3,0x17,0x05,0xCC,0x22,0x20,0x1F,0x62,0xC0,
+0x26,0x15,0xC0,0x1F,0x15,0x25,0xC8,0x3D,0x18,0x10,0x1D,0xC6,0x1A,0x1D,0x1A,0x1D,0xC1,0x98,0xC9,0x13,0x66,0xC1,0x0A,0xC0,0x3D,0x02,0xC1,0x3D,0xC0,0x07,0x02,0x3D,
+0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC3,0x07,0x02,0x3D,0x07,0x9D,0x97,0x05,0xC3,0x17,0x05,0xC9,0x33,0x1B,0x31,0xC1,0x97,0x85,0x87,0x89,0x3D,0xA9,0x98,0x12,0x69,
+0xC0,0x9A,0x99,0x3A,0xC0,0x86,0x88,0x3D,0x21,0x8C,0x14,0x9C,0xBA,0x06,0x90,0x9C,0xD1,0xA3,0x87,0x05,0x3C,0xA8,0x73,0xFE,0x21,0x24,0x1F,0x15,0xC1,0xA2,0x78,0x15,
+0x25,0xC9,0x9C,0x88,0x18,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC2,0x98,0xE9,0x0E,0x0A,0xC0,0x0E,0x0A,0xC0,0xA6,0x2B,0x5A,0xC3,0x02,0xC1,0x3D,0xC1,0x07,
+0x02,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0x18,0x3D,0xC0,0xA7,0x85,0x2B,0x17,0x05,0xC4,0x17,0x05,0xC7,0x30,0x1B,0x31,0xC0,0x93,0x74,0x8D,0x34,0x97,0x99,0x9A,0xEF,0x2D,
+0xAB,0x96,0xC1,0x34,0x3A,0x11,0xAF,0x9A,0xC0,0x1D,0x96,0x67,0x25,0xB5,0x83,0x82,0x8A,0x9B,0x8B,0x05,0xC5,0x17,0x05,0xC9,0xA6,0x87,0xB1,0x73,0x3F,0x15,0xC0,0xA2,
+0x78,0x15,0xC0,0x25,0xCA,0x3D,0xA5,0x67,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC3,0x1E,0x0E,0x0A,0xC0,0x0E,0xC0,0x0A,0xA8,0x2B,0xC1,0x09,0x06,0x1D,0xC0,0x09,
+0xC0,0x06,0x1D,0x06,0xC1,0x02,0xC1,0x3D,0xC2,0x02,0x3D,0x22,0x05,0xC7,0x17,0x05,0xC6,0xB5,0x84,0x21,0x2D,0x37,0x8B,0x24,0x2C,0xFE,0x00,0xA0,0x3A,0x16,0x04,0x0B,
+0xC0,0x96,0x86,0xA4,0x9B,0x8E,0x8A,0x2D,0x37,0x8A,0x66,0x33,0x0C,0xA5,0x86,0xFE,0x63,0x48,0x17,0x05,0xC1,0x17,0x05,0xCE,0x36,0x94,0x9B,0x15,0xC0,0x26,0x15,0x25,
+0xCA,0x02,0x18,0x6E,0xC2,0x1A,0x1D,0xC7,0x10,0x9D,0xB8,0x9B,0xF7,0xA0,0xB8,0x0E,0x0A,0xC0,0x0E,0xC0,0x09,0x06,0xA2,0x98,0x06,0x09,0x06,0x1D,0x06,0x09,0x1D,0xC0,
+0x09,0xC0,0x1D,0xC0,0x09,0xC0,0x1D,0x09,0x06,0x1D,0x06,0x09,0xA4,0x34,0x05,0xC3,0x17,0x05,0xCA,0x07,0xFE,0xF7,0xB9,0x2A,0x9B,0x99,0x21,0xA5,0x78,0x2D,0x0C,0x3A,
+0xA2,0x78,0xC0,0x7A,0x96,0x76,0x0B,0xC0,0x2A,0x2B,0x0B,0xC1,0x0E,0x8F,0x98,0xFE,0x10,0xA0,0x05,0xC2,0x17,0x05,0xCD,0xB5,0x84,0x20,0xC0,0x26,0xA2,0x97,0x25,0xCB,
+0x9C,0x88,0xA2,0x77,0xA3,0x78,0xC0,0x1A,0x1D,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x36,0xFE,0x60,0xE1,0x0A,0x7E,0xA2,0xA7,0xC0,0xA1,0xB9,0x5A,0xFE,0x49,0xA6,0xC1,
+0x09,0x06,0xA2,0x98,0x06,0x09,0x1D,0xC1,0x09,0xC0,0x1D,0x09,0xC0,0x06,0x1D,0x06,0x09,0x1D,0xC0,0xA5,0x77,0x96,0x68,0x05,0xC1,0x17,0x05,0xCC,0xB3,0x84,0x2B,0x0B,
+0xC6,0x7A,0x5B,0x34,0xA6,0x99,0x0B,0xC0,0x0E,0x12,0x3A,0x0B,0xC0,0x93,0x89,0x20,0x05,0xC4,0x17,0x05,0xCB,0x22,0xC0,0x9D,0x9D,0xCE,0x07,0xC0,0xA3,0x78,0xC0,0x1A,
+0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC2,0xFE,0x51,0x42,0xA0,0xF6,0x37,0x79,0x6B,0xC0,0x37,0x33,0xFE,0x41,0x45,0xC0,0x06,0xC1,0x09,0x06,0xC1,0x09,0x06,0x09,0x06,0xA2,
+0x98,0x06,0x09,0x1D,0xC0,0x09,0x06,0x1D,0x06,0xA9,0x54,0x05,0xC2,0x17,0x05,0xCC,0x22,0x2B,0xA3,0x89,0xC8,0x9A,0x99,0xA4,0x87,0xC0,0x0B,0xC4,0x30,0x3C,0x05,0xC3,
+0x17,0x05,0xCC,0x22,0x36,0x9B,0x9D,0xCD,0x07,0x18,0x10,0xA2,0x87,0xC7,0x1A,0x1D,0x1A,0x1D,0xC1,0xFE,0x61,0x43,0x37,0x33,0x6B,0x37,0x33,0xC0,0x3A,0xFE,0x41,0x44,
+0x2D,0xCA,0x06,0xC1,0x09,0x06,0x09,0xC0,0x06,0xA2,0x98,0x22,0x05,0xC2,0x17,0x05,0xCC,0x22,0xFE,0xEF,0x98,0x0B,0xC8,0x2B,0x54,0x0B,0xC4,0x0C,0x16,0x3C,0x05,0xC4,
+0x17,0x05,0xCB,0x22,0xC0,0x25,0xCC,0x9C,0x87,0xA5,0x68,0xC1,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC4,0xFE,0x71,0x00,0x3A,0xC0,0x37,0x33,0xC1,0x3A,0x26,0x2D,0xD0,
+0x06,0xC1,0xA3,0x54,0x05,0xC2,0x17,0x05,0xCC,0x22,0x2B,0x0B,0xC9,0x34,0xA6,0x99,0x0B,0xC3,0x88,0x9B,0x05,0x20,0x50,0x97,0x9C,0xC6,0x17,0x05,0xC8,0x22,0xC0,0x07,
+0xC1,0x9C,0x89,0x36,0x3D,0xC0,0x07,0x02,0x3D,0x07,0x3D,0x02,0xC1,0x3D,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC3,0x36,0xFE,0x89,0x40,0xA1,0xB9,0x37,0x79,
+0xC2,0x3A,0xFE,0x41,0x44,0x2D,0xD2,0xA7,0x76,0x96,0x69,0x05,0xC3,0x17,0x05,0xCB,0x22,0x15,0x0B,0xC0,0x0E,0x5B,0x60,0x0B,0xC3,0x2B,0x99,0x87,0x04,0x0B,0x0E,0x0B,
+0xC0,0x15,0x20,0x05,0xA6,0x87,0x3F,0x05,0xC1,0x17,0x05,0xCD,0xB5,0x84,0x9B,0x89,0xA1,0x7B,0xC0,0x1A,0x1D,0x1A,0x1D,0xC1,0x98,0xC9,0x3D,0x07,0x1D,0xC0,0x1A,0x1D,
+0xC4,0x1A,0x1D,0xC7,0x10,0x1D,0x9B,0xB9,0x25,0xA1,0xB9,0x33,0x3A,0xC0,0x33,0x3A,0xC0,0x2D,0xD3,0x22,0x05,0xC3,0x17,0x05,0xCC,0x22,0x2B,0x0B,0xC7,0x2B,0x19,0x04,
+0x0B,0x0E,0x0B,0xC1,0xFE,0x73,0xAD,0x05,0xC1,0xA9,0x97,0x05,0xC2,0x17,0x05,0xCB,0xA9,0x85,0xB2,0x85,0x18,0x10,0x1D,0xC8,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xCA,
+0x2D,0x37,0x33,0x3A,0x33,0x3A,0xC0,0x33,0xC0,0x2D,0xCA,0x26,0x2D,0x26,0x2D,0x26,0x2D,0xC1,0xA3,0x88,0xA3,0x54,0x91,0x9D,0xC3,0x17,0x05,0xCC,0xB8,0x73,0x2B,0x0B,
+0xC7,0x34,0x9B,0x8A,0x2B,0xA3,0x89,0xC2,0x21,0x17,0xC1,0x05,0x16,0x05,0xC3,0x17,0x05,0xCA,0xB0,0x95,0x22,0x10,0xC0,0x1D,0xC4,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,
+0xCE,0x0D,0x33,0x6B,0xC0,0x33,0xC1,0x3A,0xC0,0x2D,0xCA,0x26,0xC1,0x2D,0x26,0x2D,0x26,0x2D,0xA7,0x76,0x96,0x69,0x05,0xC1,0x17,0x05,0xCE,0x3E,0xFE,0xF7,0xB9,0x0B,
+0xC2,0x0E,0x0B,0xC0,0x9A,0x99,0x30,0x86,0x8A,0x05,0x30,0x0B,0xC1,0x97,0x9A,0x36,0x05,0xC1,0x17,0x16,0x05,0xC4,0x17,0x05,0xC8,0x3A,0x0F,0x36,0x42,0x36,0x26,0x36,
+0x6B,0xC0,0x07,0xC1,0x27,0x59,0x1A,0x1D,0xC5,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC3,0xFE,0x69,0x01,0xA3,0xE7,0x37,0x33,0xC3,0x3A,0xFE,0x41,0x44,0x2D,0xCB,0x26,
+0xC1,0x2D,0x26,0x2D,0xAC,0x43,0x05,0xC3,0x17,0x05,0xCD,0xBD,0x73,0xBF,0xA9,0x0B,0xC4,0x0C,0x83,0x79,0x89,0x9A,0x3D,0xAB,0x67,0xA3,0x99,0x0B,0xC0,0x2A,0xFE,0x4A,
+0x86,0x05,0xC3,0xAB,0x86,0x05,0xCF,0xB0,0x74,0x13,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0x36,0x9C,0x89,0xA2,0x78,0x36,0x26,0x3D,0x07,0x02,0x3D,0x07,0x1D,
+0xC1,0x10,0x1A,0xC1,0x1D,0xC2,0x1A,0x1D,0xC1,0x35,0x37,0x7A,0x37,0x33,0xC3,0x2D,0xC9,0x69,0xC1,0x2D,0xC4,0x13,0x05,0xCA,0x17,0x05,0xC6,0xAE,0x85,0x30,0x0B,0xC0,
+0x0E,0x12,0x60,0x99,0x8A,0x13,0xAC,0x68,0xB1,0xA9,0x0C,0x0B,0x2B,0x0B,0x9A,0x99,0x81,0x7A,0x0F,0x62,0xC1,0x17,0x05,0xA9,0x97,0x05,0xCE,0x20,0xAC,0x76,0x36,0x6B,
+0xC1,0xA2,0x77,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC4,0x41,0x15,0x26,0x36,0x26,0x3D,0x07,0xC1,0x27,0x1D,0x1A,0x1D,0xC1,0x36,0x25,0xA1,0xB9,0x33,0x3A,
+0x5A,0x33,0xC2,0x2D,0xC9,0x69,0xC1,0x2D,0x26,0x2D,0x26,0x2D,0xA7,0x76,0x20,0x05,0xC5,0x17,0x05,0xCB,0x22,0x8E,0x8C,0x30,0x19,0x0B,0xC0,0x19,0x84,0x79,0xB1,0xA9,
+0xAF,0x78,0x12,0x2B,0x0B,0xC0,0x0C,0x29,0x87,0xAB,0xC1,0x17,0x05,0xC1,0x20,0x0A,0x05,0xC2,0x17,0x05,0xC7,0xA6,0x87,0x39,0x98,0x9D,0x3D,0x07,0x02,0x3D,0x07,0x3D,
+0x36,0x3D,0xC0,0x18,0x3D,0xC5,0x02,0x3D,0xC0,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x36,0x42,0x36,0x26,0xC0,0x36,0x1E,0x33,0x6B,0x5A,0x33,0xC4,0xFE,0x59,0xE7,
+0xC0,0x09,0xC0,0x2D,0xC9,0x69,0xC1,0x2D,0xAC,0x43,0x1F,0x05,0xC3,0x17,0x05,0xCC,0x3F,0xAD,0x84,0x0A,0x05,0x29,0x0C,0xA6,0x86,0x0B,0x3A,0x0B,0x19,0x21,0xA5,0x78,
+0x3A,0x0B,0xFE,0x42,0x28,0x05,0xC2,0x17,0x05,0xC1,0xAB,0x86,0x0A,0x05,0xC1,0x17,0x05,0xC8,0x22,0xC0,0x10,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0x18,0x3D,
+0xC6,0x02,0x3D,0xC1,0x02,0x3D,0xC2,0x07,0x02,0x3D,0x9D,0xA8,0x1E,0xA0,0xA9,0x9D,0xB7,0xA3,0xB7,0xA1,0xB9,0x37,0x3A,0x37,0x33,0xC3,0xFE,0x61,0xE7,0xC3,0x9E,0x68,
+0x2D,0xC9,0x26,0xC0,0xAC,0x44,0x05,0xC4,0x17,0x05,0xCC,0x3C,0xA1,0x56,0x95,0xAC,0x05,0xC0,0xAB,0x86,0x21,0xB2,0x77,0xC4,0x88,0x9B,0x80,0x89,0x05,0xC4,0x17,0x05,
+0xC0,0x3A,0x05,0xCC,0xB0,0x74,0x13,0x3D,0xC0,0x07,0x02,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0x18,0x3D,0xC7,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0x9D,0xA8,0x2D,0x1E,0x0A,
+0x35,0x25,0xA1,0xB9,0x37,0x3A,0xC0,0x37,0x79,0xC5,0x3A,0xFE,0x61,0xE7,0xC3,0x2D,0xC9,0x26,0xC0,0x13,0x69,0x05,0xCB,0x17,0x05,0xC5,0xAF,0x84,0x31,0xA8,0x57,0x9B,
+0x78,0x9D,0xAA,0xC0,0xA4,0x88,0xB5,0xB7,0xB5,0x9A,0xA9,0x98,0x0B,0x3D,0x29,0x89,0x9A,0x05,0xC2,0x17,0x05,0xC3,0x3F,0x05,0xC2,0x17,0x05,0xC6,0x3C,0xA7,0x87,0x97,
+0x9D,0x07,0x02,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0x18,0x3D,0xC8,0x07,0x02,0x3D,0x9D,0xA8,0x26,0x1E,0x0A,0x35,0x25,0xA1,0xB9,0x5A,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x37,
+0x33,0xC1,0xFE,0x61,0xE7,0xC3,0x2D,0xC9,0x26,0xC0,0xAC,0x44,0x96,0x88,0x05,0xC1,0x17,0x05,0xCF,0x3C,0x0F,0xFE,0x5C,0xE8,0xAA,0x52,0x9C,0x9A,0xC1,0xA6,0x75,0x36,
+0xFE,0x7D,0x2F,0x94,0xDC,0x3F,0x05,0xC4,0x17,0x05,0xD0,0xA5,0x87,0xB3,0x85,0x97,0x9C,0x3D,0xC0,0x07,0x02,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0x18,0x3D,0xC6,0x26,0x1E,
+0xA0,0xA9,0x35,0x37,0x3A,0xC0,0x37,0x33,0xC5,0x3A,0x33,0x3A,0xC0,0x33,0xC1,0x3A,0x37,0x33,0xC2,0x20,0xC3,0x2D,0xC9,0x26,0xC0,0xAC,0x44,0x8F,0x9B,0x05,0xC4,0x17,
+0x05,0xCB,0xA9,0x85,0x3C,0x92,0x8B,0xBF,0x20,0xFE,0x76,0x87,0x69,0xC2,0x1A,0x18,0x8F,0xAD,0x19,0x05,0xC1,0xA8,0x55,0xC1,0x9A,0xAA,0x05,0xC7,0x17,0x05,0xC6,0x13,
+0x06,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0xA4,0x67,0x3D,0xC3,0x9D,0xA8,0x1E,0x2B,0x0A,0x25,0xA1,0xA9,0x33,0x3A,0x33,0xA1,0xA9,0x56,0x3A,0x37,0x33,0xC5,
+0x3A,0x33,0xC0,0x3A,0xC0,0x33,0xC1,0x3A,0x33,0x3A,0xC0,0x33,0xFE,0x61,0xE7,0xC3,0x2D,0xCA,0x26,0xAF,0x44,0x88,0xAD,0x5A,0xC2,0x17,0x05,0xCD,0xAF,0x66,0x9B,0x99,
+0x97,0xAA,0x32,0x1A,0x6D,0xC2,0x2C,0xAB,0x75,0x0D,0xFE,0x22,0x84,0x95,0xBB,0xB0,0x43,0xAE,0x64,0xA2,0x75,0xFE,0x12,0x02,0x37,0x24,0x93,0xDD,0x05,0xC8,0x17,0x05,
+0xC3,0x3F,0xAE,0x85,0x97,0x9D,0xC0,0x07,0x66,0x3D,0x07,0x3D,0x69,0x3D,0xC0,0x36,0x26,0x1E,0x2B,0x9E,0xB6,0x25,0xA1,0xA9,0x33,0x3A,0x33,0x62,0xC4,0x7E,0x3A,0x37,
+0x33,0xC5,0x3A,0x33,0xC0,0x3A,0x37,0x33,0xC5,0x3A,0x20,0xC3,0x2D,0xC8,0x13,0xC0,0xA5,0x77,0x13,0x05,0xC1,0x17,0x05,0xCA,0xA5,0x87,0x0C,0xAB,0x64,0xA7,0x65,0x94,
+0xAA,0x24,0x99,0xBB,0xA3,0x77,0xAA,0x64,0x0D,0x18,0xC1,0x1A,0x2C,0x9D,0xEE,0x1A,0x95,0x8A,0x0E,0x1A,0x18,0xC0,0xFE,0x54,0xE7,0x19,0xA2,0xA9,0x10,0x0F,0x62,0xC9,
+0x17,0x05,0xC1,0x22,0x9C,0x6C,0x3D,0xC0,0x07,0x02,0x3D,0x9D,0xA8,0x26,0x1E,0xA0,0xA9,0x9E,0xB6,0x25,0xA1,0xA9,0xC0,0x33,0x6B,0x33,0xA1,0xA9,0x31,0x3A,0x9D,0xA9,
+0x29,0xC1,0x31,0x6F,0x3A,0x29,0x33,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x37,0x33,0xC4,0xFE,0x61,0xE7,0xC3,0x9E,0x68,0x2D,0xC4,0xA7,0x65,0x69,0x13,0xC1,
+0xA7,0x87,0x98,0x78,0x91,0x9D,0xC4,0x17,0x05,0xC6,0x2A,0xB7,0x32,0xAA,0x62,0x1F,0x18,0x06,0xFE,0x23,0x03,0x0A,0x05,0xA8,0x55,0xFE,0x3C,0x62,0x06,0x1F,0x18,0x1A,
+0x0E,0xFE,0x5B,0xA9,0x1A,0x18,0x99,0x9B,0x18,0xC1,0x1A,0x28,0x05,0x37,0xC0,0x0F,0x05,0xC1,0x17,0x05,0xC7,0xA6,0x87,0x22,0x10,0x9D,0xB9,0x9D,0xA8,0x2D,0x2B,0x9D,
+0xB7,0xA3,0xB7,0xA1,0xA9,0xA0,0xA8,0x5A,0x29,0xA3,0x98,0xC0,0x3D,0x29,0x33,0x05,0x3D,0x05,0x3D,0x29,0x05,0x3D,0x05,0xC1,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,
+0xC0,0x33,0x3A,0xC0,0x33,0xC1,0x3A,0x33,0xC0,0x3A,0xFE,0x61,0xE7,0xC4,0x9E,0x68,0xA4,0x76,0x13,0xC3,0x1D,0x13,0xC1,0x0D,0x90,0x79,0x0F,0x62,0xC6,0x17,0x05,0xC3,
+0x1C,0xAA,0x52,0x18,0xC1,0x1A,0x9A,0x8A,0xFE,0x0A,0x00,0x92,0xEF,0x05,0x28,0xFE,0x55,0x63,0xA6,0x88,0x1F,0x18,0x06,0x0E,0x1A,0x18,0x0E,0xA4,0x88,0x18,0x1A,0x18,
+0x0E,0x0F,0x05,0xAA,0x64,0x9D,0x79,0x05,0xC1,0x17,0x05,0xC7,0xAF,0x84,0x2B,0x9D,0xB7,0x25,0x37,0xC0,0x33,0x6B,0xA1,0xA8,0x3D,0x05,0xC1,0x3D,0x05,0xC2,0x3D,0x05,
+0xC2,0x6E,0x05,0xC0,0x0A,0x05,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0x37,0x33,0xC5,0x20,0xC3,0x9E,0x68,0x1D,0x59,0xC1,0x1D,0xC0,0x13,0xC3,0xA8,
+0x66,0x88,0xAD,0x5A,0xC1,0x17,0x05,0xC8,0xA6,0x87,0x36,0x18,0xC2,0x1A,0x18,0x0E,0x28,0x05,0xA8,0x55,0x36,0xC0,0x1A,0x18,0x1A,0x18,0xC0,0x1A,0x12,0x32,0x1A,0x18,
+0x1A,0x18,0xFE,0x0A,0x00,0x92,0xEF,0x7B,0xAA,0x44,0x97,0xBB,0x05,0xC1,0x17,0x05,0xC6,0xB0,0x95,0xFE,0x99,0x61,0x33,0x6B,0x33,0x29,0xC0,0x33,0xA1,0xA9,0xC1,0x6E,
+0x3D,0x3A,0x29,0xC0,0x33,0x05,0xC0,0x0A,0x05,0x3A,0x3D,0x3A,0x0A,0x05,0x3A,0x3D,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x37,0x33,0xC4,0x20,
+0xC4,0x06,0x1D,0x13,0x1D,0x13,0xC2,0x0C,0x13,0x1D,0xA5,0x66,0x8B,0x9D,0xC5,0x17,0x05,0xC5,0xA5,0x87,0xFE,0x76,0x09,0x18,0xC1,0x1A,0x18,0xC0,0x1A,0x12,0xFE,0x00,
+0x40,0x05,0x39,0x1F,0x0D,0x9C,0x88,0x18,0xC2,0x15,0x0F,0xBC,0x20,0x1A,0x18,0xC0,0x8A,0x9E,0x05,0xC0,0xA7,0x78,0x5C,0x05,0xC1,0x17,0x05,0xC6,0xB2,0xE3,0xFE,0x99,
+0x61,0x33,0x3A,0x33,0xA1,0xA9,0x51,0xA3,0x88,0x05,0x3A,0x0A,0x05,0x3A,0x3D,0x3A,0x61,0x33,0x29,0xC0,0x05,0x3D,0x05,0xC2,0x0A,0x05,0x3D,0x29,0x05,0x3A,0x37,0x33,
+0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0xC0,0x20,0xC3,0x06,0xA4,0x76,0x13,0x1D,0xC0,0x13,0xC4,0xA7,0x87,0x98,0x78,0x91,0x9D,0xC5,0x17,
+0x05,0xC5,0x2B,0x19,0x18,0x1A,0x18,0xC3,0x2C,0xFE,0x09,0x81,0x96,0xCC,0x32,0x1A,0x18,0xC0,0x25,0xA4,0x88,0x18,0x2C,0x06,0x05,0xC0,0xBF,0x20,0x1F,0x18,0x12,0xFE,
+0x00,0xA0,0x05,0xC0,0x10,0x0F,0x05,0xC2,0x17,0x05,0xC4,0x28,0x37,0x3D,0x5A,0x29,0xC0,0x31,0x3A,0xA2,0x97,0x66,0x0A,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x33,0x05,0xC0,
+0x0A,0x3D,0x3A,0x0A,0xC0,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0x37,0x33,0x20,0xC3,0x9E,0x68,0x1D,
+0x13,0x1D,0xC1,0x13,0xC3,0xA7,0x87,0x92,0x79,0x97,0x9C,0xC2,0x17,0x05,0xC8,0xA6,0x87,0xFE,0x65,0xA7,0x18,0x1A,0x18,0xC4,0x12,0x19,0xAB,0x55,0xFE,0x76,0x09,0x18,
+0xC0,0x1A,0x18,0x97,0x9A,0xFE,0x2B,0x24,0x05,0xC1,0xA8,0x55,0x39,0x1F,0x0E,0x0F,0x05,0xC0,0xA5,0x88,0x10,0x0F,0x05,0xC3,0x17,0x05,0xC2,0x00,0x3D,0x5A,0xA2,0x97,
+0xC0,0x3D,0x3A,0x29,0xC0,0x31,0xC0,0x3A,0x0A,0x29,0x33,0x29,0x31,0x3A,0x0A,0x66,0xC0,0x0A,0x3D,0x05,0x3D,0x29,0x05,0x3A,0xC0,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,
+0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC0,0x37,0x33,0xC1,0x20,0xC4,0x06,0x1D,0x13,0x1D,0xC2,0x13,0xC1,0xA7,0x65,0x8D,0xAD,0x9C,0x8A,0xC5,0x17,0x05,0xC6,0x1C,0x18,0x1A,
+0x18,0xC4,0x99,0x9C,0xFE,0x09,0x81,0x9D,0xAA,0x36,0x18,0x1A,0x18,0xC1,0x25,0x15,0xFE,0x01,0x00,0x05,0xC0,0xA6,0x87,0xB9,0x21,0xFE,0x55,0x63,0xFE,0x00,0xA0,0x05,
+0xC1,0x10,0x0F,0x05,0xC4,0x17,0x05,0xC1,0xAB,0x86,0xA7,0xF6,0xFE,0x99,0x61,0x3D,0x7E,0xC0,0x6E,0x3D,0x05,0x31,0x0A,0x05,0x46,0x3D,0x3A,0x29,0xC0,0x0A,0x05,0x3A,
+0x0A,0x05,0xC0,0x0A,0x3D,0x05,0x31,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC1,0x37,0x33,0xC1,0xFE,0x61,0xE7,0xC4,0x13,0xC1,0x1D,
+0xC0,0x13,0xC1,0x1D,0xC0,0xA5,0x66,0x8B,0x9D,0xC6,0x17,0x05,0xC6,0x2C,0xFE,0x76,0x87,0x18,0xC2,0x1A,0x18,0xC1,0x15,0x2B,0xFE,0x65,0xA7,0x18,0xC3,0x1A,0x18,0x97,
+0x9A,0xFE,0x2B,0x24,0x8F,0xCD,0x05,0xC0,0xB5,0x20,0x28,0x05,0xC1,0xA6,0x87,0x10,0x0F,0x05,0xC5,0x17,0x05,0xC0,0x3A,0xAC,0xE4,0x37,0x3D,0x31,0x5F,0x9D,0xA9,0x29,
+0x33,0xA1,0xA9,0xC0,0x6E,0x3D,0x29,0x33,0x05,0xC0,0x0A,0x3D,0x0A,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC0,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,
+0x33,0x3A,0xC2,0x37,0x33,0x20,0xC4,0x13,0xC1,0x1D,0xC0,0x13,0xC2,0x1D,0xA6,0x52,0xFE,0x00,0x20,0xC7,0x17,0x05,0xC5,0xB8,0x21,0x1A,0x18,0xC3,0x1A,0x18,0xC0,0x92,
+0x9E,0x19,0xFE,0x6D,0x69,0x18,0xC1,0x1A,0x18,0xC3,0x0E,0x08,0x92,0xBD,0x17,0x10,0x0F,0x05,0xC1,0x10,0x0F,0x05,0xC6,0x17,0x05,0xC0,0xA6,0x87,0x00,0x9D,0xF3,0x9A,
+0xFB,0x5A,0x29,0xC0,0x31,0xC0,0x0A,0x66,0x3A,0x3D,0x3A,0x29,0x05,0xC0,0x0A,0x3D,0x05,0x0A,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,
+0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC1,0x20,0xC3,0x9E,0x68,0x1D,0x13,0x1D,0xC2,0x13,0x0C,0x13,0x1D,0xA1,0x75,0x8F,0x8E,0xC8,0x17,0x05,0xC4,0x2A,0xFE,0x76,0x09,
+0x18,0xC3,0x1A,0x18,0xC0,0x99,0x9C,0xFE,0x09,0x81,0xBF,0x51,0x18,0xC0,0x1A,0x18,0xC6,0x12,0xFE,0x01,0x60,0x98,0xCC,0xA8,0x77,0x28,0x05,0xC0,0xA5,0x88,0x10,0x9D,
+0x99,0xC0,0x0F,0x05,0xC7,0x2B,0xB3,0x85,0xFE,0x99,0x61,0x33,0x3A,0x33,0xA1,0xA9,0x31,0xA3,0x88,0xC0,0x05,0x3A,0x7A,0x3A,0x29,0x05,0x0A,0x05,0x0A,0x05,0xC0,0x3A,
+0x29,0x33,0x29,0x31,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC3,0x20,0xC3,0x9E,0x68,0x1D,0x13,0x1D,0xC2,0x13,0x1D,0x13,0xA5,0x77,
+0x9A,0x88,0x91,0x9D,0xC6,0x17,0x05,0xC6,0x2B,0x0E,0x1A,0x18,0xC2,0x1A,0x18,0xC1,0xFE,0x0A,0xA0,0xB6,0x96,0x18,0xC3,0x1A,0x18,0xC4,0x12,0xFE,0x00,0xA0,0x05,0x15,
+0x28,0x07,0x10,0x59,0x9D,0xAA,0xA7,0x66,0x37,0x05,0xC2,0x17,0x05,0xC3,0xAF,0x87,0xA5,0xF4,0x31,0x5F,0x0A,0x29,0xA2,0x88,0x3A,0x0A,0xC0,0x3D,0x7E,0x3D,0x29,0x05,
+0x3A,0x05,0xC0,0x0A,0x3D,0x05,0x31,0x3A,0xC0,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC4,0x37,0x20,0xC3,0x9E,0x68,0x1D,0x13,0x1D,0xC2,
+0x13,0x1D,0xC0,0x36,0x94,0x89,0x97,0x9C,0xC3,0x17,0x05,0xCA,0xFE,0x43,0xE6,0x1A,0x18,0x1A,0x18,0xC4,0x8A,0x9E,0xAF,0x97,0x18,0xC4,0x1A,0x18,0xC3,0x39,0x19,0x05,
+0x10,0xC0,0x97,0xBB,0x28,0xC0,0x7F,0xC2,0x0F,0x05,0xC3,0x17,0x05,0xC0,0xA6,0x87,0xAC,0xE4,0x3D,0x5A,0x61,0xC0,0x31,0xC0,0x0A,0xC0,0x66,0x3A,0x3D,0x3A,0x29,0xC0,
+0x3A,0xC1,0x31,0x3A,0x0A,0x29,0x3D,0x3A,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC4,0x20,0xC3,0x06,0xA4,0x76,0x13,0x1D,0xC2,0x13,0x1D,
+0xC0,0xA8,0x55,0x2B,0x9B,0x9A,0xC1,0x17,0x05,0xCC,0xAF,0x54,0xFE,0x6E,0x27,0x18,0xC2,0x1A,0x18,0xC1,0x92,0x9B,0x0D,0x18,0xC3,0x1A,0x18,0xC4,0xFE,0x3B,0xE5,0x05,
+0xC0,0x03,0x9B,0x98,0x05,0x07,0x42,0xC1,0xA3,0x77,0x37,0x99,0xBB,0x05,0xC2,0x17,0x05,0xC1,0xAB,0x86,0xAA,0xF5,0xFE,0xB1,0x81,0xC0,0x3A,0x29,0x05,0x3D,0x29,0x05,
+0x3A,0xC0,0x29,0x33,0x29,0x7E,0x3A,0x29,0x33,0x29,0x31,0x3A,0x29,0x3A,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xFE,0x61,0xE7,0xC4,
+0xA2,0x45,0xC1,0x1D,0xC0,0x13,0xC0,0x1D,0x13,0xA5,0x77,0x8B,0xAD,0x5A,0xC3,0x17,0x05,0xCA,0x2B,0x0E,0x1A,0x18,0xC3,0x1A,0x18,0x97,0x9A,0x0D,0x18,0xC4,0x1A,0x18,
+0xC3,0xFE,0x22,0x84,0x05,0x32,0x2B,0x17,0x05,0xC2,0x2B,0xAA,0x34,0x99,0xBB,0x99,0xBB,0x05,0xC6,0x22,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x3A,0x29,0x05,0x3D,0x3A,0xA2,
+0x97,0xC0,0x3D,0x05,0x31,0x3A,0x9D,0xA9,0x29,0x31,0x3A,0x24,0x29,0x31,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC6,0x20,0xC4,0x13,
+0x1D,0x13,0xC3,0x1D,0x13,0xA7,0x64,0xFE,0x00,0x20,0xCB,0x17,0x05,0xC4,0xFE,0x43,0xE6,0x1A,0x18,0xC2,0x1A,0x18,0xC1,0x99,0x9C,0x18,0x1A,0x18,0xC7,0x97,0x9A,0x19,
+0x17,0x10,0x96,0xBB,0x05,0xC0,0x2B,0xA3,0x67,0xC1,0x06,0xA4,0x77,0x0F,0x05,0xC5,0xA6,0x87,0x28,0xFE,0x99,0x61,0x3D,0x7E,0xC1,0x6E,0x3D,0x05,0x0A,0x05,0xC0,0x0A,
+0x3D,0x05,0x31,0x5F,0xC0,0x29,0x33,0x29,0x31,0x3A,0x29,0x3A,0xC0,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC3,0x20,0xC3,0x9E,0x68,0xA4,
+0x76,0x13,0x1D,0xC2,0x13,0x1D,0xC0,0x26,0xFE,0x00,0x20,0xC2,0x17,0x05,0xCD,0x24,0xFE,0x76,0x09,0x18,0x1A,0x18,0xC4,0x97,0x9A,0xA6,0x88,0x18,0xC1,0x1A,0x18,0xC4,
+0x8A,0x9E,0x05,0xAF,0x44,0x9C,0x88,0x9D,0xAA,0x99,0xBB,0x0F,0x05,0xA7,0x55,0x9E,0xBB,0x10,0x37,0x06,0x37,0x0A,0x0F,0x05,0xC3,0x1D,0x04,0xFE,0xB1,0x81,0xC0,0x3D,
+0x05,0xC2,0x6E,0x05,0xC1,0x3A,0x61,0x05,0x3D,0x29,0x33,0x29,0x31,0x3A,0x29,0x3A,0xC1,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC4,0x20,
+0xC4,0x13,0xC2,0x1D,0xC0,0x13,0xC0,0x36,0x9E,0x86,0x8D,0x9F,0xC9,0x17,0x05,0xC6,0x2B,0x39,0x1F,0x18,0x1A,0x18,0xC3,0x97,0x9A,0xA6,0x88,0x18,0xC0,0x1A,0x18,0x0D,
+0x9C,0x9A,0x25,0x0A,0x9D,0x8A,0x96,0x9B,0x92,0xCE,0x10,0x59,0xC0,0x9D,0xAA,0x06,0x37,0x24,0x37,0x06,0xC0,0x37,0x06,0x15,0x97,0xAA,0xC0,0x05,0xC2,0xAB,0x86,0xA7,
+0xF6,0xFE,0x99,0x61,0x3D,0x7E,0xC2,0x6E,0x3D,0x05,0x0A,0x05,0x0A,0x05,0x3A,0x0A,0x05,0xC1,0x3A,0x61,0x05,0x3D,0x29,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,
+0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xFE,0x61,0xE7,0xC3,0x9E,0x68,0x1D,0x59,0x1D,0xC2,0x13,0x1D,0xA5,0x66,0x13,0x90,0x7B,0xC2,0x17,0x05,0xCE,0xB4,0x42,0x0D,0x18,0xC5,
+0x2C,0x0E,0x25,0x50,0x25,0x2C,0xC0,0x0D,0x18,0x2C,0x1A,0x8C,0xAD,0x0F,0x05,0xC5,0x32,0x10,0x9D,0x99,0xA3,0x77,0x0F,0x05,0xC4,0x2B,0xB3,0x85,0xFE,0x99,0x61,0x31,
+0x3A,0xA2,0x97,0x66,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x3A,0x0A,0x05,0xC2,0x0A,0x3D,0x05,0x31,0x3A,0xC0,0x29,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,
+0xC0,0x33,0x3A,0xC5,0x20,0xC4,0x9E,0x68,0x1D,0x13,0x1D,0xC2,0x13,0xA7,0x87,0x98,0x78,0x91,0x9D,0xC1,0xA3,0x87,0x05,0xCF,0x2B,0x0E,0x1A,0x18,0xC4,0x1A,0x25,0x18,
+0xC3,0x1A,0x18,0xC1,0x97,0x9A,0xFE,0x00,0xA0,0x17,0x05,0xC1,0x17,0x05,0xC3,0x3F,0x19,0x05,0xC4,0x13,0xFE,0x8A,0x21,0x3D,0x7E,0xC0,0x6E,0x3D,0x05,0x0A,0x05,0x0A,
+0xC0,0x05,0x0A,0x05,0x0A,0x05,0x3D,0x05,0xC2,0x46,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC7,0x37,0x33,0x20,0xC4,0x13,0x1D,0xC0,0x13,
+0xC3,0x0D,0x98,0x76,0x91,0x9F,0xC3,0x17,0x05,0xCE,0xB8,0x21,0x1A,0x18,0xC4,0x1A,0x25,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC2,0xFE,0x02,0x00,0x92,0xFF,0x05,0xC1,0x0A,
+0x05,0xC1,0x0A,0x05,0xA6,0x87,0xA5,0x56,0x05,0xC3,0xA9,0x97,0xAB,0xE4,0x31,0x3D,0x5A,0xA2,0x97,0x29,0xC1,0x31,0xA2,0x88,0xC0,0x0A,0x3D,0x05,0x0A,0x05,0x0A,0xC1,
+0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x31,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC2,0x20,0xC3,0x06,0x1D,0x13,0x1D,0xC2,0x13,
+0x1D,0x36,0x96,0x88,0x95,0x9D,0xC2,0x17,0x05,0xCF,0x2B,0xFE,0x55,0x63,0xA6,0x88,0x18,0xC3,0x1A,0x25,0x18,0xC0,0x1A,0x18,0xC5,0xFE,0x22,0xC2,0x05,0xC9,0x10,0x97,
+0xBB,0x05,0xC1,0x2B,0x28,0x37,0x3D,0x31,0x3D,0x3A,0xA2,0x97,0xC0,0x3D,0x7E,0x31,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x31,0x3A,0x0A,0x05,0x0A,0x3A,0x37,0x33,0xC5,0x3A,
+0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC8,0x37,0x33,0x20,0xC4,0x13,0xC1,0x1D,0xC0,0x13,0xC0,0x1D,0xA8,0x55,0x2B,0x9B,0x9A,0x6E,0x05,0xC1,0x0A,0x05,0xC2,
+0x17,0x05,0xC9,0xB8,0x10,0xAE,0x64,0x1A,0x18,0xC3,0x1A,0x25,0x9B,0x89,0xA5,0x99,0x18,0xC0,0x1A,0x18,0xC3,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0xC1,0x17,0x05,0xC4,
+0x10,0x0F,0x05,0xC1,0x36,0x37,0x33,0x3A,0x33,0xA1,0xA9,0x31,0x29,0x33,0x05,0xC0,0x6E,0x3D,0x0A,0xC0,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,0x3D,0x29,0x05,0x3A,0xC0,
+0x29,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0x20,0xC4,0x13,0x1D,0xC0,0x13,0x69,0x13,0x1D,0x13,0xA8,0x74,0x8F,0x8C,0x0F,0x62,
+0xC7,0x17,0x05,0xC8,0x10,0xFE,0x55,0x63,0x25,0x2C,0x18,0x1A,0x18,0xC1,0x25,0x18,0x1A,0x18,0x25,0x2C,0x06,0x1F,0x18,0xC2,0x15,0x05,0xC9,0x03,0x0F,0x05,0xC0,0x0C,
+0xFE,0x8A,0x21,0x3D,0x7E,0xC0,0x3D,0x29,0x05,0x3A,0x05,0xC1,0x6E,0x3D,0x05,0x0A,0x05,0x0A,0xC0,0x29,0x33,0x29,0x7E,0x3A,0x29,0x3A,0xC2,0x37,0x33,0xC5,0x3A,0x33,
+0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xA5,0x78,0x20,0xC3,0x9E,0x68,0x1D,0x13,0x1D,0xC2,0x13,0x1D,0x36,0x8F,0x9B,0x9C,0x8A,0xC6,0x17,0x05,0xCA,0xFE,0x3C,
+0x62,0x2C,0xA4,0x87,0x95,0x99,0x0D,0x18,0xC1,0x1A,0x18,0xC4,0x2C,0x9E,0x86,0xA6,0x88,0x18,0xC1,0x3B,0xFE,0x00,0x60,0xC0,0x05,0xC7,0xA8,0x55,0xC0,0x0F,0x3C,0xA6,
+0xE5,0x31,0x3D,0x7E,0x3D,0x05,0xC2,0x6E,0x05,0xC1,0x3D,0x05,0xC2,0x0A,0x05,0xC1,0x29,0x33,0x29,0x31,0x3A,0x29,0x3A,0xC3,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,
+0x33,0x3A,0xC0,0x33,0x3A,0xC1,0x0A,0x20,0xC4,0x13,0xC1,0x1D,0xC0,0x13,0xC0,0x1D,0xA8,0x55,0x1F,0x9C,0x8A,0xC4,0x6E,0x05,0xC1,0x0A,0x05,0xC3,0x17,0x05,0xC1,0xAB,
+0x86,0xFE,0x76,0x09,0x2C,0x0D,0x9A,0x87,0x25,0x18,0xC1,0x1A,0x18,0xC6,0x2C,0x9B,0x88,0x2C,0x1A,0x3B,0xFE,0x12,0x02,0xC0,0x99,0xBB,0xA3,0x77,0xC0,0x9C,0x99,0x05,
+0x37,0x28,0x9E,0xBB,0x10,0x06,0x99,0xBB,0x16,0xAB,0xE4,0xFE,0x99,0x61,0xA1,0xB8,0xC1,0x3A,0x29,0x05,0x3D,0x05,0xC0,0x3A,0x29,0x05,0x3D,0x29,0x05,0xC0,0x6E,0x3D,
+0x05,0x0A,0x05,0x0A,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,0x37,0xAA,0x96,0xFE,0x61,0xE7,0xC4,0x1D,0x13,0xC3,0x1D,0x13,0x04,
+0x8F,0x8C,0x99,0x9C,0xC1,0x17,0x05,0xCE,0xAB,0x86,0xFE,0x76,0x09,0x9B,0x75,0xA6,0x88,0x0D,0x95,0x99,0x0D,0x18,0xC2,0x1A,0x18,0xC5,0x25,0xFE,0x0A,0x00,0xA9,0x88,
+0x9C,0xBA,0x97,0x8A,0x96,0xCC,0x6E,0x05,0xA7,0x55,0xC1,0x7F,0xC1,0x0F,0x05,0xA6,0x87,0xAC,0xE4,0xFE,0x99,0x61,0x33,0x6B,0x33,0xA1,0xA9,0x51,0x29,0x05,0xC0,0x6E,
+0x3D,0x05,0x31,0x3A,0xC0,0x05,0xC0,0x0A,0x3D,0x05,0x0A,0x05,0x0A,0x3A,0xC0,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,0x29,0x10,0xFE,
+0x61,0xE7,0xC4,0x9E,0x68,0xA4,0x65,0x0C,0x13,0x1D,0x13,0xC1,0x04,0x8F,0x8C,0x99,0x9C,0xC2,0xA3,0x87,0x05,0xCE,0xFE,0x6D,0x69,0xA0,0x52,0x25,0x2C,0x0A,0x25,0x18,
+0xC4,0x1A,0x18,0xC2,0x25,0xFE,0x1A,0xC1,0x95,0xBD,0xA5,0x76,0x5A,0x92,0xFF,0x05,0xC1,0x17,0x05,0xC5,0x00,0xFE,0xA9,0x61,0x7E,0x3D,0x29,0x05,0x3A,0xC0,0x29,0x05,
+0xC0,0x6E,0x3D,0x05,0x0A,0x05,0x0A,0xC0,0x29,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x51,0x05,0x3A,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,
+0xAA,0x86,0x20,0xC4,0x1D,0x59,0xC3,0x1D,0x13,0x04,0x8F,0x8C,0x99,0x9C,0xC3,0x17,0x05,0xCD,0xFE,0x43,0xE6,0x12,0xFE,0x0A,0x00,0x39,0xAE,0x73,0x8A,0x9D,0xAF,0x97,
+0x18,0xC1,0x1A,0x18,0xC3,0x12,0x13,0x99,0xCD,0xA7,0x66,0xA4,0x88,0x05,0xCA,0xB0,0x74,0xFE,0x8A,0xC5,0xFE,0xB1,0x81,0xC2,0x3A,0x61,0x05,0x3D,0x05,0x0A,0x05,0x0A,
+0x05,0x0A,0x05,0x51,0x05,0x3A,0x05,0x3D,0x05,0xC2,0x3A,0xC0,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,0xA5,0x78,0x10,0x20,0xC4,0xA2,
+0x45,0xC2,0x7B,0xC0,0x13,0xC0,0xA5,0x77,0x92,0x89,0x0F,0x62,0xC8,0x17,0x05,0xC7,0xA6,0x87,0xA5,0x56,0x0F,0xB2,0x53,0x0D,0xFE,0x01,0x60,0x12,0xAE,0x75,0x18,0xC1,
+0x1A,0x18,0xC0,0x39,0x3E,0xFE,0x00,0xA0,0x05,0x10,0xAC,0x43,0x37,0x0F,0x05,0xC9,0x28,0xFE,0x99,0x61,0x3D,0x7E,0xC1,0x29,0xC0,0x05,0xC1,0x0A,0x3D,0x05,0x0A,0x05,
+0x0A,0xC0,0x29,0x0A,0x05,0xC0,0x0A,0x3D,0x05,0x51,0x5F,0xC0,0x29,0x3A,0xC0,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC6,0x0A,0xA8,0x77,
+0x20,0xC4,0x13,0xC0,0x69,0x13,0x1D,0x13,0xC1,0x36,0x8F,0x9B,0x9C,0x8A,0xCA,0xA3,0x87,0x05,0xC9,0xA6,0x87,0x0E,0x39,0x25,0x50,0xA9,0x88,0x18,0x06,0x1A,0x95,0x8A,
+0x0E,0x08,0x0F,0x05,0xC0,0xAB,0x55,0xA4,0x66,0x0F,0x05,0xC2,0x17,0x05,0xC4,0xAF,0x84,0x04,0xFE,0xB1,0x81,0xC3,0x46,0x29,0x05,0x6E,0x05,0x0A,0x05,0x0A,0x05,0x31,
+0x05,0x3A,0x05,0xC1,0x0A,0x3D,0x05,0x31,0x3A,0xC0,0x29,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC6,0xAA,0x86,0xC0,0x20,0xC4,
+0x13,0xC2,0x1D,0xC0,0x13,0xC0,0x36,0x96,0x88,0x95,0x9D,0xC3,0x17,0x05,0xCF,0xAF,0x54,0xB7,0x31,0x9F,0x74,0x0D,0x18,0x25,0x50,0x25,0x0E,0x24,0x0D,0x0E,0xFE,0x01,
+0x60,0x0F,0x05,0x2B,0xAA,0x34,0x0F,0x05,0xCA,0x13,0xFE,0xA1,0xC1,0x9E,0xB9,0xC0,0x6E,0x3D,0x05,0x0A,0x05,0x0A,0xC1,0x05,0xC0,0x0A,0x3D,0x05,0x51,0x3A,0xC0,0x05,
+0xC1,0x3A,0x29,0x05,0x3D,0x29,0x3A,0xC0,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC8,0x10,0xC0,0x20,0xC4,0x1D,0x13,0x0C,0x13,0x1D,0x13,
+0xC1,0x36,0x96,0x8A,0x95,0x9B,0xCC,0x17,0x05,0xC4,0xAB,0x55,0xB3,0x42,0x0D,0x18,0x2C,0x1A,0x18,0xC0,0x0D,0x9C,0x9A,0x1A,0x36,0x9E,0x75,0xFE,0x2B,0x24,0x9B,0xAB,
+0x28,0x13,0xA4,0x63,0xFE,0x09,0x81,0x96,0xCC,0x0F,0x05,0xC1,0x17,0x05,0xC5,0xAF,0x84,0x37,0xA1,0xB8,0xC0,0x6E,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,0x46,0x05,0xC0,
+0x29,0x33,0x05,0xC0,0x0A,0x3D,0x0A,0xC0,0x05,0x3D,0x29,0x05,0x3A,0xC0,0x29,0x3A,0xC0,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xA5,
+0x78,0xA6,0xA7,0xC0,0xFE,0x61,0xE7,0xC4,0x1D,0x59,0xC0,0x69,0x13,0x1D,0x13,0xC0,0xA5,0x77,0x9A,0x88,0x91,0x9D,0xCD,0x17,0x05,0xC2,0xB3,0x33,0xFE,0x55,0x63,0xA6,
+0x88,0x18,0xC1,0x0A,0x06,0x18,0xC2,0x1A,0x18,0x99,0xAD,0x18,0xC1,0x12,0xFE,0x00,0xA0,0x05,0xC2,0x17,0x05,0xC6,0x3F,0xAD,0xF4,0x31,0x3D,0x7E,0x31,0x5F,0xA2,0x97,
+0x05,0x0A,0x3A,0x31,0x3A,0x0A,0x05,0x0A,0x3A,0x31,0x05,0xC0,0x0A,0x3D,0x05,0x0A,0x05,0x0A,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,
+0x3A,0xC8,0x0A,0xA8,0x77,0xC0,0x20,0xC4,0x5A,0xC0,0x13,0x69,0x13,0x7B,0x13,0xC0,0xA5,0x77,0x14,0x8D,0x9F,0xC2,0x17,0x05,0xCB,0x2B,0xB9,0x10,0x0D,0x18,0xC1,0x1A,
+0x18,0x2C,0x0D,0xA4,0x76,0x18,0xC1,0x1A,0x8B,0x9D,0x92,0xCE,0x28,0x0D,0x18,0xFE,0x0A,0xA0,0x19,0x05,0xCC,0x0C,0xFE,0x8A,0x21,0x98,0xFB,0x33,0x29,0x31,0x3A,0x29,
+0x3A,0xC2,0xA1,0xA8,0x3D,0x05,0xC1,0x29,0xC1,0x31,0x3D,0xC0,0x3A,0x0A,0x29,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,0x10,0xC1,
+0x20,0xC4,0x9B,0xB7,0xC0,0xA3,0x5A,0x0C,0x6B,0x0C,0x13,0x1D,0x13,0x26,0xFE,0x00,0x20,0xC3,0x17,0x05,0xC9,0xA8,0x55,0x12,0x1A,0x18,0xC4,0x1A,0x25,0x18,0xC1,0x1A,
+0x15,0xFE,0x00,0x60,0x05,0x37,0xFE,0x65,0xA7,0x59,0xFE,0x09,0x81,0x05,0xCD,0x17,0x00,0x3D,0x7E,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,0xC1,0x0A,0x3D,0x05,0x31,
+0x3A,0xC0,0x29,0x3A,0xC0,0x05,0x3D,0x29,0x05,0x3A,0xC0,0x29,0x3A,0xC1,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC3,0x10,0xC0,0x1F,0x20,
+0xC4,0x2B,0x60,0x66,0xC1,0x2B,0x09,0x1D,0x59,0xA5,0x77,0x8B,0xAD,0x5A,0xCD,0xA8,0x55,0x12,0x1A,0x18,0xC1,0x1A,0x18,0xC3,0x97,0x9A,0xA6,0x88,0x18,0xC0,0x8A,0x9E,
+0xFE,0x01,0x60,0xA5,0xA9,0xB7,0x31,0x1A,0x96,0x9B,0x0F,0x05,0xCE,0x3C,0x35,0xFE,0xB1,0x81,0xC0,0x6E,0x3D,0x05,0x0A,0x05,0x0A,0xC1,0x05,0x0A,0x05,0x3A,0x3D,0x3A,
+0x61,0x05,0x0A,0x9D,0x99,0x3A,0x9D,0xA9,0x29,0x31,0x3A,0xC0,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC7,0x10,0xC0,0x1F,0x20,0xC4,0x2B,
+0x9D,0xB7,0x5B,0x0A,0xC0,0x0E,0xC0,0x6E,0x0E,0xB1,0x06,0x8D,0x8B,0x9C,0x8A,0xC4,0x6E,0x05,0xC1,0x17,0x05,0xC1,0x32,0xBA,0x20,0xFE,0x76,0x87,0x18,0xC3,0x1A,0x18,
+0xC3,0x97,0x9A,0x25,0x18,0xC0,0x99,0x9C,0xA4,0x87,0xA4,0x76,0x18,0x8F,0xAD,0x0F,0x05,0xCD,0x17,0x05,0xB2,0xE3,0x37,0x3D,0x7E,0xC1,0x6E,0x05,0x0A,0x05,0x0A,0x05,
+0x31,0x05,0x3A,0x05,0x31,0x3A,0x0A,0x05,0x0A,0x3A,0x31,0x05,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC8,0x0A,0x10,0xC0,0x7F,0x20,
+0xC4,0x2B,0x13,0x0E,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0x28,0x97,0x2A,0x97,0x9C,0xC4,0x17,0x05,0xC4,0xA6,0x87,0x2E,0x7A,0xC1,0xAF,0x54,0xAC,0x75,0x18,0xC4,0x1A,0x18,
+0xC0,0x3B,0xFE,0x22,0x84,0xAB,0x64,0x12,0xC0,0x13,0x97,0xAA,0x96,0xAC,0x96,0xCC,0x0F,0x05,0xC2,0x17,0x05,0xC9,0xB7,0x94,0xFE,0x89,0x40,0xA1,0xB9,0x37,0xA1,0xB8,
+0x56,0x05,0xC2,0x6E,0x05,0xC0,0x29,0xC1,0x7E,0x3D,0xC0,0x0A,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x31,0x3A,0xC0,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,
+0x3A,0xC0,0x33,0x3A,0xC1,0x0A,0x10,0xC0,0x1F,0x20,0xC4,0x99,0xC6,0x0E,0xC2,0x79,0xC0,0x0E,0xC0,0x13,0xAA,0x05,0x8F,0x8E,0xC2,0x17,0x05,0xC6,0xAB,0x55,0x9A,0xBA,
+0x17,0x05,0xC1,0x2B,0xB9,0x10,0xB1,0x74,0x18,0xC4,0x12,0xFE,0x00,0xA0,0x05,0xC2,0x6E,0x05,0xA8,0x55,0x05,0xCE,0x17,0x05,0x0D,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x6E,
+0xC0,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,0x3A,0x05,0xC0,0x29,0x05,0x3D,0x05,0xC2,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC7,
+0x0A,0xA8,0x77,0xC1,0x20,0xC4,0x99,0xC6,0x0E,0xC3,0x79,0xC0,0x0E,0xC0,0x00,0x8D,0x6A,0xCA,0x06,0x9D,0xAA,0x99,0xBB,0x0F,0x05,0xC2,0x17,0xB1,0x54,0xFE,0x6E,0x27,
+0x18,0x1A,0x18,0xC0,0x95,0xAD,0xFE,0x01,0x60,0x05,0xC5,0xA8,0x55,0x05,0xC3,0xA3,0x87,0x05,0xC9,0xA6,0x87,0xB3,0xA2,0x33,0x6B,0xC0,0xA1,0xA8,0xC0,0x6E,0x3D,0x05,
+0x0A,0x05,0x0A,0xC1,0x05,0x0A,0xC0,0x05,0x0A,0x05,0x0A,0x05,0x31,0x3A,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,0x10,0xC2,0x20,0xC4,
+0x13,0xC0,0x66,0xC4,0x79,0xC0,0x28,0x17,0xC1,0x9D,0x9A,0xC4,0x17,0x05,0xC0,0xAB,0x55,0x97,0xBB,0x05,0xC6,0xB4,0x42,0x0D,0x18,0xC0,0x2C,0x06,0x05,0xC3,0xA3,0x87,
+0x05,0xC0,0xA6,0x87,0x05,0xC2,0x17,0x05,0xCA,0xB0,0x95,0x35,0x31,0x3D,0x7E,0x31,0x05,0xC0,0x46,0x29,0x05,0x3D,0x05,0x6E,0xC0,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,
+0x3A,0x05,0x31,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC7,0x0A,0xA8,0x77,0xC0,0x1F,0xC0,0x20,0xC4,0x99,0xC6,0x0E,0xC2,0xBA,0x17,
+0x11,0x90,0xA5,0x8F,0xFD,0x9D,0xB7,0xAA,0x54,0x9B,0x1D,0x95,0x9B,0xC6,0x17,0x05,0xAB,0x55,0x9C,0x88,0x05,0xC4,0x17,0x05,0xC1,0xB8,0x21,0x1A,0x18,0xFE,0x23,0x03,
+0xFE,0x00,0x40,0x05,0xC1,0x17,0x05,0xC2,0xA6,0x87,0x0A,0x05,0xC4,0x17,0x05,0xC7,0xB7,0x94,0x37,0xA1,0xB8,0xC0,0x46,0x29,0x05,0x3D,0x05,0x6E,0xC1,0x05,0x0A,0x05,
+0x0A,0x05,0x0A,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x31,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC2,0x0A,0xA8,0x77,0xC1,
+0x1F,0xFE,0x61,0xE7,0xC4,0x13,0x0E,0xC2,0x21,0xB2,0x8C,0x1B,0x99,0x97,0x97,0x99,0x95,0x86,0x93,0x89,0x8B,0x9D,0xC7,0x17,0xA8,0x56,0x0F,0x05,0xC8,0x17,0xFE,0x54,
+0xE7,0x97,0x77,0x05,0xC2,0x17,0x05,0xC3,0xA8,0x55,0x05,0xC4,0x17,0x05,0xC7,0xAF,0x84,0x04,0xFE,0xA1,0x20,0x33,0x29,0x7E,0x5F,0xA1,0xA8,0xC0,0x0A,0x3D,0x05,0x0A,
+0x05,0x0A,0xC1,0x05,0x0A,0xC0,0x29,0x33,0x05,0xC0,0x3A,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,0xAA,0x86,0xC1,0x1F,0xC0,0x20,0xC4,
+0x2B,0x0E,0x79,0xC0,0x0E,0x21,0xB2,0x8C,0xC3,0x11,0xFE,0x10,0xA0,0x9C,0x8A,0xC4,0x6E,0x05,0xA8,0x55,0xC0,0x0F,0x05,0xC9,0xB3,0x33,0x37,0x05,0xC1,0x17,0x05,0xC4,
+0xAB,0x55,0x28,0x05,0xC5,0x17,0x05,0xC4,0xAB,0x86,0x35,0xFE,0xA9,0x40,0x3D,0x29,0xC0,0xA3,0x98,0xC0,0x6E,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC0,0x05,0x0A,0x05,0x0A,
+0x05,0x31,0x05,0x3A,0x05,0x31,0x3A,0xC0,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC7,0xAA,0x86,0x7F,0xC2,0xFE,0x61,0xE7,0xC4,0x2B,0x13,
+0x0E,0xC0,0x79,0x21,0xB2,0x8C,0xC3,0x9B,0x87,0xFE,0x3A,0x24,0x90,0x9C,0xC4,0x17,0x05,0xAB,0x55,0x99,0xAA,0x05,0xC2,0x6E,0x05,0xC1,0x17,0x05,0xC0,0xA8,0x55,0xFE,
+0x6D,0x69,0x15,0x0F,0x05,0xC2,0x17,0x05,0xC2,0xA6,0x87,0xA5,0x45,0x0A,0x0F,0x05,0xC3,0x17,0x05,0xC3,0x3F,0xB2,0xA2,0xFE,0xA1,0x60,0xA1,0xA9,0x56,0x05,0xC2,0x6E,
+0x05,0xC1,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC1,0x05,0x46,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x75,0x3A,0xC2,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,
+0x33,0x3A,0xC0,0xAA,0x86,0xC0,0x1F,0xC1,0x20,0xC4,0x13,0x0E,0xC2,0x21,0xB2,0x8C,0xC4,0x30,0x80,0x9B,0x5A,0xC4,0x17,0xA8,0x56,0x97,0xBB,0x05,0xC9,0x1D,0x1A,0x98,
+0x88,0x19,0x17,0x05,0xC2,0x17,0x05,0xC0,0xA8,0x55,0x19,0x10,0x0F,0x05,0xC9,0x17,0x00,0x9D,0xF3,0x3D,0x7E,0xC0,0x29,0x05,0x3D,0x05,0xC2,0x6E,0x05,0xC1,0x0A,0xC0,
+0x05,0x0A,0x05,0x0A,0x05,0x51,0x05,0x3A,0x05,0x31,0x3A,0xC1,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC4,0xA5,0x78,0xA5,0xA7,0xC1,0x1F,
+0xC0,0x20,0xC4,0x2B,0x0E,0xC0,0x79,0xC0,0xFE,0x9C,0xF1,0xB8,0x8A,0xC4,0x97,0x85,0xFE,0x29,0x83,0x95,0x9B,0xC4,0x03,0x5C,0x05,0xC9,0x2A,0xFE,0x65,0xA7,0x18,0xC0,
+0xFE,0x22,0xC2,0x05,0xC2,0x17,0x05,0xC0,0x37,0x19,0x9D,0xAA,0x03,0x9B,0x98,0x05,0xC8,0xA5,0x87,0xB3,0x85,0xFE,0x8A,0x21,0x9A,0xFB,0x7E,0x29,0xA2,0x77,0x29,0x7E,
+0xA3,0x88,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC2,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC0,0x29,0x33,0x29,0x31,0x3A,0x29,0x3A,0xC4,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,
+0x33,0x3A,0xC0,0x33,0x3A,0x24,0x10,0xC0,0x1F,0xC1,0xFE,0x61,0xE7,0xC4,0x9B,0xB7,0x0E,0xC1,0x79,0xBA,0x08,0xBE,0x6B,0xC4,0x1B,0x30,0x80,0x9B,0x5A,0xC1,0x17,0x05,
+0x16,0x05,0xCA,0xFE,0x3C,0x62,0xAE,0x75,0x18,0xC0,0x95,0xAD,0xFE,0x00,0x60,0x05,0xC4,0xAB,0x55,0x0F,0x05,0xC0,0xA8,0x55,0x05,0xC5,0x17,0x05,0xA6,0x87,0x00,0x9D,
+0xF3,0x29,0xC1,0x7E,0x3D,0xC0,0xA2,0x87,0xC0,0x66,0x0A,0x05,0x0A,0x05,0x0A,0xC3,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,0x46,0x05,0x31,0x3A,0xC2,0x5A,0x33,0xC5,0x3A,
+0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC3,0x0A,0xA8,0x77,0xC1,0x1F,0xC0,0x20,0xC4,0x13,0x66,0xC2,0xB3,0x34,0xFE,0xE7,0x5B,0xC0,0xA3,0x87,0xA2,0x87,0xA0,
+0x9C,0xC1,0x97,0x85,0xFE,0x31,0xA5,0x94,0x89,0xC1,0x17,0x05,0xAB,0x55,0x19,0x05,0xC1,0x17,0x05,0xC4,0x0C,0xFE,0x6E,0x27,0x18,0xC1,0x0D,0xFE,0x09,0x81,0x96,0xCC,
+0x6E,0x05,0xC1,0x03,0x0F,0x05,0xC1,0x10,0x0F,0x05,0xC5,0x3F,0xAE,0x85,0xFE,0x8A,0x21,0x9A,0xFB,0x7E,0xC0,0x29,0x3D,0x3A,0xA2,0x97,0xC0,0x3D,0x05,0x0A,0x05,0x0A,
+0x05,0x0A,0x05,0x0A,0xC4,0x05,0x0A,0x05,0x29,0xA2,0x77,0x29,0x7E,0x3A,0x29,0x3A,0xC5,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0xAA,0x87,0xC0,
+0x1F,0xC2,0x20,0xC4,0x13,0x0E,0xC4,0x7E,0xAB,0x56,0x35,0x1C,0xC0,0xA7,0x7C,0xC0,0x00,0x8D,0x6A,0xC3,0xAA,0x66,0x97,0xAA,0xC0,0x05,0xC1,0x17,0x05,0xC3,0xFE,0x5C,
+0xE8,0x18,0xC1,0x1A,0x18,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0xC1,0xAB,0x55,0x9D,0x99,0x05,0xC2,0x37,0xC0,0x0F,0x05,0xC3,0xAB,0x86,0x35,0xFE,0x99,0x61,0x33,0x3A,
+0x33,0xA1,0xA9,0x31,0x29,0x05,0x6E,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC5,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,0x3A,0x05,0x31,0x3A,0xC3,0x37,0x33,0xC5,0x3A,0x33,0xC0,
+0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC2,0xAA,0x86,0xC0,0x1F,0xC2,0xFE,0x61,0xE7,0xC4,0x2B,0x0E,0xC2,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC0,0x0A,0xC0,0x09,0x99,0x5F,
+0x97,0x59,0xC1,0x17,0xA8,0x56,0x0F,0x05,0xC1,0x17,0x05,0xC3,0x3F,0xFE,0x76,0x09,0x18,0xC3,0x94,0x8B,0xFE,0x00,0xA0,0x05,0xC0,0xA8,0x55,0xC0,0x0F,0x05,0xC3,0xAA,
+0x66,0x97,0xAA,0xC0,0x05,0xC1,0xB0,0x94,0x28,0xFE,0x99,0x61,0x3D,0x7E,0xC1,0x29,0xC0,0x33,0x29,0x31,0x3A,0x05,0xC1,0x6E,0x3D,0x05,0x0A,0x05,0x0A,0xC1,0x05,0x0A,
+0xC1,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x31,0x3A,0xC3,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x24,0xA5,0xA7,0xC0,0x1F,0xC2,0x20,0xC4,0x2B,
+0x13,0x0E,0xC1,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0xC0,0xA6,0x2B,0x98,0x46,0x9C,0x8A,0xC1,0xAB,0x55,0x0F,0x05,0xC7,0x32,0x1A,0x18,0xC3,0x2C,0xFE,0x01,0x60,
+0x0F,0x07,0x9D,0x79,0x9A,0xBB,0x05,0xC1,0x0A,0x05,0xC0,0x03,0x5C,0x05,0xC0,0xAB,0x86,0x00,0x9D,0xF3,0x29,0x3D,0xA2,0x87,0x66,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,
+0x0A,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC6,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x31,0x3A,0xC4,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x24,0xA6,
+0xA7,0xC4,0xFE,0x61,0xE7,0xC4,0x13,0x0E,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0x0A,0x0E,0xC0,0x0A,0xAA,0x09,0x08,0x5A,0xC0,0x10,0x97,0xBB,0x05,0xC7,0xFE,
+0x55,0x25,0x1A,0x18,0xC4,0xFE,0x0A,0xA0,0x06,0x9D,0xAA,0x99,0xBB,0x0F,0x05,0xC3,0x17,0x05,0x10,0x9E,0xB8,0x00,0x04,0xFE,0xB1,0x81,0xC0,0x29,0xC0,0x05,0xC0,0x6E,
+0x3D,0x3A,0x29,0xC0,0x31,0xC0,0x29,0x05,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC6,0x05,0x3D,0x29,0x05,0x3A,0xC0,0x29,0x3A,0xC2,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,
+0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC1,0xAA,0x86,0xC0,0x1F,0xC3,0x20,0xC4,0x13,0x66,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0x0A,0xC0,0x0E,0xC0,0x13,0x1E,0x97,
+0x3B,0xC0,0x03,0x9A,0x98,0x05,0xC1,0x0A,0x05,0xC2,0xAF,0x54,0x0D,0x18,0x1A,0x18,0xC3,0xFE,0x23,0x41,0x0F,0x05,0xC8,0xAB,0x86,0x00,0x37,0x33,0x3A,0x33,0x29,0xC0,
+0xA3,0x98,0x3D,0x29,0x05,0x3A,0xC0,0x29,0x3A,0xC2,0x05,0x3D,0x05,0xC2,0x6E,0x05,0xC1,0x0A,0xC1,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x75,0x3A,0xC5,0x37,0x33,
+0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0x10,0xC0,0x1F,0xC3,0xFE,0x61,0xE7,0xC4,0x2B,0x0E,0xC3,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0xC0,0x0A,0x26,0x97,
+0x59,0xAB,0x55,0x0F,0x05,0xC6,0xBF,0x20,0xFE,0x76,0x87,0x18,0xC4,0x1A,0x39,0x19,0x05,0xC2,0x17,0x05,0xC3,0xA8,0x55,0x0C,0xFE,0x99,0x61,0x33,0x3A,0x33,0x29,0xC3,
+0x31,0x3D,0xC0,0x31,0x3A,0xA2,0x97,0x29,0x3D,0x3A,0xA1,0xA8,0x3D,0x05,0xC2,0x0A,0x05,0xC1,0x0A,0xC0,0x29,0xC1,0x31,0x3D,0xC0,0x31,0x3A,0x37,0x33,0xC5,0x3A,0x33,
+0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xAA,0x86,0xC0,0x7F,0xC3,0x20,0xC4,0x2B,0x13,0x0E,0xC2,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0xC1,0xAC,0x55,
+0x96,0x4A,0xA3,0x38,0x0F,0x62,0xC5,0xA5,0x87,0xFE,0x65,0xA7,0x18,0x1A,0x18,0xC4,0x97,0x9A,0xFE,0x01,0x00,0x05,0xC6,0x17,0x05,0xC0,0x10,0xFE,0x8A,0x21,0x3D,0x29,
+0xC1,0x31,0x3D,0xC0,0x31,0x3A,0x31,0x3A,0x9D,0xA9,0x29,0xA4,0x87,0x66,0x0A,0x05,0x0A,0x05,0x0A,0xC6,0x05,0x3D,0x3A,0x29,0xC0,0x31,0xC0,0x29,0x3A,0x37,0x33,0xC5,
+0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC6,0xAA,0x86,0x1F,0xC4,0x20,0xC4,0x13,0x0E,0xC0,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0xC2,0x0A,0xC0,
+0x0E,0xAC,0x55,0x9E,0x19,0x90,0x9C,0xC5,0x17,0xA8,0x56,0xFE,0x76,0x09,0x18,0xC6,0x99,0x9C,0xFE,0x09,0x81,0x96,0xCC,0x6E,0x05,0xC4,0x17,0x05,0xC0,0xA6,0x87,0xAD,
+0x85,0xFE,0xAA,0x03,0x3D,0x5A,0x29,0xC0,0x31,0xC0,0xA3,0x88,0xC0,0x66,0xC0,0x3A,0x29,0x05,0x0A,0xC0,0x05,0x3A,0x0A,0x05,0xC1,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x31,
+0x05,0x3A,0x05,0x31,0x3A,0xC4,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC3,0xAA,0x86,0x1F,0xC3,0x10,0x20,0xC4,0x13,0x0E,0x79,0xC0,0x0E,
+0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0xC3,0x0A,0xC0,0x0E,0xC0,0x09,0x9C,0x15,0x98,0xBB,0xC5,0x32,0x1A,0x18,0xC6,0x1A,0xFE,0x22,0x84,0x05,0xC3,0x17,0x05,0xC4,0x2A,0xFE,
+0x8A,0x21,0x3D,0x7E,0xC0,0x29,0x3D,0x31,0x3A,0x9D,0xA9,0x29,0x31,0x3A,0xC0,0xA2,0x97,0x05,0x3A,0x3D,0x3A,0x29,0xC0,0x3A,0xC0,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x31,
+0x05,0x3A,0xC0,0x5A,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC9,0xA5,0x78,0x1F,0xC3,0x10,0x0A,0x20,0xC4,0x9B,0xB7,0x13,0x0E,0xC2,0x79,0x0E,
+0x0A,0x0E,0xC0,0x0A,0x0E,0x0A,0xC0,0x0E,0xC0,0x13,0x0E,0xC0,0x2B,0x07,0x96,0xAC,0xC1,0x17,0x05,0xC1,0x1C,0x18,0xC0,0x1A,0x18,0xC5,0xFE,0x22,0xC2,0x05,0xCA,0xA5,
+0x88,0x1D,0x31,0x3A,0xA2,0x97,0x66,0x0A,0x3A,0x31,0x29,0xC1,0x31,0x3D,0xC0,0x31,0x3A,0x31,0xC0,0x3A,0x9D,0xA9,0x29,0x31,0x3A,0xC0,0x0A,0x29,0xC1,0x31,0x3D,0xC0,
+0x31,0x3A,0x31,0xC0,0x3A,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xA5,0x78,0x1F,0x10,0xC0,0x1F,0xC1,0x37,0x20,0xC4,0x2B,0x0E,0xC4,
+0x79,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0xC3,0xFE,0x29,0x81,0x95,0x9D,0xC4,0x17,0xFE,0x6D,0x69,0x18,0xC5,0x1A,0x18,0xC0,0x3B,0xFE,0x00,0x60,0x05,0xCA,0x2A,
+0x25,0x3A,0x37,0xA1,0xB8,0xC1,0x3A,0x29,0xC2,0x31,0x6F,0xC0,0x31,0x3A,0x31,0xC0,0x3A,0x29,0xC0,0x05,0xC0,0x6E,0x3D,0x29,0x33,0x29,0x31,0x3A,0x29,0x3A,0xC6,0x37,
+0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC1,0x10,0xC1,0x1F,0xC2,0x95,0x4B,0x20,0xC4,0x2B,0x0E,0xC4,0x79,0x0E,0x0A,0x0E,0xC0,0x0A,0x0E,0xC0,
+0x0A,0xC0,0x0E,0xC0,0x13,0x0E,0xFE,0x3A,0x01,0x91,0x9F,0xC2,0x17,0x05,0xAB,0x55,0x19,0x18,0xC7,0x1A,0x90,0x9B,0xFE,0x00,0xA0,0x05,0xC3,0x17,0x05,0xC4,0x10,0x1D,
+0x31,0x29,0xC1,0x31,0x3D,0xC0,0x31,0x29,0xC1,0x31,0x3D,0xC0,0xA2,0x87,0xC0,0x66,0x3D,0x29,0xC0,0x33,0x05,0xC0,0x0A,0x3D,0x29,0x31,0x3A,0x9D,0xA9,0x29,0x31,0x3A,
+0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xAA,0x86,0xC1,0x1F,0xC1,0x0A,0x16,0x20,0xC4,0x2B,0x0E,0xC4,0x79,0x0E,0x0A,0xC0,0x0E,
+0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0xC1,0x1E,0x9C,0x29,0x17,0x9D,0x9A,0xC2,0xB4,0x42,0x0D,0x18,0xC1,0x1A,0x18,0xC4,0x97,0x9A,0xFE,0x01,0x00,0x05,0xC1,0xA3,0x87,0x05,
+0xC7,0xAF,0x84,0xFE,0x8A,0x21,0x3D,0x29,0x3D,0x5A,0x29,0xC0,0x31,0xC0,0x29,0x3A,0x29,0xC1,0x31,0x3D,0xC0,0x31,0x3A,0x31,0xA3,0x88,0x66,0x0A,0x05,0x0A,0x05,0x31,
+0x05,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC8,0x10,0x1F,0xC3,0x98,0x68,0x99,0x5B,0x20,0xC4,0x9B,0xB7,0x0E,0xC4,0x0A,0x0E,
+0xC0,0x0A,0xC0,0x0E,0xC0,0x13,0x0E,0xC1,0x0A,0x0E,0xC0,0x2B,0x07,0x96,0xAC,0xC3,0xFE,0x43,0xE6,0x1A,0x18,0xC3,0x1A,0x18,0xC2,0x99,0x9B,0x28,0x05,0xC7,0x17,0x05,
+0xC1,0x32,0xFE,0x7A,0x21,0x29,0x33,0xA1,0xA9,0xC0,0x3A,0x29,0xC1,0x31,0x3D,0x24,0x29,0x24,0x29,0x24,0x29,0x33,0x05,0xC0,0x6E,0x3D,0x0A,0xC0,0x05,0x0A,0x05,0x3A,
+0x3D,0x3A,0x29,0xC0,0x3A,0xC1,0x31,0x3A,0xC6,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x1F,0xC3,0x10,0x95,0x6A,0x9D,0x6A,0xBB,0x67,0xC0,0x9D,0x92,0xFE,0x31,
+0xA6,0xFE,0xF7,0xFA,0xC0,0x9D,0x98,0x90,0x86,0x84,0x8B,0x91,0x9D,0xC0,0xFE,0x8C,0x6C,0xB4,0x77,0x8A,0x89,0x89,0x9A,0x0B,0xC2,0x34,0x87,0x89,0x88,0x9C,0xA4,0x98,
+0x34,0xA6,0x99,0x91,0x98,0xB1,0x89,0x0B,0x0E,0xC1,0x9D,0x88,0x89,0x88,0x81,0x9D,0xB7,0x99,0xFE,0xF7,0xF9,0x0E,0xFE,0x5B,0x8C,0xC1,0x93,0xB7,0x01,0xC1,0x8C,0xA6,
+0x01,0xC0,0x9D,0x99,0x88,0xA9,0xBA,0x67,0x6D,0x98,0xA7,0x05,0xAE,0x77,0xA3,0x89,0x9D,0xA6,0x05,0xA7,0xF6,0xFE,0xDE,0xF8,0xFE,0x4A,0x25,0x32,0x96,0x9F,0x07,0xC0,
+0xA3,0x78,0xC0,0x5A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC2,0xFE,0x51,0x42,0xFE,0x99,0x61,0x07,0xA2,0x78,0x1D,0xC8,0x1A,0x1D,0x1A,0x1D,0xC1,0xFE,0x61,0x43,0xFE,0xA1,
+0x60,0xFE,0x3A,0x24,0x99,0xDC,0xFE,0xD6,0xD7,0x88,0x76,0xBF,0xA9,0x0B,0xC2,0x0E,0x0B,0xC0,0x9A,0x99,0x88,0x89,0x86,0x8A,0x05,0x30,0x0B,0xC1,0x3D,0xFE,0x31,0xA5,
+0x05,0xC1,0xA3,0x87,0xA6,0x98,0x05,0xC4,0x17,0x05,0xC8,0x3A,0xB2,0x74,0x36,0x42,0x36,0x26,0x36,0x6B,0xC0,0x07,0xC1,0x27,0x1D,0xC0,0xFE,0xEF,0x98,0x0B,0xC4,0x0C,
+0x83,0x79,0x89,0x9A,0x36,0x26,0x05,0xFE,0xBD,0xD4,0x0B,0xC4,0x88,0x9B,0x81,0x89,0x05,0xC4,0x17,0x05,0xC0,0x3A,0x05,0xCC,0x06,0xA3,0x99,0x3D,0xC0,0x07,0x02,0x3D,
+0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC7,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0x9D,0xA8,0xA0,0xA9,0xA0,0xC6,0x97,0x2A,0xFE,0x69,0x01,0x05,0xC2,0xA8,0x55,0xC1,0x0F,
+0x05,0xC7,0x17,0x05,0xC6,0x13,0x06,0x3D,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x18,0x3D,0xC3,0x20,0x1E,0x2B,0x9D,0xB7,0xA3,0xB7,0xA1,0xA9,0x71,0xFE,0x63,0x25,
+0x05,0xCA,0x17,0x05,0xC1,0xB3,0x84,0x9C,0x6C,0x3D,0xC0,0x07,0x3D,0xC0,0x20,0xA0,0xA8,0x1E,0x2B,0x9E,0xB6,0x25,0x37,0xC0,0x79,0x6B,0x33,0xA1,0xA9,0x51,0x3A,0x9D,
+0xA9,0x29,0x31,0x13,0xC0,0xA0,0x8A,0x79,0x13,0xC3,0x1D,0x13,0xC1,0xA7,0x87,0x90,0x79,0x0F,0x62,0xC6,0x17,0x05,0xC3,0xFE,0x5C,0xE8,0xAA,0x52,0xA3,0x86,0xC1,0x67,
+0x9A,0x8A,0xFE,0x0A,0x00,0x05,0xC0,0xB8,0x10,0xFE,0x55,0x63,0xA6,0x88,0xA4,0x77,0x18,0x06,0x98,0x9B,0x1A,0x18,0x0E,0xA4,0x88,0x18,0x1A,0x18,0x0E,0x0F,0x05,0xAB,
+0x55,0x9C,0x88,0x05,0xC1,0x17,0x05,0xC7,0xAF,0x84,0x2B,0x9D,0xB7,0x25,0x37,0xC0,0x33,0x76,0xA2,0x88,0xC1,0x6E,0x05,0x56,0x05,0xC2,0x3D,0x05,0xC2,0x0A,0x05,0xC0,
+0x0A,0x05,0x31,0x05,0x33,0xFE,0x3A,0x24,0x90,0x9C,0xC5,0x17,0x05,0xC5,0xA5,0x87,0xFE,0x76,0x09,0x18,0x1A,0x18,0xC3,0x2C,0xFE,0x09,0x81,0x96,0xCC,0xB7,0x32,0x1A,
+0x18,0xC0,0x99,0x9B,0x0D,0x18,0x2C,0x06,0x05,0xC0,0xBF,0x20,0xFE,0x76,0x87,0x18,0x8F,0xAD,0x05,0xC1,0x10,0x0F,0x05,0xC2,0x17,0x05,0xC4,0xB2,0xE3,0x3D,0x17,0x1C,
+0x18,0x1A,0x18,0xC4,0x99,0x9C,0x06,0x9D,0xAA,0x36,0x18,0x1A,0x18,0xC1,0x25,0x8D,0xBE,0xFE,0x01,0x00,0x05,0xC0,0xA6,0x87,0xB9,0x21,0xFE,0x55,0x63,0xFE,0x00,0xA0,
+0x05,0xC1,0x10,0x0F,0x66,0x29,0x28,0x05,0xC1,0x10,0x0F,0x05,0xC2,0xAA,0x66,0x28,0x05,0xC0,0xA5,0x88,0x10,0x37,0xC0,0x0F,0x05,0xC0,0x15,0x28,0xA3,0xA8,0xA5,0x57,
+0x06,0x37,0x24,0x37,0x0A,0x05,0xC4,0x17,0x05,0xCA,0x2B,0x0E,0x18,0xC4,0x1A,0x18,0x97,0x9A,0x0D,0x18,0xC4,0x1A,0x18,0xC3,0xFE,0x22,0x84,0x05,0x32,0x2B,0x17,0x05,
+0xC0,0x19,0xAB,0x75,0xFE,0x76,0x09,0x18,0x1A,0x18,0xC4,0x0A,0xA6,0x88,0x18,0xC1,0x1A,0x18,0xC4,0x8A,0x9E,0x05,0xAF,0x44,0x9C,0x88,0x37,0x2B,0x0F,0x05,0x37,0x32,
+0x10,0x37,0x06,0x37,0x99,0xBB,0x0F,0x05,0xC3,0x1D,0x2B,0xFE,0x44,0xC5,0x1F,0x18,0x1A,0x18,0xC3,0x97,0x9A,0x1A,0x18,0xC0,0x1A,0x18,0x0D,0x36,0x25,0x0A,0x9D,0x8A,
+0x29,0x13,0x10,0x06,0xC0,0x37,0x06,0x37,0x24,0x37,0x17,0x06,0x37,0x06,0x15,0x97,0xAA,0xC0,0x05,0xC2,0xAB,0x86,0xA9,0xF5,0xA4,0x19,0x18,0x37,0x36,0x25,0xA4,0x87,
+0x0D,0x95,0x99,0x0D,0x18,0xC2,0x1A,0x18,0xC5,0x25,0x13,0xA9,0x88,0x9C,0xBA,0x97,0x8A,0x0A,0x6E,0x05,0xA7,0x55,0xC0,0x32,0x37,0xC1,0x0F,0x05,0xA7,0x85,0x18,0xC0,
+0x25,0xFE,0x1A,0xC1,0x37,0x13,0x5A,0x0A,0x05,0xC1,0xA3,0x87,0x05,0xC5,0xB3,0xB7,0x3D,0x7E,0x3D,0x51,0x05,0x46,0xC0,0x36,0x12,0x13,0x37,0xA7,0x66,0x0C,0x8D,0xEE,
+0xCA,0xB0,0x74,0xFE,0x8A,0xC5,0xFE,0xB1,0x81,0xC2,0x3A,0x29,0x3D,0xFE,0x00,0x20,0xC1,0xAF,0x54,0xB7,0x31,0x9F,0x74,0x0D,0x18,0x25,0x50,0x25,0x0E,0x24,0x0D,0x0A,
+0xFE,0x00,0x40,0xAA,0x55,0xB3,0x42,0x0D,0xA4,0x76,0x98,0x9B,0x1A,0x18,0xC0,0x0D,0x36,0x1A,0x36,0x9E,0x75,0xFE,0x2B,0x24,0x0C,0x0A,0x1F,0x18,0xC1,0x0A,0xA6,0x88,
+0x18,0xC2,0x1A,0x18,0x36,0xFE,0x4A,0x25,0x1E,0x13,0xC0,0x69,0x13,0x1D,0x13,0x22,0x05,0xC3,0x17,0x05,0xC9,0x37,0xFE,0x3C,0x62,0x1A,0x18,0xC4,0x1A,0x25,0x18,0xC1,
+0x1A,0x87,0xBF,0x0F,0x05,0x37,0x36,0x2C,0xFE,0x09,0x81,0x05,0xCD,0x17,0x00,0x3D,0x7E,0xC0,0xFE,0x7A,0x64,0x92,0x2B,0x9C,0x8A,0xC4,0x6E,0x05,0xC1,0x17,0x05,0xC1,
+0x32,0xBA,0x20,0xFE,0x76,0x87,0x18,0xC3,0x1A,0x18,0xC3,0x97,0x9A,0x25,0x18,0xC0,0x99,0x9C,0x0D,0x24,0x18,0x8B,0xBF,0xFE,0x12,0x02,0x31,0x2E,0x05,0xC0,0x37,0x05,
+0xCE,0x17,0x05,0xB7,0x94,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x6E,0xC0,0x05,0x0A,0x05,0x0A,0x05,0x51,0x05,0x3A,0x05,0xC0,0x29,0x05,0x3D,0x05,0xC2,0x3A,0xC1,0x37,0x33,
+0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC6,0x29,0xAC,0x76,0x92,0x2C,0xC8,0xBA,0x17,0xA6,0x69,0x13,0xA5,0x77,0x8C,0x8C,0xAA,0x55,0x0F,0x62,0xC0,
+0xA8,0x55,0x05,0xC5,0x17,0x05,0xA6,0x87,0x00,0x9D,0xF3,0x29,0xC1,0x31,0x3D,0xC0,0xA2,0x87,0xC0,0x66,0x0A,0x05,0x0A,0x05,0x0A,0xC3,0x05,0x0A,0x05,0x0A,0x05,0x45,
+0xFE,0x11,0x03,0x9B,0x98,0x62,0xC1,0x10,0x0F,0x05,0xC4,0x6E,0x3F,0x36,0xFE,0x8A,0x21,0x3D,0x7E,0xC0,0x29,0x3D,0x5A,0xA2,0x97,0xC0,0x3D,0x05,0x0A,0x05,0x0A,0x05,
+0x0A,0x05,0x0A,0xC4,0x05,0x0A,0x33,0xFE,0x61,0xE7,0x28,0x35,0xA5,0x68,0xC0,0xA7,0x7C,0xC0,0x00,0x8D,0x6A,0xC3,0xAA,0x66,0x97,0xAA,0xC0,0x05,0xC1,0x17,0x05,0xC3,
+0xFE,0x5C,0xE8,0x18,0xC1,0x1A,0x18,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0xC1,0x10,0x37,0x05,0xC2,0x37,0xC0,0x05,0xC4,0xAB,0x86,0x35,0xFE,0x99,0x61,0x31,0x05,0xC1,
+0x17,0x10,0x0F,0x05,0xC1,0x17,0x05,0xC2,0x0A,0x3F,0x19,0x18,0xC3,0x94,0x8B,0xFE,0x00,0xA0,0x05,0xC0,0xA8,0x55,0xC0,0x0F,0x05,0xC2,0x0A,0xA5,0x98,0x05,0xC1,0x10,
+0x0A,0x05,0xC7,0xFE,0x43,0xE6,0x1A,0x18,0xC3,0x2C,0xFE,0x01,0x60,0x0F,0x07,0x9D,0x79,0x05,0xC2,0x0A,0x05,0xC0,0xFE,0x55,0x25,0x1A,0x18,0xC4,0xFE,0x0A,0xA0,0x10,
+0x9D,0x99,0x0A,0x0F,0x05,0xC3,0x17,0x05,0x10,0x9E,0xB8,0x00,0x04,0xFE,0xB1,0x81,0xC0,0x29,0xC0,0xFE,0x76,0x09,0x18,0x1A,0x18,0xC3,0x15,0x0F,0x62,0xC8,0x20,0x00,
+0xFE,0x99,0x61,0x33,0x6B,0x33,0x29,0x3D,0xFE,0x6D,0x69,0xFE,0xA9,0x61,0x31,0xA1,0x3A,0x3A,0x37,0xA1,0xB8,0xC1,0x3A,0x29,0xC2,0x31,0x3D,0xC0,0x31,0x3A,0x31,0xC0,
+0x3A,0x29,0xC0,0x05,0xC0,0x6E,0x3D,0x29,0x33,0x29,0x31,0x3A,0x29,0x3A,0xC6,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC1,0xAA,0x86,0xC1,
+0x7F,0xC2,0x92,0x3A,0x4B,0xFE,0x3A,0x01,0x91,0x9F,0xC2,0x17,0x05,0xAB,0x55,0x19,0x18,0xC8,0xFE,0x00,0x40,0xAE,0x84,0xFE,0x8A,0x21,0x3D,0x31,0x0A,0x05,0xC2,0x1D,
+0x1A,0x18,0xC3,0x1A,0x18,0xC2,0x97,0x9A,0x28,0x05,0xC7,0x17,0x05,0xC1,0x07,0xBB,0x67,0x6D,0x6C,0xC3,0xA0,0xA9,0x31,0x3A,0x31,0x3E,0x3C,0x89,0xA8,0xC4,0xA4,0x86,
+0xA4,0x89,0xA5,0x87,0xA0,0xA9,0xA8,0x66,0xA4,0x68,0x0F,0x56,0xFE,0x60,0xE1,0xFE,0x4A,0xA4,0x9D,0x7D,0xC1,0x52,0xA2,0x77,0xC2,0x1D,0xC0,0x1A,0x1D,0xC6,0x1A,0x1D,
+0x1A,0x10,0xC0,0x1D,0xC0,0x10,0xC0,0x1D,0xC3,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC5,0xFE,0x69,0x01,0xFE,0x00,0x40,0x66,0xC1,0xAB,0x86,0x50,0x17,0x9D,0x9A,0xC1,
+0x17,0x05,0xD3,0xA6,0x87,0x0F,0x9B,0x69,0x1D,0x9B,0xBA,0xAF,0x66,0xB1,0xB7,0x80,0x8B,0x3C,0x6E,0xCF,0x8C,0xA6,0x9B,0x8B,0x05,0xC2,0x17,0x05,0xC6,0xB5,0x84,0xFE,
+0xF7,0xB9,0xA2,0x78,0x7A,0xC1,0x0B,0xC0,0x0E,0x21,0x96,0x87,0xBC,0x77,0x0B,0x0E,0x9D,0x88,0x89,0x88,0x31,0x0F,0x05,0xC3,0x17,0x05,0xCE,0x06,0xA7,0x86,0x97,0x9E,
+0xA6,0x78,0xC0,0xA3,0x88,0x3C,0x51,0x01,0x3C,0xC0,0x01,0x3C,0x01,0xC4,0x28,0x05,0xC7,0x17,0x05,0xC3,0xAF,0x87,0x2B,0x0B,0xC0,0x9A,0x99,0x95,0x9A,0x36,0xC0,0x37,
+0xA9,0x88,0x21,0xAA,0x76,0x21,0x0B,0xC0,0x2B,0x89,0x88,0x80,0x9C,0x05,0xC1,0x17,0x05,0xD0,0xA5,0x87,0xB3,0x85,0xA3,0x7B,0x98,0xA7,0x05,0xC2,0x17,0x05,0xC8,0xA9,
+0x97,0x0C,0x9B,0x77,0x8B,0xAC,0x13,0xA4,0x5A,0x3C,0x64,0x42,0x9A,0x99,0x29,0x9C,0x96,0x34,0xA8,0x89,0xC0,0x0E,0x96,0x76,0xFE,0x4A,0x85,0x9D,0x7C,0x9E,0xA6,0x05,
+0xC2,0x17,0x05,0xC8,0xA6,0x87,0xB7,0x74,0xAD,0x9B,0xAB,0x98,0xA6,0x86,0x0B,0x6B,0x0B,0xC0,0x9C,0x89,0x3D,0x0C,0x0B,0xC1,0x9A,0x99,0x29,0xAB,0x95,0x8F,0x9B,0x31,
+0x05,0xC5,0x17,0x05,0xC5,0xA5,0x87,0x21,0x19,0xA4,0x87,0x0B,0xC0,0x0E,0x12,0x0B,0xC3,0x0E,0x12,0x88,0x9A,0x0C,0x0B,0x0F,0x9F,0x7C,0xA2,0x97,0x33,0x0C,0xA7,0x88,
+0x7E,0x11,0xB4,0x9B,0x54,0x0C,0x33,0x9A,0x87,0xB8,0x87,0x33,0x1B,0x31,0xC1,0x0C,0x86,0x78,0x39,0x91,0xAF,0xFE,0xEF,0x98,0x3D,0x21,0xA5,0x78,0xA2,0x8A,0x0C,0x3A,
+0xA2,0x78,0xC0,0x0E,0x96,0x76,0x0B,0x04,0x2A,0x2B,0x0B,0xC2,0x8F,0xA8,0x1F,0x9C,0x8A,0xC2,0x17,0x05,0xCD,0x36,0x20,0xC0,0x9F,0x8B,0xA2,0x97,0xA4,0x89,0xCB,0x36,
+0x1D,0x9B,0xFA,0x5A,0xC0,0x09,0x06,0xA2,0x98,0x06,0x09,0x1D,0xC1,0x09,0xC0,0x1D,0x09,0xC0,0x06,0x1D,0x06,0x09,0x1D,0xC0,0xA5,0x77,0x96,0x68,0x05,0xC1,0x17,0x05,
+0xCC,0xB3,0x84,0x2B,0x0B,0xC6,0x0E,0x12,0x34,0x3A,0x0B,0xC0,0x0E,0x12,0x3A,0x0B,0xC0,0x93,0x89,0x20,0x05,0xC4,0x17,0x05,0xCB,0x22,0xC0,0x25,0xCE,0x07,0xC0,0xA3,
+0x78,0xC0,0x1A,0x1D,0x1A,0x1D,0xC3,0x1A,0x1D,0xC2,0xFE,0x51,0x42,0xA0,0xF6,0xA5,0x0D,0x94,0x37,0xAD,0x95,0x9D,0x9D,0xA5,0x67,0xC0,0x1A,0x1D,0xC4,0x1A,0x1D,0xC7,
+0x10,0x1D,0x98,0xC9,0x13,0x3A,0x0F,0x05,0xC2,0x17,0x05,0xCC,0xB8,0x73,0x2B,0xA3,0x89,0xC7,0x34,0x9B,0x8A,0x2B,0xA3,0x89,0xC2,0x21,0x17,0xC1,0x05,0x16,0x05,0xC3,
+0x17,0x05,0xCA,0x13,0x22,0x07,0x3E,0x2B,0x0B,0xC4,0x0C,0x29,0x89,0x9A,0x36,0xAB,0x68,0xA3,0x99,0x0B,0xC0,0x2A,0xFE,0x4A,0x86,0x05,0xC3,0xAB,0x86,0x05,0xCF,0xB0,
+0x74,0x13,0x3D,0x07,0x66,0x3D,0x07,0x3D,0x36,0x3D,0xC0,0x36,0x15,0x26,0x36,0x26,0x3D,0x07,0x02,0x3D,0x07,0x1D,0xC0,0x18,0x10,0x1A,0xC1,0x1D,0xC2,0x1A,0x1D,0xC1,
+0xFE,0x81,0x62,0xA0,0xC7,0xFE,0x6B,0xAB,0x37,0x0C,0x0B,0x2B,0x0B,0x2A,0xA2,0x97,0x12,0x2B,0x0B,0xC0,0x0C,0x83,0x79,0x3D,0xC3,0x07,0x02,0x3D,0x9D,0xA8,0x1E,0xA0,
+0xA9,0x9E,0xB6,0xFE,0x00,0x20,0xC0,0xAB,0x86,0x37,0x0B,0xC4,0x33,0x81,0x89,0x05,0xC4,0x17,0x05,0xC0,0x15,0x05,0xCC,0x06,0x22,0x3D,0xC0,0x07,0x02,0x3D,0x07,0x3D,
+0x36,0x3D,0xC0,0x18,0x3D,0xC7,0x07,0x02,0x3D,0x07,0x3D,0x36,0x3D,0x9D,0xA8,0xA0,0xA8,0x1E,0x9D,0xD8,0x35,0x25,0xA1,0xB9,0x5A,0x79,0xFE,0x09,0x81,0x9C,0x99,0xC0,
+0xA4,0x88,0x30,0x34,0xA8,0x9A,0x0B,0x97,0x9A,0x29,0x05,0xC3,0x17,0x05,0xC3,0x3F,0x05,0xC2,0x17,0x05,0xC6,0xAE,0x85,0xA7,0x87,0x97,0x9D,0x07,0x02,0x3D,0x07,0x3D,
+0x69,0x3D,0xC0,0x18,0x3D,0xC8,0x07,0x02,0x3D,0x20,0x26,0x1E,0x0A,0x35,0x25,0x3A,0x33,0x3A,0xC1,0x37,0x33,0xC0,0x3D,0x0F,0x26,0x6B,0xC0,0x13,0xC0,0xA5,0x77,0x13,
+0x05,0xC1,0x17,0x05,0xCA,0xA5,0x87,0xAE,0x34,0xAB,0x64,0xA7,0x65,0x94,0xAA,0x96,0xBE,0x99,0xBB,0x06,0xAA,0x64,0xBB,0x40,0xA3,0x86,0xC1,0x67,0xFE,0x4C,0x07,0x9D,
+0xEE,0x1A,0x95,0x8A,0xA1,0xAA,0x1A,0x18,0xC0,0xFE,0x54,0xE7,0xFE,0x00,0xA0,0xA2,0xA9,0x10,0x95,0xCC,0xCA,0x17,0x05,0xC1,0x22,0x9C,0x6C,0x3D,0xC0,0x07,0x3D,0xC0,
+0x20,0x26,0x1E,0xA0,0xA9,0x9E,0xB6,0x25,0xA1,0xA9,0xC0,0x33,0x6B,0x33,0xA1,0xA9,0x51,0x3A,0x9D,0xA9,0x6E,0xC0,0xFE,0x6E,0x26,0x9C,0x89,0x18,0xC2,0xFE,0x2B,0x24,
+0xFE,0x00,0x20,0xA8,0x55,0xC0,0x0F,0x05,0xC1,0x17,0x05,0xC7,0xA6,0x87,0x22,0x10,0x3D,0x20,0x2D,0x2B,0x0A,0xA3,0xB7,0xA1,0xA9,0xA0,0xA8,0x5A,0x29,0xA3,0x98,0x3D,
+0xC0,0x29,0x33,0x05,0x3D,0x05,0x3D,0x29,0x05,0x3D,0x05,0xC1,0x29,0x3A,0xFE,0x52,0x26,0x9C,0x9A,0x1D,0x59,0x1D,0x13,0xC2,0x69,0x13,0x1D,0x36,0x8B,0x9D,0xC5,0x17,
+0x05,0xC5,0xA5,0x87,0xFE,0x76,0x09,0x18,0xC1,0x1A,0x18,0xC0,0x1A,0x90,0x9B,0xFE,0x00,0x40,0x05,0x39,0xAE,0x73,0x0D,0x9C,0x88,0x18,0xC2,0x15,0x17,0xBB,0x21,0x1A,
+0x18,0xC0,0x8A,0x9E,0xFE,0x52,0x26,0xC0,0x13,0x1D,0xC0,0x13,0xC4,0xA7,0x87,0x99,0x79,0x05,0xC5,0x17,0x05,0xC5,0x2B,0x19,0x18,0xC5,0x99,0x9C,0xFE,0x09,0x81,0x17,
+0xB5,0x33,0x1A,0x18,0xC0,0x25,0xA4,0x88,0x18,0x2C,0x06,0x05,0xC0,0xBF,0x20,0x1F,0x18,0x39,0x1D,0xC0,0x13,0x1D,0xC1,0x13,0xC3,0xA8,0x66,0x93,0x99,0x1D,0x13,0xC1,
+0x1D,0xC2,0x13,0xC1,0x0F,0x8C,0x9B,0x05,0xC5,0x17,0x05,0xC5,0x17,0xFE,0x5C,0xE8,0x18,0xC6,0x99,0x9C,0x06,0x9D,0xAA,0xFE,0x65,0xA7,0x18,0x1A,0x18,0xC0,0x6B,0x25,
+0x15,0xFE,0x01,0x00,0x05,0xC0,0xA6,0x87,0xB9,0x21,0xFE,0x55,0x63,0xFE,0x00,0xA0,0x05,0xC1,0xAB,0x55,0x97,0xBB,0x05,0x1D,0x13,0xC1,0x1D,0xC0,0x13,0xC1,0x1D,0x13,
+0x1D,0x13,0xC1,0x1D,0xC0,0x13,0xC2,0x1D,0xA5,0x66,0x05,0xC7,0x17,0x05,0xC5,0x32,0x1A,0x18,0xC3,0x1A,0x18,0xC0,0x39,0x19,0xFE,0x6D,0x69,0x18,0xC1,0x1A,0x18,0xC3,
+0x0E,0x08,0x28,0x17,0x10,0x19,0x13,0x1D,0xC0,0x13,0x0C,0x13,0x1D,0xA4,0x54,0x1D,0x13,0x1D,0xC1,0x13,0x1D,0x13,0x36,0x9A,0x88,0x05,0xC6,0x17,0x05,0xC6,0x2B,0x0E,
+0x1A,0x18,0xC2,0x1A,0x18,0xC1,0xFE,0x0A,0xA0,0x3D,0x18,0xC3,0x1A,0x18,0xC4,0x8F,0xAD,0xFE,0x00,0x40,0x2B,0xA5,0x78,0x28,0xA3,0xA8,0xA5,0x57,0x06,0x37,0x24,0x37,
+0x0A,0x05,0x13,0x1D,0xC2,0x13,0x1D,0xC0,0xA8,0x55,0x93,0x99,0x05,0xC3,0x17,0x05,0xCA,0xFE,0x43,0xE6,0x1A,0x18,0x1A,0x18,0xC4,0x29,0xAF,0x97,0x18,0xC4,0x1A,0x18,
+0xC3,0x39,0x19,0x05,0x10,0xC0,0x97,0xBB,0x37,0x28,0x37,0xC2,0x05,0x39,0x0D,0x18,0xC3,0x1A,0x18,0xC4,0xFE,0x3B,0xE5,0x0A,0x05,0xA7,0x78,0x0F,0x05,0x07,0x37,0xC1,
+0x06,0x37,0x0A,0x05,0xC2,0x17,0x05,0xC1,0xAB,0x86,0xAA,0xF5,0xFE,0xB1,0x81,0xC0,0x46,0x61,0x05,0x56,0x29,0x05,0x3A,0xC0,0x29,0x33,0x29,0x31,0x3A,0x29,0xC0,0x0F,
+0xAE,0xA6,0x7B,0x13,0xC5,0xA7,0x64,0x13,0xC0,0x1D,0xC2,0x13,0x1D,0xC0,0xA4,0x54,0x1F,0x1D,0x13,0xC0,0x1D,0xC1,0x13,0x1D,0xA5,0x66,0x13,0x1D,0x13,0x1D,0xC2,0x13,
+0xA8,0x66,0x13,0xC5,0xA8,0x74,0x97,0x89,0x91,0x9F,0xC3,0x17,0x05,0xCE,0xB7,0x10,0xC0,0x05,0xC9,0x10,0x97,0xBB,0x05,0xC1,0x2B,0x00,0xFE,0x99,0x61,0x3D,0x29,0xFE,
+0x23,0xC1,0x0F,0x05,0xC1,0x17,0x05,0xC4,0x10,0x0F,0x05,0xC1,0x36,0x37,0x33,0x3A,0x33,0xFE,0x61,0xE7,0x13,0xC0,0x1D,0x13,0xC1,0x1D,0x13,0x04,0x8F,0x8C,0x0F,0x05,
+0xC7,0x17,0x05,0xC8,0x10,0xFE,0x55,0x63,0x25,0x6B,0x18,0x1A,0x18,0xC1,0x25,0x18,0x1A,0x18,0x25,0x2C,0xA4,0x86,0x1F,0x18,0xC2,0x8B,0xBF,0x05,0xC9,0xA8,0x55,0x0F,
+0x05,0xC0,0x0C,0xFE,0x8A,0x21,0x9C,0x2F,0x1D,0x13,0x1D,0xA4,0x54,0x1D,0xC0,0x13,0xC0,0xA8,0x66,0x31,0x05,0xC6,0x17,0x05,0xCA,0xFE,0x3C,0x62,0x2C,0xA4,0x86,0x95,
+0x9A,0x0D,0x18,0xC1,0x1A,0x18,0xC4,0x2C,0x0A,0x06,0x18,0xC1,0x3B,0xFE,0x00,0x60,0xC0,0x05,0xC7,0x37,0xC0,0x05,0x3C,0xA6,0xE5,0xFE,0xA9,0x40,0xFE,0x61,0xE7,0x13,
+0xC1,0x1D,0xC0,0x13,0xC1,0xA8,0x66,0x8F,0x9A,0x05,0xC8,0x6E,0x05,0xC3,0x17,0x05,0xC1,0xAB,0x86,0xFE,0x76,0x09,0x25,0x0D,0x9A,0x87,0x25,0x18,0xC1,0x1A,0x18,0xC6,
+0x25,0x9B,0x89,0xA5,0xAA,0x1A,0x3B,0xFE,0x12,0x02,0xC0,0x31,0xA4,0x47,0xC0,0x2B,0x05,0x37,0x28,0x9E,0xBB,0x06,0xC0,0x99,0xBB,0x16,0xAB,0xE4,0x33,0xA1,0xA9,0xFE,
+0x59,0xE7,0x13,0xC6,0x0F,0x31,0x99,0x9C,0xC1,0x17,0x05,0xCE,0x20,0xFE,0x76,0x09,0x25,0xA4,0x87,0x0D,0x95,0x99,0x0D,0x18,0xC2,0x1A,0x18,0xC5,0x25,0xFE,0x0A,0x00,
+0xAA,0x64,0x9B,0xDE,0x9B,0x79,0x92,0xDD,0x6E,0x05,0x28,0xC0,0x31,0x37,0xC1,0x0F,0x05,0xA6,0x87,0xAC,0xE4,0xFE,0x99,0x61,0x71,0x3D,0x1D,0xA2,0x55,0xC6,0xA9,0x77,
+0x31,0x0F,0xAC,0xE9,0x13,0xC6,0xA8,0x66,0x31,0x05,0xC3,0xA3,0x87,0x05,0xCD,0xFE,0x43,0xE6,0x12,0xFE,0x0A,0x00,0x39,0x1F,0x8A,0x9D,0x36,0x18,0xC1,0x1A,0x18,0xC3,
+0x12,0x13,0x9C,0xAB,0x13,0xFE,0x59,0xE7,0xA2,0x55,0xC2,0x7B,0xC0,0x13,0xC0,0xA5,0x77,0x31,0x05,0xC9,0x17,0x05,0xC7,0x3A,0x10,0x97,0xBB,0xB2,0x53,0x0D,0xFE,0x01,
+0x60,0x12,0xAE,0x75,0xC0,0x18,0xC0,0x1A,0x18,0xC0,0x39,0x8F,0xAC,0x0F,0x0A,0x10,0xAC,0x43,0x20,0x5A,0x13,0xC0,0x0C,0x13,0xC3,0x36,0x8F,0x9B,0x05,0xCA,0xA3,0x87,
+0x05,0xC9,0x3A,0x0E,0x39,0x25,0x50,0x18,0xC0,0x06,0x1A,0x95,0x8A,0x0E,0x08,0x0F,0x05,0xC0,0x10,0x59,0x0F,0x05,0xC2,0x17,0x05,0xC4,0x3C,0xA7,0xF6,0xFE,0xB1,0x81,
+0xC1,0x6E,0x20,0x1D,0x13,0xC3,0x7B,0x13,0xC0,0x36,0x96,0x88,0x95,0x9D,0xC3,0x17,0x05,0xCF,0xAF,0x54,0xB7,0x31,0x9F,0x74,0x0D,0x18,0x25,0x50,0x25,0x0E,0x24,0x0D,
+0x0A,0x37,0x05,0xC0,0x2B,0xAA,0x34,0x0F,0x05,0xCA,0x13,0xFE,0xA1,0xC1,0x9F,0xB9,0xC1,0x3D,0x20,0x5A,0x13,0xC0,0x0C,0x13,0x7B,0x13,0xC1,0x36,0x96,0x8A,0x05,0xCC,
+0x17,0x05,0xC3,0x6E,0x10,0xB3,0x42,0x0D,0xA3,0x87,0x99,0x9B,0x1A,0x18,0xC0,0x0D,0x9C,0x9A,0x1A,0x36,0x9E,0x75,0xFE,0x2B,0x24,0x9B,0xAB,0x28,0xA7,0x98,0xA3,0x52,
+0x06,0x05,0x0F,0x05,0xC1,0x17,0x05,0xC5,0xAF,0x84,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x6E,0x05,0xFE,0x59,0xE7,0xC0,0xA2,0x66,0x59,0xC0,0x69,0x13,0xC2,0xA5,0x77,0x3A,
+0x91,0x9D,0xCD,0x17,0x05,0xC2,0xB3,0x33,0xFE,0x55,0x63,0x18,0xC2,0x0A,0xA6,0x88,0x18,0xC2,0x1A,0x18,0x99,0xAD,0x18,0xC1,0x12,0xFE,0x00,0xA0,0x05,0xC2,0x17,0x05,
+0xC6,0x3F,0xAD,0xF4,0xFE,0xA9,0x40,0x3D,0xC0,0x31,0xFE,0x59,0xE7,0xC0,0x13,0xC1,0x69,0x13,0x7B,0x13,0xC0,0xA5,0x77,0x9E,0x86,0x05,0xC2,0x17,0x05,0xCB,0x2B,0xB9,
+0x10,0x0D,0x18,0xC1,0x1A,0x18,0x99,0x9C,0x0D,0x18,0xC2,0x1A,0x29,0x92,0xCE,0x28,0x18,0xC0,0xFE,0x0A,0xA0,0x19,0x05,0xCC,0x0C,0xFE,0x8A,0x21,0x98,0xFB,0x33,0x29,
+0xFE,0x51,0xA6,0x9D,0xC7,0x60,0x66,0xC0,0x2B,0xC0,0x09,0x1D,0x59,0x36,0x8B,0xAD,0x05,0xCD,0xA8,0x55,0x12,0x1A,0x18,0xC1,0x1A,0x18,0xC3,0x0A,0x06,0x18,0xC0,0x8A,
+0x9E,0xFE,0x01,0x60,0xA5,0x76,0xB7,0x64,0x1A,0x96,0x9B,0xFE,0x00,0x60,0x05,0xCE,0x3A,0x35,0xFE,0xB1,0x81,0xC0,0x6E,0x3D,0x05,0x0A,0x05,0x0A,0xC1,0x05,0x0A,0x9B,
+0x1B,0x66,0xC0,0x79,0xC0,0x0E,0xC0,0x13,0x2B,0xAE,0x15,0x8D,0x8B,0x9C,0x8A,0xC4,0x6E,0x05,0xC1,0x17,0x05,0xC1,0x32,0xBA,0x20,0x06,0x18,0xC3,0x1A,0x18,0xC3,0x97,
+0x9A,0x25,0x18,0xC0,0x99,0x9C,0xA4,0x87,0x18,0xC0,0x8F,0xAD,0x0F,0x05,0xCD,0x17,0x05,0xB2,0xE3,0xFE,0xA1,0xC1,0x3D,0x7E,0xC1,0x6E,0x05,0x0A,0x05,0x0A,0x05,0x31,
+0x2B,0x0E,0xC1,0x79,0x0E,0xC0,0x13,0x0E,0x28,0x97,0x2A,0x97,0x9C,0xC4,0x17,0x05,0xC4,0xA6,0x87,0xA9,0x45,0x7A,0x2E,0x31,0xAF,0x54,0xAC,0x75,0x18,0xC7,0x3B,0xFE,
+0x22,0x84,0xAB,0x64,0x12,0xC0,0x13,0x97,0xAA,0x96,0xAC,0x96,0xCC,0x0F,0x05,0xC2,0x17,0x05,0xC9,0xB7,0x94,0xFE,0x99,0x61,0x7A,0x37,0xA1,0xB8,0x56,0x05,0xC2,0x6E,
+0x3D,0xC0,0xFE,0x00,0x40,0xFE,0x65,0xA7,0x18,0x1A,0x18,0xC0,0x95,0xAD,0xFE,0x01,0x60,0x96,0xDD,0xC1,0x0F,0x05,0xC1,0xA8,0x55,0x05,0xC3,0x17,0x05,0xC9,0xA6,0x87,
+0xB3,0xA2,0x33,0x6B,0xC0,0xA1,0xA8,0xC0,0x6E,0x05,0xC0,0x3D,0xC0,0x9D,0x1A,0x66,0xC4,0x79,0xC0,0x28,0x17,0xC1,0x9D,0x9A,0xC4,0x17,0x05,0xC0,0x10,0x97,0xBB,0x05,
+0xC6,0xB4,0x42,0xFE,0x6E,0x27,0x18,0xC0,0x2C,0x06,0x05,0xC3,0xA3,0x87,0x05,0xC0,0xA6,0x87,0x05,0xC2,0x17,0x05,0xCA,0xB0,0x95,0x35,0xFE,0xA9,0x40,0x3D,0x7E,0x31,
+0x05,0xC0,0x46,0x31,0x0E,0xC2,0xBA,0x17,0x11,0x90,0xA5,0x2B,0x0A,0xAA,0x54,0x20,0x95,0x9B,0xC6,0x17,0x05,0x10,0x9C,0x88,0x05,0xC4,0x17,0x05,0xC1,0xB8,0x21,0x1A,
+0x18,0xFE,0x23,0x03,0xFE,0x00,0x40,0x05,0xC1,0x17,0x05,0xC2,0xA6,0x87,0x05,0xC5,0x17,0x05,0xC6,0xA5,0x87,0xB2,0x95,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x46,0x61,0x05,
+0x29,0x05,0x6E,0xFE,0x00,0x40,0x66,0xC1,0x17,0x05,0xC3,0x07,0x05,0x0F,0x2B,0x05,0xC4,0x0A,0x05,0xA8,0x55,0xC0,0x0F,0x05,0xC9,0x0C,0x37,0x05,0xC1,0x17,0x05,0xC4,
+0x10,0x28,0x05,0xC5,0x17,0x05,0xC4,0x20,0xAE,0xC4,0x33,0x0A,0x10,0x0F,0x1D,0x1A,0x98,0x88,0xFE,0x00,0xA0,0x17,0x05,0xC2,0x17,0x05,0xC0,0x37,0x19,0x10,0x0F,0x05,
+0xC9,0x17,0x00,0x9D,0xF3,0xFE,0xB1,0x81,0xC1,0x29,0x05,0x3D,0x05,0xC2,0x6E,0x05,0xC1,0x0A,0xC0,0x05,0x0A,0x05,0x0A,0x05,0x31,0x05,0x3A,0x05,0x31,0x3A,0xC1,0x5A,
+0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC4,0x3D,0x07,0x42,0x98,0xBB,0xC5,0x17,0x05,0xA6,0x87,0x00,0x0F,0xFE,0xA1,0x00,0x29,0xC0,0x31,0x33,
+0x3D,0xFE,0x19,0x63,0x98,0x99,0x05,0xC5,0x3F,0xAE,0x85,0xFE,0x8A,0x21,0x29,0x3D,0x7E,0x29,0x3D,0x33,0x05,0x35,0x1C,0xC0,0xA7,0x7C,0xC0,0x00,0x8E,0x6A,0x55,0xC2,
+0x15,0x97,0xAA,0xC0,0x05,0xC1,0x17,0x05,0xC3,0xFE,0x5C,0xE8,0x18,0xC1,0x1A,0x18,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0xC1,0x10,0x37,0x05,0xC2,0x37,0xC0,0x05,0xC4,
+0x20,0x35,0xFE,0x99,0x61,0x3D,0xC0,0x33,0x31,0xC0,0x5F,0xA1,0xA8,0x6E,0x05,0x0A,0x0E,0xC1,0x79,0xC0,0x09,0x26,0x97,0x59,0xC1,0x17,0x10,0x0F,0x05,0xC1,0x17,0x05,
+0xC2,0x6E,0x3F,0xFE,0x76,0x09,0x18,0xC3,0x94,0x8B,0xFE,0x00,0xA0,0x05,0xC0,0xA8,0x55,0xC0,0x0F,0x05,0xC2,0x0A,0xA9,0x77,0x0A,0xC0,0x05,0xC1,0x13,0xA4,0xD5,0xFE,
+0x99,0x61,0x3D,0x7E,0xC0,0x29,0xC0,0x3A,0x33,0x31,0x05,0xC1,0x9C,0x0A,0x0E,0xC1,0x79,0xC0,0xA6,0x2B,0x9A,0x47,0x9A,0x89,0xC0,0x14,0x10,0x96,0xBB,0x05,0xC7,0x1D,
+0x1A,0x18,0xC3,0x2C,0xFE,0x01,0x60,0x0F,0xA6,0x66,0x28,0x0A,0x05,0xC1,0x0A,0x05,0xC0,0x15,0x37,0x05,0x0F,0x20,0x00,0x9D,0xF3,0x29,0x3D,0xA2,0x87,0x66,0x46,0x33,
+0x3A,0x29,0xC1,0x3A,0xC0,0x05,0xFE,0x00,0x40,0x66,0xC7,0xFE,0x55,0x25,0x1A,0x18,0xC4,0xFE,0x0A,0xA0,0x10,0x37,0x0A,0x6E,0x05,0xC3,0x17,0x05,0x10,0x9E,0xB8,0xA5,
+0xEC,0x04,0xFE,0xB1,0x81,0xC0,0x29,0xC0,0x05,0x29,0x05,0x3D,0x3A,0x29,0x33,0x05,0x29,0xC0,0x05,0x6E,0x05,0xC1,0x0A,0x05,0xC0,0x00,0xFE,0x99,0x61,0x33,0x3A,0x33,
+0x29,0x31,0x05,0x29,0xC0,0x05,0x3A,0xC0,0x29,0x3A,0xC1,0x3D,0xC1,0x05,0xC3,0xFE,0x4A,0x24,0x37,0x33,0x37,0x33,0x29,0xC3,0x31,0x3D,0x31,0x05,0x3A,0xC0,0x31,0x3D,
+0x29,0x05,0x3D,0x05,0xC2,0xFE,0x29,0x83,0xFE,0x81,0x62,0x3D,0x29,0xC1,0x31,0x3D,0xC0,0x33,0x3A,0x3D,0x3A,0x24,0x29,0x0A,0x05,0x0A,0x05,0x0A,0x05,0x0A,0xC2,0x2B,
+0xAE,0x85,0x3D,0x31,0x3A,0x29,0xC0,0x31,0x29,0x3D,0x0A,0x05,0xC0,0x3A,0x29,0x05,0x0A,0xC0,0x05,0x3A,0x0A,0x05,0xC1,0x0A,0x32,0x1A,0x18,0xC6,0x1A,0x2C,0x0F,0x62,
+0xC2,0x17,0x05,0xC4,0xAF,0x53,0xFE,0x8A,0x21,0x3D,0x0A,0x66,0x3A,0x31,0x3D,0xC0,0x31,0x24,0x31,0x1C,0x18,0xC0,0x1A,0x18,0xC5,0x08,0xFE,0x00,0x20,0xCA,0xA5,0x88,
+0xA9,0xE9,0x29,0xC0,0x0A,0x66,0xC1,0x29,0xC2,0xFE,0x65,0xA7,0x18,0xC5,0x1A,0x18,0xC0,0x3B,0xFE,0x00,0x60,0x62,0xCA,0x2A,0xFE,0x89,0x40,0x3D,0xC0,0x31,0xA2,0x88,
+0xC0,0x3A,0x33,0x29,0x3D,0x9C,0x1A,0xFE,0x3A,0x01,0x91,0x9F,0xC2,0x17,0x05,0x10,0xFE,0x76,0x09,0x18,0xC8,0x12,0xFE,0x00,0xA0,0x05,0xC3,0x17,0x05,0xC2,0x6E,0x05,
+0x10,0xFE,0x61,0x43,0x31,0x29,0x3A,0x29,0x31,0x3D,0xC0,0x31,0x29,0xC1,0x31,0x3D,0xC0,0xA2,0x87,0xC0,0x66,0x3D,0x29,0xC0,0x33,0x05,0xC0,0x0A,0x3D,0x29,0x31,0x3A,
+0x24,0x29,0x31,0x3A,0xC1,0x37,0x33,0xC5,0x3A,0x33,0xC0,0x3A,0xC0,0x33,0x3A,0xC0,0x33,0x3A,0xC5,0xAA,0x86,0xC1,0x7F,0xC1,0x0A,0x0E,0xFE,0x55,0x63,0x28,0x99,0xCC,
+0xC1,0x17,0x05,0xC5,0x0F,0x66,0xAE,0x84,0x37,0x3D,0x29,0xC0,0xFE,0x5D,0xA5,0xFE,0x09,0x21,0x05,0xC7,0x17,0x05,0xC1,0xAB,0x86,0xFE,0x7A,0x21,0xFE,0xA1,0x61,0x33,
+0xA1,0xA9,0xBC,0x56,0xC2,0x99,0x99,0xA6,0x88,0x01,0xC2,0x9C,0x88,0x3C,0x01,0xF5,0x9D,0x99,0xC4,0x01,0xFD,0xC0,0x19,0x3C,0x01,0xED,0x28,0xC0,0x00,0xC0,0x9C,0x88,
+0x61,0xC4,0x62,0xC1,0x01,0xD6,0x28,0x01,0xD6,0x28,0x01,0xCD,0x00,0x3C,0x01,0xD6,0x28,0x01,0xD1,0x00,0x18,0x07,0xC1,0x3D,0xA5,0x67,0xC7,0x5A,0xC0,0x01,0xD6,0x28,
+0x01,0xD9,0x28,0x01,0xCA,0x00,0x3C,0x01,0xD7,0x28,0x01,0xCD,0x00,0x18,0x07,0x5F,0x1D,0xC6,0x1A,0x1D,0xC0,0x1A,0x1D,0xC1,0x1A,0x01,0xD6,0x28,0x01,0xDC,0x28,0x01,
+0xC7,0x00,0x3C,0x01,0xD8,0x28,0x01,0xC9,0x00,0x18,0x07,0x10,0x1D,0xC4,0x1A,0x1D,0xC2,0x1A,0x1D,0xC3,0x1A,0x1D,0x01,0xD6,0x28,0x01,0xDF,0x28,0x01,0xC4,0x00,0x3C,
+0x01,0xD9,0x28,0x01,0xC5,0x00,0x18,0x07,0x10,0x1D,0xC1,0x1A,0x1D,0xC4,0x1A,0x1D,0xC5,0x1A,0x1D,0xC1,0x01,0xD6,0x28,0x01,0xE0,0x28,0x01,0xC2,0x19,0xC0,0x3C,0x01,
+0xD7,0x28,0x01,0xC4,0x00,0x18,0x07,0x10,0x1D,0xC1,0x1A,0x1D,0xC6,0x1A,0x1D,0xC5,0x1A,0xC0,0x1D,0xC0,0x1A,0x01,0xD7,0x28,0x01,0xE4,0x19,0xA3,0x89,0x01,0xD6,0x28,
+0x01,0xC4,0x00,0x3D,0xC0,0x1D,0xC5,0x1A,0x1D,0xC5,0x1A,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0x39,0x01,0xD7,0x28,0x01,0xE2,0x28,0x00,0x3C,0x01,0xDA,0x28,0x99,0x99,
+0x07,0xC1,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xC2,0x1A,0x1D,0xC2,0x00,0xC0,0x19,0x3C,0x01,0xD8,0x28,0x01,0xDC,0x00,0x01,0xD6,0x28,
+0x01,0xC0,0x19,0x18,0x07,0x10,0x1D,0xC6,0x1A,0x1D,0xC5,0x1A,0x1D,0xC3,0x1A,0x1D,0xC5,0x1A,0x1D,0x39,0x01,0xC1,0x19,0xC0,0x27,0x07,0x27,0x00,0xC0,0x19,0x3C,0x01,
+0xD6,0x28,0x01,0xD8,0x00,0x3C,0x01,0xD6,0x19,0x18,0x10,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xC4,0x1A,0x1D,0xC5,0x1A,0x1D,0xC5,0x01,0xC7,0x28,0xC0,0x00,0x27,0x07,
+0x00,0xC0,0x19,0x3C,0xC0,0x01,0xD6,0x28,0x01,0xD1,0x19,0xC0,0x01,0xD5,0x19,0x18,0x10,0x1D,0xC2,0x1A,0xC0,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xC6,0x1A,0x1D,0xC5,
+0x1A,0x1D,0xC0,0x01,0xCD,0x28,0x00,0x18,0x27,0x07,0x00,0x28,0xC0,0x3C,0x01,0xD7,0x28,0x01,0xCB,0x00,0x3C,0x01,0xD3,0x28,0x18,0x07,0x10,0x1D,0x1A,0xC0,0x1D,0xC2,
+0x1A,0x1D,0xC5,0x1A,0x1D,0xC7,0x1A,0x1D,0xC5,0x1A,0x1D,0xC2,0x01,0xD1,0x19,0xC1,0x27,0x18,0x07,0x00,0xC0,0x19,0x3C,0xC0,0x01,0xD6,0x28,0x01,0xC6,0x27,0x3C,0x01,
+0xD2,0x27,0x07,0x27,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC8,0x1A,0x1D,0xC5,0x1A,0x1D,0xC8,0x01,0xD6,0x28,0x01,0x00,0x18,0x27,0xC0,0x07,0x00,0x28,0x19,0x3C,0x01,
+0xD9,0x28,0x00,0x01,0xD1,0x00,0x18,0x07,0x10,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xCA,0x1A,0x1D,0xC5,0x1A,0x1D,0xC5,0x28,0x01,0xC4,0x00,0x19,0xC0,0x27,0x18,0xC0,
+0x00,0xC0,0x19,0x3C,0xC0,0x6D,0xC1,0xA1,0xA7,0x3A,0xC0,0x3E,0x3A,0xC0,0x3E,0x3A,0x3E,0x3A,0xC1,0x3C,0x01,0xC3,0x00,0x01,0xCF,0x19,0x18,0x10,0x1D,0xC1,0x1A,0x1D,
+0xC5,0x1A,0x1D,0xCB,0x1A,0x1D,0xC5,0x1A,0x1D,0xC3,0x28,0x01,0xC9,0x60,0x9E,0x86,0x61,0x51,0x6B,0x9D,0xA9,0x41,0x9D,0x89,0x50,0x53,0x68,0x9E,0x8B,0x69,0x7F,0xC1,
+0x05,0x20,0xA4,0x86,0x29,0xA5,0x87,0xA4,0x68,0x3E,0x47,0xC0,0x67,0x00,0x3C,0x01,0xCE,0x27,0x9D,0x98,0x27,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xCC,0x1A,0x1D,0xC5,
+0x1A,0x1D,0xC3,0x01,0x28,0x01,0xC5,0x31,0x0F,0x22,0x9B,0x9A,0x99,0x88,0x9C,0x8A,0x9D,0x9A,0xD0,0x2B,0xA4,0x98,0xA7,0x76,0xA7,0x88,0xA4,0x97,0x07,0x3A,0xC0,0x67,
+0x01,0xCB,0x93,0xA9,0xC1,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xCD,0x1A,0x1D,0xC5,0x1A,0x1D,0xC3,0x01,0xC0,0x28,0x01,0xC0,0x3E,0x0F,0x22,0x20,0x9A,0x89,0x9B,0xAA,
+0x05,0xD8,0xA6,0x87,0xA9,0x85,0x29,0xA8,0x86,0x4F,0x3C,0x01,0xC8,0x19,0x18,0x10,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xCE,0x1A,0x1D,0xC5,0x1A,0x1D,0xC3,0x01,0xC1,
+0x9C,0x95,0x06,0x99,0x99,0x17,0x9D,0x9A,0xDE,0x7F,0x3F,0x22,0xA6,0x88,0x31,0x3C,0x01,0xC5,0x19,0x18,0x10,0x1D,0xC3,0x1A,0x1D,0xC5,0x1A,0x1D,0xCF,0x1A,0x1D,0xC5,
+0x1A,0x1D,0xC2,0x28,0x01,0x3E,0x8B,0x99,0x17,0x05,0xC9,0x14,0x05,0xC9,0x14,0x05,0xCA,0x14,0x32,0x13,0x2B,0x4F,0x3C,0x01,0xC2,0x19,0x18,0x10,0x1D,0xC4,0x1A,0x1D,
+0xC5,0x1A,0x1D,0xD0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC1,0x28,0x01,0x3E,0x88,0x9A,0x05,0xCA,0x14,0x05,0xCB,0x14,0x05,0xCB,0xA6,0x87,0x36,0xA6,0x88,0xA0,0x6A,0xC0,0x3C,
+0x19,0x18,0x10,0x1D,0xC5,0x1A,0x1D,0xC5,0x1A,0x1D,0xD1,0x1A,0x1D,0xC5,0x1A,0x1D,0xC0,0x01,0x28,0x01,0x1F,0x05,0xCA,0x14,0x05,0xCD,0x14,0x05,0xCB,0x16,0x07,0x3A,
+0x19,0x18,0x10,0x1D,0xC6,0x1A,0x1D,0xC5,0x1A,0x1D,0xD2,0x1A,0x1D,0xC5,0x1A,0x1D,0x28,0x01,0x3E,0x1F,0x05,0xC9,0x14,0x05,0xCF,0x14,0x05,0xCC,0xAF,0x84,0x29,0x13,
+0x1D,0xC2,0x1A,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xD3,0x1A,0x1D,0xC5,0x1A,0x1D,0xC0,0x01,0xC0,0x07,0x8A,0x9C,0x05,0xCE,0x14,0x05,0xD1,0x14,0x05,0xC6,0xA6,0x87,
+0x36,0xC0,0x18,0x61,0x10,0x1D,0x1A,0xC1,0x1D,0xC3,0x1A,0x1D,0xC5,0x1A,0x1D,0xD4,0x1A,0x1D,0xC5,0x1A,0x28,0x01,0x9C,0x95,0x05,0xCC,0x14,0x05,0xD2,0x14,0x05,0xCA,
+0x13,0x07,0x18,0x61,0x10,0x1D,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xD5,0x1A,0x1D,0xC5,0x1A,0x1D,0xC0,0x01,0x28,0x00,0x05,0xD0,0x14,0x05,0xD4,0x14,0x05,
+0xC5,0xAE,0x85,0x0F,0x9B,0x69,0x1D,0xC2,0x1A,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xD6,0x1A,0x1D,0xC5,0x28,0x01,0x06,0x05,0xCE,0x14,0x05,0xD5,0x14,0x05,0xC7,0x20,
+0x1E,0x19,0x1D,0xC8,0x1A,0x1D,0xC5,0x1A,0x1D,0xD7,0x1A,0x1D,0xC1,0x01,0x28,0x97,0xA5,0x0A,0x05,0xCD,0x14,0x05,0xD6,0x14,0x05,0xC7,0x20,0x0F,0x19,0x1D,0xC2,0x1A,
+0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xD8,0x1A,0x1D,0xC0,0x28,0x01,0x8E,0xA6,0x17,0x9D,0x9A,0xC9,0x14,0x05,0x3C,0x99,0x88,0x05,0xC9,0x14,0x05,0xD6,0x16,0xAE,0x65,
+0x19,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xD9,0x1A,0x1D,0xC3,0x28,0x01,0x8E,0xA6,0x97,0x9C,0xC9,0x14,0x05,0xC0,0xFE,0x94,0xCD,0xA8,0x98,0x29,0x17,0x05,0xC3,0xA6,
+0x87,0x05,0xCB,0x14,0x05,0xCD,0xAC,0x87,0xAC,0x74,0x18,0x61,0x10,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xC1,0x3D,0xC0,0x41,0xC1,0x3D,0xC0,0x26,0xC1,
+0x3D,0x1D,0xC2,0x1A,0x1D,0xC3,0x1A,0x1D,0xC1,0x01,0x9C,0x88,0x17,0x05,0xCC,0xFE,0x8C,0x6C,0xBC,0x77,0x9A,0x9A,0x8D,0x87,0x8A,0x89,0x0A,0x05,0xC0,0xA6,0x87,0x1E,
+0x29,0x17,0x05,0xC9,0x14,0x05,0xCE,0x3C,0xAA,0x76,0x18,0x07,0x10,0x1D,0x1A,0xC0,0x1D,0xC2,0x1A,0x1D,0xC2,0x3D,0xC0,0x26,0x3D,0x6E,0xC0,0xA3,0x99,0xC7,0x3D,0xC0,
+0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0x39,0x01,0xD6,0x9C,0x95,0x05,0xCA,0x14,0x05,0xC0,0x1E,0x04,0x7B,0x04,0x96,0x87,0x32,0x31,0x17,0x05,0xB5,0x84,0xFE,0xD6,0xF5,
+0x95,0x97,0x06,0x05,0xCA,0x14,0x05,0xCD,0x13,0x07,0x18,0x61,0x10,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0xC0,0x9B,0xCA,0xC0,0x1D,0x25,0xCD,0x3D,0x02,0x1D,0xC2,0x1A,0x1D,
+0xC4,0x1A,0x1D,0x01,0xD7,0x13,0x05,0xCD,0x06,0xFE,0xEF,0x98,0x0E,0x04,0x0E,0x2B,0x8D,0x87,0x20,0x05,0xC0,0x21,0x04,0x19,0x8E,0x9A,0x31,0x17,0x05,0xCA,0x14,0x05,
+0xCB,0xB7,0x74,0x61,0x18,0x61,0x10,0x1D,0x1A,0xC0,0x1D,0xC0,0x26,0x02,0x25,0xD0,0x3D,0x07,0xC1,0x1D,0xC2,0x1A,0x1D,0xC4,0x01,0xD7,0x20,0x05,0xCA,0x14,0x05,0xC0,
+0x3F,0x34,0x0E,0x04,0x0E,0xC0,0x04,0x92,0x87,0x13,0x05,0x06,0xFE,0xDE,0xF8,0xA8,0x76,0x61,0x8F,0x86,0x06,0x05,0xCC,0x14,0x05,0xC9,0x3F,0x0F,0x9B,0x99,0x1D,0xC2,
+0x26,0xC0,0xA2,0x98,0x25,0xD2,0x02,0xC0,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC0,0x01,0xD7,0x8C,0xA6,0x17,0x05,0xCB,0x14,0xA4,0x77,0x19,0x0B,0x3A,0x0B,0xC0,0x3A,
+0x0B,0x34,0x1E,0x14,0xFE,0x9C,0xF1,0x0B,0x0E,0x04,0x19,0x83,0x8B,0x05,0xD0,0x14,0x05,0xC5,0x3C,0x1E,0x9A,0x58,0x9B,0xBC,0x26,0x02,0x25,0xD5,0x02,0xC0,0x1D,0xC1,
+0x1A,0x1D,0xC5,0x1A,0x1D,0x39,0x01,0xD5,0x60,0x89,0x9A,0x05,0xCE,0xFE,0xBD,0xD4,0x0B,0x3A,0x0B,0xC0,0x3A,0x0B,0xC0,0x9A,0x99,0x3E,0x97,0x99,0x19,0x04,0x0E,0x0B,
+0x19,0x87,0x86,0x86,0x8D,0x08,0x05,0xCC,0x14,0x05,0xC7,0x13,0x22,0x3C,0x25,0xC8,0x02,0xC1,0x25,0xCA,0x02,0xC0,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0x00,0xC0,0xA3,
+0x88,0xA3,0x99,0xC0,0x01,0xD0,0x29,0x17,0x05,0xCA,0x14,0x05,0xC1,0xFE,0xA5,0x72,0x0E,0x04,0x0E,0xC0,0x98,0x8A,0x37,0xC0,0xA8,0x77,0xC0,0x1E,0xB4,0x97,0xA7,0x77,
+0xA7,0x9A,0x0E,0x0B,0x9A,0x99,0x8A,0x87,0x31,0x05,0xC9,0x14,0x05,0xCB,0xB7,0x74,0x29,0x25,0xC4,0x02,0xC0,0x9D,0x88,0x62,0xC3,0x25,0xC9,0x02,0x6E,0xC0,0x1D,0xC0,
+0x1A,0x1D,0xC5,0x1A,0x1D,0x9B,0xBA,0xC0,0x26,0x3D,0x69,0x3D,0xC0,0x1D,0xC0,0x27,0x00,0xA3,0x88,0x3C,0x01,0xC9,0x06,0x05,0xCB,0x14,0x05,0xC1,0xFE,0x94,0xCD,0x0B,
+0x3A,0x95,0x79,0x3E,0x15,0xC0,0x3D,0xC0,0xA3,0x87,0x13,0xAB,0x76,0x11,0x0E,0x5A,0x0E,0x04,0x9D,0x99,0x85,0x89,0x84,0x9B,0x05,0xCB,0x14,0x05,0xC8,0x20,0x1E,0x25,
+0xC3,0x36,0x15,0xC6,0x36,0x25,0xC8,0x02,0x18,0x07,0x10,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0x1D,0xC0,0x1A,0x1D,0x3D,0xC0,0x26,0x3D,0x36,0x3D,0xC0,0x26,0x3D,0x36,0x3D,
+0x36,0x15,0x3D,0xC0,0x1D,0x25,0x00,0xC0,0x19,0x3C,0xC0,0x01,0xC0,0x8F,0x96,0x05,0xCD,0x14,0x05,0xFE,0x7C,0x2B,0xB1,0x89,0x3E,0x6B,0x33,0xAD,0x78,0xA7,0x97,0xC2,
+0x9B,0x99,0x9F,0x85,0x2B,0x0E,0x04,0x0E,0xC0,0x5A,0x8E,0x99,0x88,0x76,0x17,0x9D,0x9A,0xCD,0x14,0x05,0xC6,0xB3,0x84,0x29,0x25,0xC0,0x02,0x15,0xC9,0x25,0xC8,0x02,
+0x18,0x61,0x10,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0x1D,0xC1,0x1A,0x9B,0xCA,0xC0,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC0,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC1,0x26,0x3D,0x36,
+0x3D,0x36,0x3D,0xA9,0x84,0x17,0x05,0xCE,0x14,0x29,0x21,0x0C,0x0B,0x6B,0xC4,0x0B,0x3A,0x0B,0xC1,0x3A,0x0B,0x21,0x80,0x8B,0xAD,0x77,0x9E,0x86,0x05,0xCD,0x14,0x05,
+0xC6,0xA6,0x87,0xB2,0x74,0x18,0x3D,0x15,0xCA,0x25,0xC8,0x02,0x18,0x61,0x10,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0x1D,0xC2,0x3D,0xC0,0x26,0x3D,0x36,0x3D,0xC0,0x02,0x3D,
+0xC0,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC2,0x26,0x3D,0x36,0x3D,0x13,0x05,0xCA,0x14,0x05,0xC3,0xB5,0x84,0x2B,0x0E,0x0B,0x12,0xC1,0x0B,0xC0,0x61,0x0B,0xC2,0x3A,0x0B,
+0x9A,0x99,0x21,0x0C,0x04,0x96,0x87,0xFE,0x3A,0x03,0x0A,0x05,0xD5,0x22,0x9B,0x9A,0x15,0xCB,0x25,0xC8,0x3D,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC1,0x3D,0xC1,0x26,
+0x3D,0x69,0x3D,0x36,0x3D,0xC2,0x02,0x3D,0xC1,0xA3,0x87,0x3D,0x02,0x3D,0xC1,0x13,0x3C,0x05,0xD0,0x3C,0xAA,0x76,0x18,0x29,0xA7,0xA8,0x2D,0x0B,0x0E,0xC0,0x04,0x0E,
+0xC0,0x0B,0xC0,0x61,0x0B,0x19,0x0B,0xC0,0x3A,0x0C,0x85,0x87,0x31,0x05,0xC9,0x14,0x05,0xC9,0x3F,0x22,0x3F,0x15,0xC9,0x3D,0x25,0xC8,0x3D,0x1D,0xC0,0x1A,0x1D,0xC5,
+0x1A,0x1D,0xC1,0x3D,0xC2,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC3,0x02,0x3D,0xC2,0x02,0x3D,0xC0,0xA7,0x85,0x96,0x88,0x17,0x9D,0x9A,0xCB,0x14,0x05,0xC1,0x3C,0xFE,0xD6,
+0xD7,0xA4,0x8A,0x0C,0x37,0x8C,0x68,0x30,0x2B,0x0E,0x0B,0x12,0x0B,0x3A,0x0B,0xC0,0x34,0x0E,0x0B,0x3A,0x8A,0x8B,0x85,0x88,0xA8,0x87,0x13,0x05,0xD6,0xB5,0x84,0x20,
+0x15,0xC9,0x25,0xC9,0x07,0xC0,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0x9B,0xBA,0xC1,0xA3,0x87,0x3D,0xC0,0x02,0x3D,0xC3,0x02,0x3D,0xC4,0x02,0x3D,0xC0,0x29,0x17,0x05,
+0xCF,0x14,0xAB,0x87,0xFE,0xE7,0x38,0xA6,0x8C,0xC1,0x37,0x86,0x25,0xA9,0xDB,0x2A,0xA4,0x98,0x0B,0xC1,0x3A,0x0B,0x34,0x0B,0x3A,0x30,0x8B,0x47,0x0C,0xA6,0x52,0xA5,
+0xAB,0x89,0xFE,0x17,0x9D,0x9A,0xCC,0x14,0x05,0xC5,0x3C,0xA3,0x96,0x97,0x8E,0xC8,0x3D,0x25,0xC8,0x02,0xC0,0xA4,0x67,0xC3,0x1A,0x1D,0xC5,0x1A,0x9B,0xFA,0x02,0xC1,
+0x3D,0x02,0x3D,0xC5,0x02,0x3D,0xC5,0x02,0x13,0x05,0xCB,0x14,0x05,0xC3,0x16,0xFE,0xDE,0xF8,0xA8,0x8B,0xC0,0x0C,0x82,0x24,0x44,0x9C,0xAB,0xA9,0xDB,0x2B,0x0E,0x0B,
+0x12,0x0B,0x9A,0x99,0x2B,0x0E,0x33,0xC0,0xFE,0x1B,0x41,0x9B,0x9A,0x9B,0xBB,0xA9,0x88,0x98,0xEC,0x90,0x9C,0xD5,0xA9,0x85,0xAE,0x75,0x15,0xC7,0x3D,0x25,0xC9,0x07,
+0x18,0x07,0x10,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0x1D,0xC3,0x9B,0xFA,0x5A,0xC3,0x02,0xC1,0x3D,0xC0,0x02,0x3D,0xC5,0x02,0x3D,0x25,0x20,0x95,0x9B,0xCB,0x14,0x05,0xC3,
+0xA6,0x87,0xFE,0xBE,0x54,0x31,0xC0,0x37,0x12,0x96,0xAC,0x95,0xEE,0xAB,0x76,0x1F,0xBC,0x98,0x0E,0x04,0x0E,0x96,0x76,0xAA,0x8A,0x21,0xAA,0x89,0x2D,0x84,0x22,0x94,
+0xBC,0x97,0xCC,0x18,0xB4,0x93,0x83,0x9B,0x17,0x05,0xCD,0x14,0x05,0xC4,0xB8,0x73,0x16,0x15,0xC5,0x3D,0x25,0xCA,0x07,0x18,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC1,
+0x09,0x5A,0x09,0x06,0x09,0xC0,0x06,0x09,0xC0,0x06,0xC3,0x02,0xC2,0x3D,0xC1,0xA4,0x95,0x96,0x7A,0x05,0xC9,0x14,0x05,0xC5,0xA5,0x88,0xBD,0x94,0xAF,0x79,0xA8,0x9B,
+0x37,0x88,0x01,0x96,0xBD,0x97,0xCC,0xAD,0x65,0xA9,0x66,0xBD,0xEC,0xA9,0x87,0x61,0x0B,0x96,0x86,0x34,0x21,0x33,0x0C,0x32,0x31,0xAD,0xBA,0x3D,0x2B,0x1E,0x14,0x55,
+0xC9,0x14,0x05,0xC8,0xB5,0x84,0x20,0x15,0xC4,0xA4,0x88,0x25,0xCB,0x07,0x18,0x1D,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xC0,0x09,0x5A,0x09,0xC0,0x06,0x09,0x06,0x09,0xC0,
+0x06,0x09,0xC0,0x06,0x09,0xC0,0x06,0x09,0xC1,0x06,0x09,0x22,0x05,0xCF,0x14,0x05,0xC0,0xA5,0x87,0xFE,0xBD,0xD1,0xAB,0x8A,0x99,0x78,0x21,0x11,0xC1,0x2D,0x2A,0xA4,
+0x87,0x0E,0xC0,0x04,0x96,0x87,0x3A,0x99,0x8A,0x9C,0x77,0xC1,0x3D,0xA9,0x87,0xC1,0x8D,0x96,0x17,0x05,0xD0,0x14,0x05,0xC1,0x13,0xA3,0x77,0x15,0xC3,0x02,0x25,0xCB,
+0x07,0x18,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xC0,0x09,0x06,0xC2,0xA2,0x98,0x09,0x06,0x09,0xC0,0x06,0x09,0xC2,0x06,0x09,0xC0,0x06,0x09,0xC0,0x13,0x05,0xD1,0x14,
+0x05,0xFE,0xBD,0xD1,0x0B,0x3A,0x0E,0x04,0x0E,0xC0,0x0B,0xC1,0x3A,0x0B,0xC0,0x34,0x0B,0x0E,0xC1,0x04,0x0E,0xC0,0x0B,0xC0,0x93,0x89,0x20,0x05,0xCC,0x14,0x05,0xC5,
+0x3C,0xA5,0x87,0x3F,0xA3,0x89,0xA2,0x98,0x6B,0x25,0xCD,0x3D,0xA5,0x67,0xC1,0x1A,0x1D,0xC5,0x1A,0x1D,0xC2,0x98,0xEA,0x06,0xC2,0xA2,0x98,0x09,0x06,0x09,0xC0,0x06,
+0x09,0xC2,0x1D,0x09,0xC0,0x06,0x09,0xA7,0x77,0x96,0x56,0x17,0x9D,0x9A,0xCB,0x14,0x05,0xC4,0xFE,0xAD,0x8E,0x0E,0x5A,0x3A,0x0B,0xC3,0x3A,0x0B,0xC1,0x19,0x0B,0xC1,
+0x3A,0x0B,0xC3,0x86,0x87,0x13,0x05,0xCC,0x14,0x05,0xC5,0x3C,0xA9,0x77,0x18,0x25,0xCF,0x02,0xC0,0xA4,0x67,0xC4,0x1A,0x1D,0xC5,0x1A,0x1D,0x2D,0xC8,0x06,0xC2,0xA2,
+0x98,0x09,0x1D,0x09,0xC1,0xA9,0x44,0x17,0x05,0xC9,0x14,0x05,0xC7,0xFE,0x9D,0x2D,0x04,0x0B,0x3A,0x0B,0xC4,0x3A,0x0B,0xC0,0x34,0x0B,0xC0,0x3A,0x0B,0xC3,0x9D,0x98,
+0xFE,0x3A,0x06,0x13,0x08,0x05,0xCA,0x14,0x05,0xC6,0x3C,0xAA,0x76,0x25,0xD0,0x9C,0x88,0xA5,0x67,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC4,0x98,0xE9,0x2D,0xCE,0x06,0xC1,
+0x22,0x05,0xCA,0x14,0x05,0xC7,0xFE,0xAD,0x8E,0x0E,0x0B,0x3A,0x0B,0xC5,0x3A,0x0B,0xC0,0x34,0x0B,0xC0,0x0E,0x04,0x0E,0xC0,0x0B,0x37,0x05,0x3C,0x99,0x88,0x05,0xCA,
+0x14,0x05,0xC6,0x3C,0x0F,0x18,0x25,0xCE,0x9C,0x88,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xC3,0x26,0x2D,0xC6,0x26,0x2D,0xC7,0xA7,0x76,0x20,0x05,0xCD,0x14,0x05,0xC3,
+0xA6,0x87,0xFE,0xAD,0x8E,0x0E,0x0B,0xC0,0x61,0x0E,0x0B,0x3A,0x0B,0xC4,0x19,0x0B,0xC2,0x3A,0x0B,0xC0,0xFE,0x5B,0x4A,0x89,0x9A,0x3F,0x20,0x05,0xCE,0x14,0x05,0xC2,
+0xB0,0x74,0x07,0x95,0xAD,0xC0,0xA3,0x87,0x3D,0x25,0xCB,0x9A,0x78,0x02,0xA4,0x67,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC4,0x98,0xE9,0x2D,0xC5,0x26,0x2D,0xC5,0x26,0x2D,
+0xC0,0xA3,0x88,0x17,0x05,0xD1,0x14,0x05,0xA5,0x87,0xFE,0xBD,0xD1,0x0B,0x3A,0x0E,0x0B,0xC0,0x3A,0x0B,0xC4,0x19,0xA6,0x88,0x0B,0x3A,0x0E,0x0B,0xC0,0x0E,0x37,0x05,
+0xC1,0x13,0x05,0xD2,0x14,0xB2,0x74,0xC0,0x1D,0xC0,0x1A,0x1D,0x3D,0xC1,0x41,0x3D,0x69,0x3D,0x36,0x3D,0xC3,0x18,0x61,0x5F,0x1D,0x1A,0xC0,0x1D,0xC1,0x1A,0x1D,0xC4,
+0x1A,0x1D,0xC0,0x2D,0xC5,0x69,0x2D,0xC7,0x26,0x2D,0x13,0x05,0xD0,0x14,0x05,0xC1,0xA6,0x87,0xFE,0xBE,0x31,0x0B,0x61,0x0E,0x0B,0xC0,0x0E,0x0B,0x3A,0x0B,0xC1,0x9D,
+0x98,0x0E,0x0B,0x6B,0x0B,0xC0,0x3A,0x0B,0xC0,0x29,0x17,0x05,0xC0,0xAF,0x84,0x92,0x8C,0x05,0xCB,0x14,0x05,0xC3,0xA6,0x87,0x1E,0x18,0x07,0x10,0x1D,0x1A,0xC0,0x1D,
+0xC1,0x1A,0x1D,0xC2,0x10,0x1D,0xC3,0x1A,0x1D,0xC5,0x1A,0x1D,0xC6,0x2D,0xC5,0x26,0x2D,0xC8,0xA7,0x76,0x3C,0x05,0xC9,0x14,0x05,0xC8,0x3F,0x34,0x0E,0x0B,0xC0,0x61,
+0x0B,0xC5,0x93,0x89,0xC0,0x3A,0x0E,0xC0,0x04,0x0E,0xC0,0x00,0x05,0xC2,0x3C,0x05,0xCA,0x14,0x05,0xC5,0x3C,0xA9,0x77,0x18,0x61,0x10,0xA2,0x87,0x1A,0xC0,0x1D,0xC1,
+0x1A,0x1D,0xC5,0x1A,0x1D,0xC5,0x1A,0x1D,0xC9,0x2D,0xC5,0x26,0x2D,0xC2,0x26,0x2D,0xC1,0x26,0x2D,0xAC,0x43,0x92,0x89,0x17,0x05,0xCE,0x14,0x05,0xC2,0xB0,0x74,0x34,
+0x0E,0x5A,0xC0,0x3A,0x0B,0xC3,0x93,0x89,0x36,0x17,0x05,0xFE,0x9C,0xF1,0xB8,0x75,0x0E,0x04,0x0E,0x93,0x79,0xFE,0x18,0xE2,0x05,0xC2,0x3C,0x05,0xCB,0x14,0x05,0xC3,
+0x3A,0x1E,0x3C,0x07,0xC1,0x1D,0xC3,0x1A,0x1D,0xC5,0x1A,0x1D,0xD2,0x26,0x2D,0xC5,0x26,0x2D,0xC2,0x26,0xC0,0x2D,0xC1,0xA7,0x76,0x05,0xD1,0x14,0x05,0xC1,0x25,0xAC,
+0x75,0x2A,0xA4,0x87,0xC1,0x0E,0x04,0x0E,0xC0,0x33,0x3A,0x9A,0x89,0xC0,0x14,0x3D,0x2B,0x0E,0x0B,0x97,0x9A,0x3C,0x05,0xC3,0x20,0x05,0xCF,0x14,0x05,0x3C,0xA5,0x87,
+0x3C,0x9A,0x8B,0xA4,0x87,0x15,0xA4,0x88,0x41,0xC0,0x3D,0xC1,0xA5,0x67,0xC0,0x27,0x1D,0xC2,0x1A,0x1D,0xC5,0x1A,0x1D,0xC5,0x1A,0x1D,0xC2,0x2D,0xC6,0x69,0x2D,0xC2,
+0x26,0xC1,0x2D,0xC0,0x13,0x05,0xCA,0x14,0x05,0xC8,0xB5,0x84,0x31,0x30,0xBC,0x86,0x0E,0xC1,0x04,0x0E,0x00,0x05,0x29,0xB9,0x98,0xA7,0x7A,0x2A,0x97,0x88,0x3A,0x0E,
+0x0C,0x25,0x05,0xC4,0x20,0x05,0xD0,0xA9,0x85,0x39,0x95,0xAE,0x3D,0xC1,0x0F,0x3D,0xC2,0x41,0x3D,0x36,0x26,0xC0,0x3D,0xC2,0x1D,0xC0,0x27,0x1D,0xC1,0x1A,0x1D,0xC5,
+0x1A,0x1D,0xC4,0x98,0xE9,0x6B,0xC6,0x26,0x2D,0xC2,0x26,0xC1,0xAC,0x44,0x31,0x99,0x9C,0xC9,0x14,0x05,0xC9,0x36,0x20,0x0A,0xBB,0x98,0x2B,0x0E,0x5A,0x12,0x11,0x8F,
+0x89,0xBA,0x88,0x0B,0xC2,0x0E,0x0B,0x97,0x9A,0xFE,0x4A,0x86,0x17,0x05,0xC4,0x20,0x05,0xCF,0xA5,0x87,0x36,0x06,0x9C,0x9C,0xC0,0x41,0x3D,0x69,0x3D,0x36,0x3D,0xC3,
+0x18,0x3D,0xC0,0x26,0x3D,0x36,0x3D,0x36,0x26,0xC0,0x3D,0xC1,0x10,0x1D,0xC4,0x1A,0x1D,0xC4,0x9B,0xEA,0x9D,0x99,0xC5,0x69,0x2D,0xC2,0x26,0xC1,0x2D,0xAC,0x43,0x17,
+0x05,0xCA,0x14,0x05,0xC8,0x36,0x9A,0x57,0x05,0xC0,0x16,0xBF,0x84,0x0B,0x2B,0x21,0x3A,0x0E,0x0C,0x9B,0x77,0x21,0x3A,0x0E,0x37,0xFE,0x31,0xA5,0x05,0xC6,0xA9,0x97,
+0x05,0xCF,0x22,0x29,0x3D,0x02,0x3D,0xC5,0x02,0x3D,0xC1,0x41,0x3D,0x36,0x3D,0xC2,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC1,0x26,0xC0,0x3D,0xC1,0x10,0x1D,0xC2,0x1A,0x3D,
+0xA2,0xD8,0x09,0x2D,0xC5,0x69,0x2D,0xC2,0x26,0xC1,0xAC,0x44,0x05,0xD4,0x14,0xA4,0x77,0x13,0x9A,0x59,0x98,0x99,0x05,0xC0,0xB9,0x76,0x0C,0xA8,0x76,0x12,0x0B,0x3A,
+0x9C,0x89,0x2B,0x0B,0x0E,0x33,0x80,0x89,0x05,0xC7,0x16,0x05,0xCE,0xAB,0x86,0xAC,0x76,0x95,0xAC,0x3D,0xC2,0x41,0x3D,0x36,0x3D,0x36,0x3D,0xC3,0x18,0x3D,0xC1,0x26,
+0x3D,0x36,0x3D,0x36,0x3D,0xC3,0x18,0x3D,0xC2,0x26,0x3D,0x36,0x3D,0x36,0x26,0x9F,0xD8,0xA5,0xA9,0x5A,0x2D,0xC5,0x26,0x2D,0xC2,0x26,0xC0,0xA7,0x77,0x9F,0x66,0x0A,
+0x05,0xCC,0x14,0x05,0xC5,0x16,0xA7,0x76,0x15,0x0F,0x14,0x05,0xC0,0x25,0x37,0x0B,0xC0,0x61,0x0B,0xC0,0x95,0x8B,0x29,0x0F,0x05,0xC8,0x16,0x05,0xCD,0x3F,0xB1,0x85,
+0x3C,0xA0,0x7A,0x3D,0xC0,0x41,0x3D,0x36,0x3D,0x36,0x3D,0xC3,0x18,0x3D,0xC3,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC3,0x18,0x3D,0xC4,0x9D,0xC8,0xA0,0xA6,0x9E,0xB8,0xA0,
+0xA7,0xA2,0xA7,0x20,0x5A,0x9B,0x89,0xC5,0x26,0x2D,0xC2,0x26,0xC0,0xAC,0x44,0x31,0x05,0xCA,0x14,0x05,0xC8,0xAB,0x86,0xC0,0x9D,0x9B,0xA7,0x54,0x99,0x9A,0x55,0xC1,
+0xAD,0x86,0x30,0xB3,0x79,0x19,0x2D,0x30,0x86,0x8A,0x05,0xC0,0x14,0x05,0xC7,0x16,0x0A,0x05,0xCA,0x14,0x32,0xAB,0xA6,0x06,0x3D,0xC1,0x41,0x3D,0x69,0x3D,0x36,0x3D,
+0xC3,0x18,0x3D,0xC5,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC3,0x9D,0xA8,0xA0,0xA8,0x1E,0x9E,0xB8,0x12,0x25,0xA1,0xA9,0xC1,0x7A,0xC0,0xFE,0x61,0xE7,0x1D,0x9B,0x89,0xC6,
+0x26,0x2D,0xC2,0x26,0xAC,0x44,0x8E,0x8B,0x05,0xCB,0x14,0x05,0xC7,0xB0,0x95,0x94,0x79,0x6F,0xFE,0x54,0xE7,0xA6,0x64,0x69,0xC1,0xA6,0x87,0x6D,0x25,0xFE,0x4C,0x07,
+0x8C,0xAC,0x97,0xCC,0x05,0xC9,0x14,0x05,0xCE,0x13,0x22,0x3D,0xC0,0x41,0x3D,0x69,0x3D,0x36,0x3D,0xC3,0xA4,0x67,0x3D,0xC6,0x26,0x3D,0x36,0x3D,0x36,0x3D,0xC0,0x2D,
+0x1E,0x9E,0xB8,0xA3,0xB8,0x74,0x37,0xC1,0x3A,0xC5,0x20,0x1D,0x2D,0xC7,0x69,0x2D,0xC2,0x39,0x05,0xD2,0x14,0x05,0xC1,0xB0,0x95,0x05,0xC0,0x12,0xAD,0x61,0xC4,0x1A,
+0x18,0x8B,0xBF,0x0F,0x05,0xCB,0x14,0x05,0xCB,0xAB,0x86,0xA8,0x87,0x3D,0xC0,0x41,0x3D,0x36,0x3D,0x36,0x3D,0xC3,0xA4,0x67,0x3D,0xC7,0xA3,0x87,0x9A,0xC9,0x1E,0x9E,
+0xB8,0x35,0x25,0xC0,0x37,0xC0,0x3A,0xCB,0xFE,0x61,0xE7,0x1D,0x2D,0xC1,0x26,0x2D,0xC1,0x26,0xC0,0x2D,0xC1,0x26,0x22,0x60,0x05,0xCE,0x14,0x05,0xC4,0xA6,0x87,0xA9,
+0x85,0x05,0xC0,0xFE,0x3C,0x62,0xB1,0x74,0xC3,0x95,0xAD,0x99,0xFE,0xAE,0x23,0x9D,0x76,0x06,0x97,0xCC,0xA6,0x66,0xAF,0x43,0xA7,0x87,0x91,0xBD,0x9B,0xCC,0x24,0x2B,
+0x08,0x05,0xCA,0x14,0x05,0xC3,0xB4,0x67,0x9C,0x88,0x07,0x3D,0x6E,0x3D,0xC5,0x02,0x3D,0xC2,0xA3,0x87,0x3D,0xC0,0x26,0x1E,0x61,0xA0,0xC7,0xA2,0xA7,0xA1,0xA9,0xC0,
+0x7A,0xC0,0x7A,0xC1,0x3A,0xCC,0x20,0x09,0x2D,0xC6,0x26,0x2D,0xA7,0x65,0xC1,0xA8,0x66,0x8F,0x9A,0x17,0x05,0xCF,0x14,0xAA,0x44,0xAA,0x53,0xA9,0x77,0x9F,0x65,0x24,
+0x15,0x10,0xC0,0x2C,0xFE,0x76,0x87,0x69,0xC2,0xFE,0x54,0xE7,0xFE,0x6B,0xAB,0xFE,0x6D,0x69,0x1A,0x29,0x13,0xAE,0x63,0x1A,0x18,0x92,0x9E,0xFE,0x00,0xA0,0x17,0x15,
+0x98,0x99,0x14,0x55,0xC9,0x14,0x05,0xC2,0xB0,0x74,0xA3,0x99,0x99,0x9C,0xC0,0xA3,0x87,0x3D,0xC3,0x41,0x3D,0x69,0x3D,0xC1,0x2D,0xA0,0xC6,0x9E,0xB6,0x25,0xC0,0x37,
+0xC0,0x9D,0xB9,0x6E,0xC5,0xA2,0x88,0xC0,0x3A,0xCC,0x20,0x1D,0x41,0x2D,0xC3,0xA7,0x65,0xC5,0xA8,0x74,0x17,0x05,0xCF,0xAF,0x33,0x2C,0xAD,0x52,0x1A,0x18,0xC0,0x8A,
+0x9E,0xFE,0x00,0x60,0x05,0xA5,0x87,0xAE,0x34,0xFE,0x55,0x63,0x18,0xC2,0x99,0x9C,0xFE,0x5B,0xAA,0xAA,0x65,0x18,0x0A,0xA6,0x89,0x18,0xC2,0xFE,0x23,0x41,0x05,0x2B,
+0xA3,0x67,0x99,0xBB,0x05,0xCB,0x14,0x05,0xC0,0xB5,0x84,0x9B,0x89,0x9C,0x9C,0xC0,0xA3,0x87,0x3D,0xC2,0x69,0x9D,0xC9,0x1E,0x9E,0xC8,0x35,0x25,0xA1,0xA9,0xC0,0x3A,
+0xC0,0x7A,0x7E,0x3D,0xC0,0x3A,0xC0,0x61,0xC3,0x3D,0x29,0xC1,0x3D,0x29,0x3A,0xC9,0x20,0x1D,0x41,0xA4,0x76,0xC8,0x13,0xC0,0xA5,0x77,0x17,0x9D,0x9A,0xCC,0x14,0x05,
+0x2B,0x0E,0x1F,0x18,0xC2,0x1A,0x08,0x05,0xC1,0xFE,0x3C,0x62,0xAA,0x76,0x18,0xC2,0x39,0xA7,0x97,0x1A,0x18,0x97,0x9A,0x18,0xC2,0x25,0xFE,0x09,0x81,0x05,0x32,0x2B,
+0x05,0xC9,0x14,0x05,0xC1,0xA6,0x87,0xAF,0x85,0x9B,0x89,0x9C,0x9C,0x69,0x26,0x1E,0x61,0x16,0x35,0x74,0x37,0xC0,0x7A,0x7A,0xC0,0x3A,0xC0,0x29,0xC1,0xA4,0x87,0x66,
+0x3D,0xC0,0x3A,0xC0,0x05,0x3D,0x05,0x3D,0xC1,0x3A,0xC0,0x29,0xC0,0x3A,0xC9,0x20,0x09,0x1D,0xC2,0x13,0x1D,0xC2,0x13,0x1D,0x13,0xC0,0xA5,0x77,0x8B,0x9D,0xC9,0x14,
+0x05,0xC3,0xB8,0x21,0x1A,0x18,0xC4,0x97,0x9A,0xFE,0x09,0x81,0x97,0xCC,0x05,0x32,0x2C,0x69,0x18,0xC0,0x6F,0x18,0xC2,0x3B,0xAE,0x76,0x1A,0x18,0xC1,0xFE,0x23,0x03,
+0x05,0xC0,0x10,0x0F,0x05,0xCC,0x3C,0x20,0x99,0xC6,0xA0,0xA7,0xA2,0xA7,0xC0,0x37,0xC0,0x3A,0x3D,0x7E,0x3D,0x05,0xC0,0x3D,0xC0,0x65,0x05,0x3D,0x05,0xC1,0x3D,0xC0,
+0x05,0x3D,0x05,0xC1,0x6E,0x05,0x29,0xC1,0x3D,0x29,0x3A,0xCA,0x20,0x5A,0x41,0xA4,0x76,0xC3,0x59,0x1D,0x13,0xC2,0xA5,0x77,0x96,0x8A,0x96,0x8A,0x66,0xC9,0x14,0x05,
+0xC2,0x32,0x1A,0x18,0xC5,0x8F,0xAD,0xFE,0x00,0xA0,0x17,0xA5,0x67,0xFE,0x65,0xA7,0x1A,0x9A,0x89,0x18,0xC4,0x15,0x9B,0xDE,0xBB,0x30,0x18,0xC1,0x39,0x0F,0x05,0x2B,
+0x37,0x0A,0x05,0xC9,0x14,0x05,0x3C,0xFE,0x89,0x40,0xA1,0xA9,0xC0,0x3A,0x3D,0x29,0xC1,0xA3,0x98,0x3D,0xA2,0x87,0x05,0xC0,0x3D,0xC0,0x31,0x05,0x3D,0x05,0xC1,0x0A,
+0x05,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x3D,0x3A,0xCE,0xFE,0x61,0xE7,0xC0,0x1D,0xC2,0x13,0x1D,0x13,0xC0,0x1D,0xC2,0xA7,0x76,0x8D,0x8B,0x9C,0x8A,0xCC,0x14,0x05,0xC0,
+0x32,0x1A,0x18,0xC5,0x9D,0x9A,0x0C,0x8E,0xDD,0x05,0x39,0x18,0xC0,0x99,0x9B,0x18,0xC2,0x9D,0x9B,0xFE,0x02,0x00,0x95,0xEE,0xBA,0x31,0x1A,0x18,0xC0,0x25,0x28,0x05,
+0xC0,0x3F,0x19,0x76,0x05,0xC9,0x14,0xB2,0x74,0x37,0xC0,0x3A,0xC0,0x3D,0x51,0xC0,0xA3,0x98,0x3D,0x05,0xC1,0x6E,0x05,0x29,0xC4,0x3D,0x05,0x3D,0xC0,0x31,0x05,0xC0,
+0x3D,0xC0,0x31,0x05,0xC0,0x3A,0xCD,0x20,0xC0,0xA2,0x56,0xC3,0x13,0x1D,0x13,0xC0,0x1D,0xC1,0xA7,0x54,0x89,0xAF,0xCC,0x14,0x05,0xC1,0x32,0x1A,0x18,0xC6,0x0E,0x19,
+0x17,0x32,0x1A,0x18,0xC1,0x25,0x18,0xC0,0x92,0x9E,0x19,0x9D,0xAA,0x2B,0xBA,0x21,0xFE,0x76,0x87,0x18,0xC0,0x10,0x19,0x0A,0x05,0xAB,0x55,0x0F,0x05,0xC9,0x14,0xB2,
+0x74,0x37,0x3D,0xC0,0x3A,0xC0,0x61,0xA3,0x98,0x3D,0x05,0xC1,0x6E,0x05,0xC0,0x29,0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x3D,0xC0,0x05,0x0A,0x05,0xC1,0x3D,0xC0,0x31,0x05,
+0x3A,0xCC,0x20,0x09,0x1D,0x13,0xC1,0x1D,0xC2,0x13,0x1D,0x13,0xC0,0x1D,0x90,0x6A,0xD0,0x0C,0x1A,0x18,0xC3,0x1A,0x18,0xC1,0x0C,0x8E,0xDD,0xAE,0x54,0xFE,0x76,0x09,
+0x18,0xC2,0x25,0x0E,0xFE,0x0A,0x00,0x0A,0x05,0xC0,0xA8,0x55,0x39,0x18,0x1A,0x0C,0x0A,0x05,0xC0,0x3F,0x9D,0x78,0x05,0xCA,0x3C,0xA7,0xF6,0xFE,0xB1,0x81,0x3D,0xC0,
+0x65,0x29,0xC1,0x3D,0x05,0xC0,0x3D,0x05,0xC1,0x29,0xC1,0x3D,0x05,0xC1,0x3D,0xC0,0x31,0x05,0xC1,0x3D,0xC0,0x31,0x05,0x3A,0xCD,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x59,
+0xC1,0x1D,0x13,0xC1,0x1D,0xA5,0x66,0x9B,0x89,0x90,0x9C,0xC9,0x14,0x05,0xC4,0x10,0x0D,0x18,0xC2,0x1A,0x18,0xC2,0x39,0x0F,0x10,0x0D,0x18,0xC1,0x1A,0x18,0xC0,0x3B,
+0xFE,0x09,0x81,0x0F,0x05,0xC0,0x2B,0x12,0x0D,0x3E,0x05,0xC2,0xAB,0x86,0x0F,0x05,0xC9,0xA5,0x88,0xB4,0xA1,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x3D,0xC0,0x31,0x05,0x3A,
+0xC0,0x3D,0xC0,0x3A,0x05,0x3D,0x3A,0x29,0xC0,0x05,0x6E,0x05,0xC2,0x3D,0xC0,0x31,0x05,0x3A,0xC0,0x3D,0x3A,0xCE,0xFE,0x61,0xE7,0xC0,0x1D,0xC0,0x13,0xC5,0x1D,0xC0,
+0xA7,0x54,0x94,0x9A,0x95,0x9D,0xC9,0x14,0x05,0xC4,0x10,0xFE,0x65,0xA7,0x1A,0x18,0xC3,0x1A,0x18,0xC0,0x99,0x9C,0xFE,0x01,0x60,0x73,0x36,0x18,0xC1,0x1A,0x18,0xC1,
+0x2C,0x92,0xBE,0x28,0x05,0xC0,0x2B,0xBA,0x21,0x3E,0x05,0xC2,0xA6,0x87,0x37,0x99,0xBB,0x05,0xC9,0xA9,0x97,0xA7,0xF3,0xFE,0xA1,0x60,0xA1,0xA9,0x3D,0x05,0xC1,0x29,
+0xC1,0xA4,0x87,0xC0,0x05,0x29,0xC1,0x0A,0xC1,0x05,0xC3,0x3D,0xC0,0x31,0x05,0x46,0xC0,0x3D,0x3A,0xCD,0x20,0xC0,0x1D,0xC0,0x59,0xC3,0x1D,0x13,0xC1,0xA8,0x66,0x8F,
+0x9A,0x9A,0x8B,0x66,0xCC,0x14,0x05,0xC1,0xFE,0x5C,0xE8,0x18,0xC1,0x1A,0x18,0xC4,0x0C,0x37,0x36,0x18,0xC5,0x9D,0x9A,0x18,0x25,0xFE,0x23,0x03,0x05,0xC0,0x2B,0x10,
+0x97,0xBB,0x05,0xC2,0x10,0x0F,0x05,0xCA,0x16,0x09,0x33,0xA1,0xA9,0x51,0x05,0x29,0xC1,0x05,0x6E,0x05,0xC1,0x29,0xC0,0x05,0x0A,0x05,0x3D,0xC0,0x05,0x0A,0x05,0x3D,
+0x3A,0x29,0xC2,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xC9,0x20,0xC0,0x1D,0xC0,0x13,0xC0,0x1D,0xC2,0x13,0x1D,0x13,0xA8,0x66,0x17,0x9D,0x9A,0xD1,0x2C,0x1F,0x18,0xC2,0x1A,
+0x18,0xC2,0x3B,0x32,0x36,0x1A,0x18,0xC4,0x1A,0x18,0xC1,0x0E,0x0C,0x8E,0xDD,0x2B,0x37,0x9C,0x99,0x17,0x05,0xC0,0xAA,0x66,0xA5,0x55,0x0A,0x05,0xCA,0xAF,0x84,0x04,
+0xFE,0xB1,0x81,0xC0,0x3D,0x5A,0x29,0xC0,0x05,0x3D,0x05,0xC1,0x29,0xC0,0x05,0x3D,0x05,0xC1,0x6E,0x05,0xC1,0x3D,0x3A,0x29,0xC0,0x05,0x3A,0xCE,0x20,0x41,0x1D,0x13,
+0xC2,0x1D,0x13,0x1D,0xC2,0x39,0x89,0xAF,0xCB,0x14,0x05,0xC4,0xB4,0x42,0xBB,0x30,0x18,0xC4,0x06,0x18,0xC0,0x97,0x9A,0xFE,0x09,0x81,0x19,0x18,0xC6,0x9D,0x9A,0x18,
+0xC1,0x0D,0x89,0xBE,0x05,0xA3,0x87,0xA7,0x78,0x9A,0x88,0x17,0x05,0xC0,0xAF,0x44,0x10,0xC0,0x96,0xBB,0x05,0xC9,0xB2,0xE3,0xFE,0x99,0x61,0xC0,0x3A,0xC0,0x29,0xC1,
+0xA3,0x98,0x6E,0x05,0x3D,0xC0,0x31,0x05,0xC1,0x0A,0x05,0xC3,0x29,0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xCB,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x13,0x1D,0xC2,0x13,0x1D,
+0xA5,0x66,0x22,0x8D,0x9D,0xC9,0x14,0x05,0xC6,0x10,0x0D,0x18,0xC5,0x9D,0x9A,0x18,0xC0,0xFE,0x0A,0x00,0xFE,0x76,0x09,0x18,0xC4,0x1A,0x18,0xC4,0x25,0xFE,0x09,0x21,
+0x99,0xBB,0x32,0x10,0x97,0xBB,0x10,0xC0,0x59,0x9C,0x99,0xC0,0x10,0x0F,0x05,0xC8,0x22,0xFE,0x8A,0x21,0x3D,0xC0,0x3A,0xC0,0x29,0xA3,0x98,0xC0,0x3D,0x05,0xC1,0x6E,
+0x05,0x29,0x3D,0xC0,0x0A,0x05,0xC1,0x29,0xC2,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xCB,0x20,0xC0,0x1D,0xC2,0x59,0x1D,0x13,0xC0,0x1D,0xC0,0x36,0x9B,0x89,0x90,0x9C,0xCA,
+0x14,0x05,0xC6,0xFE,0x54,0xE7,0x18,0xC5,0x9D,0x9A,0x18,0xC0,0xFE,0x23,0x41,0x0D,0x18,0xC3,0x1A,0x18,0xC5,0x25,0x37,0x99,0xBB,0x05,0x10,0x37,0x32,0x2B,0xA2,0x79,
+0x32,0x2B,0x03,0x10,0x97,0xBB,0x05,0xC7,0xAC,0x87,0x04,0xFE,0xB1,0x81,0xC0,0x29,0xC1,0x3D,0x05,0xC2,0x3D,0xC0,0x31,0x05,0x3A,0xC0,0x3D,0x05,0x3D,0x3A,0x29,0xC0,
+0x05,0x3A,0xD1,0x20,0xC0,0x1D,0xC2,0x13,0x1D,0x13,0xC0,0x1D,0xC0,0xA5,0x66,0x96,0x88,0x95,0x9D,0xCA,0x14,0x05,0xC6,0xB8,0x10,0x1A,0x18,0xC4,0x1A,0x18,0xC0,0x92,
+0x9B,0x1A,0x18,0xC5,0x1A,0x18,0xC3,0x0E,0xFE,0x00,0xA0,0x05,0x2B,0x10,0x0A,0x05,0x10,0x37,0xC0,0x32,0xA6,0x44,0x9C,0x99,0x17,0x05,0xC7,0xAB,0x86,0x04,0xFE,0xB1,
+0x81,0xC0,0x29,0x31,0x05,0x29,0x3D,0xC0,0x3A,0x05,0x31,0x05,0x29,0x3D,0xC1,0x3A,0xC0,0x29,0xC0,0x3A,0x29,0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xCB,0xFE,0x61,0xE7,
+0x5A,0x41,0xA4,0x76,0xC0,0x13,0x1D,0xC3,0x13,0xA9,0x77,0x90,0x89,0x17,0x9D,0x9A,0xCC,0x14,0x05,0xC3,0x10,0x0D,0x18,0xC3,0x1A,0x18,0xC1,0x0E,0x1A,0x18,0xC6,0x1A,
+0x18,0xC2,0x3B,0x05,0xC0,0x03,0x0A,0x05,0xC4,0xAF,0x33,0x9C,0x99,0x2B,0x9B,0xAA,0x05,0xC6,0x22,0xFE,0x99,0x61,0xA2,0xA7,0x66,0x29,0xC3,0x3D,0x05,0xC2,0x31,0x29,
+0xC1,0x05,0x29,0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xCF,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x13,0x1D,0xC4,0xA7,0x76,0x8D,0x8B,0x9C,0x8A,0xCD,0x14,0x05,0xC4,0xFE,0x44,
+0xC5,0x18,0x1A,0x18,0xC4,0x9D,0x9A,0x18,0x9D,0x9B,0x18,0xC4,0x1A,0x18,0xC4,0xFE,0x02,0x00,0x19,0x03,0x32,0x05,0xC1,0x32,0x2B,0x03,0x5C,0xA2,0x97,0x2E,0x28,0x05,
+0xC6,0x2B,0xB4,0xA2,0xFE,0x99,0x61,0x0A,0x66,0xC1,0x29,0xC0,0x05,0x3D,0x05,0xC1,0x0A,0x05,0xC0,0x29,0xC2,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xD1,0x20,0xC0,0x1D,0xC2,
+0x13,0x1D,0x13,0xC0,0x1D,0xC0,0xA8,0x55,0x17,0x9D,0x9A,0xC9,0x14,0x05,0xC8,0xB4,0x42,0xBB,0x30,0x18,0xC5,0x06,0x18,0x99,0x9C,0x18,0xC1,0x1A,0x18,0xC6,0x39,0xFE,
+0x00,0xA0,0x2B,0xA3,0x67,0x19,0x9D,0xAA,0x05,0xC4,0xA2,0x77,0xA9,0x66,0xC0,0x0A,0x05,0xC5,0x22,0x04,0xFE,0xB1,0x81,0xC1,0x3D,0xC0,0x05,0x6E,0x05,0xC0,0x3D,0x05,
+0xC1,0x0A,0x05,0x29,0x3D,0x29,0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xD0,0x20,0xC0,0x5A,0x13,0xC1,0x7B,0x13,0x1D,0xC1,0xA7,0x54,0xC0,0x89,0xAF,0xCC,0x14,0x05,0xC6,
+0x10,0xBF,0x40,0x1A,0x18,0xC1,0x1A,0x18,0xC2,0x97,0x9A,0x18,0xC3,0x1A,0x18,0xC0,0x2C,0x0D,0x25,0x0E,0x3E,0x24,0x2E,0xC1,0x10,0xC0,0x59,0xC0,0x2B,0x37,0x07,0x24,
+0x06,0x07,0x37,0x99,0xBB,0x05,0xC3,0xA6,0x87,0xB3,0xA2,0xFE,0x99,0x61,0xA2,0xA7,0x66,0x56,0xC0,0x05,0x0A,0x05,0xC1,0x3D,0xC0,0x05,0x0A,0x05,0xC0,0x29,0xC5,0x3D,
+0x29,0xA2,0x78,0xC0,0x05,0x3A,0xCE,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x13,0x1D,0xC3,0x39,0xC0,0x89,0xAF,0xC9,0x14,0x05,0xCA,0xFE,0x43,0xE6,0x1A,0x18,0xC4,0x9D,0x9A,
+0x18,0x94,0x8B,0x25,0xC0,0x50,0xC4,0x2C,0x25,0xC0,0x88,0xAF,0x19,0x76,0x05,0xC0,0x6E,0x05,0xC0,0xA8,0x55,0x10,0xC0,0x28,0xC0,0x10,0x19,0x32,0x2B,0x05,0xC4,0xB0,
+0xA6,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x6E,0x05,0xC3,0x0A,0x05,0xC3,0x29,0xC1,0x05,0x0A,0x05,0x3D,0xC0,0x3A,0xC0,0x29,0xC0,0x3A,0x29,0x3A,0xCE,0x20,0x5A,0x41,0xA4,
+0x76,0xC0,0x13,0x1D,0xC3,0x36,0x22,0x8D,0x9D,0xCA,0x14,0x05,0xC9,0x3F,0xFE,0x65,0xA7,0x1A,0x18,0xC5,0x25,0xC0,0x1A,0xC0,0x18,0xC6,0x8F,0xAD,0xFE,0x00,0x60,0x05,
+0xC7,0x32,0x2B,0x03,0x5C,0x05,0xC5,0xAB,0x86,0x04,0x29,0xC1,0x3D,0x7E,0xC2,0x0A,0x05,0xC3,0x0A,0x3D,0xC0,0x0A,0xC0,0x05,0x29,0xC1,0x3A,0xD4,0xFE,0x61,0xE7,0xC0,
+0x1D,0xC2,0x13,0x1D,0x13,0xC0,0x1D,0xA7,0x76,0x9A,0x87,0x8F,0x8E,0xCA,0x14,0x05,0xCA,0x12,0x18,0xC2,0x1A,0x18,0xC2,0x97,0x9A,0x18,0xC1,0x1A,0x18,0xC4,0x25,0x28,
+0x05,0xC9,0x32,0x10,0x05,0xC4,0x2B,0xB3,0x93,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x6E,0xC0,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0x3D,0xC0,0x31,0x05,
+0x3A,0xC0,0x3D,0x3A,0xCF,0x20,0x5A,0x06,0xA4,0x76,0xC0,0x13,0x1D,0xC3,0x0D,0x99,0x79,0x90,0x9C,0xCD,0x14,0x05,0xC7,0xAF,0x54,0xFE,0x76,0x09,0x18,0xC1,0x1A,0x18,
+0xC2,0x97,0x9A,0x18,0xC2,0x1A,0x18,0xC4,0xFE,0x02,0x00,0x92,0xFF,0x05,0xC4,0x0F,0x05,0xC2,0xAB,0x86,0x0F,0x05,0xC3,0xB5,0x84,0xFE,0x8A,0x21,0x3D,0xC1,0xA2,0x87,
+0xC0,0x9D,0x99,0xA2,0x88,0x29,0x3D,0xC0,0x05,0x3D,0x0A,0xC0,0x05,0xC3,0x0A,0x3D,0x0A,0x29,0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xCE,0xFE,0x61,0xE7,0x5A,0x41,0xA4,
+0x76,0xC0,0x13,0x1D,0xC3,0x0D,0x98,0x78,0x92,0x8C,0x66,0xCD,0x14,0x05,0xC6,0x2E,0xB7,0x41,0x18,0xC3,0x1A,0x18,0xC0,0x97,0x9A,0xA6,0x89,0x18,0xC1,0x1A,0x18,0xC4,
+0xFE,0x1B,0x41,0xFE,0x00,0x40,0x05,0xC4,0xA2,0x77,0x05,0xC2,0xA6,0x87,0xA2,0x56,0x05,0xC2,0xAB,0x86,0xFE,0x8A,0x21,0x3D,0xC0,0x29,0xC0,0xA3,0x98,0x6E,0x05,0x3D,
+0x05,0x3D,0x05,0xC1,0x0A,0x05,0xC2,0x3D,0x05,0xC1,0x29,0xC0,0x05,0x46,0xD4,0xFE,0x61,0xE7,0x5A,0x06,0xA4,0x76,0xC0,0x13,0x1D,0xC3,0xA7,0x76,0x94,0x78,0x95,0x9D,
+0xCB,0x14,0x05,0xC8,0x3F,0xFE,0x54,0xE7,0x35,0xA9,0x97,0x18,0xC3,0x9D,0x9B,0x25,0x35,0x0E,0x25,0x18,0xC4,0x1A,0x18,0xC0,0x3B,0xFE,0x00,0x40,0x05,0xC4,0xA2,0x77,
+0x05,0xC2,0x3F,0x9D,0x78,0x05,0xC1,0x3F,0xAD,0xF4,0xFE,0xA1,0xC1,0x31,0x29,0x66,0x29,0xA3,0x98,0x3D,0xC0,0x31,0x05,0xC1,0x6E,0xC0,0x05,0xC3,0x0A,0x3D,0x0A,0x05,
+0x31,0x05,0x29,0x3D,0xC0,0x3A,0xD2,0x20,0x41,0x1D,0x13,0xC4,0x1D,0x13,0x04,0x91,0x8C,0x17,0x9D,0x9A,0xCD,0x14,0x05,0xC5,0xFE,0x43,0xE6,0xAE,0x41,0x25,0xC0,0x18,
+0xC1,0x1A,0x18,0x06,0x18,0xC2,0x25,0x0E,0x0D,0x18,0xC4,0x8A,0x9E,0x0F,0x05,0xC9,0x14,0xAA,0x44,0x05,0xC0,0x03,0xB0,0xA4,0xFE,0xA1,0xC1,0x31,0xC0,0xA2,0x88,0x9D,
+0x89,0x3D,0xC0,0x3A,0x29,0xC0,0x05,0x0A,0x05,0x3D,0x05,0xC0,0x3D,0x0A,0xC1,0x05,0xC3,0x29,0xC0,0x3A,0xD4,0x20,0xC0,0xA2,0x56,0x13,0xC1,0x1D,0x13,0x1D,0xC0,0x13,
+0x04,0x91,0x8C,0x97,0x9C,0xD5,0xAF,0x54,0xFE,0x76,0x09,0x25,0x18,0x92,0x9B,0x1A,0x18,0xC4,0x06,0x18,0xC2,0x9D,0x9B,0x25,0x0D,0x18,0xC2,0x8A,0x9E,0x0F,0x05,0xCA,
+0x10,0x0F,0x05,0x36,0xA0,0xF7,0xFE,0xB1,0x81,0xC0,0x9D,0x89,0x7E,0x05,0x3D,0xC0,0x31,0x05,0xC1,0x0A,0xC1,0x05,0xC3,0x0A,0x3D,0x29,0xC1,0x05,0x29,0x3A,0xD5,0x20,
+0xC0,0x1D,0x13,0xC3,0x1D,0x13,0xC0,0xA8,0x66,0x8F,0x9A,0x17,0x9D,0x9A,0xD0,0x14,0x05,0xC1,0x1C,0xAD,0x51,0x97,0x99,0x0D,0x0E,0x25,0x18,0xC1,0x1A,0x18,0xC7,0x25,
+0x0E,0x25,0x18,0x1A,0x8B,0x9D,0x10,0xC0,0x59,0x99,0xBB,0x17,0x05,0xC0,0x6E,0xC0,0x05,0xC1,0x37,0x07,0x05,0xB0,0x74,0x35,0x09,0x9E,0xB9,0x3D,0xC0,0x65,0x05,0xC1,
+0x6E,0xC2,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x3D,0xC0,0x3A,0xC0,0x61,0xC0,0x3A,0x29,0x3A,0xD2,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x13,0x1D,0xC3,0xA7,0x76,0x90,0x79,
+0x17,0x9D,0x9A,0xD1,0x14,0x05,0xC0,0xBF,0x20,0x1F,0x97,0x99,0xA6,0x89,0xC0,0x24,0x1A,0x18,0xC2,0x1A,0x18,0xC7,0x24,0x98,0x8B,0x0E,0x3E,0x9A,0xAC,0x9C,0x99,0x28,
+0xC0,0x10,0x19,0x37,0x32,0x06,0x10,0xC0,0x06,0xC0,0x97,0xCC,0x16,0x35,0x09,0x9B,0xBA,0xA3,0x98,0x3D,0xC0,0x65,0x05,0xC1,0x6E,0xC2,0x3D,0xC0,0x3A,0x05,0x31,0x0A,
+0x05,0xC3,0x0A,0x3D,0x29,0x3A,0xD6,0x20,0xC0,0x1D,0x13,0xC4,0x1D,0x13,0xA8,0x74,0x8F,0x8C,0x17,0x9D,0x9A,0xD2,0x14,0x05,0xB8,0x21,0x1A,0x95,0x8A,0x25,0x0D,0x25,
+0x35,0xAD,0x86,0x18,0xC2,0x1A,0x18,0xC5,0x25,0xFE,0x23,0x03,0x05,0xAF,0x33,0x58,0x37,0x99,0xBB,0x05,0xC9,0x2B,0xAD,0xF5,0xFE,0x99,0x61,0x29,0xC1,0x3D,0x29,0x3A,
+0xC0,0xA1,0xA8,0x6E,0x05,0xC2,0x29,0xC1,0x3D,0x05,0xC2,0x0A,0x05,0x3D,0xC0,0x65,0x05,0x3A,0xC0,0x3D,0x3A,0xD3,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x59,0x1D,0xC3,0xA7,
+0x76,0x94,0x78,0x95,0x9D,0xC9,0x14,0x05,0xC9,0xA8,0x55,0xFE,0x6D,0x69,0x93,0x67,0x15,0x0E,0x1F,0x8F,0xAC,0x18,0xC3,0x1A,0x18,0xC4,0x92,0x9E,0x8A,0xCE,0x37,0xA3,
+0x77,0x0C,0x37,0x99,0xBB,0x05,0xCA,0x36,0x09,0x31,0xA2,0x88,0x56,0xC0,0x31,0x56,0xC0,0x05,0x6E,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x3D,0x05,0x3D,0x0A,0xC1,0x3D,
+0xC0,0x3A,0xC0,0x29,0xC0,0x3A,0x29,0x3A,0xD1,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x59,0x1D,0xC3,0x0D,0x94,0x78,0x95,0x9D,0xCA,0x14,0x05,0xC9,0x0C,0x98,0x99,0x0F,0xB6,
+0x21,0x1A,0xFE,0x0A,0x00,0x39,0x18,0x1A,0x18,0xC2,0x1A,0x18,0xC0,0x97,0x9A,0x19,0x05,0x24,0x10,0xAA,0x53,0x06,0x0F,0x05,0xCA,0x3C,0xA7,0xF6,0xFE,0xB1,0x81,0x3D,
+0xA2,0x87,0xC1,0x3D,0x29,0xC0,0x0A,0xC2,0x05,0xC3,0x0A,0x3D,0x29,0x3A,0x05,0x3D,0x05,0xC1,0x29,0xC0,0x05,0x3A,0xD6,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x59,0x1D,0xC3,
+0x0D,0x12,0x95,0x9D,0xCB,0x14,0x05,0xCB,0xAF,0x54,0xFE,0x65,0xA7,0x88,0x9D,0xAE,0x73,0x25,0x18,0xC1,0x1A,0x18,0xC0,0x99,0x9C,0x12,0xFE,0x0A,0x00,0x92,0xEF,0x05,
+0xC0,0x2E,0x13,0x0A,0x05,0xCA,0x14,0xB2,0xA6,0x09,0x9C,0xB9,0xA2,0x88,0x6E,0x05,0x29,0xC1,0x05,0x3D,0x0A,0xC1,0x3D,0x0A,0x05,0xC3,0x29,0xC0,0x05,0x3D,0xC0,0x31,
+0x05,0x3A,0xC0,0x3D,0x3A,0xD6,0x20,0x5A,0x06,0xA4,0x76,0xC0,0x59,0x1D,0xC3,0xA5,0x66,0x9B,0x89,0x90,0x9C,0xCB,0x14,0x05,0xCB,0xAF,0x54,0xB7,0x31,0x2C,0x1A,0x0E,
+0x1F,0x18,0xC1,0x25,0x35,0x25,0x91,0x9C,0x0F,0x05,0xC0,0x6E,0x2E,0x98,0x99,0x05,0xC9,0x14,0x05,0x2B,0xAF,0xF4,0x09,0x9E,0xB9,0x6E,0x05,0xC1,0x9D,0x89,0xC0,0x05,
+0x0A,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0x51,0x3D,0x05,0xC0,0x3D,0x3A,0x29,0xC0,0x05,0x3A,0xD8,0x20,0x41,0x1D,0x13,0xC5,0x1D,0x36,0x9C,0x97,0x8F,0x8E,0xCB,0x14,0x05,
+0xC9,0x24,0x39,0xA7,0x97,0x9B,0x77,0xA9,0x97,0x18,0xC0,0x0E,0xA2,0x75,0xC0,0x9B,0x9A,0x0A,0xA6,0x89,0x0E,0xFE,0x00,0xA0,0x17,0x05,0xC0,0x2E,0x9C,0x88,0x0F,0x05,
+0xCB,0x3C,0xFE,0x8A,0x21,0x3D,0xC0,0xA2,0x87,0x66,0x29,0xC1,0x05,0x0A,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x3D,0x05,0xC1,0x3D,0xC0,0x31,0x05,0x3A,0xC0,0x3D,0x3A,
+0xD6,0x20,0xC0,0x1D,0xC0,0x13,0xC0,0x1D,0x13,0xC2,0x1D,0xA6,0x52,0xFE,0x00,0x20,0xCF,0x14,0x05,0xC3,0x10,0xB3,0x42,0x36,0x18,0xC1,0x25,0x18,0xC1,0x1A,0x18,0xC0,
+0x2C,0x0E,0x3E,0x0C,0xA5,0x76,0xAA,0x51,0x0E,0x15,0x05,0x17,0x05,0xC9,0x14,0x05,0x3C,0xFE,0x99,0x61,0x0A,0xC0,0x66,0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x3D,0x05,0xC1,
+0x29,0xC1,0x3D,0x05,0xC2,0x31,0x29,0xC1,0x05,0x29,0x3A,0xD6,0x20,0xC0,0x1D,0xC0,0x59,0xC0,0x1D,0x13,0xC2,0x1D,0xA5,0x66,0x8B,0x9D,0xD4,0xAF,0x54,0x0E,0x1F,0x18,
+0xC2,0x25,0x18,0xC5,0x9D,0x9A,0x18,0x0D,0x18,0xC0,0x2C,0xFE,0x01,0x60,0x05,0xC9,0x14,0x05,0xC1,0x16,0xAB,0xE4,0xFE,0xB1,0x81,0x3D,0x05,0xC1,0x0A,0x05,0xC2,0x29,
+0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x0A,0xC0,0x05,0xC3,0x0A,0x3D,0x29,0x3A,0x05,0x3A,0xD6,0x20,0x5A,0x41,0xA4,0x76,0xC0,0x13,0x1D,0xC3,0x13,0xA8,0x66,0x17,0x9D,0x9A,
+0xD1,0x2B,0x15,0x0D,0x18,0xC4,0x9D,0x9A,0x0D,0x18,0xC3,0x2C,0x91,0x9B,0xFE,0x12,0x02,0xAF,0x64,0x1A,0x18,0x12,0x19,0x05,0xC9,0x14,0x05,0xC2,0x00,0xFE,0xA1,0xC1,
+0x9B,0xBA,0xC1,0x3D,0x29,0x3A,0xA1,0xA8,0x3D,0xC0,0x65,0x05,0xC1,0x0A,0xC1,0x3D,0xC0,0x3A,0x05,0x31,0x0A,0x05,0x3D,0x3A,0x29,0xC0,0x05,0x3A,0xD7,0x20,0x5A,0x9B,
+0xC7,0x60,0x2B,0x49,0xA3,0x7B,0x5A,0xA4,0x65,0xC2,0xA9,0x77,0x90,0x89,0x97,0x9C,0xC9,0x14,0x05,0xC4,0x10,0xB4,0x53,0x1F,0x18,0xC3,0x1A,0x18,0xC0,0x97,0x9A,0x1A,
+0x18,0xC1,0x0D,0x0C,0x8E,0xDD,0x05,0xA5,0x87,0xFE,0x6D,0x69,0x1A,0x08,0x05,0xCA,0x14,0x05,0xC2,0xAB,0x86,0x04,0x29,0xA2,0x88,0xC0,0x3A,0xA1,0xA8,0x31,0xA3,0x88,
+0x05,0x31,0x05,0x29,0x3D,0xC0,0x05,0xC0,0x3D,0xC0,0x31,0x29,0xC3,0x05,0x29,0x3A,0xDA,0xFE,0x61,0xE7,0xC0,0x99,0xC6,0xA0,0xA7,0x47,0xC1,0x13,0xA2,0x79,0xC0,0x09,
+0x06,0x0F,0x93,0x99,0x95,0x9D,0xCC,0x14,0x05,0xC0,0xA5,0x87,0xFE,0x3C,0x62,0x18,0xC4,0x1A,0x18,0xC2,0x97,0x9A,0x18,0xC1,0x99,0x9C,0x37,0x05,0x17,0x32,0x1A,0x2C,
+0x37,0x05,0x17,0x05,0xC9,0x14,0x05,0xC2,0x00,0xFE,0x99,0x61,0xA2,0xA7,0xC1,0x66,0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x05,0x3D,0xC0,0x05,0x0A,0x9B,0x9A,0x29,0xC1,0x0A,
+0xC0,0x29,0xC1,0x3D,0x29,0x3A,0xC0,0x05,0x3A,0xD2,0x20,0xC0,0x13,0xA2,0x79,0x0E,0xC0,0x13,0x0E,0xC0,0x13,0x0E,0x13,0xAB,0x66,0x9F,0x38,0x8F,0x8E,0xCC,0x14,0x05,
+0xA5,0x87,0xFE,0x55,0x25,0x1A,0x18,0xC8,0x1A,0x18,0x97,0x9A,0x18,0xC1,0x0E,0x12,0x0E,0xA8,0x75,0x18,0x0A,0xFE,0x01,0x00,0x05,0xCC,0x14,0x05,0xC1,0x16,0x35,0xFE,
+0xA1,0xC1,0x9E,0xB9,0x6E,0xC0,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0xC0,0x3D,0xC0,0x31,0x05,0x3A,0xC0,0x3D,0x05,0x31,0x05,0x29,0x3D,0xC0,0x3A,0x29,0x3A,0xD5,0x20,0xC0,
+0x13,0xA0,0xA7,0x47,0xC1,0x13,0x0E,0x13,0x0E,0xC0,0x13,0x00,0x8D,0x6A,0xCD,0x2B,0x0C,0xAB,0x75,0x15,0x1D,0xA8,0x65,0xA9,0x86,0x18,0xC5,0x1A,0x18,0xC0,0x97,0x9A,
+0x98,0x9B,0x0D,0xC0,0x18,0xC0,0x0D,0x25,0x92,0xBF,0xFE,0x00,0x60,0x05,0xCF,0x14,0x05,0xB7,0x94,0x09,0x9E,0xB9,0x3D,0x05,0xC1,0x6E,0x05,0xC2,0x0A,0x05,0xC3,0x29,
+0xC0,0x05,0x0A,0x05,0x29,0xC1,0x3A,0xD9,0x20,0x41,0x9B,0xD6,0xA0,0xA7,0x0E,0xC2,0x13,0x0E,0x13,0x0E,0xC0,0xAC,0x55,0x17,0x9D,0x9A,0xCC,0x3F,0x9D,0x78,0x05,0xC2,
+0xAA,0x66,0xB5,0x42,0x1F,0x18,0xC4,0x1A,0x18,0xFE,0x23,0x41,0x05,0x17,0xA5,0x67,0x2A,0x6B,0x37,0x19,0xA1,0xAA,0x0F,0x05,0xD0,0x14,0xB2,0x74,0xFE,0x99,0x61,0x3D,
+0x7E,0x3D,0xC0,0x05,0x0A,0x05,0xC1,0x0A,0x05,0xC1,0x9D,0x89,0xC3,0x05,0x0A,0x05,0xC0,0x3D,0xC0,0x65,0x29,0xC1,0x3A,0xD5,0x20,0xC0,0x13,0x0E,0xC0,0x13,0x0E,0x13,
+0x0E,0xC2,0x13,0x28,0x97,0x2A,0x17,0x9D,0x9A,0xCA,0x10,0xC0,0x96,0xBB,0x05,0xC4,0xB8,0x21,0x1A,0x18,0xC4,0x3B,0x0F,0x05,0xC5,0x10,0x05,0xD2,0x36,0xFE,0x89,0x40,
+0x37,0xA1,0xB8,0x3D,0xC0,0x05,0x6E,0x05,0xC1,0x0A,0xC0,0x05,0x29,0xC1,0x3A,0xC0,0x3D,0xC0,0x0A,0xC0,0x31,0x3A,0xDB,0x20,0xC0,0x13,0x12,0x0E,0xC3,0x13,0x0E,0x13,
+0x0E,0xAA,0x63,0xA0,0x2B,0x90,0x7C,0xCA,0xA8,0x55,0x07,0x05,0xC7,0x32,0x1A,0x18,0xC2,0x39,0x19,0x9D,0xAA,0x05,0xC5,0x10,0x05,0xCA,0x14,0x05,0xC4,0xA6,0x87,0x1E,
+0x33,0xA1,0xA9,0x31,0xA3,0x88,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0xC1,0x3D,0xC0,0x05,0x0A,0x05,0xC1,0x0A,0x42,0xDB,0x20,0xC0,0x13,0x0E,0xC0,0x13,0x0E,0x13,0xB9,0x28,
+0x20,0x13,0x75,0xC1,0x0D,0x89,0x8D,0xCA,0x10,0x0F,0x05,0xC8,0x32,0x06,0x18,0xC0,0x97,0x9A,0xFE,0x09,0x81,0x0F,0x05,0xC6,0xA5,0x88,0x05,0xD1,0x3C,0x35,0xFE,0xA1,
+0xC1,0x29,0x3D,0xC0,0xA2,0x87,0xC0,0x31,0x3A,0x29,0xC0,0xA3,0x98,0x0A,0x05,0x0A,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x3D,0x3A,0xD9,0x20,0x5A,0x9B,0xC7,0x0E,0xC0,
+0x13,0x0E,0x28,0xFE,0xEF,0xBB,0x9D,0x9A,0x94,0x97,0x36,0x00,0x13,0xB2,0x13,0x8E,0x6C,0x17,0x9D,0x9A,0xC7,0x03,0x32,0x05,0xCA,0xFE,0x3C,0x62,0xAE,0x76,0xC0,0xFE,
+0x0A,0x00,0x92,0xEF,0x05,0xC7,0x10,0x05,0xCB,0x14,0x05,0xC2,0xA5,0x87,0xB3,0x93,0xFE,0x99,0x61,0xA2,0xA7,0xC1,0x3D,0xC0,0x3A,0xA1,0xA8,0x51,0x0A,0x05,0x0A,0x05,
+0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x3D,0x3A,0xDC,0x20,0x41,0x9B,0xD6,0x0E,0xC0,0x13,0x0E,0xAA,0x63,0xFE,0xEF,0xBB,0xA2,0x9B,0xC1,0x05,0x97,0x89,0x93,0xA9,0x85,0x88,
+0x95,0x9B,0xC8,0xA6,0x87,0xA2,0x56,0x05,0xCA,0x10,0xBF,0x40,0x93,0x67,0xFE,0x00,0x60,0x05,0xC8,0x3F,0x19,0x05,0xCC,0x14,0x05,0xC0,0xB0,0x95,0xA5,0xE6,0xFE,0xB1,
+0x81,0xC0,0x9D,0x89,0x7E,0x05,0x29,0xC0,0x05,0x0A,0x05,0x56,0x05,0xC0,0x0A,0x05,0xC3,0x0A,0x3D,0x29,0xA2,0x78,0x05,0x3A,0xDB,0xFE,0x61,0xE7,0x1D,0x0E,0xC0,0x6E,
+0x0E,0x13,0x09,0xFE,0xEF,0xBB,0xA2,0x9B,0xC3,0x05,0x80,0x88,0x84,0x9B,0xC7,0x2B,0x37,0x19,0x9D,0xAA,0x05,0xC9,0x14,0xB2,0x22,0x0A,0x05,0x2B,0x05,0xC7,0x10,0x9C,
+0x88,0x05,0xCD,0x14,0x32,0xB4,0xA1,0xFE,0x99,0x61,0x29,0xC1,0xA3,0x98,0x6E,0x05,0xC0,0x0A,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0xC2,0x3D,0x3A,0x29,0xC0,0x05,0x3A,0xDA,
+0x20,0xC0,0x13,0x75,0x0E,0xC0,0x13,0x09,0xFE,0xEF,0xBB,0x31,0xC4,0x21,0xFE,0x10,0xA0,0x9C,0x8A,0xC6,0x10,0x28,0x05,0xCB,0xAF,0x33,0xBB,0x62,0x85,0x9D,0x19,0x9D,
+0xAA,0x05,0xC7,0xAB,0x55,0x06,0x97,0xCC,0x05,0xCD,0xB7,0x94,0xFE,0xA1,0xC1,0x9E,0xB9,0x29,0xC1,0xA2,0x88,0x05,0xC2,0x6E,0x05,0x0A,0x05,0xC3,0x0A,0x3D,0x0A,0x05,
+0x51,0x3D,0x3A,0xDD,0x20,0x1D,0x9B,0xC7,0x0E,0xC1,0x13,0xA9,0x74,0xFE,0xF7,0xDD,0xA1,0x9A,0xC4,0x9C,0x74,0xFE,0x3A,0x24,0x90,0x9C,0xC6,0xAF,0x53,0x05,0xCA,0x14,
+0x05,0xFE,0x54,0xE7,0x18,0x3B,0x0F,0x05,0xC8,0x10,0x59,0x0F,0x05,0xCC,0xB5,0x84,0xFE,0x8A,0x21,0x3D,0xC0,0x0A,0x9D,0x99,0x29,0x66,0xA4,0x87,0x3D,0xC0,0x05,0x0A,
+0x05,0xC1,0x0A,0xC1,0x05,0xC3,0x0A,0x3D,0x29,0x3A,0x05,0x3A,0xDA,0x20,0x1D,0x2B,0x0E,0xC2,0x09,0xFE,0xEF,0xBB,0xA2,0x9B,0xC4,0x1B,0x30,0x80,0x9B,0x5A,0xC4,0x32,
+0xA5,0x77,0x98,0x99,0x14,0x05,0xC9,0xB4,0x42,0xBB,0x30,0x18,0x99,0x9C,0xFE,0x01,0x60,0x05,0xA3,0x87,0x05,0xC5,0xA5,0x87,0x0F,0x10,0x99,0xAA,0x17,0x05,0xC0,0x6E,
+0xC0,0x05,0xC6,0xAF,0x84,0x35,0x29,0xA3,0x98,0x6E,0x3D,0xC0,0x5A,0x05,0x51,0x0A,0x05,0x0A,0xC0,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0xC2,0x29,0xC1,0x3D,0x29,0x3A,0xC0,
+0x05,0x3A,0xD6,0x20,0xC0,0x13,0xA0,0xA7,0x0E,0xC2,0xFE,0xE7,0x5B,0xA5,0x9A,0xC5,0x97,0x85,0x3C,0x92,0x8B,0xC4,0x2B,0x37,0x97,0xDD,0x05,0xC4,0x0F,0x05,0xC2,0x2B,
+0xFE,0x6D,0x69,0x1A,0x18,0xC0,0xFE,0x23,0x41,0x05,0x17,0x05,0xC4,0x03,0x32,0x05,0x2B,0xA3,0x67,0x19,0x0A,0x05,0xC8,0xB0,0x74,0xA2,0xF7,0xFE,0x99,0x61,0x29,0x7E,
+0x29,0x24,0xA4,0x87,0x56,0xC0,0xA2,0x87,0xC0,0x31,0x0A,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0xC2,0x0A,0x05,0x29,0xC1,0x3A,0xC0,0x3D,0x3A,0xD7,0x20,0x1D,0x9B,0xC7,0x0E,
+0xC3,0xFE,0xDE,0xF8,0x1B,0xA1,0x9A,0xC4,0x1B,0x30,0x80,0x8B,0xC4,0x10,0x0F,0x05,0xCA,0xFE,0x3B,0xE5,0x1A,0x18,0xC1,0x95,0xAD,0x19,0x05,0xC4,0x03,0x5C,0x99,0xBB,
+0x05,0xC0,0x03,0x0A,0xC0,0x05,0xC4,0x0F,0x05,0xC0,0xB0,0x94,0x28,0xFE,0x99,0x61,0x29,0x7E,0x29,0xC1,0xA3,0x98,0x6E,0x05,0xC0,0x0A,0xC0,0x05,0xC3,0x0A,0x3D,0x0A,
+0x05,0xC2,0x0A,0xC0,0x05,0x29,0xC1,0x3A,0xC0,0x3D,0x3A,0xD7,0x20,0xC0,0x99,0xC6,0x12,0x47,0xC2,0x28,0x00,0xA6,0x93,0xA7,0x7C,0xC0,0xA6,0x69,0x11,0xC0,0xA3,0xA9,
+0x33,0x85,0x88,0x95,0x9B,0xC3,0x10,0x0F,0x05,0xC9,0x10,0xFE,0x65,0xA7,0x1A,0x18,0xC2,0xFE,0x02,0x00,0x19,0x9D,0xAA,0x05,0xC2,0xAB,0x55,0x9C,0x88,0x05,0xC1,0xA6,
+0x87,0x19,0x17,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0xA5,0x87,0xAB,0xB8,0xA0,0xF3,0x3D,0xC0,0xA2,0x87,0x31,0x29,0xC1,0x3D,0x7E,0xC2,0x0A,0x05,0x0A,0xC0,0x05,0xC3,0x0A,
+0x3D,0x0A,0x05,0xC2,0x29,0xA2,0x78,0xDC,0xFE,0x61,0xE7,0x41,0x13,0x0E,0xC1,0x13,0x0E,0x13,0x0E,0xC1,0x79,0xC0,0x0E,0xC0,0x13,0x0E,0x00,0x8D,0x6A,0xC3,0x10,0x97,
+0xBB,0x05,0xC9,0xBF,0x20,0xFE,0x76,0x87,0x18,0xC3,0x15,0x05,0x17,0x05,0xC0,0x17,0xA7,0x78,0x19,0x05,0xC3,0x03,0x05,0xC5,0xA6,0x87,0xAF,0x85,0xFE,0x8A,0x21,0x3D,
+0xC0,0x29,0x31,0xA2,0x88,0x29,0x3D,0xC0,0x05,0xC0,0x6E,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0xC2,0x0A,0xC1,0x05,0xC1,0x29,0xC1,0xA2,0x78,0xDA,0x20,0xC0,0x13,0x75,0x0E,
+0xC1,0x13,0x0E,0x13,0x0E,0xC1,0x0A,0x0E,0xC0,0x13,0x0E,0xAA,0x63,0x9F,0x1B,0x92,0x8C,0x66,0xC1,0x10,0x97,0xBB,0x05,0xC8,0x2B,0xFE,0x6D,0x69,0x18,0xC1,0x1A,0x18,
+0xC0,0xFE,0x54,0xE7,0x19,0x17,0x05,0xC0,0x2E,0x19,0x17,0x05,0xC0,0x0A,0xC0,0x05,0x10,0x0F,0x05,0xC3,0x3C,0xA4,0xE6,0x25,0xA1,0xA9,0xA1,0xB8,0x6E,0x05,0x29,0xC1,
+0xA2,0x78,0xC0,0x7A,0x05,0x3D,0x05,0xC1,0x0A,0x05,0xC2,0x0A,0xC0,0x05,0xC3,0x0A,0x3D,0x0A,0x05,0x31,0x3D,0x3A,0xDA,0x20,0xC0,0x13,0x75,0x0E,0xC2,0x13,0x0E,0x13,
+0x0E,0xC1,0x0A,0x0E,0xC1,0x13,0x28,0x92,0x2B,0x9C,0x8A,0xC1,0xAF,0x33,0x05,0xC9,0xB4,0x42,0xBB,0x30,0x18,0xC3,0x1A,0x9A,0x8A,0xFE,0x01,0x60,0x05,0x32,0x10,0x05,
+0xC6,0x32,0x2B,0x05,0xC1,0x2B,0x1D,0xA0,0xF3,0x9A,0xDB,0xC0,0xA1,0xB8,0x6E,0xC0,0x3D,0xC0,0x3A,0xC0,0x29,0xC0,0x3A,0x05,0x3D,0x05,0xC1,0x0A,0x05,0xC2,0x0A,0xC1,
+0x05,0xC3,0x0A,0x3D,0x29,0x3A,0x05,0x3A,0xDA,0xBC,0x56,0xC2,0x96,0x99,0xA9,0x78,0x01,0xC2,0x27,0x39,0x01,0xFD,0xFD,0xC0,0x27,0x39,0x01,0xF2,0x9C,0x88,0x9D,0x99,
+0x27,0x55,0x01,0xFD,0xC5,0x19,0x00,0x01,0xEF,0x19,0x00,0x18,0x9C,0xA9,0xA2,0x77,0x5F,0xA2,0x87,0xC0,0x01,0xFD,0xC5,0x00,0x19,0x01,0xEB,0x19,0x00,0x18,0x9A,0x99,
+0x10,0x1D,0xC5,0x01,0xFD,0xC5,0x27,0x39,0x01,0xE8,0x19,0x27,0x18,0x26,0x10,0x1D,0xC8,0x01,0xFD,0xC5,0x18,0x01,0xE6,0x19,0x27,0x3D,0x07,0xC0,0x10,0x1D,0xCA,0x01,
+0xFD,0xC5,0x27,0x39,0x01,0xE3,0x18,0x07,0x10,0x07,0x10,0x1D,0xCD,0x39,0x01,0xFD,0xC3,0x19,0x00,0x01,0xE1,0x19,0x27,0x26,0x10,0x1D,0xD1,0x07,0x10,0x00,0x19,0xC0,
+0x01,0x66,0x01,0xFB,0x00,0x19,0x01,0xDF,0x00,0x3D,0x07,0xC0,0x1D,0xCF,0x07,0x1D,0xC1,0x3C,0x01,0x19,0x00,0x18,0x07,0x10,0x1D,0x00,0x19,0x01,0x3C,0x01,0xF6,0x27,
+0x39,0x01,0xDC,0x19,0x27,0x26,0x10,0x1D,0xD6,0x01,0xC5,0x9D,0x99,0x19,0x00,0x18,0x07,0x27,0x00,0x19,0x01,0x3C,0x01,0xF1,0x27,0x39,0x01,0xDA,0x19,0x27,0x26,0x10,
+0x1D,0xD8,0x39,0x01,0xC9,0x19,0x00,0x18,0x07,0x27,0xC0,0x00,0x28,0x39,0x01,0xED,0x27,0x01,0xD9,0x19,0x27,0x26,0x10,0x18,0x1D,0xD9,0x01,0xCF,0x19,0x00,0x18,0x07,
+0x27,0xC0,0x19,0x01,0x3C,0xC0,0x01,0xE6,0x19,0x00,0x01,0xD7,0x19,0x18,0x3D,0x10,0x1D,0xDC,0x01,0xD3,0x19,0xC0,0x27,0x3D,0x07,0x10,0x00,0x19,0x01,0x3C,0xC0,0x01,
+0xE1,0x18,0x39,0x01,0xD6,0x18,0x3D,0x10,0x1D,0xC5,0x07,0x1D,0xD6,0x01,0xD8,0x19,0x00,0x19,0x18,0x3D,0x10,0x1D,0x00,0x19,0x01,0x3C,0x01,0xDC,0x18,0x01,0xD5,0x18,
+0x26,0x10,0x1D,0xE0,0x01,0xC6,0x28,0x19,0x00,0x27,0x18,0x1D,0x00,0x19,0xC0,0x39,0x01,0xC0,0x69,0xC1,0xA1,0xA7,0x3A,0xC0,0x3E,0x3A,0xC0,0x3C,0x01,0x3C,0x01,0x3C,
+0x01,0x3C,0x01,0xC4,0x19,0x27,0x39,0x01,0xD2,0x27,0x26,0x10,0x1D,0xDC,0x01,0xCC,0x60,0x9E,0x86,0xC1,0x7E,0xC1,0x9D,0x99,0x9B,0xAA,0x49,0x62,0x9D,0x89,0xC3,0xA4,
+0x89,0x06,0xA3,0x99,0x07,0xA2,0x8A,0xA3,0x76,0x3E,0x3A,0xC1,0x67,0xC0,0x00,0x19,0x01,0x3C,0x01,0xCF,0x19,0x27,0x26,0x10,0x18,0x1D,0xD6,0x9D,0xA9,0x1D,0xC3,0x01,
+0xC7,0x3E,0x3A,0x9D,0xA6,0xC0,0x36,0x9A,0x88,0x9A,0x89,0x9C,0x8A,0x51,0x9D,0xAA,0x5A,0xCE,0xA7,0x85,0xA7,0x99,0xA5,0x87,0x0F,0xA4,0x68,0x3E,0x47,0x00,0x19,0x01,
+0x66,0x01,0xCE,0x27,0x18,0x26,0x1D,0xDF,0x01,0xC4,0x31,0x9B,0xA9,0x06,0x62,0x2B,0x17,0x05,0xD9,0xA7,0x85,0x3C,0x07,0xC0,0xA5,0x78,0x3E,0x3A,0x01,0xCC,0x19,0x97,
+0xA9,0x10,0x1D,0xC7,0x07,0x1D,0xD7,0x01,0xC1,0x31,0x9B,0xA9,0x06,0x97,0x99,0x9B,0x8B,0x05,0xE0,0xA5,0x88,0x06,0xA8,0x87,0xA4,0x68,0x3A,0xC0,0x67,0xC0,0x01,0xC7,
+0x19,0x3D,0xA2,0x77,0xC0,0x1D,0xE1,0x01,0xC0,0x98,0xA6,0x94,0x88,0x9B,0x8B,0x05,0xE6,0x20,0xAC,0x76,0xA6,0x86,0x3E,0x3A,0xC0,0x01,0xC5,0x00,0x3D,0x1D,0xE4,0x01,
+0x3E,0x93,0x96,0x92,0x8E,0x05,0xE9,0xAE,0x85,0xAA,0x76,0xA4,0x68,0x3A,0x67,0x01,0xC3,0x27,0x26,0x10,0x1D,0xE4,0x01,0x3E,0x8F,0x98,0x05,0xEC,0xAE,0x85,0x0F,0x3E,
+0x3A,0xC0,0x01,0xC0,0x19,0x26,0x10,0x1D,0xE5,0x01,0x3E,0x12,0x05,0x0A,0x05,0xEB,0xA6,0x87,0x29,0xA8,0x87,0xA0,0x6A,0xC0,0x00,0x3D,0x1D,0xC6,0x9D,0xA9,0x1D,0xDE,
+0x01,0x3E,0x8B,0x99,0x9B,0x8B,0x05,0xEE,0xA9,0x97,0xAF,0x75,0xC0,0x97,0x7B,0x1D,0xEE,0x01,0x60,0x17,0x08,0x05,0xEF,0x2B,0xAE,0x86,0xA4,0x77,0x9C,0x68,0x1D,0xE7,
+0x9D,0xA9,0x1D,0xC3,0x01,0x9C,0x95,0x8B,0x9C,0x05,0xF2,0xAF,0x84,0xA9,0x88,0x29,0x1D,0xEC,0x01,0x07,0x05,0xF4,0x20,0x07,0xC0,0x9A,0x6B,0x1D,0xC5,0x9D,0xA9,0x1D,
+0xE2,0x01,0x99,0xA4,0x05,0xF5,0x2B,0xB2,0x75,0xC0,0x1A,0x1D,0x1A,0x1D,0xC5,0x9D,0xA9,0x1D,0xDF,0x01,0x06,0x05,0xF6,0x2B,0x29,0x0F,0x18,0x1D,0xC6,0x07,0x1D,0xDF,
+0x01,0x8E,0xA6,0x97,0x9C,0xF7,0x2B,0x29,0x0F,0x1A,0x1D,0x1A,0x1D,0xC5,0x07,0x1D,0xDD,0x3E,0x2B,0x17,0x05,0xCD,0x36,0x3C,0x17,0x08,0x05,0xE4,0xA5,0x88,0xB2,0x74,
+0xC0,0x1A,0x1D,0xE6,0x01,0xD6,0x07,0x8B,0x9C,0x05,0xCE,0xFE,0x8C,0x6C,0xB4,0x77,0x36,0x89,0x8B,0x05,0xC3,0x31,0x2B,0x17,0x05,0xDD,0x2B,0x29,0xA5,0x87,0x1A,0x1D,
+0xE5,0x01,0xD6,0x07,0x05,0xCF,0xBD,0x73,0xBF,0xA9,0xA2,0x77,0x34,0x8A,0x89,0x89,0x9A,0x97,0x9C,0xC1,0xAE,0x85,0x1F,0x0F,0x31,0x9B,0x8B,0x05,0xDC,0xA7,0x87,0xB1,
+0x85,0x06,0x18,0x1D,0xD4,0x9D,0xA9,0x26,0xC1,0x3D,0x07,0x61,0xC1,0x07,0x10,0x1D,0xC3,0x01,0xD6,0x29,0x05,0xCF,0xB5,0x84,0x3A,0x04,0x7B,0x3A,0x90,0x89,0x22,0x0A,
+0x05,0xC0,0x0F,0x34,0x95,0x97,0x22,0x0A,0x05,0xDC,0x16,0x0F,0x06,0x18,0x1D,0xC5,0x07,0x1D,0xC5,0x9B,0xBA,0x26,0xC0,0x3D,0x6E,0xC0,0xA3,0x99,0xC8,0x02,0xC0,0x18,
+0x1D,0xC1,0x01,0xD6,0x94,0xA5,0x05,0xCF,0x13,0xFE,0xEF,0x98,0xA3,0x89,0x0E,0x51,0x0B,0x34,0x85,0x9A,0x89,0x9B,0x05,0xA5,0x87,0xFE,0x9D,0x2D,0x04,0x98,0x9B,0x8E,
+0x75,0x85,0x9B,0x97,0x9C,0xDC,0x3C,0x0F,0x18,0x1D,0xCA,0x3D,0x26,0x3D,0x25,0xCF,0x02,0xC0,0x18,0x1D,0xC0,0x01,0xD6,0x31,0x9B,0x8B,0x05,0xCE,0x20,0x34,0x04,0x0B,
+0x0E,0x3A,0x0B,0x9C,0x86,0x8B,0x9A,0x3F,0x05,0x29,0x34,0x04,0x3A,0x90,0x89,0x13,0x0A,0x05,0xDB,0x29,0xA4,0x77,0x18,0x1D,0xC6,0x3D,0x26,0x3D,0x25,0xD2,0x02,0xC0,
+0x18,0x1D,0xC0,0x01,0xD5,0x9C,0x88,0x8B,0xA9,0x05,0xCF,0x3F,0x34,0x04,0x3A,0x0E,0x3A,0x0B,0x0E,0x3A,0x8E,0x7A,0x16,0x2B,0xFE,0x9C,0xF1,0x0B,0x0E,0x3A,0x34,0x32,
+0x17,0x08,0x05,0xD9,0x2B,0xB3,0x85,0x9C,0x87,0x1D,0xC4,0x26,0x10,0x25,0xD5,0x02,0xC0,0x18,0x1D,0xC0,0x01,0xD5,0x07,0x05,0xD0,0x2B,0xFE,0xCE,0xB3,0x0E,0xC0,0x3A,
+0x0B,0x0E,0x0B,0x0E,0x04,0x21,0xFE,0x29,0x83,0x07,0xFE,0xE7,0x38,0x3A,0x55,0x0B,0x15,0x8B,0x9A,0x31,0x9B,0x8B,0x05,0xD9,0x3C,0xAA,0x76,0x06,0x18,0x1D,0x3D,0x26,
+0x3D,0x25,0xD7,0x02,0xC0,0x18,0x1D,0xC0,0x01,0x39,0x01,0xD3,0x06,0x05,0xD0,0xA5,0x87,0xFE,0xBE,0x31,0x04,0x0B,0x0E,0x3A,0x0B,0x0E,0x9D,0x88,0x0B,0x53,0x11,0x16,
+0x21,0xA8,0x75,0x34,0x04,0x3A,0x0E,0x8A,0x76,0x20,0x95,0x9B,0xDA,0x29,0x0F,0x94,0x9C,0xC0,0x25,0xDA,0x02,0x6E,0x10,0x1D,0xC0,0x26,0xC0,0x3D,0x02,0xA7,0x78,0xA3,
+0x88,0xC0,0x39,0x7A,0x01,0x3C,0x01,0xCA,0x12,0x05,0xD1,0xFE,0xBD,0xD1,0x04,0x0B,0x0E,0x93,0x79,0x8F,0xAA,0x25,0x20,0xA4,0x89,0xA6,0x85,0xA4,0x7A,0x13,0xA8,0x66,
+0xAC,0x87,0xBA,0x89,0x0E,0x0B,0x0E,0x04,0x8E,0x9A,0x20,0x05,0xD9,0xA5,0x87,0x0F,0x9B,0x9A,0x25,0xC8,0x02,0xC0,0x65,0xC0,0x07,0x25,0xCC,0x02,0x07,0x1D,0xC1,0x3D,
+0xC0,0x07,0x36,0xC1,0x26,0xC0,0x3D,0x02,0x27,0xA3,0x88,0x28,0xC0,0x39,0x3C,0x01,0x3C,0x01,0xC3,0x1F,0x05,0xD1,0xFE,0xAD,0x8E,0xB0,0x8A,0x11,0x25,0x05,0x3F,0x25,
+0xAC,0x87,0xA6,0x84,0x33,0x11,0x9B,0x96,0x36,0x0C,0x0B,0x0E,0x04,0x0E,0xC0,0x04,0x3D,0xFE,0x21,0x41,0x97,0x9C,0xD9,0xAE,0x85,0xAA,0x76,0x25,0xC5,0x02,0x26,0xC0,
+0x61,0xC4,0x02,0x25,0xCA,0x02,0x1D,0xC2,0x9B,0xBA,0x07,0x61,0xC0,0x3D,0x07,0x36,0xC0,0x3D,0xC0,0x07,0x36,0xC0,0x26,0xC0,0x3D,0x02,0x27,0x00,0x19,0xC0,0x39,0x9D,
+0xA5,0x8B,0x9C,0x05,0xD1,0xB8,0x73,0x29,0x00,0x33,0xAB,0x76,0xA7,0xA9,0x3A,0xA2,0x78,0xC3,0x19,0x9C,0x75,0x0E,0x0B,0x0E,0x04,0x0E,0x0B,0x19,0x81,0x9B,0x91,0x9C,
+0x05,0xD9,0x07,0xC0,0x25,0xC3,0x3D,0x26,0x15,0xC7,0x25,0xCA,0x3D,0xA2,0x77,0xC0,0x1D,0xC0,0x3D,0x07,0x61,0xC0,0x3D,0xC1,0x07,0x36,0xC0,0x3D,0xC2,0x07,0x36,0xC0,
+0x3D,0xC2,0xA3,0x87,0x06,0x05,0xD2,0xB9,0x84,0x34,0x04,0xA0,0x8A,0x0B,0xC2,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x04,0x0E,0x0B,0xC0,0x0E,0x34,0x3C,0x20,0x1E,0x17,0x08,
+0x05,0xD7,0x20,0xB0,0x85,0x29,0x25,0xC0,0x02,0x15,0xCA,0x3D,0x25,0xC9,0x02,0x1D,0xC2,0x3D,0xC0,0x07,0x36,0xC0,0x3D,0xC2,0x0F,0x3D,0x07,0x36,0xC0,0x3D,0xC2,0x0F,
+0x3D,0xC0,0x29,0x94,0x88,0x05,0xD2,0x32,0xFE,0xF7,0xB9,0x04,0x0E,0x12,0x0B,0xC4,0x0E,0x0B,0xC1,0x0E,0x04,0x0E,0x9D,0x88,0x8D,0x87,0xA9,0x8B,0xA7,0xA9,0x0C,0x32,
+0x08,0x05,0xD8,0xB5,0x84,0xA2,0x78,0x25,0x02,0x15,0xCB,0x3D,0x25,0xC9,0x02,0x1D,0xC2,0x3D,0xC1,0xA2,0x77,0x61,0xC0,0x3D,0xC2,0x0F,0x3D,0xC4,0x07,0x36,0xC0,0x3D,
+0x29,0x31,0x05,0xD2,0xB5,0x84,0x30,0x16,0x58,0x30,0xAC,0x87,0xAE,0x78,0x12,0x69,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0x96,0x86,0x0E,0x0B,0xC0,0x0E,0x34,0xFE,0x3A,0x03,
+0x91,0x9D,0xD8,0x3F,0xB1,0x85,0x94,0x9C,0x15,0xCC,0x3D,0x25,0xC9,0x02,0x1D,0xC2,0x3D,0x07,0x36,0xC0,0x3D,0xC2,0xA3,0x87,0x3D,0xCA,0x13,0x0A,0x05,0xD2,0xB5,0x84,
+0xB8,0x9A,0xA8,0x77,0x37,0x33,0x25,0x36,0x3D,0x12,0x0B,0xC2,0x0E,0x04,0x0E,0x0B,0x34,0x2B,0x0B,0x53,0x0B,0x0C,0x33,0x92,0x75,0x31,0x99,0x9C,0xD8,0xB7,0x74,0x06,
+0x15,0xCC,0x25,0xCA,0x02,0x1D,0xC2,0x9B,0xBA,0xC0,0xA2,0x77,0x61,0xC0,0x3D,0xC2,0xA3,0x87,0x3D,0xC9,0x3C,0x17,0x05,0xD2,0xB5,0x84,0x2A,0xA4,0x9C,0xC0,0x9B,0x87,
+0x83,0x66,0x93,0x55,0x3D,0xFE,0xC6,0x97,0x12,0x0B,0xC4,0x0E,0x19,0x0E,0x0B,0xC0,0x88,0x9B,0x83,0x99,0xA2,0x46,0xB5,0xB7,0x98,0x88,0x05,0xD8,0x20,0xAC,0x76,0x15,
+0xCC,0x25,0xC9,0x02,0xC0,0x18,0x1D,0xC2,0x02,0xC0,0x65,0x3D,0xCE,0x25,0x99,0x85,0x97,0x9C,0xD3,0xB0,0x95,0x2B,0x31,0xC0,0x11,0xFE,0x0B,0x41,0x96,0xCC,0x17,0xAC,
+0x88,0xFE,0xD6,0xD7,0x12,0x0B,0x0E,0x0B,0xC1,0x34,0x2B,0x0B,0x0E,0x30,0x85,0x8A,0xA2,0x79,0xAC,0x43,0xAB,0x75,0xA6,0xEB,0x85,0x9B,0x97,0x9C,0xD8,0xB8,0x73,0x36,
+0x15,0xCA,0xA4,0x88,0x25,0xC9,0x3D,0x25,0x4D,0xC2,0x9B,0xEA,0xC0,0x02,0xC0,0x36,0x3D,0x02,0xC0,0x36,0x3D,0x02,0x3D,0xC7,0x29,0x05,0xD4,0xB0,0x74,0xFE,0xDE,0xF8,
+0x31,0xC0,0x30,0x97,0x13,0x8D,0xEF,0x05,0xAF,0x53,0x27,0x0C,0x0B,0xC3,0x96,0x86,0x0E,0x0B,0x30,0x8F,0x57,0x9C,0x78,0x05,0xAB,0x55,0xAD,0x54,0xB9,0xEC,0x29,0x05,
+0xD8,0xB3,0x84,0x9D,0x89,0x15,0xC9,0x02,0x25,0xCA,0x02,0xC0,0x18,0x1D,0xC1,0x9B,0xEA,0xC8,0x02,0xC1,0x36,0x3D,0x02,0x3D,0xC2,0x13,0x0A,0x05,0xD3,0x3C,0xFE,0xD6,
+0xD7,0xA9,0x9C,0xC0,0x33,0xFE,0x0B,0x41,0x96,0xCC,0x9C,0xBB,0xAA,0x64,0x11,0x33,0xB8,0x75,0x12,0x0B,0xC0,0x9D,0x98,0x34,0x04,0x33,0x2D,0x07,0x9C,0x47,0x06,0x08,
+0xA3,0x9A,0x33,0x9C,0x85,0x82,0x8B,0x05,0xD7,0x3C,0x0F,0x15,0xC8,0x02,0x25,0xCB,0x02,0x1D,0xC3,0x9B,0xFA,0xC4,0x5A,0xC3,0x09,0xC1,0x06,0xC2,0x02,0x29,0x3C,0x17,
+0x05,0xD3,0x3C,0xB7,0x86,0x3D,0x12,0x98,0x99,0x89,0x63,0x98,0x38,0xC0,0xAF,0xBA,0x3D,0x37,0xA4,0x66,0x12,0x69,0xC0,0x34,0x2B,0x21,0xAE,0x78,0xA3,0x9B,0x21,0x32,
+0x19,0xC0,0xFE,0x73,0xAD,0x2A,0x3D,0x22,0x0A,0x05,0xD6,0xA5,0x87,0xB6,0x83,0x8E,0x9D,0x15,0xC6,0x02,0x25,0xCC,0x02,0x1D,0xC3,0x06,0x09,0xC1,0x06,0xC5,0x09,0xC2,
+0x06,0xC1,0x09,0xA9,0x44,0x91,0x9C,0x05,0xD4,0x20,0x34,0x0C,0x9B,0x77,0x11,0xC0,0x33,0xC0,0x0B,0x2D,0x2A,0x12,0x69,0xC1,0x96,0x86,0x0E,0x3D,0x21,0x11,0xC0,0x0F,
+0x33,0x2D,0x0B,0x0E,0x0B,0x00,0xFE,0x08,0x20,0x05,0xD7,0x1E,0x20,0xC0,0x15,0xC4,0xA4,0x88,0x25,0xCC,0x02,0x1D,0xC4,0x06,0x09,0xC2,0x06,0xC1,0x09,0xC2,0x06,0xC1,
+0x09,0xC2,0x36,0x08,0x05,0xD4,0x20,0x34,0x0B,0x0E,0x0B,0xC3,0x0E,0x0B,0xC3,0x19,0x0E,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x04,0x21,0xFE,0x21,0x41,0x97,0x9C,0xD7,0x1E,
+0x20,0x15,0xC4,0x25,0xCE,0x9C,0x87,0x1D,0xC4,0x06,0xC3,0x09,0xC3,0x06,0xC0,0xA2,0x98,0xC4,0xA5,0x77,0x9E,0x64,0x05,0xD5,0x3C,0x19,0x0E,0x0B,0xC2,0x0E,0x0B,0xC4,
+0x0E,0x19,0x0E,0x0B,0xC3,0x0E,0x04,0x0E,0x0B,0xC0,0xFE,0x6B,0x89,0x95,0x89,0x05,0xD7,0x1E,0x3C,0x15,0xC0,0x26,0xC0,0x3D,0x25,0xCE,0x3D,0xA2,0x77,0x5F,0xA2,0x87,
+0xC3,0x98,0xEA,0xC5,0xA3,0x88,0xC3,0x09,0xC1,0xA2,0x88,0xC1,0x00,0x98,0x55,0x05,0xD5,0x20,0x34,0x0B,0xC0,0x0E,0x0B,0xC5,0x0E,0x04,0x0E,0x9D,0x88,0x54,0x0B,0x0E,
+0x0B,0xC5,0x0C,0x16,0xA7,0x76,0x05,0xD6,0xA5,0x87,0xB2,0x75,0x98,0x9B,0x02,0xC0,0x18,0x25,0xD0,0x3D,0xA2,0x77,0xC0,0xA3,0x78,0xC3,0x98,0xE9,0x2D,0xC2,0x26,0x2D,
+0x26,0x2D,0x26,0x2D,0xC2,0x26,0xA3,0x89,0xC1,0xAB,0x64,0x1F,0x05,0xD5,0x3C,0x19,0x0E,0x0B,0xC4,0x0E,0x0B,0xC4,0x19,0x0E,0x0B,0xC4,0x0E,0x51,0x11,0x05,0xB0,0x74,
+0x05,0xD7,0x1E,0x29,0x25,0xD3,0x3D,0x1D,0xC5,0x26,0x2D,0x26,0x2D,0x26,0x2D,0x26,0x2D,0x26,0xC0,0x2D,0x26,0x2D,0x26,0xC1,0x2D,0xA3,0x88,0x22,0x8E,0x8C,0x05,0xD5,
+0x20,0x34,0x04,0x3A,0x0E,0x0B,0x0E,0x0B,0xC6,0x0E,0x34,0xA5,0x99,0x0B,0x53,0x0B,0xC0,0x0E,0x0B,0xC0,0x2B,0x13,0x0A,0x20,0x3F,0x99,0x9A,0xD6,0x1E,0x25,0xD3,0x02,
+0x1D,0xC6,0x26,0x2D,0x26,0x2D,0x26,0xC2,0x2D,0x26,0x2D,0x26,0xC3,0x2D,0x06,0x20,0x05,0xD6,0x20,0x34,0x04,0x3A,0x0E,0x0B,0xC0,0x0E,0x04,0x0E,0x0B,0xC1,0x0E,0x0B,
+0xC0,0x19,0x2B,0x0B,0x53,0x0B,0xC1,0x0E,0x0B,0x21,0xFE,0x00,0x20,0xC0,0x3F,0x20,0x05,0xD5,0x3F,0xB1,0x85,0x36,0x02,0x25,0xD0,0x02,0xC0,0x18,0x1D,0xC5,0x2D,0xC2,
+0x26,0x06,0x2D,0xC2,0x26,0xC0,0x2D,0x26,0x2D,0x26,0xC0,0x0D,0x1F,0x05,0xD6,0x22,0x15,0x0B,0xC0,0x0E,0x04,0x0E,0x0B,0xC2,0x0E,0x0B,0xC1,0x19,0x2B,0x0B,0x0E,0x04,
+0x0E,0x0B,0xC2,0xFE,0x42,0xA9,0x05,0xC0,0xA7,0x85,0xA8,0x87,0x05,0xD5,0x20,0x0F,0x36,0x3D,0x07,0x36,0xC0,0x3D,0xC1,0x25,0xCA,0x9A,0x78,0x10,0x1D,0xC6,0x2D,0xC2,
+0x69,0xC0,0x2D,0xC2,0x26,0xC0,0x2D,0x26,0x2D,0x26,0x13,0xA5,0x77,0x08,0x05,0xD6,0x22,0x2B,0x0B,0x53,0x0B,0xC2,0x0E,0x0B,0xC3,0x2B,0x15,0x0B,0xC1,0x0E,0x04,0x0E,
+0x0B,0xC0,0x11,0xFE,0x00,0x20,0xC1,0xA5,0x87,0x3A,0x05,0xD5,0x36,0xC0,0x1D,0xC5,0x07,0x10,0x9B,0xA9,0xC0,0x61,0x26,0xC0,0x3D,0x02,0x3D,0xC3,0x1D,0xC7,0x2D,0xC2,
+0x69,0xC0,0x2D,0x26,0x2D,0xC2,0x26,0xC0,0x2D,0x26,0x36,0x3C,0x05,0xD7,0x0F,0xFE,0xEF,0x98,0x0B,0x53,0x0B,0xC3,0x0E,0x04,0x0E,0x0B,0xC1,0x9A,0x99,0xA4,0x87,0x0B,
+0xC0,0x0E,0x04,0x0E,0x0B,0x0C,0x16,0x97,0x8A,0xC2,0x3C,0x17,0x05,0xD4,0x1E,0x18,0x1D,0xDC,0x2D,0xC2,0x26,0xC0,0x2D,0x26,0x2D,0xC3,0x26,0xC0,0x2D,0x0D,0x1F,0x05,
+0xD7,0x22,0xFE,0xE7,0x76,0x0B,0x0E,0x0B,0xC6,0x3A,0x21,0x8D,0x7A,0x93,0xAA,0x33,0x0B,0x6B,0x0B,0x0E,0x0B,0xC0,0xFE,0x6B,0xAB,0x84,0x9B,0xC3,0x20,0x05,0xD4,0xB0,
+0x74,0x0F,0x18,0x1D,0xDC,0x2D,0xC2,0x26,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0x2D,0x26,0x2D,0x26,0xC0,0x0D,0x05,0xD8,0xB5,0x84,0x29,0xFE,0xEF,0xBB,0x0E,0x3A,0x0B,0x0E,
+0x0B,0xC0,0x0E,0x0B,0x97,0x9A,0x29,0x17,0x9D,0x9A,0xC1,0xFE,0xBE,0x54,0x12,0x0E,0x3A,0xA2,0x78,0x33,0x05,0xC4,0xAC,0x87,0x05,0xD4,0x0F,0x06,0x07,0x10,0x1D,0xDB,
+0x2D,0xC3,0x26,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC0,0x2D,0x26,0x13,0x6C,0x05,0xD8,0xB5,0x84,0x90,0x8B,0x33,0x0B,0x0E,0x0B,0xC1,0x0E,0x0B,0x93,0x89,0xFE,0x3A,0x06,
+0x92,0x89,0xA9,0x88,0x29,0x30,0x9C,0x8A,0x33,0xB8,0x75,0x12,0x0B,0x21,0x2B,0x17,0x05,0xC3,0x3C,0x05,0xD3,0x3C,0xAA,0x76,0x94,0x9C,0xC0,0x42,0xC1,0x61,0x26,0x07,
+0x10,0x1D,0xD5,0x2D,0xC2,0x69,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC1,0x2D,0x26,0xAC,0x44,0x96,0x88,0x05,0xD8,0x36,0x96,0x48,0x05,0x33,0x0B,0x6B,0x0B,0xC0,0x0E,0x96,
+0x76,0xFE,0x31,0xA5,0x25,0x11,0x0C,0x0B,0xC1,0x0E,0x0B,0xC0,0x11,0xFE,0x18,0xE2,0x05,0xC5,0x20,0x05,0xD2,0x3F,0x0F,0x36,0x02,0x66,0xC6,0x41,0xC0,0x3D,0x02,0x3D,
+0x07,0x10,0x1D,0xCE,0x2D,0xC3,0x69,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC1,0x2D,0x0D,0x8D,0x8B,0x05,0xD7,0x2B,0xAF,0x84,0x9B,0x49,0x0A,0x3A,0x11,0x0B,0x0E,0x0B,0x9A,
+0x99,0xFE,0x52,0xC6,0x21,0x2A,0x1B,0x0E,0x51,0x19,0x3A,0x0B,0xC0,0x11,0xFE,0x18,0xE2,0x05,0xC6,0xA9,0x85,0x97,0x9C,0xD2,0x36,0x9B,0x89,0x3C,0x3D,0x07,0x61,0xC0,
+0x3D,0xC2,0xA3,0x87,0x3D,0xC4,0x41,0x3D,0x26,0xC0,0x3D,0x02,0x3D,0x07,0x1D,0xC7,0x2D,0xC2,0x69,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC1,0x2D,0xA7,0x76,0xA5,0x66,0x08,
+0x05,0xD7,0x3C,0x6D,0x24,0x0A,0x05,0xC0,0x33,0x0B,0x12,0x0C,0x55,0x12,0x0B,0x93,0x89,0x9C,0xA7,0x21,0x2A,0xA4,0x87,0xC0,0x30,0x2B,0x05,0xC6,0x2B,0x03,0x05,0xD1,
+0x36,0x51,0x99,0x9D,0x07,0x61,0xC0,0x3D,0xC2,0x0F,0x3D,0xC5,0x07,0x36,0xC0,0x3D,0xC2,0x0F,0x3D,0xC1,0x41,0xC0,0x3D,0x02,0x27,0x59,0xC0,0x2D,0xC2,0x69,0xC0,0x2D,
+0x26,0x2D,0xC0,0x26,0xC1,0x2D,0xAC,0x43,0x3C,0x05,0xD8,0x06,0x9B,0x98,0xA0,0x59,0x99,0xAA,0x05,0xC1,0x16,0x2A,0x0B,0xC3,0x61,0x04,0x0E,0x95,0x7B,0x29,0x17,0x05,
+0xC7,0x2B,0x3F,0x05,0xD0,0xAB,0x86,0xAD,0x86,0x94,0x9C,0x3D,0xDD,0x41,0xC0,0x15,0xA1,0xC9,0xC2,0x69,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC1,0x2D,0xAC,0x43,0x31,0x9B,
+0x8B,0x05,0xD7,0x13,0x1F,0x10,0x19,0x05,0xC2,0xAF,0x87,0x37,0x0B,0x0E,0x0B,0xC1,0x0C,0x30,0x2B,0x05,0xC9,0xA9,0x97,0x2B,0x17,0x05,0xCE,0x3F,0xB1,0x85,0x94,0x9C,
+0x02,0x3D,0xCA,0x41,0x3D,0xD3,0x2D,0xC2,0x69,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC1,0x2D,0xAC,0x43,0x05,0xD9,0x36,0x08,0x10,0x59,0x05,0xC3,0x10,0x30,0xB5,0x88,0xA9,
+0x88,0x0C,0x11,0x82,0x9A,0x05,0xCB,0x2B,0x17,0x05,0xCE,0x2B,0xAE,0x86,0x9D,0x88,0x3C,0x9E,0x8B,0xCA,0x41,0x3D,0xC0,0x07,0x36,0xC0,0x3D,0xC2,0xA3,0x87,0x3D,0xC6,
+0x07,0x36,0xC0,0x3D,0x2D,0xC2,0x69,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC1,0xA7,0x77,0xA5,0x66,0x05,0xD8,0x2B,0xAA,0x85,0x05,0xA5,0x88,0xFE,0x3B,0xE5,0xA4,0x63,0xC2,
+0xA4,0x9B,0xA6,0x64,0xA4,0x87,0x9A,0x87,0xFE,0x6C,0x47,0x18,0x91,0xA9,0x05,0xDE,0xB0,0x95,0x22,0x3D,0xCA,0x41,0x3D,0xC1,0x07,0x61,0xC0,0x3D,0xC2,0x0F,0x3D,0xC7,
+0x07,0x36,0xC0,0x3D,0x2D,0xC3,0x69,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC0,0xAC,0x44,0x96,0x88,0x05,0xD8,0x16,0x20,0x05,0xC0,0xFE,0x5C,0xE8,0xAE,0x40,0xC1,0x65,0xC4,
+0xFE,0x23,0x41,0x0A,0x05,0xDD,0x20,0xAC,0x76,0x3D,0xA2,0x77,0x61,0xC0,0x3D,0xC2,0x0F,0x3D,0xC8,0x07,0x36,0xC0,0x3D,0xC2,0x0F,0x3D,0xC5,0x9D,0xA8,0x26,0xA0,0xA6,
+0x9D,0xC9,0x2D,0xC2,0x26,0xC0,0x2D,0x26,0x2D,0xC0,0x26,0xC0,0xA3,0x89,0xAC,0x43,0x31,0x05,0xD8,0xB0,0x74,0x31,0x9B,0x8B,0x05,0xFE,0x55,0x25,0x24,0xC0,0x18,0xC2,
+0x97,0x9A,0xA2,0x9B,0xA7,0x75,0x0E,0xFE,0x01,0x00,0x05,0xC2,0x19,0x03,0x5C,0x19,0x05,0xD4,0x2B,0xB0,0x85,0x3C,0x3D,0xD5,0x41,0x3D,0xC1,0x69,0xC0,0x26,0x1E,0xA0,
+0xA9,0x70,0xA3,0xA8,0x74,0xA1,0xA9,0xC1,0xFE,0x41,0x44,0x2D,0x26,0x2D,0x26,0xC3,0xA3,0x89,0x22,0x13,0xA5,0x77,0xA2,0x78,0x05,0xD5,0x19,0xA6,0x55,0x7F,0x9D,0xAA,
+0xA8,0xA7,0x28,0x05,0x0F,0xFE,0x54,0xE7,0x24,0xC0,0x18,0xC2,0xFE,0x4C,0x07,0x3E,0xFE,0x76,0x67,0x51,0xFE,0x0A,0xA0,0x0F,0xAD,0x44,0x15,0xAC,0x66,0x9D,0x97,0x37,
+0x10,0xA4,0x87,0x28,0x05,0x0F,0x05,0xD1,0xB0,0x74,0x29,0x3D,0xD6,0x41,0x9F,0xD8,0x1E,0x9D,0xC9,0xA1,0xA7,0x25,0xC0,0xA1,0xA9,0x7A,0x61,0x3A,0xC3,0x13,0xC1,0x3C,
+0x9D,0x89,0x13,0xC5,0x36,0x9C,0x97,0x05,0xD2,0xA5,0x87,0xAE,0x34,0xAB,0x75,0xAA,0x52,0xA2,0x75,0x0E,0x2C,0x94,0xEF,0x10,0x77,0x10,0xFE,0x3C,0x62,0x18,0xC1,0x6F,
+0xC0,0x18,0x12,0xFE,0x6B,0xAB,0xFE,0x65,0xA7,0x1F,0x12,0x9D,0xCF,0x0D,0x18,0xC1,0xFE,0x23,0x41,0x0F,0x62,0xAA,0x66,0x17,0x08,0x05,0xD0,0x32,0xAE,0x85,0x3C,0x3D,
+0xD0,0x26,0x2D,0x1E,0xA0,0xA9,0x9E,0xB6,0x25,0xC0,0xA1,0xA9,0x3A,0x61,0x3A,0x29,0x3A,0x29,0x7E,0x29,0x3A,0x29,0x31,0x3A,0xC0,0x13,0xCA,0xA8,0x74,0x91,0x8C,0x97,
+0x9C,0xD1,0xAB,0x44,0xFE,0x3C,0x62,0x0D,0x18,0xC2,0x0A,0x06,0x05,0xC0,0x0F,0x0C,0xFE,0x5D,0xA6,0x0D,0x18,0xC1,0x24,0x0A,0xFE,0x5B,0xAA,0x0E,0x24,0x98,0x9A,0x0D,
+0x18,0xC2,0x2C,0xFE,0x02,0x00,0x17,0xA2,0x88,0x03,0x05,0xD1,0x13,0xA0,0x5A,0x3D,0xA3,0x68,0x3D,0xC8,0x2D,0xC0,0x1E,0xC0,0xA0,0xA9,0x9E,0xB6,0x35,0x37,0xC0,0x29,
+0x3A,0x29,0x31,0x3A,0x29,0xC2,0x3A,0x29,0x31,0x3A,0x29,0x3A,0xC3,0x13,0xCA,0x04,0x17,0x08,0x05,0xD0,0xBF,0x20,0x0D,0xA3,0x86,0xC1,0x24,0x18,0xC0,0x39,0x19,0x05,
+0xC0,0xA5,0x87,0xFE,0x54,0xE7,0xA6,0x64,0x18,0xC1,0x1F,0x1A,0x0E,0x24,0x18,0xC0,0x39,0x18,0xC1,0x1F,0x18,0x8F,0xAD,0x0F,0x05,0x15,0x40,0x19,0x05,0xCF,0xB5,0x84,
+0x3C,0x3D,0xC5,0x9D,0xA8,0x26,0x1E,0x9D,0xC9,0xA1,0xA7,0xA2,0xA7,0xA1,0xA9,0x3A,0x29,0xC0,0x3A,0x29,0x31,0x3A,0xA1,0xA8,0x56,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,
+0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0x3A,0xC0,0x13,0xC7,0x7B,0x13,0x36,0xA1,0x85,0xFE,0x00,0x20,0xD1,0x2B,0xFE,0x65,0xA7,0x1F,0x18,0xC1,0x24,0x18,0x24,0xC0,
+0xFE,0x23,0x41,0xFE,0x00,0x40,0x05,0xC0,0xFE,0x43,0xE6,0x0D,0x9A,0x87,0x18,0xC3,0x24,0x18,0x24,0x8E,0xAC,0x0D,0x18,0xC1,0x24,0x0A,0xFE,0x01,0x60,0x05,0xC0,0xAA,
+0x66,0x17,0x05,0xCE,0xAB,0x86,0xA5,0xA7,0x9C,0x7B,0xC0,0x9D,0xC9,0x1E,0xC0,0xA0,0xA9,0x9E,0xB6,0x35,0x25,0xA1,0xA9,0x3A,0xA1,0xA8,0x3D,0xC0,0x29,0x3D,0x29,0x3D,
+0x29,0xC1,0x05,0x3D,0xC0,0x31,0x29,0xC2,0x05,0x3D,0x29,0x3D,0x05,0x3D,0xC0,0x31,0x3A,0xC2,0xFE,0x52,0x26,0x13,0xC5,0x1D,0x13,0xC0,0xA7,0x87,0x98,0x78,0x91,0x9D,
+0xD1,0x3F,0xFE,0x65,0xA7,0x1F,0x18,0x24,0xC0,0x18,0xC2,0x2C,0x06,0x05,0xC0,0x15,0xFE,0x76,0x09,0x5C,0x0A,0x18,0xC2,0x24,0x18,0x24,0x89,0xAE,0x98,0xCD,0x19,0x18,
+0xC1,0x24,0x08,0x05,0xC0,0x32,0xA6,0x55,0x99,0xAA,0x05,0xCD,0x0C,0x16,0x35,0x25,0x37,0x7A,0x61,0xC0,0x66,0x29,0xC0,0xA3,0x98,0x3D,0xC0,0x05,0xC0,0x3D,0xC0,0x31,
+0x3A,0x05,0x3D,0xC0,0x05,0xC2,0x3D,0xC0,0x05,0xC6,0x29,0x3A,0x29,0x31,0x3A,0x29,0x1D,0x13,0xC6,0x1D,0x13,0xAB,0x75,0x8E,0x9D,0x98,0x79,0x66,0xD0,0x10,0x36,0x1F,
+0x18,0x6F,0x18,0xC1,0x24,0x18,0x24,0x8E,0xAC,0x19,0x05,0xA5,0x87,0xFE,0x54,0xE7,0x18,0xC0,0x39,0x18,0xC2,0x24,0x18,0xFE,0x0A,0x00,0x0F,0xBC,0x20,0x0D,0x18,0xC1,
+0x8F,0xAD,0x0F,0x05,0xC0,0x10,0x19,0x05,0xCD,0xB0,0x95,0xFE,0x8A,0x21,0x29,0xC1,0xA3,0x98,0x3D,0x29,0xC1,0x05,0x3D,0x05,0x3D,0xC0,0x05,0xC1,0x31,0x29,0x05,0x3D,
+0xC0,0x05,0xC1,0x31,0x05,0x3D,0xC0,0x05,0xC1,0x31,0x05,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0xFE,0x52,0x26,0x13,0xC1,0x1D,0x13,0xC1,0x1D,0x13,0xC0,0xA7,0x87,
+0x8D,0x8B,0x9C,0x8A,0xD1,0x3F,0xFE,0x76,0x09,0x18,0xC2,0x24,0x18,0x24,0x18,0xC0,0x9D,0x9B,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xBF,0x20,0x0D,0x18,0xC0,0x99,0x9C,0x69,
+0x0D,0x18,0xC0,0x97,0x9A,0x28,0x05,0x2B,0xFE,0x54,0xE7,0x18,0xC1,0x0A,0xFE,0x00,0xA0,0x05,0xC0,0x2B,0x10,0x19,0x05,0xCC,0xB0,0x95,0xA4,0xD5,0x29,0x3A,0x29,0x31,
+0x3A,0x29,0x3A,0x29,0xA3,0x98,0xC2,0x6E,0x05,0x3D,0xC0,0x31,0x3A,0x29,0x3A,0x29,0x31,0x05,0xC2,0x0A,0xC0,0x05,0xC3,0x3A,0xC6,0x1D,0x13,0xC4,0x1D,0x13,0x1D,0x13,
+0xA7,0x65,0x89,0xAF,0xD2,0xA8,0x55,0x36,0xA7,0x75,0x18,0x24,0x18,0xC2,0x24,0x18,0x24,0x8E,0xAC,0x19,0x05,0xB8,0x21,0x1A,0x51,0x18,0xC0,0x0D,0x9A,0x87,0x36,0x06,
+0x89,0xBF,0xFE,0x00,0x40,0x05,0xC0,0x10,0xFE,0x55,0x25,0x24,0x18,0x2C,0x28,0x05,0x0F,0x05,0xAA,0x64,0x28,0x05,0x0F,0x05,0xCA,0x3F,0xB2,0xA2,0xFE,0xA1,0xC1,0x31,
+0x29,0xA3,0x98,0x31,0x29,0x05,0x31,0x05,0xC2,0x6E,0xC0,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0x05,0xC3,0x0A,0xC0,0x29,0x0A,0x05,0x29,0x3A,0x29,0x31,0x3A,0x29,
+0x3A,0x29,0x3A,0x1D,0x13,0xC1,0x1D,0x13,0x1D,0x13,0xC1,0xA5,0x77,0x13,0x90,0x7B,0xD2,0x2B,0xFE,0x55,0x63,0x24,0xC0,0x18,0xC5,0x24,0x2C,0xFE,0x09,0x81,0x05,0xB4,
+0x42,0x1A,0x51,0x18,0xC1,0x0D,0x0A,0x94,0xAD,0x28,0x05,0xA2,0x77,0x05,0xC0,0xAF,0x33,0xBB,0x62,0x1F,0x1A,0xFE,0x09,0x81,0x05,0xC0,0x0F,0x77,0x10,0x19,0x05,0xCC,
+0x36,0xFE,0x8A,0x21,0x29,0x31,0x29,0xA3,0x98,0x31,0x29,0xC0,0x05,0xC3,0x6E,0xC0,0x29,0x0A,0x29,0x3A,0x29,0x05,0xC2,0x0A,0xC0,0x29,0x0A,0x29,0x05,0xC2,0x3A,0xC6,
+0x13,0xC2,0x1D,0x13,0xC1,0x1D,0x13,0xA8,0x66,0x93,0x99,0x95,0x9D,0xD2,0x2B,0xFE,0x54,0xE7,0x18,0xC3,0x6F,0x18,0x24,0x18,0xC1,0x15,0xFE,0x00,0x40,0xAE,0x53,0xFE,
+0x76,0x09,0x18,0xC3,0x1F,0x18,0x92,0x9E,0xFE,0x12,0x02,0x0A,0x05,0xC1,0xAA,0x66,0x0E,0xAC,0x64,0xFE,0x02,0x00,0x94,0xFE,0x05,0xC1,0xAB,0x55,0x99,0xAA,0x05,0xCC,
+0x16,0xA9,0xE5,0x29,0x3A,0xA1,0xA8,0x56,0xC0,0x31,0x3A,0x29,0x3D,0x29,0x3D,0x29,0x05,0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x05,0xC2,0x6E,0xC0,0x29,0x0A,0x29,0x05,0xC0,
+0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x3A,0xC2,0x1D,0x13,0x1D,0x13,0xC1,0x1D,0x13,0x1D,0x13,0xAB,0x75,0x89,0x9D,0x9C,0x8A,0xD3,0xFE,0x43,0xE6,0x18,0xC1,0x6F,0x18,0x24,
+0x18,0xC3,0x39,0x19,0x10,0xFE,0x76,0x09,0x18,0xC4,0x24,0x18,0x24,0x89,0xAE,0x06,0x05,0xC0,0xA2,0x77,0x2A,0x39,0xFE,0x12,0x02,0x05,0xC3,0x15,0x17,0x05,0xCC,0x13,
+0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x3D,0xC0,0x05,0xC1,0x31,0x05,0x9D,0x89,0x05,0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x05,0xC3,0x0A,0xC0,0x29,0x0A,0x29,0x05,0x29,0x3A,0x29,
+0x31,0x3A,0x29,0x3A,0x29,0x3A,0xC1,0x13,0xC2,0x7B,0x13,0xC3,0x04,0x88,0x8F,0xD4,0x32,0x1A,0x18,0xC1,0x6F,0x18,0x24,0x18,0xC2,0x2C,0xFE,0x01,0x00,0x10,0x19,0x18,
+0xC1,0x24,0x18,0x24,0x18,0xC2,0x25,0x8D,0xBE,0x28,0x05,0x0F,0x10,0x06,0x0F,0x05,0xC2,0x2B,0xA3,0x67,0x9C,0x99,0x05,0xCB,0x10,0xFE,0x7A,0x64,0x29,0xC0,0x3A,0x29,
+0x31,0x3A,0x29,0x3A,0x29,0xA3,0x98,0xC2,0x29,0xC1,0x05,0x3D,0x05,0xC3,0x0A,0xC0,0x29,0x0A,0x29,0x05,0x29,0x3A,0xC7,0x1D,0x13,0xC1,0x1D,0x13,0x1D,0x13,0x1D,0x13,
+0xA7,0x65,0x8A,0x9E,0x66,0xD3,0xAF,0x54,0xFE,0x76,0x09,0x18,0xC5,0x24,0x18,0x24,0x18,0xFE,0x0A,0xA0,0xFE,0x19,0x63,0x19,0x18,0xC1,0x6B,0x18,0xC2,0x24,0x18,0x24,
+0x18,0x12,0x8D,0xCF,0x0F,0x05,0x15,0x37,0x0F,0x05,0xC2,0xAC,0x87,0x05,0xCD,0x13,0xFE,0x8A,0x21,0x29,0x7E,0x3D,0x29,0x3D,0x29,0xC1,0xA3,0x98,0xC3,0x29,0xC0,0x3A,
+0x05,0xC3,0x6E,0xC0,0x29,0x0A,0x29,0x05,0x29,0x3A,0xC8,0x13,0xC2,0x1D,0x13,0x1D,0x13,0xC0,0xA8,0x66,0x9C,0x87,0x8C,0x9E,0xD4,0x37,0xFE,0x6D,0x69,0x1F,0x18,0xC1,
+0x24,0x18,0x24,0x18,0xC2,0x3B,0x10,0x19,0x18,0xC2,0x1F,0x18,0xC3,0x24,0x18,0x24,0x0D,0x8D,0x9C,0xFE,0x01,0x00,0x05,0x07,0x10,0x99,0xAA,0x05,0xC1,0xAA,0x77,0x37,
+0x19,0x05,0xCB,0x2B,0xB2,0x95,0x09,0x31,0x6F,0x51,0x3D,0x29,0xC0,0x31,0x29,0xA3,0x98,0xC2,0x29,0xC0,0x05,0x3D,0xC0,0x05,0xC1,0x0A,0x05,0xC2,0x29,0xC0,0x3A,0x29,
+0x31,0x3A,0x29,0x3A,0x29,0x3A,0xC1,0x1D,0x13,0xC1,0x1D,0x13,0x1D,0x13,0x1D,0x04,0x97,0x89,0x92,0x8E,0x66,0xD4,0xFE,0x3C,0x62,0x18,0xC2,0x6B,0x18,0xC4,0x92,0x9E,
+0xFE,0x1A,0x03,0xFE,0x76,0x09,0x18,0xC6,0x24,0x18,0x24,0x18,0xC2,0xFE,0x23,0x41,0x0A,0x05,0xAA,0x66,0x10,0x0A,0x05,0xA5,0x88,0x10,0xA4,0x87,0xC1,0x95,0xAB,0x05,
+0xCA,0xB0,0x94,0xFE,0x8A,0x21,0x29,0x7E,0x3D,0x29,0x3A,0x29,0x31,0x3A,0xA1,0xA8,0xC2,0x29,0xC0,0x05,0xC0,0x3D,0xC0,0x05,0xC1,0x6E,0x05,0xC1,0x29,0xC0,0x05,0x3A,
+0xC7,0x1D,0x13,0xC4,0x1D,0x13,0xAB,0x75,0x8E,0x8B,0x97,0x9C,0xD5,0xB8,0x21,0x1A,0x18,0xC2,0x6F,0x18,0x24,0x18,0xC1,0x25,0xFE,0x23,0x03,0x1A,0x51,0x18,0xC3,0x24,
+0x18,0x24,0x18,0xC4,0x39,0xFE,0x00,0xA0,0x05,0xC0,0x15,0x10,0xC0,0xA4,0x87,0x10,0x59,0x97,0xCC,0x37,0x10,0x19,0x05,0xC9,0xAB,0x86,0x35,0x29,0xC0,0x3A,0x29,0x7E,
+0x3A,0x29,0x3A,0x0A,0x66,0xC2,0x3D,0xC0,0x31,0x3A,0x05,0x0A,0x05,0xC2,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0x3A,0xC4,0x1D,0xC0,0x13,0xC1,0x1D,0x13,0x1D,0x13,
+0xAB,0x75,0x89,0x9D,0x9C,0x8A,0xD5,0x10,0xFE,0x65,0xA7,0x18,0xC1,0x6F,0x18,0x24,0x18,0xC2,0x9D,0x9B,0x8D,0x9C,0x1A,0x51,0x18,0xC4,0x24,0x18,0x24,0x18,0xC3,0x12,
+0x0F,0x05,0xC0,0xAA,0x77,0x37,0x0F,0x05,0x2B,0x03,0x05,0x15,0x10,0x03,0x0F,0x05,0xC8,0xA7,0x85,0xB2,0xA4,0x09,0x3D,0x51,0x3D,0x29,0xA3,0x98,0x51,0x29,0x05,0x31,
+0x05,0xC2,0x29,0xC0,0x05,0x3A,0x05,0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x3A,0xC9,0x29,0x1D,0x13,0xC1,0x1D,0x13,0x1D,0x13,0x1D,0x04,0x17,0x9D,0xAA,0x5A,0xD4,0x2B,0xFE,
+0x54,0xE7,0x24,0x18,0xC1,0x24,0x18,0x24,0x18,0xC2,0x94,0x8B,0xAC,0x86,0x1A,0x18,0xC1,0x24,0x18,0x24,0x18,0xC6,0xFE,0x23,0x41,0xFE,0x00,0x40,0x05,0xAA,0x66,0x3F,
+0x05,0xC0,0xA5,0x88,0x10,0x03,0x37,0x2B,0xA6,0x45,0x37,0x32,0x05,0xC8,0x20,0xA9,0xF5,0x3D,0x29,0x3D,0x7E,0x31,0x29,0x05,0x31,0x05,0xC3,0x29,0xC0,0x05,0x3A,0x05,
+0x31,0x29,0xC0,0x66,0x29,0x3D,0x29,0x3D,0x29,0xC0,0x31,0x3A,0xC6,0x1D,0x13,0xC1,0x1D,0x13,0x1D,0x13,0xA5,0x77,0xA2,0x78,0x89,0xAD,0xD7,0xB8,0x10,0x1A,0xA2,0x77,
+0xC0,0x18,0xC6,0x39,0x24,0x18,0xC1,0x24,0x18,0x24,0x18,0xC6,0x0D,0x06,0x05,0xC0,0x15,0x0A,0x05,0xC4,0x17,0xAC,0x34,0x06,0x37,0x05,0xC8,0x22,0xA2,0xF7,0xFE,0xB1,
+0x81,0x3D,0xC0,0x05,0xC0,0x29,0x3A,0x05,0xC0,0x3D,0x29,0x3D,0x29,0xC0,0x31,0x3A,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0x3A,0xCB,0x1D,0x13,0xC1,0x1D,0x13,0x1D,
+0x13,0x36,0xA2,0x75,0xFE,0x00,0x20,0xD7,0x10,0xFE,0x65,0xA7,0x1F,0x18,0x6F,0x18,0xC3,0x24,0x18,0x0E,0x24,0x18,0xC2,0x24,0x18,0x24,0x18,0xC5,0x8F,0xAD,0xFE,0x00,
+0x60,0x05,0xAA,0x64,0x9D,0x79,0x05,0xC1,0x2B,0x03,0x3F,0x20,0x10,0x06,0xA4,0x65,0x06,0x05,0xC0,0x0F,0x14,0x05,0xC4,0xB7,0x94,0x09,0x9E,0xB9,0x3D,0xC0,0x05,0xC0,
+0x29,0xC0,0x3A,0x29,0x31,0x05,0xC2,0x29,0xC0,0x05,0x3A,0x05,0x31,0xC0,0x29,0x05,0x31,0x29,0x3A,0xC9,0x29,0x1D,0xC0,0x59,0xC1,0x1D,0x13,0x1D,0xA8,0x55,0x9C,0x87,
+0x8C,0x9E,0xD8,0x39,0x18,0xC1,0x24,0x18,0x24,0x18,0xC2,0x25,0xA4,0x88,0x18,0xC1,0x24,0xC0,0x18,0xC6,0x0D,0xFE,0x0A,0x00,0x93,0xEF,0x37,0x19,0x05,0xC7,0xA5,0x88,
+0xAA,0x54,0x06,0x05,0xC7,0xAB,0x86,0x35,0x3D,0x7E,0xC2,0x6E,0xC0,0x29,0x0A,0x29,0x05,0xC4,0x3A,0xC0,0x29,0x3A,0x29,0x7E,0x3A,0x29,0x3A,0x29,0x3A,0xC4,0x29,0x3A,
+0xC3,0x1D,0x59,0xC1,0x1D,0x13,0x1D,0x13,0xAB,0x75,0x94,0x8A,0x91,0x9D,0xD8,0xB7,0x10,0x1A,0xA2,0x77,0xC0,0x18,0xC5,0x0D,0x9A,0x87,0x18,0xC3,0x24,0x18,0x24,0x18,
+0xC1,0x25,0x6B,0x12,0x37,0x10,0xA4,0x87,0x2E,0x10,0x06,0x37,0x9C,0x99,0x05,0xC0,0x37,0x10,0x15,0x37,0x19,0x10,0x19,0x05,0xC6,0xB7,0x94,0x09,0x9E,0xB9,0xC0,0x3D,
+0xC0,0x05,0xC1,0x6E,0x05,0xC3,0x0A,0xC0,0x05,0xC0,0x29,0xC1,0xA2,0x78,0x29,0x7E,0x3A,0x29,0x3A,0x29,0x3A,0xC9,0x1D,0xC0,0x13,0xC1,0x1D,0x13,0x1D,0xA8,0x55,0x93,
+0x99,0x95,0x9D,0xD8,0x06,0xBF,0x51,0x1F,0x18,0xC2,0x24,0x18,0x24,0x18,0xC0,0x94,0x8B,0x1F,0x9D,0x9A,0x18,0x2C,0x25,0x50,0x0E,0x35,0x0E,0x0A,0x35,0xC0,0x92,0xAD,
+0x06,0x37,0x32,0x28,0xC1,0x07,0x10,0x2A,0x4A,0x06,0x28,0xC0,0x07,0x2E,0x10,0x03,0x15,0x17,0x05,0xC4,0x3C,0xA6,0xE5,0x29,0xA3,0x98,0xC2,0x6E,0xC0,0x29,0x0A,0xC0,
+0x05,0xC5,0x29,0xC3,0x05,0x56,0x29,0x3A,0xCC,0x1D,0xC1,0x13,0xC1,0x1D,0x13,0x0F,0x91,0x9A,0x97,0x9C,0xD9,0xFE,0x43,0xE6,0x0D,0x18,0xC2,0x6F,0x18,0x24,0x18,0xC0,
+0x94,0x8B,0x25,0x2C,0x0D,0xC0,0x18,0xC1,0x24,0x18,0xC1,0x24,0x39,0x19,0x05,0xC7,0x37,0x10,0x32,0x05,0xAF,0x54,0x93,0xBC,0x05,0xC6,0xA6,0x87,0xB3,0xA2,0x09,0x3D,
+0x7E,0x3D,0xC0,0x05,0xC1,0x0A,0x05,0xC4,0x0A,0xC0,0x29,0x0A,0x29,0x05,0x29,0xA2,0x78,0xC0,0x29,0x3A,0x29,0x7E,0x3A,0x29,0x3A,0x29,0x3A,0xC6,0xFE,0x52,0x26,0x13,
+0xC5,0xAD,0x63,0x8A,0x9D,0x9B,0x8B,0x62,0xD8,0xAF,0x33,0x36,0x1F,0x18,0x6F,0x18,0xC4,0x25,0x0D,0x18,0xC2,0x24,0x18,0x24,0x18,0xC2,0x25,0xFE,0x01,0x60,0x05,0xC9,
+0xA8,0x55,0x14,0x10,0x28,0x05,0x0F,0x05,0xC4,0xB5,0x84,0x04,0xFE,0xB1,0x81,0x3D,0x29,0x3D,0x05,0x0A,0x05,0xC7,0x0A,0xC0,0x29,0x0A,0x29,0x05,0xC1,0x3D,0x29,0x3D,
+0x29,0xC0,0x7E,0x3A,0x29,0x3A,0xC7,0x1D,0x13,0xC4,0x1D,0xAB,0x64,0x89,0x9D,0x9C,0x8A,0xDA,0xBF,0x20,0x0D,0x18,0xC3,0x6F,0x18,0x24,0x0D,0x25,0x18,0xC1,0x24,0x18,
+0x24,0x18,0xC4,0xFE,0x22,0xC2,0x05,0xCB,0xA7,0x85,0x10,0x19,0x05,0xC4,0x3C,0xAB,0xA4,0x09,0x3D,0x7E,0xC3,0x0A,0xC0,0x29,0x0A,0xC1,0x05,0xC8,0x0A,0xC0,0x29,0xC0,
+0x3A,0x29,0x7E,0x3A,0x29,0x3A,0x29,0x3A,0xC5,0x13,0xC0,0x1D,0x13,0xC1,0x1D,0x13,0xA8,0x66,0x17,0x9D,0xAA,0x5A,0xD9,0xB3,0x33,0x0D,0x18,0xC1,0x24,0x18,0xC2,0x24,
+0x39,0x18,0xC1,0x24,0x18,0x24,0x18,0xC4,0x8A,0x9E,0xFE,0x00,0x60,0x05,0xCB,0x20,0x0F,0x05,0xC3,0x15,0xAF,0xC3,0xFE,0x89,0x40,0xA1,0xA9,0x3A,0xA1,0xA8,0xC2,0x9D,
+0x89,0xC0,0x05,0x3A,0x05,0x31,0x0A,0x05,0xC5,0x0A,0x05,0xC2,0x29,0x3A,0xCD,0x1D,0xC1,0x13,0xC3,0xA9,0x77,0x17,0x9D,0x9A,0xD9,0xA8,0x55,0x39,0xA5,0x84,0x24,0x18,
+0xC1,0x24,0x18,0x24,0x18,0xC0,0x35,0x0D,0x18,0xC1,0x24,0x18,0xC3,0x24,0x18,0x8F,0xAD,0xFE,0x00,0x60,0x05,0xCB,0x20,0x05,0xC3,0x17,0xB4,0x95,0xFE,0x8A,0x21,0x29,
+0x31,0x3D,0x29,0xA3,0x98,0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x05,0xC4,0x6E,0xC0,0x29,0x0A,0x29,0x05,0xC1,0x3D,0x3A,0xCE,0x1D,0xC1,0x13,0x1D,0x13,0xC1,0xA8,0x66,0x88,
+0x9D,0xDA,0xFE,0x43,0xE6,0xAE,0x41,0x69,0x1A,0x51,0x18,0xC2,0x9D,0x9B,0x9A,0x87,0xC0,0x0E,0x0A,0x0E,0x0D,0x18,0xC1,0x24,0x18,0xC3,0x0A,0x19,0x05,0xCB,0x15,0x2B,
+0x17,0x05,0xC1,0x22,0x04,0x31,0x29,0xC0,0x66,0x31,0x29,0xA3,0x98,0x31,0x05,0xC1,0x3D,0x29,0x3D,0x05,0x6E,0xC0,0x05,0xC5,0x0A,0x3D,0x29,0x3D,0x29,0xC0,0x31,0x3A,
+0x29,0x3A,0xC8,0xFE,0x52,0x26,0x13,0x1D,0x13,0xC1,0x1D,0x13,0x0F,0x17,0x9D,0x9A,0xD8,0xAF,0x54,0xFE,0x76,0x09,0x9B,0x75,0xA2,0x9B,0x06,0x18,0xC1,0x6F,0x18,0x06,
+0x18,0xC1,0x6B,0x18,0x2C,0x25,0xC0,0x0D,0x18,0xC3,0x24,0x0A,0xFE,0x00,0xA0,0x05,0xCB,0x2B,0x3F,0x05,0xC1,0x20,0xA9,0xF5,0x3D,0x7E,0x29,0x3A,0x29,0x7E,0x3A,0x29,
+0x3A,0x29,0x3A,0xC1,0x05,0x3D,0xC0,0x05,0xC1,0x6E,0x05,0xC2,0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x3A,0xC1,0x29,0x3A,0xC8,0x1D,0x13,0x1D,0x13,0xC3,0xA8,0x74,0x88,0x8F,
+0xD8,0x2B,0x1C,0x06,0x25,0x0D,0x12,0x18,0xC3,0x24,0x18,0x24,0x18,0xC3,0x0D,0x9A,0x87,0xC0,0x1A,0x06,0x18,0xC1,0x94,0x8B,0x19,0x05,0xCB,0x2B,0x03,0x05,0xC0,0xA6,
+0x87,0xAC,0xE4,0x09,0x31,0x3D,0x7E,0x3D,0xC0,0x31,0x5F,0x29,0x3D,0x05,0xC5,0x6E,0xC0,0x29,0x0A,0xC1,0x05,0xC2,0x3A,0xC0,0x29,0x3A,0xCD,0x1D,0x13,0xC4,0xA5,0x77,
+0xA2,0x78,0x89,0xAD,0xD8,0xB8,0x21,0x1A,0x0D,0x18,0x2C,0x9E,0x86,0xA2,0x9B,0x06,0x18,0xC2,0x24,0x18,0x24,0x18,0xC4,0x0D,0x0A,0xC0,0x1A,0x18,0xC0,0x39,0xFE,0x12,
+0x02,0x9C,0x99,0x97,0xCC,0x05,0xC9,0x2B,0x03,0x05,0xC0,0xB5,0x84,0xFE,0x99,0x61,0xA1,0xB8,0xC2,0x6E,0xC0,0x29,0x0A,0x29,0x05,0xC1,0x3D,0x05,0xC2,0x0A,0xC0,0x05,
+0xC3,0x3A,0xC0,0x29,0x3A,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0x3A,0xC7,0x1D,0x13,0xC3,0x1D,0x36,0x07,0x89,0xAD,0xD8,0x32,0x1A,0x25,0x0D,0x9A,0x87,0xA6,0x88,
+0x35,0x1F,0x18,0xC1,0x1F,0x18,0xC5,0x6F,0x18,0x24,0x18,0x25,0x12,0x0A,0x06,0x3B,0x10,0xA4,0x87,0x9C,0x78,0x9D,0xAA,0x10,0x19,0x2B,0x17,0x05,0xC2,0x17,0x37,0x10,
+0x15,0x05,0x3C,0xA6,0xE5,0x29,0xA3,0x98,0xC3,0x6E,0xC0,0x29,0x0A,0xC1,0x05,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0x05,0xC2,0x29,0x3A,0xCF,0x1D,0x13,0xC4,0xA7,0x87,0x5E,
+0x88,0x9D,0xD8,0x10,0xFE,0x76,0x09,0x9B,0x75,0xA2,0x9B,0x25,0xA4,0x88,0x97,0x89,0x2C,0x18,0xC1,0x24,0x18,0x24,0x18,0xC8,0xFE,0x23,0x41,0x37,0xAC,0x75,0xA0,0x34,
+0x2E,0x98,0x99,0x05,0xA2,0x77,0x05,0xC0,0x2B,0x06,0x37,0x10,0x77,0xC0,0x10,0x96,0xBB,0xA3,0x77,0x05,0xA9,0x85,0xAB,0xF6,0x29,0xC0,0x3D,0x7E,0xC1,0x29,0xC0,0x05,
+0x3A,0x05,0x6E,0x05,0xC2,0x29,0x3A,0xC0,0x05,0xC2,0x0A,0xC0,0x05,0xC2,0x29,0xC1,0x3A,0xCD,0x13,0xC4,0x1D,0x13,0xAB,0x75,0x85,0x9F,0xD8,0x19,0x1C,0xA4,0x51,0xFE,
+0x3B,0xE5,0xA8,0x76,0x0A,0xAA,0x77,0x93,0x9B,0x1F,0x18,0xC2,0x24,0x18,0x24,0x18,0xC4,0x0D,0x8D,0x9C,0x06,0x05,0x2E,0x0C,0x28,0x05,0x0F,0x05,0xCB,0xB2,0xE3,0xFE,
+0xA1,0x20,0xC3,0xA3,0x98,0x29,0xC1,0x05,0x3D,0x05,0xC0,0x6E,0x05,0xC0,0x29,0x3A,0x29,0x7E,0x05,0xC0,0x0A,0x05,0xC5,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0x3A,
+0xC8,0x1D,0x59,0xC3,0x1D,0x13,0xA7,0x65,0x8A,0x9E,0x66,0xD8,0x17,0xAA,0x55,0x19,0x0C,0x0E,0x24,0xFE,0x23,0x03,0xFE,0x55,0x63,0x24,0x18,0xC2,0x1F,0x18,0xC3,0x9D,
+0x9A,0x95,0x9D,0x19,0x8D,0xEF,0x10,0xA4,0x87,0xA6,0x54,0x92,0xBD,0x05,0x0F,0x05,0xCB,0x3C,0xFE,0x99,0x61,0xA1,0xB8,0x6E,0x05,0xC0,0x29,0x66,0x29,0x3D,0x05,0x3D,
+0xC0,0x05,0xC1,0x0A,0x05,0xC2,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0x3A,0xD0,0x13,0xC2,0x7B,0x13,0x1D,0xC0,0xAB,0x64,0x89,0x9D,0x9C,0x8A,0xD9,0x2B,0x9C,0x89,0x05,0xBF,
+0x20,0x25,0xFE,0x09,0x21,0xB1,0x30,0x1A,0x06,0x18,0xC5,0x6F,0x96,0x99,0xFE,0x23,0x03,0x8D,0xEF,0x76,0xA7,0x78,0x10,0xAC,0x43,0x98,0x89,0x17,0x05,0xCC,0xA6,0x87,
+0xAC,0xE4,0x3D,0x7E,0x6E,0x05,0xC0,0x29,0x66,0xC0,0x29,0x3D,0x05,0x0A,0x05,0xC2,0x29,0xA2,0x78,0xC0,0x05,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0x3A,0xD0,0x13,0xC5,0x1D,
+0xAB,0x64,0x17,0x9D,0xAA,0x5A,0xDB,0x32,0xFE,0x55,0x63,0x8F,0xBF,0x39,0x0E,0xAC,0x64,0x18,0xC3,0x24,0x0A,0x98,0x9B,0xFE,0x0A,0x00,0x0F,0x05,0xC1,0x0C,0x13,0x0F,
+0x05,0xCD,0xB0,0x95,0xA5,0xE6,0xFE,0xB1,0x81,0x3D,0xA2,0x87,0x05,0xC0,0x29,0x66,0xA2,0x87,0x29,0x05,0xC0,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0x3A,0xC0,0x0A,0x05,0xC2,
+0x29,0x3A,0xC0,0x05,0x3A,0xCE,0x13,0xC4,0x1D,0x13,0xAB,0x75,0x1F,0x9C,0x8A,0xDB,0xAB,0x55,0xB3,0x42,0xA8,0x76,0x0D,0x18,0x99,0x9C,0xC0,0x0D,0x18,0xC0,0x0D,0x9A,
+0x87,0x9B,0x9A,0x2C,0x96,0x99,0xFE,0x00,0xA0,0x05,0xC1,0x2B,0xAA,0x55,0x98,0x89,0x9A,0xBB,0x05,0xC4,0x17,0x05,0xC6,0xB2,0xE3,0x29,0xA4,0x87,0x66,0xC2,0x29,0x3A,
+0xC0,0x05,0x0A,0xC0,0x05,0xC5,0x0A,0x3D,0x0A,0x3A,0x05,0xC2,0x0A,0xC0,0x29,0x0A,0x29,0x3A,0xD0,0x1D,0x59,0xC3,0x1D,0xC0,0xAB,0x64,0x8E,0x8B,0x97,0x9C,0xD9,0xAB,
+0x44,0xB3,0x53,0x36,0xA7,0x75,0x12,0x1F,0x1A,0x18,0x25,0x50,0x0E,0x9D,0x87,0x9D,0x89,0x0A,0xAA,0x77,0x0E,0xFE,0x01,0x00,0x9A,0xBB,0x05,0xC1,0x31,0x06,0x05,0xCE,
+0x3F,0x04,0xFE,0xB1,0x81,0x3D,0xA2,0x87,0xC0,0x05,0xC0,0x29,0x66,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0x3A,0x05,0xC3,0x3A,0xC0,0x29,0x3A,0x29,0xA2,0x77,0x3A,0xD1,0x1D,
+0x59,0xC3,0x1D,0xC0,0xA7,0x76,0x94,0x78,0x95,0x9D,0xD7,0x2B,0xB3,0x22,0xFE,0x55,0x63,0xAA,0x77,0x18,0xC0,0x25,0xA4,0x88,0x18,0xC1,0x1A,0x51,0x18,0x06,0x39,0x35,
+0xFE,0x0A,0x00,0x9C,0xAB,0xC0,0x2E,0x15,0xA9,0x75,0x13,0x92,0xEF,0x05,0xCE,0xB0,0x94,0xFE,0x99,0x61,0xA1,0xB8,0x6E,0x05,0xC2,0x0A,0xC0,0x29,0x0A,0xC1,0x05,0x0A,
+0xC0,0x05,0xC2,0x29,0x3A,0xC0,0x05,0x0A,0xC0,0x05,0x3D,0xC0,0x65,0x3A,0x29,0x3D,0x3A,0xD0,0xFE,0x4A,0x25,0xC5,0x1D,0xAB,0x64,0x95,0x8B,0x90,0x9C,0xD6,0x2E,0x39,
+0x18,0xC2,0x6F,0x18,0x0E,0x18,0xC1,0x24,0x18,0x24,0x18,0xC0,0x0D,0x36,0xC0,0x1F,0x9D,0x99,0x18,0x35,0x19,0x05,0xCF,0x13,0x37,0xA1,0xB8,0x0A,0x05,0xC3,0x0A,0xC0,
+0x05,0xC1,0x3D,0x05,0x0A,0x05,0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x05,0xC2,0x0A,0x05,0x29,0x31,0x29,0x05,0x31,0x29,0x3A,0xCE,0x13,0xC6,0xA5,0x77,0x13,0x90,0x7B,0xD4,
+0x2B,0x28,0x2C,0x0D,0x18,0xC3,0x24,0x96,0x99,0x1A,0x06,0x18,0xC3,0x1A,0x0E,0x12,0xA8,0xAB,0x1F,0x18,0xC0,0xFE,0x1B,0x41,0x0F,0x05,0xCF,0xB0,0x88,0xA4,0xE2,0x29,
+0xA3,0x98,0xC0,0x56,0x29,0x3D,0x05,0x6E,0xC1,0x05,0xC0,0x29,0x66,0x31,0x3D,0x29,0x3D,0x05,0x0A,0xC2,0x05,0xC5,0x29,0x3A,0xD1,0x9F,0x1B,0x49,0xA3,0x7B,0x1D,0x13,
+0xC1,0x1D,0x13,0xA8,0x66,0x17,0x9D,0x9A,0xD2,0xA5,0x87,0xBA,0x21,0x0D,0x18,0xC4,0x6F,0x18,0x24,0x96,0x99,0x24,0x18,0xC2,0x0D,0x8D,0x9C,0xFE,0x01,0x00,0x9B,0xBB,
+0xA6,0x66,0xFE,0x6D,0x69,0x18,0x99,0x9C,0xFE,0x01,0x60,0x05,0xD0,0x3F,0xB0,0x95,0xFE,0xA1,0xC1,0x9B,0xBA,0xC3,0xA3,0x98,0xC1,0x6E,0x05,0xC0,0x29,0x66,0x0A,0xC0,
+0x05,0xC5,0x0A,0x52,0x0A,0x3A,0x05,0xC0,0x29,0x3A,0x29,0x31,0x3A,0x29,0x3A,0x29,0x3A,0xCB,0x9C,0x2A,0xC1,0x6E,0xA2,0x79,0xA3,0x5A,0x1D,0x59,0xC0,0x0D,0x89,0x9D,
+0x5A,0xD1,0xAB,0x44,0xBB,0x41,0xAE,0x51,0x18,0xC2,0x24,0x18,0x24,0x18,0xC1,0x99,0x9B,0x2C,0x18,0xC1,0x24,0xFE,0x3B,0xE5,0x0F,0x05,0xC0,0xA5,0x88,0x1C,0x24,0x8E,
+0xAC,0x0F,0x05,0xD1,0x22,0xFE,0x99,0x61,0xC0,0x29,0x31,0x29,0xA3,0x98,0x31,0x05,0xC1,0x3D,0x29,0x3A,0x05,0xC0,0x3D,0x0A,0x05,0xC0,0x29,0x66,0x31,0x3D,0x31,0x29,
+0x05,0x31,0x29,0x3A,0xD4,0x0E,0xC0,0x6E,0x0E,0xC0,0x13,0x0E,0x2B,0x70,0x0D,0x8D,0x8B,0x9C,0x8A,0xD0,0x06,0xBB,0x41,0xAE,0x51,0x18,0xC3,0x24,0x18,0x24,0x18,0xC2,
+0x25,0xA4,0x88,0x18,0xC1,0x8F,0xAD,0x28,0xC0,0xA3,0xA8,0xB5,0x44,0x0D,0x18,0xFE,0x22,0xC2,0x05,0xD2,0x3F,0xB2,0xA2,0x31,0x0A,0x66,0xC5,0x0A,0x3D,0x0A,0x3A,0x05,
+0xC0,0x29,0x05,0xC0,0x29,0xC1,0x3A,0x29,0xC1,0x05,0x3D,0x05,0xC0,0x3A,0xD2,0x0E,0xC0,0x13,0x0E,0xC1,0x13,0x0E,0xC0,0xAC,0x55,0x99,0x29,0x95,0x9D,0xCF,0xA8,0x55,
+0x2C,0x0D,0x9C,0x9A,0xA7,0x75,0x18,0x24,0x18,0xC5,0x24,0x18,0x24,0x96,0x99,0x25,0x0D,0x18,0xC0,0x0A,0x9E,0x9B,0x0D,0x1F,0x1A,0x18,0xFE,0x0A,0x00,0x93,0xEF,0x05,
+0xD2,0xB0,0x95,0x04,0xFE,0xB1,0x81,0x3D,0xA2,0x87,0xC0,0x05,0xC2,0x0A,0xC0,0x05,0xC1,0x3D,0x0A,0x05,0xC2,0x29,0x3A,0xC0,0x05,0x3A,0x3D,0x29,0x3D,0x29,0xC0,0x31,
+0x3A,0x29,0x3A,0xCE,0x9C,0x2A,0xC0,0x6E,0x0E,0xC2,0x13,0x0E,0xAA,0x63,0xA1,0x2A,0x8F,0x8E,0xC1,0x6E,0x05,0xC4,0x17,0x05,0xC3,0xA5,0x87,0xA5,0x78,0x10,0x37,0x10,
+0x15,0xB4,0x31,0x0D,0x18,0xC3,0x24,0x18,0x24,0x18,0xC1,0x0D,0x8D,0x9C,0x39,0x36,0x1F,0x18,0x24,0x9C,0x99,0x36,0x39,0xFE,0x01,0x60,0x05,0xD3,0x3F,0xB2,0xA2,0x3D,
+0x7E,0x6E,0x05,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0xC0,0x05,0x9D,0x89,0x31,0x05,0x3D,0xC0,0x05,0xC1,0x31,0x05,0x29,0x05,0x3A,0xD1,0x0E,0xC0,0x13,0x0E,0xC1,0x79,0x0E,
+0xC0,0x13,0xFE,0x52,0xC6,0x8B,0xAD,0x5A,0xCC,0x2B,0x10,0x19,0x05,0xC3,0x10,0x1D,0x0D,0x18,0xC4,0x24,0x18,0x24,0x8E,0xAC,0x19,0x05,0xA7,0x55,0x10,0xA4,0x87,0xA6,
+0x54,0x31,0x9C,0x78,0x9D,0xAA,0x19,0x05,0xD4,0xB9,0x84,0xFE,0x99,0x61,0xA1,0xB8,0x6E,0x05,0xC0,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0x3A,0xC0,0x29,0x3A,0x29,0x7E,0x05,
+0xC0,0x0A,0x05,0x3D,0xC0,0x31,0x3A,0x29,0x3D,0x3A,0xCE,0x0E,0xC0,0x13,0x0E,0xC1,0x79,0x0E,0xC0,0x13,0x36,0x17,0x9D,0xAA,0x5A,0xCB,0x10,0x28,0x05,0xA2,0x77,0x05,
+0xC3,0x6E,0xB3,0x53,0xFE,0x65,0xA7,0x1F,0x18,0x24,0x18,0xC2,0x39,0x19,0x05,0xC6,0x20,0x0F,0x05,0xD4,0xB7,0x94,0xFE,0x89,0x40,0x37,0xA1,0xB8,0xC2,0x6E,0xC0,0x05,
+0xC1,0x3D,0x0A,0xC0,0x05,0x29,0x31,0x29,0xC2,0x05,0x3D,0x0A,0x05,0xC0,0x29,0x66,0x31,0x3D,0x31,0x3A,0xCF,0x0E,0xC0,0x13,0x0E,0xC1,0x79,0x0E,0xC1,0xAC,0x55,0x99,
+0x29,0x95,0x9D,0xCB,0xA6,0x87,0xA2,0x56,0x19,0x05,0xC7,0xB3,0x33,0xFE,0x5D,0xA6,0x18,0xC1,0x6F,0x18,0x95,0xAD,0x37,0x19,0x05,0xC6,0x3A,0x0F,0x05,0xD3,0x2B,0xB4,
+0xA2,0xFE,0xA1,0xC1,0x3D,0x7E,0xC0,0x6E,0x05,0xC5,0x0A,0x3D,0x0A,0x42,0x05,0xC0,0x29,0x05,0xC0,0x3D,0x0A,0x05,0xC1,0x29,0xC0,0x05,0x3A,0xD1,0x9C,0x2A,0xC0,0x13,
+0xFE,0x9D,0x2D,0x9E,0x9D,0x28,0x0E,0xC0,0x13,0x0E,0xAA,0x63,0xA0,0x3D,0x90,0x6A,0xCB,0x10,0x19,0x05,0xC9,0x17,0x1A,0x18,0xC1,0x99,0x9B,0xFE,0x02,0x00,0x94,0xFE,
+0x05,0xC7,0x2B,0x17,0x08,0x05,0xD2,0xB0,0x74,0x35,0x29,0xA3,0x98,0xC0,0x3D,0x0A,0x05,0xC5,0x0A,0x3D,0x0A,0xC0,0x05,0xC2,0x0A,0xC0,0x05,0xC1,0x3D,0x0A,0x3A,0xD3,
+0xBC,0x56,0xC4,0x96,0x99,0x01,0xC3,0x99,0x99,0xA3,0x88,0x01,0xC4,0x27,0x01,0xF8,0x93,0xA9,0xAC,0x78,0x01,0xF7,0x27,0x01,0xF7,0x19,0x00,0x01,0xEF,0x00,0x9C,0x88,
+0x9A,0x99,0x01,0xC3,0x00,0x19,0x01,0xEC,0x00,0x18,0x26,0xA2,0x98,0xA3,0x68,0xA2,0x87,0x01,0xC3,0x18,0xAA,0x78,0x01,0xE9,0x00,0x18,0x26,0x3D,0x10,0x1D,0xC2,0x18,
+0x00,0x19,0x01,0x3C,0x01,0xFD,0xC5,0x27,0x01,0xE7,0x19,0x27,0x26,0x3D,0x10,0x1D,0xC3,0x18,0x1D,0xA7,0x99,0x19,0x27,0x07,0xC1,0x00,0x19,0x01,0x3C,0x01,0xFD,0x00,
+0x19,0x01,0x3C,0x01,0xE3,0x00,0x18,0x26,0x3D,0x1D,0xC6,0x18,0x1D,0x01,0xC3,0x00,0xC0,0x18,0x07,0xC0,0x00,0xC0,0x19,0x01,0x3C,0x01,0xF8,0x27,0x01,0xE3,0x19,0x27,
+0x26,0x3D,0x10,0x1D,0xC3,0x18,0x1D,0xC1,0x18,0x1D,0xC0,0x01,0xC8,0x19,0x00,0x18,0x07,0xC0,0x00,0x19,0x01,0x3C,0x01,0xF4,0x18,0x39,0x01,0xE0,0x00,0x18,0x26,0x3D,
+0x1D,0xC1,0x18,0x1D,0xC2,0x18,0x1D,0xC3,0x18,0x01,0xCC,0x19,0x00,0x18,0x07,0xC0,0x00,0x19,0x28,0x3C,0x01,0xF0,0x18,0x39,0x01,0xDE,0x00,0x18,0x26,0x3D,0x1D,0xC0,
+0x5A,0x1D,0xC0,0x18,0x1D,0xC4,0x18,0x1D,0xC2,0x01,0xD0,0x19,0x00,0x18,0x07,0xC1,0x00,0x19,0x28,0x3C,0x01,0xEA,0x19,0x00,0x01,0xDD,0x00,0x3D,0x10,0x1D,0xC3,0x1A,
+0x1D,0xC1,0x18,0x1D,0xC5,0x18,0x1D,0xC0,0x01,0xD4,0x28,0x19,0x00,0x18,0x26,0x3D,0x1D,0x00,0x19,0x01,0x3C,0x01,0xE5,0x00,0x19,0x01,0x3C,0x01,0xD9,0x00,0x18,0x07,
+0x18,0x07,0x1D,0xC2,0x1A,0x1D,0xC0,0x18,0x1D,0xC6,0x18,0x1D,0xC1,0x01,0xD9,0x28,0x19,0x27,0x07,0xC0,0x3D,0x10,0x00,0x19,0x01,0x3C,0x01,0xE0,0x18,0x39,0x01,0xD9,
+0x00,0x26,0x3D,0x10,0x1D,0xC3,0x1A,0x1D,0xC1,0x18,0x1D,0xC7,0x18,0x1D,0xC1,0x01,0xC6,0x28,0x19,0x00,0x18,0x07,0x1D,0x27,0x00,0x19,0x01,0x3C,0x01,0xC3,0x69,0xC4,
+0x3C,0x01,0x3A,0xC1,0x3C,0x01,0xCA,0x18,0x01,0xD8,0x00,0x26,0x3D,0x10,0x1D,0xC2,0x18,0x1D,0xC8,0x18,0x1D,0xC2,0x01,0xCC,0x19,0x00,0x9F,0xA6,0xC0,0xA5,0x87,0xA4,
+0x89,0x6D,0x62,0x69,0xC1,0x0F,0xC1,0x56,0xC2,0xA2,0x98,0xA3,0x68,0x3E,0x3C,0x3E,0x3C,0x3A,0xC1,0x67,0x01,0xC3,0x19,0x00,0x01,0xD6,0x19,0x27,0x26,0x18,0x61,0x1D,
+0x27,0x1D,0xC0,0x18,0x1D,0xC9,0x18,0x1D,0xC2,0x01,0xC9,0x3E,0x6D,0x2B,0xC0,0x0F,0x9B,0x99,0x9D,0xAA,0x41,0x9B,0x88,0x9D,0x9B,0x55,0x51,0xC1,0x9D,0x9A,0x6E,0x05,
+0x0A,0x05,0x0A,0x05,0x0A,0x2B,0x6B,0x3A,0xA3,0x98,0xA7,0x76,0x29,0x0F,0x31,0x3E,0x47,0xC1,0x67,0x01,0x27,0x01,0xD5,0x19,0x27,0x26,0x10,0x1D,0xC2,0x18,0x1D,0xCA,
+0x18,0x1D,0xC4,0x01,0xC5,0x28,0x0F,0xC0,0x97,0x99,0x9C,0x8A,0x9C,0x87,0x17,0xC0,0x05,0x0A,0x05,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x05,0xCE,0xA6,0x87,0xA8,0x86,0x29,
+0x0F,0xA4,0x68,0xC0,0x3E,0x93,0x9B,0x39,0x01,0xD3,0x00,0x26,0x3D,0x1D,0xC2,0x1A,0x1D,0xC2,0x18,0x1D,0xCB,0x18,0x1D,0xC0,0x01,0xC1,0x3E,0x6D,0x9A,0x89,0x06,0x97,
+0x99,0x17,0x05,0x0A,0x05,0xDF,0xA7,0x87,0x22,0xA8,0x84,0xA0,0x8A,0xA1,0x6A,0x3E,0x47,0x01,0xD0,0x93,0xA9,0xC0,0x1D,0xC2,0x1A,0x1D,0xC3,0x18,0x1D,0xCC,0x18,0x1D,
+0xC0,0x01,0xC0,0x9C,0x95,0x06,0x97,0x99,0x17,0x05,0xD3,0x0A,0x05,0xD1,0xA9,0x97,0x22,0xA8,0x84,0xA2,0x7A,0x3A,0xC1,0x67,0x01,0xCA,0x19,0x26,0x3D,0x10,0x1D,0xC2,
+0x18,0x1D,0xCD,0x18,0x1D,0xC5,0x01,0x99,0xA4,0x8E,0x8D,0x05,0xEC,0x3F,0x22,0x16,0x3E,0x3A,0xC1,0x3C,0x01,0xC7,0x00,0x26,0x1D,0xC4,0x18,0x1D,0xCE,0x18,0x1D,0xC5,
+0x01,0x94,0xA5,0x05,0xEF,0xA6,0x87,0x20,0xA7,0x99,0xC0,0x4F,0x3C,0x01,0x69,0x01,0xC4,0x18,0x61,0x1D,0x27,0x1D,0xC1,0x18,0x1D,0xCF,0x18,0x1D,0xC6,0x01,0x94,0xA3,
+0x0A,0x05,0xF0,0xA7,0x85,0xAE,0x87,0x35,0xC0,0x3A,0x01,0xC4,0x07,0xC0,0x1D,0xC1,0x18,0x1D,0xD0,0x18,0x1D,0xC8,0x01,0x90,0xA5,0x05,0xD5,0x0A,0x05,0xD5,0x0A,0x05,
+0xC3,0xAB,0x86,0x24,0xA4,0x66,0x3A,0xC1,0x3C,0x01,0x3D,0x10,0x1D,0xC3,0x18,0x1D,0xD1,0x18,0x1D,0xC6,0x3E,0x8D,0x99,0x97,0x9C,0xF4,0xA6,0x87,0xAE,0x73,0xA7,0x9A,
+0xA0,0x6A,0xC1,0x26,0x3D,0x10,0x1D,0xC3,0x18,0x1D,0xD0,0x1A,0x1D,0xC2,0x18,0x1D,0xC2,0xAB,0x85,0x88,0xBB,0x05,0xF6,0xA9,0x97,0xAE,0x65,0x1E,0x96,0x8B,0x10,0x1D,
+0xC3,0x18,0x1D,0xD0,0x1A,0x1D,0xC0,0x18,0x1D,0xC6,0x31,0x86,0xAC,0x05,0xF8,0x13,0x1E,0x20,0x1D,0xC5,0x18,0x1D,0xD0,0x1A,0x1D,0xC1,0x18,0x1D,0xC3,0x07,0x05,0xDF,
+0x0A,0x05,0xD8,0xAB,0x86,0x24,0x29,0x1D,0xC6,0x18,0x1D,0xD0,0x1A,0x1D,0xC2,0x18,0x1D,0xC0,0xA3,0xA4,0x0F,0x05,0xF8,0x0A,0x05,0xA9,0x85,0xAF,0x87,0xC0,0x18,0x61,
+0x1D,0x27,0x1D,0xC2,0x18,0x1D,0xD0,0x1A,0x1D,0xC3,0x18,0x9B,0xA7,0x95,0x9B,0xFC,0xA6,0x87,0xB1,0x75,0x1E,0x96,0x8B,0x1D,0xC2,0x1A,0x1D,0xC4,0x18,0x1D,0xD0,0x1A,
+0x1D,0x01,0xC0,0x8C,0xA6,0x17,0x05,0xFD,0x22,0xA5,0x88,0x18,0x61,0x1D,0x27,0x1D,0xC3,0x18,0x1D,0xD0,0x1A,0x1D,0xC5,0x18,0x01,0xA1,0x85,0x86,0xAC,0x05,0xFD,0xC1,
+0x22,0xA5,0x88,0x9B,0x69,0x1D,0xC2,0x1A,0x1D,0xC5,0x18,0x1D,0xD0,0x1A,0x1D,0xC1,0x01,0x9C,0x95,0x05,0xD1,0x3F,0x51,0x17,0x05,0xE0,0x0A,0x05,0xC8,0x13,0x0F,0x18,
+0x1D,0xC2,0x1A,0x1D,0xC6,0x18,0x1D,0xD0,0x1A,0x1D,0x01,0x22,0x05,0xD1,0xBD,0x73,0xAE,0x96,0x36,0x1F,0x05,0xC0,0x0A,0x05,0xE8,0x29,0xC0,0x18,0x61,0x1D,0x27,0x1D,
+0xC4,0x18,0x1D,0xD0,0x1A,0x1D,0xC2,0x01,0x94,0xA5,0x05,0xD1,0x1E,0xFE,0xEF,0x98,0x9D,0x9A,0x90,0x75,0x13,0x17,0xC0,0x05,0x0A,0x05,0xA6,0x87,0xAE,0x73,0x1F,0x05,
+0xC1,0x0A,0x05,0xDE,0x3A,0x0F,0x29,0x1D,0xC3,0x1A,0x1D,0xC7,0x18,0x1D,0xCF,0x31,0x12,0x05,0xD1,0x29,0x2B,0xA3,0x89,0xC0,0x96,0x86,0x8B,0x99,0x8A,0x8B,0x97,0x9C,
+0xC2,0x36,0xAD,0x98,0x93,0x89,0x1F,0x05,0x0A,0x05,0xC2,0x0A,0x05,0xDA,0x3A,0xB1,0x75,0x13,0x1D,0xC7,0x18,0x1D,0xD0,0x1A,0x1D,0xC1,0x31,0x1F,0x05,0xD1,0xAE,0x85,
+0xFE,0xE7,0x38,0x0B,0xC1,0x2B,0x21,0x13,0x90,0x8B,0x05,0xC0,0x3A,0x21,0xAE,0x89,0x8F,0x99,0x86,0x8B,0x05,0xE1,0x20,0x24,0x06,0x1D,0xC2,0x1A,0x1D,0xC8,0x18,0x1D,
+0xC6,0x9D,0xA9,0xC0,0x26,0xA2,0x98,0x26,0x3D,0x26,0xAD,0x84,0x05,0xD2,0x3F,0x34,0x0B,0xC2,0x69,0x93,0x8A,0x1E,0x17,0xC0,0x05,0x29,0x34,0xA8,0x89,0x92,0x86,0x1E,
+0x17,0x05,0xE0,0x13,0x1E,0x18,0x61,0x1D,0x27,0x1D,0xC5,0x18,0x1D,0xC5,0x26,0x69,0x56,0x1F,0x17,0x3D,0x10,0x71,0xC0,0xA3,0x99,0xC1,0x01,0xD4,0x99,0xA4,0x05,0xD2,
+0x3F,0xFE,0xCE,0xB3,0x0B,0xC4,0x34,0x8A,0x89,0x87,0x9A,0x9C,0x8A,0x05,0x0F,0x04,0x0B,0x9C,0x86,0x21,0x12,0x05,0xC1,0x0A,0x05,0xDC,0x36,0xA2,0x78,0x18,0x61,0x1D,
+0x27,0x1D,0xC6,0x18,0x1D,0xC0,0x26,0x69,0x26,0x3D,0x10,0x25,0xC8,0x01,0xD3,0xA1,0x85,0x8F,0xBB,0x05,0xD2,0xA5,0x87,0xFE,0xBE,0x54,0x04,0x6B,0xC2,0x04,0x0B,0x15,
+0x8A,0x89,0x85,0x9B,0x97,0x9C,0x13,0xFE,0xDE,0xF8,0x0B,0xC1,0x8F,0xA8,0x86,0x79,0x05,0xDF,0x2B,0x1E,0x9B,0x87,0x18,0x07,0x1D,0x27,0x1D,0xC5,0x26,0x1F,0x26,0x02,
+0x25,0xCC,0x01,0xD3,0x31,0x8B,0xBA,0x17,0x05,0xD2,0xFE,0xBD,0xD1,0x0B,0xC3,0x04,0x0B,0xC0,0x9D,0x98,0x21,0x81,0x9C,0x3A,0xFE,0x9C,0xF1,0x0B,0xC2,0x34,0x1E,0x17,
+0x9D,0x9A,0xC0,0x0A,0x05,0xDB,0xAB,0x86,0x24,0x29,0x1D,0xC5,0x26,0x1F,0x26,0x02,0x25,0xCF,0x01,0xD3,0x9D,0xA5,0x17,0xC0,0x05,0x0A,0x05,0xD0,0x22,0x04,0x0B,0xC0,
+0x7A,0xC1,0x0B,0xC2,0x21,0x31,0x36,0x2B,0x0B,0x34,0x0B,0xC0,0x34,0x87,0x89,0x88,0x9C,0x17,0x05,0xDD,0x29,0x0F,0x18,0x07,0x1D,0x27,0x1D,0x26,0x3D,0x10,0x25,0xD3,
+0xA7,0x67,0x01,0x66,0x01,0x3C,0x01,0xCD,0x98,0xA5,0x05,0xD4,0x21,0x04,0x0B,0xC0,0x0E,0x0B,0x9D,0x98,0x0C,0x55,0xC0,0xA3,0x98,0x0C,0x8C,0x86,0x87,0x8A,0xFE,0xBD,
+0xD1,0xA3,0x77,0x34,0x0B,0xC1,0x15,0x36,0x05,0x97,0x9C,0xDD,0x3A,0xB5,0x84,0x9C,0x79,0x18,0x9C,0xA9,0x26,0x3D,0x25,0xD5,0x3D,0x26,0xC0,0x3D,0x10,0x1D,0xC0,0xA3,
+0x99,0xA3,0x88,0x01,0x3C,0x01,0xC3,0x69,0x01,0xC2,0x94,0xA5,0x05,0xD4,0x21,0x04,0x0B,0xC0,0x95,0x8B,0x33,0x25,0x95,0x88,0x7E,0xC0,0x16,0xA6,0x78,0x13,0xA3,0x77,
+0xA5,0x88,0x36,0x0B,0xC2,0x0E,0x15,0x8A,0x89,0x85,0x9B,0x97,0x9C,0xDD,0xAC,0x87,0x2B,0x20,0x02,0x25,0xD7,0x3D,0xC0,0x10,0x02,0x3D,0x26,0xC1,0x3D,0x26,0xA4,0x87,
+0xC0,0xA6,0x78,0x19,0x28,0x3C,0xC0,0x01,0x69,0x01,0xA1,0x85,0x8D,0xBA,0x97,0x9C,0xD4,0xFE,0x7C,0x2B,0xBB,0x98,0x92,0x9B,0x8C,0x68,0x8C,0x99,0x17,0x36,0x19,0xA9,
+0xB7,0x33,0xC2,0x9C,0x85,0x9B,0x78,0xBB,0xAA,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x9D,0x88,0x36,0x87,0x8A,0x97,0x9C,0xDD,0x22,0x0F,0x18,0x25,0xC8,0x02,0xC0,0x26,0x69,
+0x26,0xC0,0x3D,0x25,0xC6,0x3D,0xC1,0x10,0x02,0x3D,0xC0,0x10,0x02,0x3D,0xC1,0x26,0xC2,0x3D,0x10,0x00,0xA3,0x88,0x0F,0x17,0x05,0xD4,0x0F,0x9B,0x9A,0x99,0x9B,0xB0,
+0x76,0xAE,0x88,0x2D,0xA7,0x97,0x0B,0xC3,0x04,0x0B,0x96,0x86,0x34,0x0B,0xC4,0x0E,0x34,0x1E,0x8B,0x9B,0x9C,0x8A,0xDC,0xA6,0x87,0x3C,0x29,0x25,0xC5,0x02,0xC0,0x26,
+0x61,0xC6,0x25,0xC5,0x02,0x3D,0x10,0x02,0x3D,0xC2,0x10,0x02,0x3D,0xC3,0x10,0x02,0x3D,0x26,0x3D,0x22,0x05,0xD5,0xB5,0x84,0xB8,0x97,0x2A,0x0B,0xC2,0x04,0x0B,0xC3,
+0x0E,0x04,0x9C,0x87,0x0B,0xC4,0x2B,0x1E,0x95,0x9A,0x29,0x08,0x05,0xDC,0x29,0x0F,0x25,0xC4,0x3D,0x9C,0x88,0xCA,0x25,0xC4,0x3D,0xC2,0x10,0x02,0x3D,0xC4,0x10,0x02,
+0x3D,0xC3,0x29,0x20,0x05,0xD5,0x36,0x2B,0x0B,0x6B,0x0B,0xC1,0x04,0x0B,0xC8,0x0E,0x04,0x0B,0xC0,0xFE,0x73,0xAD,0x93,0x88,0xAD,0x87,0x33,0x8D,0x86,0x8D,0x9D,0xDC,
+0x3A,0xB2,0x74,0x29,0x25,0xC1,0x02,0x26,0x69,0x15,0xCA,0x25,0xC4,0x3D,0xC4,0x10,0x02,0x3D,0xC5,0x10,0x02,0x3D,0xC0,0x36,0x8F,0x9B,0x05,0xD5,0x36,0x19,0x2D,0x37,
+0xA4,0x66,0x0C,0xA8,0x76,0x12,0x0B,0xC2,0x04,0x0B,0xC5,0x0E,0x34,0x2D,0x2A,0x12,0x0B,0x8F,0xA8,0xFE,0x21,0x41,0x97,0x9C,0xDC,0x06,0x24,0x25,0xC0,0x02,0x26,0x15,
+0xCC,0x25,0xC4,0x3D,0xC6,0x10,0x02,0x3D,0xC6,0x10,0x29,0x05,0x0A,0x05,0xD4,0x29,0x0F,0x3E,0x25,0x32,0xC0,0xB4,0x76,0x2D,0x12,0x0B,0xC2,0x04,0x0B,0xC4,0x34,0xA2,
+0x9A,0x0B,0x0E,0x0B,0xC1,0x82,0x88,0x17,0xC0,0x05,0x0A,0x05,0xD8,0xA5,0x87,0x1E,0x9A,0x88,0x26,0x69,0x15,0xCD,0x25,0xC4,0x02,0xC0,0x26,0x3D,0xC5,0x10,0x02,0x3D,
+0xC4,0xA7,0x85,0x20,0x05,0xD6,0x13,0x0C,0xA8,0x8B,0x54,0x9C,0x88,0x2D,0x18,0x26,0xFE,0xB5,0xB2,0x12,0x0B,0xC3,0x0E,0x04,0x0B,0x0E,0xC0,0x96,0x76,0x0B,0xC2,0x9A,
+0x99,0x21,0x8F,0x88,0x13,0x17,0x05,0xDB,0x29,0xA4,0x75,0x15,0xCF,0x25,0xC4,0x3D,0xC9,0x10,0x02,0x3D,0xC3,0x29,0x94,0x88,0x17,0x05,0xD5,0x3C,0x19,0xA6,0x8C,0xC1,
+0x11,0x8D,0x23,0x9C,0xAB,0x3F,0x11,0x0B,0xC7,0x34,0xA5,0x99,0x0B,0x12,0x60,0x11,0x82,0x9A,0x9B,0x79,0xAC,0x64,0xAD,0xB8,0x87,0x9A,0x05,0xDB,0xA6,0x87,0xB5,0x84,
+0x20,0x15,0xCE,0x25,0xC4,0x3D,0x02,0xC0,0x3D,0xC7,0x10,0x02,0x3D,0xC2,0x29,0x05,0xD7,0x3C,0xFE,0xE7,0x38,0xA6,0x8C,0xC0,0x33,0xFE,0x33,0x25,0xA1,0x34,0x92,0xFF,
+0x17,0x3A,0x21,0x12,0x0B,0xC4,0x61,0x98,0x76,0x0B,0xC0,0x3A,0x30,0x85,0x8B,0x7E,0xA9,0x56,0xA9,0x65,0xB0,0xD8,0x13,0x08,0x05,0xDB,0x29,0x39,0x15,0xCD,0x02,0x25,
+0xC4,0x9C,0xB8,0xC2,0x3D,0xCB,0x13,0x22,0x05,0x0A,0x05,0xD5,0x3C,0xFE,0xD6,0xD7,0x31,0xC0,0x3D,0x82,0x13,0x9D,0x77,0x05,0xC0,0xAA,0x66,0x36,0x2D,0x12,0x0B,0xC1,
+0x04,0x0B,0x96,0x86,0xA7,0x9A,0x0B,0x61,0x30,0x8F,0x47,0x99,0xAA,0x05,0x37,0xAF,0x43,0xFE,0x9C,0xF1,0xC0,0xFE,0x10,0xC1,0x17,0x05,0xC1,0x0A,0x05,0xD6,0xAF,0x84,
+0xA9,0x96,0x90,0x8F,0xCD,0x25,0xC5,0x06,0xC8,0x02,0xC0,0x26,0xA2,0x98,0xC2,0xA9,0x84,0x20,0x05,0xD7,0x3C,0x34,0x31,0xC0,0x9B,0x87,0xFE,0x2B,0x24,0x19,0x90,0xCD,
+0x9D,0xAA,0x2E,0xAD,0xCA,0xAA,0x99,0x2A,0x0B,0xC3,0x96,0x86,0x0B,0xC0,0x33,0x9C,0x85,0x93,0x25,0x9A,0x79,0x93,0xFF,0x28,0x08,0x11,0x33,0x22,0x8D,0x9D,0xDB,0xA6,
+0x87,0x24,0x20,0x15,0xCB,0x25,0xC6,0x9C,0xC8,0xC1,0x06,0xC3,0x09,0xC0,0x06,0x09,0xC0,0x06,0x09,0x06,0x3D,0xAB,0x74,0x8D,0xAB,0x05,0xD7,0x3C,0xB7,0x86,0xB4,0x8C,
+0x31,0x1B,0x89,0x98,0xFE,0x1B,0x41,0x9E,0xAB,0x9C,0xAB,0xAB,0x75,0x2D,0xAB,0x97,0x11,0x0B,0x0E,0xC0,0x0B,0x9A,0x99,0x34,0x0B,0x11,0xAF,0x9A,0xC0,0x32,0x08,0x0C,
+0x08,0x0C,0x30,0xB1,0x77,0x36,0x17,0xC0,0x05,0x0A,0x05,0xD8,0x1E,0x3C,0x15,0xCA,0x25,0xC7,0x09,0xC0,0x06,0x09,0x06,0x09,0xC0,0x06,0x09,0x06,0x09,0xC1,0x06,0x09,
+0x06,0x09,0xA9,0x44,0x05,0x0A,0x05,0xD6,0x3C,0xBF,0x96,0xA0,0x8B,0x11,0x37,0x11,0x92,0x66,0x0C,0xA1,0xA8,0xB0,0xB8,0x11,0xC1,0xB4,0x86,0xC2,0x34,0x19,0x2D,0x11,
+0x33,0xA3,0x87,0x95,0x87,0x1D,0x08,0x0C,0x30,0x2A,0xA4,0x87,0x96,0x86,0x3C,0x92,0x8B,0x0A,0x05,0xD9,0x36,0x54,0x15,0xC9,0x25,0xC8,0x09,0xC0,0x06,0x09,0x06,0x09,
+0xC0,0xA2,0x88,0x09,0xC0,0x06,0x09,0x06,0x09,0xC0,0x1D,0xA5,0x77,0x9C,0x55,0x05,0xD8,0x3C,0x34,0x0B,0xC0,0x9D,0x98,0x9D,0x9A,0x52,0x19,0x0C,0xA6,0x86,0x0B,0xC5,
+0x34,0x2B,0x0B,0x34,0x9B,0x8A,0x9B,0xA9,0x11,0xC0,0x21,0xA9,0x89,0xA9,0x87,0xC2,0xFE,0x6B,0x89,0x05,0x0A,0x05,0xD9,0xB3,0x84,0xA5,0x88,0x15,0xC7,0xA4,0x87,0x25,
+0xC9,0x09,0xC1,0x06,0x09,0x06,0x09,0xC0,0x1D,0x09,0xC0,0x06,0x09,0x06,0x09,0xC0,0xAB,0x54,0x1F,0x05,0xD8,0x3C,0x34,0x0B,0xC5,0x0E,0x59,0x0B,0x0E,0x0B,0xC1,0x0E,
+0x34,0x3A,0x0B,0xC2,0x0E,0x04,0x0B,0x0E,0x0B,0xC2,0x84,0x98,0x81,0x8C,0x05,0xDA,0x13,0xA8,0x74,0x15,0xC6,0xA4,0x88,0x25,0xCA,0x99,0xC9,0x06,0xC3,0x09,0xC1,0x06,
+0x09,0x06,0x09,0xC0,0x1D,0x09,0x0D,0x05,0x0A,0x05,0xD7,0xB0,0x74,0x34,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0xC1,0x0E,0x59,0x0B,0x96,0x86,0x2B,0x0B,0x12,0x3A,0x0B,
+0xC1,0x0E,0x04,0x0B,0x0E,0x0B,0x2B,0xFE,0x52,0xC6,0x96,0x8A,0x05,0xDA,0x13,0xA8,0x74,0x15,0xC4,0x02,0x25,0xCC,0x2D,0xC4,0xA3,0x88,0xC3,0x09,0xC0,0x06,0xC0,0x00,
+0x9C,0x55,0x05,0xD9,0xB0,0x74,0x34,0x0B,0xC4,0x61,0x0B,0xC1,0x0E,0x59,0x0B,0x0E,0x0B,0x2B,0x34,0x0B,0xC3,0x0E,0xC1,0x0B,0x0E,0x0B,0x93,0x89,0x3F,0x22,0x05,0xDA,
+0x06,0xA8,0x95,0x15,0xC1,0x26,0x3D,0xA3,0x68,0x25,0xCD,0x2D,0xCD,0x0D,0x92,0x79,0x97,0x9C,0xD9,0x06,0x34,0xA8,0x89,0xC3,0x0E,0xC0,0x0B,0xC4,0x3A,0x0B,0x3A,0x94,
+0x76,0xAE,0x89,0x0B,0xC0,0x0E,0x0B,0xC2,0x0E,0x04,0x0B,0xFE,0x6B,0xAB,0x85,0xAC,0x29,0x8D,0x9C,0xDA,0x06,0xA8,0x95,0x02,0xC0,0x25,0xD1,0x2D,0xCD,0x0D,0x17,0xC0,
+0x05,0x0A,0x05,0xD6,0x13,0x0C,0x0E,0xC0,0x0B,0x0E,0x0B,0xC2,0x0E,0x59,0x0B,0x0E,0x0B,0xC2,0x19,0x2B,0x0B,0xC1,0x0E,0x04,0x0B,0x0E,0x0B,0xC0,0x95,0x8B,0xFE,0x18,
+0xE2,0x05,0x13,0x17,0x05,0xD9,0x06,0x24,0x25,0xD3,0x99,0xC9,0xCC,0xA7,0x76,0x22,0x05,0xDA,0x36,0xFE,0xE7,0x38,0x0B,0x0E,0x0B,0xC2,0x0E,0x04,0x0B,0x0E,0x0B,0xC4,
+0x2B,0x99,0x87,0x0B,0xC0,0x61,0x0B,0xC1,0x0E,0x04,0x0B,0x30,0x05,0xC0,0x13,0x3F,0x05,0xD9,0x29,0xA5,0x95,0x25,0xD3,0x2D,0xCC,0x0D,0x92,0x79,0x97,0x9C,0xDA,0x0F,
+0x2B,0x0B,0x12,0x3A,0x0B,0xC2,0x0E,0x59,0x0B,0x0E,0x0B,0xC2,0x3A,0x31,0x2B,0x0B,0x12,0x3A,0x0B,0xC3,0x0C,0x26,0x05,0xC0,0x20,0xC0,0x05,0xD9,0x36,0x22,0x25,0xD3,
+0x2D,0xCC,0x1E,0x17,0x05,0xDA,0xBB,0x83,0xFE,0xEF,0x98,0x0B,0x12,0x3A,0x0B,0xC7,0x3A,0x0B,0x3A,0x31,0x04,0x0B,0xC4,0x3A,0x0B,0xC0,0x30,0x05,0xC1,0xA6,0x87,0x3C,
+0x05,0xD9,0xBB,0x83,0x06,0x26,0x69,0x26,0x02,0x25,0xCF,0x2D,0xCB,0x1D,0x22,0x05,0xDB,0xBD,0x73,0xBB,0xAA,0x0B,0xC4,0x61,0x0B,0xC3,0x0E,0x04,0x9D,0x99,0x0B,0x12,
+0x3A,0x0B,0xC5,0x93,0x89,0x3F,0x05,0xC1,0xA6,0x87,0xA8,0x86,0x05,0xD8,0x3F,0xB4,0x84,0x18,0x61,0xA3,0x78,0x27,0x07,0xC0,0x26,0xC0,0x3D,0x26,0x07,0x02,0x25,0xC8,
+0x2D,0xCB,0x0D,0x94,0x78,0x05,0xDB,0xFE,0x7C,0x2B,0xBB,0x98,0xA3,0x89,0xC4,0x61,0x0B,0xC4,0x0E,0x04,0x2B,0x0B,0xC6,0x2B,0x29,0x05,0xC2,0xA6,0x87,0x3C,0x05,0xD8,
+0x13,0x0F,0x18,0x1D,0xC3,0x1A,0x1D,0xC2,0x3D,0x26,0xC3,0x69,0x26,0xC1,0x1F,0x2D,0xCB,0x0D,0x8D,0x8B,0x05,0xDB,0x1E,0x0C,0x0B,0x6B,0x0B,0xC1,0x0E,0x04,0x0B,0x0E,
+0x0B,0xC1,0x19,0x21,0x25,0x9C,0x87,0xBA,0x87,0x0B,0xC2,0x0E,0x04,0x0B,0x33,0x05,0x0A,0x05,0xC1,0xA5,0x87,0x3C,0x05,0xD8,0x1E,0x22,0x1D,0xC8,0x18,0x1D,0xC9,0x2D,
+0xCA,0x13,0x22,0x05,0xDB,0x2B,0xB2,0x75,0x16,0xFE,0xEF,0xBB,0x0B,0xC1,0x04,0x0B,0xC4,0x21,0x36,0x94,0x89,0xC1,0x3A,0xFE,0xC6,0x97,0x12,0x0B,0xC2,0x93,0x89,0x3A,
+0x05,0xC3,0x3A,0x3C,0x05,0xD7,0x3C,0x24,0x94,0x8D,0x10,0x18,0x61,0x1D,0x27,0x1D,0xC7,0x18,0x1D,0xC5,0x98,0xEA,0xCA,0xAC,0x43,0x20,0x05,0xDB,0x3A,0xB1,0x75,0x8D,
+0x8B,0x11,0xB4,0x86,0x0E,0x0B,0xC1,0x0E,0x04,0x0B,0x9D,0x98,0x87,0x99,0x17,0xC0,0x05,0xA5,0x88,0x3A,0xC0,0x30,0x12,0x0B,0xC1,0x93,0x89,0x3F,0x05,0xC4,0x32,0x3C,
+0x05,0xD7,0xB5,0x84,0x54,0x3D,0x10,0x1D,0xC6,0x1A,0x1D,0xC9,0x18,0x2D,0xCA,0x36,0x17,0xC0,0x05,0x0A,0x05,0xD8,0xA9,0x97,0x07,0x28,0x3F,0x37,0x12,0x69,0xC3,0x2B,
+0x81,0x9D,0x05,0xAA,0x77,0xB2,0x86,0x11,0x0C,0xA2,0x87,0x9D,0x89,0x37,0x12,0x0B,0xC0,0x95,0x8B,0x18,0x90,0xA9,0xC5,0x3A,0x3C,0x05,0xD6,0x29,0xA5,0x87,0x94,0x9C,
+0x6B,0x26,0xC3,0xA4,0x87,0xC0,0x1D,0xCB,0x18,0x1D,0x98,0xEA,0xC9,0xA7,0x76,0x22,0x05,0xDC,0x3C,0x06,0x9B,0x58,0x17,0x26,0xFE,0xBE,0x54,0x04,0x0E,0xC0,0x5A,0x0E,
+0x30,0x8F,0x8A,0x33,0x0C,0x0B,0x12,0x0B,0xC2,0x0E,0x04,0x93,0x8A,0x36,0x05,0xC6,0x3A,0x3C,0x05,0xD5,0x3C,0x24,0x0F,0x3D,0x10,0x02,0x3D,0xC3,0x26,0x1F,0x26,0xC1,
+0x07,0xC0,0xA3,0x78,0xC3,0x18,0x1D,0xC1,0x2D,0xC9,0xA7,0x76,0x9B,0x68,0x05,0xDC,0x13,0x9A,0x59,0xA5,0x55,0x05,0xC0,0x15,0x21,0x12,0x69,0xC0,0x93,0x89,0x91,0xA8,
+0x19,0xA6,0x77,0x0E,0x0B,0xC0,0x93,0x89,0x0C,0x0E,0xC0,0x5A,0x11,0x3A,0x05,0xC7,0xA9,0x97,0x3F,0x05,0xD4,0x3A,0xB5,0x83,0x22,0x26,0x3D,0xCC,0x26,0x1F,0x26,0x02,
+0x07,0xC0,0xA3,0x78,0xC2,0x98,0xE9,0x2D,0xC8,0xAF,0x43,0x17,0x05,0xDC,0x29,0x32,0xAA,0x33,0x05,0xC1,0x3A,0x11,0x0B,0x0E,0x2A,0x0B,0xC1,0x93,0x89,0x21,0x11,0x34,
+0xA8,0x89,0xC0,0x2A,0x30,0x05,0xC9,0x16,0x3A,0x05,0xD4,0x22,0xA2,0x88,0x3D,0x10,0x02,0x3D,0xD0,0x41,0x1F,0x26,0xC1,0x9F,0xD8,0x2D,0xC7,0x13,0x36,0x05,0xDC,0x3A,
+0x22,0x05,0x24,0x05,0xC3,0x30,0x2A,0x0B,0xC7,0x93,0x89,0x25,0x05,0x0A,0x05,0xC8,0xAC,0x87,0x05,0xD4,0xB5,0x84,0x54,0x3D,0xCB,0x10,0x02,0x3D,0xCA,0x26,0x2D,0xC7,
+0x36,0x9B,0xA9,0x05,0xDC,0xA9,0x85,0x22,0x8D,0x9D,0x24,0x93,0xDD,0x05,0xC3,0xB7,0x67,0xBC,0x97,0x12,0x69,0xC3,0x98,0x9A,0x30,0x32,0x05,0xCB,0xAC,0x87,0x05,0xD3,
+0x3C,0xAA,0x76,0x18,0x3D,0xD9,0x26,0x6B,0xC1,0x26,0x2D,0xC1,0x26,0x2D,0x0D,0x92,0x79,0x97,0x9C,0xDC,0x3C,0xC0,0x05,0xAB,0x55,0x28,0x9D,0xAA,0x05,0xC3,0x1F,0xBB,
+0x94,0xB3,0x9A,0x0B,0x0E,0x0C,0x33,0x16,0x05,0xCD,0x16,0x05,0xD2,0xA9,0x85,0xAF,0x87,0x98,0x89,0x9A,0x8C,0x3D,0xD9,0x9D,0xC8,0x2D,0xC1,0x26,0x2D,0x26,0x2D,0xC1,
+0x0F,0x17,0x9D,0x9A,0xDC,0x13,0x94,0x79,0x05,0x10,0xB3,0x42,0x9F,0x65,0x9C,0xAA,0x9F,0xAC,0x55,0x13,0xA4,0x63,0xA8,0x75,0xA2,0x9B,0x9A,0x9B,0xFE,0x8C,0xAC,0x30,
+0x16,0x05,0xE3,0x14,0xB2,0x74,0x22,0x97,0x8D,0x3D,0xCF,0xA3,0x68,0x02,0x3D,0xC7,0x2D,0xC7,0xA7,0x76,0x22,0x05,0xDD,0xAF,0x84,0x05,0xC0,0xAB,0x55,0x36,0xA7,0x74,
+0xC7,0x9D,0x9B,0x28,0x8A,0xEF,0x05,0xC1,0x6B,0x05,0xDF,0xB0,0x95,0x22,0x99,0x9C,0x3D,0xDB,0x2D,0xC6,0xA3,0x88,0x1E,0x3C,0x05,0x6E,0x05,0xDA,0xA6,0x87,0x3C,0x05,
+0xC0,0x10,0xFE,0x65,0xA7,0x18,0xC8,0x97,0x9A,0xFE,0x09,0x21,0x05,0x0C,0x05,0x0C,0x05,0x0C,0x05,0xDC,0xAB,0x86,0xAC,0x76,0x95,0xAC,0x3D,0xDC,0x2D,0xC2,0x06,0x13,
+0xC0,0x22,0x1D,0xAB,0x64,0x1F,0x05,0xDC,0x3C,0x9B,0x88,0x97,0x9C,0xC0,0xAB,0x44,0xBF,0x51,0x18,0xC4,0x9D,0x9A,0xFE,0x43,0xE6,0xA8,0x76,0xAD,0x51,0x06,0xFE,0x1A,
+0xC1,0xFE,0x00,0x40,0x05,0xC1,0x37,0x10,0x77,0xA5,0x55,0x37,0x05,0x0C,0x0A,0x05,0x0A,0x05,0xD4,0x07,0x36,0x6B,0xA3,0x68,0x02,0x3D,0xDA,0xA4,0xA6,0x22,0x13,0x22,
+0x1D,0x13,0x22,0x1D,0x13,0xA8,0x74,0x05,0x0A,0x05,0xD5,0x37,0x2E,0x19,0xA7,0x87,0x9F,0x65,0x92,0xCE,0xA0,0xBB,0x24,0x9C,0xAA,0x32,0x3A,0xFE,0x6D,0x69,0x18,0xC4,
+0x0D,0xFE,0x5B,0xA9,0xA0,0xA9,0xFE,0x76,0x09,0x18,0x8F,0xAD,0xFE,0x00,0xA0,0xA7,0x66,0xAC,0x54,0x12,0xA8,0x75,0x9E,0x9B,0x06,0x32,0x24,0x38,0x95,0xAA,0x0F,0x05,
+0xC1,0x0C,0x05,0xD1,0x22,0x9D,0xAA,0x3C,0x9E,0x8B,0xDD,0x1D,0x22,0x13,0xC0,0x22,0x1D,0x13,0xC0,0x04,0x97,0x8B,0x05,0xD5,0x24,0xAF,0x64,0x0A,0xA6,0x88,0xA2,0x88,
+0x18,0xC0,0x29,0x19,0x0F,0x17,0xA3,0x99,0x15,0xFE,0x54,0xE7,0x1F,0x06,0x18,0xC3,0xFE,0x4C,0x07,0x9D,0xEE,0xFE,0x6D,0x69,0x18,0x0A,0x13,0xAE,0x63,0x18,0xC2,0x8F,
+0xAD,0x19,0x9D,0xAA,0x03,0x2E,0x0F,0x62,0xC1,0x0C,0x05,0xD0,0x3A,0xAF,0x85,0x97,0x9D,0xDA,0x9D,0xA8,0xA0,0xA8,0xA0,0xA6,0x9E,0xB8,0xA0,0xA7,0x1D,0x22,0x9D,0xAA,
+0xC2,0x22,0x1D,0xAB,0x64,0x89,0x9D,0x05,0xD4,0xAF,0x33,0xB7,0x52,0xAD,0x62,0x18,0xC3,0x0D,0xFE,0x1A,0xC1,0x0A,0x05,0xC0,0x37,0xAF,0x43,0xFE,0x55,0x63,0x06,0x18,
+0xC3,0x92,0x9E,0xFE,0x6B,0xAA,0xAE,0x10,0x18,0x0D,0x9C,0x88,0x18,0xC3,0x0D,0xFE,0x1A,0xC1,0x05,0xC0,0x15,0x37,0x05,0x0C,0x6D,0x05,0xD1,0xB0,0x88,0x9C,0x87,0x6B,
+0xD2,0x36,0x3D,0x26,0x1E,0x9E,0xC8,0x79,0xC0,0xA2,0xA7,0xA1,0xA9,0xC1,0x7A,0xC0,0x1D,0x22,0x13,0xC3,0x22,0xA8,0x84,0xFE,0x08,0x20,0x05,0xD4,0x2C,0x1F,0x06,0x18,
+0xC4,0x97,0x9A,0xFE,0x09,0x21,0x99,0xBB,0x05,0x0A,0x10,0x0E,0xA4,0x77,0x18,0xC3,0x0D,0x92,0x9A,0xAA,0x88,0x18,0xC0,0x0E,0x06,0x1A,0x18,0xC2,0x39,0xFE,0x00,0xA0,
+0x0F,0x17,0x10,0x0F,0x05,0xC1,0x0C,0x05,0xCE,0x3F,0xAD,0x79,0x9C,0x88,0x9A,0x99,0x3D,0xCB,0x2D,0x1E,0xC0,0x9E,0xB8,0x7A,0x79,0x25,0xA1,0xA9,0xC1,0x3A,0x61,0xC6,
+0x1D,0x22,0x9D,0xAA,0xC3,0x04,0x40,0x05,0x0A,0x05,0xD2,0xAA,0x64,0x36,0xA7,0x74,0xC7,0x8F,0xAD,0x19,0x0A,0x05,0xC0,0xBF,0x20,0x1F,0x99,0x9A,0x18,0xC0,0x06,0x18,
+0xC4,0x99,0x9C,0x39,0x18,0x06,0x18,0xC1,0x0D,0xFE,0x02,0x00,0x0F,0x05,0xA6,0x87,0xA5,0x56,0x0F,0x05,0xD1,0x22,0x9C,0x8B,0x4B,0x3D,0xC6,0x20,0x1E,0x9E,0xB8,0x16,
+0xA3,0xA8,0xC1,0x9F,0xE7,0xA2,0x88,0x29,0xC1,0x31,0x05,0x31,0x05,0x31,0x29,0xC1,0x31,0x29,0xC2,0x1D,0x22,0x9D,0xAA,0xC3,0xAB,0x75,0x94,0x88,0x0A,0x66,0xD3,0xAF,
+0x54,0x0D,0x18,0xC6,0x06,0x18,0xFE,0x22,0x84,0x0A,0x05,0x0A,0xB3,0x53,0x1A,0x18,0x97,0x9A,0x06,0x18,0xC0,0x6F,0x18,0xC2,0x99,0x9C,0xFE,0x0A,0x00,0x36,0x18,0xC3,
+0x8A,0x9E,0x19,0x9D,0xAA,0x05,0x15,0x19,0x62,0x7E,0x05,0xCF,0x22,0x3C,0x53,0x3D,0x9D,0xC8,0x20,0x26,0x9E,0xB6,0x16,0x35,0xC0,0x9F,0xE7,0x37,0xC0,0x7A,0xA1,0xA8,
+0x9D,0x89,0xA2,0x88,0x05,0xC0,0x3D,0x05,0x29,0xC2,0x05,0xC1,0x29,0x3D,0x29,0xC2,0x05,0x1D,0x22,0x9D,0xAA,0xC3,0xAB,0x75,0x8C,0x8B,0x17,0x9D,0x9A,0xD3,0xAF,0x54,
+0xFE,0x6E,0x27,0x18,0x06,0x18,0xC1,0x06,0x18,0xC2,0x0E,0xFE,0x01,0x00,0x19,0x05,0xAB,0x55,0xFE,0x65,0xA7,0x18,0x0D,0x97,0x89,0x06,0x1A,0x18,0xC0,0x6F,0x18,0x24,
+0x92,0xBF,0x19,0xB4,0x43,0x0D,0x18,0xC2,0x97,0x9A,0xFE,0x09,0x21,0x99,0xBB,0x05,0xA6,0x87,0x10,0x0A,0x05,0xCF,0xA9,0x97,0xA5,0xDA,0x99,0xD6,0xA3,0xA8,0x74,0xC0,
+0xA1,0xA9,0xC0,0x79,0x29,0xC2,0xA3,0x98,0xC0,0x3D,0x05,0x3D,0x05,0x51,0x05,0x31,0x29,0x05,0x29,0x3D,0x29,0x05,0x3D,0x05,0x31,0x29,0xC0,0x05,0xC2,0x1D,0x22,0x13,
+0xC3,0xAB,0x75,0x17,0xC0,0x9D,0x9A,0x0A,0x05,0xD1,0xAF,0x54,0x0D,0x18,0xC8,0x06,0xFE,0x22,0xC2,0x0A,0x05,0xC0,0x1C,0x1F,0x18,0xC0,0x0E,0x06,0x18,0x06,0x18,0xC1,
+0xFE,0x23,0x41,0x0A,0x03,0xB8,0x30,0x1F,0x18,0xC2,0xFE,0x02,0x00,0x0F,0x05,0xC0,0xAB,0x55,0x28,0x0A,0x05,0x0A,0x05,0xCC,0xA9,0x97,0xAB,0xE4,0x37,0xC0,0x7A,0xA1,
+0xA8,0x29,0xC1,0x7E,0x29,0x31,0x05,0x31,0xA3,0x88,0x05,0x3D,0x05,0xC0,0x3D,0x05,0x31,0x05,0x3D,0x05,0x31,0x05,0x0A,0x05,0x0A,0x05,0x0A,0x05,0xC2,0x0A,0x1D,0x22,
+0x13,0xC2,0xA5,0x77,0xA2,0x78,0x89,0xAD,0x6E,0x05,0xD3,0xAF,0x53,0x0D,0x18,0xC9,0x0E,0x28,0x05,0xC0,0x2C,0x1F,0x06,0x18,0xC0,0x99,0x9B,0x50,0x06,0x18,0xC0,0x99,
+0x9C,0xFE,0x09,0x81,0x17,0x05,0x10,0x12,0x1F,0x18,0xC0,0x9D,0x9A,0x08,0xFE,0x00,0x40,0x05,0x0A,0xA4,0x87,0x10,0x0F,0x05,0xCE,0x16,0xA9,0xE5,0x37,0xC0,0x3A,0x29,
+0xC3,0xA3,0x98,0xC4,0x6E,0x05,0x3D,0x05,0x31,0x29,0x3D,0x05,0x29,0x05,0x3D,0x05,0xC1,0x3D,0x29,0xC0,0x05,0xC0,0x3D,0x05,0x13,0x22,0x1D,0x13,0xC1,0xA9,0x77,0x3C,
+0x92,0x8B,0xD5,0xAF,0x33,0xFE,0x65,0xA7,0x18,0xC3,0x06,0x18,0xC3,0x6F,0xFE,0x23,0x03,0x0F,0x05,0xB4,0x42,0x1A,0x18,0xC3,0x39,0x2C,0x18,0x8A,0x9E,0xFE,0x00,0xA0,
+0x9D,0xAA,0x05,0xC0,0xAF,0x33,0xFE,0x55,0x63,0x06,0x18,0xC0,0x15,0xFE,0x00,0x40,0x05,0xC1,0x10,0x9C,0x88,0x0A,0x05,0xCE,0xB7,0x94,0x37,0xC0,0x3A,0x61,0xC2,0xA3,
+0x98,0xC1,0x3D,0x05,0x31,0x05,0x6E,0x05,0x29,0x3D,0x29,0xC2,0x31,0x29,0x31,0x3D,0x05,0xC0,0x3D,0x05,0x31,0x05,0x0A,0x05,0x0A,0x1D,0x13,0x22,0x1D,0x13,0xC0,0xAB,
+0x75,0x89,0x9D,0x9C,0x8A,0xD5,0xAF,0x33,0xBB,0x62,0x18,0xCA,0x0E,0x19,0x0F,0x2A,0xFE,0x6E,0x27,0x18,0xC4,0x97,0x9A,0x98,0x8A,0xFE,0x01,0x60,0x05,0xC3,0xAF,0x66,
+0x3D,0x18,0xC0,0x15,0xFE,0x00,0x40,0x05,0xC2,0x2E,0x0F,0x0A,0x05,0x0A,0x05,0xCB,0x22,0xA2,0xF7,0xFE,0xA9,0x61,0x7E,0x29,0x05,0x29,0xC0,0x05,0xC2,0x3D,0x05,0xC2,
+0x3D,0x05,0x31,0x29,0x3D,0x29,0xC2,0x05,0xC2,0x3D,0x05,0x31,0x05,0x6E,0x05,0x1D,0x22,0x13,0xC2,0xAB,0x75,0x1F,0x9C,0x8A,0xD5,0xA8,0x55,0x12,0xAD,0x62,0x18,0xC1,
+0x06,0x18,0xC4,0x06,0x18,0xFE,0x09,0x81,0x98,0xCB,0xA7,0x8A,0x0D,0x18,0xC6,0x8F,0xAD,0xFE,0x02,0x00,0x0F,0x05,0xC2,0xB4,0x42,0x36,0x18,0xFE,0x3B,0xE5,0xFE,0x00,
+0x40,0x05,0xC1,0x6B,0xAA,0x65,0x03,0x05,0xCE,0xA6,0x87,0xB4,0x93,0xFE,0x99,0x61,0xC0,0x7A,0x29,0xC4,0xA3,0x98,0xC2,0x6E,0x05,0xC0,0x3D,0x05,0x31,0x29,0x3D,0x29,
+0x05,0x3D,0x05,0x31,0x05,0x0A,0x05,0x3D,0x05,0xC0,0x0A,0x05,0x1D,0xA3,0x66,0x9D,0xAA,0xC1,0xA7,0x87,0x9F,0x75,0xFE,0x00,0x20,0xD6,0x2B,0xBA,0x21,0x1F,0x18,0xC0,
+0x9D,0x9A,0x18,0xC5,0x06,0x18,0xFE,0x22,0x84,0x8E,0xDD,0xAE,0x33,0xFE,0x76,0x09,0x18,0xC0,0x06,0x18,0xC4,0x99,0x9C,0x92,0xAB,0xFE,0x09,0x21,0x05,0x6B,0x0A,0x05,
+0xB3,0x33,0xB7,0x62,0x3B,0x0F,0x05,0xC1,0x6B,0x05,0xAF,0x54,0x0F,0x05,0xC1,0x0C,0x05,0xCA,0xB3,0x85,0x35,0xFE,0x99,0x61,0xA1,0xB8,0x56,0x05,0x51,0x56,0x3D,0x29,
+0xC3,0x05,0xC2,0x29,0xC1,0x31,0x29,0x31,0x05,0x3D,0x05,0xC2,0x31,0x05,0x31,0xA3,0x88,0x05,0x1D,0x13,0x22,0x1D,0x13,0x1E,0x3C,0x92,0x8B,0xD7,0x32,0xFE,0x6E,0x27,
+0x18,0x06,0x18,0xC6,0x6F,0x18,0x12,0xFE,0x00,0xA0,0xA7,0x77,0xFE,0x76,0x09,0x18,0xC1,0x06,0x18,0xC5,0xFE,0x54,0xE7,0x8D,0xCF,0x8E,0xDD,0x05,0xC1,0x0C,0x17,0x0F,
+0x05,0xC3,0xAA,0x77,0x03,0x05,0xCE,0xA7,0x85,0xB2,0xA4,0x37,0xA1,0xB8,0x3D,0x05,0xC1,0x29,0xC0,0x05,0xC0,0x29,0x05,0x3D,0x05,0x51,0x29,0x3D,0x29,0xC2,0x05,0xC2,
+0x6E,0x05,0x0A,0x05,0xC0,0x3D,0x29,0x31,0x1D,0x22,0x13,0xC1,0xA7,0x87,0x92,0x79,0x97,0x9C,0xD7,0x17,0x1A,0x18,0xC0,0x06,0x18,0xC7,0x0E,0xFE,0x00,0xA0,0x2A,0xFE,
+0x6E,0x27,0x18,0xC0,0x06,0x18,0xC7,0x0D,0x92,0x9A,0xFE,0x02,0x00,0x93,0xFF,0x05,0xC0,0xAB,0x55,0x28,0x9A,0xBB,0x05,0xC0,0x0A,0x05,0x2B,0x15,0x19,0x05,0xCE,0x13,
+0xFE,0x8A,0x21,0x31,0xA2,0x88,0x31,0x29,0x05,0x29,0x05,0x3D,0x9D,0x99,0x29,0x05,0x3D,0xA2,0x87,0x05,0x31,0x05,0x31,0x29,0xC0,0x05,0x3D,0x0A,0x05,0x3D,0x05,0xC3,
+0x3D,0x29,0x31,0x13,0x22,0x1D,0x13,0xC0,0xAB,0x75,0x89,0x9D,0x9C,0x8A,0xD7,0x3F,0x36,0x18,0xC4,0x06,0x18,0xC3,0x2C,0xFE,0x09,0x81,0x2A,0x0D,0x18,0xC1,0x9D,0x9A,
+0x18,0xC7,0x0D,0x25,0x8D,0xBE,0x28,0x19,0x05,0x2A,0x99,0x9B,0x05,0x6B,0x6D,0x05,0xC0,0xAA,0x78,0x9B,0x98,0x05,0xCE,0x37,0xAB,0xEA,0xFE,0x99,0x61,0xA1,0xB8,0xC0,
+0x29,0x3D,0x29,0xC2,0x05,0xC2,0x6E,0x31,0x29,0xC2,0x05,0xC3,0x3D,0x05,0xC3,0x31,0x05,0x1D,0x22,0x13,0xC1,0xA7,0x87,0x89,0x9D,0x5A,0xD7,0x32,0xFE,0x54,0xE7,0xAD,
+0x62,0x18,0xC2,0x06,0x18,0xC5,0x3E,0x9E,0xAC,0xFE,0x76,0x09,0x18,0xC2,0x06,0x18,0xC8,0x06,0x92,0x9B,0xFE,0x01,0x60,0x05,0xA3,0x87,0x38,0x95,0xAA,0x05,0xC2,0x03,
+0xA3,0x87,0x19,0x05,0x6E,0x05,0x0A,0x05,0xCA,0xAB,0x86,0x35,0xFE,0x99,0x61,0xA1,0xB8,0x31,0x29,0xC3,0x05,0xC4,0x29,0x3D,0x29,0x05,0x6E,0x05,0x0A,0x05,0xC0,0x0A,
+0x05,0x0A,0x05,0xC0,0x0A,0x29,0x05,0x1D,0x22,0x13,0xC0,0xA5,0x77,0x07,0x89,0xAD,0xD9,0xFE,0x43,0xE6,0x1F,0x06,0x18,0xC1,0x06,0x18,0xC5,0x8A,0x9E,0xFE,0x32,0xA4,
+0x1A,0x18,0xC1,0x06,0x18,0xC9,0x6F,0x18,0x12,0x19,0x62,0x7E,0xAC,0x55,0x28,0x19,0x05,0x6E,0x03,0x31,0x0C,0x9C,0x76,0x9C,0xAB,0x17,0x05,0xCC,0x0D,0x37,0x9F,0xB8,
+0x56,0xC4,0xA3,0x98,0xC4,0x29,0xC0,0x05,0xC2,0x6E,0x31,0x05,0x3D,0x05,0xC3,0x31,0x29,0xFE,0x52,0x26,0x22,0x9D,0xAA,0xC0,0x36,0x22,0x8D,0x9D,0xD9,0x0C,0xFE,0x76,
+0x09,0x18,0x9D,0x9A,0x18,0xC8,0x12,0x9C,0xAD,0x1A,0x18,0xC0,0x06,0x18,0xCA,0x24,0x18,0x97,0x9A,0xFE,0x09,0x21,0x99,0xBB,0x05,0x37,0xAF,0x43,0x94,0xBC,0xC0,0xA4,
+0x98,0x49,0x37,0x05,0x28,0x31,0x24,0x0F,0x05,0xC1,0x6B,0x05,0xC7,0xB0,0x95,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0xC0,0xA2,0x88,0x31,0x29,0xC2,0x05,0xC2,0x6E,0x31,0x05,
+0x29,0xC0,0x05,0xC2,0x0A,0x31,0x05,0x0A,0x05,0x0A,0x05,0x29,0x05,0x1D,0x13,0x22,0x1D,0xAB,0x64,0x94,0x8A,0x91,0x9D,0xD9,0xAA,0x64,0xFE,0x6D,0x69,0x18,0xC2,0x9D,
+0x9A,0x18,0xC5,0x97,0x9A,0x39,0x18,0xC0,0x06,0x18,0xCB,0x6F,0x18,0x0A,0xFE,0x00,0xA0,0x62,0x17,0x05,0xAF,0x54,0x9C,0x78,0x17,0x37,0x10,0xC0,0x06,0xC0,0x37,0x10,
+0xC0,0x0F,0x05,0xC1,0x0C,0x05,0xC6,0x13,0x35,0xFE,0x99,0x61,0xA1,0xB8,0x51,0xC0,0x05,0x31,0x29,0xC1,0xA4,0x87,0x05,0x0A,0x05,0xC0,0x0A,0x29,0x31,0x05,0x31,0x29,
+0x05,0x0A,0x05,0x0A,0x05,0xC0,0x0A,0x29,0x31,0x29,0x1D,0x13,0x22,0x1D,0xAB,0x64,0x90,0x8A,0x95,0x9D,0xD9,0x2B,0xFE,0x3C,0x62,0x18,0x9D,0x9A,0x18,0xC8,0x2C,0x39,
+0x18,0x06,0x18,0xCC,0x6F,0x18,0x12,0x19,0x05,0xC0,0xA8,0x55,0x10,0x0F,0x05,0xC0,0x0F,0x05,0xC1,0xAB,0x44,0xC0,0x37,0x03,0x05,0xCA,0x3A,0x04,0xFE,0xA9,0x61,0x7E,
+0x3D,0x05,0xC1,0x29,0x3D,0x05,0xC0,0x0A,0xC0,0x05,0x0A,0x05,0xC0,0x0A,0x29,0x31,0x29,0x3D,0x05,0xC0,0x0A,0xC0,0x3D,0x05,0x29,0x05,0x29,0x13,0x22,0x1D,0x13,0x1E,
+0x8B,0x9B,0x9C,0x8A,0xDA,0xB8,0x10,0x1A,0x18,0xC1,0x9D,0x9A,0x18,0xC6,0x0E,0x06,0x18,0xC0,0x06,0x18,0xCC,0xFE,0x23,0x03,0x0F,0x05,0xC0,0xAF,0x33,0x0F,0x05,0xC0,
+0x32,0x7E,0xC0,0x37,0x10,0x37,0x10,0x37,0x3F,0x05,0xCA,0x22,0x04,0x3D,0x7E,0xC0,0x29,0x3D,0x29,0xC1,0x31,0x05,0x31,0x0A,0x05,0xC0,0x3D,0x05,0x31,0x05,0x0A,0x05,
+0x3D,0xC0,0x05,0x29,0x05,0x29,0xC2,0x31,0x13,0x22,0x1D,0x13,0xA8,0x74,0x17,0xC0,0x9D,0x9A,0x6E,0x05,0xD7,0x2A,0xFE,0x6E,0x27,0x18,0xC2,0x06,0x18,0xC5,0x92,0x9B,
+0xAE,0x76,0x06,0x18,0xC2,0x06,0x18,0xC8,0x2C,0xFE,0x01,0x60,0x05,0x17,0x15,0x9A,0x88,0x05,0x0A,0x05,0xC4,0x19,0x2E,0x9C,0x88,0x32,0x0A,0x05,0x0A,0x05,0xC7,0xB7,
+0x94,0xFE,0x99,0x61,0x31,0xA3,0x88,0x66,0x0A,0x05,0x29,0xC0,0x05,0x3D,0x0A,0x05,0x3D,0x05,0x29,0x05,0x29,0xC3,0x31,0x29,0x31,0x3D,0x9D,0x99,0x29,0x31,0x29,0xC1,
+0x13,0x22,0x1D,0x13,0x1E,0x8B,0x9B,0x9C,0x8A,0xDA,0x2B,0xFE,0x54,0xE7,0xAD,0x62,0x18,0xC3,0x9D,0x9A,0x18,0xC3,0x92,0x9B,0x1F,0x18,0xC9,0x06,0x18,0xC2,0x3B,0x0F,
+0x05,0x03,0x15,0x05,0xC3,0xA8,0x88,0xC1,0xA2,0x66,0x07,0x10,0xA4,0x54,0x9C,0xAB,0x96,0xCC,0x05,0xC1,0x0C,0x05,0x0A,0x05,0xC2,0x3F,0xB2,0xA2,0x37,0xA2,0xA7,0x66,
+0x0A,0x05,0x29,0xC4,0x05,0xC4,0x29,0xC3,0x05,0xC1,0x29,0xC2,0x05,0x46,0x1D,0x59,0x22,0xA5,0x88,0x9E,0x85,0xFE,0x00,0x20,0xDC,0x28,0x1A,0x18,0xC9,0x0E,0xA8,0x75,
+0x18,0xC1,0x06,0x18,0xC9,0x2C,0xFE,0x0A,0x00,0x93,0xEF,0xA5,0x66,0x2A,0x99,0x9B,0x99,0xBB,0x05,0x0A,0x05,0xC4,0x17,0x37,0xAF,0x43,0x94,0xBC,0x05,0xC9,0xB3,0x85,
+0x35,0xFE,0xB1,0x81,0x3D,0x05,0xC3,0x31,0x56,0x3D,0x05,0xC0,0x6E,0xC0,0x3D,0x0A,0x05,0x0A,0x05,0x29,0xC1,0x31,0x05,0x31,0x29,0xC1,0x0A,0x3A,0xC0,0xFE,0x4A,0x25,
+0x22,0x1D,0xAB,0x64,0x99,0x89,0x0F,0x62,0xDB,0xAF,0x33,0xBB,0x62,0x18,0xC3,0x9D,0x9A,0x18,0xC3,0x2C,0xC0,0x18,0xC0,0x06,0x18,0xC7,0x9D,0x9B,0xC0,0x25,0x3B,0x37,
+0x24,0xA4,0x88,0x9C,0xA9,0x24,0x37,0xC0,0x05,0x6B,0x6D,0x05,0x2B,0x32,0x03,0x15,0x05,0x37,0x10,0x37,0x05,0xC7,0xA6,0x87,0xB3,0xA2,0xFE,0x99,0x61,0xA2,0xA7,0x66,
+0xC2,0x0A,0x05,0xC0,0x51,0x05,0x31,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x05,0xC0,0x29,0xC1,0x31,0x29,0x31,0x6F,0x9D,0x99,0x29,0xC1,0x31,0x13,0xC0,0x22,0xA5,0x88,0x97,
+0x99,0x91,0x9D,0xDC,0x2B,0xBA,0x21,0x1F,0x18,0xC1,0x06,0x18,0xC5,0x39,0xA7,0x86,0xC3,0x9E,0x86,0xC1,0x9D,0x8A,0x61,0xC2,0x3B,0x96,0x8B,0x9B,0xAB,0x9C,0xCC,0x59,
+0x9D,0xAA,0x10,0x37,0x3F,0x15,0xA5,0x55,0xA0,0xA9,0x24,0xC0,0x10,0x37,0x2B,0x2E,0xC0,0x37,0x32,0x7E,0x9C,0x78,0x05,0xC1,0x0C,0x05,0xC2,0x36,0xA0,0xF7,0x3D,0x7E,
+0xC4,0x6E,0x05,0xC0,0x51,0x0A,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0x31,0x29,0xC2,0x05,0x46,0x29,0xC1,0x31,0x29,0x31,0x13,0x22,0x1D,0xAB,0x64,0x90,0x8A,0x95,0x9D,
+0xDD,0xB3,0x33,0xFE,0x76,0x09,0x18,0xC0,0x9D,0x9A,0x18,0xC6,0x8F,0xAD,0xAA,0x88,0x59,0xC0,0x0D,0x18,0x06,0x1A,0x18,0xC4,0x0D,0x3E,0xFE,0x00,0x40,0x05,0xC7,0x32,
+0x7E,0x38,0x32,0x05,0x10,0x15,0x03,0x15,0x3F,0x05,0xC6,0x02,0xAA,0xE4,0xFE,0xA1,0xC1,0x9E,0xB9,0xC2,0x6E,0x05,0xC0,0x31,0x0A,0xC0,0x05,0x0A,0x05,0xC0,0x0A,0xC0,
+0x05,0x3D,0x05,0x31,0x29,0x3D,0x29,0xC1,0x31,0x05,0x31,0x29,0xC1,0xA2,0x78,0x1D,0x13,0xC0,0x1E,0x8E,0x89,0x17,0x9D,0x9A,0xDC,0x2B,0xFE,0x54,0xE7,0x18,0x06,0x18,
+0xC7,0x35,0x06,0x18,0x06,0x18,0xC9,0x8F,0xAD,0xFE,0x00,0xA0,0x9D,0xAA,0x05,0xC0,0x0A,0x05,0xC6,0x03,0x15,0x05,0x2A,0x0F,0x05,0xC7,0x32,0xB2,0x94,0xFE,0x99,0x61,
+0x9F,0xB8,0xA3,0x88,0x66,0x3D,0x05,0x31,0x05,0x0A,0x05,0x0A,0xC0,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x3D,0x29,0x31,0x05,0x29,0x3D,0x29,0x05,0x0A,0x29,0xC1,
+0x31,0x29,0x13,0x22,0x1D,0x24,0x89,0x9D,0x9C,0x8A,0xDE,0xB8,0x21,0x1A,0x18,0xC2,0x06,0x18,0xC3,0x97,0x9A,0x06,0x18,0xC1,0x06,0x18,0xC7,0x35,0xFE,0x09,0x21,0x05,
+0x6B,0x6D,0x05,0xC1,0x0A,0x05,0xC6,0x03,0x19,0x0F,0x17,0x05,0xC5,0xB5,0x84,0x04,0x3A,0xC0,0x31,0xA2,0x88,0x31,0xA3,0x88,0x05,0xC0,0x0A,0xC0,0x05,0x0A,0x05,0xC0,
+0x0A,0xC0,0x05,0xC1,0x3D,0x05,0x31,0x05,0x0A,0x05,0x0A,0xC0,0x31,0x05,0x31,0x29,0xC1,0x3A,0x13,0x22,0x1D,0x24,0x1F,0x9C,0x8A,0xDE,0xAB,0x44,0xFE,0x65,0xA7,0x18,
+0xC5,0x9D,0x9A,0x18,0xC1,0x97,0x9A,0x06,0x18,0xC2,0x06,0x18,0xC5,0x9D,0x9B,0xFE,0x0A,0x00,0x05,0xCD,0x10,0x28,0x9A,0xBB,0x05,0xC5,0x02,0x1C,0xFE,0x99,0x61,0xC0,
+0x3A,0xA1,0xA8,0xC3,0x6E,0x05,0xC0,0x31,0x0A,0xC1,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0x05,0x0A,0x05,0x29,0xC1,0x31,0x3A,0xC0,0x31,0xFE,0x4A,0x25,0xC0,
+0x22,0xA8,0x84,0x17,0xC0,0x9D,0x9A,0x6E,0x05,0xDB,0xB5,0x20,0x39,0x18,0xC1,0x06,0x18,0xC5,0x92,0x9B,0xAF,0x76,0x18,0xC0,0x06,0x18,0xC7,0x0D,0x3E,0x0A,0x05,0xCC,
+0x2B,0x15,0x0A,0x05,0xC1,0x0C,0x05,0xC0,0xA6,0x87,0xB3,0xA2,0xFE,0x8A,0x21,0x31,0xC0,0x3D,0x7E,0xC0,0x6E,0xC0,0x3D,0x0A,0x3D,0x05,0xC0,0x0A,0xC0,0x3D,0x0A,0x3D,
+0x0A,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0x29,0xC1,0x31,0x29,0x31,0x3D,0x13,0xC0,0x22,0x16,0xFE,0x08,0x20,0x5A,0xDD,0x3A,0x36,0x9E,0x75,0x36,0x18,0x06,
+0x18,0xC5,0x2C,0x99,0x98,0x0A,0x06,0x18,0xC3,0x06,0x18,0xC4,0xFE,0x23,0x41,0xFE,0x00,0x40,0x05,0xCD,0xAC,0x87,0x0A,0x05,0xC1,0x0C,0x05,0x2B,0x1E,0x0F,0x31,0xC0,
+0x3D,0x31,0xA2,0x88,0x31,0xA3,0x88,0x05,0x31,0x05,0x31,0x0A,0x05,0xC0,0x0A,0xC1,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0xC0,0x05,0x31,0x29,0xA2,0x78,0xC0,
+0x31,0x3A,0xC0,0x13,0xC0,0x22,0xA5,0x88,0x88,0x9D,0x6E,0x05,0xDB,0xA6,0x87,0xFE,0x54,0xE7,0x2C,0xC0,0x9E,0x86,0xA9,0x88,0x06,0x18,0xC2,0x2C,0xC2,0x0D,0xC0,0x25,
+0x0A,0x06,0x18,0xC4,0x06,0x18,0xC1,0x15,0xFE,0x00,0x40,0x05,0xC1,0x0C,0x05,0xC9,0x07,0x98,0x9B,0x05,0xC1,0x0C,0x05,0xB5,0x84,0x04,0xFE,0xA1,0x61,0x29,0xC1,0x31,
+0x29,0x31,0xA2,0x88,0x31,0x05,0x31,0xA3,0x88,0x05,0xC0,0x0A,0xC2,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0xC0,0x31,0x05,0x31,0x29,0xC1,0x3A,0xC0,0x1D,0x13,
+0x36,0xA2,0x78,0x89,0xAD,0xDD,0x32,0x0D,0x9A,0x87,0x06,0x35,0x06,0x18,0xC0,0x06,0x18,0xC7,0x0D,0x25,0x0A,0x06,0x18,0xC5,0x06,0x92,0x9B,0xFE,0x00,0x40,0x05,0xC1,
+0x0C,0x05,0xC1,0x0A,0x05,0x0A,0x05,0xC3,0xAA,0x66,0x19,0x05,0x0A,0x05,0xC0,0x3C,0x1C,0x09,0x29,0xC1,0x31,0x29,0x31,0x3D,0x9D,0x99,0x29,0x3D,0x7E,0xC0,0x6E,0xC0,
+0x3D,0x0A,0x3D,0x0A,0xC0,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0xC0,0x31,0x3A,0xC0,0x31,0x3A,0xC1,0x13,0xC0,0x36,0x07,0x89,0xAD,0xDC,0xAF,0x54,0x0D,0x18,
+0x97,0x9A,0x06,0x35,0x0E,0x06,0x18,0xC2,0x06,0x18,0xC7,0x35,0x0A,0x06,0x18,0xC4,0xFE,0x23,0x41,0xFE,0x00,0x40,0x05,0xCD,0x2B,0xA3,0x67,0x05,0x0C,0x0A,0xA8,0x97,
+0xB0,0x92,0xFE,0x99,0x61,0x29,0xC1,0x7E,0x29,0x31,0x3D,0x24,0x29,0x3D,0xC0,0x7E,0xC0,0x6E,0xC0,0x3D,0x0A,0x3D,0x0A,0xC1,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,
+0x31,0x05,0x31,0x29,0xC1,0x3A,0xC0,0x13,0x22,0x1D,0xAB,0x64,0x85,0x9F,0x6E,0x05,0xDA,0x12,0x18,0x06,0x25,0x18,0x35,0x61,0x1A,0x18,0xC3,0x06,0x18,0xC7,0x0D,0x25,
+0x50,0x0D,0x18,0xC2,0x15,0xFE,0x10,0xC2,0x05,0x6E,0x05,0x0A,0x05,0xC4,0x17,0x05,0xC2,0xA6,0x87,0xA2,0x56,0x05,0x0C,0x0A,0xB6,0x94,0xFE,0x8A,0x21,0x31,0xC0,0x3D,
+0x31,0xA2,0x88,0x29,0x3D,0x29,0xC1,0x31,0x05,0xC2,0x6E,0x05,0xC0,0x31,0x0A,0xC2,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x31,0x05,0x31,0x29,0xC1,0xA2,0x78,0xC0,
+0x13,0xC0,0x22,0xA5,0x88,0x88,0x9D,0xDC,0xBF,0x20,0x1F,0x25,0x6B,0xA4,0x87,0x2C,0xC0,0x9E,0x86,0x1F,0x18,0x06,0x18,0xCC,0x06,0x35,0x0A,0x06,0x18,0xC0,0x15,0x10,
+0x38,0x9B,0xAA,0x03,0x9B,0x98,0x05,0xC1,0x0C,0x05,0xC5,0xA6,0x87,0x10,0x96,0xBB,0x05,0x13,0x04,0x3D,0x7E,0xC5,0x6E,0x05,0xC0,0x31,0x0A,0xC3,0x05,0x0A,0x05,0xC0,
+0x0A,0xC0,0x05,0xC1,0x0A,0x29,0xC3,0x05,0x46,0x29,0x3A,0xC0,0x31,0x3A,0xC0,0x13,0xC0,0x22,0xA8,0x84,0x08,0x5A,0xDB,0xB4,0x42,0x1A,0x25,0x2C,0xC0,0x0D,0x9A,0x87,
+0xC0,0x1A,0x18,0xC4,0x06,0x18,0xC9,0x12,0x95,0xBF,0xAF,0x75,0x0E,0x8C,0x9D,0x10,0x59,0x37,0xC0,0x10,0x37,0x3F,0x15,0x03,0x15,0x05,0x37,0xC0,0x2B,0x03,0x15,0xA5,
+0x76,0x28,0x05,0xAB,0x86,0xAE,0xA3,0xFE,0x99,0x61,0x29,0xA3,0x98,0xC2,0x6E,0x05,0xC0,0x51,0x0A,0xC4,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0xC0,0x31,0x3A,
+0x29,0xC0,0x05,0xC0,0x29,0x3A,0xC0,0x31,0x3A,0xC2,0x13,0xC0,0x36,0x1E,0x8A,0x8B,0x9D,0x9A,0xDB,0x10,0xFE,0x65,0xA7,0x59,0x24,0x0E,0xA8,0x75,0x9A,0x88,0x36,0x2C,
+0x18,0xC1,0x06,0x18,0xCB,0x0D,0x8D,0x9C,0xFE,0x00,0xA0,0xA4,0x77,0xA7,0x54,0xC0,0x9C,0xAB,0x96,0xCC,0x05,0xC3,0x32,0x03,0x15,0x3F,0x15,0x68,0x15,0x03,0x37,0x05,
+0x28,0x9F,0xCB,0x0F,0xFE,0x99,0x61,0xC0,0x7A,0xA1,0xA8,0xC1,0x9D,0x89,0x3D,0x29,0x05,0x6E,0x29,0x0A,0x05,0x0A,0x05,0xC0,0x0A,0x29,0x31,0x29,0x3D,0x0A,0x05,0x0A,
+0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0x29,0xC0,0x3A,0xC0,0x31,0x3A,0xC2,0x1D,0x59,0xC0,0xAB,0x75,0x85,0x9F,0x6E,0x05,0xDB,0x39,0xA5,0x84,0xFE,0x09,0x21,0xAF,0x43,
+0xB3,0x85,0x2C,0x0D,0x3B,0x1A,0x18,0xC5,0x9D,0x9A,0x18,0xC5,0x12,0x8E,0x8A,0x10,0x2B,0xAA,0x22,0x3E,0x9A,0xAC,0x05,0xD0,0x00,0xFE,0x99,0x61,0x29,0xC1,0x31,0x29,
+0x31,0x6F,0x9D,0x99,0x29,0x3D,0xA2,0x87,0x66,0x0A,0x05,0xC0,0x0A,0x29,0x31,0x29,0x3D,0xC0,0x05,0xC0,0x0A,0xC0,0x3D,0x0A,0x3D,0x0A,0xC1,0x05,0x3D,0x05,0x31,0x29,
+0x3D,0x29,0xC1,0x31,0x3A,0x1D,0x59,0xC0,0xAB,0x75,0x17,0xC0,0x9D,0x9A,0x6E,0x05,0xD9,0x2A,0xA5,0x88,0x8E,0xBD,0x05,0xB8,0x10,0x1A,0x90,0x9B,0xFE,0x01,0x60,0x0E,
+0x06,0x18,0xC3,0x06,0x18,0xC4,0x99,0x9C,0x91,0x9B,0x92,0xCE,0x98,0xBC,0x3F,0xA4,0x45,0x3E,0x9A,0xAC,0x0F,0x05,0xC1,0x0C,0x05,0xCB,0x20,0xA9,0xF5,0xFE,0xB1,0x81,
+0x3D,0x05,0x31,0x56,0x3D,0x29,0xC1,0x31,0xA3,0x88,0x05,0x0A,0x05,0xC0,0x0A,0x29,0x31,0x29,0x3D,0xC0,0x05,0x3D,0x05,0xC3,0x31,0x05,0x3D,0x05,0x31,0x29,0x3D,0x29,
+0xC1,0x31,0x3A,0xC1,0x31,0xFE,0x4A,0x25,0xC0,0x22,0xA5,0x88,0x8C,0x9B,0x9C,0x8A,0xE0,0x15,0xFE,0x76,0x09,0x3B,0xFE,0x09,0x21,0xFE,0x23,0xC1,0xB3,0x84,0x1A,0x18,
+0xC2,0x06,0x18,0xC2,0x25,0x3B,0x91,0xBE,0x05,0xA4,0x66,0xA7,0x66,0x13,0x3E,0x13,0x05,0x19,0x05,0xCE,0xA6,0x87,0xB1,0x95,0xFE,0x99,0x61,0x0A,0x66,0x0A,0x05,0xC0,
+0x0A,0x9C,0x89,0x31,0x29,0x3D,0xC0,0x05,0x0A,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0xC0,0x31,0x0A,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x31,0x5F,0xC0,
+0x31,0x3A,0xC3,0x1D,0x59,0xC0,0xAB,0x75,0x88,0x8D,0x9D,0x9A,0xE0,0xA8,0x55,0x36,0x3B,0x12,0x36,0x9B,0x77,0xA9,0x97,0x18,0xC1,0x06,0x18,0xC1,0x97,0x9A,0x12,0x95,
+0xBF,0x28,0x05,0xC1,0x37,0x19,0x9D,0x77,0x05,0xD1,0xB3,0x85,0x04,0x3D,0x7E,0xC3,0x3D,0x51,0x31,0x05,0x6E,0x05,0x0A,0x05,0xC0,0x0A,0xC0,0x05,0xC1,0x0A,0x29,0xC0,
+0x05,0xC2,0x0A,0x05,0xC0,0x31,0x0A,0xC1,0x31,0x05,0x31,0x29,0xC1,0x3A,0xC2,0xBC,0x56,0xC5,0x99,0x99,0xC0,0x01,0xC5,0x96,0x99,0xA7,0x88,0x01,0xC5,0x95,0x99,0xAA,
+0x78,0x01,0xC5,0x18,0x39,0x01,0xC4,0x9C,0x88,0x00,0x01,0xC6,0x00,0xC0,0x01,0xF2,0x18,0x39,0x01,0xEB,0x00,0x01,0xFD,0xD0,0x18,0x39,0x01,0xEB,0x00,0x98,0xA9,0x41,
+0x27,0x28,0xC0,0x01,0x66,0x01,0xFD,0xC8,0x19,0x00,0x3C,0x01,0xEE,0x00,0x27,0x9D,0x98,0x3D,0x18,0x00,0xC0,0x01,0xFD,0xC6,0x27,0x28,0xC0,0x01,0xF2,0x19,0x00,0x07,
+0x3D,0x07,0x00,0xC0,0x01,0xFD,0xC2,0x18,0x39,0x01,0xEA,0x00,0x3D,0x01,0xC9,0x19,0x00,0x07,0x26,0x27,0x00,0xC0,0x01,0xFB,0x19,0x27,0x28,0x01,0xE7,0x00,0x18,0x26,
+0x3D,0x18,0x01,0xCD,0x19,0x00,0x07,0x26,0x27,0x00,0xC0,0x01,0xF7,0x00,0xC0,0x01,0xE6,0x00,0x3D,0x26,0x3D,0xA5,0x67,0xC1,0x01,0xD1,0x00,0x27,0x07,0x3D,0x18,0x27,
+0x28,0xC0,0x01,0x3C,0x01,0xF0,0x27,0x28,0xC0,0x01,0x3C,0x01,0xE1,0x00,0x3D,0x26,0xA5,0x78,0x18,0x1D,0xC2,0x01,0xD5,0x19,0x00,0x07,0x3D,0x18,0x27,0x00,0xC0,0x01,
+0xEE,0x18,0x39,0x01,0xE2,0x00,0x3D,0x26,0x10,0x1D,0xC5,0x01,0xDA,0x19,0x00,0x07,0x3D,0x26,0x27,0x00,0x19,0x39,0x01,0xE8,0x27,0x28,0x01,0xE0,0x00,0x3D,0x07,0x1D,
+0xC8,0x01,0xC9,0x00,0xC0,0x3D,0x07,0xC0,0x1D,0x19,0x39,0xC0,0x01,0xE2,0x00,0xC0,0x01,0xDF,0x27,0x26,0x3D,0x1D,0xC5,0x01,0xCD,0x28,0x00,0x27,0x26,0x3D,0x1D,0xC0,
+0x19,0x39,0xC0,0xA2,0x84,0xA0,0xA9,0xC8,0x47,0xC4,0x01,0xCC,0x18,0x39,0x01,0xDC,0x19,0x07,0x3D,0x07,0x18,0x1D,0xC6,0x01,0xCE,0x3E,0xC1,0x9D,0x98,0x55,0x56,0xC3,
+0x9D,0x97,0xC1,0x9C,0x8A,0x65,0x67,0xC1,0x06,0x3A,0xA4,0x89,0xC0,0x0F,0x1E,0x0F,0xA3,0x99,0x3E,0xC1,0x47,0xC1,0x01,0xC6,0x27,0x28,0x01,0xDA,0x19,0x97,0xA9,0x26,
+0x3D,0x1D,0xC9,0x01,0xC9,0x31,0x9F,0xB8,0x0F,0x56,0x20,0x9B,0x9A,0x3C,0x99,0x88,0x53,0x51,0x9D,0x9A,0xD0,0x2B,0x7F,0x6E,0xA4,0x87,0xA9,0x85,0xA1,0x9A,0x0F,0x1E,
+0xA4,0x77,0x9F,0x9B,0x46,0xC1,0x01,0xC1,0x19,0x00,0xA6,0x88,0xC0,0x01,0xD7,0x19,0x27,0x26,0x10,0x18,0x1D,0xCA,0x01,0xC5,0x3E,0xC0,0x07,0x06,0x9B,0x98,0x2B,0x17,
+0x9D,0x9A,0xDE,0xA6,0x87,0xA8,0x86,0xA5,0x87,0x1E,0xA4,0x77,0x9F,0x9B,0x46,0xC1,0x27,0x28,0xC0,0x01,0x66,0x01,0xD5,0x00,0x3D,0x26,0x10,0x1D,0xCC,0x01,0xC2,0x3E,
+0x1E,0x22,0x98,0x8A,0x2B,0x17,0x9D,0x9A,0xE5,0x2B,0xA4,0x98,0x06,0x0F,0x1E,0xA4,0x77,0x97,0x98,0x3A,0xC1,0x01,0xD4,0x00,0x9A,0x98,0x3D,0x07,0x18,0x1D,0xCD,0x01,
+0xA1,0x85,0x9F,0xB8,0x9C,0x79,0x06,0x17,0x05,0xED,0xA9,0x85,0x22,0x1E,0xA4,0x76,0x31,0x3E,0x9E,0x7B,0x01,0xD2,0x00,0x96,0x98,0x10,0x18,0x1D,0xCF,0x01,0x07,0x90,
+0x99,0x99,0x9C,0xF3,0xAB,0x86,0xA9,0x85,0x2B,0x3E,0xC0,0x3C,0x01,0xCF,0x18,0x1F,0x10,0x1D,0xD1,0x01,0x20,0x05,0xF6,0x16,0x36,0x35,0x47,0x3A,0xC1,0x01,0xCB,0x93,
+0xA9,0x3D,0x07,0x18,0x1D,0xD1,0x01,0x06,0x91,0x9C,0x05,0xF7,0xA9,0x85,0x22,0x35,0x31,0x3A,0x3C,0x01,0xC8,0x19,0x07,0x26,0x1D,0xD4,0x3E,0x12,0x95,0x9D,0xFA,0xA9,
+0x85,0xAE,0x77,0x35,0x31,0x3A,0x3C,0x01,0xC5,0x27,0x26,0x10,0x1D,0xD5,0x3E,0x8B,0x99,0x99,0x9C,0xFC,0x06,0x0F,0x3E,0xC0,0x3C,0xC0,0x01,0xC2,0x27,0x26,0x10,0x1D,
+0xD6,0x3E,0x88,0x9A,0x05,0xFD,0xA5,0x87,0xAB,0xA7,0x35,0x47,0x3A,0x3C,0x01,0x39,0x18,0x26,0x10,0x18,0x1D,0xD6,0x0F,0x8A,0x8C,0x05,0xFD,0xC1,0x3F,0x07,0x35,0x3A,
+0xC0,0x10,0x26,0x3D,0x1D,0xD8,0x07,0x05,0xFD,0xC4,0x22,0x1E,0x29,0x26,0x3D,0x1D,0xD9,0x20,0x05,0xFD,0xC5,0xAE,0x85,0xAD,0x85,0x9D,0x8A,0x18,0x1D,0xD9,0x01,0xC1,
+0x90,0xA7,0x05,0xFD,0xC6,0x3F,0x07,0x0F,0x9B,0x69,0x1D,0xDD,0x01,0xC1,0x8C,0xA6,0x05,0xFD,0xC8,0x07,0x35,0x19,0x1D,0xDC,0x01,0xC0,0x07,0x8B,0x9C,0x05,0x6B,0x05,
+0xFD,0xC7,0x22,0x1E,0x19,0x1D,0xC0,0x5A,0x1D,0xD8,0x01,0xC0,0x07,0x05,0x0C,0x05,0xFD,0xC9,0x22,0x24,0x06,0x1D,0xDA,0x01,0xC0,0x99,0xA4,0x05,0xFD,0xCC,0x22,0x1E,
+0x06,0x1D,0xD9,0x01,0xC0,0x94,0xA3,0x05,0xFD,0xCC,0x2B,0x07,0x35,0x18,0x1D,0xD8,0x01,0x3E,0x2B,0x17,0x05,0xD3,0x36,0xA3,0x88,0x3F,0x05,0xF2,0xA6,0x87,0x1E,0x0F,
+0x18,0x1D,0xD7,0x01,0x07,0x8B,0x9C,0x05,0x0C,0x05,0xD2,0xFE,0x7C,0x2B,0xB6,0x9A,0x94,0x78,0x1E,0x16,0x05,0xC5,0x3F,0x17,0x05,0xE8,0x3F,0x24,0x9D,0x8A,0x18,0x1D,
+0xD6,0x01,0x20,0x05,0xD5,0x07,0xFE,0xEF,0x98,0xA3,0x88,0x9A,0x9A,0x93,0x85,0x36,0x90,0x8B,0x17,0x05,0xC2,0x13,0xA7,0x65,0x12,0x05,0xE8,0x16,0xB2,0x74,0x22,0x1D,
+0xD6,0x01,0x94,0xA5,0x05,0xD5,0x13,0x19,0x04,0x6B,0x04,0x98,0x88,0x8C,0x99,0x3C,0x05,0xC3,0x1E,0xAF,0x86,0x2B,0x3F,0x05,0xE7,0x3C,0x24,0x22,0x1D,0xD5,0x01,0x31,
+0x05,0xD5,0xAC,0x87,0xFE,0xCE,0xB3,0x0B,0x04,0x0B,0x04,0x0B,0x8E,0x99,0x89,0x88,0x90,0x8B,0x05,0xC1,0x16,0x3D,0xAF,0x89,0x3D,0x36,0x17,0x05,0xE6,0x22,0xAA,0x74,
+0x29,0x18,0x1D,0xD3,0x07,0x8B,0x9C,0x05,0xD5,0x2B,0xFE,0xBD,0xD1,0x0B,0x04,0x0B,0xC1,0x04,0x34,0x89,0x98,0x8A,0x8B,0x97,0x9C,0xC1,0x36,0x34,0x04,0x34,0x0C,0x8A,
+0x8B,0x97,0x9C,0xE6,0xB3,0x84,0x1E,0x06,0x1D,0xD3,0x01,0xD1,0x9D,0xA5,0x0A,0x05,0xD6,0x3D,0xB3,0x9B,0x0B,0x04,0x0B,0xC1,0x04,0x9A,0x9A,0x8C,0x76,0x87,0x9C,0x05,
+0xC0,0xA5,0x88,0x00,0x04,0x0B,0x9D,0x98,0x3D,0x06,0x0A,0x05,0xE4,0xA5,0x87,0x07,0x0F,0x18,0x1D,0xD2,0x01,0xD1,0x3A,0x05,0x6B,0x05,0xD5,0xFE,0x9D,0x2D,0x04,0x0B,
+0xC0,0x04,0x0B,0x0E,0x0B,0x04,0x0B,0x21,0x3C,0x05,0xC0,0x13,0x34,0x04,0x0B,0x04,0x93,0x8A,0x0F,0x8C,0x9B,0x05,0xE4,0xA9,0x85,0x35,0x36,0x18,0x1D,0xD0,0x9B,0xBA,
+0x01,0xD0,0xA1,0x85,0x8B,0xBA,0x99,0x9C,0xD7,0xFE,0x94,0xCD,0x04,0x6B,0xC0,0x0E,0x0B,0xC0,0x04,0x0B,0xC0,0x9D,0x98,0x21,0x3C,0x94,0x7A,0xA3,0x98,0x21,0x04,0x0E,
+0x0B,0xC0,0x34,0x8A,0x89,0x31,0x05,0xE4,0x3A,0x27,0x29,0x1D,0xCD,0x26,0x69,0x26,0x3D,0x01,0xD0,0x07,0x0F,0x05,0xD7,0xFE,0x8C,0x6C,0x04,0x0B,0xC0,0x0E,0xC0,0x0B,
+0xC1,0x04,0x0B,0x9D,0x98,0x21,0x20,0x05,0xB8,0x73,0x19,0x04,0x2B,0x04,0x0E,0x19,0x00,0x12,0x05,0xE4,0x07,0x35,0x18,0x7F,0x9D,0x98,0x1D,0xC7,0x26,0x1F,0x26,0x3D,
+0xA4,0x88,0xC1,0x01,0xD0,0x9C,0x95,0x8B,0x9C,0x05,0xD7,0xFE,0x7C,0x2B,0x04,0x0B,0xC0,0x0E,0xC1,0x0B,0xC4,0x21,0x31,0xA2,0x88,0xFE,0xB5,0xB2,0x19,0x95,0x97,0x0B,
+0xC1,0x2B,0x00,0x20,0x95,0x9B,0xE3,0x3F,0x24,0x9A,0x8A,0x18,0x1D,0xC5,0x3D,0x26,0xC0,0x3D,0x25,0xC4,0xA7,0x67,0xA3,0x89,0xC0,0x7A,0x01,0xCB,0x3E,0x3A,0x05,0x0C,
+0x05,0xD6,0xBB,0x84,0xFE,0xF7,0xB9,0x0B,0x04,0x0B,0xC0,0x2B,0x96,0x79,0x11,0x9C,0x99,0x11,0x0B,0xA4,0x99,0x42,0x89,0x98,0x89,0x9A,0xB8,0x74,0x1F,0xB6,0x9A,0xA8,
+0x76,0xC2,0x9D,0x98,0x8D,0x87,0x20,0x95,0x9B,0xE3,0xAF,0x84,0xAE,0x74,0x29,0x18,0x7F,0x9D,0x98,0x1D,0x9B,0xBA,0x26,0xC0,0x3D,0x18,0x27,0x25,0xC5,0x26,0x69,0x26,
+0x18,0xA4,0x88,0x19,0x39,0xC0,0x7A,0x01,0xC6,0xA1,0x85,0x8B,0xBA,0x05,0xD8,0x32,0xFE,0xF7,0xB9,0x0B,0x04,0x97,0x9B,0x33,0x89,0x89,0x92,0x9A,0x05,0xC3,0xA5,0x87,
+0xA9,0x97,0xA5,0x87,0x9C,0x88,0xFE,0xBE,0x31,0x0B,0xC2,0x04,0x0B,0x0E,0x21,0x3C,0x94,0x7A,0x05,0xE2,0xB8,0x73,0x1E,0x96,0x8B,0x10,0x26,0x1F,0x26,0xA3,0x98,0x25,
+0xC9,0x9C,0x88,0x26,0x3D,0xC0,0x26,0xC0,0x3D,0x26,0x3D,0x1D,0x00,0xC0,0x01,0xC3,0x9D,0xA5,0x8A,0x8C,0x05,0xD8,0x32,0xBD,0x99,0x99,0x78,0x88,0x8A,0x2B,0x17,0x05,
+0xA6,0x87,0x25,0xAC,0x87,0x33,0xC2,0x11,0xC0,0x22,0x0B,0xAD,0x98,0x04,0x0B,0x0E,0x0B,0x04,0x0B,0x9D,0x98,0x21,0x3C,0x0F,0x05,0xE1,0xA9,0x85,0x35,0x96,0x9B,0x26,
+0x3D,0x18,0x25,0xCB,0x26,0x3D,0x18,0x3D,0xC1,0x18,0x3D,0xC2,0x26,0x1F,0x26,0x18,0x00,0xA5,0x97,0x9B,0x95,0x8C,0x9E,0xD9,0xB3,0x85,0xC0,0x92,0x8B,0x25,0xB0,0x85,
+0xAC,0x87,0xA9,0x89,0xA5,0x88,0xA2,0x89,0xA2,0x87,0x0B,0xC2,0x04,0x0B,0x21,0xC0,0x0B,0x04,0x0B,0xC1,0x04,0x0B,0xC0,0x2B,0x89,0x88,0x87,0x9C,0x95,0x9B,0xE2,0x22,
+0x1E,0x29,0x25,0xCD,0x9C,0x88,0xC0,0x18,0x3D,0xC1,0x18,0x3D,0xC7,0x29,0x26,0x05,0xD9,0x29,0x33,0xAF,0x87,0x2A,0x12,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC0,0x04,0x0B,
+0x0E,0x0B,0x2B,0x21,0x0B,0xC4,0x04,0x0B,0x2B,0x87,0x99,0x1E,0x90,0x9B,0x05,0xE1,0x32,0xB6,0x83,0x9D,0x89,0x25,0xCA,0x9C,0x88,0xC0,0x1F,0x26,0x02,0x3D,0xC3,0x18,
+0x3D,0xC6,0xA9,0x84,0x90,0x8B,0x05,0xD9,0x36,0x15,0x12,0xC1,0x0B,0xC3,0x04,0x0B,0x0E,0x0B,0xC1,0x04,0x97,0x9B,0x04,0x0B,0xC0,0x0E,0xC1,0x0B,0x04,0x30,0x05,0x3C,
+0x24,0x2B,0x17,0x05,0xE0,0xAF,0x84,0x1E,0x25,0xC8,0x9C,0x88,0x1F,0x26,0x61,0xC0,0x3D,0x18,0x3D,0xC4,0x18,0x3D,0xC4,0xA3,0x87,0x22,0x05,0xDA,0x36,0xFE,0xE7,0x76,
+0x0E,0x0B,0xC8,0x04,0x0B,0xC2,0x04,0x0B,0x0E,0x0B,0xC2,0x21,0x3C,0xAE,0x78,0x00,0xA4,0x87,0x36,0x8B,0xAD,0x5A,0xE0,0x2B,0xB8,0x74,0x36,0x18,0x25,0xC3,0x3D,0xC0,
+0x1F,0x26,0x61,0xC2,0x3D,0xC0,0x18,0x3D,0xC4,0x0F,0x3D,0x18,0x3D,0xC1,0x13,0x3A,0x05,0x6B,0x05,0xD8,0x29,0xB2,0x86,0x11,0x33,0xC0,0x11,0x2D,0xAA,0x97,0x12,0xC0,
+0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC3,0x04,0x0B,0x0E,0x0B,0x98,0x9A,0x11,0x19,0x04,0x0B,0xC0,0x21,0x3A,0x05,0x6B,0x05,0xDF,0x13,0x35,0x13,0x25,0xC2,0x3D,0x26,0x15,
+0xC5,0x3D,0xCA,0x18,0x3D,0xC0,0x36,0x94,0x89,0x97,0x9C,0xDA,0x13,0x3E,0xC0,0x9B,0x7B,0x07,0x98,0x98,0x2B,0xB4,0x77,0x2D,0x0D,0x7E,0x0B,0xC5,0x04,0x0B,0x0E,0x0B,
+0xC0,0x9D,0x98,0x31,0x0B,0xC0,0x04,0x0B,0x0E,0x9C,0x76,0x86,0x8A,0x87,0x9A,0x05,0xE0,0x32,0xB6,0x83,0x9C,0x77,0x25,0xC0,0x02,0x9D,0x88,0x26,0x61,0xC6,0x3D,0xCD,
+0xAB,0x74,0x05,0x0C,0x05,0xD9,0xB3,0x85,0xFE,0xDE,0xF8,0xA8,0x8B,0xC0,0x9E,0x75,0x0C,0x85,0x69,0x89,0x99,0x32,0x11,0x0D,0x12,0x0B,0x04,0x0B,0x0E,0x0B,0xC4,0x04,
+0x92,0x87,0xAB,0x9A,0x04,0x0E,0x0B,0x04,0x0B,0x0E,0x8E,0x89,0x36,0x08,0x5A,0xE0,0x13,0x35,0x13,0x02,0x1F,0x15,0xC8,0x3D,0xCC,0x13,0x39,0x05,0xDB,0x29,0x0C,0xA8,
+0x8B,0xC0,0x9E,0x75,0x95,0x87,0x87,0x35,0x9D,0x98,0xFE,0x19,0x44,0x9C,0x97,0x33,0x0D,0x12,0x69,0x0E,0x0B,0xC4,0x04,0x34,0xC0,0x04,0x0B,0xC0,0x04,0x93,0x8A,0x86,
+0x7B,0x97,0xA9,0x7E,0x3C,0x20,0x95,0x9B,0xE0,0xA6,0x87,0x1E,0x9B,0x87,0x15,0xCA,0x3D,0xCC,0x36,0x2C,0x05,0xDB,0x29,0x0C,0x31,0xC0,0x54,0xFE,0x5B,0xA9,0x9D,0x02,
+0x96,0xDC,0x95,0xDE,0x0A,0x2B,0x33,0x0D,0x12,0x69,0x0E,0xC0,0x0B,0xC3,0x92,0x86,0x0B,0xC1,0x04,0x33,0x2B,0x51,0xA8,0x45,0x0F,0x11,0x1E,0x89,0x8C,0x05,0x6B,0x05,
+0xDE,0xB7,0x74,0xA0,0x85,0x3F,0x15,0xC9,0x3D,0xCC,0xAC,0x73,0x8C,0x9B,0x05,0xDB,0x29,0xFE,0xDE,0xF8,0xA8,0x8B,0xC0,0x9B,0x87,0x28,0xA1,0x45,0x91,0xFF,0x05,0xC0,
+0x26,0x9D,0x88,0x11,0x0D,0x0B,0x04,0x0B,0xC2,0x0E,0x34,0xA2,0x9A,0x04,0x0B,0x9D,0x98,0x81,0x9D,0x14,0x05,0x17,0x08,0xA9,0x77,0x2A,0x11,0xFE,0x21,0x41,0x97,0x9C,
+0xE0,0xAC,0x87,0xAF,0x84,0x3F,0x15,0xC9,0xA4,0xB8,0xC0,0x02,0xC1,0x3D,0xC7,0x07,0x05,0x6B,0x05,0xDA,0x29,0xFE,0xDE,0xF8,0x31,0xC0,0x33,0x28,0xA1,0x45,0x96,0xDC,
+0x95,0xDE,0xA1,0xAA,0xB2,0x10,0x28,0x25,0x2D,0x0D,0x7E,0x0B,0x04,0x0B,0x0E,0x0B,0x92,0x86,0x0B,0xC1,0x16,0x8E,0x65,0x32,0x05,0xC0,0x13,0xAA,0x54,0xFE,0xD6,0xD7,
+0x2D,0x0F,0x8A,0x8C,0x05,0xDF,0x3A,0x24,0x95,0x8B,0x98,0x9C,0xC9,0xA4,0xC8,0xC1,0x5A,0xC2,0x02,0xC0,0x66,0xC2,0x29,0x9D,0x88,0x0A,0x05,0xDB,0x29,0xFE,0xDE,0xF8,
+0xA8,0x8B,0xC0,0x1B,0x8B,0x45,0x19,0x28,0x19,0x28,0x12,0x11,0xAB,0x98,0x87,0x89,0x33,0xA5,0x96,0x0B,0x0E,0x0B,0x0E,0x9A,0x89,0x9C,0x75,0x0B,0xC0,0x30,0x8F,0x58,
+0xA8,0x43,0x13,0x95,0xDE,0xC0,0xAF,0x55,0x28,0x2A,0xA2,0x89,0x84,0x86,0x87,0x9A,0x99,0x9C,0xE0,0xB5,0x84,0xA1,0x85,0xFE,0x21,0x24,0xC9,0x09,0xC0,0x5A,0x09,0xC0,
+0x06,0x09,0xC1,0x06,0x09,0x02,0xC0,0xAB,0x84,0x91,0x9A,0x97,0x9C,0xDC,0xB0,0x95,0xB2,0x76,0x33,0xA5,0x9A,0xC0,0x33,0x30,0x28,0x08,0x28,0x23,0x2A,0xA2,0x89,0x2D,
+0x11,0x0D,0x0B,0x0E,0x0B,0x0E,0x96,0x76,0xA6,0x88,0xA4,0x8B,0x88,0x9A,0xA7,0x98,0xC0,0x28,0xA1,0x45,0x9C,0xCA,0xA2,0x89,0x28,0x23,0x05,0x11,0x00,0x91,0x9A,0x8B,
+0xAD,0x5A,0xDF,0x13,0x24,0x8E,0x9D,0x57,0xC8,0x09,0xC0,0x06,0x09,0xC2,0x06,0x09,0xC1,0x06,0xC0,0x0F,0x8A,0x8C,0x05,0xDC,0x29,0xBD,0x85,0x21,0x33,0x37,0xA9,0x88,
+0xC0,0x9B,0x77,0x11,0x37,0x2D,0x0B,0x37,0x11,0x33,0xB8,0x75,0x0E,0x0B,0x0E,0xC0,0x31,0x0B,0x34,0x11,0xB4,0x9B,0x9E,0x75,0x11,0x94,0x22,0x28,0x9D,0x98,0xB1,0xAA,
+0x3D,0x33,0x3D,0x2A,0x88,0x97,0x82,0x8B,0x9C,0x8A,0xDF,0x3F,0xB6,0x71,0x8E,0x9E,0x15,0xC8,0x09,0xC1,0x06,0x09,0xC1,0x06,0x09,0xC0,0x06,0x09,0xA7,0x77,0x22,0x05,
+0xDD,0x22,0x34,0x04,0x0B,0x0C,0x2D,0x9E,0x86,0x21,0x37,0xC0,0x2D,0x0C,0xC0,0xA8,0x76,0x0E,0xC0,0x0B,0x0E,0xC0,0x51,0x94,0x76,0x0B,0x9A,0x99,0x33,0x37,0x0C,0xC0,
+0x2D,0x37,0x11,0xC1,0xAF,0x9A,0xA5,0x96,0x0B,0x31,0x2C,0x05,0xDF,0xA5,0x87,0xB6,0x84,0x94,0x89,0x99,0x9D,0xC8,0x09,0xC2,0x06,0x09,0xC1,0x06,0x09,0xC1,0xAB,0x54,
+0x2C,0x05,0xDD,0x29,0x34,0x04,0x0B,0xC0,0x0E,0x0B,0xC5,0x04,0x0B,0x0E,0x0B,0xC1,0x9D,0x98,0x99,0x87,0x0B,0xC0,0x04,0x9A,0x9A,0x2D,0x9E,0x86,0xC0,0x37,0x34,0x04,
+0x6B,0xC0,0x0E,0x0B,0x9C,0x86,0xFE,0x5B,0x27,0x8A,0x8C,0x05,0xDF,0x24,0x96,0x99,0x97,0x8E,0xC8,0x09,0xC3,0x06,0x09,0xC1,0x06,0x09,0xC0,0x1E,0x1F,0x05,0xDD,0x29,
+0x34,0x0E,0x0B,0x0E,0xC0,0x51,0x0B,0x04,0x0B,0x0E,0x0B,0xC5,0x04,0x2B,0x99,0x87,0x0E,0x0B,0x0E,0xC0,0x3A,0x0B,0x04,0x0B,0xC0,0x0E,0xC1,0x0B,0xC0,0x2B,0x3C,0x1F,
+0x05,0xDF,0xB8,0x73,0x9B,0x97,0x15,0xC8,0xA1,0xC9,0x06,0xC1,0x09,0xC0,0x06,0x09,0xC1,0x06,0xA9,0x54,0x0F,0x05,0xDE,0x22,0x34,0x04,0x0B,0xC0,0x0E,0x0B,0xC0,0x04,
+0x0B,0x0E,0x0B,0xC6,0x04,0x31,0x0E,0x0B,0x0E,0xC0,0x3A,0x0B,0x04,0x0E,0x0B,0xC4,0x34,0x36,0x99,0x9A,0x05,0xDF,0xB7,0x74,0x9D,0x97,0x15,0xC8,0x2D,0xC5,0x06,0xC2,
+0x1E,0x96,0x88,0x05,0x6B,0x05,0xDC,0x29,0x34,0x04,0x0B,0xC0,0x0E,0x0B,0xC1,0x04,0x0B,0x0E,0x0B,0xC6,0x19,0x0B,0xC0,0x04,0x0E,0x0B,0xC6,0x04,0x0B,0x88,0x9B,0x89,
+0x89,0x29,0x05,0xDF,0xB8,0x73,0x14,0x15,0xC6,0xA4,0x88,0x25,0x2D,0xC9,0x24,0x8C,0x8B,0x05,0xDE,0x29,0x34,0x0E,0x0B,0x0E,0xC0,0x51,0x0B,0x04,0x0E,0x0B,0x04,0x0B,
+0x0E,0x0B,0xC4,0x19,0x0B,0xC0,0x04,0x0E,0x0B,0x04,0x0B,0x0E,0x0B,0xC3,0x2A,0x13,0x95,0x7A,0x07,0x05,0xDF,0x0F,0x14,0x15,0xC3,0x3D,0xC0,0x25,0xC1,0x2D,0xC4,0x69,
+0xC2,0xA7,0x77,0x36,0x8B,0xAD,0x05,0xDE,0x07,0xFE,0xE7,0x76,0x12,0x0E,0x0B,0xC7,0x04,0x0B,0x0E,0x0B,0xC2,0x15,0x19,0x0B,0xC0,0x04,0x0E,0x0B,0xC0,0x04,0x0B,0x0E,
+0x0B,0xC1,0x21,0x05,0xC0,0x36,0x08,0x05,0xDE,0x24,0x22,0x98,0x8A,0x3D,0x18,0x3D,0x25,0xC4,0x2D,0xC4,0x26,0xC2,0x0D,0x94,0x78,0x05,0xDF,0x24,0x15,0xA4,0x8B,0x0E,
+0xC0,0x0B,0xC8,0x04,0x0B,0x0E,0x0B,0xC1,0x92,0x86,0x0B,0xC2,0x04,0x0B,0xC2,0x0E,0x0B,0x9D,0x98,0x29,0x05,0xC0,0x36,0x94,0x89,0x97,0x9C,0xDE,0xB8,0x81,0x36,0x18,
+0x25,0xC7,0x26,0xC8,0x0F,0x8A,0x8C,0x05,0xDF,0xB8,0x73,0x15,0x12,0x0E,0xC1,0x0B,0xC9,0x69,0x0B,0x0E,0x0B,0x19,0x15,0x0B,0x04,0x0B,0xC2,0x0E,0x0B,0xC0,0x04,0x11,
+0x05,0xC1,0x29,0x9C,0x87,0x05,0x0C,0x05,0xDC,0xBB,0x84,0x29,0x25,0xC8,0x2D,0xC4,0x26,0xC1,0x36,0x0A,0x05,0xE0,0x0F,0x2B,0x04,0x0E,0x0B,0x0E,0x0B,0xCA,0x04,0x0B,
+0x19,0x34,0x04,0x0B,0xC0,0x0E,0x0B,0xC2,0x04,0x0B,0x9A,0x99,0xFE,0x3A,0x06,0x92,0x9A,0x05,0xC0,0x13,0xC0,0x05,0xDD,0x3F,0x24,0x13,0x25,0xC8,0x2D,0xC4,0x26,0xC1,
+0x1E,0x16,0x05,0xE0,0x32,0xFE,0xF7,0xB9,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC7,0x04,0x0B,0x0E,0x96,0x76,0x15,0x0B,0xC0,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x33,0x05,0xC2,
+0xAC,0x87,0x22,0x05,0xDD,0x3C,0x24,0x20,0x02,0xC0,0x25,0xC6,0x2D,0xC5,0x26,0x13,0x1E,0x1F,0x05,0xE0,0xFE,0x8C,0x6C,0x04,0x0B,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,
+0x0B,0xC4,0x3A,0x0B,0xC0,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x98,0x9A,0x20,0x05,0xC2,0x16,0xAB,0x74,0x05,0xDD,0x29,0x07,0x95,0xAC,0x42,0x69,0x26,0xC0,0x3D,0x25,0xC3,
+0x2D,0xC5,0x69,0x0D,0x99,0x79,0x91,0x9C,0x05,0xDF,0xA5,0x87,0xFE,0x94,0xCD,0x04,0x0E,0x0B,0xCB,0x04,0x0B,0x0E,0x0B,0xC8,0x04,0x0B,0x30,0x05,0xC3,0xAB,0x86,0x22,
+0x05,0xDC,0x2B,0xB6,0x84,0x22,0x18,0x6E,0xC2,0x3D,0x41,0x61,0x26,0x1F,0x3D,0x2D,0xC4,0x69,0xC0,0x1E,0x8B,0x9B,0x05,0xE0,0xA5,0x88,0xFE,0x9D,0x2D,0x04,0x0E,0x0B,
+0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,0x04,0x0B,0x9A,0x99,0x94,0x88,0x33,0xAD,0x78,0xAA,0x97,0x7E,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC0,0x21,0x05,0xC4,0xA9,0x85,
+0x22,0x8D,0x9D,0xDC,0x3C,0x24,0x18,0x1D,0xC6,0x10,0x18,0x1D,0x98,0xEA,0xC4,0x26,0x13,0xA5,0x77,0x08,0x05,0xE0,0xAC,0x87,0x07,0xBA,0x88,0xAD,0x98,0xC0,0x04,0x0B,
+0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,0x0C,0x30,0x8A,0x7A,0x05,0xC0,0x3F,0x33,0x0D,0x0B,0x04,0x0B,0xC2,0x0C,0xFE,0x3A,0x06,0x14,0x05,0xC3,0x3F,0x22,0x05,0xDC,0xB5,0x84,
+0xC0,0x18,0x1D,0xC9,0x2D,0xC4,0x26,0xAE,0x54,0x3C,0x05,0xE1,0x22,0x6D,0x36,0x19,0x04,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC3,0x11,0x81,0x99,0x05,0xC3,0xAC,0x87,0x2A,
+0xA2,0x89,0x0B,0x04,0x0B,0x0E,0x2A,0xFE,0x5B,0x4A,0x87,0xAB,0xC5,0x3F,0x22,0x05,0xDB,0x20,0x2B,0x22,0x18,0x1D,0xC9,0x2D,0xC4,0x26,0x0D,0x8D,0x8B,0x05,0xE1,0x07,
+0x9D,0x67,0x0A,0xBB,0x86,0xBD,0x9A,0x12,0xC0,0x0B,0xC1,0x04,0x0B,0x0E,0x2A,0x30,0x80,0x8B,0xC1,0x32,0x36,0x25,0x02,0x99,0x98,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x04,
+0x9D,0x99,0x81,0x8B,0x84,0x9B,0xC6,0x20,0xA9,0x85,0x05,0xDB,0xB3,0x85,0xA5,0x87,0x18,0x1D,0xCA,0x2D,0xC4,0x13,0x0F,0x8A,0x8C,0x05,0xE1,0x24,0x17,0x0A,0x05,0xFE,
+0x9C,0xF1,0xB7,0x87,0x0B,0x0E,0x0B,0x0E,0xC0,0x51,0x0B,0xFE,0x6B,0xAB,0x84,0x9B,0xA6,0x87,0xB3,0x77,0x11,0xAB,0x98,0x2A,0xA2,0x97,0x0B,0x3D,0x2A,0x12,0x0B,0xC0,
+0x2B,0x29,0x05,0xC7,0x36,0x3C,0x05,0xDA,0xAB,0x86,0xB0,0x85,0x3C,0x9C,0x7B,0x69,0xA2,0x99,0x10,0x18,0x1D,0xC6,0x98,0xE9,0xC4,0xAC,0x44,0x9C,0x97,0x05,0xE2,0xB8,
+0x73,0x9B,0x48,0x91,0xCC,0x9D,0xAA,0xA4,0x87,0x33,0x0D,0x0E,0x0B,0xC2,0x30,0x1F,0x30,0xB5,0x88,0x0D,0x12,0x0B,0x0E,0xC0,0x0B,0x04,0x0B,0x0E,0x0B,0x98,0x9A,0x29,
+0x05,0xC8,0xAC,0x87,0x9D,0x86,0x97,0x9C,0xDA,0x0F,0x22,0x99,0x9D,0x18,0x3D,0x41,0x1F,0x26,0xC0,0x36,0xA2,0x78,0x3D,0x07,0x18,0x1D,0xC0,0x98,0xE9,0xC4,0xB2,0x44,
+0x8E,0x89,0x97,0x9C,0xE1,0xA6,0x87,0xAF,0x85,0x9A,0x37,0x98,0xAA,0x05,0xC1,0x33,0x0D,0x0B,0x0E,0x0B,0x93,0x89,0x8B,0x9A,0xB9,0x98,0x0D,0x12,0xC0,0x69,0xC0,0x9D,
+0x98,0x9D,0x9A,0x04,0x0B,0xC1,0x95,0x8B,0x18,0x90,0xA9,0xC9,0x13,0x95,0x7A,0x05,0xD9,0xB3,0x85,0xA4,0x77,0x95,0xAC,0xA2,0x78,0x62,0xC5,0x41,0x1F,0x26,0xC0,0x1F,
+0x26,0x9F,0xD8,0xC3,0x13,0x1E,0x05,0xE2,0x3C,0x22,0x98,0x59,0x44,0x05,0xC2,0xFE,0x8C,0xAC,0x04,0x0B,0xC0,0x97,0x9A,0x2A,0x12,0x0B,0x34,0x11,0xC0,0x9E,0x84,0xA4,
+0x9B,0x19,0x0B,0xC1,0x11,0x20,0x05,0xCA,0x06,0x0A,0x05,0xD8,0x20,0xB0,0x85,0x3C,0x9E,0x8B,0x18,0x3D,0xC4,0xA3,0x87,0x3D,0xC4,0x26,0xC3,0xAE,0x54,0x06,0x05,0xE2,
+0x22,0x3C,0x9D,0x47,0x24,0x0A,0x05,0xC2,0xBC,0x87,0x2A,0xA2,0x89,0x0B,0xC3,0x9D,0x98,0x19,0x0B,0x0E,0xC0,0x12,0x0C,0x16,0x14,0x55,0xCB,0x3C,0x05,0xD8,0x3A,0x1E,
+0x9B,0x87,0x3D,0x18,0x3D,0xC4,0x0F,0x3D,0xC5,0x26,0xC3,0xB2,0x43,0x3F,0x05,0xE2,0x22,0x3A,0x55,0x24,0x0A,0x05,0xC3,0xB9,0x76,0x2D,0x12,0x0B,0xC6,0x53,0x11,0x36,
+0x94,0x89,0xCD,0x3C,0x05,0xD8,0xB8,0x73,0x9F,0x86,0x3D,0x18,0x3D,0xC4,0xA3,0x87,0x3D,0xC6,0x26,0xC2,0xA7,0x77,0xAB,0x64,0x88,0x8D,0x05,0xE2,0x22,0x08,0x05,0xAF,
+0x44,0x93,0xCC,0x05,0x6B,0x05,0xC2,0x02,0xFE,0xBD,0xD4,0x12,0x0B,0xC1,0x0E,0x0B,0xC0,0x93,0x89,0x29,0x14,0x05,0x17,0x05,0xCB,0x3F,0xA4,0x87,0x05,0xD7,0xB0,0x74,
+0xA8,0x87,0x97,0x9C,0x4B,0x3D,0xCE,0x26,0xC1,0x6B,0x0D,0x22,0x05,0xE2,0x3F,0x22,0x05,0xC0,0xB3,0x33,0x91,0xCC,0x0A,0x05,0xC4,0x3F,0x30,0xB5,0x88,0x12,0x69,0xC0,
+0x93,0x89,0x8B,0x9A,0x2B,0x17,0x9D,0x9A,0xCE,0xA9,0x85,0x3A,0x9A,0x89,0xD6,0x36,0xAC,0x74,0x18,0x9C,0xA9,0x18,0x3D,0xC4,0xA3,0x87,0x3D,0xC7,0x26,0xC1,0x2D,0x24,
+0x90,0x8A,0x05,0xE2,0x3C,0x9C,0x7B,0x05,0xC0,0x0C,0xFE,0x3C,0x62,0x9C,0x9A,0x9B,0x9A,0x9C,0xAB,0x9F,0x67,0xC0,0xA4,0xAA,0xA6,0x76,0xA8,0x76,0xA6,0x75,0x12,0x01,
+0x33,0x29,0x05,0xEB,0xA9,0x97,0xAF,0x75,0x9B,0x69,0x3D,0x18,0x3D,0xC4,0xA3,0x87,0x3D,0xC8,0x9D,0xC8,0xC1,0xA7,0x66,0xA8,0x74,0x17,0x05,0xE2,0x13,0x2B,0x17,0x05,
+0xB4,0x42,0xFE,0x6E,0x27,0xA3,0x86,0xC0,0x67,0x51,0xC1,0x18,0xC3,0x12,0xFE,0x09,0x81,0x0A,0x05,0xE9,0x2B,0x1E,0x22,0x3D,0xA4,0x67,0x3D,0xC4,0x0F,0x3D,0xC9,0xA0,
+0xB8,0xC0,0x13,0xA8,0x66,0x32,0x05,0xE3,0x13,0x05,0xC1,0x0C,0x0D,0xA3,0x86,0xCA,0x3E,0xFE,0x00,0xA0,0x0A,0x05,0xE8,0xB5,0x84,0x22,0x3D,0xD3,0x13,0x1D,0x5B,0xAB,
+0x74,0x94,0x89,0x05,0xE2,0x16,0xA7,0x76,0x05,0xC1,0x0C,0xFE,0x6E,0x26,0xC0,0x18,0xC4,0x1A,0x12,0xA9,0x86,0x18,0xC0,0x8A,0x9E,0xFE,0x00,0xA0,0x0A,0x05,0xE7,0x22,
+0x36,0x3C,0x3D,0xA4,0x67,0x3D,0xC4,0xA3,0x87,0x3D,0xCA,0xA0,0xB8,0x21,0xA3,0x76,0xAB,0x84,0x89,0x9D,0x05,0xDD,0xA8,0x55,0xA3,0x77,0xA4,0x77,0x48,0x06,0xA8,0x98,
+0x97,0xAB,0x9A,0x88,0x0A,0x05,0x0C,0xFE,0x6E,0x26,0xA3,0x87,0xC3,0x1A,0x18,0x99,0x9C,0xFE,0x5B,0xA9,0xA3,0x55,0x1A,0x06,0x9A,0x88,0xFE,0x01,0x60,0x05,0xC0,0x6E,
+0x05,0xAB,0x44,0x0C,0x9C,0xA9,0x69,0x24,0x31,0x99,0x9A,0x0A,0x05,0xDB,0x29,0xA4,0x77,0x95,0xAC,0x3D,0xA4,0x67,0x3D,0xC4,0x0F,0x3D,0xCB,0xA0,0xB8,0x21,0xA5,0x75,
+0xA3,0x88,0x05,0xDA,0xA5,0x87,0xAA,0x22,0xAA,0x54,0xA9,0x85,0xA8,0x75,0xA2,0x89,0x6B,0x3B,0x13,0x24,0x31,0x2E,0x9C,0x99,0xC0,0x08,0x0D,0xA3,0x86,0xC5,0x1A,0xFE,
+0x5B,0xA9,0xA0,0xA9,0xFE,0x65,0xA7,0x18,0xC0,0xFE,0x23,0x03,0xFE,0x00,0x60,0x2B,0x19,0xAE,0x53,0x25,0x0D,0x39,0x37,0x99,0xBB,0x10,0xA4,0x87,0x37,0x0A,0x05,0xD9,
+0x16,0xB2,0x74,0x3C,0xC0,0x3D,0xD4,0xA4,0x95,0xC0,0xA7,0x87,0x9F,0x75,0x05,0xD9,0x3F,0x12,0x2C,0x1A,0x51,0x18,0xC2,0x3B,0xFE,0x00,0xA0,0x0A,0x05,0xA5,0x87,0x7F,
+0x31,0xFE,0x55,0x25,0x18,0x1A,0x18,0xC3,0x1A,0xFE,0x4C,0x07,0x9D,0xEE,0xAA,0x10,0x18,0xC0,0x12,0x9C,0xAD,0xAC,0x50,0x1A,0x06,0x18,0xC1,0x8A,0x9E,0x0F,0x62,0xA5,
+0x88,0x2E,0x0F,0x05,0xD9,0xB8,0x73,0x98,0xAA,0x3D,0xA4,0x67,0x3D,0xC4,0xA3,0x87,0x3D,0xCD,0x13,0xC0,0xA8,0x66,0x97,0x97,0x05,0xD8,0x37,0x12,0xB1,0x74,0x1A,0x18,
+0xC4,0x1A,0x87,0xBF,0xFE,0x00,0x60,0x05,0x6B,0x05,0xC0,0xB7,0x10,0x39,0x18,0x1A,0x18,0xC3,0x39,0x3E,0x1C,0x18,0xC0,0x25,0x6B,0x18,0xC4,0x2C,0xFE,0x02,0x00,0x05,
+0xC0,0x3F,0xA3,0x78,0x9A,0x88,0x05,0xD7,0xB0,0x74,0xA8,0x87,0x97,0x9C,0x3D,0xD6,0x13,0xA8,0x66,0xA3,0x97,0x88,0x8D,0x05,0xD8,0x28,0xFE,0x6E,0x27,0x18,0xC6,0x1A,
+0x36,0x10,0x05,0xC2,0x31,0x0E,0x0A,0x1A,0x18,0xC4,0x12,0x0A,0x18,0xC1,0x39,0x1A,0x51,0x18,0xC3,0x3B,0x19,0x05,0xC0,0x2A,0x37,0x99,0xBB,0x05,0xD5,0x2B,0x07,0x95,
+0xAC,0x3D,0xD7,0x13,0xA7,0x87,0x04,0x17,0x05,0xD8,0x12,0x18,0xC4,0x1A,0x18,0xC2,0x3B,0x19,0x0A,0x05,0xC0,0x2B,0x1C,0x25,0x2C,0x18,0xC4,0x1A,0x18,0xC2,0x25,0x2C,
+0x18,0xC4,0x2C,0xFE,0x09,0x81,0x0A,0x05,0x32,0x2E,0x93,0xCC,0x05,0xD5,0x16,0xAC,0x75,0x3C,0x3D,0xCF,0x69,0x3C,0x36,0x42,0x9F,0xD8,0xA0,0xA6,0xA0,0xA9,0x9E,0xB6,
+0x1D,0x24,0x98,0x88,0x05,0xD8,0x32,0xFE,0x54,0xE7,0x18,0xC7,0x1A,0x18,0xC0,0xFE,0x22,0x84,0x19,0x0A,0x05,0xC0,0xB8,0x21,0x1A,0x25,0x50,0x1A,0x18,0xC4,0x1A,0x18,
+0xC0,0x2C,0x8D,0xBD,0x1A,0x51,0x18,0xC3,0x15,0x0F,0x05,0xC0,0x3F,0x37,0x99,0xBB,0x05,0xD4,0x13,0x49,0x3D,0xCB,0x16,0x26,0x1E,0x2B,0x70,0x79,0xA3,0x99,0x74,0xA1,
+0xA9,0xC1,0x7A,0x61,0x1D,0x24,0x90,0x8A,0x05,0xD8,0xA8,0x55,0x0E,0x18,0xC4,0x1A,0x18,0xC3,0x0E,0x37,0x0A,0x05,0xC0,0x2A,0xFE,0x76,0x09,0x18,0x2C,0x0E,0x18,0xC7,
+0x0E,0xFE,0x09,0x81,0xBB,0x41,0x18,0xC4,0x39,0x37,0x05,0xC1,0xAB,0x55,0x99,0xAA,0x0A,0x05,0xD3,0xB5,0x84,0x3C,0xC0,0x3D,0xC0,0x41,0xC0,0x3D,0x26,0x9F,0xD8,0x1E,
+0x2B,0x9E,0xB6,0xC0,0x35,0x25,0xA1,0xA9,0x3A,0x7A,0xC1,0x7E,0x6E,0xC1,0x29,0xC1,0x36,0xA3,0x88,0x88,0x9D,0xD9,0xA8,0x55,0x0E,0x18,0xCB,0x15,0xFE,0x00,0x60,0x05,
+0xC0,0xA5,0x88,0xFE,0x6D,0x69,0x18,0xC1,0x39,0x1A,0x18,0xC5,0x8A,0x9E,0x19,0x2A,0xFE,0x65,0xA7,0x18,0xC3,0x2C,0x06,0x05,0xC1,0x32,0x10,0x19,0x05,0xD2,0xA5,0x87,
+0x13,0x20,0x9D,0x9B,0x26,0x1E,0xA0,0xA9,0x12,0xC0,0x35,0x25,0x3A,0x61,0x66,0x29,0xC0,0xA3,0x98,0xC4,0x56,0xC0,0x05,0x51,0x29,0xC1,0xFE,0x5B,0x27,0x9F,0x86,0xFE,
+0x00,0x20,0xD9,0xA5,0x88,0x0E,0x18,0xCB,0x0E,0x06,0x96,0xCC,0x05,0xC0,0x39,0x18,0xC2,0x0E,0x18,0xC5,0xFE,0x0A,0x00,0x19,0x05,0xB8,0x21,0x1A,0x18,0xC3,0xFE,0x1A,
+0xC1,0x19,0x05,0xC1,0x10,0x19,0x0A,0x05,0xD1,0xA5,0x87,0xB4,0x85,0x35,0x25,0xA1,0xB8,0x3D,0xC0,0x7E,0x31,0x24,0x29,0x24,0x29,0x24,0x31,0x05,0xC1,0x3D,0xA2,0x87,
+0xC0,0x29,0xC0,0x05,0x0A,0x3D,0xC0,0x05,0x31,0xFE,0x73,0x67,0x95,0x7A,0x91,0x9D,0x6B,0x05,0xD7,0x2B,0x1C,0x18,0xCC,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0x0C,0xFE,
+0x43,0xE6,0xFE,0x76,0x87,0x18,0xC2,0x2C,0x9E,0x86,0x1A,0x18,0xC1,0x0E,0x37,0x05,0xC0,0x2B,0xBA,0x21,0x1A,0x18,0xC2,0x15,0x0F,0x05,0xC1,0xA5,0x88,0xA5,0x77,0x19,
+0x05,0xD1,0x32,0xB6,0x83,0xFE,0x99,0x61,0xC0,0x7A,0x3D,0xC0,0x7E,0x31,0x24,0x29,0xC2,0x05,0x6E,0xC3,0x05,0xC1,0x3D,0x0A,0x05,0x0A,0x3D,0xC0,0x22,0x8D,0x7B,0x99,
+0x9C,0xD9,0xA5,0x87,0x1C,0xAE,0x40,0x18,0xC3,0x1A,0x18,0xC5,0x39,0xFE,0x09,0x21,0x05,0xC0,0xB4,0x42,0xFE,0x6E,0x27,0x18,0xC3,0x1A,0x0E,0x18,0xC0,0x0D,0x89,0xBE,
+0x0F,0x05,0xC1,0x32,0x39,0x18,0xC2,0x8F,0xAD,0x0F,0x05,0xC2,0x3F,0x32,0x05,0xD2,0xB7,0x94,0x25,0xA1,0xA9,0x3A,0x75,0x29,0x66,0x29,0x24,0x31,0x29,0xA3,0x98,0x0A,
+0xC2,0x05,0x0A,0xC1,0x05,0x3D,0xC0,0x29,0xC0,0x05,0xC0,0x0A,0xFE,0x6B,0x85,0xFE,0x08,0x20,0x5A,0xDA,0x2C,0x1A,0x18,0xCC,0x13,0x19,0x05,0xAF,0x54,0xFE,0x76,0x09,
+0x18,0xC5,0x97,0x9A,0xA2,0x89,0x15,0xFE,0x01,0x00,0x05,0xC3,0x3F,0x1C,0x18,0xC1,0x39,0x0F,0x05,0xC2,0x2B,0xA4,0x98,0x0F,0x05,0x0C,0x05,0xCF,0xB5,0x84,0xFE,0x8A,
+0x21,0xFE,0xA9,0x40,0x29,0x24,0x29,0xC2,0x3D,0xC0,0x7E,0x31,0xA3,0x88,0xC1,0x05,0x0A,0xC1,0x29,0xC4,0x3D,0x31,0xFE,0x52,0xE3,0xFE,0x00,0x20,0xDB,0x1D,0x1F,0x18,
+0xC3,0x1A,0x18,0xC6,0x3B,0xFE,0x00,0xA0,0x9D,0xAA,0x2E,0xFE,0x6E,0x27,0x18,0xC6,0x99,0x9C,0x3B,0x28,0x05,0xC4,0x2A,0xBB,0x42,0x18,0xC0,0x0E,0xFE,0x00,0x60,0x05,
+0xC3,0x10,0x9D,0x99,0x0A,0x05,0xD0,0xB0,0x95,0xA5,0xE6,0xFE,0xA9,0x61,0xC0,0x7E,0x31,0x24,0x3D,0xC0,0x05,0x31,0x24,0xA5,0x87,0xC1,0x05,0x0A,0xC2,0x29,0xC1,0x3D,
+0xC0,0x05,0x31,0x24,0xFE,0x3A,0x01,0x91,0x9F,0xDB,0xB8,0x21,0x1A,0x18,0xCC,0x39,0x28,0x05,0xAF,0x33,0x0D,0x18,0xC8,0x39,0x8A,0xCE,0x19,0x05,0xC3,0xB3,0x33,0xFE,
+0x65,0xA7,0x18,0x0E,0x37,0x05,0xC3,0x2B,0x2A,0x0F,0x05,0x6B,0x05,0xCE,0x3F,0xB4,0x83,0xFE,0x99,0x61,0xC0,0x3A,0x3D,0x29,0xC3,0x3D,0x31,0x0A,0xC1,0x66,0x0A,0xC1,
+0x05,0xC1,0x3D,0x29,0xC0,0x66,0x29,0xFE,0x19,0x00,0x99,0x9C,0xDB,0x38,0xFE,0x76,0x09,0x18,0xCC,0x99,0x9C,0xFE,0x02,0x00,0x05,0xAF,0x33,0x0D,0x18,0xC9,0x2C,0x3B,
+0x28,0x0F,0x05,0x0C,0x05,0xC0,0xB7,0x10,0xB3,0x85,0x9C,0x78,0xFE,0x00,0xA0,0x9D,0xAA,0x05,0xC2,0x0A,0x2E,0x99,0xAA,0x0A,0x05,0xD0,0xB3,0x84,0xA6,0xC6,0x33,0x7B,
+0x7E,0x29,0xC0,0x66,0x29,0xC2,0x3D,0x65,0xA3,0x88,0x3D,0xC0,0x05,0x31,0x0A,0x3D,0xC0,0x05,0x31,0x24,0x29,0x3D,0xFE,0x08,0x80,0x9D,0x9A,0xDB,0xAF,0x54,0x36,0x18,
+0xCC,0x9D,0x9A,0xFE,0x0A,0xA0,0x05,0x2E,0x0D,0x18,0xC3,0x1A,0x18,0xC5,0x0E,0x3E,0x19,0x05,0xC2,0xB4,0x42,0x15,0x0F,0x05,0xC4,0xAB,0x55,0x2E,0x0F,0x05,0xD0,0x2B,
+0xB5,0xA4,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0x3D,0xC0,0x7E,0xC1,0x29,0xC0,0x24,0x29,0xC0,0x05,0x0A,0x3D,0xC0,0x05,0x31,0x24,0x29,0x3D,0x29,0xC0,0x24,0x29,0xFE,0x00,
+0x20,0xDC,0x10,0xBF,0x40,0x18,0xCC,0x06,0x3B,0x19,0x2E,0x0D,0x18,0xCB,0x06,0xC0,0x92,0x9B,0x13,0x19,0x05,0xC0,0xA3,0x87,0xAC,0x55,0x37,0x99,0xBB,0x05,0xC4,0x31,
+0x37,0x0A,0x05,0xD0,0xB4,0x72,0xA5,0xB7,0xFE,0x89,0x40,0xA1,0xA9,0xA1,0xB8,0x6E,0x52,0x0A,0xC0,0x29,0xC0,0x05,0x29,0xC0,0x05,0x0A,0xC2,0x29,0xC1,0x3D,0xC1,0x29,
+0xFE,0x00,0x20,0xDC,0xA5,0x88,0x0E,0x18,0xCA,0x06,0x18,0xC0,0x0E,0x19,0xAF,0x55,0x0D,0x18,0xCE,0x99,0x9C,0x3B,0x28,0x9B,0xBB,0x05,0x32,0x2E,0x99,0xAA,0x99,0xBB,
+0x05,0xC2,0x0A,0x10,0x31,0x0A,0x05,0xD0,0x2B,0x1E,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0x3D,0x29,0xA3,0x98,0x6E,0x3D,0x29,0x05,0x0A,0x29,0xC0,0x05,0xC3,0x3D,0x29,0xC3,
+0x3D,0xFE,0x00,0x21,0x69,0xDC,0xB8,0x10,0x0D,0x18,0xCA,0x06,0x18,0x99,0x9B,0xFE,0x01,0x60,0xA9,0x88,0x06,0x18,0xCB,0x06,0x18,0xC2,0x39,0xFE,0x09,0x81,0x96,0xCC,
+0x05,0x2B,0x2A,0x99,0x9B,0x0A,0x05,0xC2,0x0A,0x38,0x93,0xBB,0x05,0x6B,0x05,0xCF,0xB0,0x74,0x1C,0xFE,0x89,0x40,0xA1,0xA9,0x3A,0x31,0x29,0xC2,0x3D,0x31,0xC0,0xA2,
+0x88,0x6E,0xC1,0x05,0x3D,0x29,0xC0,0x24,0x29,0xC0,0x0A,0x0C,0x69,0xDC,0xB3,0x33,0xFE,0x76,0x09,0x18,0xCC,0x0D,0xFE,0x02,0x00,0xA9,0xA9,0x1A,0x18,0xCC,0x9D,0x9A,
+0x18,0xC2,0x0E,0x10,0x05,0xC0,0x2B,0x2A,0x99,0x9B,0x05,0xC3,0x2E,0x9C,0x99,0x0F,0x05,0x6B,0x05,0xCF,0x22,0xFE,0xA1,0xC1,0x9E,0xB9,0x0A,0x3D,0xC0,0x29,0xC2,0x3D,
+0x31,0x0A,0x3D,0x0A,0xC1,0x05,0x3D,0x29,0xC0,0x05,0x0A,0xC0,0x0C,0x69,0xDC,0x37,0x0E,0x18,0xCA,0x06,0x18,0xC0,0x3E,0x1D,0x1F,0x18,0xCB,0x06,0x18,0xC4,0x3B,0xFE,
+0x00,0xA0,0x9D,0xAA,0x05,0xA5,0x88,0x2E,0x37,0x05,0xC2,0x2A,0xA5,0x34,0x9F,0xCD,0x9C,0xA9,0x9C,0x78,0x0A,0x05,0xCE,0xB3,0x84,0x04,0x3D,0x7E,0xC0,0x29,0x24,0x29,
+0x24,0xA2,0x87,0x29,0xC0,0x05,0x6E,0xC1,0x05,0xC1,0x3D,0x29,0xC0,0x05,0x0A,0xFE,0x00,0x20,0xDD,0x2B,0xBA,0x21,0x1A,0x18,0xCC,0x8A,0x9E,0x39,0x18,0xCC,0x9D,0x9A,
+0x18,0xC4,0x0E,0xFE,0x09,0x81,0x96,0xCC,0x05,0xC0,0x3F,0x2E,0x0F,0x06,0x0C,0x2E,0x10,0x06,0x0A,0xA6,0x55,0x2E,0x10,0x0F,0x05,0xCD,0xB0,0x74,0x1C,0x33,0x3D,0xC0,
+0x51,0xC3,0x3D,0x31,0xC0,0xA2,0x88,0xC1,0x3D,0xA2,0x87,0x05,0x29,0xC0,0x24,0x29,0x05,0xFE,0x00,0x20,0xDE,0xB8,0x21,0x1A,0x18,0xCC,0x39,0xA7,0x85,0x18,0xCA,0x9D,
+0x9A,0x18,0xC6,0x97,0x9A,0xFE,0x01,0x60,0x05,0xC1,0x2B,0x0C,0x98,0x99,0x9D,0xAA,0x06,0xA4,0x77,0x10,0xC0,0x37,0x06,0x19,0xA6,0x88,0x10,0x19,0x05,0xCC,0x3C,0xAC,
+0x95,0x09,0x29,0xC0,0x66,0x3D,0xC0,0x7E,0x31,0x24,0x29,0x3D,0x29,0xA4,0x87,0xC1,0x05,0x3D,0x29,0xC2,0x05,0xFE,0x00,0x20,0xDE,0x2A,0x36,0x18,0xCA,0x9D,0x9A,0x18,
+0x25,0x36,0x18,0xCD,0x06,0x18,0xC3,0x12,0x19,0x9D,0xAA,0x05,0xC0,0x15,0x19,0x05,0xC3,0x2B,0xC0,0x7F,0x10,0xC0,0x37,0x10,0x19,0x05,0xCB,0xA9,0x85,0x22,0x09,0x29,
+0x31,0x29,0x24,0x29,0xA3,0x98,0x6E,0x3D,0xC0,0x29,0x05,0x0A,0x3D,0x0A,0xC2,0x05,0x3D,0x29,0xC0,0xFE,0x00,0x20,0xDE,0x37,0xBE,0x30,0x18,0xCC,0x39,0x36,0x18,0xCE,
+0x06,0x18,0xC2,0xFE,0x23,0x41,0x0F,0x05,0xC0,0x37,0xA3,0x77,0x19,0x05,0xC0,0x3F,0xA3,0x78,0x03,0x37,0x06,0x19,0x05,0x10,0x19,0xAB,0x55,0x92,0xDD,0x05,0xCB,0x3F,
+0x22,0x09,0x29,0xA3,0x98,0xC0,0x29,0x66,0x3D,0xC0,0x05,0x31,0xA3,0x88,0x3D,0x05,0xC1,0x3D,0x0A,0x05,0x29,0x05,0x0A,0x3D,0xFE,0x00,0x20,0xDF,0x1D,0x1F,0x18,0xCB,
+0x99,0x9C,0x9E,0x86,0x1A,0x18,0xCD,0x9D,0x9A,0x18,0xC1,0x2C,0xFE,0x09,0x81,0x96,0xCC,0x05,0x2B,0x10,0x19,0x05,0xC1,0x7F,0x2B,0x3A,0x37,0x06,0x10,0xC0,0xA4,0x66,
+0x10,0xC0,0x19,0x05,0xC1,0x14,0x05,0xC7,0xB0,0x74,0xA9,0xD6,0x09,0x9E,0xB9,0xC2,0x3D,0x29,0xC0,0x05,0x3D,0xC0,0x05,0x31,0xA3,0x88,0x3D,0x05,0xC1,0x29,0x66,0x3D,
+0x05,0xFE,0x00,0x20,0xDF,0x2A,0x0D,0x18,0xCC,0x94,0x8B,0x18,0xCA,0x9D,0x9A,0x18,0xC5,0x12,0x19,0x05,0xC0,0x15,0x19,0x05,0xC9,0x10,0xA4,0x87,0x49,0x92,0xDD,0x05,
+0xCB,0x07,0x1C,0x33,0x3D,0xA2,0x87,0xC1,0x66,0x3D,0x29,0xC1,0x3D,0xC0,0x05,0x51,0x0A,0x3D,0x05,0xC0,0x29,0xC0,0x05,0xC0,0xFE,0x00,0x20,0xDF,0xA5,0x88,0x0E,0x18,
+0xCC,0x92,0x9B,0x1F,0x18,0xCB,0x06,0x18,0xC3,0x13,0x19,0x05,0xC0,0x15,0x19,0x05,0xC3,0x15,0x10,0xC1,0x37,0x10,0x37,0x2E,0x13,0x19,0x05,0xC0,0x17,0x05,0xC7,0x3A,
+0x22,0x04,0x3D,0x7E,0x0A,0xC1,0x05,0x3D,0x29,0xC1,0x3D,0xC1,0x05,0x31,0x0A,0x3D,0x05,0x29,0xC0,0x66,0x29,0xFE,0x00,0x20,0xE0,0x1D,0x1A,0x06,0x18,0xCA,0x92,0x9B,
+0x18,0x1A,0x18,0xCD,0x06,0x18,0x3B,0x19,0x05,0x6E,0x2E,0x37,0x0A,0x05,0xC4,0x0F,0x05,0x6B,0x05,0x2B,0x16,0xAA,0x24,0xA1,0x54,0x05,0xCB,0xB0,0x95,0x1C,0x33,0x3D,
+0xA2,0x87,0x66,0xC1,0x3D,0x29,0xC0,0x05,0x3D,0x31,0x29,0x66,0x3D,0xC0,0x05,0xC3,0x3D,0x29,0xFE,0x00,0x20,0xE0,0x2E,0x0D,0x18,0xCB,0x35,0x0D,0x18,0xCE,0x06,0x0E,
+0x3E,0x37,0xA3,0x77,0xA4,0x77,0x0C,0x06,0x55,0x28,0x05,0xC6,0x2B,0xC0,0x17,0x06,0x0C,0x19,0x9D,0xAA,0x05,0xC8,0x3A,0xB5,0x83,0x04,0x3D,0x7E,0x6E,0xC2,0x05,0x3D,
+0x29,0xC1,0x3D,0xC0,0x05,0x0A,0x3D,0x0A,0xC0,0x05,0xC1,0x3D,0x29,0xFE,0x00,0x20,0xE0,0x32,0x0E,0x1F,0x18,0xCA,0x99,0x9C,0x0E,0x36,0x2C,0xC3,0x9E,0x86,0x0E,0x35,
+0xC1,0x61,0xC1,0x9D,0x89,0x3B,0x99,0xAD,0x98,0x99,0x2E,0x13,0x2E,0xC0,0x13,0x2E,0xC0,0x13,0x2E,0xC0,0x59,0x28,0x10,0xA4,0x87,0x24,0x10,0x31,0x24,0x10,0x0F,0x2B,
+0x15,0x9A,0x88,0x05,0xC8,0xB0,0x74,0x1C,0x09,0x9F,0xB9,0xC1,0x66,0x0A,0xC1,0x05,0xC0,0x0A,0x3D,0x0A,0xC0,0x05,0x3D,0xC0,0x05,0xC4,0x3D,0xFE,0x00,0x20,0xE1,0xB8,
+0x10,0x0D,0x18,0xCA,0x0D,0x08,0xA8,0x86,0x25,0x0A,0x25,0x2C,0xC0,0x0D,0xC4,0x1A,0xA1,0x8A,0x1F,0x0D,0x3E,0x19,0x05,0xC7,0xA8,0x55,0xA3,0x77,0x24,0x0C,0x06,0x96,
+0xCC,0x05,0x2B,0x10,0x2E,0x10,0x06,0xC0,0x24,0x0F,0x05,0xC6,0x2B,0xB6,0x83,0x04,0xFE,0xB1,0x81,0x6E,0x3D,0x0A,0xC0,0x9D,0x99,0x05,0x0A,0xC2,0x05,0x0A,0xC1,0x05,
+0xC0,0x0A,0xC1,0x05,0x0A,0xC0,0x31,0xAF,0x77,0xAA,0x78,0xA3,0x88,0xC2,0x28,0x01,0xC0,0x99,0x99,0x9D,0x99,0x99,0x99,0x00,0x98,0xA9,0x26,0x3D,0xA5,0x67,0x3D,0xA3,
+0x68,0x1D,0xC1,0x3D,0xAF,0x66,0xC2,0x67,0xC0,0x01,0xCA,0x95,0x99,0xAA,0x78,0x01,0xDC,0x9C,0x88,0x07,0x3D,0x10,0x1D,0xA6,0x95,0xA2,0x98,0x55,0xA3,0x99,0x6F,0xC1,
+0x3A,0xC1,0x3C,0x01,0xC5,0x27,0x28,0x01,0xDA,0x19,0x18,0x26,0x3D,0x1D,0xC1,0x90,0xBA,0x55,0xCD,0x6E,0xA4,0x87,0x7F,0x6E,0xA4,0x87,0xA9,0x85,0xA1,0x9A,0x0F,0x1E,
+0xA4,0x77,0x9F,0x9B,0x01,0x69,0xC0,0x01,0xC1,0x00,0xC0,0xA6,0x88,0xC0,0x01,0xD7,0x19,0x27,0x26,0x3D,0x01,0xC2,0x39,0x01,0xC1,0x00,0x9A,0x98,0x01,0xC0,0x00,0x96,
+0x98,0x10,0x39,0x18,0x1F,0x10,0x1D,0xAC,0x93,0x47,0x3A,0x3C,0xC0,0x8F,0xA6,0xAE,0x77,0x35,0x3A,0xC0,0x3C,0x07,0x89,0xAD,0xFD,0xC4,0xB3,0x84,0x1E,0x9A,0x89,0x98,
+0x89,0x14,0xAD,0x85,0x0A,0x05,0xD3,0x14,0x05,0xF3,0x2B,0x07,0xA4,0x96,0x8E,0x8B,0x97,0x9C,0xC8,0xFE,0xAD,0x8E,0x1E,0x90,0x9B,0x05,0xC5,0xA6,0x87,0x0F,0xFE,0xEF,
+0x98,0xA3,0x88,0x9A,0x9A,0x3D,0x36,0x90,0x8B,0x51,0x05,0xC2,0xB0,0x95,0xA7,0x65,0x20,0x05,0xE8,0x16,0xB2,0x74,0x22,0x18,0x13,0xFE,0xD6,0xF5,0x04,0x6B,0x04,0x34,
+0x8C,0x99,0x3C,0x05,0xC3,0x1E,0x3D,0x2B,0x3F,0x05,0xE7,0x3C,0x35,0x22,0x35,0x8A,0x9B,0x05,0xD5,0x20,0xFE,0xCE,0xB3,0x0B,0x04,0x0B,0x04,0x0B,0x8E,0x99,0x89,0x88,
+0x90,0x8B,0x05,0xC1,0x16,0x3D,0xAF,0x89,0x3D,0x36,0x17,0x05,0x0A,0x05,0xE4,0x22,0xAA,0x74,0x13,0x04,0xC0,0x0B,0xC0,0x7A,0x04,0x34,0x89,0x98,0x3F,0x05,0xC1,0x36,
+0x0E,0x0B,0x04,0x0B,0xC1,0x04,0x9A,0x9A,0x8C,0x76,0x20,0x05,0xC0,0x3A,0xAB,0x58,0x05,0x2B,0xFE,0x9D,0x2D,0x04,0x0E,0x0B,0xC0,0x34,0x8A,0x89,0x31,0x05,0xE4,0xB0,
+0x74,0x27,0x29,0x1D,0xCD,0x26,0x69,0xC0,0x20,0x05,0x0F,0x19,0x04,0x9D,0x99,0x04,0x0B,0x15,0x86,0x8A,0x8B,0x99,0x05,0xE4,0x36,0x35,0x18,0x1D,0x9D,0xA9,0x1D,0xC7,
+0x26,0x69,0x26,0xA2,0x98,0xA4,0x88,0xC0,0xAA,0x67,0x01,0xCE,0x69,0x9C,0x96,0x8B,0x9C,0x05,0xD7,0xFE,0x7C,0x2B,0x04,0x0B,0xC0,0x0E,0xC1,0x0B,0xC3,0x2B,0x21,0x31,
+0xA2,0x88,0xFE,0xB5,0xB2,0x19,0x95,0x97,0x0B,0xC1,0x15,0x3C,0x01,0xC0,0x3A,0x94,0xA6,0x91,0x9D,0x6B,0x05,0xD6,0x32,0xFE,0xF7,0xB9,0x0B,0x04,0x0B,0x0E,0x2B,0x96,
+0x79,0x99,0x9A,0x9C,0x99,0x11,0x0B,0xA2,0x8A,0xC0,0x89,0x98,0x89,0x9A,0xB8,0x74,0x1F,0xB6,0x9A,0xA8,0x76,0xC2,0x9D,0x98,0x8D,0x87,0x20,0x95,0x9B,0xE3,0x06,0x27,
+0x29,0x1D,0xC1,0x0B,0x04,0x97,0x9B,0x33,0x89,0x89,0x14,0x05,0xC3,0xA5,0x87,0xA9,0x97,0xA5,0x87,0x9C,0x88,0xFE,0xBE,0x31,0x0B,0xC2,0x04,0x0B,0x0E,0x21,0x06,0x92,
+0x8B,0x05,0xE2,0x1E,0xB4,0x9A,0x8C,0x68,0x2B,0x05,0xC0,0xA6,0x87,0x25,0xAC,0x87,0x33,0xC1,0x11,0xC1,0x22,0xBE,0x78,0xAD,0x98,0x04,0x0B,0x0E,0x0B,0x04,0x0B,0x9D,
+0x98,0x21,0x3C,0x17,0x05,0xE1,0x3F,0x12,0x05,0xD9,0xB3,0x85,0x33,0x3D,0xA5,0x88,0xA4,0x88,0x0E,0x0B,0x04,0x0B,0x0E,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0x2B,0x91,0x9A,
+0x0B,0xC4,0x04,0x0E,0x2B,0x87,0x99,0x96,0x78,0x91,0xAC,0x05,0xE1,0x3A,0xB5,0x84,0x0F,0x25,0xCA,0x9C,0x88,0xC0,0x26,0x0B,0x12,0xC0,0x0B,0xC3,0x04,0x0B,0x0E,0x0B,
+0xC1,0x04,0x97,0x9B,0x04,0x0B,0x0E,0x0B,0x0E,0xC0,0x0B,0x04,0x82,0x9B,0x05,0x3C,0x24,0x8A,0x8D,0x05,0x0A,0x05,0xD9,0xB5,0x84,0x19,0x0B,0x0E,0xC0,0x0B,0x34,0x11,
+0x19,0x04,0x0B,0xC0,0x8A,0x86,0x3C,0x0A,0x3F,0x05,0xDA,0x13,0x3E,0xC0,0x9B,0x7B,0x95,0xBA,0x3A,0x2B,0xB4,0x77,0x2D,0xAA,0x97,0x7E,0x0B,0xC5,0x04,0x0B,0x0E,0x0B,
+0xC0,0x9D,0x98,0x92,0x98,0xAF,0x89,0x80,0x7A,0x88,0x79,0xA1,0xAA,0x11,0x0D,0x12,0x0B,0x04,0x0B,0x0E,0x0B,0xC4,0x04,0x31,0x2B,0x04,0x0E,0x0B,0x04,0x0B,0x0E,0x8E,
+0x89,0x36,0x8B,0xAD,0x5A,0xE0,0x13,0x27,0xFE,0x31,0xE6,0x3D,0xC5,0x13,0x39,0x05,0xDB,0xB3,0x85,0x0C,0xA8,0x8B,0xC1,0x93,0x74,0x87,0x35,0x9D,0x98,0x3F,0x51,0x33,
+0x0E,0x12,0x69,0x0E,0x0B,0xC4,0x04,0x34,0x50,0x04,0x0B,0xC0,0x0E,0x93,0x79,0x86,0x7B,0x07,0x1D,0x0C,0x31,0xC0,0x54,0xFE,0x5B,0xA9,0x9D,0x02,0x96,0xDC,0x95,0xDE,
+0x0A,0x2B,0x33,0x0D,0x12,0x69,0x0E,0xC0,0x0B,0xC2,0x04,0x92,0x87,0x0B,0xC1,0x04,0x33,0x2B,0x17,0xA5,0x67,0xA7,0xBA,0x11,0x8D,0x87,0x05,0xFE,0xE7,0x38,0xA6,0x8C,
+0xC0,0x9B,0x87,0x28,0x0C,0x91,0xFF,0x05,0xC0,0x20,0x9C,0x7A,0x21,0x0D,0x0B,0x04,0x0B,0xC2,0x0E,0x34,0xC0,0x0B,0xC0,0x9D,0x98,0x81,0x9D,0x84,0x99,0x05,0x17,0xB2,
+0x21,0xA9,0x77,0x2A,0x11,0xFE,0x21,0x41,0xAF,0x87,0x0A,0x67,0x69,0xDA,0x29,0xFE,0xDE,0xF8,0x31,0xC0,0x33,0x28,0xA1,0x45,0x96,0xDC,0x95,0xDE,0x32,0xB2,0x10,0x28,
+0x25,0x2D,0x0D,0x15,0x0B,0x04,0x0B,0x0E,0x0B,0x92,0x86,0x0B,0xC0,0x2B,0x06,0x05,0xDC,0x29,0xFE,0xDE,0xF8,0xA8,0x8B,0xC0,0x1B,0x8B,0x45,0x91,0x42,0xC0,0x19,0x28,
+0x12,0x11,0xAB,0x98,0x87,0x89,0x2B,0x0B,0xC0,0x0E,0x0B,0x0E,0x9A,0x89,0x9C,0x75,0x0B,0xC0,0x30,0x0C,0x31,0xC0,0x33,0x30,0x28,0xC1,0x23,0x33,0xA3,0x87,0x2D,0x11,
+0x0E,0x0B,0x0E,0x0B,0x0E,0x19,0xA6,0x88,0xA4,0x8B,0x88,0x9A,0xA7,0x98,0xC0,0x28,0xA1,0x45,0x9C,0xCA,0xC0,0xA4,0x66,0x36,0xBB,0x86,0x21,0x33,0x37,0xA9,0x88,0xC0,
+0x37,0x11,0x21,0x2D,0x9E,0x86,0x37,0x11,0x33,0xB8,0x75,0xC1,0x0E,0xC0,0x31,0x0B,0x3D,0x11,0xB4,0x9B,0x05,0x21,0x92,0x13,0x9B,0x76,0x08,0xB1,0xAA,0x3D,0x33,0x3D,
+0x2B,0x87,0x99,0x82,0x8B,0x9C,0x8A,0xDF,0xA9,0x97,0x27,0x96,0x9C,0x34,0x0B,0xC0,0x0C,0x2D,0x9E,0x86,0x21,0xC0,0x37,0x2D,0x0C,0xC0,0xA8,0x76,0xC0,0x0E,0x0B,0x0E,
+0xC0,0x3A,0x94,0x76,0x0B,0x9A,0x99,0x33,0x37,0x0C,0xC0,0x2D,0x37,0x11,0xC1,0xAF,0x9A,0xA5,0x96,0x0E,0x31,0x20,0x05,0xDF,0xA5,0x87,0x24,0x0E,0x0B,0xC0,0x0E,0x0B,
+0xC7,0x0E,0x0B,0xC1,0x9D,0x98,0x99,0x87,0x0B,0xC0,0x04,0x9A,0x9A,0x2D,0x9E,0x86,0xC0,0x37,0x3D,0xA9,0x87,0xC0,0x0E,0xC0,0x3A,0x0B,0x04,0x0B,0x0E,0x0B,0xC5,0x04,
+0x2B,0x99,0x87,0x0B,0xC0,0x0E,0xC0,0x3A,0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x2B,0x82,0x78,0x1F,0x9C,0x9A,0x05,0xDE,0x1E,0x3F,0x07,0x05,0xDF,0x0F,0x22,0x0E,
+0x9C,0x76,0x19,0x0B,0xC0,0x04,0x0E,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC1,0x21,0x08,0x05,0xB5,0x84,0x90,0x8B,0x0A,0x05,0xC0,0x29,0x9C,0x87,0x05,0x6B,0x05,0xDC,0x1E,
+0x97,0xA9,0x05,0xE0,0x0F,0xFE,0xEF,0x98,0x0B,0x93,0x89,0x15,0xA4,0x8A,0x0E,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x88,0x9B,0x05,0xC2,0xAC,0x87,0x22,0x05,0xDD,0xAE,0x85,
+0x24,0x20,0xA2,0x8A,0x25,0xA0,0xA6,0x1E,0x1F,0x05,0xE0,0xFE,0x7C,0x2B,0x04,0x0B,0xC0,0x04,0x0B,0xC9,0x04,0x0B,0xC5,0x0E,0x0B,0xC2,0x04,0x0B,0xFE,0x73,0xAD,0x05,
+0xC3,0x20,0x22,0x05,0xDC,0xA5,0x87,0x24,0x95,0xAC,0xA1,0x5A,0xC3,0x26,0xC0,0x61,0x26,0x69,0xA2,0x99,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,0x04,0x0B,0x9A,0x99,
+0x21,0x33,0x2D,0x0D,0x0B,0x0E,0x0B,0x04,0x0B,0x0E,0x0B,0xC0,0x21,0x05,0xC4,0x3F,0x22,0x05,0xDC,0x3C,0x24,0x18,0x1D,0xC6,0x10,0x18,0x3D,0x39,0x08,0x05,0xE0,0x36,
+0x07,0xBA,0x88,0x0E,0x5A,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,0x98,0x9A,0x30,0x1F,0x05,0xC0,0x3F,0x33,0x0D,0x0B,0x04,0x0B,0xC2,0x0C,0xFE,0x3A,0x06,0x14,0x05,
+0xC3,0x3F,0x22,0x05,0xDC,0xB5,0x84,0xC0,0x1D,0xA3,0x99,0x19,0x04,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC3,0x11,0x1F,0x05,0x08,0x05,0xC1,0xAC,0x87,0x2A,0xA2,0x89,0x0B,
+0x04,0x0B,0x0E,0x2A,0xFE,0x5B,0x4A,0x87,0xAB,0xC5,0x3F,0x22,0x05,0xDB,0x20,0xB0,0x85,0x22,0x1D,0xC7,0x0A,0xBB,0x86,0xBD,0x9A,0xA5,0x86,0xC0,0x0B,0xC1,0x04,0x0B,
+0x0E,0x2A,0x30,0x80,0x8B,0xC1,0x32,0x36,0x25,0x02,0x99,0x98,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x0E,0x9D,0x88,0x81,0x8B,0x84,0x9B,0xC6,0xA9,0x97,0xAB,0x74,0x05,0xDB,
+0xB3,0x85,0x39,0x18,0x1D,0xC7,0x0A,0x08,0xFE,0x9C,0xF1,0x12,0x0B,0xC1,0x0E,0xC0,0x51,0x0B,0xFE,0x6B,0xAB,0x84,0x9B,0xA6,0x87,0xB3,0x77,0x11,0xAB,0x98,0x2A,0xA2,
+0x97,0x0B,0x3D,0x2A,0x12,0x0B,0xC0,0x2B,0x29,0x05,0xC7,0x36,0x3C,0x05,0xDA,0xAB,0x86,0x24,0x3C,0x26,0x1F,0xA2,0x99,0x10,0x1D,0xC4,0x93,0x98,0x05,0xA5,0x87,0x33,
+0x0D,0x0E,0x0B,0xC2,0x30,0x1F,0x30,0xB5,0x88,0x0D,0x12,0x0B,0x0E,0x0B,0xC0,0x04,0x0B,0xC1,0x0C,0x29,0x05,0xC8,0x36,0x9D,0x86,0x97,0x9C,0xDA,0xB8,0x73,0x22,0x99,
+0x9D,0x18,0x3D,0x26,0x1F,0x26,0xC1,0xA4,0x87,0x10,0x1D,0x96,0x76,0x05,0xC1,0x33,0x0D,0x0B,0x0E,0x0B,0x93,0x89,0x8B,0x99,0xB9,0x99,0x0D,0x12,0xC0,0x69,0xC0,0x9D,
+0x98,0x9D,0x9A,0x0B,0xC2,0x2D,0x18,0x05,0xC9,0x13,0x95,0x7A,0x05,0xD9,0xB3,0x85,0xA4,0x77,0x36,0xA2,0x78,0x62,0xC2,0x3C,0x3D,0xC0,0x26,0x1F,0x26,0xA0,0x43,0x05,
+0xC2,0xFE,0x8C,0xAC,0x04,0x0B,0xC0,0x34,0x2A,0x12,0xC0,0x34,0x11,0x21,0x9C,0x75,0xA4,0x9B,0x2A,0x0B,0xC1,0x11,0x20,0x05,0xCA,0x06,0x0A,0x05,0xD8,0x20,0x35,0x3C,
+0x3D,0x18,0x3D,0xC4,0xA3,0x87,0x3D,0xC1,0xA5,0x93,0x05,0xE2,0x22,0x3C,0x9D,0x47,0x7B,0x05,0xC3,0xBC,0x87,0x2A,0x0B,0xC4,0x9D,0x98,0x19,0x0B,0x0E,0xC0,0x0B,0xFE,
+0x19,0x00,0x53,0xAA,0x34,0x92,0xDD,0x05,0xC3,0xB9,0x76,0x2D,0x12,0x0B,0xC6,0x53,0x11,0x36,0x94,0x89,0xCC,0x14,0x3C,0x05,0xD8,0xB8,0x73,0x9F,0x86,0x3D,0xC0,0x1E,
+0x17,0x05,0xE2,0xB5,0x84,0x08,0x0A,0x24,0x93,0xDD,0x05,0x6B,0x05,0xC2,0x02,0xFE,0xBD,0xD4,0x12,0x0B,0xC1,0x0E,0x0B,0xC0,0x93,0x89,0x29,0x14,0x05,0x17,0x05,0xCB,
+0x3F,0x20,0x05,0xD7,0xB0,0x74,0xA8,0x87,0x97,0x9C,0x3D,0x9D,0xC8,0xAE,0x54,0x9D,0x77,0xA3,0x7D,0x17,0x05,0xEA,0xA9,0x97,0xAF,0x75,0x9B,0x69,0x3D,0x3C,0x96,0x89,
+0x17,0x05,0xB4,0x42,0xFE,0x6E,0x27,0xA3,0x86,0xC0,0x67,0x51,0xC1,0x18,0xC3,0x95,0xAD,0x14,0x0A,0x05,0xE8,0x36,0xC0,0x0D,0xFE,0x52,0x26,0xC0,0x35,0x31,0x05,0xDD,
+0xA8,0x55,0xA3,0x77,0x24,0x58,0x06,0xA5,0xC9,0x9A,0x7A,0x9A,0x88,0x0A,0x05,0xB3,0x33,0xFE,0x6E,0x26,0x18,0xC3,0x1A,0x18,0x99,0x9C,0xFE,0x5B,0xA9,0xC0,0x1A,0x06,
+0x9A,0x88,0xFE,0x01,0x60,0x05,0xC0,0x6E,0x08,0xAB,0x34,0x0C,0x9C,0xA9,0x5A,0x24,0x2E,0x99,0xAA,0x05,0xC0,0x28,0x13,0xAA,0x54,0xA9,0x85,0xA8,0x75,0xA2,0x89,0x2C,
+0x92,0xAB,0x13,0x24,0x31,0x24,0xC0,0x10,0xAA,0x53,0x0D,0x18,0xC5,0x1A,0xFE,0x5B,0xA9,0x3E,0xFE,0x65,0xA7,0x18,0xC0,0xFE,0x23,0x03,0xFE,0x00,0x60,0x2B,0x19,0xAE,
+0x53,0x25,0x0D,0x39,0x37,0x99,0xBB,0xA9,0x75,0x10,0x12,0x2C,0x1A,0x18,0xC3,0x3B,0xFE,0x00,0xA0,0x0A,0x05,0xC0,0xA6,0x87,0xA9,0x55,0x0E,0x18,0x1A,0x18,0xC3,0x1A,
+0xFE,0x4C,0x07,0x9D,0xEE,0xAA,0x10,0x18,0xC0,0x12,0x9C,0xAD,0xAC,0x50,0x1A,0x51,0x18,0xC1,0x8A,0x9E,0x0F,0x62,0x1A,0xC0,0x18,0xC4,0x1A,0x87,0xBF,0x0F,0x05,0x6B,
+0x05,0xC0,0xB7,0x10,0x0A,0x18,0x1A,0x18,0xC3,0x39,0xFE,0x5B,0x6C,0x1C,0x18,0xC0,0x25,0x6B,0x18,0xC4,0x2C,0xFE,0x02,0x00,0x05,0xC0,0x3F,0xA3,0x78,0x05,0xD8,0xAE,
+0x85,0xAA,0x76,0x98,0x89,0x18,0xC6,0x1A,0x36,0x10,0x92,0xFF,0x05,0xC1,0x31,0x0E,0xA2,0x75,0x1A,0x18,0xC4,0x12,0x0A,0x18,0xC1,0x39,0x18,0xC5,0x3B,0x05,0xC1,0xAF,
+0x53,0x37,0x05,0xD6,0x2B,0xB6,0x84,0x91,0x9D,0x3D,0x05,0xD9,0x12,0xB1,0x75,0x18,0xC3,0x1A,0x18,0xC2,0x13,0xFE,0x4A,0x43,0x05,0xD8,0xA5,0x88,0xFE,0x54,0xE7,0x18,
+0xC7,0x1A,0x18,0xC0,0xFE,0x22,0x84,0x91,0xCC,0x9D,0xAA,0x05,0xC0,0xB8,0x21,0x1A,0x25,0x50,0x1A,0x18,0xC4,0x1A,0x18,0xC0,0x2C,0x8D,0xBD,0x1A,0x51,0x18,0xC3,0x15,
+0xFE,0x00,0x60,0x05,0xC0,0x3F,0x37,0x99,0xBB,0x05,0xD4,0xB0,0x95,0x49,0x3D,0xCB,0x16,0x7B,0xA0,0xC6,0xA0,0xA9,0x70,0x79,0xA3,0x99,0x74,0xA1,0xA9,0xFE,0x21,0x41,
+0x97,0x9C,0xD8,0xA8,0x55,0x0E,0x18,0xC4,0x1A,0x18,0xC3,0xFE,0x54,0xE7,0x28,0x05,0xC1,0x31,0xFE,0x76,0x09,0x18,0x2C,0x0E,0x18,0xC7,0x0E,0xFE,0x09,0x81,0x39,0x18,
+0xC4,0x39,0x37,0x05,0xC0,0xA3,0x87,0xA7,0x78,0x9A,0x88,0x9C,0xBA,0x05,0xD3,0xB5,0x84,0x26,0x3C,0x3D,0xC0,0x41,0xC0,0x3D,0x20,0xA0,0xA8,0x1E,0x2B,0xC0,0x9E,0xB6,
+0x35,0x25,0xA1,0xB9,0xC0,0x7A,0xC1,0x7E,0x6E,0x05,0xFE,0x1B,0x41,0x0F,0x62,0xC0,0xA5,0x88,0xFE,0x6D,0x69,0x18,0xC0,0x2C,0x39,0x1A,0x18,0xC5,0x29,0x0F,0x2A,0xFE,
+0x65,0xA7,0x18,0xC3,0x2C,0x06,0x05,0xC1,0x37,0xA3,0x88,0x96,0xBB,0x05,0xD2,0xA5,0x87,0x13,0x9B,0x79,0x9D,0x9B,0x26,0xA0,0xC7,0x9E,0xB6,0xC1,0x35,0x25,0xA1,0xB8,
+0x62,0x66,0x29,0xC0,0xA3,0x98,0xC4,0x56,0xC0,0x05,0x51,0x29,0xC1,0x0E,0x06,0x0A,0x08,0x5A,0x39,0x18,0xC2,0x0E,0x18,0xC5,0x0C,0x19,0x05,0xB8,0x21,0xB7,0x51,0x18,
+0xC3,0xFE,0x1A,0xC1,0xFE,0x00,0xA0,0x05,0xC1,0x10,0x19,0x05,0xD2,0xA5,0x87,0xB4,0x85,0x35,0x25,0x33,0x3D,0xC0,0x7E,0x31,0x29,0xC3,0x31,0x05,0xC1,0x3D,0xA2,0x87,
+0x05,0x29,0xC0,0x05,0x0A,0x3D,0xC0,0x05,0x29,0xFE,0x6B,0x88,0x94,0x89,0x91,0x9D,0x6B,0x05,0xD7,0xA5,0x87,0x0E,0x18,0xCB,0x9D,0x9A,0xFE,0x23,0x03,0x0F,0x05,0x0C,
+0xFE,0x43,0xE6,0x1F,0x18,0xC2,0x2C,0x9E,0x86,0x1A,0x18,0xC1,0x0E,0x37,0x05,0xC0,0x2B,0xBA,0x21,0x1A,0x18,0xC2,0xFE,0x23,0x41,0xFE,0x00,0x40,0x05,0xC1,0xA5,0x88,
+0x10,0x05,0xD2,0x32,0xB6,0x83,0xFE,0x99,0x61,0xC0,0x7A,0x3D,0xC0,0x7E,0x31,0x24,0x29,0xC2,0x05,0x6E,0xC5,0x05,0x3D,0x0A,0x05,0x0A,0x3D,0x05,0xFE,0x73,0x67,0x8F,
+0x7B,0x97,0x9C,0xD9,0x32,0x1C,0x18,0xC4,0x1A,0x18,0xC5,0x39,0xFE,0x09,0x21,0x05,0x6E,0xB3,0x53,0x0D,0x18,0xC3,0x1A,0x0E,0x18,0xC0,0x0D,0x15,0x0F,0x05,0xC1,0x32,
+0x39,0x18,0xC2,0x8F,0xAD,0x05,0xC3,0x3F,0x51,0x05,0xD2,0xB7,0x94,0xFE,0x99,0x61,0xC0,0x3A,0x31,0x29,0x24,0x29,0x24,0x31,0x29,0xA3,0x98,0x6E,0xC2,0x05,0x0A,0xC1,
+0x05,0xC0,0x3D,0x29,0x3D,0x05,0xC0,0x0A,0xFE,0x6B,0x87,0x88,0x8D,0x9D,0x9A,0xDA,0x2C,0x1A,0x18,0xCB,0x99,0x9C,0xFE,0x0A,0x00,0x05,0xC0,0xAF,0x54,0xFE,0x6E,0x27,
+0x18,0xC5,0x97,0x9A,0xA2,0x89,0x15,0x28,0x17,0x05,0xC2,0x3F,0x1C,0x18,0xC1,0x39,0x17,0x05,0xC2,0x2B,0x10,0x0F,0x05,0x0C,0x05,0xCF,0xB5,0x84,0xFE,0x8A,0x21,0xFE,
+0xA9,0x40,0x29,0x66,0x29,0xC2,0x3D,0xC0,0x7E,0x31,0xA3,0x88,0xC1,0x05,0x0A,0xC1,0x29,0xC4,0x3D,0x3A,0xFE,0x53,0x04,0xFE,0x00,0x20,0xDB,0x1D,0x1F,0x18,0xC3,0x1A,
+0x18,0xC6,0x3B,0xFE,0x00,0xA0,0x9D,0xAA,0x2E,0x0D,0x18,0xC6,0x2C,0x3B,0x28,0x05,0xC4,0x2A,0xBB,0x42,0x1F,0x18,0x0E,0xFE,0x00,0x60,0x05,0xC3,0x10,0x9D,0x99,0x0A,
+0x05,0xD0,0xB0,0x95,0xA9,0xB5,0xFE,0xA9,0x61,0xC0,0x7E,0x31,0x24,0x3D,0xC0,0x05,0x31,0x05,0x6E,0xC1,0x05,0x0A,0xC2,0x29,0xC1,0x31,0x3D,0x05,0x29,0x24,0xFE,0x3A,
+0x24,0x90,0x9C,0xDB,0xB8,0x21,0x1A,0x18,0xCC,0x39,0x28,0x14,0xAE,0x22,0x0D,0x18,0xC8,0x39,0x8A,0xCE,0x19,0x05,0x14,0x05,0xC1,0xB3,0x33,0xFE,0x65,0xA7,0x18,0x0E,
+0x37,0x05,0xC3,0x2B,0x2A,0x0F,0x05,0x6B,0x05,0xCE,0x3F,0xB4,0x83,0xFE,0x99,0x61,0xC0,0x3A,0x31,0x29,0x66,0x29,0xC1,0x3D,0x31,0x0A,0xC1,0x66,0x0A,0xC1,0x05,0x29,
+0x05,0x3D,0x29,0xC2,0xFE,0x32,0xA4,0xBB,0x30,0x18,0xCC,0x2C,0xFE,0x02,0x00,0xFE,0x00,0x20,0xAF,0x33,0x0D,0x18,0xC8,0x1A,0x2C,0x3B,0x28,0x0F,0x05,0x0C,0x05,0xC0,
+0xB7,0x10,0xB3,0x85,0x9C,0x78,0xFE,0x00,0xA0,0x9D,0xAA,0x05,0xC2,0x0A,0x2E,0x99,0xAA,0x0A,0x05,0xD0,0xB3,0x84,0x1C,0x29,0xA2,0x88,0x7E,0x29,0xC5,0x3D,0x33,0xA2,
+0x98,0x3D,0xC0,0x05,0x31,0x0A,0x05,0x3D,0xC0,0xFE,0x55,0x63,0x3E,0x19,0x9C,0xAA,0xC2,0xB5,0x20,0x15,0x0F,0x05,0xC4,0xAB,0x55,0x2E,0x0F,0x05,0xD0,0x2B,0xB5,0xA4,
+0xFE,0x8A,0x21,0x31,0x3D,0xC0,0x7E,0xC1,0x29,0xC0,0x66,0x29,0xC0,0x31,0xA3,0x88,0x3D,0xC0,0x05,0x31,0x24,0x29,0xC0,0xFE,0x23,0xC1,0xFE,0x00,0x60,0xAD,0x65,0x0D,
+0x18,0xCB,0x9D,0x9A,0xC0,0x92,0x9B,0x13,0x19,0x9C,0xAA,0xC0,0x14,0x31,0x37,0x99,0xBB,0x05,0xC4,0x31,0x37,0x05,0xD1,0xB3,0x84,0xA6,0xA5,0xFE,0x99,0x61,0xC0,0xA1,
+0xB8,0x6E,0x3D,0x0A,0xC0,0x9C,0x89,0xC0,0x05,0x29,0xC0,0x05,0x0A,0xC2,0x29,0xC1,0x3D,0xC1,0x29,0x0E,0x19,0x2E,0x0D,0x18,0xCE,0x2C,0x3B,0x28,0x9B,0xBB,0x62,0xA5,
+0x88,0x2E,0x99,0xAA,0x05,0xC4,0x10,0x31,0x92,0xBC,0x05,0xD0,0x2B,0x1E,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0x3D,0x29,0xA3,0x98,0x6E,0x3D,0x29,0x05,0x0A,0x29,0xC0,0x33,
+0x05,0xC2,0x3D,0x29,0xC3,0x3D,0x25,0x37,0xAB,0x66,0x06,0x18,0xCB,0x06,0x18,0xC2,0x39,0xFE,0x09,0x81,0x96,0xCC,0x66,0x2B,0x2A,0x37,0x0A,0x05,0xC2,0x0A,0xAE,0x55,
+0x93,0xBB,0x05,0x6B,0x05,0xCF,0xB0,0x74,0x1C,0xFE,0x89,0x40,0x29,0x3A,0x31,0x29,0xC2,0x3D,0x31,0xC0,0xA2,0x88,0x6E,0xC1,0x05,0x3D,0x29,0xC0,0x24,0x29,0xC0,0x05,
+0x17,0xBB,0x30,0x18,0xCC,0x0D,0xFE,0x02,0x00,0xA9,0xA9,0x1A,0x18,0xCC,0x9D,0x9A,0x18,0xC2,0x0E,0x10,0xFE,0x00,0x20,0xC0,0xA5,0x88,0xAA,0x54,0xBB,0x41,0x18,0xCA,
+0x06,0x18,0xC0,0xFE,0x0A,0xA0,0x1D,0x1F,0x18,0xCB,0x06,0x18,0xC4,0x3B,0xFE,0x00,0xA0,0x9D,0xAA,0x05,0x32,0x2E,0x37,0x05,0xC1,0x19,0x2E,0x2C,0x9F,0xCD,0x31,0x9C,
+0x78,0x0A,0x05,0xCE,0xB7,0x74,0xFE,0x8A,0xC5,0xFE,0xA9,0x61,0x7E,0xC0,0x29,0x24,0x29,0x24,0xA2,0x87,0x29,0xC0,0x05,0x6E,0xC1,0x05,0xC1,0x3D,0x05,0xFE,0x4C,0x07,
+0x1A,0x18,0xCB,0x1A,0x8B,0x9D,0x39,0x18,0xCC,0x9D,0x9A,0x18,0xC4,0x0E,0xFE,0x09,0x81,0x96,0xCC,0x66,0xC0,0x3F,0x2E,0x0F,0x06,0x2E,0xC0,0x9C,0x99,0x06,0x0A,0x28,
+0x2E,0x10,0x0F,0x05,0xCD,0xB0,0x74,0x1C,0x33,0x31,0x3D,0x51,0xC3,0x3D,0x31,0xC0,0xA2,0x88,0xC1,0x3D,0xA2,0x87,0x05,0x29,0x31,0x12,0xFE,0x22,0x03,0x36,0x18,0xCA,
+0x9D,0x9A,0x18,0x99,0x9B,0x36,0x18,0xCD,0x06,0x18,0xC3,0x12,0x19,0x9D,0xAA,0x66,0xC0,0xAA,0x66,0x19,0x05,0xC3,0x2B,0x05,0x37,0x10,0xC0,0x37,0xA2,0xAA,0x03,0xFE,
+0x5C,0xE8,0x18,0xCC,0x39,0x36,0x18,0xCE,0x06,0x18,0xC2,0xFE,0x23,0x03,0x0F,0x05,0x7A,0x32,0xA6,0x44,0x99,0xBB,0x05,0xC0,0x3F,0x15,0x03,0x37,0x28,0x19,0x0F,0x10,
+0x19,0x10,0x0A,0x05,0xCB,0xA9,0x85,0xB1,0xA6,0xFE,0xA1,0xC1,0x29,0xA3,0x98,0xC0,0x29,0x24,0x3D,0xC0,0x05,0x51,0xA3,0x88,0x3D,0x05,0xC1,0x3D,0x0A,0x05,0xC1,0x0A,
+0xFE,0x00,0x20,0xFE,0x3B,0xE5,0xB5,0x50,0x18,0xCB,0x99,0x9C,0x9E,0x86,0x18,0xCE,0x9D,0x9A,0x18,0xC1,0x2C,0xFE,0x09,0x81,0x05,0x6E,0x0F,0x10,0x19,0x0A,0x05,0xC0,
+0x14,0x2B,0x7F,0x37,0x06,0x10,0xC0,0xA4,0x66,0x10,0xC0,0x19,0x05,0xC1,0x14,0x05,0xC7,0xB0,0x74,0xA9,0xD6,0x09,0x9E,0xB9,0xC2,0x3D,0x29,0xC0,0x05,0x3D,0xC0,0x05,
+0x31,0xA3,0x88,0x3D,0x05,0xC1,0x29,0xC1,0xFE,0x00,0x20,0x2A,0x0D,0x18,0xCC,0x39,0x18,0xCA,0x9D,0x9A,0x18,0xC5,0x12,0x19,0x05,0xC0,0x15,0x19,0x05,0xC3,0x08,0x05,
+0xC0,0x6E,0x05,0xC0,0x24,0xA0,0xA9,0x24,0x0A,0x08,0x05,0xCA,0xB8,0x73,0x9C,0xF7,0xFE,0xB1,0x81,0x3D,0xA2,0x87,0xC1,0x05,0x3D,0x29,0xC1,0x3D,0xC0,0x05,0x51,0x0A,
+0x3D,0x05,0xC0,0x29,0xC1,0xFE,0x00,0x20,0x32,0x0E,0x1A,0x18,0xCB,0x92,0x9B,0x1F,0x18,0xCB,0x06,0x18,0xC3,0xFE,0x0A,0x00,0x19,0x05,0x2B,0x15,0x98,0x99,0x05,0xC3,
+0x3F,0x10,0xC1,0x37,0x10,0x37,0x2E,0x13,0x19,0x05,0xC0,0xA3,0x87,0x05,0xC7,0x3A,0xB7,0x74,0xFE,0x99,0x61,0x3D,0x7E,0x0A,0xC1,0x05,0x3D,0x29,0xC1,0x3D,0xC1,0x05,
+0x31,0x0A,0x31,0x05,0x29,0xC0,0x66,0x18,0xCB,0x92,0x9B,0x1F,0x1A,0x18,0xCD,0x06,0x18,0x3B,0x19,0x9C,0xAA,0x0F,0xAD,0x65,0x19,0x31,0x0D,0x18,0xCB,0x94,0x8B,0x0D,
+0x18,0xC1,0x6F,0x18,0xCA,0x06,0x0E,0x3E,0x96,0xBD,0x10,0x31,0x0C,0x06,0x9D,0xAA,0x28,0x05,0xC4,0x0F,0x05,0x2B,0xC0,0x05,0x06,0x0C,0x19,0x9D,0xAA,0x05,0xC8,0x3A,
+0xB5,0x83,0x04,0xFE,0xB1,0x81,0xC0,0x6E,0xC2,0x05,0x3D,0x29,0xC1,0x3D,0x05,0x3D,0x32,0x0E,0x1F,0x18,0xCA,0x2C,0x0E,0x2C,0xC4,0x0E,0xC0,0x35,0xC1,0x61,0xC1,0x9D,
+0x89,0x3B,0x99,0xAD,0x13,0x2E,0x59,0x2E,0x24,0x13,0x2E,0xC1,0x31,0x2E,0x24,0x28,0x10,0x31,0x24,0x10,0x31,0x24,0x10,0x95,0xCC,0x2B,0x10,0x28,0x05,0xC8,0xB0,0x74,
+0x1C,0x09,0x9E,0xB9,0x0A,0xC0,0x05,0x0A,0xC1,0x05,0xC0,0x0A,0x3D,0x0A,0xC0,0x05,0xFE,0x00,0x40,0xB7,0x21,0x0D,0x18,0xCA,0x0D,0x08,0xA8,0x86,0x25,0x0A,0x25,0x2C,
+0xC0,0x0D,0xC3,0x9F,0xAB,0x1A,0xC0,0x1F,0x0D,0x3E,0x0F,0x62,0x7A,0x05,0xC3,0x6E,0x05,0x37,0x24,0xC0,0x3E,0x96,0xBD,0x0A,0x05,0x2B,0x10,0x2E,0x10,0x06,0xC0,0x24,
+0x17,0x05,0xC6,0x3F,0x22,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0x6E,0x3D,0x0A,0xC0,0x9D,0x99,0x05,0x0A,0xC2,0x05,0x0A,0xC1,0xBC,0x56,0xC1,0x56,0x7A,0x9A,0x88,0x9D,0x99,
+0x99,0x99,0xA2,0x97,0xA4,0x68,0x27,0xA7,0x88,0xC0,0x01,0x3C,0x01,0xF0,0x27,0x28,0xC0,0x01,0x3C,0x01,0xE1,0x00,0x98,0xA9,0xC0,0xA3,0x68,0x18,0x39,0x18,0x39,0x01,
+0xE2,0x00,0x3D,0x26,0xA7,0x77,0x3C,0x01,0x9C,0x88,0x00,0x9A,0x98,0x3D,0x26,0x01,0xC3,0x39,0x28,0x36,0x3D,0x1D,0xC0,0x19,0x39,0xC0,0xA2,0x84,0xA0,0xA9,0xC8,0x47,
+0xC1,0x3C,0xC0,0x3A,0x3C,0xC0,0x01,0xCA,0x18,0x39,0x01,0xDB,0x3C,0x19,0x07,0x3D,0x10,0x1D,0xAA,0xA5,0x51,0x55,0x54,0xA0,0x8A,0xC1,0xA0,0x85,0x9D,0x9A,0xC1,0x9C,
+0x8A,0x3D,0xA2,0x85,0xC1,0x06,0x65,0xA4,0x89,0xC0,0x07,0x1E,0x0F,0xA3,0x99,0x3E,0xC1,0x47,0xC1,0x67,0x01,0xC5,0x27,0x28,0x01,0xDA,0x19,0x18,0x26,0x3D,0x1D,0xC0,
+0x5A,0x90,0xB9,0x7B,0x55,0xCD,0x0A,0xA4,0x87,0x7F,0x6E,0xA4,0x87,0xA5,0xA8,0x07,0x0F,0x1E,0xA4,0x77,0x9F,0x9B,0x01,0x69,0xC0,0x67,0x88,0x98,0x31,0x07,0x06,0x93,
+0x9B,0x9D,0x9A,0xED,0xA9,0x85,0xAA,0x87,0xA5,0x88,0xA5,0x87,0xC0,0x0F,0x20,0xAA,0x86,0x35,0x31,0x3C,0x3A,0x3C,0xC0,0x0A,0x66,0xF9,0xA9,0x85,0x07,0x35,0x31,0x3A,
+0x3C,0x01,0xC5,0x27,0x26,0x1A,0x31,0x3F,0x39,0x35,0x3A,0xC0,0x93,0xAA,0x26,0x1D,0x8F,0xBA,0xC0,0x22,0x1E,0x39,0x26,0x3D,0x1D,0x3A,0x8C,0xA7,0xB0,0x77,0x0F,0x06,
+0x1D,0xC2,0x05,0xC0,0x07,0x35,0x96,0x6A,0x1D,0xC1,0x05,0xC1,0x22,0x1E,0x06,0x1D,0xC0,0x05,0xC2,0x22,0xA8,0x86,0x19,0x1D,0x05,0xC3,0x22,0x1E,0x18,0x9F,0xA3,0x0A,
+0x05,0xD3,0x14,0x2B,0x05,0xD4,0x07,0xFE,0xE7,0x38,0x93,0x85,0x1E,0x90,0x9B,0x05,0xC5,0xA5,0x88,0x17,0x05,0xE8,0x3F,0x24,0x07,0x0A,0x05,0xD4,0x13,0xFE,0xD6,0xF5,
+0xA8,0x88,0x6B,0x04,0x34,0x8C,0x99,0x8C,0x8A,0x05,0xC3,0x1E,0x3D,0x90,0x8A,0x3F,0x05,0xE7,0x3C,0x2B,0x8E,0x8A,0xB1,0x7B,0x07,0x8B,0x9C,0x62,0xD5,0xA5,0x87,0xFE,
+0xBD,0xD1,0x04,0xC0,0x0B,0xC1,0x04,0x34,0x89,0x98,0x8A,0x8B,0x97,0x9C,0x0A,0x05,0xB5,0x84,0x34,0x04,0x34,0x0C,0x8A,0x8B,0x97,0x9C,0xE6,0xB3,0x84,0x1E,0x9A,0x58,
+0xFE,0xFF,0xFA,0x0B,0x04,0x9A,0x9A,0x8C,0x76,0x20,0x05,0xC0,0x32,0x0B,0xC2,0x8A,0x86,0x86,0x9C,0x05,0xC0,0x13,0x34,0x04,0x0B,0x04,0x93,0x8A,0x87,0x98,0x8C,0x9B,
+0x05,0xE4,0x16,0x35,0x36,0x18,0x1D,0xD0,0xFE,0xF7,0xFA,0x04,0x0B,0xC0,0x9D,0x98,0x21,0x3C,0x05,0xA5,0x87,0x21,0x04,0x0B,0xC1,0x34,0x8A,0x89,0x31,0x05,0xE4,0x06,
+0xAC,0x67,0x29,0x1D,0xCD,0x26,0x55,0x26,0x3F,0xFE,0xB5,0xB2,0x19,0x95,0x97,0x0B,0xC1,0x9C,0x86,0x8B,0x9A,0x3E,0x93,0x98,0x05,0x6B,0x05,0xD6,0xBB,0x84,0xFE,0xF7,
+0xB9,0x0B,0x04,0x0B,0x0E,0x9D,0x88,0x96,0x79,0x99,0x9A,0x9C,0x99,0x11,0x0B,0xA2,0x8A,0xC0,0x8A,0x85,0x83,0xBE,0x05,0xC0,0x0A,0x05,0xC0,0xA7,0x85,0xA7,0x99,0xA5,
+0x87,0x9C,0x88,0xFE,0xBE,0x31,0xAE,0x8A,0xC3,0x14,0xA5,0x87,0xAA,0x89,0xAC,0x87,0x33,0xC1,0x11,0xC1,0x22,0xBE,0x78,0xAD,0x98,0x04,0x0B,0x0E,0x0B,0x04,0x0B,0x2B,
+0x8D,0x87,0x3C,0x14,0x05,0xE1,0xA9,0x85,0x35,0x29,0x26,0xFE,0xD6,0xD7,0xA5,0x88,0xA2,0x97,0xA2,0x79,0x0B,0x0E,0x0B,0xC0,0x04,0x0B,0x8E,0x99,0xC0,0x0B,0x04,0x0B,
+0xC1,0x04,0x0B,0xC0,0x2B,0x00,0x20,0x95,0x9B,0xE2,0x22,0x1E,0x25,0x0B,0x04,0x0B,0x0E,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0x2B,0x21,0x0B,0xC4,0x04,0x0B,0x2B,0x87,0x99,
+0x96,0x78,0x91,0x9A,0x97,0x9C,0xE1,0xA5,0x88,0xB6,0x83,0x0F,0x0E,0x05,0x0B,0x12,0xC0,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC3,0x04,0x0E,0xC1,0x34,0x11,0x19,0x04,0x0E,
+0x0B,0x8A,0x86,0x2C,0x0A,0x0C,0x05,0xDF,0x13,0x35,0x93,0xBE,0x0B,0xC6,0x04,0x0B,0x0E,0x0B,0xC0,0x9D,0x98,0x92,0x98,0x3A,0x0B,0x04,0x0B,0x0E,0x19,0xFE,0x08,0x80,
+0x0C,0x05,0xD9,0x29,0xFE,0xDE,0xF8,0xA8,0x8B,0xC0,0x9E,0x75,0x0C,0x86,0x78,0x88,0x79,0x32,0x11,0xB3,0x98,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC4,0x04,0x92,0x87,0x2B,
+0x04,0x0B,0xC0,0x04,0x0B,0x0E,0x8E,0x89,0x89,0x88,0x08,0x5A,0xE0,0x13,0x35,0x8C,0x8E,0x9C,0x97,0x33,0x0E,0x12,0x0B,0x0E,0x0B,0xC4,0x04,0x34,0x50,0x04,0x0B,0xC0,
+0x0E,0x93,0x79,0x88,0x8A,0x95,0x9A,0x1D,0xAC,0x94,0x8C,0x9A,0xFE,0xF7,0xFA,0xC0,0x0E,0xC0,0x0B,0xC2,0x04,0x31,0x0B,0xC1,0x04,0x33,0x2B,0x9D,0x89,0xA9,0x55,0xA4,
+0xCB,0x11,0x39,0x89,0xAF,0xC0,0x6B,0x05,0xDE,0x36,0x52,0xFE,0xE7,0x38,0xA6,0x8C,0xC0,0x9B,0x87,0xFE,0x2B,0x24,0xA1,0x45,0x91,0xFF,0x05,0xC0,0x20,0x9C,0x7A,0x21,
+0x12,0x0B,0x04,0x0B,0xC2,0x0E,0x34,0xC0,0x0B,0xC0,0x9D,0x98,0x16,0x86,0x78,0x05,0xA7,0x85,0xAC,0x36,0xAB,0x64,0x29,0xFE,0xDE,0xF8,0xA8,0x8B,0xC0,0x33,0x28,0xA1,
+0x45,0x96,0xDC,0x95,0xDE,0x32,0xB2,0x10,0xA1,0xAA,0x29,0x2D,0x0D,0x0E,0x0B,0x04,0x0B,0x0E,0x0B,0x92,0x86,0x0B,0xC0,0x2B,0x16,0x8E,0x65,0x9B,0xAC,0x05,0x0F,0x13,
+0xAA,0x54,0x29,0xFE,0xDE,0xF8,0xA8,0x8B,0xC0,0x54,0x8B,0x45,0x19,0xC1,0x28,0x12,0x11,0x3D,0x87,0x89,0x2B,0x0B,0xC0,0x0E,0x0B,0x0E,0x9A,0x89,0x9C,0x75,0x0B,0xC0,
+0x82,0x9A,0x8F,0x57,0xA8,0x44,0x13,0x95,0xDE,0xC0,0xAF,0x55,0xA6,0x52,0xFE,0x4A,0x25,0xB2,0x76,0xB4,0x8A,0xA8,0x8B,0xC0,0x2A,0x30,0x28,0xC1,0x23,0x2A,0xA2,0x89,
+0x2D,0x11,0x0E,0x0B,0x0E,0x0B,0x0E,0x96,0x76,0xA6,0x88,0xA4,0x8B,0x88,0x9A,0xA7,0x98,0xC0,0x28,0xA1,0x45,0x9C,0xCA,0xC0,0xA4,0x66,0x23,0x29,0xBD,0x85,0x21,0x33,
+0x37,0xA9,0x88,0xC0,0x37,0x11,0x37,0xA4,0x66,0xC0,0x37,0x11,0x33,0xB8,0x75,0xC1,0x0E,0x0B,0x31,0x0B,0x34,0x11,0xB4,0x9B,0x05,0x21,0x92,0x13,0x9B,0x76,0x9C,0xAB,
+0xB1,0xAA,0x3D,0x80,0x87,0x34,0x0B,0x05,0x0C,0x2D,0x9E,0x86,0x21,0x37,0xC0,0x2D,0x0C,0xC0,0xA8,0x76,0xC0,0x0E,0x0B,0x0E,0xC0,0x3A,0x94,0x76,0x0B,0x9A,0x99,0x33,
+0x37,0x0C,0xC0,0x2D,0x37,0x11,0xC1,0xAF,0x9A,0xA5,0x96,0x0B,0x31,0x2C,0x91,0x9F,0xDF,0xA5,0x87,0xB6,0x84,0x0B,0xC1,0x0E,0x0B,0xC7,0x0E,0x0B,0xC1,0x9D,0x98,0x99,
+0x87,0x0B,0xC0,0x04,0x9A,0x9A,0x2D,0x9E,0x86,0xC0,0x37,0x3D,0x04,0x6B,0xC1,0x05,0x19,0x31,0x0E,0x0B,0x0E,0xC0,0x3A,0x0B,0x04,0x0B,0xC5,0x96,0x86,0x36,0x99,0x9A,
+0x05,0xDF,0xB7,0x74,0x9C,0x96,0x07,0x34,0x0B,0xC0,0x0E,0xC0,0x3A,0x0B,0x04,0x0E,0x0B,0x04,0x0B,0x0E,0x0B,0xC4,0x19,0x0B,0xC0,0x04,0x0E,0x0B,0x04,0x0B,0x0E,0x0B,
+0xC3,0x2A,0x13,0x32,0x07,0x05,0xDF,0xB8,0x73,0x9B,0x99,0x32,0x0B,0x9C,0x86,0x19,0x0B,0x0E,0x04,0x0E,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0xC1,0x21,0xFE,0x08,0x20,0x05,
+0x36,0x8F,0x9B,0x0B,0x0E,0xC0,0x0B,0xC8,0x04,0x0B,0x0E,0x0B,0xC1,0x31,0x0B,0xC2,0x04,0x0B,0xC2,0x0E,0x0B,0x2B,0x29,0x05,0xC0,0x36,0x94,0x89,0x97,0x9C,0xDE,0x0F,
+0x0B,0x34,0x04,0x0B,0xC0,0x0E,0x0B,0xC2,0x04,0x0B,0x9A,0x99,0xFE,0x3A,0x06,0x05,0x0E,0xC0,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x88,0x9B,0x05,0xA2,0x77,0xAD,0x95,0x05,
+0xDF,0x7F,0x0B,0xC0,0x19,0x21,0x33,0x2D,0x0D,0x0E,0xC0,0x0B,0x04,0x0B,0x0E,0x0B,0xC0,0x21,0x05,0xC4,0x3F,0x22,0x05,0xDC,0x3C,0x24,0x18,0x6E,0xC5,0x10,0x1D,0x10,
+0x20,0x07,0xBA,0x88,0x0E,0x5A,0x04,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,0x0C,0x30,0x8A,0x7A,0x05,0xC0,0x3F,0x33,0x0E,0xFE,0x4A,0xA4,0x29,0x19,0x0B,0xC1,0x04,0x0B,
+0x0E,0x0B,0xC3,0x11,0x1F,0x05,0x08,0x05,0xC1,0xAC,0x87,0x2A,0xA2,0x89,0x0B,0x04,0x0B,0x0E,0x2A,0xFE,0x5B,0x4A,0x87,0xAB,0xC5,0x3F,0x22,0x05,0xDB,0xAB,0x86,0xB0,
+0x85,0x18,0x1D,0xC4,0xA3,0x74,0x0A,0xBB,0x86,0xFE,0xF7,0xB9,0x0B,0x6B,0x0B,0xC1,0x04,0x0B,0x0E,0x2A,0x30,0x80,0x8B,0xC1,0x32,0x36,0x25,0x9D,0x88,0x99,0x98,0xFE,
+0xBE,0x54,0xAD,0x98,0xC1,0x0E,0x9D,0x88,0x81,0x8B,0x84,0x9B,0xC6,0x20,0xA9,0x85,0x05,0xDB,0xB3,0x85,0x39,0x18,0x1D,0xC0,0x10,0x1D,0xC1,0xA4,0x41,0x0A,0x05,0x33,
+0x12,0x0B,0xC1,0x0E,0xC0,0x51,0x0B,0xFE,0x6B,0xAB,0x84,0x9B,0xA6,0x87,0xB3,0x77,0x11,0x3D,0x2A,0xA2,0x97,0x0B,0x3D,0x2A,0x12,0x0B,0xC0,0x2B,0x29,0x0A,0x05,0xC6,
+0x36,0x3C,0x05,0xDA,0xAB,0x86,0xB0,0x85,0x3C,0x26,0x1F,0xA2,0x99,0x10,0x1D,0xC1,0xA2,0x54,0x91,0xCC,0x05,0xA5,0x87,0x33,0x0D,0x0E,0x0B,0xC2,0x30,0x1F,0x30,0xB5,
+0x88,0x0B,0x12,0x0B,0xC2,0x04,0x0E,0x0B,0xC0,0x98,0x9A,0x29,0x05,0xC8,0x36,0x9D,0x86,0x97,0x9C,0xDA,0xB8,0x73,0x22,0x99,0x9D,0x18,0x3D,0x26,0x1F,0x26,0xC0,0x3D,
+0x9D,0xC9,0xB2,0x43,0x8E,0x89,0x97,0x9C,0xE1,0xA6,0x87,0xAF,0x85,0x9A,0x48,0x98,0x99,0x05,0xC1,0x33,0x0B,0xC0,0x0E,0x0B,0x93,0x89,0x89,0x8C,0xBB,0xA6,0x0D,0x12,
+0xC0,0x69,0xC0,0x9D,0x98,0x9D,0x9A,0x0B,0xC2,0x95,0x8B,0x18,0x05,0xC9,0xB0,0x74,0x95,0x9B,0x05,0xD9,0xB3,0x85,0x07,0x97,0xAA,0xA0,0x7A,0x62,0xC2,0x3C,0x3D,0xC0,
+0x26,0x1F,0xC0,0xA6,0xB7,0x1E,0x05,0xE2,0x3C,0x22,0x98,0x59,0x44,0x05,0xC2,0xFE,0x8C,0x6C,0x04,0x0B,0xC0,0x97,0x9A,0x2A,0x12,0xC0,0x3D,0x11,0x21,0x33,0x21,0xAF,
+0x87,0x0B,0xC1,0x11,0x20,0x05,0xCA,0x06,0x0A,0x05,0xD8,0x20,0x1E,0x3C,0x9E,0x8B,0x18,0x3D,0xC4,0xA3,0x87,0x3D,0xC1,0x9D,0xC9,0xAE,0x53,0x99,0x99,0x05,0xE2,0x22,
+0x3C,0x9D,0x47,0x2E,0x05,0xC3,0x16,0x2A,0x0B,0xC4,0x2B,0x19,0x04,0x0E,0x0B,0x12,0x98,0x99,0x86,0x78,0x87,0x9A,0x3A,0x55,0xAA,0x34,0x91,0xEE,0xC4,0xB9,0x76,0xBA,
+0x88,0x12,0x0B,0xC6,0x0E,0x11,0x82,0x9A,0x05,0xCC,0x14,0x3C,0x05,0xD8,0xB7,0x74,0x61,0xA6,0x86,0x17,0x05,0xE2,0x36,0x8B,0xAD,0x0A,0xAE,0x33,0x93,0xDD,0x05,0x6B,
+0x05,0xC2,0xAF,0x87,0xFE,0xBE,0x54,0xAD,0x98,0xC2,0x0E,0x0B,0xC0,0x93,0x89,0x29,0x05,0xC0,0x17,0x05,0xCB,0x3F,0x20,0x05,0xD6,0xA2,0x77,0x17,0x05,0xB3,0x33,0x91,
+0xCC,0x0A,0x05,0xC4,0x3F,0x30,0xB5,0x88,0x12,0x69,0xC0,0x05,0xC0,0x0C,0xFE,0x3C,0x62,0x9C,0x9A,0x9B,0x9A,0x9C,0xAB,0x9F,0x67,0xC0,0xA4,0xAA,0xA6,0x76,0xA8,0x76,
+0xA6,0x75,0x12,0x01,0x33,0x29,0x12,0x06,0x05,0xEA,0x2B,0x1E,0x22,0x99,0x9D,0xC0,0xA4,0x95,0xC0,0x0A,0x05,0xE5,0x22,0xA2,0x88,0x3D,0xB2,0x70,0x89,0x9D,0x05,0xDD,
+0xA8,0x55,0x06,0x24,0x58,0x06,0xA9,0x97,0x96,0xAC,0x19,0x0A,0x05,0x0C,0xFE,0x6E,0x26,0xA3,0x87,0xC3,0x67,0x18,0x99,0x9C,0xFE,0x5B,0xA9,0xC0,0x1A,0x06,0x9A,0x88,
+0xFE,0x01,0x60,0x97,0xDD,0x05,0x0A,0x76,0xAB,0x34,0x0C,0x9C,0xA9,0x2E,0x24,0x31,0x99,0x9A,0x05,0xDC,0xB3,0x85,0xA5,0x87,0x8D,0x9D,0x13,0xAA,0x54,0xA9,0x85,0xA8,
+0x75,0xA2,0x89,0x2C,0x3B,0x13,0x24,0x31,0x24,0xC0,0x10,0xAA,0x53,0xBB,0x40,0x18,0xC5,0x1A,0xFE,0x5B,0xA9,0xA0,0xA9,0xFE,0x65,0xA7,0x18,0x9D,0x9A,0x12,0x2C,0x1A,
+0x18,0xC3,0x3B,0x19,0x05,0xC1,0x37,0xA7,0x87,0xFE,0x55,0x25,0x18,0x1A,0x18,0xC3,0x1A,0xFE,0x4C,0x07,0x9D,0xEE,0xAA,0x10,0x18,0xC0,0x2B,0xB2,0x11,0x0A,0x18,0x1A,
+0x18,0xC3,0x92,0x9E,0x3E,0x1C,0x18,0xC0,0x25,0x6B,0x18,0xC4,0x2C,0xFE,0x02,0x00,0xFE,0x00,0x20,0xA2,0x77,0x3F,0xA4,0x56,0x96,0xBB,0x05,0xD7,0x3C,0xAA,0x76,0x3D,
+0x22,0xA8,0x86,0x88,0x8D,0x05,0xD8,0x28,0x0D,0x18,0xC6,0x1A,0x2C,0xFE,0x09,0x81,0x0A,0x05,0xC1,0x31,0x0E,0xA2,0x75,0x1A,0x18,0xC4,0x12,0x0A,0x18,0xC1,0x39,0x18,
+0xC5,0x3B,0x05,0xC0,0x6E,0xAE,0x53,0x37,0x05,0xD6,0x2B,0xB6,0x84,0x91,0x9D,0x3D,0xD6,0x36,0x18,0xC4,0x1A,0x18,0xC2,0xFE,0x3B,0xE5,0xFE,0x00,0xA0,0x0A,0x05,0xC0,
+0xA5,0x87,0x1C,0x25,0x2C,0x18,0xC3,0x9D,0x9A,0x2B,0xFE,0x54,0xE7,0x18,0xC7,0x1A,0x18,0xC0,0x0C,0x19,0x0A,0x05,0x0A,0xB7,0x32,0x1A,0x25,0x50,0x1A,0x18,0xC4,0x1A,
+0x18,0xC0,0x2C,0x8D,0xBD,0x1A,0x06,0x18,0xC3,0x15,0x05,0xC1,0x3F,0x37,0x99,0xBB,0x05,0xD4,0xB0,0x95,0x49,0x3D,0xCB,0x20,0x73,0xA0,0xC6,0xA0,0xA9,0x70,0x79,0xA3,
+0x99,0x74,0xA1,0xA9,0x79,0xC0,0xFE,0x54,0xE7,0x18,0xC4,0x39,0x05,0xC1,0x17,0xA5,0x67,0x19,0x05,0xD4,0xB5,0x84,0x3C,0xC0,0x3D,0xC0,0xA2,0x77,0x26,0x3D,0x20,0xA0,
+0xA8,0x1E,0x2B,0xC0,0x9E,0xB6,0x35,0x25,0xA1,0xB9,0x61,0x7E,0xFE,0x55,0x63,0x18,0xCB,0xFE,0x1B,0x41,0xFE,0x00,0x60,0x05,0x6E,0xA4,0x88,0xFE,0x6D,0x69,0x18,0xC0,
+0x2C,0x39,0x1A,0x18,0xC5,0x8A,0x9E,0x0F,0x2A,0xFE,0x65,0xA7,0x18,0xC3,0x2C,0xFE,0x09,0x81,0x05,0xC1,0x32,0xB2,0x94,0xA0,0x65,0x05,0xD9,0xA5,0x88,0x0E,0x18,0xCB,
+0x0E,0x06,0x0A,0x76,0x05,0x39,0x18,0xC2,0x0E,0x18,0xC5,0x0C,0x05,0x0A,0xB7,0x32,0xFE,0x6E,0x27,0x18,0xC3,0xFE,0x1A,0xC1,0x19,0x05,0xC1,0x10,0x19,0x05,0xD2,0xA5,
+0x87,0xB4,0x85,0x35,0x25,0x33,0x7B,0xC0,0x7E,0x31,0x56,0xC1,0x66,0x37,0x0E,0x18,0xCB,0x9D,0x9A,0xFE,0x23,0x03,0x0F,0x62,0x6B,0xFE,0x43,0xE6,0xFE,0x76,0x87,0x18,
+0xC2,0x2C,0x9E,0x86,0x1A,0x18,0xC1,0x0E,0x37,0x05,0xC0,0x2B,0xBA,0x21,0x1A,0x18,0xC2,0x15,0x05,0xC2,0xA5,0x88,0xA4,0x78,0x98,0x98,0x05,0xD1,0x32,0xB6,0x83,0xFE,
+0x99,0x61,0xC0,0x3A,0x31,0xFE,0x01,0x00,0x1C,0x18,0xC4,0x1A,0x18,0xC5,0x39,0xFE,0x09,0x21,0x05,0x0A,0xB3,0x53,0x0D,0x18,0xC3,0x1A,0x0E,0x18,0xC0,0x0D,0x15,0x0F,
+0x05,0xC1,0x32,0x39,0x18,0xC2,0x8F,0xAD,0x05,0xC3,0x3F,0x28,0x05,0xD2,0xB7,0x94,0xFE,0x99,0x61,0xC0,0x3A,0x31,0xFE,0x00,0xA0,0x2C,0x1A,0x18,0xCB,0x99,0x9C,0xFE,
+0x0A,0x00,0x05,0xC0,0xAF,0x54,0xFE,0x6E,0x27,0x18,0xC5,0x97,0x9A,0xA2,0x89,0x15,0x28,0x9C,0xBA,0x05,0xC2,0x3F,0x1C,0x18,0xC1,0x39,0x05,0xC3,0xA5,0x87,0x10,0x0F,
+0x05,0x0C,0x05,0xCF,0xB5,0x84,0xFE,0x8A,0x21,0x29,0xC0,0x24,0xFE,0x00,0x60,0x1D,0x1A,0x18,0xC3,0x1A,0x18,0xC6,0x3B,0x0F,0x19,0xB4,0x43,0xB7,0x51,0x18,0xCC,0x39,
+0x28,0x14,0xAE,0x22,0x0D,0x18,0xC8,0x39,0x13,0x95,0xDE,0x05,0x14,0x05,0xC1,0xB3,0x33,0xFE,0x65,0xA7,0x1F,0x0E,0xFE,0x09,0x21,0x05,0xC3,0x2B,0x2A,0x0F,0x05,0x6B,
+0x05,0xCE,0x3F,0xB4,0x83,0xFE,0x99,0x61,0xC0,0x3A,0x9D,0xA9,0x05,0xC1,0xB7,0x10,0xB3,0x85,0x9C,0x78,0xFE,0x00,0xA0,0x9D,0xAA,0x05,0xC2,0x0A,0x2E,0x99,0xAA,0x05,
+0xD1,0x22,0xA6,0xC6,0x33,0x0E,0xFE,0x4A,0xA4,0xA5,0xB7,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x6E,0x05,0x31,0x0D,0x18,0xCE,0x2C,0x15,0x28,0x9B,0xBB,0x62,0xA5,0x88,0x2E,
+0x99,0xAA,0x05,0xC4,0x10,0x31,0x92,0xBC,0x05,0xD0,0x2B,0xB2,0x95,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0x6F,0xFE,0x22,0x84,0x06,0x18,0xCB,0x06,0x18,0xC1,0x06,0x39,0xFE,
+0x09,0x81,0x0A,0x05,0x2B,0x2A,0x37,0x05,0xC3,0x0A,0xAE,0x55,0x05,0xC0,0x6B,0x05,0xCF,0xB0,0x74,0x1C,0xFE,0x89,0x40,0x24,0xFE,0x22,0x84,0xFE,0x76,0x09,0x18,0xCC,
+0x9D,0x9B,0xFE,0x02,0x00,0xA9,0xA9,0x1A,0x18,0xCC,0x9D,0x9A,0x18,0xC2,0x0E,0x10,0x05,0xC0,0xA6,0x87,0xA9,0x55,0x37,0x05,0xC3,0x2E,0x9C,0x99,0x97,0xBB,0x0A,0x05,
+0xC0,0xAF,0x33,0xA5,0x54,0x0C,0x31,0x9C,0x78,0x0A,0x05,0xCE,0xB7,0x74,0xFE,0x8A,0xC5,0xFE,0xB1,0x81,0x31,0x2E,0x10,0x06,0x0A,0x28,0x2E,0x10,0x95,0xCC,0xCE,0xB0,
+0x74,0x1C,0x33,0x0E,0x18,0xCA,0x9D,0x9A,0x18,0xC6,0x97,0x9A,0xFE,0x01,0x60,0x05,0xC1,0x2B,0x0C,0x24,0x99,0xBB,0xA3,0x77,0x9E,0xBC,0x10,0xC0,0x37,0x06,0x99,0xBB,
+0xA6,0x88,0x10,0x19,0x05,0xCC,0x3C,0xAC,0x95,0xFE,0xA1,0xC1,0x29,0xC0,0x66,0x3D,0xC0,0x7E,0x51,0x24,0x29,0xC0,0x19,0x9D,0xAA,0x66,0xC0,0x15,0x19,0x05,0xC3,0x2B,
+0x05,0x37,0xA7,0x66,0x10,0x37,0xA2,0xAA,0x19,0x05,0xCB,0xA9,0x85,0x22,0x09,0x29,0x31,0x29,0x66,0x29,0xA3,0x98,0x6E,0x3D,0xC0,0x33,0xFE,0x00,0x40,0x66,0x08,0xA5,
+0x78,0x06,0x19,0x05,0xC0,0x3F,0x03,0x37,0xC1,0x19,0x0F,0x10,0x05,0xAF,0x33,0x0A,0x05,0xCB,0xA9,0x97,0x22,0x09,0x29,0xA3,0x98,0xC0,0x29,0x66,0x3D,0xC0,0x05,0x31,
+0xA3,0x88,0xFE,0x00,0x20,0x6E,0x05,0x0A,0x05,0x0F,0x03,0x0E,0x18,0xCC,0x92,0x9B,0xAE,0x76,0x18,0xCB,0x9D,0x9A,0x18,0xC3,0x13,0x19,0x05,0x2B,0x15,0x0F,0x05,0xC3,
+0x3F,0x10,0xC1,0x37,0x10,0x37,0x2E,0x13,0x19,0x05,0xC0,0xA3,0x87,0x05,0xC7,0x3A,0xB5,0x83,0xFE,0x99,0x61,0xA2,0xA7,0x10,0x96,0xBB,0xAE,0x54,0x0D,0x18,0xCB,0x94,
+0x8B,0x06,0x18,0xC1,0x6F,0x18,0xCB,0x0E,0x3E,0x96,0xBD,0x10,0x31,0x0C,0x06,0x9D,0xAA,0x28,0x05,0xC0,0x0F,0x13,0xC0,0x2E,0xC1,0x31,0x2E,0x59,0x28,0x10,0x31,0x24,
+0x10,0x31,0x24,0x10,0x0F,0x2B,0x10,0x05,0xC0,0xFE,0x23,0x41,0xB7,0x62,0x18,0xCA,0x0D,0x92,0x89,0xA8,0x86,0xA2,0x89,0x0A,0x25,0x6B,0xC1,0x0D,0xC2,0x9F,0xAB,0x1A,
+0xC0,0x1F,0x0D,0x3E,0x0F,0x05,0x7A,0x05,0xC0,0x0F,0x05,0xC0,0x6E,0x05,0x37,0x24,0xC0,0x3E,0x96,0xBD,0x0A,0x05,0x2B,0x10,0x2E,0x10,0x06,0xC0,0x24,0x0A,0xBC,0x56,
+0xC7,0x99,0x99,0xC0,0x01,0xC7,0x95,0x99,0xA8,0x88,0x01,0xC7,0x94,0x89,0xAB,0x98,0x01,0xC7,0x96,0x99,0x01,0xC7,0x00,0xC0,0x01,0xC7,0x18,0x28,0x3C,0x01,0xC6,0x18,
+0x3C,0x01,0x27,0x00,0x01,0x3C,0x01,0xFD,0xD4,0x00,0x27,0x00,0x9A,0x98,0x9B,0x89,0xA3,0xA9,0x27,0x00,0x28,0x01,0xFD,0xD1,0x00,0xC0,0x01,0xC1,0x9C,0x88,0x00,0x07,
+0x9C,0x88,0xA2,0x98,0x27,0x00,0x28,0x3C,0x01,0xFD,0xCC,0x07,0xAC,0x68,0xC0,0x19,0x00,0x07,0x17,0x07,0x00,0xC0,0x01,0xFD,0xCA,0x10,0x3C,0x01,0xE9,0x00,0xC0,0x07,
+0x1F,0x07,0x00,0x19,0x39,0x01,0xFD,0xC4,0x00,0xC0,0x01,0xEE,0x00,0x27,0x99,0x99,0xC0,0x18,0x00,0x01,0x3C,0xC0,0x01,0xFD,0x18,0x28,0x3C,0x01,0xF0,0x19,0x00,0x07,
+0x26,0xC0,0x07,0x27,0x00,0x28,0x3C,0xC0,0x01,0xF8,0x07,0x39,0x01,0xEC,0x39,0x01,0xC7,0x19,0x27,0x3D,0x1F,0x36,0x27,0x00,0x28,0x3C,0xC0,0x01,0xF3,0x19,0x27,0x3C,
+0x01,0xFA,0x19,0x00,0x07,0x26,0xC0,0x18,0x00,0xC0,0x01,0xF1,0x27,0x00,0x01,0xFD,0xC1,0x28,0x19,0x27,0x07,0x17,0x07,0x27,0x00,0x28,0x3C,0xC0,0x01,0xEA,0x07,0x39,
+0x01,0xFD,0xC6,0x19,0x00,0x07,0x26,0xC0,0x07,0x00,0x19,0x28,0x01,0xE7,0x27,0x01,0xE6,0x00,0x01,0x3C,0xC0,0x01,0xE3,0x00,0xC0,0x07,0x78,0x4F,0xA4,0xA7,0xA6,0x87,
+0xA3,0x89,0xD0,0x47,0xC1,0x01,0x39,0x01,0xC0,0x39,0x01,0xCA,0x00,0xC0,0x01,0xE4,0x00,0x26,0xC0,0x01,0xE3,0x3E,0xC2,0x64,0x1E,0x55,0x56,0xC1,0x9C,0x98,0x6D,0xC0,
+0x9C,0x8A,0x65,0x3C,0x3A,0x3C,0x9D,0x89,0xC2,0x3A,0x3C,0x22,0x07,0xC0,0x0F,0xA3,0x97,0xA2,0x76,0xA0,0x8A,0xC1,0x9E,0x7C,0xC0,0x01,0xC0,0x39,0x01,0xC8,0x93,0xA9,
+0x28,0x01,0xE2,0x00,0x26,0xC0,0x07,0x18,0x28,0xA2,0x88,0x01,0xDC,0x3E,0xC0,0x0F,0x56,0x9D,0x97,0x06,0x9B,0x9A,0x9C,0x87,0x53,0x51,0xC1,0x9D,0x9A,0xD3,0x2B,0x31,
+0xA4,0x87,0x06,0xA7,0x85,0x0F,0x24,0x35,0xC0,0x3A,0xC1,0x01,0xC0,0x3C,0x01,0xC3,0x93,0xA9,0x39,0x01,0xE0,0x00,0x26,0xC0,0x18,0x6E,0xC1,0x01,0xDA,0x3E,0x1E,0x0F,
+0x06,0x65,0x31,0x2B,0x05,0xE2,0x2B,0x31,0x06,0x32,0x0F,0x24,0x35,0x47,0x9F,0x9B,0xC0,0x01,0xC0,0x3C,0x00,0xC0,0x01,0xDF,0x96,0x99,0x1F,0x36,0x10,0x1D,0xC3,0x01,
+0xD7,0x3E,0x1E,0x9B,0x87,0x12,0x17,0xC0,0x05,0xEB,0xA7,0x85,0x06,0x0F,0x24,0x35,0x47,0x3A,0xC0,0x18,0x28,0x3C,0x01,0xDC,0x00,0x26,0xC0,0x1D,0xC6,0x01,0xD3,0x31,
+0x3A,0xA0,0xA5,0x9A,0x89,0x95,0x7B,0x17,0xC0,0x05,0xF1,0xA7,0x87,0xAA,0x94,0x24,0xA2,0x76,0x31,0x06,0x3A,0xC0,0x01,0xC0,0x3C,0x01,0xD7,0x19,0x9A,0x99,0x26,0x18,
+0x1D,0xC6,0x5A,0x01,0xD3,0x24,0x94,0x8A,0x96,0x8B,0x17,0x05,0xF7,0xAB,0x86,0xAB,0x83,0x24,0xA2,0x76,0x31,0x9F,0x9B,0xC0,0x01,0xC0,0x3C,0x01,0xD4,0x96,0x99,0x1F,
+0x3D,0x27,0x1D,0xC6,0x1A,0x1D,0x01,0xD3,0x99,0xA4,0x8D,0x9E,0x05,0x0A,0x05,0xFA,0xAE,0x85,0x0F,0x24,0x3E,0x9E,0x7B,0x01,0xD5,0x07,0x9B,0x89,0x07,0x27,0x1D,0xC2,
+0x1A,0x1D,0xC3,0x1A,0x01,0xD3,0x06,0x05,0x0A,0x05,0xFD,0xAB,0x86,0x0F,0x24,0x3E,0x3A,0xC0,0x01,0xC0,0x3C,0x01,0xCD,0x19,0x93,0xAA,0x18,0x1D,0xC4,0x1A,0x1D,0xC4,
+0x1A,0x01,0xD2,0x3E,0x12,0x98,0x8B,0x05,0xFD,0xC2,0x20,0x0F,0x35,0xC0,0x3A,0xC0,0x01,0xCD,0x18,0x99,0x99,0x3D,0x1D,0xC7,0x1A,0x1D,0xC3,0x01,0xD2,0xA0,0xA5,0x8C,
+0x89,0x05,0xFD,0xC5,0x20,0x0F,0x35,0x3E,0x3C,0x01,0xCB,0x07,0x17,0x07,0x27,0x1D,0xC3,0x1A,0x1D,0xC6,0x1A,0x01,0xD2,0x1E,0x8B,0x9B,0x05,0xFD,0xC6,0x2B,0x06,0x0F,
+0xA5,0x88,0x46,0x3A,0x01,0xC7,0x19,0x26,0xC0,0x07,0x18,0x1D,0xC2,0x1A,0x1D,0xC7,0x1A,0x1D,0x01,0xD2,0x0F,0x8A,0x8C,0x05,0x0A,0x05,0xFD,0xC6,0x3F,0x36,0x35,0xC0,
+0x3A,0xC0,0x01,0xC4,0x00,0x26,0xC0,0x1D,0xC3,0x1A,0x1D,0xC8,0x1A,0x1D,0xC0,0x01,0xD2,0x9D,0xA5,0x05,0x0A,0x05,0xFD,0xC9,0x12,0x1E,0x3E,0xC0,0x9E,0x7B,0x01,0xC2,
+0x00,0x26,0x10,0x1D,0xC3,0x1A,0x1D,0xC9,0x1A,0x1D,0xC0,0x01,0xD2,0x99,0xA4,0x0A,0x05,0xFD,0xCC,0xB0,0x95,0x35,0xC0,0x3A,0xC0,0x01,0x00,0x26,0x10,0x1D,0xC8,0x1A,
+0x1D,0xC8,0x01,0xD2,0x90,0xA7,0x05,0x0A,0x05,0xFD,0xCC,0xA7,0x85,0x1E,0xA6,0x64,0x9D,0x8C,0x27,0x99,0x98,0x3D,0x1D,0xC5,0x1A,0x1D,0xCB,0x1A,0x01,0xD1,0x31,0x2B,
+0x51,0x05,0xFD,0xCE,0xA7,0x85,0xB0,0x74,0xA6,0x87,0x06,0x1D,0xC6,0x1A,0x1D,0xCC,0x1A,0x01,0xD1,0x9C,0x95,0x8B,0x9C,0x05,0xFD,0xD0,0x7F,0x22,0xA8,0x87,0x36,0x18,
+0x1D,0xC9,0x1A,0x1D,0xC8,0x01,0xC1,0x36,0x05,0x0A,0x05,0xEA,0x14,0x05,0xE2,0xAE,0x85,0x35,0x9A,0x88,0x18,0x1D,0xC3,0x1A,0x1D,0xCD,0x01,0xC1,0x99,0xA4,0x0A,0x05,
+0xE7,0x14,0x05,0xE7,0xA9,0x97,0x24,0x9D,0x8A,0x1A,0x1D,0xCA,0x1A,0x1D,0xC5,0x01,0xC1,0x12,0x17,0x05,0xE7,0x14,0x05,0xE8,0x16,0x24,0x0F,0x18,0x1D,0xC0,0x1A,0x1D,
+0xC2,0x1A,0x1D,0xC9,0x01,0xC0,0x1E,0x8B,0x9B,0x05,0xE7,0x14,0x05,0xE9,0x14,0xA8,0x74,0x24,0x0F,0x18,0x1D,0xCB,0x1A,0x1D,0xC2,0x01,0xC0,0x07,0x8B,0x9C,0x62,0x0A,
+0x05,0xEB,0x14,0x05,0xE5,0x3F,0x24,0x9D,0x8A,0x18,0x1D,0xCD,0x1A,0x1D,0x01,0xC0,0x20,0x0A,0x05,0xE7,0x14,0x05,0xEC,0x16,0x24,0x32,0x18,0x1D,0xC0,0x1A,0x1D,0xC2,
+0x1A,0x1D,0xC6,0x01,0xC0,0x90,0xA7,0x05,0xD8,0x29,0xC0,0x31,0x05,0xE7,0x14,0x05,0xD1,0x20,0x27,0x22,0x18,0x1D,0xC0,0x1A,0x1D,0xC3,0x1A,0x1D,0xC4,0x01,0xA1,0x85,
+0x89,0xBC,0x05,0xD8,0xB9,0x76,0xBD,0x95,0x92,0x87,0x1E,0x12,0x17,0x05,0xE8,0x14,0x05,0xCE,0xAF,0x84,0x35,0x96,0x9B,0x18,0x1D,0xC0,0x1A,0x1D,0xC4,0x1A,0x1D,0xC2,
+0x01,0x07,0x8B,0x9C,0x05,0xD8,0x29,0x34,0xA6,0x99,0x34,0x21,0x36,0x92,0x89,0x05,0xC5,0xAC,0x87,0x20,0x05,0xE8,0x14,0x05,0xC5,0x22,0xA8,0x87,0x29,0x18,0x1D,0xC2,
+0x1A,0x1D,0xC6,0x01,0x99,0xA4,0x0A,0x05,0xD8,0x3C,0xFE,0xBE,0x54,0xAD,0x97,0xC1,0x96,0x87,0x8C,0x8A,0x06,0x05,0xC4,0x16,0x24,0x9D,0x8A,0x91,0x9A,0x97,0x9C,0xE9,
+0x14,0x05,0xC3,0xB5,0x84,0x35,0x13,0xA1,0x6B,0x1D,0xCA,0x01,0x90,0xA7,0x05,0xD9,0x16,0xFE,0xB5,0xB2,0x04,0xC0,0x7B,0xC0,0x9D,0x88,0x90,0x86,0x07,0x31,0x05,0xC3,
+0x06,0xB5,0x97,0x3D,0x07,0x8E,0x9B,0x17,0x05,0xE8,0x14,0x05,0xC1,0x2B,0x1E,0x38,0x27,0x1D,0xCA,0xAB,0x85,0x88,0xBB,0x05,0xD9,0x2B,0x0F,0x3A,0x0E,0xC3,0x19,0x8C,
+0x8A,0x3C,0x05,0xC2,0x14,0xBA,0x73,0x34,0xC0,0x8E,0x88,0x20,0x05,0xED,0x3F,0x24,0x9D,0x8A,0x1A,0x1D,0xC9,0x01,0xCE,0x07,0x05,0xC2,0x14,0x05,0xD6,0x1F,0x3A,0x0E,
+0x5A,0x0E,0xC2,0x9C,0x76,0x8E,0x88,0x22,0x17,0xC0,0x05,0xC0,0x20,0xBA,0x85,0x3A,0xC0,0x94,0x76,0x07,0x8B,0x9C,0x05,0xEC,0x20,0xB2,0x72,0x07,0x1D,0xC7,0x1A,0x1D,
+0x01,0xCE,0x99,0xA4,0x0A,0x05,0xDA,0x1F,0x3A,0x0E,0xC5,0x3A,0x31,0x07,0x0F,0x05,0xC1,0x07,0x19,0x04,0xC0,0x19,0x8B,0x99,0x8A,0x8B,0x97,0x9C,0xE7,0x14,0x05,0xC2,
+0x06,0x35,0x29,0x18,0x1D,0xC0,0x1A,0x1D,0xC4,0x01,0xCD,0x3E,0x12,0x05,0xC2,0x14,0x05,0xD6,0x32,0xFE,0xEF,0x98,0x0E,0xC2,0x3A,0x0B,0x0E,0xC1,0x31,0x07,0x17,0xC0,
+0x05,0x3F,0xBE,0x84,0x3A,0x0E,0xC0,0x2B,0x21,0x06,0x05,0xEC,0x36,0x35,0x13,0x1D,0xC7,0x01,0xCD,0x07,0x05,0xDC,0xBB,0x83,0xFE,0xEF,0x98,0x0E,0x0B,0x0E,0xC3,0x3A,
+0x0B,0x04,0x31,0x07,0x17,0x05,0xC0,0xB8,0x73,0x34,0x3A,0x0E,0xC0,0x2B,0x31,0x07,0x17,0x05,0xC3,0x14,0x05,0xE4,0xA5,0x88,0x1E,0x38,0xFE,0x3A,0x48,0x1D,0xC2,0x1A,
+0x1D,0xC1,0x01,0xCD,0x9B,0xA2,0x05,0xC2,0x14,0x05,0xD7,0x0F,0x15,0x0E,0xC2,0x3A,0x0B,0x04,0x0E,0xC1,0x04,0x31,0x07,0x8B,0x9C,0x05,0xAB,0x86,0x3D,0x04,0xC0,0x0E,
+0x0B,0x0E,0x19,0x87,0x9A,0x8B,0x9D,0x05,0xC2,0x14,0x05,0xE5,0x20,0xB2,0x75,0x9B,0x99,0x1A,0x1D,0xC3,0x1A,0x1D,0x01,0xCC,0x3E,0x93,0x98,0x05,0xDC,0x36,0x15,0x0E,
+0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0x0E,0xC1,0x04,0x31,0x22,0x17,0x05,0x3C,0xBE,0x98,0x0E,0x9A,0x89,0x0B,0x0E,0x0B,0x34,0x0C,0x8A,0x8B,0x97,0x9C,0xC2,0x14,0x05,
+0xE5,0x22,0xA8,0x87,0x29,0x1D,0xC2,0x1A,0x1D,0xC0,0x01,0xCC,0x3E,0x12,0x05,0xDC,0x29,0xFE,0xDE,0xF8,0x0E,0xC5,0x04,0x0E,0xC1,0x04,0x0E,0x8F,0x98,0x86,0x79,0x17,
+0x13,0xFE,0xCE,0xB3,0x04,0x21,0x0B,0x0E,0x0B,0xC0,0x34,0x89,0x98,0x20,0x05,0xEA,0x1E,0x38,0x27,0x1D,0xC3,0x1A,0x01,0xCC,0x1E,0x8B,0x9B,0x05,0xDC,0x29,0x34,0xA6,
+0x99,0x0E,0xC2,0x04,0x9C,0x8A,0x97,0x88,0x9C,0xAA,0xC0,0xA6,0x68,0xA3,0xA8,0xA5,0x86,0x0E,0x8E,0x89,0x20,0x9C,0x87,0xBE,0x86,0xA5,0x8B,0xA3,0xA6,0xB1,0x79,0xC0,
+0x0E,0x0B,0xC0,0x34,0x89,0x98,0x20,0x05,0xC2,0x14,0x05,0xE4,0x16,0x3C,0x9B,0x99,0x1D,0xC4,0x18,0xA4,0x88,0x28,0x01,0xC9,0x99,0xA4,0x0A,0x05,0xDC,0x36,0x34,0x3A,
+0x0E,0xC0,0x2B,0x2D,0x8D,0xA8,0x8F,0x8A,0x14,0x0A,0x05,0x14,0xA5,0x87,0xA6,0x89,0xAD,0x76,0xA3,0x98,0x1E,0x1F,0x1E,0xA9,0x98,0xBA,0x88,0x0E,0x0B,0x0E,0xC1,0x04,
+0x34,0x0C,0x90,0x8A,0x91,0x9D,0xC3,0x14,0x05,0xE3,0xB3,0x85,0x35,0x29,0x18,0x1D,0xC2,0x3D,0x40,0x6B,0xC0,0xA4,0x87,0x18,0x00,0xC0,0x01,0xC3,0x3E,0x12,0x05,0xDD,
+0x29,0x34,0xA6,0x99,0x9A,0x8A,0x90,0x89,0x13,0x14,0x0A,0x05,0xC1,0x32,0x7E,0xA2,0x89,0x16,0x3F,0xC0,0xAA,0x94,0xA4,0x79,0x13,0x0C,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,
+0x0B,0x0E,0x0C,0x8A,0x76,0x8F,0x97,0x05,0xC2,0x14,0x05,0xE3,0xA9,0x85,0x24,0x1E,0x18,0x1D,0xC0,0x3D,0x40,0x26,0x3D,0xC3,0x1F,0x26,0x3D,0xC0,0x27,0x00,0xC0,0xA7,
+0xA4,0x89,0x9C,0x9C,0x8A,0xDD,0x13,0xBB,0x74,0x30,0x15,0x05,0xC0,0x15,0xA8,0x88,0xAC,0x87,0x33,0xAB,0x76,0xA4,0x99,0x0C,0xA5,0x86,0x9D,0x9A,0x0C,0x2B,0x19,0x0B,
+0x82,0x98,0x0B,0x04,0x0E,0xC1,0x04,0x0E,0x5A,0x0E,0xC0,0x34,0x89,0x98,0x8C,0x8C,0x05,0xE7,0x14,0x06,0x35,0x97,0x99,0x26,0xC1,0x18,0x9C,0xA9,0xC9,0x26,0x18,0x36,
+0x05,0xDE,0x06,0xA7,0x85,0x95,0xAF,0xB0,0x76,0x11,0xAB,0x98,0x7F,0x0B,0x6B,0x0B,0xC0,0x0E,0xC1,0x04,0x0E,0x0B,0xC0,0x0E,0x8D,0x86,0xC0,0x04,0x0B,0x0E,0xC0,0x0B,
+0x0E,0x0B,0xC0,0x0E,0xC0,0x34,0x89,0x98,0x8C,0x8C,0x95,0x9B,0xE8,0x39,0xA4,0x96,0x36,0x27,0x25,0xC0,0x9C,0x88,0xCA,0xA9,0x84,0x9A,0x88,0x05,0xDE,0x06,0x21,0x2B,
+0x0E,0x0B,0x0E,0xC1,0x04,0x0E,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x9C,0x76,0x91,0x98,0x04,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0xC1,0x19,0x3C,0x46,0x8B,0xBA,0x05,
+0xE7,0x20,0xB3,0x83,0x97,0x9C,0x25,0xC1,0x9C,0x88,0xCA,0xAC,0x73,0x91,0x9A,0x97,0x9C,0xDE,0x06,0x34,0xA6,0x99,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0xC3,0x3A,0x0B,
+0x04,0x0E,0xC1,0x96,0x76,0x04,0x0B,0x0E,0x0B,0xC0,0x0E,0xC2,0x98,0x8A,0x36,0x05,0x36,0x0F,0x8A,0x8C,0x05,0xE6,0x14,0xB7,0x73,0x24,0x95,0xAE,0x25,0xC0,0x3D,0xC9,
+0xA3,0x87,0xA8,0x75,0x8B,0x9C,0x05,0xDE,0x06,0x34,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC2,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0xFE,0x5B,
+0x4A,0x05,0xC0,0xA9,0x97,0x3C,0x0A,0x05,0xC2,0x14,0x05,0xE2,0x20,0xB2,0x72,0x07,0x25,0xC0,0x3D,0xC8,0xA3,0x87,0xA4,0x86,0x6C,0x8D,0x9E,0x05,0xDE,0x06,0xB5,0x97,
+0xAC,0x79,0x37,0x0B,0xA4,0x99,0x0C,0x0E,0x5A,0x0E,0xC1,0x04,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0x0E,0x8E,0x89,0x90,0x79,0x11,0x2D,0x0C,
+0x34,0x89,0x98,0x8C,0x8C,0x95,0x9B,0xE7,0x1E,0xA2,0x84,0xFE,0x4A,0x27,0x25,0x9C,0x88,0xC6,0xA3,0x87,0x3D,0xC0,0xAC,0x73,0x91,0x9A,0x97,0x9C,0xDF,0x06,0x07,0x31,
+0x14,0x0A,0x05,0x3F,0xB2,0x77,0x11,0x2A,0x12,0x0B,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0xC1,0x04,0x0E,0x0B,0xC2,0x19,0xC0,0x04,0x0B,0x0E,0xC1,0x93,0x79,0x0F,0x8A,
+0x8C,0x05,0xE6,0xA9,0x97,0x24,0x9D,0x8A,0x25,0x3D,0xC6,0xA3,0x87,0x3D,0x6E,0xAB,0x84,0x1F,0x05,0xDF,0x06,0xBC,0x98,0xAA,0x89,0x55,0x37,0x33,0x96,0x89,0x90,0x88,
+0x0A,0x00,0x2D,0xAB,0xA7,0x59,0xC0,0x0E,0xC2,0x04,0x0E,0x0B,0xC2,0x0E,0xC1,0x9C,0x76,0x96,0x88,0x04,0xC0,0x0E,0x0B,0xC0,0x0E,0xC0,0x87,0x88,0x8A,0x89,0x05,0xE7,
+0xB8,0x73,0x24,0x95,0xAE,0x9C,0x79,0xC6,0xA3,0x87,0x3D,0xA7,0x85,0xC0,0x05,0xC2,0x14,0x05,0xDB,0x13,0x19,0xAA,0x9F,0xC2,0x54,0xFE,0x6B,0xAB,0x8F,0x57,0x99,0xBB,
+0xA4,0xAA,0x37,0x12,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x61,0x0B,0x0E,0x92,0x76,0x2B,0x0E,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x97,0x9A,0x86,0x86,0x8B,0x9D,0x9A,
+0x89,0xE6,0x36,0x3C,0x29,0x18,0x9C,0xA9,0xC7,0xAB,0x94,0x98,0x78,0x05,0xE0,0xB0,0x74,0x34,0xA8,0x9E,0xC2,0x11,0x8D,0x23,0xC0,0x98,0xCD,0x17,0xA3,0x99,0xFE,0xB5,
+0xB2,0x04,0x0B,0xC0,0x0E,0xC3,0x04,0x0E,0x0B,0xC1,0x96,0x86,0xC0,0x0E,0xC3,0x93,0x79,0x16,0x00,0x29,0x1E,0x9D,0x85,0x05,0xE7,0xB8,0x73,0x24,0x3D,0xC6,0xA3,0x87,
+0x3D,0xAC,0x73,0x1F,0x05,0xC2,0x14,0x05,0xDB,0x13,0x19,0x31,0xC1,0x9B,0x87,0xFE,0x33,0x25,0xA1,0x34,0x9B,0xBA,0xFE,0x00,0xA0,0x0A,0x05,0x3F,0x37,0x12,0x69,0xC0,
+0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0x0E,0x9D,0x88,0x92,0x98,0x0B,0xC0,0x0E,0xC0,0x2A,0x30,0x85,0x8A,0x17,0x05,0x19,0xB7,0xA6,0x35,0x8A,0x9B,0x05,0xE6,0x13,0x35,0x3D,
+0xC7,0x13,0xA5,0x77,0x05,0xE1,0xB4,0x72,0x34,0xA8,0x9E,0xC1,0x2D,0xFE,0x1B,0x41,0x0C,0x92,0xFF,0x19,0x05,0x2B,0xA5,0x8A,0xC0,0x2D,0xAB,0xA7,0x0E,0xC2,0x51,0x0B,
+0x04,0x0E,0xC0,0x96,0x76,0xA6,0x88,0x0E,0x0B,0xC0,0x2A,0xFE,0x5B,0x4A,0x05,0xC0,0x2B,0xAE,0x34,0xA4,0x65,0x2D,0x21,0x87,0x88,0x17,0x05,0xE5,0x3F,0x3C,0x3D,0xC6,
+0xA3,0x87,0xA4,0x86,0x9C,0x87,0x05,0xE1,0x29,0x34,0x31,0xC1,0x93,0x74,0x12,0x4A,0x96,0xCC,0x0A,0x05,0x06,0xAA,0x64,0x10,0x25,0x2A,0xA4,0x88,0x69,0x0E,0x0B,0xC0,
+0x0E,0xC1,0x0B,0x92,0x86,0x04,0x0E,0xC0,0x98,0x8A,0x83,0x79,0x05,0xC2,0xB3,0x33,0xA6,0x22,0x11,0x33,0x87,0x85,0x87,0x9A,0x05,0xE6,0xB8,0x73,0x94,0xCD,0xC3,0x02,
+0xC1,0x3D,0x36,0x31,0x05,0xE1,0x13,0x34,0x1B,0xA1,0x9A,0xC0,0x2A,0xFE,0x2B,0x24,0x0C,0x19,0x2C,0xC0,0x19,0x2C,0xB4,0xCD,0x9E,0xDB,0x30,0x0B,0x12,0x0B,0xC0,0x0E,
+0xC1,0x0B,0x96,0x86,0x15,0x0B,0x0E,0x98,0x8A,0x81,0x6A,0x94,0x76,0xA4,0x87,0x93,0xBC,0x05,0xC0,0xAF,0x21,0xAA,0x34,0x11,0x1B,0x21,0x22,0x05,0xC2,0x14,0x05,0xE1,
+0xAE,0x85,0x9E,0xCB,0xC4,0x06,0x02,0xA3,0xA6,0x36,0x8B,0xAD,0x05,0x0A,0x05,0xDF,0x22,0xBA,0x97,0x0B,0xA0,0x9D,0xC1,0x11,0x8D,0x23,0x0C,0x2C,0x0C,0x2C,0xAA,0xA9,
+0xB8,0xFE,0x1B,0x33,0xAB,0x76,0x12,0x69,0xC0,0x0E,0x0B,0xC0,0x0E,0x22,0x0B,0xC0,0x0C,0x36,0x25,0x19,0xC0,0x93,0xBC,0x9A,0xBB,0xA3,0x77,0xAE,0x53,0xA4,0x55,0xFE,
+0xBE,0x54,0x31,0x97,0x85,0x86,0x86,0x89,0x9C,0x05,0xE5,0xA6,0x87,0x09,0xC1,0x06,0x09,0xC1,0x06,0x36,0x13,0x05,0x0A,0x05,0xE0,0xB3,0x84,0xAF,0x98,0x33,0xB3,0x89,
+0x31,0xC0,0x1B,0x21,0x1D,0x9A,0x89,0xA1,0x75,0xAD,0xCD,0x0C,0x31,0xC0,0x33,0x30,0xBB,0x86,0x0E,0x5A,0x0E,0x0B,0xC0,0x9A,0x99,0x9C,0x75,0x04,0x2B,0x81,0x8B,0xB1,
+0xA9,0x2D,0x85,0x44,0xA1,0x34,0x9E,0xCB,0x2C,0x19,0x12,0xA6,0xBB,0x33,0xC0,0x30,0x58,0x90,0x89,0x90,0x9C,0xE6,0x09,0xC1,0x5A,0x09,0xC2,0x1E,0x92,0x88,0x05,0xE2,
+0xB3,0x85,0x34,0xA0,0x9B,0x11,0x9C,0x99,0x21,0x2D,0x0C,0x2D,0x37,0x21,0xA5,0x78,0x37,0x0B,0x33,0xC0,0x30,0x2B,0x0E,0x5A,0x0E,0x0B,0xC0,0x96,0x86,0xA6,0x88,0x0B,
+0x11,0x37,0x31,0xC0,0x37,0x1D,0x28,0xA1,0x65,0x4A,0x2C,0x3D,0x7F,0x30,0x2B,0x34,0x1E,0x05,0xC2,0x14,0x05,0xE1,0x09,0xC1,0x06,0x09,0xC2,0xAC,0x41,0x17,0xC0,0x05,
+0xE1,0xB5,0x84,0x34,0xA6,0x99,0x0E,0xC0,0x2B,0x3D,0x37,0xC1,0xA4,0x66,0x3D,0x0C,0x2A,0x3A,0x0E,0x5A,0x0E,0xC2,0x59,0x0E,0x8F,0x98,0x04,0xC0,0x21,0xC0,0xAD,0x8B,
+0x1B,0x31,0x33,0x98,0x75,0x37,0x0B,0xC0,0x95,0xAB,0x21,0xB0,0x79,0xA2,0x86,0xC0,0x86,0x87,0x83,0x9B,0x99,0x9C,0xE5,0x09,0xC1,0x06,0x09,0xC1,0xA7,0x77,0xA3,0x52,
+0x05,0xE3,0x07,0x19,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x92,0x76,0x04,0x0E,0x5B,0x0C,0x11,0x33,0xC4,0xAB,0x76,
+0x2A,0x12,0x69,0xC0,0x0E,0x31,0xFE,0x3A,0x03,0x05,0xE5,0x09,0xC1,0x06,0x09,0xC1,0xAF,0x44,0x3C,0x05,0xE3,0x36,0x34,0xA6,0x99,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0xC0,
+0x0E,0xC1,0x0B,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC1,0x31,0x04,0x0E,0x12,0x0B,0xC0,0x0E,0xC1,0x0B,0xC0,0x12,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x34,0x1E,0x87,0xAD,
+0x05,0xE4,0x09,0xC1,0x06,0x09,0xC1,0x32,0x89,0x9B,0x05,0xE3,0x07,0x19,0x0B,0x0E,0xC1,0x04,0x0E,0x0B,0xC2,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x31,0x04,0x0E,
+0x12,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC0,0x0E,0xC0,0x34,0x32,0x8C,0x89,0x05,0xE4,0xA9,0xC9,0x06,0xC3,0x00,0x07,0x0F,0x05,0xE3,0xB8,0x73,0x34,
+0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x92,0x86,0x04,0xC0,0x0E,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC1,
+0x11,0x1E,0x3C,0x05,0xE4,0x2D,0xC4,0xB2,0x42,0x90,0x8B,0x05,0xE4,0x1E,0x34,0x3A,0x0E,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0xC2,0x0E,0x93,0x79,
+0x04,0x0E,0x5A,0xC0,0x0E,0xC1,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0xFE,0x6B,0xAB,0x13,0x36,0x08,0x5A,0x0A,0x05,0xE1,0x2D,0xC3,0xA7,0x76,0x1E,0x1F,0x05,0xE4,
+0x32,0xFE,0xEF,0x98,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0x34,0x15,0x0E,0x0B,0xC0,0x0E,0xC1,0x04,0x0E,0x0B,0xC2,0x0E,0x0B,
+0xC0,0x95,0x8B,0xFE,0x18,0xE2,0xA2,0x89,0x0F,0x8A,0x8C,0x05,0xE3,0xA9,0xC9,0xC3,0x0D,0x9D,0x77,0x0A,0x05,0xE4,0x32,0x2B,0x0B,0x0E,0xC1,0x04,0x0E,0x0B,0xC2,0x0E,
+0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x2B,0x19,0x04,0x0B,0x0E,0xC2,0x04,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x30,0x05,0xC0,0xB8,0x73,0x91,0x9A,0x97,0x9C,0xE3,0x2D,
+0x69,0xC1,0x2D,0x0D,0x3F,0x05,0xE5,0xFE,0x7C,0x2B,0xBC,0x98,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x31,0xAA,
+0x88,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x3D,0xFE,0x21,0x24,0x05,0x14,0x32,0x90,0x8A,0x05,0xE3,0x26,0xC0,0x2D,0x26,0x36,0x0F,0x05,0xC2,
+0x14,0x05,0xE1,0x1F,0x3A,0x0E,0x0B,0xC1,0x0E,0xC1,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC1,0x2B,0x22,0x0E,0xC1,0x04,0x0E,0x0B,0xC2,0x0E,0x0B,0xC1,
+0x30,0x05,0xC0,0x0A,0x07,0x3C,0x05,0xE3,0x26,0xC0,0x2D,0x26,0x1E,0x92,0x88,0x05,0xE5,0xA5,0x87,0xFE,0x94,0xCD,0x3A,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,
+0xC1,0x0B,0x0E,0x0B,0xC3,0x0E,0x0B,0xC0,0x0E,0x22,0x34,0x3A,0x0E,0xC0,0x0B,0xC2,0x0E,0xC0,0x0B,0x0E,0x0B,0x93,0x89,0x2B,0x17,0x05,0xC0,0x29,0x6C,0x05,0x0A,0x05,
+0xE1,0x2D,0xC1,0x13,0x24,0x17,0xC0,0x05,0xE4,0xA6,0x87,0xBE,0x73,0xB8,0x99,0x0E,0x5A,0x0E,0xC0,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0xC3,0x31,0xAB,
+0x9A,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0xC0,0xFE,0x5B,0x4A,0x05,0xC2,0x13,0x36,0x08,0x05,0xE2,0x2D,0x26,0x2D,0x0D,0x9C,0x78,0x17,0x05,0xE5,0x3F,0x00,
+0x3A,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0xC4,0x0E,0x0B,0x9A,0x99,0x31,0x2B,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0xC3,0x3A,0x0B,0x93,0x89,0xFE,0x10,0xC1,
+0x05,0x0A,0x05,0xC0,0x3C,0xAA,0x76,0x05,0xC2,0x14,0x05,0xDE,0x2D,0xC1,0xB2,0x42,0x8E,0x8A,0x97,0x9C,0xE6,0xAC,0x87,0xBF,0x82,0x04,0x6B,0xC1,0x0E,0x0B,0xC0,0x0E,
+0xC1,0x0B,0x0E,0x0B,0xC4,0x0E,0x0B,0x19,0x04,0xC0,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x9D,0x98,0xFE,0x52,0xC6,0x05,0xC3,0xA9,0x97,0x22,0x17,0x05,0xE2,
+0x2D,0xC0,0x1D,0x1E,0x8B,0x9B,0x05,0xE6,0xB0,0x74,0x21,0x0E,0xC2,0x3A,0x0B,0x04,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC5,0x0E,0x0B,0xC0,0x0E,
+0xC1,0x0B,0x0E,0x0B,0xC0,0x33,0x05,0xC2,0x14,0x05,0x16,0x39,0x05,0xC2,0x14,0x05,0xDD,0x3F,0x2D,0xC0,0x0D,0x98,0x78,0x05,0xC2,0x14,0x05,0xE2,0x13,0x31,0x04,0x0E,
+0x5B,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC4,0x0C,0x55,0xA7,0x97,0x0E,0x0B,0x0E,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0x0E,0x95,0x7B,0xFE,0x18,0xE2,0x05,
+0xC4,0xA9,0x85,0xAE,0x74,0xFE,0x00,0x20,0xC2,0x14,0x05,0xDD,0xB1,0x93,0x98,0xBE,0xC0,0x0D,0x90,0x79,0x05,0xE7,0x36,0x0F,0x2A,0x12,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,
+0xC1,0x0B,0x0E,0x0B,0xC2,0x2A,0x21,0x22,0x92,0x8C,0x3A,0x29,0xBA,0x88,0xAB,0xA7,0x0E,0xC2,0x04,0x0E,0x0B,0xC0,0x2B,0x29,0x05,0xC5,0xA9,0x85,0x07,0x8B,0x9C,0x62,
+0xE1,0x24,0x8E,0xCF,0x0D,0x22,0x05,0xC2,0x14,0x05,0xE3,0x1E,0x10,0x33,0x12,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC1,0x11,0x3C,0x05,0xC3,0xAC,0x87,
+0x2A,0x12,0x0B,0xC2,0x0E,0x0B,0xC0,0x30,0x05,0xC6,0xAB,0x86,0x07,0x0F,0x05,0xE0,0x20,0x27,0x2D,0x0D,0x3C,0x05,0xE7,0x32,0xB7,0x64,0x8F,0x79,0x99,0xBB,0x37,0x12,
+0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0x9A,0x99,0x84,0x79,0x84,0x9B,0xC2,0x14,0x05,0xC1,0x21,0x04,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x33,0x05,0xC7,0xAB,
+0x84,0x22,0x17,0x05,0xE0,0x24,0x9D,0x8A,0x13,0xAB,0x76,0x1F,0x05,0xE6,0x14,0xAF,0x74,0xAF,0x74,0x8C,0x6C,0x99,0xBB,0x36,0x3D,0x0E,0xC1,0x04,0x0E,0x0B,0xC2,0x0E,
+0x95,0x7B,0x13,0x14,0x05,0xC1,0x32,0xAA,0x87,0x07,0x25,0x95,0x87,0xFE,0x94,0xCD,0xB7,0x99,0x0B,0x0E,0x0B,0xC0,0x0E,0x33,0x17,0xC0,0x05,0xC6,0x3C,0x6D,0x05,0xE0,
+0x3C,0x35,0x96,0x9B,0xC0,0xA5,0x87,0x8A,0x8C,0x05,0xE7,0x22,0xA8,0x87,0x94,0x16,0x92,0xFF,0x05,0xB4,0x67,0x2A,0xA4,0x88,0x0B,0xC3,0x0E,0x0B,0x93,0x89,0x36,0x0A,
+0xA4,0x87,0x29,0x33,0x0B,0x2A,0xA2,0x97,0x0E,0x3A,0x3D,0x37,0xB1,0x76,0xC0,0x0E,0xC1,0x86,0x77,0x17,0xC0,0x05,0xC7,0x3C,0x6D,0x05,0xE0,0x1E,0x55,0x98,0x89,0x24,
+0x3A,0x05,0xE6,0x14,0x05,0x29,0x06,0x9F,0x58,0x93,0xCC,0x05,0xC0,0xBC,0x75,0x2A,0x12,0x0B,0xC3,0x2D,0xFE,0x21,0x65,0xC0,0x30,0x2D,0xA9,0xA6,0x0E,0x0B,0x0E,0xC0,
+0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x33,0x17,0x9D,0x9A,0x0A,0x05,0xC7,0x06,0x9B,0x98,0x17,0x05,0xDE,0x06,0xAB,0x97,0x20,0x57,0xB0,0xA3,0x8F,0x7B,0x97,0x9C,0xE8,0x29,
+0x12,0xA4,0x58,0x0F,0x05,0xC1,0xBC,0x75,0x2A,0x0B,0xC0,0x0E,0xC0,0x9D,0x88,0xFE,0x52,0xC6,0x05,0x2A,0x0B,0xC1,0x0E,0xC1,0x0B,0xC3,0x0E,0x0B,0x9A,0x99,0x84,0x8B,
+0x84,0x89,0xC2,0x14,0x05,0xC6,0xB4,0x72,0x93,0x9B,0x05,0xDE,0x31,0xB4,0x86,0x36,0x97,0x9C,0x6B,0xAC,0x81,0x17,0x05,0xE6,0x14,0x05,0x29,0x92,0x8A,0xAE,0x34,0x91,
+0xCC,0x0A,0x05,0xC1,0xBC,0x75,0x2A,0xA4,0x88,0x0B,0xC0,0x93,0x89,0x21,0xAD,0x8B,0xA5,0x85,0xC0,0x9D,0x98,0x2A,0x3A,0x9A,0x8A,0x9B,0x77,0x95,0xAB,0xB2,0x86,0xA6,
+0x77,0x0E,0xC1,0x2D,0x82,0x96,0x8B,0x9D,0xCC,0xB3,0x84,0x17,0x05,0xDD,0xA5,0x87,0x1E,0x55,0x3C,0x4F,0x3D,0xA5,0x93,0x05,0xE8,0xA9,0x97,0x07,0x8B,0x9C,0xAD,0x65,
+0x98,0x89,0x05,0xC2,0x14,0xB8,0x65,0x0C,0x0E,0x0B,0x0E,0x0B,0xC1,0x0E,0x97,0x8A,0x93,0x85,0xC0,0xA4,0x9B,0x0C,0x3A,0x0E,0x0B,0x0E,0x9D,0x88,0x33,0x16,0x05,0x6E,
+0x05,0xCB,0x22,0x17,0x05,0xDD,0x20,0x27,0x06,0x9C,0x9C,0xC1,0x9B,0x85,0x05,0xE8,0x06,0x13,0x14,0x2E,0x9B,0x88,0x9A,0xBB,0x05,0xC2,0x14,0xB3,0x67,0x2D,0x12,0x0B,
+0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC0,0x2D,0x29,0x05,0xCE,0xA5,0x87,0x13,0x14,0x05,0xDC,0xA9,0x85,0x35,0x20,0x26,0x3D,0xC1,0x17,0xC0,0x9D,0x9A,0xE7,
+0xB8,0x73,0x16,0x05,0xAA,0x66,0x4C,0x19,0x05,0xC4,0xAC,0x87,0xFE,0xBE,0x54,0xAD,0x97,0x0E,0x5A,0xC0,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0x9D,0x98,0x33,0x80,0x89,0x05,
+0xCF,0x3F,0xAA,0x94,0x05,0x6E,0x05,0xDA,0xA5,0x87,0x1E,0x39,0x18,0x3D,0xC2,0x05,0xC2,0x14,0x05,0xE4,0xB5,0x84,0x05,0xC0,0xAB,0x55,0xA4,0x87,0x05,0x0A,0x05,0xC4,
+0x32,0x33,0xB3,0x89,0x12,0x0B,0xC2,0x0E,0x0B,0xC0,0x21,0x22,0x05,0xD1,0xAB,0x86,0x9C,0x87,0x05,0xDC,0x24,0x0F,0x97,0x9C,0x3D,0xC3,0x05,0xE6,0x14,0x05,0x3F,0x36,
+0x05,0xC0,0x32,0xAA,0x54,0x93,0xBC,0x05,0xC7,0x29,0x2D,0x12,0x0B,0xC1,0x2A,0x21,0x00,0x05,0xC2,0x14,0x05,0xCE,0xAC,0x87,0x2B,0x17,0x05,0xDA,0xB3,0x85,0x24,0x94,
+0x8D,0x3D,0xC4,0x94,0x89,0x05,0xE6,0x14,0xAF,0x74,0xC0,0x05,0xC0,0x2B,0xB3,0x22,0xA6,0x76,0x99,0x9A,0x98,0x99,0x5A,0x9C,0xBB,0xC1,0x10,0xA4,0xAA,0xAB,0x64,0xA8,
+0x87,0x9F,0x66,0x01,0xAB,0xCB,0xA4,0x99,0x91,0x9A,0x8A,0x97,0x05,0xC2,0x14,0x05,0xD0,0xA8,0x88,0x05,0x14,0x05,0xD9,0xB0,0x74,0x07,0x0F,0x9D,0x9A,0xC5,0x94,0x89,
+0x05,0xE6,0x14,0x29,0x94,0x88,0x05,0xC1,0xFE,0x3B,0xE5,0xB4,0x50,0xC1,0x9A,0x8A,0xC2,0xA4,0x87,0x69,0xA3,0x88,0xC1,0x1A,0x98,0x88,0x8F,0xBF,0xFE,0x09,0x21,0x99,
+0xBB,0x05,0xE8,0x14,0x05,0xC7,0x3F,0x24,0x22,0x18,0x3D,0xC5,0x05,0xE7,0x14,0x29,0x17,0xC0,0x05,0xC0,0xFE,0x43,0xE6,0x1F,0xC0,0x1A,0x6D,0x6F,0xC1,0x18,0xC0,0x24,
+0x18,0x24,0x18,0x24,0x96,0x99,0xFE,0x0A,0x00,0x05,0x6E,0x05,0xF0,0x3F,0x1E,0x29,0x9D,0x7B,0x3D,0xC6,0x05,0xE7,0x16,0x22,0x17,0x05,0xC1,0xFE,0x3B,0xE5,0x1A,0x6D,
+0x24,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0xC2,0x24,0x06,0x19,0xFE,0x00,0x60,0x05,0xE8,0x14,0x05,0xC5,0x3A,0x1E,0x29,0x3D,0xC8,0x0C,0x05,0xE6,0xB0,0x74,0x65,0x05,
+0xC2,0x13,0x1A,0x18,0x24,0xC0,0x18,0xC0,0x24,0x18,0x24,0x18,0x8F,0xAD,0xC0,0x0D,0x69,0x18,0x8B,0xBF,0xFE,0x00,0xA0,0x0A,0x05,0xE7,0x14,0x05,0xC5,0x07,0xC0,0x3D,
+0xC6,0xA3,0x87,0x3D,0x6E,0x0C,0x05,0xDE,0x37,0xA3,0x77,0xA4,0x65,0xA4,0x9A,0xA4,0x65,0x61,0x0C,0x9C,0xA9,0xA5,0x87,0x9B,0x79,0x37,0x0A,0xC0,0x05,0xFE,0x3B,0xE5,
+0x1A,0x18,0x6F,0x18,0x24,0x18,0x24,0x18,0xC0,0x0D,0xFE,0x5B,0xA9,0x9F,0x9B,0x1C,0x24,0xC0,0x96,0x99,0xFE,0x0A,0x00,0x05,0xC2,0x14,0x05,0x06,0x13,0xA0,0x9A,0x2E,
+0x7A,0x06,0x99,0xBB,0x05,0xE2,0xB8,0x73,0x1E,0x3C,0x3D,0xC6,0xA3,0x87,0x3D,0x02,0x93,0x9A,0x05,0xDB,0x37,0x31,0xFE,0x23,0xC1,0x39,0x0A,0x2C,0x0D,0x69,0x2C,0x8D,
+0xAD,0x91,0xDF,0x7F,0xC0,0x24,0x2E,0x24,0x99,0xBB,0x1D,0x1F,0x18,0xC1,0x6F,0x18,0x24,0x18,0xC0,0x0D,0xFE,0x4C,0x07,0xFE,0x73,0xAD,0x2C,0x1F,0xC0,0x1A,0x12,0xFE,
+0x00,0x60,0x05,0xA7,0x55,0xA8,0x66,0xAF,0x64,0x39,0x0A,0x39,0x06,0x19,0xA6,0x86,0x31,0x2E,0x0F,0x05,0x6E,0x05,0xDE,0xB0,0x95,0xAB,0x77,0x3C,0x3D,0xC6,0xA3,0x87,
+0x3D,0x02,0x3D,0x05,0xDB,0x37,0x3B,0xAE,0x65,0x0D,0x1F,0xC0,0x1A,0x18,0xC0,0x6F,0x98,0x9A,0xFE,0x0A,0x00,0x05,0xC2,0xA5,0x88,0xA6,0x55,0x15,0x0D,0x69,0x18,0xC0,
+0x24,0x18,0x24,0x18,0xC0,0x0D,0x8E,0xBF,0x16,0xA0,0x54,0x0D,0x06,0x18,0x8F,0xAD,0xFE,0x12,0x02,0xA9,0x76,0xB0,0x51,0x0D,0x06,0x18,0xC1,0x12,0x19,0x0A,0x05,0xAF,
+0x53,0xC0,0x93,0xBD,0x05,0xDE,0xA9,0x85,0x35,0x93,0x9B,0x3D,0xC6,0xA3,0x87,0x3D,0x02,0x3D,0xC0,0x94,0x88,0xDA,0xAB,0x44,0x12,0x0D,0x18,0x6F,0x18,0x24,0x18,0xC3,
+0x94,0x8B,0xFE,0x01,0x60,0x19,0x05,0xC2,0x06,0x3B,0xB2,0x63,0x1F,0x18,0x24,0x18,0x24,0x18,0xC1,0x39,0xFE,0x6B,0xAB,0xC0,0x2C,0x18,0x24,0x25,0x9A,0xAD,0x1A,0xC0,
+0x18,0xC3,0x0D,0xFE,0x0A,0x00,0xFE,0x00,0x20,0xC1,0xAA,0x66,0x4C,0x0A,0x05,0xDD,0x1E,0x9A,0x89,0x3D,0xC7,0x0F,0x3D,0x02,0x3D,0xC0,0x05,0xDA,0xB8,0x21,0xFE,0x6E,
+0x26,0x1F,0x18,0xC0,0x24,0x18,0x24,0x18,0xC3,0x3B,0x19,0x05,0xC3,0x1D,0x39,0x1A,0xC0,0x18,0xC4,0x25,0xFE,0x4C,0x07,0x9A,0xDE,0xFE,0x5D,0xA6,0x18,0xC1,0x0E,0x0D,
+0x18,0x24,0x18,0x24,0x18,0xC1,0x12,0xFE,0x01,0x00,0x05,0xC0,0x2B,0x2A,0x93,0xBD,0x05,0x0A,0x05,0xDA,0xB0,0x74,0xA8,0x87,0x36,0x3D,0xC7,0xA3,0x87,0x3D,0x02,0x3D,
+0xC0,0x05,0xD9,0x2B,0x39,0x1A,0x18,0xC9,0x2C,0x13,0x05,0xC3,0x17,0xFE,0x65,0xA7,0x35,0x1A,0xC0,0x18,0xC4,0x0E,0x39,0x1A,0x18,0xC1,0x0E,0x0D,0x69,0x18,0xC5,0xFE,
+0x0A,0xA0,0x19,0x05,0xC0,0xA7,0x78,0x10,0x97,0xBB,0x05,0xDA,0x2B,0x1E,0x96,0x8B,0x3D,0xCD,0x05,0xD9,0x2B,0xFE,0x55,0x63,0x18,0x24,0x18,0x24,0x18,0xC7,0x8F,0xAD,
+0x19,0x05,0xC2,0xA8,0x55,0x0E,0x0D,0x35,0x1A,0x18,0xCA,0x0D,0x39,0x1A,0x18,0xC5,0x12,0x19,0x9D,0xAA,0x05,0xC0,0x15,0x4C,0x0A,0x05,0xD9,0xB0,0x95,0xA5,0x77,0x3D,
+0xCE,0x05,0xD9,0x10,0xFE,0x65,0xA7,0x18,0xCB,0x0D,0xFE,0x23,0x03,0xFE,0x00,0x60,0x05,0xC2,0xFE,0x3B,0xE5,0x1F,0xC0,0x35,0x1A,0x18,0xC9,0x0D,0x89,0xAE,0x36,0x18,
+0xC0,0x24,0x18,0x24,0x18,0xC0,0x0D,0x06,0x99,0xBB,0x05,0xC1,0xAF,0x54,0x0F,0x05,0xD9,0xB8,0x73,0x3C,0x3D,0xC6,0xA3,0x87,0x3D,0x02,0x3D,0xC3,0x97,0x87,0x05,0xD8,
+0xAF,0x33,0x36,0x18,0xCC,0x35,0xFE,0x01,0x60,0x19,0x05,0xC1,0xB4,0x42,0x36,0x18,0xC0,0x35,0x1A,0x18,0xC8,0x99,0x9C,0x06,0x32,0xB7,0x51,0x18,0xC5,0xFE,0x23,0x41,
+0xFE,0x00,0x60,0x05,0xC1,0xA9,0x78,0x10,0x0F,0x05,0xD7,0x2B,0x1E,0x3C,0x3D,0xCC,0x26,0x74,0x05,0xD9,0x24,0x36,0x18,0xCD,0x15,0x0F,0x05,0xC1,0xA9,0x85,0x36,0x18,
+0xC1,0x35,0x1A,0x18,0xC7,0x0E,0xFE,0x00,0xA0,0x2B,0xFE,0x3C,0x62,0x0D,0x18,0xC4,0x12,0x19,0x9C,0xAA,0xC1,0xA5,0x88,0x10,0x19,0x0A,0x05,0xD6,0x3C,0xAA,0x76,0x97,
+0x9C,0x3D,0xC2,0x69,0x20,0x16,0x7B,0xA0,0xA8,0xC0,0xA0,0xA6,0x61,0xA0,0xB8,0x79,0xA2,0xA7,0xC0,0x05,0xD9,0x2E,0xFE,0x65,0xA7,0x18,0xCD,0x97,0x9A,0x37,0x19,0x05,
+0xC1,0x39,0x1A,0x18,0xC1,0x0E,0x0A,0x18,0xC6,0x3B,0x19,0x05,0x10,0xBF,0x40,0x18,0xC4,0x0E,0x28,0x05,0xC2,0x03,0x10,0x97,0xBB,0x05,0xD6,0xB3,0x85,0x6C,0x26,0xC0,
+0x1E,0x0D,0xA2,0x99,0x16,0x12,0xA3,0x99,0x25,0xA1,0xA9,0x25,0x37,0x71,0xC0,0x7E,0x6F,0x7E,0xFE,0x00,0x20,0xD9,0x2E,0x36,0x18,0xCE,0xFE,0x23,0x03,0x0F,0x05,0xC1,
+0x1D,0x1F,0x18,0xC2,0x99,0x9B,0x99,0x99,0xAB,0x87,0x1F,0x18,0xC2,0x9D,0x9B,0xFE,0x0A,0x00,0x05,0xC1,0xB8,0x21,0xB7,0x51,0x18,0x6F,0x18,0x24,0x18,0xC0,0xFE,0x02,
+0x00,0x92,0xFF,0x05,0xC2,0xAF,0x54,0x0F,0x05,0xC1,0x0A,0x05,0x14,0x05,0xD0,0xB0,0x95,0xA0,0xE4,0x99,0xEB,0x37,0x29,0xA3,0x98,0xC2,0x29,0xC0,0x66,0xC3,0x05,0xC0,
+0x6E,0xFE,0x00,0x20,0xD9,0xAF,0x33,0x36,0x18,0xCE,0x0E,0x28,0x05,0xC1,0x32,0x19,0x18,0xC4,0x8F,0xAD,0x2C,0x18,0xC2,0x0E,0xFE,0x00,0xA0,0x9D,0xAA,0x05,0xC1,0xBF,
+0x20,0x1F,0x18,0x6F,0x18,0x24,0x18,0xFE,0x0A,0xA0,0x19,0x05,0xC2,0xA9,0x85,0xA2,0x58,0x0F,0x62,0xD5,0x22,0xFE,0x8A,0x21,0x29,0xC0,0x3D,0x7E,0xC1,0x6E,0x29,0xC0,
+0x66,0x29,0xC0,0x24,0x29,0x05,0xC0,0x0A,0xFE,0x00,0x20,0xD9,0xAB,0x44,0xFE,0x55,0x63,0x18,0xCE,0x99,0x9B,0xFE,0x0A,0x00,0x05,0xC1,0xB3,0x33,0x1A,0xC0,0x18,0xC4,
+0x25,0x0A,0x18,0xC0,0x99,0x9C,0x0C,0x8F,0xDD,0x05,0xC2,0x06,0x39,0x1A,0x18,0xC2,0xFE,0x1B,0x41,0x0F,0x05,0xC3,0x31,0x0F,0x05,0xC1,0x6E,0xC0,0x05,0x14,0x05,0xCE,
+0x22,0xA1,0xF7,0x29,0xC0,0x24,0x29,0xA3,0x98,0x29,0x7E,0x24,0xC1,0x29,0x31,0x24,0x3D,0x05,0xC0,0x6E,0xFE,0x00,0x20,0xD9,0xAF,0x33,0x1C,0xAE,0x40,0x18,0xCE,0x3B,
+0x0F,0x05,0xC0,0xAF,0x54,0x0D,0x69,0x18,0xC5,0x25,0x99,0x99,0x0E,0x08,0x19,0x9D,0xAA,0x05,0xC3,0xAF,0x33,0x0E,0x0D,0x18,0xC1,0x15,0x0F,0x05,0xC3,0x3F,0x10,0x0F,
+0x05,0xD4,0xB0,0x95,0x35,0x29,0x66,0xC0,0xA4,0x87,0x29,0x7E,0x24,0x3D,0x24,0xC0,0x05,0x29,0x31,0x3D,0xA2,0x87,0xC1,0xFE,0x00,0x20,0xD9,0xAB,0x44,0x39,0x1A,0x18,
+0xCE,0x0E,0x19,0x9D,0xAA,0x05,0xAF,0x33,0x36,0x18,0xC7,0x0D,0x92,0x9A,0x92,0x9D,0x19,0x05,0xC5,0xAF,0x54,0x36,0x18,0xC1,0x8A,0x9E,0x0F,0x05,0xC3,0x0F,0x31,0x0F,
+0x05,0xC1,0x0A,0xC0,0x05,0xCF,0xA9,0x97,0xB0,0xB3,0xFE,0xA1,0xC1,0x3D,0x51,0x7E,0x52,0x3D,0x24,0x29,0x31,0x24,0x3D,0xC0,0x7E,0xC0,0x6E,0xC1,0xFE,0x00,0x20,0xD9,
+0xA5,0x87,0xBA,0x21,0x1F,0x18,0xCE,0x99,0x9C,0xFE,0x0A,0x00,0x05,0x6E,0x2E,0x36,0x18,0xC9,0x25,0x15,0xFE,0x09,0x21,0x0A,0x05,0x14,0x05,0xC2,0xB4,0x42,0x36,0x18,
+0xC0,0x8A,0x9E,0x0F,0x05,0xC4,0x3F,0xA8,0x34,0x0A,0x05,0xD3,0x2B,0xB6,0x84,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xC0,0x9D,0x89,0x31,0x3D,0xA2,0x87,0x3D,0x29,0x3D,0x05,
+0xC0,0x0A,0xC2,0x05,0xFE,0x00,0x20,0xD9,0xA5,0x87,0xBA,0x21,0x1A,0xC0,0x18,0xCE,0xFE,0x23,0x03,0xFE,0x00,0x60,0x05,0x2E,0x36,0x18,0xCB,0x12,0x24,0x0F,0x05,0xC3,
+0x0F,0xB6,0x21,0x36,0x18,0x3B,0xFE,0x00,0xA0,0x05,0xC4,0x2B,0x0C,0x94,0xAA,0x05,0xD4,0xB5,0x84,0x1C,0x09,0x9E,0xB9,0x29,0x31,0x3D,0x29,0x3D,0x29,0xC0,0x66,0x29,
+0x05,0x0A,0xC0,0x05,0x0A,0xFE,0x00,0x20,0xDA,0x32,0xB7,0x51,0x18,0xCF,0x3B,0xFE,0x00,0xA0,0x05,0x10,0x0D,0x69,0x18,0xCB,0x99,0x9C,0x15,0x37,0x99,0xBB,0x05,0xC2,
+0x37,0x15,0x0D,0x15,0x0F,0x05,0xC5,0xAF,0x33,0x2E,0x0A,0x05,0xD3,0x16,0xB2,0x73,0xFE,0x8A,0x21,0x29,0x31,0x3D,0xA2,0x87,0x3D,0x29,0xC0,0x66,0x29,0xA3,0x98,0x29,
+0x05,0xC0,0x0A,0x29,0xBC,0x56,0x99,0x99,0xC0,0x01,0xC4,0x00,0xC0,0x01,0xC4,0x94,0x89,0xAB,0x88,0x01,0xC4,0x93,0xA9,0x01,0xC5,0x96,0x99,0x01,0xC4,0x00,0xC0,0x01,
+0xC4,0x27,0x01,0xFD,0xDB,0x10,0x39,0x01,0xFD,0xD8,0x95,0x99,0x01,0xFD,0xD8,0x9C,0x88,0x00,0x01,0xC3,0x8F,0xAA,0x18,0x00,0xC0,0x01,0xFD,0xCF,0x00,0xC0,0x01,0xC3,
+0x00,0x27,0x07,0x26,0x18,0xC0,0x00,0x19,0x39,0x01,0xFD,0xC9,0x18,0x01,0xE8,0x00,0x18,0x01,0xC2,0x9D,0x99,0x19,0x27,0x07,0x26,0x18,0xC0,0x19,0x39,0x7A,0xC0,0x01,
+0xFD,0xC3,0x18,0x01,0xE6,0x19,0x07,0x26,0x07,0x01,0xC7,0x19,0x00,0x18,0x9C,0xA9,0xC1,0x00,0xC0,0x01,0xFD,0xC0,0x19,0x00,0x01,0xE4,0x19,0x27,0x99,0x98,0x3D,0xA5,
+0x67,0x5A,0x01,0xCC,0x19,0x00,0x18,0x26,0x18,0xC0,0x19,0x28,0x39,0x01,0xF8,0x00,0xC0,0x01,0xE2,0x00,0x07,0x26,0x07,0x18,0x1D,0xC1,0x01,0xD0,0x19,0x00,0x18,0x26,
+0xC0,0x18,0xC0,0x19,0x28,0x39,0x01,0xF3,0x18,0x01,0xE1,0x00,0x07,0x1F,0x3D,0x1D,0x1A,0x1D,0xC2,0x01,0xD5,0x00,0x27,0x07,0x26,0xC0,0x18,0xC0,0x00,0xC0,0x01,0xEF,
+0x18,0x01,0xDF,0x19,0x27,0x1F,0x07,0x1D,0x1A,0x1D,0xC4,0x01,0xDA,0x28,0x19,0x27,0x07,0x26,0xC0,0x07,0x1D,0x19,0x39,0x3C,0x39,0x01,0xE6,0x19,0x00,0x01,0xDE,0x18,
+0x99,0x99,0x07,0x1D,0xC8,0x01,0xE0,0x19,0x00,0x18,0x26,0xC1,0x18,0xC0,0x19,0x28,0x39,0x3C,0x01,0xE0,0x27,0x19,0x39,0x3C,0x39,0x01,0xD9,0x27,0x1F,0x3D,0x1D,0xCA,
+0x01,0xC0,0x19,0xC0,0x00,0x18,0x26,0xC0,0xA5,0x76,0x18,0xA7,0x95,0xA4,0x7A,0xA1,0xA7,0xC3,0x6D,0x62,0xC1,0x69,0xC4,0xA2,0x77,0xC1,0x47,0xC1,0x3A,0x3E,0x9E,0x7B,
+0xC1,0x01,0xC4,0x10,0x39,0x01,0xDA,0x00,0x26,0xC0,0x18,0xC0,0x1D,0xCA,0x01,0xE6,0x3E,0xC0,0x6D,0x60,0x9C,0x77,0x9C,0x9B,0x6D,0x9D,0xA9,0x47,0x62,0xC1,0x9D,0x89,
+0xC1,0x68,0x52,0x51,0x9D,0x9A,0xA2,0x89,0xC1,0x05,0x12,0x3C,0xC0,0xA6,0x75,0x0A,0xA7,0x79,0x24,0xA2,0x76,0xA2,0x78,0x35,0x3E,0xC0,0x47,0x3E,0x9E,0x7B,0xC1,0x01,
+0x18,0x01,0xD9,0x19,0x95,0xB9,0x26,0x18,0xC0,0x1D,0xCC,0x01,0xE0,0x3A,0x3E,0xC0,0x9D,0x98,0x0F,0x22,0x9C,0x88,0x12,0x05,0x9A,0x8A,0x9D,0x9A,0xC0,0x6E,0x05,0xD5,
+0xA6,0x87,0x12,0xA3,0x9A,0x32,0xA4,0x97,0x35,0xC0,0x47,0xC1,0x00,0xC0,0x01,0xD8,0x18,0x99,0x99,0xA5,0x98,0x1D,0x1A,0x1D,0xCD,0x01,0xDD,0x31,0xC0,0x9B,0xA9,0x22,
+0x9C,0x88,0x9A,0x89,0x9A,0x8A,0x9D,0x9A,0xE3,0xA7,0x85,0x3A,0x32,0x16,0x38,0x0F,0xA1,0x8B,0xA2,0x78,0x67,0xC0,0x01,0xD3,0x19,0x36,0x26,0x18,0xC0,0x1D,0xCF,0x01,
+0xD8,0x3E,0xC0,0x49,0x07,0x22,0x96,0x89,0x17,0x9D,0x9A,0xC2,0x0A,0x05,0xE6,0xA5,0x87,0xA6,0x87,0xAB,0x83,0x24,0x27,0x31,0xC0,0x3C,0xC0,0x01,0xD0,0x19,0x36,0x42,
+0x1D,0x1A,0x1D,0xD0,0x01,0xD7,0xA0,0xA4,0x9A,0x89,0x99,0x9A,0x1F,0x05,0xDC,0x0A,0x05,0xD3,0xA5,0x87,0xAA,0x85,0x0F,0x24,0x35,0x3E,0x9E,0x7B,0xC0,0x01,0xCD,0x00,
+0x26,0x10,0x1D,0x1A,0x1D,0xD1,0x01,0xD7,0x3A,0x05,0xF8,0xA9,0x97,0xAD,0x72,0x24,0x31,0xC0,0x3C,0x01,0xCB,0x96,0x99,0x99,0x98,0x10,0x1D,0xD4,0x01,0xD7,0x8E,0xA6,
+0x17,0x9D,0x9A,0xF9,0xA9,0x85,0x36,0xA8,0x77,0x62,0xA0,0x6A,0x67,0xC0,0x01,0xC7,0x93,0xA9,0x9C,0x89,0x07,0x18,0x1D,0xD4,0x01,0xD6,0x3E,0x8B,0x99,0x99,0x9C,0xFC,
+0x12,0x0F,0x24,0x3E,0x3C,0xC0,0x01,0xC5,0x26,0xC0,0x1D,0x1A,0x1D,0xD5,0x01,0xD6,0x3E,0x31,0x05,0xFD,0xC0,0x06,0xAB,0x97,0xC0,0x3A,0x3C,0xC0,0x01,0xC1,0x28,0x26,
+0x18,0xC0,0x1D,0xD7,0x01,0xD6,0x2B,0x17,0x05,0xFD,0xC1,0xA7,0x87,0x36,0xA8,0x77,0x3E,0x9E,0x7B,0xC0,0x01,0xC0,0x26,0x18,0xC0,0x1D,0xD8,0x01,0xD6,0x0F,0x0A,0x05,
+0xFD,0xC3,0xAE,0x85,0x24,0xA2,0x76,0x3A,0x67,0x26,0x18,0xC0,0x1D,0xD9,0x01,0xD6,0x0F,0x05,0xFD,0xC5,0xA6,0x87,0xB1,0x73,0x35,0x06,0x62,0x18,0x1D,0xDA,0x01,0xD6,
+0x99,0xA4,0x05,0xFD,0xC7,0xB0,0x95,0x2B,0x36,0x18,0x1D,0xDA,0x01,0xD5,0x3E,0x20,0x05,0xFD,0xC8,0x16,0x24,0x27,0x06,0x1D,0x1A,0x1D,0xD7,0x01,0xD6,0x06,0x05,0xFD,
+0xC9,0x3A,0x39,0x24,0x98,0x5A,0x1D,0xD8,0x01,0xD6,0x8E,0xA6,0x97,0x9C,0xFD,0xCB,0x22,0x27,0x96,0x9D,0x1D,0xD7,0x01,0xC6,0x3E,0x89,0x9B,0x05,0xFD,0xCC,0x13,0xAB,
+0x76,0x22,0x1D,0x1A,0x1D,0xD4,0x01,0xC6,0x0F,0x0A,0x05,0xFD,0xCD,0x13,0x35,0x22,0x1D,0xD5,0x01,0xC6,0x9C,0x95,0x0A,0x05,0xFD,0xCE,0x06,0x2B,0x22,0x1D,0xD4,0x01,
+0xC6,0x20,0x05,0xFD,0xD0,0x06,0x2B,0x22,0x1D,0x1A,0x1D,0xD1,0x01,0xC6,0x94,0xA3,0x05,0xD4,0x29,0xAD,0x87,0x06,0x05,0xF6,0x13,0x24,0x19,0x1D,0xD2,0x01,0xC5,0xA1,
+0x85,0x8B,0xBA,0x05,0xD4,0x29,0xFE,0xDE,0xF8,0xA0,0x75,0x92,0x87,0x22,0x91,0x9B,0x05,0xC5,0xA5,0x87,0x05,0xEC,0x22,0x24,0x18,0x1D,0xD1,0x01,0xC5,0x07,0x8B,0x9C,
+0x05,0xD4,0x16,0xFE,0xCE,0xB3,0xAA,0x8A,0x6B,0x9A,0x98,0x8D,0x87,0x8A,0x89,0x05,0xC4,0x29,0xA5,0x87,0x93,0x99,0x05,0xEA,0x2B,0x0F,0x24,0x18,0x1D,0xD0,0x01,0xC5,
+0x07,0x8B,0x9C,0x05,0xD4,0x2B,0xFE,0xBD,0xD1,0x0B,0x6B,0x0B,0x12,0x92,0x85,0x88,0x8A,0x8F,0x9A,0x05,0xC2,0x2B,0x0F,0x21,0x95,0x8A,0x8C,0x9A,0x17,0x9D,0x9A,0xE8,
+0x2B,0x24,0x9C,0x77,0x1D,0x1A,0x1D,0xCE,0x01,0xC5,0x98,0xA5,0x05,0xD6,0x21,0xB6,0x89,0x12,0x79,0x0B,0xC0,0x19,0x8D,0x87,0x06,0x05,0xC2,0xA6,0x87,0x21,0xB3,0x9A,
+0x95,0x87,0x8B,0x9B,0x8C,0x89,0x05,0xE8,0xAB,0x86,0x27,0x29,0x18,0x1D,0xCE,0x01,0xC4,0x3E,0x20,0x05,0xD6,0xFE,0x7C,0x2B,0xBC,0x98,0x0B,0xC4,0x8F,0xA8,0x8B,0x79,
+0x31,0x05,0xC1,0x29,0x34,0x0E,0x2B,0x90,0x86,0x13,0x05,0xE8,0x06,0x27,0x97,0x9B,0x1D,0xCE,0x01,0xC4,0x32,0x31,0x05,0xD6,0x32,0x2B,0x0B,0xC2,0x0E,0x0B,0x04,0x96,
+0x87,0x3C,0x8C,0x9A,0x97,0x9C,0xC0,0xA5,0x87,0xBD,0x95,0x3A,0x0B,0xC0,0x19,0x3C,0x31,0x05,0xE7,0xB5,0x84,0x27,0x18,0x1D,0xCD,0x01,0xC4,0x0F,0x0A,0x05,0xD6,0x36,
+0xFE,0xE7,0x76,0x0B,0xC6,0x15,0x8A,0x89,0x87,0x9C,0x05,0xC0,0x13,0x19,0x0B,0x0E,0x0B,0x15,0x00,0x8B,0x9A,0x05,0xE6,0x2B,0x0F,0xC0,0x18,0x1D,0xCC,0x01,0xC4,0x98,
+0xA5,0x05,0xD7,0xAE,0x85,0x34,0x0E,0x0B,0xC1,0x0E,0x0B,0xC1,0x0E,0x9D,0x88,0x21,0x20,0x05,0xA5,0x87,0xBD,0x95,0xBA,0x88,0x0B,0xC1,0x12,0x92,0x85,0x85,0x9B,0x8F,
+0x9B,0x05,0xE5,0xA9,0x85,0x35,0x22,0x1D,0x1A,0x1D,0xC7,0x26,0xC1,0x01,0xC4,0x94,0xA5,0x91,0x9D,0xD7,0x20,0x19,0x0B,0x0E,0x0B,0xC1,0x0E,0x0B,0xC2,0x9D,0x98,0x21,
+0x3A,0x05,0x13,0x19,0x2B,0x9D,0x9A,0x0B,0xC1,0x96,0x86,0x89,0x8A,0x8A,0x9A,0x05,0xE5,0x06,0xAB,0x97,0x06,0x1D,0xC5,0x26,0xC1,0xA3,0x98,0xA3,0x99,0xC0,0x01,0xC3,
+0x32,0x31,0x05,0xD7,0xA9,0x85,0xFE,0xBE,0x31,0x0B,0x12,0x0B,0xC2,0x0E,0x0B,0xC1,0x12,0x0B,0x21,0x20,0x9A,0x89,0x3D,0xA6,0x7B,0x0C,0xA8,0x76,0xC1,0x0E,0x0C,0x8A,
+0x76,0x05,0x17,0x9D,0x9A,0xE4,0x07,0xA4,0x94,0x18,0x1D,0xC2,0x26,0xC1,0x02,0x25,0xC2,0x01,0xC3,0x32,0x17,0x05,0xD7,0x3F,0xFE,0xBD,0xD1,0x0B,0xC3,0x0C,0x96,0x87,
+0x94,0x89,0xC1,0xA5,0x86,0xA1,0x9C,0x9C,0x85,0x24,0x90,0x8A,0xAD,0x88,0x36,0xBA,0x88,0x0E,0x0B,0x04,0x0B,0xC0,0x15,0x00,0x12,0x05,0xE4,0xA9,0x85,0x35,0x99,0x97,
+0x18,0x9C,0xA9,0x41,0xC0,0x3D,0x25,0xC5,0x01,0xC3,0x98,0xA5,0x0A,0x66,0xD7,0x3F,0xFE,0xBD,0xD1,0x0B,0xC0,0x3A,0x91,0x9B,0x8F,0x78,0x3F,0x99,0x9A,0xC5,0xAE,0x85,
+0x24,0x20,0x22,0x0B,0xC3,0x0E,0x0B,0x9D,0x98,0x8D,0x87,0x87,0x9B,0x05,0xE4,0x06,0xAB,0x97,0x20,0xC0,0x02,0x25,0xC7,0x40,0x1D,0xA6,0x88,0xC0,0xA3,0x89,0x7A,0x39,
+0x01,0x3C,0x01,0xC9,0x3A,0x05,0xD8,0x3F,0xFE,0xAD,0x8E,0xB1,0x9B,0x97,0x7B,0x3E,0x17,0x05,0xC1,0xA5,0x87,0x20,0xA9,0x7A,0xA8,0xA8,0x33,0xA4,0x77,0xC0,0x22,0x90,
+0x68,0xA7,0x98,0x04,0xA0,0x8A,0x0B,0xC1,0x0E,0x0B,0xC1,0x3D,0x13,0x05,0x0A,0x05,0xE2,0xB7,0x72,0x0F,0x18,0x25,0xC8,0x9C,0x88,0xC0,0x26,0xC2,0x18,0xC0,0xA4,0x88,
+0x19,0xA3,0x89,0x7A,0x39,0x01,0x3C,0x01,0xC2,0x32,0x8C,0x89,0x05,0xD8,0x2B,0x36,0x30,0x86,0x8A,0xC0,0xA9,0x88,0x16,0x11,0xA7,0x87,0x0C,0xA5,0x86,0xA3,0x89,0xC4,
+0x96,0x86,0x89,0x8A,0x2B,0x0B,0xC1,0x12,0x0B,0xC3,0x22,0x06,0x05,0xE3,0x3A,0xB5,0x84,0x9A,0x89,0x18,0x25,0xC7,0x3D,0xC6,0x69,0x26,0xC1,0x3D,0xA5,0x78,0xA6,0x77,
+0xC0,0x39,0x7A,0x39,0x9D,0xA5,0x0A,0x05,0xD9,0x07,0xA4,0x7A,0x11,0xAB,0x98,0xA6,0x86,0x0B,0xC4,0x0E,0x0B,0xC3,0x21,0xAC,0x88,0x0B,0x0E,0x0B,0xC2,0x0E,0x0B,0x2B,
+0x30,0x98,0x76,0x97,0x99,0x05,0xE3,0x06,0xAB,0x97,0x06,0x25,0xC6,0x9C,0x88,0xC2,0x36,0x3D,0xC1,0x36,0x3D,0xC4,0x26,0xC2,0x02,0xA6,0x84,0x05,0xDA,0x1F,0xBC,0x98,
+0x0B,0xC3,0x12,0x0B,0xC2,0x12,0x0B,0xC2,0x9A,0x99,0x95,0x97,0x0B,0xC4,0x0E,0x9D,0x88,0x30,0x05,0xA5,0x88,0x0F,0x93,0x99,0x05,0xE3,0x1E,0x0F,0x25,0xC5,0x26,0xC1,
+0x02,0x3D,0xC5,0x36,0x3D,0xC3,0x36,0x3D,0xC0,0xA9,0x84,0x99,0x9A,0x05,0xDA,0x1F,0x3A,0x0B,0xC0,0x6B,0x0B,0xC5,0x0E,0x0B,0xC3,0x92,0x86,0x0B,0xC0,0x12,0x0B,0xC2,
+0x8E,0x99,0x8D,0x7A,0x33,0x11,0x21,0x1F,0x84,0x9B,0x05,0xE2,0x3C,0x24,0x98,0x8B,0x25,0xC2,0x02,0x9D,0x88,0x62,0xC0,0x3D,0xC6,0x69,0x3D,0xC4,0x36,0x3D,0xC0,0xA9,
+0x84,0x8F,0x9B,0x05,0xDA,0xBB,0x84,0x3A,0x0B,0x2B,0x19,0x0C,0xA4,0x77,0x0B,0xC3,0x0E,0x0B,0xC3,0x34,0x2B,0x0B,0xC3,0x19,0x22,0x04,0x12,0x0B,0xC0,0x34,0x0F,0x0A,
+0x05,0xE2,0x1E,0x0F,0x25,0xC1,0x3D,0x15,0xC2,0x3D,0xD0,0x07,0x0A,0x05,0xDA,0x07,0xAD,0x97,0x95,0x8C,0x93,0xAA,0x99,0x88,0xC0,0x3F,0x16,0x2D,0x12,0xC0,0x0E,0x0B,
+0xC1,0x0E,0x0B,0xC4,0x12,0x0B,0xC0,0x31,0x0B,0xC1,0x12,0x0B,0xC0,0x21,0x83,0x88,0x05,0xE2,0x20,0xB2,0x72,0x96,0x9D,0x25,0x3D,0x15,0xC3,0x3D,0xC2,0x36,0x3D,0xC5,
+0x36,0x3D,0xC2,0x13,0xA4,0x65,0x05,0xDB,0x07,0x33,0x37,0xC1,0x33,0x26,0x98,0x87,0x2B,0xBD,0x95,0xBA,0x7A,0xA2,0x97,0x12,0x0E,0x0B,0xC2,0x0E,0x0B,0xC3,0x34,0xA4,
+0x87,0x0B,0xC2,0x0E,0x9D,0x88,0x2D,0x88,0x95,0x1F,0x9C,0x8A,0xE2,0x07,0x7E,0x94,0x9C,0x3F,0xA1,0x9A,0xC3,0x3D,0xC3,0x36,0x3D,0xC6,0x36,0x3D,0xC0,0xA9,0x84,0x3A,
+0x05,0xDB,0x07,0x2A,0xA4,0x9C,0xC1,0x2D,0x85,0x33,0x9D,0x87,0x92,0xCE,0x05,0xBC,0x75,0x2A,0x0B,0x0E,0x0B,0x04,0x0B,0xC2,0x0E,0x0B,0xC0,0x19,0x99,0x78,0xAD,0x98,
+0xC1,0x9D,0x98,0x11,0x8F,0x89,0x90,0xA9,0x9D,0x89,0xB1,0x73,0x9C,0x9A,0x8D,0x9D,0xE2,0x3C,0xAD,0x86,0x8E,0x8A,0x15,0xC4,0x3D,0xC4,0x69,0x3D,0xC7,0x36,0x0F,0x8F,
+0x9A,0x99,0x9C,0xDB,0xB5,0x84,0x2A,0xA4,0x9C,0xC1,0x8A,0x33,0x91,0x22,0x9B,0xBA,0xFE,0x00,0x60,0x05,0xC0,0xB4,0x67,0xFE,0xDE,0xF8,0x0B,0x0E,0x0B,0x04,0x0B,0xC3,
+0x0E,0x92,0x76,0xAB,0x9A,0x0B,0xC0,0x2B,0x81,0x8B,0x84,0x9B,0xC0,0xA8,0x55,0xAC,0x75,0xBD,0xBA,0x94,0x97,0x84,0x8A,0x9A,0x8A,0x9D,0x9A,0xE1,0x1E,0x96,0x88,0x15,
+0xC4,0x3D,0xCF,0xAC,0x73,0x0A,0x05,0xDB,0xB3,0x85,0x0C,0xA8,0x8B,0xC0,0x54,0xFE,0x5B,0xAA,0x9D,0x01,0x2C,0x0A,0x05,0xA7,0x78,0xC0,0xB2,0x86,0x2A,0xA4,0x87,0x0E,
+0x0B,0xC1,0x0E,0x0B,0xC0,0x19,0x9C,0x75,0x0B,0x0E,0x0B,0xFE,0x73,0xAD,0x05,0xC1,0xB3,0x33,0xA6,0x52,0x2D,0xA3,0xA8,0x1E,0x87,0xAD,0x05,0xE1,0x22,0x39,0x3F,0xA1,
+0x9A,0xC3,0x3D,0xCE,0xA7,0x85,0x22,0x05,0xDC,0x29,0xFE,0xD6,0xD7,0x31,0xC0,0x1B,0xFE,0x6B,0xAB,0xFE,0x0B,0x41,0x9E,0xCB,0x94,0xBC,0xC0,0xA8,0x77,0x2C,0x9B,0xEE,
+0x33,0xB7,0x87,0x0B,0xC4,0x12,0x92,0x85,0xAC,0x9A,0x0B,0x2B,0x30,0x37,0x28,0x99,0xCC,0xA2,0x77,0x0C,0xA6,0x52,0x3D,0x1B,0x11,0x81,0x97,0x05,0xE1,0xA9,0x97,0x27,
+0x8E,0x9E,0x9D,0x9B,0xC3,0xA4,0xB8,0x02,0xC1,0x66,0xCA,0xAC,0x73,0x12,0x05,0xDC,0xB0,0x74,0x34,0xA8,0x9E,0xC1,0x21,0xFE,0x1B,0x41,0x4A,0x2C,0x0C,0x2C,0xA5,0x97,
+0x2D,0x89,0xAA,0xB1,0x97,0xB1,0x77,0x0E,0x0B,0xC3,0x8F,0xA8,0x0B,0x12,0x11,0x85,0x9A,0x19,0x2C,0x96,0xCD,0xA5,0x88,0x19,0xA8,0x98,0xBA,0xEF,0x1B,0x11,0x36,0x05,
+0xE2,0x32,0x96,0x97,0x97,0x8E,0xC3,0xA4,0xB8,0x7A,0xC1,0x06,0xC1,0x02,0xC0,0x3D,0xC5,0xAC,0x73,0x89,0x9D,0x05,0xDC,0xAF,0x84,0xFE,0xBE,0x54,0x31,0xC1,0x1B,0x89,
+0x98,0x92,0x12,0x3E,0xA4,0x66,0xA5,0xBB,0x0B,0x1B,0x54,0x30,0xB9,0x8A,0x1B,0xA1,0x85,0x6B,0x0B,0xC0,0x9A,0x99,0xC0,0x0B,0x2D,0x11,0xAB,0x98,0x83,0x35,0xA1,0x54,
+0x0C,0xC0,0xA0,0xB8,0xB8,0xFF,0x1B,0x90,0x97,0xC0,0x98,0x75,0x1F,0x9C,0x8A,0xE1,0x39,0x64,0xFE,0x21,0x24,0xC3,0x06,0x09,0xC1,0x06,0x09,0xC0,0x06,0x09,0x06,0x02,
+0xC1,0x66,0xC0,0xA4,0xA6,0x36,0x05,0xDD,0x3C,0xB2,0x76,0x37,0xB1,0x77,0x31,0xC1,0x98,0x85,0x2D,0xC0,0x0C,0x31,0xC0,0x1B,0x2D,0x37,0x12,0x0E,0x5A,0x04,0x0B,0x93,
+0x89,0xAD,0x98,0x19,0x8E,0x8A,0x0D,0x31,0x97,0x85,0x23,0x95,0xC8,0x23,0x3D,0x1B,0x21,0x2D,0x12,0x96,0x85,0xFE,0x4A,0x43,0x05,0xE1,0x13,0xA8,0x74,0x15,0xC3,0x06,
+0x09,0xC2,0x06,0x09,0x06,0x09,0xC0,0x06,0x09,0x06,0x02,0xC0,0xAB,0x84,0x3A,0x05,0xDD,0xB0,0x74,0xFE,0xBE,0x31,0x2D,0x33,0xC0,0x37,0x2D,0xC1,0x37,0xC0,0x33,0xC1,
+0x37,0x2B,0x0B,0xC3,0x31,0x0B,0x34,0x30,0x2D,0xA6,0x99,0x1B,0xC0,0x54,0xC0,0x3D,0x91,0x9A,0x3D,0x1B,0x0B,0xC0,0x1F,0x84,0x9B,0x9C,0x8A,0xE0,0x20,0x27,0x8C,0x9D,
+0x15,0xC2,0x09,0xC0,0x5A,0x09,0x06,0x09,0xC1,0x06,0x09,0x06,0x09,0xC2,0xAF,0x42,0x17,0x9D,0x9A,0xDD,0xB0,0x74,0x31,0x0B,0xC0,0x9C,0x86,0x0C,0x2D,0x0C,0x2D,0x0C,
+0x2B,0x0B,0xC3,0x0E,0x0B,0x69,0x0B,0x2B,0x19,0x0B,0x0E,0x2B,0x96,0x79,0x21,0x33,0xC0,0x30,0xA4,0x75,0x37,0xAF,0x86,0xA2,0x78,0xC1,0x0E,0x22,0xFE,0x29,0x81,0x05,
+0xE0,0xA9,0x97,0x27,0x12,0x9D,0x9D,0xC2,0x09,0xC0,0x5A,0x09,0x06,0x09,0xC3,0x06,0x09,0x06,0x09,0xC0,0x39,0x05,0xCE,0x6E,0x05,0xCD,0xAE,0x85,0x22,0x0B,0xC2,0x0E,
+0x0B,0x04,0x0B,0xC4,0x0E,0x0B,0xC2,0x9C,0x86,0x34,0x0E,0x0B,0xC0,0x6B,0x0B,0xC6,0x0E,0x0B,0xC0,0x8D,0x96,0x36,0x05,0xE0,0x3F,0xB7,0x82,0x91,0x9A,0x99,0x9F,0xC2,
+0x09,0xC1,0x06,0x09,0x06,0x09,0xC4,0x06,0x09,0xAB,0x54,0x9A,0x87,0x05,0xDE,0xAC,0x87,0x22,0x0B,0xC2,0x0E,0x0B,0xC1,0x0E,0x0B,0xC7,0x2B,0x19,0x0B,0x0E,0x0B,0xC1,
+0x12,0x0B,0xC5,0x12,0x0B,0xFE,0x6B,0xAA,0x1E,0x17,0x05,0xDF,0xA5,0x87,0x27,0x93,0x9D,0x15,0xC2,0x09,0xC2,0x5A,0x09,0x06,0x09,0xC5,0x24,0x8E,0x8B,0x17,0x9D,0x9A,
+0xDD,0x16,0x22,0x0B,0xC2,0x0E,0x0B,0xC2,0x0E,0x0B,0xC7,0x19,0x0B,0x0E,0x0B,0xC2,0x12,0x0B,0xC5,0x9A,0x99,0x16,0xAC,0x75,0x96,0x88,0x05,0xE0,0x27,0x93,0x9D,0x15,
+0xC2,0xA1,0xC9,0xC0,0xA3,0x88,0xC3,0x09,0xC0,0x06,0x09,0x06,0x09,0xC0,0x1E,0x08,0x05,0xDE,0x16,0x3D,0x3A,0x0B,0xC1,0x0E,0x0B,0xC9,0x0E,0x0B,0xC0,0x31,0x0B,0xC2,
+0x6B,0x0B,0xC7,0x21,0x05,0xAC,0x87,0x13,0x05,0xE0,0x24,0x98,0x5A,0x97,0xBD,0xC1,0x02,0x2D,0xC7,0x06,0xC1,0x09,0xA9,0x44,0xC0,0x05,0xDF,0x20,0x3D,0x3A,0x0B,0xC2,
+0x0E,0x0B,0xCA,0x0E,0x93,0x79,0x0C,0xA8,0x76,0x12,0x0B,0xC9,0xFE,0x4B,0x0A,0x05,0xA5,0x88,0x0F,0x08,0x05,0xDE,0xA6,0x87,0x27,0x29,0x25,0xC2,0x2D,0xCA,0x06,0x0D,
+0x0A,0x05,0xDF,0x16,0x3D,0xB1,0x9B,0x0B,0xC3,0x0E,0x0B,0xC9,0x12,0x9D,0x97,0x31,0x04,0x12,0x0B,0xC3,0x0E,0x0B,0xC2,0x93,0x89,0x17,0x05,0xC0,0x36,0x1F,0x05,0xDE,
+0xA5,0x87,0x27,0x29,0x25,0xC2,0x2D,0xCB,0x24,0x90,0x8A,0x05,0xDF,0x16,0x22,0xB1,0x79,0xC2,0x0E,0x0B,0xC3,0x0E,0x0B,0xC7,0x96,0x86,0xA7,0x9A,0x0B,0xC3,0x0E,0x0B,
+0xC1,0x0E,0x2B,0xFE,0x5B,0x4A,0x05,0xC1,0xB3,0x84,0x96,0x89,0x17,0x9D,0x9A,0xDD,0x16,0x27,0x96,0x9D,0x25,0xC2,0x2D,0xCA,0x06,0xAC,0x51,0x08,0x05,0xDF,0x16,0x31,
+0x0B,0xC3,0x6B,0x0B,0xC7,0x0E,0x0B,0x69,0x0B,0x2B,0x31,0x0B,0xC6,0x0E,0x0B,0xC0,0x93,0x89,0x17,0x05,0xC1,0x13,0x20,0x05,0xDE,0xB0,0x74,0xAB,0x97,0x06,0x25,0xC2,
+0x2D,0xCA,0x0D,0x0A,0x05,0xE0,0x16,0xFE,0xBD,0xD1,0xB1,0x79,0x12,0x0B,0xC7,0x0E,0x0B,0x12,0x0B,0xC2,0x9A,0x99,0x31,0x0B,0xC5,0x12,0x0B,0xC2,0x36,0x05,0xC2,0x20,
+0x06,0x05,0xDE,0x36,0x39,0x3F,0xA3,0x89,0x15,0xA4,0x88,0xC0,0x2D,0xC7,0x69,0x2D,0xC0,0x24,0x90,0x8A,0x05,0xE0,0x3C,0xFE,0xBE,0x54,0xAD,0x98,0xC2,0x0E,0x0B,0xCB,
+0x96,0x86,0x3A,0x0B,0xC1,0x0E,0x0B,0xC1,0x0E,0x0B,0xC1,0x37,0x17,0x05,0xC2,0x3F,0xAD,0x84,0x05,0xDE,0x24,0x9C,0x77,0x9A,0x7E,0xC0,0x1A,0x1D,0x99,0xAA,0x2D,0xC7,
+0x69,0x2D,0x13,0x24,0x17,0x05,0xE0,0x06,0x19,0x0B,0x0E,0x0B,0xC5,0x0E,0x0B,0xCD,0x0E,0x0B,0xC2,0x9C,0x86,0x36,0x05,0xC3,0xA5,0x87,0x0A,0x05,0xDD,0xA9,0x85,0x35,
+0x96,0x6A,0x1D,0xC3,0x2D,0xC7,0x26,0x2D,0x36,0xC0,0x8B,0x9D,0xE1,0x06,0xFE,0xCE,0xB3,0x0B,0x0E,0x0B,0xC6,0x0E,0x0B,0xC6,0x3A,0x0B,0xC1,0x0E,0x0B,0xC0,0x6B,0x0B,
+0xC1,0x33,0x05,0xC4,0x2B,0x20,0x05,0xDD,0xB3,0x84,0x27,0x1D,0x1A,0x1D,0xC2,0x2D,0xC7,0x26,0x2D,0x36,0x2C,0x05,0xE1,0x29,0x34,0x0B,0xC1,0x0E,0x0B,0xCA,0x97,0x9A,
+0x8D,0x97,0x92,0x6C,0xA1,0xA5,0x37,0x12,0x0E,0xC0,0x0B,0x04,0x0B,0xC1,0x95,0x8B,0x3F,0x05,0xC4,0x2B,0x22,0x05,0xDC,0x2B,0x24,0x32,0x1D,0xC4,0x98,0xEA,0xC7,0x26,
+0x2D,0x24,0x17,0x05,0xE1,0x29,0xAF,0x97,0x3A,0x0E,0x0B,0xC1,0x0E,0x0B,0xC6,0x9A,0x99,0x30,0x86,0x8A,0x05,0xC1,0x3A,0xFE,0xC6,0x97,0x12,0x0B,0xC1,0x0E,0x0B,0x9D,
+0x98,0xFE,0x52,0xC6,0x05,0xC5,0x3A,0x22,0x05,0xDC,0x3C,0x27,0x06,0x1D,0xC4,0x98,0xEA,0xC7,0x26,0xA7,0x77,0xA8,0x63,0x08,0x05,0xE1,0x22,0x2C,0x11,0x12,0xC0,0x0E,
+0x0B,0x69,0x0B,0xC2,0x0E,0x0B,0x04,0x37,0x82,0x79,0x05,0xC4,0xBC,0x87,0x12,0xC0,0x0E,0x0B,0x12,0x0B,0x84,0x98,0x05,0xC6,0x3A,0x39,0x05,0xDB,0xA5,0x87,0x27,0x0A,
+0x9B,0x8E,0xC0,0xA5,0x67,0x1A,0x1D,0xC1,0x2D,0xC7,0x26,0x0D,0x0A,0x05,0xC1,0x6E,0x05,0xDE,0xB5,0x84,0x9A,0x57,0x3A,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x12,0x0B,0xC4,
+0x33,0xFE,0x10,0xC2,0x05,0xC1,0xAC,0x87,0xAD,0x77,0x16,0x29,0x36,0xFE,0xE7,0x79,0x0B,0x0E,0x0B,0xC0,0x21,0x2B,0x05,0xC6,0xA9,0x97,0xAC,0x75,0x05,0xDB,0xB0,0x94,
+0x24,0x91,0x9E,0x3F,0xA1,0x9A,0xC1,0xA2,0x78,0xC0,0x1D,0x98,0xE9,0x2D,0x26,0x2D,0x26,0xC0,0x2D,0x26,0xC0,0x2D,0x24,0x17,0x05,0xE2,0x1E,0x9A,0x37,0x0A,0x25,0xFE,
+0xDE,0xF8,0x0B,0x0E,0x0B,0x12,0x0B,0xC2,0x86,0x87,0x05,0x0A,0xB3,0x78,0x33,0xAF,0x87,0xA6,0x86,0x0B,0xC1,0x19,0x0B,0xC0,0x12,0x0B,0x21,0xFE,0x10,0xC1,0x05,0xC7,
+0xAB,0x86,0xAB,0x83,0x05,0xDA,0xA9,0x85,0xB2,0x86,0x99,0x88,0x98,0x9E,0xC3,0x41,0xC1,0x9F,0xD8,0x2D,0x26,0xC0,0x2D,0x26,0x2D,0x26,0xC0,0xA7,0x77,0xA8,0x63,0x88,
+0x8F,0xE3,0xB7,0x71,0x9C,0x4A,0x0A,0x05,0xB5,0x84,0xFE,0xD6,0xD7,0x1B,0x0B,0xC2,0x0E,0x21,0xFE,0x10,0xC1,0x29,0x37,0xAF,0x86,0x0B,0xC0,0x3A,0x0B,0xC1,0x0E,0x0B,
+0xC1,0x21,0x3F,0x05,0xC8,0x3C,0xC0,0x05,0xDA,0xB8,0x73,0x24,0x94,0x8D,0x9D,0x9A,0xC1,0x69,0x3D,0xC2,0x26,0x2D,0x26,0xC0,0x2D,0x26,0xC0,0x2D,0x26,0x0D,0x9A,0x87,
+0x05,0xE2,0xA6,0x87,0x39,0x98,0x6A,0x95,0xAB,0x05,0xC0,0x25,0xFE,0xDE,0xF8,0x0B,0x0E,0x0B,0xC0,0x9A,0x99,0xFE,0x4A,0x86,0x21,0xB0,0x79,0xA2,0x97,0x0B,0xC1,0x9D,
+0x98,0x99,0x87,0x0C,0x0B,0x0E,0x0B,0xC0,0x33,0xFE,0x10,0xC2,0x9B,0x99,0xC9,0x3C,0x9B,0x88,0x17,0x9D,0x9A,0xD8,0x0A,0x27,0x06,0x3D,0xC1,0x36,0x3D,0xC3,0x26,0x2D,
+0x26,0xC0,0x2D,0x26,0xC1,0x2D,0xB1,0x62,0x91,0x7A,0x05,0xE2,0x16,0x13,0x31,0x95,0xAB,0x05,0xC1,0x00,0x0C,0xA8,0x77,0x0E,0x0B,0x93,0x89,0x0C,0xA8,0x76,0xC0,0x2B,
+0x96,0x79,0x21,0x11,0x9E,0x84,0xAB,0x8D,0x12,0x69,0x12,0x9A,0x98,0x84,0x8B,0x05,0xCB,0x13,0x94,0x79,0x05,0xD8,0xAB,0x86,0x27,0x97,0x9B,0x3D,0xC2,0x36,0x3D,0xC3,
+0x26,0xC0,0x6B,0x26,0xC0,0x2D,0x26,0xC0,0x13,0x24,0x17,0x05,0xE2,0x06,0x3C,0x9D,0x58,0x59,0x96,0xCC,0x05,0xC1,0x25,0x37,0x12,0x0E,0xC0,0x0B,0xC2,0x0C,0x19,0xC0,
+0x0B,0xC1,0x12,0x93,0x88,0x25,0x05,0xCC,0x13,0x17,0x05,0xD7,0xA5,0x87,0xB3,0x85,0xC0,0x3D,0xC1,0x36,0x3D,0xC5,0x26,0x2D,0x26,0xC0,0x2D,0x26,0xC1,0xAC,0x44,0x04,
+0x08,0x05,0xE2,0xB3,0x84,0x98,0x8A,0x9D,0x9B,0xA7,0x44,0x0A,0x05,0xC2,0x3A,0x33,0xB7,0x87,0x6D,0xC8,0x0C,0x8C,0x86,0x3A,0x05,0xCD,0x13,0x05,0xD8,0x22,0x39,0x3D,
+0xC1,0x69,0x3D,0xC6,0x26,0x2D,0x26,0xC0,0x2D,0x26,0xC1,0x24,0x94,0x8A,0x05,0xE3,0xB0,0x74,0x1F,0x05,0x2E,0x0A,0x05,0xC4,0xB9,0x76,0xBA,0x88,0x12,0x0B,0x12,0x0E,
+0x0B,0x69,0x0B,0xC0,0x8E,0x99,0x13,0x05,0xCE,0xA6,0x87,0x36,0x05,0xD7,0x3C,0x24,0x94,0x8D,0x3D,0xC2,0x36,0x3D,0xC5,0x26,0xC0,0x6B,0x26,0xC0,0x2D,0x26,0x13,0x24,
+0x8C,0x8B,0x05,0xE3,0x22,0x05,0xC0,0xAF,0x54,0x95,0xAB,0x05,0xC5,0x32,0x30,0x0C,0x0B,0x0E,0x0B,0x9D,0x98,0x96,0x79,0x00,0x0A,0x05,0xCF,0x3A,0xC0,0x05,0xD6,0x3F,
+0xB4,0x84,0x99,0x88,0x3D,0xC1,0x36,0x3D,0xC7,0x26,0xC0,0x2D,0x26,0xC0,0x2D,0x26,0x13,0x24,0x17,0x05,0xE2,0x3A,0x22,0x05,0xC0,0x31,0x99,0x9A,0x9A,0xAA,0x05,0xC3,
+0x37,0xAC,0x75,0xAA,0x55,0x7F,0x33,0xA7,0x98,0x97,0x75,0x87,0x9C,0x05,0xEC,0x39,0x22,0x36,0x42,0x3D,0xC1,0x36,0x3D,0xC6,0x9D,0xC8,0x2D,0x26,0xC0,0x2D,0x26,0xC0,
+0xAE,0x54,0x22,0x05,0xE3,0x20,0x06,0x05,0xC0,0x31,0xB7,0x31,0x9C,0x75,0x9C,0x9A,0x45,0xC1,0x12,0xA8,0x75,0xA6,0x88,0xA3,0x87,0xC0,0x9D,0x9B,0x95,0x9C,0x8A,0xCE,
+0x0F,0x05,0xEB,0x22,0xA4,0x76,0x3D,0xC2,0x36,0x3D,0xC8,0x26,0xC1,0x2D,0x26,0xC0,0x2D,0x24,0x90,0x8A,0x05,0xE3,0x22,0x96,0x89,0x9A,0x8A,0x9D,0x9A,0x2E,0x0D,0x18,
+0xCA,0x8F,0xAD,0xFE,0x01,0x60,0x05,0xEA,0x36,0xAC,0x74,0x36,0x3D,0xC1,0x36,0x3D,0xC9,0x26,0xC2,0x2D,0x26,0xC0,0x24,0x17,0x05,0xE3,0xB3,0x85,0x92,0x8A,0x05,0xC0,
+0x2E,0x0D,0x18,0xCA,0x99,0x9B,0x13,0x93,0xEF,0x05,0xE8,0x3A,0xB5,0x84,0x94,0x8C,0x3D,0xC3,0x36,0x3D,0xC8,0x26,0xC0,0x2D,0x26,0xA3,0x89,0xC0,0xA9,0x54,0x1E,0x08,
+0x05,0xE2,0xA5,0x87,0xAF,0x84,0x05,0xC1,0xAF,0x33,0x0D,0x18,0xC6,0x94,0x8B,0x1D,0xAC,0x75,0xAA,0x41,0x62,0x8B,0x9D,0xFE,0x00,0x60,0x05,0xC3,0xA7,0x55,0x10,0xA4,
+0x66,0xC0,0x9C,0x99,0x96,0xCC,0xC0,0x05,0xDC,0xB3,0x85,0x22,0x99,0x9C,0x6B,0xC1,0x36,0x3D,0xCA,0xA0,0xB8,0xC0,0xA4,0x65,0xC0,0x7B,0xC0,0x1E,0x22,0x05,0xDF,0x28,
+0x10,0x24,0x9C,0x99,0x31,0xA1,0xB9,0x05,0xC1,0xAB,0x44,0xFE,0x65,0xA7,0xA8,0x64,0x1A,0x18,0xC4,0x92,0x9E,0xFE,0x6B,0xAB,0x2C,0xFE,0x76,0x87,0x18,0x95,0xAD,0x06,
+0x0A,0xC0,0xA7,0x66,0x31,0xFE,0x23,0xC1,0xA9,0xAA,0x3B,0x06,0xC0,0xA4,0x77,0xA8,0x65,0x06,0x0A,0xC0,0x66,0xD9,0xB0,0x74,0xA8,0x87,0x94,0x9C,0x3D,0xC2,0x36,0x3D,
+0xCA,0x13,0xC4,0xAB,0x75,0x94,0x8A,0x05,0xDB,0x37,0x31,0xAA,0x21,0x3B,0x39,0x0E,0x9D,0x87,0x8F,0xAF,0x31,0x49,0xC0,0x2E,0x24,0xC0,0xFE,0x65,0xA7,0xA8,0x64,0x18,
+0xC5,0x0E,0x3E,0xC0,0x0D,0x18,0xC0,0xFE,0x23,0x41,0x96,0x9C,0x29,0xAD,0x84,0xA6,0x88,0x18,0xC0,0x1A,0x29,0xFE,0x00,0x60,0x05,0x28,0x31,0x95,0xAB,0x05,0xD9,0x2B,
+0x07,0x99,0x99,0x3C,0x3D,0xC1,0x69,0x3D,0xCB,0xA0,0xB8,0x13,0xC3,0xAB,0x75,0x8C,0x8B,0x05,0xDA,0xB3,0x33,0xFE,0x3C,0x62,0xAA,0x77,0x1A,0x18,0xC2,0x39,0xFE,0x01,
+0x60,0x05,0x6E,0x05,0x28,0xA4,0x88,0xB3,0x42,0x0D,0x18,0xC5,0x25,0xFE,0x4C,0x07,0x9D,0xEE,0xFE,0x65,0xA7,0xA8,0x64,0x18,0x35,0x25,0x18,0xC0,0x1A,0x18,0xC1,0x99,
+0x9C,0xFE,0x0A,0x00,0x0F,0x62,0xA8,0x55,0xA7,0x87,0x0F,0x05,0xD8,0xAB,0x86,0xAA,0x86,0x3C,0x3D,0xC1,0x69,0x3D,0xCC,0x06,0xA4,0x65,0xC0,0x1D,0x13,0xA5,0x77,0xC0,
+0x05,0xDA,0xB5,0x20,0x2C,0x1A,0x18,0xC5,0x3B,0x28,0x05,0x0F,0x05,0xC0,0x10,0xB3,0x42,0x0D,0x18,0xC5,0x12,0x38,0xFE,0x65,0xA7,0x24,0x18,0x9D,0x9A,0x0E,0x18,0xC5,
+0x39,0x19,0x05,0xC0,0x10,0x59,0x0A,0x05,0xD7,0xB5,0x84,0x3C,0x3D,0xC2,0x69,0x3D,0xCC,0xA4,0x95,0xC3,0x1E,0x9A,0x86,0x05,0xD9,0xA6,0x87,0xFE,0x6D,0x69,0x24,0x18,
+0xC6,0x0D,0x89,0xAE,0x0F,0x05,0xC2,0xFE,0x43,0xE6,0x39,0x0D,0x18,0xC4,0x2C,0x39,0x0D,0x18,0xC1,0x0E,0x18,0x24,0x1A,0x18,0xC3,0xFE,0x0A,0xA0,0x0F,0x05,0xC0,0x10,
+0x37,0x0F,0x05,0xD5,0x3F,0x07,0x36,0x42,0xA2,0x98,0xC2,0x36,0x3D,0xC6,0x26,0x2D,0x69,0x9E,0xB6,0xA0,0xB8,0x13,0xC3,0xAB,0x75,0x90,0x8A,0x05,0xD9,0xB4,0x42,0x1A,
+0x18,0xC8,0x97,0x9A,0x06,0x96,0xCC,0xC0,0x05,0xC0,0x31,0xFE,0x65,0xA7,0x0E,0xA8,0x76,0x18,0xC8,0x6F,0x1A,0x90,0x9B,0x1F,0x18,0xC4,0x12,0x0F,0x05,0xC0,0x2B,0xAA,
+0x54,0x0F,0x05,0xD5,0x3C,0xA5,0x88,0x3D,0xC1,0x69,0x3D,0xC3,0x41,0x2D,0x69,0xA0,0xC7,0x16,0x79,0xA2,0xA7,0xA1,0xA9,0x79,0x6B,0xA1,0xA8,0x13,0xC3,0xAE,0x63,0x89,
+0x9D,0x99,0x9C,0xD9,0x1D,0x1F,0x18,0xC6,0x24,0x18,0xC0,0x8F,0xAD,0x0F,0x05,0xC1,0xA6,0x87,0xFE,0x5C,0xE8,0x1A,0x98,0x88,0xA2,0x8A,0x1A,0x18,0xC5,0x24,0x18,0x2C,
+0x0C,0xB7,0x62,0x24,0x18,0xC3,0x2C,0xFE,0x0A,0x00,0x05,0xC1,0xAF,0x33,0x10,0x05,0xD5,0x29,0x9D,0x88,0x3C,0x9E,0x8B,0x41,0xC1,0x9F,0xD8,0xA0,0xA6,0x2B,0xA1,0xC7,
+0x25,0xC0,0x37,0x7A,0xA1,0xA8,0xC5,0xFE,0x4A,0x25,0xC2,0xA5,0x77,0xA3,0x96,0x0F,0x62,0xD9,0x1D,0x1F,0x18,0xC4,0x6F,0x18,0xC3,0xFE,0x0A,0xA0,0x0F,0x05,0xC1,0xB8,
+0x21,0x1A,0x18,0x0A,0xC0,0xA6,0x88,0x18,0x24,0x1A,0x18,0xC3,0x0E,0x28,0x17,0x1A,0x18,0xC4,0x15,0xFE,0x00,0x40,0x05,0xC1,0xAA,0x66,0x19,0x05,0xD4,0x29,0x26,0x9E,
+0xB6,0x16,0x35,0x25,0x37,0x33,0x37,0x33,0x37,0x71,0x66,0x29,0x24,0xA4,0x87,0xC5,0xFE,0x52,0x26,0xC2,0x04,0x9C,0x79,0x8C,0x9E,0xD9,0xA5,0x87,0xBA,0x21,0x1F,0x18,
+0xC4,0x6F,0x18,0xC3,0x0E,0x28,0x05,0xC1,0x10,0xFE,0x76,0x09,0x18,0xC0,0x99,0x9B,0x0E,0x18,0x24,0x18,0xC4,0x12,0x0F,0x05,0xFE,0x43,0xE6,0x1F,0x18,0xC3,0x39,0xFE,
+0x00,0xA0,0x05,0xC1,0xA6,0x87,0x10,0x05,0xD4,0xB9,0x84,0x35,0x33,0x6B,0x7A,0x7E,0xC0,0x29,0x66,0x05,0x29,0xC2,0x05,0xC6,0xFE,0x52,0x26,0xC1,0x13,0xAB,0x75,0x94,
+0x8A,0x91,0x9D,0xDA,0x2C,0x1F,0x18,0xC5,0x6F,0x18,0xC2,0x9D,0x9B,0x89,0xAE,0x0F,0x05,0xC0,0x2B,0xFE,0x6D,0x69,0x24,0x18,0xC0,0x06,0x97,0x8A,0x25,0x18,0xC4,0x08,
+0x0A,0x05,0x28,0x39,0x0D,0x18,0xC2,0x0E,0x28,0x05,0xC2,0xA6,0x87,0x10,0x05,0xD2,0x7F,0x1E,0xFE,0x8A,0x21,0xFE,0xA1,0x00,0x29,0xC0,0x24,0xA4,0x87,0x29,0xC3,0x24,
+0x05,0xC4,0x6E,0x05,0xC0,0x1D,0xC2,0xAE,0x52,0x31,0x99,0x9C,0xDA,0xFE,0x43,0xE6,0x1F,0x18,0xC6,0x6F,0x18,0xC2,0x0E,0x28,0x05,0xA2,0x77,0x05,0xFE,0x3C,0x62,0x1F,
+0x18,0xC2,0x97,0x9A,0xC0,0x06,0x18,0x24,0x18,0x25,0xFE,0x01,0x60,0x05,0x6E,0xC0,0x10,0x0E,0x18,0x24,0x18,0xC0,0x25,0xFE,0x09,0x81,0x0A,0xC0,0x05,0xC0,0x2B,0x2A,
+0x0F,0x05,0xD2,0xB5,0x84,0x9F,0xF7,0xFE,0x99,0x61,0x33,0x37,0x29,0xC3,0x7E,0xC1,0xA2,0x88,0xC3,0x6E,0xC0,0x05,0x29,0xFE,0x52,0x26,0xC1,0x36,0x1E,0x8A,0x8B,0x9D,
+0x9A,0xDA,0xFE,0x3B,0xE5,0x18,0xC4,0x24,0x18,0xC6,0xFE,0x23,0x03,0x0F,0x05,0xC0,0x32,0x1A,0x18,0xC4,0x12,0xAA,0x77,0x1A,0x18,0xFE,0x23,0x41,0xFE,0x00,0x40,0x05,
+0xC2,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC2,0xFE,0x0A,0x00,0x0F,0x05,0xC2,0x2E,0x06,0x0A,0xC0,0x05,0xD0,0xB0,0x74,0xA9,0xD6,0x29,0x66,0xA4,0x87,0x29,0xC0,0x05,0xC3,
+0x6E,0xC0,0x05,0xC3,0x0A,0xC0,0x05,0x1D,0xC1,0xA5,0x66,0x04,0x88,0x9F,0x5A,0xDA,0xB8,0x10,0x1F,0x18,0xC7,0x6F,0x18,0xC2,0x0E,0xFE,0x00,0xA0,0x05,0xC0,0xB4,0x42,
+0x1A,0x18,0xC5,0x97,0x9A,0x9B,0x9A,0x3B,0xFE,0x01,0x00,0x05,0xC4,0x17,0xFE,0x65,0xA7,0xA8,0x64,0x18,0x9D,0x9A,0xFE,0x0A,0xA0,0x0F,0x05,0xC2,0x3A,0x10,0x05,0xD2,
+0xA9,0x85,0xB2,0x86,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0x29,0x66,0x05,0x29,0xC0,0x05,0x29,0xC0,0x05,0xC3,0x6E,0xC0,0x05,0x0A,0x05,0x1D,0xC1,0xAB,0x64,0x9C,0x77,0xFE,
+0x00,0x20,0xDB,0x0C,0x1A,0x18,0xC6,0x6F,0x18,0xC3,0x0D,0x13,0x93,0xEF,0x05,0x31,0xFE,0x76,0x09,0x18,0xC5,0x24,0x18,0x12,0x13,0x0F,0x05,0xC4,0xB5,0x20,0xB7,0x41,
+0x18,0x0D,0x89,0xAE,0x0F,0x05,0xC3,0xAF,0x33,0x9C,0x99,0x05,0xD2,0x07,0x35,0x37,0x29,0x66,0xA4,0x87,0x29,0xC4,0x7E,0x05,0xC3,0x0A,0xC0,0x05,0x1D,0xC1,0x27,0x8E,
+0x9E,0x95,0x9B,0xDB,0xAF,0x54,0x19,0x18,0xC4,0x6F,0x18,0xC6,0x8A,0x9E,0x0F,0x05,0x31,0x0D,0x18,0xC8,0x2C,0x3B,0x28,0x05,0xC4,0x08,0x2C,0x18,0xFE,0x23,0x03,0x0F,
+0x05,0xC3,0xA5,0x87,0x31,0x95,0xAB,0x05,0xD1,0x20,0x27,0xFE,0x8A,0x21,0xFE,0xA1,0x00,0xA4,0x87,0xC2,0x56,0x51,0xC2,0x7E,0x05,0x31,0xC0,0x05,0x31,0xC0,0x05,0xFE,
+0x4A,0x25,0x1D,0x13,0x27,0x87,0xAF,0x9C,0x8A,0xDB,0x10,0x36,0xA8,0x64,0x18,0x9D,0x9A,0x18,0xC4,0x24,0x18,0xC3,0x0E,0x28,0x05,0x2E,0x0D,0x18,0xC5,0x24,0x18,0xC2,
+0x0E,0x8D,0xBE,0x28,0x05,0xC3,0x08,0x0E,0x12,0xFE,0x00,0x60,0x05,0x6E,0x05,0xC2,0x10,0x59,0x0A,0x05,0xD1,0xB5,0x84,0x9D,0xF8,0x37,0x33,0xA1,0xA9,0xC2,0x3D,0x29,
+0x66,0x05,0x29,0xC0,0x05,0x29,0x05,0xC2,0x13,0x1D,0xA7,0x54,0xA1,0x9A,0x88,0x9D,0xDC,0xA8,0x55,0x0E,0x18,0x6F,0x18,0xC6,0x24,0x18,0xC2,0x2C,0xFE,0x0A,0x00,0x05,
+0x2E,0x0D,0x18,0xC6,0x24,0x18,0xC2,0x0D,0x92,0x9A,0x13,0x93,0xEF,0x05,0xC2,0x0C,0x13,0x0F,0x05,0xC4,0x3A,0x10,0x19,0x05,0xD1,0x3A,0xB5,0x84,0xFE,0x8A,0x21,0xFE,
+0xA1,0x00,0xA4,0x87,0x3D,0x05,0xC4,0x29,0x24,0x05,0x29,0xA4,0x87,0x05,0x0A,0x05,0x1D,0x59,0xAB,0x75,0x98,0x88,0x8D,0x9F,0xDD,0x12,0xB1,0x75,0x18,0xC5,0x6F,0x18,
+0xC4,0x1A,0x8B,0x9D,0xFE,0x00,0x60,0xAD,0x65,0xFE,0x76,0x09,0x18,0xC5,0x24,0x18,0xC4,0x1A,0x25,0x29,0x06,0x96,0xCC,0xC0,0x05,0xC0,0x31,0x06,0x0A,0xC0,0x05,0xC3,
+0x2E,0x06,0x05,0xD2,0x22,0x1C,0xFE,0xA1,0x20,0xC3,0x7E,0x29,0xC2,0x31,0x29,0xA3,0x98,0xC2,0x3D,0x13,0xC0,0x27,0x92,0x9A,0x91,0x9F,0xDD,0xB8,0x10,0x1F,0x18,0xC4,
+0x24,0x18,0xC4,0x1A,0x18,0x12,0x0F,0xAD,0x65,0x19,0x18,0xC6,0x24,0x18,0xC4,0x1A,0x18,0x0E,0x8F,0xBF,0x06,0x05,0xC1,0x31,0x06,0x05,0xC4,0xA5,0x87,0x31,0x95,0xAB,
+0x05,0xD1,0x3A,0xB5,0x84,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0xC0,0xA2,0x88,0x31,0x29,0xC2,0x31,0x29,0x05,0xC4,0x13,0x1D,0x27,0x87,0xAF,0x9C,0x8A,0xDD,0x2E,0x0D,0x18,
+0xC7,0x24,0x18,0xC3,0x0E,0xFE,0x01,0x00,0xA8,0x87,0x0D,0x18,0xCA,0x24,0x18,0xC3,0x0D,0x12,0xFE,0x01,0x60,0x98,0xCC,0x05,0xC0,0x31,0x19,0x05,0xC3,0x0A,0x2E,0x06,
+0x05,0xC0,0x0A,0x05,0xCF,0x22,0x1C,0xFE,0xB1,0x81,0xC2,0x29,0xC2,0x7E,0x29,0x05,0xC4,0x13,0x36,0x04,0x0F,0x62,0xDD,0xA8,0x55,0x0E,0x18,0xC4,0x24,0x18,0xC4,0x1A,
+0x18,0x99,0x9C,0x06,0x0C,0x0D,0x18,0xCB,0x24,0x18,0xC4,0x92,0x9B,0xFE,0x02,0x00,0x0F,0x05,0xC0,0xAF,0x55,0x37,0x0F,0x05,0xC2,0xAB,0x55,0xA4,0x66,0x37,0x28,0x19,
+0x05,0xCF,0x3A,0xB4,0x93,0xFE,0x99,0x61,0xA1,0xB8,0xC1,0x29,0xC2,0x31,0x29,0xC0,0x05,0xC3,0x13,0x04,0xC0,0x88,0x9F,0x5A,0xDD,0xA5,0x87,0xBA,0x21,0xFE,0x76,0x87,
+0x18,0xC6,0x6F,0x18,0xC3,0x0D,0xFE,0x0A,0x00,0xA9,0x99,0x1A,0x18,0xC5,0x24,0x18,0xC4,0x1A,0x18,0xC4,0x8F,0x9C,0x19,0x05,0xC0,0xA8,0x55,0xA7,0x87,0x0F,0x05,0xC1,
+0xAA,0x64,0x31,0x0C,0x13,0xC0,0x31,0x06,0x05,0xCF,0x1E,0x35,0xFE,0x99,0x61,0x29,0x7E,0xC0,0x29,0xC2,0x31,0x29,0xA3,0x98,0xC1,0x6E,0x05,0x1D,0xAB,0x64,0x14,0x8D,
+0x9F,0xDF,0xB5,0x20,0x0D,0x18,0xCC,0x6F,0x15,0xA5,0xAB,0x1F,0x18,0xC7,0x24,0x18,0xC4,0x1A,0x18,0xC2,0x0E,0x28,0x05,0xC0,0x6E,0x10,0xA4,0x66,0x99,0xBB,0x24,0xA8,
+0x65,0x98,0xCC,0x06,0x05,0xC0,0x0F,0x2B,0x2E,0x06,0x05,0xCE,0xB3,0x84,0x1C,0xFE,0xB1,0x81,0x29,0x66,0x05,0x29,0xC0,0x05,0xC0,0x29,0xC1,0x05,0xC2,0xFE,0x52,0x26,
+0x27,0x92,0x9A,0x91,0x9F,0xDF,0xAF,0x33,0x0D,0x18,0xC4,0x6F,0x18,0xC4,0x1A,0x18,0x3B,0xA0,0x9B,0x0D,0x18,0xC5,0x24,0x18,0xC4,0x1A,0x18,0xC4,0x94,0x8B,0x28,0x05,
+0x0F,0x05,0x2B,0x0C,0x37,0x0F,0x2B,0x06,0xC0,0x10,0x06,0x10,0xA4,0x66,0x37,0x10,0x06,0x0A,0x05,0xCC,0x3C,0xAB,0xA4,0x3D,0x7E,0xC0,0x3D,0x29,0xC0,0x05,0xC0,0x51,
+0xC0,0x05,0x31,0x05,0xC1,0x1D,0x27,0x20,0x95,0x9B,0xDF,0x2B,0xBA,0x21,0x1F,0x18,0xC7,0x6F,0x18,0xC2,0x35,0x0E,0x18,0x24,0x18,0xC7,0x24,0x18,0xC4,0x1A,0x18,0xC1,
+0x8A,0x9E,0xFE,0x00,0x60,0x05,0xC1,0x10,0x37,0x05,0xC6,0xA5,0x88,0xAA,0x33,0x95,0xCC,0xA6,0x88,0x19,0x05,0xCC,0x3C,0xAB,0xA4,0xFE,0xA1,0xC1,0x9E,0xB9,0xC1,0x9D,
+0x89,0xC0,0x05,0xC0,0x29,0x31,0xC0,0x05,0x31,0x05,0x6E,0x22,0x27,0x8A,0x9D,0x99,0x9C,0xE0,0x08,0x0D,0x18,0xC4,0x6F,0x18,0xC4,0x1A,0x25,0x50,0x24,0x18,0xC4,0x24,
+0x18,0xC4,0x1A,0x18,0xC5,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xC0,0x37,0x10,0x05,0xC1,0x2B,0x03,0xC0,0x15,0x10,0x06,0x10,0x37,0x10,0x37,0x10,0x96,0xBB,0x05,0xCB,0x22,
+0x1C,0xFE,0xB1,0x81,0x29,0xA4,0x87,0x05,0x29,0xC0,0x66,0x05,0x29,0xC0,0x05,0x29,0x05,0xC1,0x36,0x27,0x87,0xAF,0x9C,0x8A,0xE0,0xAF,0x33,0x0D,0x18,0xC5,0x6F,0x18,
+0xC4,0x1A,0x94,0xAE,0x18,0xC4,0x24,0x18,0xC4,0x1A,0x18,0xC5,0x25,0x28,0x05,0x0F,0x05,0x15,0x19,0x05,0xC6,0x19,0x37,0x10,0x13,0x37,0x10,0x96,0xBB,0x05,0xCB,0xB8,
+0x73,0xFE,0x8A,0xC5,0xFE,0xB1,0x81,0xC2,0x3D,0x29,0x7E,0xC0,0x29,0x3D,0x05,0xC0,0x3D,0x05,0x29,0x36,0xA3,0x96,0x8A,0x7E,0x62,0xE0,0x37,0x0E,0x18,0xC5,0x24,0x18,
+0xC4,0x1A,0x93,0x9A,0xAE,0x76,0x18,0xC8,0x6F,0x18,0xC4,0x1A,0x18,0xC0,0x8A,0x9E,0x0F,0x05,0xC0,0x10,0x06,0x0A,0x05,0xC4,0x19,0x05,0xC2,0x0C,0x13,0x06,0x0A,0xC0,
+0x05,0xC9,0x3F,0xB7,0x82,0xFE,0x99,0x61,0xA1,0xB8,0x6E,0x05,0x0A,0xC0,0x05,0x9D,0x89,0xC1,0x66,0x05,0x29,0x0A,0x05,0x29,0xFE,0x5B,0x27,0x9E,0x85,0xFE,0x00,0x20,
+0xE2,0xFE,0x23,0x41,0x1A,0x18,0xC7,0x6F,0x18,0xC2,0x8F,0xAD,0x1F,0x18,0xC6,0x24,0x18,0xC4,0x1A,0x18,0xC1,0x25,0xFE,0x01,0x60,0x05,0xC1,0x10,0x97,0xBB,0x05,0xC3,
+0x3F,0xA1,0x9A,0x2A,0x4A,0xC0,0x2E,0x10,0x24,0x3E,0x28,0x05,0x6E,0x05,0xC9,0xB3,0x85,0x1C,0x09,0x9E,0xB9,0xC4,0x6E,0x9C,0x89,0xC2,0x31,0x29,0x05,0xC0,0xBC,0x56,
+0xC0,0x96,0x99,0xA6,0x77,0x01,0xC1,0x94,0x89,0xAB,0x88,0x01,0xC1,0x93,0xA9,0xAC,0x78,0x01,0xC0,0x19,0x27,0x01,0xC1,0x99,0x99,0xC0,0x01,0xC1,0x27,0x19,0x01,0xC1,
+0x07,0x3C,0x01,0xC1,0x27,0x01,0xC1,0x19,0x00,0x01,0xC1,0x00,0xC0,0x01,0xE9,0x19,0x01,0x3C,0xC0,0x01,0xFD,0xCF,0x95,0x99,0x39,0x01,0xE7,0x00,0x98,0xA9,0x41,0x3D,
+0x26,0x07,0x27,0x19,0x7F,0x39,0x01,0xFD,0xCB,0x18,0x39,0x01,0xE5,0x00,0x3D,0x26,0x3D,0xA5,0x67,0x3C,0xC0,0x19,0x00,0x18,0x3D,0x26,0x07,0x00,0xC0,0x19,0x01,0x3C,
+0x01,0xFD,0xC4,0x19,0x27,0x01,0xE4,0x00,0x3D,0x26,0x10,0x1D,0x5A,0xC0,0x01,0xC5,0x19,0x00,0x18,0x3D,0x26,0x07,0x27,0x19,0x28,0x39,0x01,0xFD,0xC0,0x00,0xC0,0x01,
+0xE2,0x00,0x3D,0x26,0x10,0x18,0x1D,0x1A,0xC0,0x1D,0x01,0xCA,0x00,0xC0,0x3D,0xC0,0x26,0x07,0x00,0x19,0x01,0x3C,0x01,0xF9,0x27,0x19,0x01,0xE0,0x00,0x3D,0x26,0x10,
+0x18,0x1D,0x1A,0x1D,0x1A,0x1D,0xC0,0x01,0xCF,0x19,0x00,0x18,0x26,0x3D,0x1D,0x00,0xC0,0x01,0xC0,0x3C,0x01,0xF3,0x07,0x3C,0x01,0xDE,0x19,0x3D,0x26,0x07,0x27,0x1D,
+0x1A,0x1D,0xC4,0x01,0xD3,0x19,0x00,0x27,0x3D,0x26,0xC0,0x3D,0x00,0xC0,0x01,0xC0,0x3C,0xC0,0x01,0xED,0x27,0x01,0xDD,0x19,0x3D,0x40,0x07,0x27,0x1D,0xC8,0x01,0xC0,
+0x28,0x19,0x00,0x18,0x3D,0x26,0x3D,0x1D,0x27,0x19,0x28,0xC0,0x39,0x3C,0x01,0xE6,0x00,0xC0,0x01,0xC0,0x3C,0xC0,0x01,0xD8,0x18,0x99,0x99,0x07,0x27,0x1D,0xC0,0x01,
+0xC6,0x28,0x19,0x00,0x3D,0xC0,0x26,0x3D,0x1D,0x00,0x19,0x01,0x3C,0x01,0xE2,0x27,0x19,0x01,0xDA,0x18,0x17,0x3D,0x1D,0x1A,0x1D,0xC1,0x01,0xCC,0x28,0x19,0x27,0x3D,
+0x26,0x1F,0x07,0x18,0x00,0xC0,0x01,0xC0,0xA1,0xA6,0xC7,0x6D,0x62,0xA2,0x76,0x3C,0x32,0x3C,0x32,0x3C,0x46,0x9F,0x9B,0xC4,0x01,0xC4,0x27,0x01,0xD9,0x00,0x3D,0x26,
+0x10,0x18,0x1D,0xC3,0x01,0xD0,0x3E,0x9F,0x96,0x9D,0x8A,0x54,0x69,0x65,0xC0,0x9D,0x9C,0x68,0x6F,0x9B,0x9A,0x67,0xC1,0x9D,0x89,0x50,0x51,0x05,0x31,0xC0,0x05,0x20,
+0xA5,0x87,0xA4,0x86,0x26,0xC0,0x0F,0x24,0xA2,0x76,0xA2,0x78,0x35,0x6B,0x9E,0x7B,0xC1,0x01,0x66,0x01,0x96,0x99,0x01,0xD8,0x10,0x1F,0x07,0x18,0x1D,0xC5,0x01,0xCB,
+0x3E,0xC0,0x9D,0x98,0x41,0x20,0x9B,0x9A,0x05,0x31,0x9C,0x8A,0x9D,0x9A,0xD6,0x31,0xA4,0x89,0x14,0x39,0xA4,0x96,0xA2,0x78,0x38,0x35,0x6B,0x00,0xC0,0x01,0xC0,0x66,
+0xC0,0x01,0xD2,0x19,0x93,0xAA,0x3D,0x1D,0x7B,0x1D,0xC6,0x01,0xC6,0x3E,0xC0,0x1E,0x07,0x9D,0x97,0x9A,0x9B,0x31,0x17,0x05,0xE1,0x31,0x3A,0x39,0x16,0xC0,0xA1,0x6C,
+0x9F,0x9B,0x67,0x01,0xD3,0x00,0x1F,0xA4,0x88,0x18,0x1D,0xC0,0x1A,0x1D,0xC5,0x01,0xC3,0x3E,0xC0,0x9B,0x88,0x06,0x99,0x99,0x17,0x9D,0x9A,0xE9,0xA5,0x87,0xAA,0x85,
+0x39,0xA6,0x86,0x38,0x31,0x9F,0x9B,0x3C,0x01,0xCF,0x96,0x99,0x1F,0xA4,0x88,0x18,0x1D,0xC9,0x01,0xC0,0x35,0x0F,0x39,0x94,0x9C,0x99,0x99,0x05,0xF0,0xA7,0x85,0x14,
+0x16,0xA2,0x78,0x3E,0xC0,0x3C,0x01,0xCC,0x07,0x9C,0x88,0x07,0x18,0x1D,0xCA,0x01,0x3E,0x93,0x98,0x17,0x05,0xF6,0x3A,0x39,0x35,0x6B,0x9E,0x7B,0x67,0x01,0xC9,0x26,
+0x3D,0x1D,0x7B,0x1D,0xC0,0x1A,0x1D,0xC8,0x01,0x3E,0x88,0x9A,0x05,0xF9,0xAF,0x84,0x0F,0x24,0xA1,0x6A,0x9F,0x9B,0x3C,0x01,0xC5,0x19,0x3D,0x40,0x1D,0x1A,0x1D,0xCC,
+0x01,0x3E,0x2B,0x05,0xFB,0x06,0x24,0xA2,0x76,0x3A,0xC1,0x01,0x3C,0x01,0xC0,0x19,0x1F,0x07,0x18,0x1D,0xCE,0x01,0x31,0x17,0x05,0xFC,0xA6,0x87,0xAF,0x85,0x35,0x6B,
+0x9E,0x7B,0x67,0x01,0xC0,0x19,0x26,0x3D,0x1D,0x7B,0x1D,0xCE,0x01,0x1E,0x89,0x8C,0x05,0xFD,0xC0,0x20,0x24,0xA2,0x76,0x3A,0x01,0x19,0x3D,0x1F,0x1D,0xD1,0x01,0x9C,
+0x95,0x8A,0x9C,0x05,0xFD,0xC1,0x2B,0x22,0x35,0x9B,0x9A,0x1F,0xA4,0x88,0x18,0x1D,0xD1,0x01,0x9C,0x95,0x0A,0x05,0xFD,0xC3,0xAE,0x85,0x24,0x0F,0x18,0x1D,0xC0,0x1A,
+0x1D,0xCF,0x01,0x22,0x05,0xFD,0xC5,0xA7,0x85,0x39,0x16,0x99,0x8B,0x1D,0x1A,0x1D,0xCF,0x01,0xC1,0x06,0x05,0xFD,0xC7,0x20,0x35,0x20,0x1D,0xC0,0x1A,0x1D,0xC8,0x01,
+0xC1,0x94,0xA3,0x0A,0x05,0xFD,0xC7,0x3C,0x24,0x39,0x1A,0x1D,0xC9,0x01,0xC1,0x8E,0xA6,0x17,0x9D,0x9A,0xFD,0xC8,0xA9,0x97,0x24,0x0F,0x18,0x1D,0x1A,0x1D,0xC6,0x01,
+0xC0,0x3E,0x88,0x9A,0x05,0xFD,0xCA,0xA7,0x87,0x0F,0x24,0x1A,0x1D,0xC7,0x01,0xC0,0x1E,0x89,0x8C,0x05,0xFD,0xCB,0xA6,0x87,0x1E,0x24,0x18,0x1D,0xC6,0x01,0xC0,0x07,
+0x0A,0x05,0xFD,0xCC,0x3A,0x1E,0x55,0x18,0x1D,0xC5,0x01,0xC0,0x22,0x05,0xD3,0x2B,0xA6,0x85,0x1F,0x05,0xF4,0x3A,0x1E,0x39,0x1A,0x1D,0x1A,0x1D,0xC2,0x01,0xC0,0x94,
+0xA5,0x17,0x05,0xD2,0x16,0xFE,0xAD,0x8E,0xC0,0x07,0x8E,0x9C,0x05,0xF3,0x16,0x24,0x20,0x1D,0xC4,0x01,0xC0,0x31,0x17,0x05,0xD3,0xFE,0xA5,0x72,0xB2,0x96,0x55,0x91,
+0x9A,0x07,0x32,0x05,0xC4,0xB0,0x95,0x44,0x17,0x05,0xE9,0x3C,0x24,0x39,0x1D,0x1A,0x1D,0xC1,0x01,0x3E,0x89,0x9B,0x05,0xD4,0xFE,0x7C,0x2B,0xBE,0x87,0xA0,0x8A,0x69,
+0x9A,0x99,0x8D,0x87,0x8C,0x98,0x17,0x05,0xC2,0x16,0x24,0x1F,0x06,0x05,0xE9,0x06,0x24,0x06,0x1D,0x1A,0x1D,0xC0,0x01,0x07,0x8A,0x9C,0x05,0xD4,0x1E,0xFE,0xEF,0x98,
+0x12,0x0B,0xC0,0x61,0x95,0x79,0x8C,0x87,0x8C,0x9A,0x17,0x9D,0x9A,0xC1,0xAE,0x85,0xBF,0x96,0xA9,0x78,0x8E,0x88,0x8B,0x9A,0x17,0x05,0xE7,0xB3,0x84,0x35,0x06,0x1D,
+0xC0,0x1A,0x01,0x07,0x0A,0x05,0xD4,0xB3,0x85,0xFE,0xE7,0x76,0xA4,0x8A,0xC0,0x61,0x0B,0x3A,0x15,0x0F,0x8C,0x98,0x8F,0x9E,0x05,0xC1,0xBB,0x84,0x15,0x0B,0x34,0x1F,
+0x31,0x17,0x05,0xE5,0xA5,0x87,0xB3,0x85,0x24,0x1A,0x1D,0xC0,0x01,0xC1,0x94,0xA5,0x05,0xD5,0xAC,0x87,0xFE,0xCE,0xB3,0x04,0x12,0x0B,0xC2,0x61,0x91,0x98,0x0F,0x8C,
+0x9B,0x05,0xC0,0xA9,0x85,0x3D,0x04,0x12,0x9D,0x97,0x3D,0x13,0x08,0x5A,0xE5,0xA9,0x85,0xB2,0x86,0x9C,0x76,0x1D,0x1A,0x1D,0xCC,0x26,0x01,0xC1,0x90,0xA5,0x95,0x9D,
+0xD5,0x16,0xFE,0xBE,0x54,0xAD,0x98,0xC6,0x34,0x8A,0x89,0x89,0x9A,0x17,0x9D,0x9A,0x0F,0xBE,0x9A,0x0B,0x3A,0x0B,0x19,0x87,0x9B,0x31,0x17,0x05,0xE4,0x3C,0x24,0x39,
+0x1D,0x1A,0xC0,0x1D,0xC7,0x26,0x69,0x26,0xA2,0x98,0x01,0xC0,0xA1,0x85,0x88,0xBB,0x05,0xD5,0xA5,0x88,0x21,0x0B,0xC3,0x7A,0xC2,0x15,0x86,0x8A,0x87,0x9A,0x05,0x3F,
+0xFE,0x9D,0x2D,0x04,0xA0,0x8A,0x0B,0xC0,0x15,0x8B,0x9A,0x86,0x89,0x05,0xE5,0x20,0x35,0x06,0x1D,0xC6,0x3D,0x26,0xC0,0x3D,0xA4,0x88,0xC1,0x01,0xC0,0x07,0x8A,0x9C,
+0x05,0xD6,0x21,0x04,0x0E,0xC7,0x15,0x0F,0x84,0x8A,0x17,0x07,0xFE,0xE7,0x38,0xC1,0x0E,0xC1,0x8D,0x86,0x13,0x08,0x5A,0xE4,0xB8,0x73,0x24,0x1A,0x1D,0xC3,0x26,0x69,
+0x26,0xA3,0x98,0x25,0xC3,0x01,0xC0,0x20,0x05,0xD7,0xFE,0x8C,0x6C,0x04,0xA0,0x8A,0x0B,0xC0,0x0E,0xC3,0x0B,0xC0,0x15,0x36,0x87,0x8A,0x31,0x22,0xC0,0xAE,0x78,0x12,
+0x0B,0xC1,0x96,0x86,0x0F,0x8C,0x9B,0x9C,0x8A,0xE3,0x3F,0x0F,0x9F,0x86,0x1D,0xC0,0x1A,0x26,0x69,0x26,0x25,0xC6,0x01,0xC0,0x90,0xA7,0x05,0xD7,0xFE,0x7C,0x2B,0x04,
+0x0B,0xC3,0x95,0x8B,0x11,0x9C,0x99,0xC0,0x11,0xA2,0x97,0x99,0x87,0x24,0x31,0xB4,0x86,0x0F,0x0B,0xC1,0x0E,0xC1,0x34,0x87,0x89,0x8C,0x9A,0x97,0x9C,0xE3,0xAE,0x85,
+0x24,0x06,0x9A,0x8B,0xC0,0xA4,0x88,0x18,0x25,0xC7,0x01,0x1E,0x31,0x17,0x05,0xD6,0xBD,0x73,0x3A,0x0B,0xC0,0x0C,0x33,0x25,0x91,0x99,0x05,0xC4,0x13,0xA8,0x66,0x20,
+0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x0E,0x0B,0xC0,0x0E,0x9A,0x89,0x8D,0x87,0x84,0x8A,0x17,0x9D,0x9A,0xE2,0xB5,0x84,0x39,0x1A,0x25,0xCA,0xA7,0x67,0x9D,0x99,0xA6,0x78,
+0x01,0xD0,0x9C,0x95,0x0A,0x05,0xD7,0x1E,0xFE,0xEF,0x98,0x57,0x11,0x20,0x05,0xC2,0xA8,0x88,0x29,0xA9,0x89,0x33,0x11,0xC0,0x21,0x1E,0xAF,0x86,0x04,0x0E,0x0B,0xC3,
+0x0E,0x2B,0x0F,0x86,0x89,0x95,0x9D,0xE2,0xA6,0x87,0x1E,0x9E,0x76,0x25,0xCA,0x26,0x1F,0x26,0xC0,0xA2,0x98,0x1D,0x00,0x19,0xC0,0x01,0x66,0x01,0xC7,0x69,0x98,0xA6,
+0x05,0xD8,0x29,0x11,0x25,0x14,0x15,0xB1,0x76,0x33,0xA7,0x98,0xA8,0x77,0xA3,0x98,0xA4,0x87,0x0B,0x0E,0xC2,0x96,0x76,0x8C,0x8A,0x2B,0xA3,0x8A,0x0B,0xC0,0x3A,0x0B,
+0xC3,0x1F,0x8B,0x99,0x05,0xE2,0xAE,0x85,0x24,0x95,0xAE,0x25,0xC7,0x26,0x69,0xA4,0x88,0x62,0xC2,0x26,0xC0,0x3D,0x26,0x1F,0x3D,0x1D,0x00,0xC0,0xA3,0x88,0x28,0xA2,
+0x78,0x7A,0xC0,0x01,0x3E,0x93,0x98,0x05,0xD8,0x06,0xA4,0x86,0xAC,0x9B,0xB1,0x77,0xA7,0xA9,0xA4,0x87,0xA2,0x78,0x3A,0x0B,0xC0,0x0E,0xC3,0x0B,0x3A,0x8C,0x76,0x34,
+0x0B,0xC3,0x0E,0xC1,0x8E,0x89,0x83,0x88,0xA8,0x76,0x92,0x9B,0x17,0x9D,0x9A,0xE1,0xB7,0x74,0x7E,0x18,0x25,0xC4,0x3D,0x26,0x15,0xC0,0x3D,0xC2,0x26,0xA4,0x87,0x3D,
+0x26,0x07,0x3D,0xC0,0x26,0xC0,0x3D,0x26,0xC0,0x1F,0x3D,0x18,0x1D,0x1E,0x31,0x17,0x05,0xD7,0xAE,0x85,0xFE,0xBE,0x54,0xAD,0x98,0xC0,0x0E,0xC3,0x0B,0x61,0x0E,0xC3,
+0x0B,0x34,0x9A,0x87,0x0B,0xC0,0x0E,0x0B,0xC2,0x93,0x89,0x3F,0x14,0x3C,0x24,0x89,0x9D,0x05,0xE1,0x16,0x24,0x20,0x25,0xC3,0x9A,0x77,0xC0,0x15,0xC1,0x3D,0xC0,0x26,
+0x07,0x3D,0xC6,0x26,0x07,0x3D,0xC2,0x26,0x07,0x36,0x8D,0x8C,0x05,0xD8,0xAB,0x86,0xFE,0xCE,0xB3,0x04,0x0E,0xC3,0x5A,0x3A,0x0E,0x0B,0xC3,0x0E,0xC0,0x31,0x0B,0x0E,
+0xC3,0x9A,0x89,0x30,0xB1,0x77,0xA4,0x99,0x19,0x9C,0x75,0x84,0x8A,0x08,0x05,0xE1,0xB7,0x74,0x24,0x18,0x25,0xC0,0x9C,0x88,0x15,0xC4,0x3D,0x26,0xA4,0x87,0x3D,0xCF,
+0xA8,0x72,0x05,0xD9,0x16,0x31,0xAE,0x8A,0x2B,0x0C,0x55,0xC0,0xA3,0x98,0x0B,0xC5,0x0E,0xC0,0x0B,0x34,0x0B,0xC1,0x0E,0x0B,0xC0,0x31,0x0B,0x0E,0xC2,0x8F,0x98,0x06,
+0x05,0xE1,0x3F,0xB7,0x82,0x95,0x9D,0x25,0x9C,0x88,0x26,0x15,0xC4,0x3D,0xC1,0x26,0x07,0x3D,0xC4,0x26,0x07,0x3D,0xC4,0x29,0x3C,0x05,0xD9,0x3F,0xB9,0x85,0x99,0x8B,
+0x93,0xAA,0x99,0x88,0x05,0x2B,0x3D,0x33,0x2A,0x0B,0x3A,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC2,0x96,0x76,0xA4,0x9B,0x3A,0x0B,0xC2,0x9D,0x98,0x8A,0x88,
+0x82,0x8A,0x17,0x05,0xE0,0xB3,0x84,0x35,0x36,0x3F,0x15,0xC5,0x3D,0x26,0x07,0x3D,0xC5,0x26,0x07,0x3D,0xC5,0xA9,0x84,0x31,0x17,0x05,0xD8,0xA6,0x87,0xBC,0x84,0x2D,
+0xA2,0x97,0xC0,0x2D,0x88,0x78,0x8C,0x77,0x9B,0xBB,0x25,0x2D,0xAB,0x97,0x0B,0xC0,0x0E,0xC3,0x0B,0x61,0x0E,0x0B,0x2B,0x95,0x87,0x0B,0x0E,0xC0,0x0B,0x0C,0x37,0x33,
+0x97,0x75,0x32,0x17,0x05,0xE0,0x3F,0x27,0x8E,0x9C,0x15,0xC6,0xA4,0x88,0xD1,0xA9,0x84,0x0F,0x05,0xD9,0xA5,0x87,0xFE,0x9D,0x2D,0xB6,0x9F,0xC1,0x9B,0x87,0x85,0x21,
+0x9B,0x46,0x92,0xFF,0x05,0x3F,0xFE,0xB5,0xB2,0x0B,0xC0,0x3A,0x0B,0xC0,0x0E,0x0B,0x0E,0xC2,0x92,0x76,0x0B,0x0E,0xC0,0x3A,0x8A,0x8B,0x80,0x89,0x05,0xC0,0xB7,0x67,
+0xAB,0xB5,0x8D,0x89,0x17,0x05,0xE0,0xB7,0x74,0x20,0x3F,0x15,0xC5,0x3D,0xD0,0x13,0xA5,0x77,0x0F,0x05,0xD9,0xA6,0x87,0xFE,0x9D,0x2D,0xB6,0x9F,0xC1,0x93,0x74,0x88,
+0x01,0x9E,0xAB,0x28,0x0F,0x05,0xA5,0x88,0xFE,0xB5,0xB2,0xB2,0x78,0x69,0xC0,0x0E,0xC4,0x9A,0x89,0x9C,0x75,0x04,0x0E,0x04,0x87,0x99,0x05,0xC0,0xAA,0x66,0xAB,0x31,
+0xB3,0xBD,0x2A,0x1F,0x87,0x9A,0x05,0xE0,0xAE,0x85,0x24,0x31,0xA1,0x9C,0xC5,0x3D,0xD0,0x36,0x9B,0x89,0x05,0xDA,0x2B,0xFE,0x9D,0x2D,0xB5,0x9E,0xA1,0x9A,0xC0,0x11,
+0x8F,0x00,0x9E,0xAB,0x28,0x9B,0xBB,0xA6,0x66,0xA7,0x77,0x9B,0xBB,0x2D,0xAB,0x97,0x0B,0xC3,0x0E,0xC0,0x92,0x76,0xAB,0x9A,0x12,0x0B,0x33,0x17,0x05,0xC0,0xAB,0x44,
+0xAE,0x31,0xAD,0xDD,0x1B,0x94,0x75,0xFE,0x3A,0x24,0x05,0xE0,0xA5,0x87,0xB3,0x85,0x2C,0x99,0x9F,0xC5,0x3D,0xC3,0x26,0xA4,0x87,0x3D,0xC9,0x0F,0x91,0x9A,0x17,0x9D,
+0x9A,0xDA,0x1F,0x1B,0xA1,0x9A,0xC0,0x0B,0x12,0x0C,0x3E,0x45,0x3E,0x2C,0xFE,0x6B,0xAB,0x9B,0x7A,0xFE,0xE7,0x38,0xA4,0x87,0xA2,0x78,0xC3,0x9D,0x98,0x95,0x87,0x0B,
+0x0E,0x8F,0x9B,0xFE,0x19,0x63,0xA9,0x55,0x98,0x99,0x95,0xDD,0xAF,0x33,0x12,0x23,0xB6,0xDD,0x9B,0x87,0x82,0x84,0x17,0x05,0xE0,0x0F,0x39,0x91,0xAF,0xC5,0x3D,0xD0,
+0x0F,0x8C,0x9B,0x05,0xDB,0xFE,0x7C,0x2B,0x1B,0x31,0xC0,0x33,0x1F,0x12,0x4A,0x3E,0x0C,0x1D,0xB8,0xFE,0x55,0x30,0xBD,0x88,0x0B,0x3A,0x0B,0xC0,0x0E,0x19,0xC0,0x0E,
+0x3D,0x30,0xC0,0x12,0x4A,0x3E,0xA2,0x89,0x1D,0xB8,0xFE,0x1B,0x11,0x21,0x87,0x99,0x0A,0x05,0xDF,0x13,0xA8,0x74,0x3F,0x15,0xC4,0xA4,0xB8,0xC3,0x02,0xC4,0x66,0xC4,
+0xA7,0x85,0x22,0x05,0xDC,0x35,0x0C,0x31,0xC1,0x33,0x8D,0x98,0x99,0x22,0xC0,0x01,0x0C,0x31,0xC0,0x93,0x74,0x2D,0xAB,0x97,0x69,0x0E,0xC1,0x34,0x3A,0x55,0x33,0x1B,
+0x9C,0x88,0x30,0x98,0x13,0xA1,0x75,0x2C,0x2D,0x12,0x11,0xAB,0x98,0xA3,0x98,0x83,0x87,0x17,0x05,0xDF,0x3C,0xAD,0x85,0x8E,0x8B,0x9F,0x9C,0xC4,0xA4,0xC8,0xC4,0x06,
+0xC3,0x02,0xC2,0x66,0x02,0x0F,0x93,0x9B,0x95,0x9B,0xDC,0x35,0xA9,0xAD,0x11,0xAF,0x9A,0x1B,0x31,0xC0,0x9E,0x75,0xC1,0x33,0xC0,0x2D,0x11,0xA7,0x87,0xAD,0x98,0xC0,
+0x0E,0xC0,0x59,0x92,0x87,0x0B,0x8E,0x99,0x37,0x1B,0xA1,0x9A,0x1B,0x33,0xC1,0x0C,0x11,0xAB,0x98,0x12,0x0B,0x8D,0x96,0xFE,0x21,0x41,0x17,0x9D,0x9A,0xDE,0xA5,0x87,
+0x27,0x8E,0x9C,0x15,0xC4,0x09,0xC2,0x06,0x09,0xC1,0x06,0x09,0xC2,0x06,0x09,0xC0,0x13,0xA8,0x74,0x17,0x05,0xDC,0x35,0xBE,0x99,0x0C,0x11,0x9C,0x99,0xC3,0x11,0x21,
+0xA5,0x78,0x19,0x3A,0xA2,0x78,0x0E,0x0B,0xC0,0x0E,0x19,0x9C,0x75,0xAA,0x89,0x0E,0x37,0x95,0x86,0x33,0x11,0xC0,0x33,0x30,0x21,0x0B,0xC2,0x34,0x81,0x87,0x17,0x05,
+0xDF,0x24,0x96,0x99,0x15,0xC4,0x09,0xC3,0x06,0x09,0xC3,0x06,0x09,0xC2,0xA4,0x66,0x39,0x05,0xDD,0x24,0xBF,0x88,0x0B,0xC4,0x0E,0xC0,0x0B,0x0E,0xC3,0x0B,0x3A,0x0E,
+0x15,0x34,0x0B,0xC0,0x0E,0xC2,0x2B,0xC0,0xA3,0x8A,0x0B,0xC3,0x2B,0x80,0x88,0x17,0x05,0xDF,0x24,0x9B,0x87,0xFE,0x21,0x24,0xC4,0x09,0xC4,0x06,0x09,0xC5,0x06,0x09,
+0xAB,0x54,0x99,0x79,0x05,0xDD,0x1E,0xFE,0xEF,0x98,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x9A,0x99,0x34,0x0B,0xC0,0x0E,0x0B,0xC0,
+0x0E,0x0B,0xC0,0x0E,0x0B,0xC3,0x93,0x89,0x84,0x98,0x96,0x88,0x05,0xDF,0x0F,0x39,0x15,0xC4,0x09,0xC1,0x5A,0x09,0xC6,0x06,0x09,0xC1,0x1E,0x8E,0x89,0x05,0xDD,0xB7,
+0x74,0xFE,0xE7,0x76,0xA4,0x8A,0xC2,0x0E,0x0B,0xC0,0x0E,0x0B,0xC5,0x0E,0xC0,0x15,0x34,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC6,0x33,0x3C,0x22,0x05,0xDF,0x39,0x32,
+0x3F,0xA1,0x9A,0xC1,0xA2,0x78,0xA2,0x98,0x06,0xC2,0x09,0xC1,0x06,0x09,0xC6,0x1E,0x89,0x8C,0x05,0xDD,0x39,0x19,0x3A,0x0B,0xC3,0x0E,0x0B,0xC0,0x0E,0x0B,0xC5,0x2B,
+0x95,0x87,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC6,0x25,0x14,0x07,0x8A,0x9C,0x05,0xDE,0xB8,0x73,0x39,0x1A,0x02,0xC0,0x25,0xC1,0x99,0xC9,0xC1,0x06,0xC2,0x09,0xC2,
+0x06,0x09,0xC1,0x36,0x39,0x05,0xDE,0x07,0x19,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC9,0x0E,0x31,0x0B,0x0E,0xC0,0x0B,0x0E,0xC3,0x0B,0x3A,0x0E,0x0B,0x93,0x89,0x17,
+0x05,0x36,0x92,0x89,0x05,0xDE,0x0F,0x39,0x25,0xC4,0x2D,0xC8,0x06,0xC2,0x09,0x0D,0x99,0x79,0x05,0xDE,0x07,0x19,0x3A,0xA2,0x78,0xC7,0x0E,0xC0,0x0B,0x0E,0x0B,0xC2,
+0x2B,0x95,0x87,0x0B,0xC4,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0xFE,0x6B,0xAB,0x84,0x9B,0xC0,0x3C,0x6D,0x17,0x05,0xDD,0x1E,0x07,0x25,0xC4,0x2D,0xCA,0x69,0xC0,0x2D,0x24,
+0x8C,0x8B,0x05,0xDE,0x07,0x19,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xCA,0x0E,0x92,0x76,0x2B,0xA3,0x8A,0x0B,0xC6,0x0E,0x95,0x7B,0xFE,0x10,0xC2,0x05,0xC0,0x20,0x22,
+0x05,0xDD,0xA5,0x87,0x27,0x22,0x25,0xC4,0x99,0xC9,0xC6,0x26,0x2D,0xC3,0x13,0xA8,0x74,0x08,0x05,0xDE,0x0F,0xFE,0xE7,0x76,0x0B,0xC1,0x0E,0xC3,0x0B,0x61,0x0E,0x0B,
+0xC4,0x0E,0xC0,0x31,0xAB,0x9A,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0xFE,0x6B,0xAA,0x05,0xC1,0xA7,0x85,0x36,0x8D,0x8C,0x05,0xDC,0x16,0x24,0x20,0x3D,0xC0,0x25,0xC2,
+0x2D,0xC4,0x26,0x2D,0xC5,0x36,0x39,0x05,0xDF,0x07,0x19,0x0B,0xC4,0x0E,0xC0,0x0B,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x92,0x76,0x2B,0x12,0x0B,0xC7,0x93,0x89,0x17,
+0x05,0xC2,0x36,0x0F,0x05,0xDC,0x22,0xA8,0x84,0xFE,0x31,0xE6,0xA3,0x89,0x99,0x99,0x69,0x26,0xC0,0x3D,0x2D,0xC4,0x69,0x2D,0xC0,0x26,0xC3,0x24,0x20,0x05,0xDF,0xB7,
+0x74,0x15,0xA4,0x8A,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC9,0x93,0x89,0x3A,0xA2,0x78,0x0E,0x0B,0xC4,0x0E,0xC0,0x0B,0xFE,0x6B,0xAB,0x84,0x9B,0xC3,0x36,0x8F,0x9B,0x05,
+0xDC,0xB8,0x73,0x39,0x1A,0x7A,0xC0,0x1A,0x1D,0xC0,0x9D,0xA9,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC2,0x2D,0x24,0x1F,0x05,0xDF,0xB7,0x74,0x19,0x0B,0x0E,0xC3,0x0B,0x3A,
+0x0E,0x0B,0xC5,0x0E,0xC0,0x0B,0x0E,0x0B,0xC6,0x0E,0x93,0x79,0x3F,0x05,0xC3,0xB4,0x72,0x1F,0x05,0xDB,0xA5,0x87,0x0F,0x20,0x1D,0xC1,0x1A,0xC0,0x1D,0xC0,0x2D,0xC4,
+0x26,0x2D,0xC0,0x26,0xC2,0xA7,0x77,0x39,0x05,0xE0,0x1E,0x15,0xA4,0x8A,0xC1,0x0E,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0xC2,0x3A,0x0B,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,
+0x0E,0x9D,0x88,0x00,0x05,0xC4,0x13,0x97,0x78,0x17,0x05,0xDA,0x3C,0xAF,0x73,0x92,0x9F,0xA2,0x68,0x1A,0x1D,0xC3,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC2,0x0D,0x9A,0x87,
+0x17,0x05,0xDF,0x24,0x2B,0x12,0x0B,0xC8,0x0E,0xC0,0x0B,0x0E,0x19,0x33,0x36,0x25,0x21,0x0B,0xC6,0x86,0x87,0x05,0xC5,0x13,0x99,0x78,0x17,0x9D,0x9A,0xDA,0x1E,0x39,
+0x1A,0x1D,0xC5,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC2,0x24,0x31,0x05,0xE0,0x24,0xB6,0x7A,0xAD,0x98,0xC0,0x0E,0xC5,0x0B,0x3A,0x0E,0x0B,0x2B,0x33,0x3C,0x05,0xC1,0x31,
+0xFE,0xBE,0x54,0xAD,0x98,0xC0,0x0E,0xC1,0x0B,0x93,0x89,0x3F,0x05,0xC5,0x13,0x31,0x05,0xDA,0xA9,0x97,0x27,0x0F,0x18,0x1D,0xC3,0x1A,0x1D,0x2D,0xC4,0x26,0x2D,0xC0,
+0x26,0xC1,0x13,0x04,0x17,0x05,0xE0,0x1E,0x0F,0x0C,0xA8,0x76,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0x97,0x9A,0x36,0x8D,0x8C,0x05,0xC3,0xBC,0x75,0x0B,0xC1,0x0E,0xC0,
+0x15,0x25,0x14,0x55,0xC5,0x22,0x96,0x89,0x17,0x9D,0x9A,0xD9,0xB8,0x73,0x39,0x91,0xAF,0xC0,0xA2,0x78,0xA2,0x98,0x1D,0x9D,0xA9,0xA3,0x89,0x1D,0xC0,0x2D,0xC4,0x69,
+0x2D,0xC0,0x26,0xC1,0x36,0x39,0x05,0xE0,0xA5,0x87,0x0F,0x93,0x59,0x36,0x2A,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x37,0xFE,0x31,0xA5,0x05,0xC0,0x2B,0xAF,0x79,
+0x30,0x33,0x30,0x95,0x87,0x2A,0x0B,0xC1,0x9D,0x98,0x81,0x8B,0x84,0x9B,0xC7,0x22,0x96,0x89,0x97,0x9C,0xD9,0x3C,0x24,0x95,0x8B,0x3D,0x41,0xC0,0x3D,0x26,0xC0,0x69,
+0xC0,0x15,0x2D,0xC4,0x69,0x2D,0xC0,0x26,0xC1,0x24,0x90,0x8C,0x05,0xE0,0xA6,0x87,0x24,0x94,0x39,0x05,0xBC,0x87,0xFE,0xEF,0xBB,0xC0,0x0B,0x61,0x0B,0xC0,0x0E,0x0B,
+0x93,0x89,0x3F,0x99,0x9A,0x29,0x11,0x0C,0xA8,0x76,0xC1,0x3A,0x0B,0xC0,0x0E,0x0B,0x3A,0x16,0x05,0xC8,0x36,0x31,0x05,0xD8,0x3F,0x0F,0x9F,0x86,0x3D,0xC8,0x2D,0xC4,
+0x26,0x2D,0xC0,0x26,0xC1,0xB2,0x42,0x89,0x9D,0x05,0xE0,0x3F,0x39,0x98,0x37,0x92,0xEF,0x05,0x30,0x2A,0x0B,0xC2,0x0E,0x19,0xFE,0x4A,0x25,0x25,0x21,0x3A,0x0B,0x0E,
+0x0B,0xC5,0x2B,0x16,0x05,0xC9,0x36,0x8D,0x8C,0x05,0xD8,0x39,0xA4,0x96,0x94,0x8F,0x3D,0xC8,0x2D,0xC5,0x26,0x2D,0xC0,0x26,0xA7,0x77,0x39,0x05,0xE1,0xA9,0x97,0x06,
+0x9F,0x68,0x93,0xBC,0x05,0xC0,0x30,0x2A,0x0B,0x3A,0x0B,0xC0,0x30,0x33,0x2A,0x0B,0xC2,0x9C,0x86,0x97,0x8B,0xA2,0x8A,0x12,0x69,0x0E,0x0C,0x83,0x79,0x05,0xCA,0x22,
+0x05,0xD8,0x3C,0xAF,0x73,0x06,0x3D,0xC9,0x9D,0xC9,0xC4,0x26,0x2D,0xC0,0x26,0xC0,0x04,0x99,0x9A,0x17,0x05,0xE0,0x3C,0xC0,0x31,0x0F,0x05,0xC1,0x30,0x2A,0x0B,0x0E,
+0xC0,0x97,0x8A,0x12,0xC0,0x0B,0x8F,0xA8,0x33,0xC0,0x11,0x3D,0x12,0xC0,0x0B,0x93,0x89,0x25,0x14,0x05,0xC9,0xA6,0x87,0x13,0x08,0x05,0xD6,0x3A,0x1E,0x39,0x95,0xAF,
+0x41,0x07,0x3D,0xC7,0x2D,0x69,0xC1,0x2D,0x26,0xC1,0x2D,0x26,0x2D,0x24,0x8E,0x8B,0x17,0x9D,0x9A,0xE0,0x13,0x99,0x78,0x2E,0x98,0x99,0x0F,0x62,0xC1,0xB7,0x67,0xBE,
+0xA6,0x12,0xC1,0x69,0xC0,0x0E,0xC0,0x51,0x0B,0x0E,0x0B,0xC1,0x33,0x80,0x89,0x05,0xCB,0x20,0x3C,0x05,0xD7,0xB8,0x73,0x39,0x95,0xAF,0x41,0x07,0x3D,0xC8,0x2D,0x69,
+0xC2,0x2D,0x26,0x2D,0x26,0xC0,0x1D,0x24,0x8C,0x8B,0x05,0xE1,0xB3,0x84,0x1F,0xA6,0x68,0x4C,0x05,0xC3,0x3C,0x21,0x0B,0xC7,0x0E,0x95,0x7B,0x29,0x05,0xCD,0xAF,0x84,
+0x3F,0x14,0x05,0xD5,0x22,0x0F,0x18,0x3D,0x41,0x07,0x3D,0xC8,0x9D,0xC9,0xC4,0x69,0x2D,0xC0,0x26,0x1D,0x39,0x05,0xE2,0x22,0x05,0xA7,0x78,0xA8,0x43,0x05,0xC5,0xBC,
+0x75,0xB9,0x98,0x12,0xC1,0x0B,0xC1,0x0C,0x30,0x86,0x8A,0x9A,0x89,0xCE,0xAC,0x87,0x08,0x05,0xD5,0x20,0xB0,0x84,0x95,0x8B,0x9C,0x9C,0xC0,0x41,0x07,0x3D,0xC8,0x2D,
+0x69,0xC1,0x2D,0x26,0x2D,0x26,0xC1,0xB1,0x63,0x95,0x7A,0x17,0x05,0xE0,0xA5,0x87,0xAE,0x85,0x05,0x2B,0xAA,0x55,0x93,0xBC,0x05,0xC5,0x15,0x30,0x2A,0x0B,0x0E,0x97,
+0x8A,0x8F,0x86,0x86,0x8D,0x05,0xD0,0x2B,0x05,0xD5,0x2B,0xB3,0x85,0x06,0x9C,0x9C,0xC1,0x41,0x07,0x3D,0xC8,0x2D,0x69,0xC2,0x2D,0x26,0x2D,0x26,0xA3,0x89,0x27,0x8A,
+0x9D,0x17,0x05,0xE0,0xA6,0x87,0x13,0x08,0x05,0xB3,0x33,0x98,0x99,0x28,0x9B,0xBB,0xA6,0x66,0x9C,0x99,0x37,0x06,0xAC,0x54,0xAE,0x53,0xA7,0x97,0x9A,0x9B,0xFE,0x7C,
+0x2B,0x29,0x3A,0x05,0xEA,0xB5,0x84,0xA2,0x76,0x3D,0x41,0x07,0x3D,0xCB,0x2D,0xC4,0x69,0x2D,0xC0,0x1D,0xAB,0x62,0x17,0x05,0xE1,0xA9,0x97,0x3C,0x05,0xC0,0xB5,0x20,
+0xB7,0x52,0x58,0x50,0x9E,0x9B,0xC1,0xA4,0x77,0xA6,0x86,0x6D,0xC1,0x1A,0x0E,0xFE,0x02,0x00,0x05,0xE9,0xB0,0x74,0xA7,0x88,0x95,0xAC,0x3D,0x41,0xA4,0x87,0x3D,0xCB,
+0x2D,0xC4,0x69,0x2D,0xC0,0x1D,0x22,0x05,0xE2,0x13,0x99,0x78,0x97,0x9C,0xC0,0x0C,0x1A,0x18,0xC1,0x1A,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xFE,0x1B,0x41,0x0F,0x05,
+0xE7,0x3F,0xB1,0x85,0x97,0x9C,0x3D,0xCF,0x2D,0xC4,0x26,0x2D,0xC0,0x1E,0x20,0x05,0xE2,0x13,0x90,0x8B,0x05,0xC0,0x0C,0x1A,0x18,0xC0,0x1A,0x18,0xC2,0x1A,0x25,0xA4,
+0x88,0x18,0xC0,0x8F,0xAD,0x28,0x9B,0xBB,0x05,0xC4,0x2B,0x45,0x0F,0x05,0xDD,0x32,0x22,0x3D,0x41,0x07,0x3D,0xCD,0x2D,0x69,0xC1,0x2D,0x26,0x2D,0x26,0xA3,0x89,0xAF,
+0x53,0x17,0x05,0xE1,0x3F,0x13,0x08,0x05,0xC0,0xAF,0x54,0xFE,0x6E,0x26,0x18,0xC0,0x1A,0x18,0xC2,0x06,0xFE,0x43,0xE6,0x9E,0xCD,0x0D,0x18,0x2C,0xFE,0x0A,0x00,0x92,
+0xEF,0x05,0xC0,0xA5,0x87,0xA6,0x45,0xAC,0x54,0xA2,0x75,0x96,0xBE,0xC1,0x13,0x28,0x0F,0x05,0xD9,0x3C,0xAD,0x85,0x3D,0x41,0x07,0x3D,0xCE,0x2D,0x69,0x2D,0xC0,0xA7,
+0x65,0xC0,0x7B,0xC0,0x39,0xA4,0x96,0x17,0x05,0xDB,0x2B,0x37,0x06,0xA4,0x65,0xA5,0x66,0x13,0x0C,0xC0,0x06,0x37,0x9C,0x99,0xAB,0x55,0x0D,0x18,0xC1,0x1A,0x18,0xC2,
+0xFE,0x4C,0x07,0x9D,0xEE,0xFE,0x6D,0x69,0x18,0xC0,0x8B,0xBF,0x19,0x37,0xB0,0x43,0xAD,0x53,0xA7,0x97,0x1A,0x0D,0xFE,0x23,0x03,0xFE,0x00,0x20,0xC0,0x06,0x2E,0x98,
+0x99,0x05,0xD8,0x3A,0xB2,0x74,0x98,0x89,0x9C,0x9C,0xC2,0x41,0x07,0x3D,0xCB,0xA0,0xB8,0xC0,0xA4,0x65,0x1D,0x13,0x1D,0x13,0xC0,0xA7,0x87,0x9F,0x75,0x05,0xDA,0xAB,
+0x44,0x19,0x3B,0x0E,0xA4,0x77,0x1A,0x25,0x19,0x28,0xC0,0x37,0x06,0x2E,0x0C,0x25,0x18,0xC0,0x1A,0x18,0xC3,0x12,0xFE,0x73,0xAD,0xA5,0x50,0xFE,0x76,0x87,0x18,0x25,
+0x15,0xB1,0x62,0x1A,0x18,0xC2,0x25,0x06,0x05,0xC0,0xAA,0x64,0x24,0x05,0xD8,0x3C,0xA7,0x87,0x3D,0x41,0xA4,0x87,0x3D,0xCD,0x26,0x07,0x36,0x1D,0xC0,0x13,0x1D,0x13,
+0xC1,0x0D,0x98,0x78,0x17,0x05,0xD8,0x0C,0x0E,0xA8,0x75,0x18,0xC1,0x1A,0x18,0x2C,0x88,0xAE,0x05,0xC2,0x28,0xAE,0x53,0x0E,0x06,0xA4,0x77,0x18,0x06,0x18,0xC0,0x1A,
+0x25,0xFE,0x5B,0x8B,0xA4,0x42,0x1F,0x18,0x1A,0x0E,0x1F,0x18,0x1A,0x18,0xC0,0x1A,0x18,0x12,0xFE,0x00,0x60,0x05,0xC0,0xAB,0x55,0x59,0x05,0xD7,0x22,0x9C,0x88,0x3C,
+0x3D,0x26,0x07,0x3D,0xCC,0x9D,0xC8,0xC0,0x1D,0xC1,0x13,0xC0,0x1D,0x13,0xC0,0x27,0x8A,0x9D,0x05,0xD8,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC0,0x1A,0x18,0xC3,0x0A,0x06,
+0x05,0xC2,0xA5,0x88,0x12,0x0A,0x1A,0x18,0x9D,0x9A,0x18,0xC1,0x1A,0x12,0x39,0x1F,0x18,0x1A,0x25,0x6B,0x1A,0x18,0xC0,0x1A,0x18,0xC1,0xFE,0x0A,0x00,0x92,0xEF,0x05,
+0x0F,0xAD,0x64,0x95,0xAC,0x0F,0x05,0xD4,0x2B,0xB3,0x85,0x20,0x3D,0xC4,0x41,0x07,0x3D,0xC2,0x9D,0xA8,0xA0,0xA8,0xA0,0xA6,0xA0,0xA9,0x9E,0xB6,0xA2,0xA7,0xA1,0xB8,
+0x76,0xFE,0x4A,0x25,0x1D,0x13,0xC4,0xAB,0x73,0x17,0x05,0xD8,0xFE,0x3C,0x62,0x1F,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC1,0x12,0x28,0x05,0xC2,0xFE,0x43,0xE6,0x2C,0x9E,
+0x86,0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x06,0x12,0x1F,0x18,0x06,0x18,0xC2,0x12,0xFE,0x00,0x60,0x05,0xC0,0x32,0x10,0x96,0xBB,0x05,0xD4,0xAC,0x87,0x22,0x3D,0xC4,0x41,
+0x69,0x3D,0x9D,0xC8,0x2B,0x9E,0xB6,0xA3,0x99,0x25,0x33,0xA1,0xA9,0xC1,0x56,0x05,0x6E,0xFE,0x52,0x26,0xC0,0x13,0xC3,0xA5,0x77,0xA2,0x76,0x89,0xAF,0xD8,0x37,0xFE,
+0x65,0xA7,0x18,0xC1,0x1A,0x18,0xC4,0x06,0x15,0x0F,0x05,0xC1,0xAA,0x66,0x36,0x58,0x50,0x1A,0x18,0xC2,0x1A,0x18,0xC3,0xFE,0x23,0x41,0xAD,0x88,0x18,0x06,0x18,0xC2,
+0x06,0xFE,0x02,0x00,0x05,0xC1,0xAA,0x66,0x4C,0x05,0xD4,0x22,0x9D,0x89,0x1F,0x75,0x20,0x26,0x9E,0xB6,0xA0,0xB8,0x79,0xA2,0xA7,0xA1,0xA9,0x7A,0x61,0xC1,0xA3,0x98,
+0x6E,0xC2,0x05,0xC0,0x3D,0x1D,0xC0,0x13,0xC3,0xAB,0x73,0x98,0x8A,0x8D,0x9F,0xD8,0xAF,0x54,0xFE,0x76,0x09,0x18,0x9D,0x9A,0x18,0xC3,0x06,0x18,0xC1,0x99,0x9B,0x10,
+0x05,0xC2,0xFE,0x44,0xC5,0xAE,0x73,0x9D,0x9A,0x0E,0x06,0x24,0x18,0x06,0x18,0xC3,0x1A,0xFE,0x0A,0xA0,0x31,0x36,0x18,0x06,0x18,0xC2,0xFE,0x23,0x41,0x0F,0x05,0xC0,
+0xA5,0x87,0xA6,0x45,0x0F,0x05,0xD3,0x22,0xFE,0x61,0x43,0x35,0x37,0x3A,0xA3,0x77,0x9E,0xB9,0xC0,0x3D,0x9D,0x99,0x29,0xC2,0x05,0xC0,0x0A,0xC2,0x05,0x3D,0x05,0x1D,
+0xC0,0x13,0xC3,0x27,0x8E,0x9C,0x95,0x9D,0xD8,0x31,0x36,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC0,0x8F,0xAD,0x0F,0x05,0xC1,0xB8,0x21,0x1A,0x18,0xC0,0x94,0x8B,
+0x0D,0x18,0xC2,0x1A,0x18,0xC1,0xFE,0x09,0x81,0x05,0xB4,0x42,0x19,0x18,0xC1,0x1A,0x18,0x39,0xFE,0x00,0xA0,0x0F,0x05,0xC0,0xAA,0x64,0xA5,0x57,0x05,0xD3,0xB8,0x73,
+0x9C,0xF7,0x29,0xC0,0xA3,0x98,0xC0,0x3D,0x29,0x66,0x29,0xC2,0x3D,0x05,0x0A,0xC0,0x05,0x3D,0x0A,0xC0,0x05,0x3D,0x1D,0xC0,0x13,0xC3,0x16,0x88,0x8F,0x9D,0x9A,0xD8,
+0x2A,0xFE,0x76,0x09,0x18,0xC2,0x1A,0x18,0xC4,0x9D,0x9A,0x0D,0xFE,0x23,0x03,0x05,0xC1,0xAA,0x66,0x36,0x18,0xC0,0x1A,0x25,0x50,0x1A,0x18,0xC2,0x06,0x0E,0xFE,0x00,
+0xA0,0x62,0x05,0xFE,0x43,0xE6,0x1A,0x18,0xC2,0x25,0xFE,0x01,0x60,0x05,0xC2,0xAF,0x33,0x05,0xC1,0x6E,0x05,0xCF,0xB5,0x84,0x9D,0xF8,0xFE,0x99,0x61,0x3A,0x29,0xC1,
+0x3D,0x9D,0x99,0x29,0xC1,0x24,0xA4,0x87,0x6E,0xC3,0x05,0x3D,0x0A,0x9D,0x99,0x13,0x7B,0xC0,0x13,0xC1,0x36,0xA2,0x76,0x89,0xAF,0xD9,0x2E,0xFE,0x65,0xA7,0x18,0xC2,
+0x06,0x18,0xC3,0x1A,0x18,0xC0,0x92,0x9E,0x19,0x05,0xC0,0xA7,0x85,0x0E,0x06,0xA4,0x77,0x18,0xC0,0x06,0x0E,0xA4,0x77,0x1A,0x18,0xC0,0x06,0x12,0xFE,0x00,0x40,0x05,
+0xC0,0xA8,0x55,0x12,0x1F,0x18,0xC0,0x06,0x18,0x10,0x05,0xC2,0xA5,0x88,0x2E,0x0A,0x05,0xD1,0x3C,0xAB,0xA4,0x33,0x76,0xC5,0x3D,0x7E,0x6E,0xC1,0x05,0x3D,0x0A,0xC1,
+0x05,0x3D,0x29,0x13,0x1D,0x13,0xC2,0xA9,0x77,0x9D,0x85,0xFE,0x00,0x20,0xD9,0xA9,0x97,0x36,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0xFE,0x0A,0x00,0x92,0xEF,0x05,
+0xA2,0x77,0xBD,0x31,0x1F,0x18,0xC0,0x1A,0x18,0xC0,0x97,0x9A,0x0E,0x06,0x18,0x0A,0xFE,0x09,0x81,0x05,0xC2,0xAF,0x33,0xB7,0x52,0x18,0xC1,0x1A,0xFE,0x1A,0xC1,0xFE,
+0x00,0x40,0x05,0xC2,0x2E,0x98,0x99,0x05,0xD1,0xA5,0x87,0xB5,0xA4,0xFE,0x99,0x61,0x3A,0x29,0xC0,0x66,0xA4,0x87,0x31,0xC1,0x3D,0xA2,0x87,0xC0,0x05,0x3D,0x0A,0xC2,
+0x05,0x3D,0x29,0xFE,0x4A,0x25,0xC2,0x1D,0x13,0x27,0x92,0x9C,0x17,0x9D,0x9A,0xD8,0xAB,0x55,0xFE,0x55,0x63,0x1A,0x18,0xC3,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0x8F,0xAD,
+0x28,0x05,0xC0,0xB8,0x21,0x1A,0x18,0x06,0x18,0xC3,0x92,0x9B,0x0E,0x8C,0x9D,0x05,0xC4,0x10,0xBB,0x41,0x1F,0x18,0x1A,0x87,0xBF,0x0F,0x05,0xC2,0xA7,0x85,0xA8,0x57,
+0x0F,0x05,0xD1,0xB8,0x73,0x35,0x3D,0x29,0xC2,0x3D,0x9D,0x99,0x29,0xC0,0xA3,0x98,0xC0,0x3D,0xA2,0x87,0xC0,0x05,0x3D,0x0A,0xC1,0x05,0x13,0x1D,0x13,0xC2,0xAE,0x63,
+0x89,0x9D,0x17,0x9D,0x9A,0xD8,0xA8,0x55,0xFE,0x54,0xE7,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC1,0x06,0x18,0xFE,0x02,0x00,0x92,0xFF,0x05,0xB4,0x42,0xBB,0x30,0x18,
+0x06,0x18,0xC3,0x1A,0x98,0x88,0x15,0x28,0x9B,0xBB,0x05,0xC2,0x6E,0xAE,0x33,0x0E,0x06,0xA4,0x77,0x15,0x0F,0x05,0xC3,0x2E,0x9C,0x88,0x05,0xD1,0xAC,0x87,0x22,0xFE,
+0x99,0x61,0x9F,0xB8,0xC1,0x3D,0x29,0x66,0xC0,0x29,0xC1,0xA3,0x98,0xC0,0x3D,0xC0,0x05,0x6E,0xC0,0x05,0xC0,0x1D,0xC0,0x13,0xC1,0xA5,0x77,0xA6,0x84,0x88,0x8F,0x9D,
+0x9A,0xD9,0xA6,0x87,0xFE,0x3C,0x62,0x1F,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC2,0x8A,0x9E,0xFE,0x00,0x40,0x05,0xB4,0x42,0x06,0x18,0xC1,0x06,0x18,0xC3,0x1A,
+0x39,0x0C,0x91,0xCC,0x0F,0x05,0xC2,0xAF,0x33,0x0E,0x1A,0x29,0x0A,0x05,0xC4,0xAF,0x54,0x0F,0x05,0xD1,0xB8,0x73,0x35,0x3D,0x7E,0xC0,0x3D,0xA2,0x87,0xC0,0x05,0x3D,
+0x51,0xC0,0x66,0x05,0x51,0x3D,0x29,0xC0,0x05,0x0A,0x29,0x13,0xC2,0x1D,0xA7,0x54,0x16,0xFE,0x00,0x20,0xDB,0x15,0x1A,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x0E,
+0x19,0x05,0x0C,0x1A,0x18,0xC0,0x06,0x18,0xC3,0x1A,0x18,0xC1,0x12,0x10,0x05,0xC2,0x6E,0xAE,0x33,0xB7,0x52,0x15,0xFE,0x00,0x60,0x05,0xC4,0xAA,0x66,0x4C,0x05,0xD1,
+0xAB,0x86,0x22,0xFE,0x89,0x40,0x33,0xA1,0xA9,0xC0,0x6E,0xC1,0x29,0x66,0x05,0x31,0x3D,0x31,0xC0,0x05,0x0A,0xC1,0x29,0x13,0xC0,0x1D,0xC0,0x13,0xAB,0x75,0x96,0x99,
+0x8F,0x8E,0xDB,0x08,0xFE,0x6E,0x26,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC2,0xFE,0x09,0x81,0x05,0xAF,0x33,0x0D,0x18,0xC2,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC0,0x99,
+0x9B,0x8D,0xBE,0x92,0xCF,0x05,0xC2,0xAB,0x55,0x0C,0x19,0x05,0xC4,0x2B,0xAA,0x55,0x19,0x0F,0x05,0xD0,0x36,0x35,0x29,0xC1,0xA3,0x98,0xC0,0x3D,0x29,0x66,0x05,0x51,
+0x3D,0x31,0x05,0x6E,0xC1,0x29,0xC0,0x13,0xC0,0x1D,0x13,0xC0,0x27,0x8C,0x9D,0x9A,0x8A,0x9D,0x9A,0xDA,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC0,0x9D,0x9A,0x18,0xC3,0x1A,
+0x18,0xC3,0x06,0xFE,0x23,0x03,0x05,0x2E,0x36,0x18,0xC0,0x1A,0x18,0xC5,0x06,0x18,0xC2,0x0E,0x19,0x28,0x9A,0xBB,0x05,0xC0,0xAF,0x33,0xC0,0x0F,0x05,0xC4,0x2E,0x9C,
+0x88,0x05,0xD1,0x3A,0x22,0xFE,0x89,0x40,0x29,0xC1,0x3D,0x9D,0x99,0x29,0x24,0x29,0xC1,0xA3,0x98,0xC0,0x6E,0xC2,0x9D,0x99,0x13,0x1D,0x13,0x1D,0x13,0x27,0x87,0xAF,
+0x9C,0x8A,0xDB,0x10,0x0E,0xA8,0x75,0xA4,0x77,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC1,0x8F,0xAD,0x0F,0x2A,0x0D,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC3,0x12,0x0C,
+0x91,0xCC,0x05,0x6E,0xAE,0x33,0x2E,0x0A,0x05,0xC3,0xA7,0x85,0x0C,0x19,0x05,0x0A,0x05,0xCF,0xB8,0x73,0x35,0x29,0xA3,0x98,0xC0,0x3D,0x9D,0x99,0x29,0xC1,0x24,0x29,
+0xC0,0x05,0x6E,0xC2,0x9D,0x99,0x1D,0xC0,0x13,0xC0,0xA5,0x77,0x39,0x89,0xAF,0xDC,0x2B,0x12,0xB1,0x75,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC1,0x0E,0x19,0x2E,0xFE,
+0x65,0xA7,0x18,0xC0,0x06,0x18,0xC3,0x1A,0x18,0xC4,0x06,0x18,0xC0,0x99,0x9B,0x15,0x28,0x9B,0xBB,0x05,0x10,0x2E,0x92,0xCC,0x05,0xC3,0xAF,0x33,0x9B,0x99,0x05,0x0A,
+0x05,0xCF,0xA9,0x85,0xB2,0x86,0xFE,0x99,0x61,0xA2,0xA7,0xC0,0x66,0x3D,0x29,0xC0,0x66,0x29,0xC1,0x05,0xC1,0x0A,0xC1,0x1D,0xC0,0x13,0xC0,0x04,0x45,0x17,0x9D,0x9A,
+0xDC,0xB7,0x10,0x06,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x25,0xFE,0x09,0x81,0x19,0x0D,0x18,0xC4,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC4,0x0D,0x15,0x0F,0x05,0xC0,
+0xAA,0x66,0xA5,0x55,0x05,0xC1,0x6E,0x0F,0x2A,0x3E,0x9A,0x9A,0xC0,0x9C,0xAB,0x05,0xCF,0xB8,0x73,0x35,0x3D,0x7E,0x31,0xC1,0x52,0x29,0xC1,0x05,0xC1,0x6E,0xC0,0x05,
+0x3D,0x1D,0xC1,0x59,0xAB,0x75,0x14,0x8D,0x9F,0x6B,0x05,0xDB,0xAF,0x33,0x0D,0x18,0xC0,0x1A,0x18,0xC6,0x9D,0x9A,0x18,0xC1,0x2C,0xA4,0xBB,0x1A,0x18,0xC0,0x06,0x18,
+0xC3,0x1A,0x18,0xC5,0x06,0x18,0xC1,0x25,0xFE,0x01,0x60,0x05,0x6E,0x6E,0x2A,0x9C,0x79,0x05,0xA8,0x55,0x2E,0xC0,0xA0,0x65,0x06,0x99,0xBB,0x37,0x24,0xC0,0x0F,0x05,
+0xCD,0xB0,0x95,0xA9,0xB5,0xFE,0x99,0x61,0x7A,0x29,0xC0,0x31,0xC1,0x3D,0x29,0xC1,0xA3,0x98,0xC0,0x3D,0xA2,0x87,0xC0,0x1D,0xC1,0x13,0xAB,0x75,0x90,0x8A,0x95,0x9D,
+0xDD,0xA8,0x55,0xFE,0x54,0xE7,0x18,0xC0,0x1A,0x18,0xC7,0x9D,0x9A,0x18,0xC0,0x8A,0x9E,0xA1,0xBC,0x1F,0x18,0x1A,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC6,0x25,0xFE,
+0x09,0x81,0x96,0xCC,0x05,0xC0,0x37,0xAB,0x66,0x9C,0x88,0x06,0x2E,0x24,0x06,0xC0,0x55,0x73,0x19,0x10,0x2E,0x19,0x0F,0x05,0xCB,0x20,0xAE,0xA3,0x33,0x3D,0x51,0xC0,
+0xA3,0x98,0x29,0x05,0x6E,0x29,0xC1,0x05,0xC0,0x3D,0x0A,0xC0,0x1D,0xC0,0x59,0xC0,0x27,0x8A,0x9D,0x99,0x9C,0xDE,0xFE,0x23,0xC1,0x1A,0x18,0xC4,0x9D,0x9A,0x18,0xC3,
+0x1A,0x18,0x8F,0xAD,0xC0,0x1F,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC6,0x97,0x9A,0x28,0x9B,0xBB,0x05,0xC0,0xA5,0x87,0xAA,0x55,0x19,0x05,0xC2,0x2B,0x19,0x37,0xA3,
+0x77,0x2E,0x2B,0x31,0x19,0x05,0xCB,0xA9,0x97,0x1C,0xFE,0x99,0x61,0xA1,0xB8,0x6E,0x9C,0x89,0xC1,0x05,0xC0,0x3D,0x9D,0x99,0x29,0x05,0xC0,0x3D,0x0A,0x05,0x1D,0xC0,
+0x13,0xC0,0x27,0x17,0x9D,0x9A,0xDE,0x31,0x36,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC2,0x97,0x9A,0x0E,0x18,0xC0,0x1A,0x18,0xC8,0x06,0x18,0xC3,0x1A,0x18,0x12,
+0x0F,0x05,0xC1,0x15,0x19,0x0F,0x05,0xA5,0x88,0x10,0x03,0x5C,0x19,0x10,0x0F,0x10,0x96,0xBB,0x10,0x0A,0x05,0xCB,0x20,0xAE,0xA3,0x33,0x3D,0xA2,0x87,0xC0,0x66,0x29,
+0xC1,0x3D,0x24,0x3D,0x05,0x0A,0xC0,0x05,0xC0,0x1D,0x13,0x1D,0xA5,0x66,0xA6,0x84,0x17,0x9D,0x9A,0xDE,0x10,0xFE,0x44,0xC5,0x1F,0x18,0xC0,0x1A,0x18,0xC8,0x99,0x9C,
+0x9E,0x86,0x18,0x06,0x18,0xC3,0x1A,0x18,0xC7,0x06,0x18,0xC1,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0xC0,0xAA,0x66,0x37,0x19,0x05,0xC1,0x2B,0x32,0x10,0x37,0xA3,0x77,
+0x2E,0x59,0x48,0x9C,0xCC,0x28,0x0F,0x05,0xC2,0x6E,0x05,0xC5,0xB3,0x84,0x1C,0xFE,0x99,0x61,0xA1,0xB8,0x6E,0xC0,0x05,0x3D,0x29,0xC0,0x66,0x3D,0x05,0x0A,0xC0,0x05,
+0x51,0xC0,0x13,0xC0,0x1D,0xA8,0x55,0x54,0x89,0xAF,0xE0,0xFE,0x23,0x41,0x1A,0x18,0xC0,0x1A,0x18,0xC8,0x9D,0x9A,0x95,0x9A,0x1F,0x18,0x1A,0x18,0xC2,0x06,0x18,0xC3,
+0x1A,0x18,0xC4,0x2C,0xFE,0x09,0x81,0x05,0xC0,0x2B,0x10,0x96,0xBB,0x05,0xC8,0x03,0x0C,0x9C,0x88,0x99,0xBB,0x19,0x05,0xCA,0xBB,0x83,0xFE,0x8A,0x21,0xFE,0xB1,0x81,
+0x6E,0xC2,0x31,0xC2,0x3D,0x29,0xC0,0x3D,0x05,0x0A,0xC0,0x13,0xC0,0x1D,0xA8,0x55,0x26,0xFE,0x00,0x20,0xE0,0x2E,0xFE,0x65,0xA7,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,
+0x18,0xC2,0x12,0x1F,0x18,0xC4,0x06,0x18,0xC3,0x1A,0x18,0xC4,0x12,0x28,0x05,0xC0,0xAA,0x66,0x28,0x9B,0xBB,0x05,0xC2,0x03,0x24,0xC1,0x58,0x10,0x59,0x13,0x0C,0x28,
+0x0F,0x05,0xC2,0x6E,0x05,0xC4,0x20,0xB0,0x84,0x33,0x31,0xA3,0x88,0xC0,0x66,0x3D,0x0A,0xC0,0x29,0xC1,0x3D,0x9D,0x99,0x3D,0x05,0xC0,0x3D,0x1D,0x59,0xC0,0x16,0x14,
+0x8D,0x9F,0xE0,0x37,0xFE,0x54,0xE7,0x18,0xC0,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC3,0x8F,0xAD,0x0D,0x18,0xC5,0x06,0x18,0xC3,0x1A,0x18,0xC3,0xFE,0x0A,0x00,0x92,0xEF,
+0x05,0x37,0xA3,0x77,0x0A,0x05,0xC9,0x37,0x2E,0x3E,0x28,0x0F,0x05,0xC2,0x0A,0x05,0xC4,0xB5,0x84,0x35,0xFE,0xB1,0x81,0xC0,0x3D,0xA2,0x87,0x05,0x0A,0xC0,0x05,0x3D,
+0x29,0xC0,0x05,0xC0,0x3D,0x0A,0x05,0x0A,0xFE,0x4A,0x25,0x1D,0x13,0x27,0x20,0x95,0x9B,0xE0,0xA5,0x87,0xB2,0x11,0xFE,0x6E,0x26,0x18,0x06,0x18,0xC3,0x1A,0x18,0xC3,
+0x97,0x9A,0x2C,0x1A,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC5,0x12,0x28,0x05,0xC0,0x0C,0x91,0xCC,0x05,0x6E,0x05,0x0A,0x05,0xC4,0x19,0x37,0x0F,0x05,0xAB,0x44,0x2E,
+0x0F,0x05,0xC8,0x3C,0xB0,0x73,0xFE,0x99,0x61,0xA2,0xA7,0xC1,0x66,0x3D,0x0A,0xC1,0x05,0xC1,0x3D,0x0A,0x05,0x0A,0x05,0x0A,0x13,0x1D,0x13,0x27,0x8C,0x9D,0x17,0x9D,
+0x9A,0xE0,0x10,0xFE,0x55,0x63,0x18,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC4,0x0E,0x06,0xA4,0x77,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0x2C,0x0A,0xC0,0x0E,0x91,0x9C,0x96,
+0xBC,0x0C,0xA1,0x54,0x3E,0x0C,0xC0,0x13,0xC0,0xA0,0x9A,0x9C,0x99,0x28,0x7F,0x15,0x06,0x24,0x06,0x2E,0x0C,0x37,0x19,0x37,0x06,0x96,0xCC,0x05,0xC7,0xB8,0x73,0x1C,
+0xFE,0x99,0x61,0xA1,0xB8,0x6E,0xC1,0x05,0x3D,0x0A,0xC1,0x05,0xC1,0x0A,0xC2,0x31,0x1D,0x59,0x1D,0x27,0x8A,0x9D,0x99,0x9C,0xE2,0xFE,0x3B,0xE5,0x1F,0x18,0xC0,0x1A,
+0x18,0xC8,0x8F,0xAD,0x1F,0x0D,0x18,0x99,0x9C,0xC0,0x9E,0x86,0xC0,0x0E,0x44,0x61,0x12,0xC1,0x24,0x0E,0x35,0x92,0xAD,0x91,0xDF,0x73,0x2B,0x05,0x19,0x62,0x05,0xC1,
+0x19,0x37,0xA7,0x66,0x58,0xA5,0x66,0x13,0x92,0xEF,0x05,0x0F,0x37,0x0C,0x06,0x37,0x10,0x2E,0x19,0x05,0xC6,0xA9,0x97,0xB2,0x73,0xFE,0x99,0x61,0xA2,0xA7,0xC2,0x66,
+0x3D,0x0A,0xC1,0x05,0xC2,0x0A,0xC2,0x9D,0x99,0xBC,0x56,0xC0,0x93,0xA9,0x01,0xC0,0x07,0x01,0x9C,0x88,0x9A,0x99,0x01,0x99,0x99,0xC0,0x01,0x27,0x19,0xA3,0x89,0x07,
+0xAC,0x78,0x39,0x92,0xB8,0x42,0x07,0x27,0x19,0x7F,0x39,0x01,0xC4,0x3C,0xC0,0x19,0x00,0x9C,0x88,0x9C,0xA9,0x26,0x07,0x00,0xC0,0x19,0x01,0xC0,0x39,0x3C,0x01,0xF9,
+0x27,0x19,0x01,0xE0,0x00,0x3D,0x26,0xA5,0x78,0x18,0x6E,0xC0,0x39,0x01,0x3C,0x01,0xF2,0x3C,0x97,0x78,0x27,0x3D,0x26,0x3D,0x1D,0x27,0x19,0x28,0xC0,0x39,0x01,0x3C,
+0x01,0x28,0x19,0x27,0x3D,0x26,0x69,0x07,0x18,0x00,0xC0,0x01,0xA1,0xA7,0x69,0xC7,0x6D,0x69,0xC1,0x63,0x3C,0x32,0x35,0x47,0x9F,0x9B,0xC4,0x01,0xC2,0x39,0x01,0xC3,
+0x3E,0x9F,0x96,0x9D,0x8A,0x54,0x69,0x9E,0x9B,0x51,0xA3,0x85,0x9D,0x9A,0x6F,0x9B,0x9A,0x67,0xC1,0x9D,0x89,0x50,0x51,0x05,0x31,0xC0,0x05,0x20,0xA5,0x87,0xA4,0x86,
+0x22,0x26,0x0F,0x24,0xA2,0x76,0xA2,0x78,0x35,0x6B,0x9E,0x7B,0xC1,0x67,0x35,0x24,0x20,0x97,0x9C,0x99,0x99,0x9C,0x8A,0xF0,0x31,0x14,0xA8,0x86,0x35,0x3E,0xC0,0x01,
+0xCD,0x07,0x9C,0x88,0x07,0x1D,0x92,0xA8,0x52,0x05,0xF5,0xAF,0x84,0x39,0x35,0xC0,0x9E,0x7C,0x3C,0x01,0xC9,0x8F,0xAA,0xA2,0x97,0x1D,0x7B,0x1D,0x3A,0x3C,0x01,0xC5,
+0x19,0x3D,0x1F,0x1D,0xC0,0x35,0x3A,0xC0,0x01,0xC0,0x3C,0x01,0xC0,0x19,0x26,0x07,0x18,0x1D,0xC0,0xA4,0xA5,0x38,0x9E,0x9B,0x01,0xC2,0x19,0x26,0x3D,0x1D,0x27,0x07,
+0x1D,0xA8,0xA5,0x17,0x05,0xFD,0xC0,0x20,0x24,0xA2,0x76,0x3E,0x9E,0x7B,0x0F,0x05,0xFD,0xC2,0xA5,0x87,0x22,0x38,0x0F,0x05,0xA7,0x87,0x39,0x16,0x99,0x8B,0x1A,0x05,
+0xFD,0xC8,0xAE,0x85,0x24,0x0F,0x93,0x9B,0x24,0x0F,0x18,0x1D,0x1A,0x05,0xA9,0x85,0x24,0xC0,0x1D,0xC0,0x8F,0xBA,0xC0,0xA6,0x87,0x1E,0x16,0x06,0x05,0x1D,0x2B,0xFE,
+0xF7,0xF9,0x9D,0x99,0x91,0x9A,0x36,0x8F,0x9B,0x05,0xC4,0xB0,0x95,0x44,0x17,0x05,0xE9,0x3C,0x24,0x39,0x1D,0xC0,0xA6,0x95,0x05,0xD5,0x1E,0x2B,0xA3,0x8A,0x69,0xC0,
+0x61,0x95,0x79,0x8C,0x87,0x8C,0x9A,0x97,0x9C,0xB6,0x70,0x0A,0x05,0xD4,0xB3,0x85,0xFE,0xE7,0x76,0xA4,0x8A,0xC2,0x3A,0x15,0x8B,0x9A,0x8C,0x98,0x9B,0x8D,0xFE,0xCE,
+0xB3,0x04,0x0B,0xC3,0x3A,0x91,0x98,0x8B,0x79,0x1F,0x05,0xC0,0xA9,0x85,0xFE,0xAD,0x8E,0x04,0x0B,0x2B,0x3D,0x13,0x90,0x8B,0x5A,0xE5,0xA9,0x85,0xB2,0x86,0x39,0x1D,
+0xC0,0x1A,0x1D,0xC4,0x98,0xB8,0xFE,0xBE,0x54,0xAD,0x98,0xC6,0x98,0x87,0x8A,0x89,0x31,0x99,0x9C,0xC0,0x0F,0xBE,0x9A,0x0B,0x3A,0x0B,0x19,0x35,0x31,0x17,0x05,0xE4,
+0xAE,0x85,0x24,0x99,0x89,0x1D,0x1A,0xC0,0x1D,0xC2,0x9D,0xA9,0x97,0x98,0x21,0x0B,0xC3,0x7A,0x0B,0xC1,0x15,0x1F,0x31,0x05,0x3F,0xFE,0x9D,0x2D,0x04,0x0B,0xC1,0x15,
+0x8B,0x9A,0x86,0x89,0x05,0xE5,0x20,0x35,0x18,0x1D,0xC5,0x0B,0xC0,0x0E,0x0B,0x15,0x0F,0x12,0x05,0xB5,0x84,0x15,0x9E,0x9B,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0xC1,0x15,
+0x88,0x9A,0x87,0x8A,0x31,0x22,0xC0,0xAE,0x78,0xA3,0x8A,0x0B,0xC1,0x96,0x86,0x84,0x8A,0x8C,0x9B,0x9D,0x8A,0x66,0xE2,0x3F,0xB4,0x84,0x32,0x1D,0xC0,0x1A,0x99,0xBA,
+0xC0,0x3E,0x8F,0x9A,0x05,0xD7,0xFE,0x7C,0x2B,0x04,0x0B,0xC3,0x93,0x89,0x99,0x9A,0x9C,0x99,0xC0,0x11,0xC0,0x9B,0x96,0x24,0x31,0x2B,0x0F,0xB9,0x89,0x0E,0x0B,0xC0,
+0xFE,0x3A,0x03,0x39,0x20,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x0E,0x0B,0xC1,0x15,0x0F,0x84,0x8A,0x97,0x9C,0xBA,0x67,0xC2,0x01,0xC3,0x3C,0x01,0xC4,0x9C,0x95,0x0A,0x05,
+0xD7,0x1E,0xFE,0xEF,0x98,0x57,0x11,0x20,0x05,0xC2,0x3F,0x29,0xA9,0x89,0x33,0x11,0xC0,0xA2,0x97,0x1E,0xAF,0x86,0x04,0x0B,0xC4,0x0E,0x2B,0x0F,0x1D,0x00,0xA3,0x88,
+0xC0,0x01,0x3C,0x01,0x3C,0x01,0xC5,0x69,0x98,0xA6,0x8D,0x9D,0xD8,0x29,0x11,0x86,0x9B,0x91,0x99,0xA7,0x88,0xB1,0x76,0x33,0xA7,0x98,0xA8,0x77,0xA3,0x98,0xA4,0x87,
+0x0B,0x0E,0xC1,0x0B,0x96,0x86,0x1F,0x2B,0x0B,0xC1,0x3A,0x0B,0xC2,0x2B,0x0B,0xC2,0x0E,0xC0,0x0B,0x0E,0x0B,0x3A,0x21,0x34,0x0B,0xC3,0x0E,0xC1,0x8E,0x89,0x83,0x88,
+0x39,0x92,0x9B,0x17,0x9D,0x9A,0xE1,0x39,0x0B,0xC0,0x0E,0xC1,0x0B,0x61,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x34,0x9A,0x87,0x0B,0xC0,0x0E,0x0B,0xC2,0x93,0x89,0x3F,0x68,
+0x05,0xD9,0x20,0x19,0x04,0x6B,0x0E,0x0B,0xC2,0x3A,0x0B,0x0E,0x0B,0xC2,0x0E,0xC0,0x92,0x76,0x0B,0xC0,0x0E,0xC1,0x0B,0x9A,0x99,0x88,0x89,0xB1,0x77,0x3D,0x19,0x9C,
+0x75,0x22,0xC0,0x05,0xD9,0x16,0x31,0xAE,0x8A,0x2B,0x0C,0x3D,0x0C,0xA2,0x87,0x0B,0xC5,0x0E,0xC0,0x0B,0x34,0x0B,0xC4,0x31,0x0B,0x0E,0x0B,0x0E,0xC0,0x8F,0x98,0x82,
+0x79,0x05,0xE1,0x3F,0xB7,0x82,0x97,0x9C,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0xC0,0x26,0xA4,0x87,0x62,0xC5,0x26,0x07,0x3D,0xC5,0x36,0x92,0x89,
+0x05,0xD9,0xA6,0x87,0xBC,0x84,0xB1,0x7B,0xA2,0x97,0xC0,0x2D,0x88,0x78,0x8C,0x77,0x9B,0xBB,0x25,0x2D,0x12,0x0B,0xC0,0x0E,0xC3,0x0B,0x61,0x0E,0x0B,0x2B,0x95,0x87,
+0x0B,0xC0,0x0E,0x0B,0x0C,0x37,0x33,0x3E,0x39,0x17,0x05,0x18,0x9C,0xA9,0xCF,0xA9,0x84,0x0F,0x05,0xD9,0xA5,0x87,0xFE,0x9D,0x2D,0xB6,0x9F,0xC1,0x9B,0x87,0x85,0x21,
+0x9B,0x66,0x92,0xDF,0x05,0xA7,0x85,0xFE,0xB5,0xB2,0x0B,0xC0,0x3A,0x0B,0xC0,0x0E,0x0B,0x0E,0xC0,0x0B,0xC0,0x92,0x86,0xAB,0x9A,0x0B,0xC0,0x3A,0x8A,0x8B,0x80,0x89,
+0x05,0xC0,0xB7,0x67,0xAB,0xB5,0x8D,0x89,0x05,0x0A,0x05,0xD9,0xA6,0x87,0xFE,0x9D,0x2D,0xB6,0x9F,0xC1,0x93,0x74,0x12,0x9E,0xAB,0x28,0x0F,0x05,0xA5,0x88,0xFE,0xB5,
+0xB2,0xB2,0x78,0x69,0xC0,0x0E,0xC3,0x0B,0x9A,0x99,0x9C,0x75,0x0B,0xC0,0x04,0x87,0x99,0x05,0xC0,0xA7,0x78,0xFE,0x1A,0xC1,0xB3,0xBD,0xB1,0xDC,0x86,0x83,0x17,0x05,
+0xE0,0xAE,0x85,0xAD,0x83,0x8E,0x8D,0x3D,0x6E,0x3D,0xA5,0x67,0x3D,0xC4,0x26,0x3D,0xC0,0xA9,0x84,0x9B,0x89,0x90,0x9C,0xDA,0xA5,0x87,0xFE,0x9D,0x2D,0xB5,0x9E,0x31,
+0xC0,0x11,0x8F,0x00,0x9E,0xAB,0x28,0x05,0xA8,0x55,0xA7,0x77,0x9B,0xCC,0x2D,0xAB,0x97,0x0B,0xC3,0x0E,0x0B,0x92,0x86,0xAB,0x9A,0x0B,0xC0,0x88,0x9B,0xFE,0x10,0xC1,
+0x0A,0x05,0xAB,0x44,0xAE,0x31,0xAD,0xDD,0x1B,0x94,0x75,0xFE,0x3A,0x24,0x05,0xC0,0x3D,0x07,0x3D,0xC6,0x07,0x3D,0xC0,0xAC,0x73,0x8F,0x9A,0x17,0x05,0xDA,0xFE,0x7C,
+0x2B,0x1B,0xA1,0x9A,0xC0,0x0B,0x12,0x4A,0x3E,0x45,0x3E,0x2C,0xFE,0x6B,0xAA,0x9B,0x7B,0xFE,0xE7,0x38,0xA4,0x87,0xA2,0x78,0xC3,0x9D,0x98,0x95,0x87,0x0B,0x0E,0x8F,
+0x9B,0xFE,0x19,0x63,0xA9,0x55,0x98,0x99,0x05,0xAF,0x33,0x12,0x23,0xB6,0xDD,0x9B,0x87,0x82,0x84,0x17,0x05,0x3D,0xCB,0xAB,0x74,0x8D,0xAB,0x05,0xDB,0xFE,0x7C,0x2B,
+0x1B,0x31,0xC0,0x33,0x1F,0x12,0x4A,0x9C,0xCA,0x0C,0xA5,0xDB,0xB8,0xFE,0x55,0x30,0xBD,0x88,0x0B,0x3A,0x0B,0xC0,0x0E,0x19,0xC0,0x0E,0x3D,0x30,0xC0,0x12,0x4A,0x3E,
+0x12,0x1D,0x3D,0x1B,0x11,0x21,0x87,0x99,0x05,0x02,0xC4,0x66,0xC4,0xA4,0x97,0xA3,0x75,0x05,0xDC,0x35,0xB9,0xAC,0x31,0xC1,0x33,0x8D,0x98,0x99,0x22,0xC0,0x01,0x0C,
+0x31,0xC0,0x93,0x74,0x2D,0xAB,0x97,0x69,0x0E,0x0B,0x0E,0x34,0x3A,0x55,0x33,0x1B,0x9C,0x88,0x01,0x93,0x54,0xC0,0x2C,0x2D,0x12,0x11,0xAB,0x98,0x19,0x83,0x87,0x17,
+0x02,0x07,0x20,0x05,0xDC,0x35,0xA9,0xAD,0x37,0xAC,0x79,0x1B,0x31,0xC0,0x9E,0x75,0xC0,0x0B,0x33,0x0C,0x2D,0x11,0xA7,0x87,0xAD,0x98,0xC0,0x0E,0xC0,0x04,0x92,0x87,
+0x0B,0x8E,0x99,0x37,0x1B,0xA1,0x9A,0x1B,0x33,0xC1,0x0C,0x11,0x3D,0x12,0x0B,0x8D,0x96,0xFE,0x21,0x41,0x02,0x1E,0x8B,0x9B,0x9C,0x8A,0xDC,0x35,0xBE,0x99,0x0C,0x11,
+0x9C,0x99,0xC3,0x11,0x21,0xA5,0x78,0x0C,0x3A,0xA2,0x78,0x0E,0x0B,0xC1,0x19,0x9C,0x75,0x04,0x0E,0x37,0x95,0x86,0x33,0x11,0xC0,0x33,0x30,0x21,0x0B,0xC2,0x34,0xFE,
+0x52,0xC6,0x99,0xDD,0x39,0x05,0xDD,0xBB,0x82,0xBF,0x88,0x0B,0xC4,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0x3A,0x0B,0x15,0x34,0x0B,0xC1,0x0E,0xC1,0x2B,0xC0,
+0x12,0x0B,0xC3,0x2B,0x80,0x88,0x91,0xCE,0x7A,0xC0,0x06,0x09,0xC6,0x06,0x09,0xC1,0x1E,0x8E,0x89,0x05,0xDD,0x07,0x15,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x0B,0xC5,0x0E,
+0x0B,0x15,0x19,0x0B,0xC3,0x0E,0x0B,0xC6,0x33,0x3C,0x22,0x05,0xDF,0x0F,0x9F,0x86,0xFE,0x21,0x24,0x0E,0x0B,0xC0,0xFE,0x52,0xE3,0x05,0xDE,0x07,0xFE,0xE7,0x38,0x0B,
+0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC6,0x0E,0x0B,0x0E,0xC0,0x92,0x76,0x0B,0x0E,0xC0,0x0B,0x0E,0xC3,0x0B,0x3A,0x0E,0x0B,0x93,0x89,0xFE,0x00,0x60,0x0E,0x5A,0xC3,0x0E,
+0xC0,0x0B,0x0E,0x0B,0xC0,0xFE,0x6B,0xAB,0x84,0x9B,0xC0,0x3C,0x6D,0x17,0x05,0xDD,0x24,0x8E,0xCF,0xC0,0x24,0x8C,0x8B,0x05,0xDE,0x07,0x19,0x0B,0xC0,0x0E,0x0B,0xC0,
+0x0E,0x0B,0xCA,0x0E,0x92,0x76,0xAB,0x9A,0x0B,0xC9,0xFE,0x31,0xA6,0x0B,0xC1,0x0E,0x0B,0xC9,0x31,0x2D,0xC0,0x24,0x1F,0x05,0xDF,0x36,0x19,0x0B,0xC0,0x0E,0xC2,0x0B,
+0x61,0x0E,0x0B,0xC5,0x0E,0xC0,0x0B,0x0E,0x0B,0xC6,0x0E,0x93,0x79,0xFE,0x10,0xC1,0x05,0xC3,0xB4,0x72,0x1F,0x05,0xDB,0x2B,0xB3,0x85,0x20,0x9D,0x7D,0xC2,0xFE,0xF7,
+0xFA,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0xC0,0x9D,0x88,0x00,0x05,0xC4,0x13,0x97,0x78,0x17,0x05,0xDA,0x3C,0x27,0x1D,0x9E,0xA5,0x17,0x05,0xDF,0x24,0x2B,0x12,0x0B,
+0xC8,0x0E,0x0B,0xC0,0x0E,0x19,0x33,0x36,0x25,0x11,0x12,0x0B,0xC5,0x86,0x87,0x05,0xC5,0x13,0x99,0x78,0x17,0x9D,0x9A,0xDA,0x36,0x0B,0x0E,0x0B,0x0E,0xC2,0x0B,0x61,
+0x0E,0x0B,0x0C,0x33,0x3C,0x05,0xC1,0x31,0xFE,0xBE,0x54,0xAD,0x98,0xC0,0x0E,0xC1,0x0B,0x95,0x8B,0x05,0xC6,0x22,0x96,0x89,0x17,0x9D,0x9A,0xD9,0x0F,0x39,0x15,0xC0,
+0xA2,0x78,0x3D,0x1D,0xC0,0x22,0x0A,0x05,0xDF,0xA5,0x87,0x0F,0x93,0x59,0xAC,0xAB,0x2A,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x37,0xFE,0x31,0xA5,0x05,0xC0,0x2B,
+0xAF,0x79,0x30,0x33,0x30,0x95,0x87,0x2A,0x0B,0xC0,0x0E,0x1E,0x92,0x8A,0x05,0xE0,0xA6,0x87,0x24,0x94,0x39,0x05,0xBC,0x87,0x0B,0x53,0x0B,0x61,0x0B,0xC0,0x0E,0x0B,
+0x93,0x89,0x3F,0x99,0x9A,0xB3,0x85,0x11,0x0C,0x3A,0xA2,0x78,0xC3,0x0E,0x0B,0x3A,0x16,0x05,0xC8,0x36,0x31,0x05,0xD8,0x3F,0x35,0x32,0x3D,0xC3,0xA2,0x77,0xFE,0xEF,
+0x98,0x0B,0xC3,0x9A,0x99,0x13,0x29,0x20,0xA5,0x87,0x9F,0x68,0x93,0xBC,0x05,0xC0,0x30,0x2A,0x0B,0xC2,0x30,0x33,0x2B,0x0B,0xC2,0x9C,0x86,0x97,0x8B,0x2D,0x12,0x69,
+0x0E,0x0C,0x83,0x79,0x05,0xCA,0x22,0x05,0xD8,0x3C,0x27,0x06,0x3D,0xC8,0x26,0xAD,0xA4,0x9A,0x87,0x05,0xE1,0x3C,0xC0,0x31,0x0F,0x05,0xC1,0x30,0x2B,0x0B,0xC0,0x0E,
+0x97,0x8A,0x12,0x0B,0xC0,0x21,0x33,0xC0,0x11,0x3D,0x12,0x0B,0xC0,0x93,0x89,0x25,0x14,0x05,0xC9,0xA6,0x87,0x13,0x0F,0x05,0xD6,0x3A,0x1E,0x9B,0x87,0xFE,0xF7,0xFA,
+0xC0,0x0E,0x0B,0xC0,0x0E,0x51,0x0B,0xC3,0x33,0x80,0x89,0x05,0xCB,0xAB,0x86,0x3C,0x05,0xD7,0xB8,0x73,0x32,0x24,0x32,0x05,0xE2,0x22,0x05,0x03,0x24,0x05,0xC5,0xBC,
+0x75,0x3D,0x12,0xC1,0x0B,0xC1,0x0C,0x30,0x3A,0x9A,0x89,0xCE,0x26,0x05,0xE1,0xA5,0x87,0x22,0x05,0xC0,0xA9,0xC9,0x27,0x8A,0x9D,0x17,0x05,0xE0,0x3A,0x06,0x05,0xC0,
+0xB3,0x33,0x98,0x99,0x28,0xC0,0x7F,0x9C,0x99,0x37,0x06,0xAD,0x65,0xAD,0x53,0xA7,0x97,0x39,0xFE,0x7C,0x2B,0x29,0x3A,0x05,0xEA,0xB5,0x84,0x54,0xFE,0x76,0x86,0x20,
+0x05,0xE2,0x13,0x99,0x78,0x99,0x8B,0x62,0x0C,0xFE,0x76,0x67,0x18,0xC1,0x1A,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xFE,0x1B,0x41,0x0F,0x05,0xE7,0x3F,0xB4,0x83,0xFE,
+0x65,0xA7,0x18,0xC0,0x8F,0xAD,0xFE,0x01,0x00,0x05,0xC4,0x6E,0x2B,0x19,0x0F,0x05,0xDD,0xB7,0x72,0x05,0xC4,0x3F,0xA9,0xA6,0x05,0xC1,0xAF,0x54,0xFE,0x6E,0x26,0x18,
+0xC0,0x1A,0x18,0xC2,0x06,0xFE,0x43,0xE6,0x9E,0xCD,0xFE,0x6E,0x27,0x18,0x99,0x9C,0xFE,0x0A,0x00,0x05,0xC1,0x2B,0xA6,0x45,0xAC,0x54,0xC0,0x98,0xAB,0xC1,0x13,0x28,
+0x05,0xC0,0x37,0x06,0x13,0xA5,0x66,0x13,0xA4,0x9A,0xC0,0x06,0x37,0x9C,0x99,0x24,0x0D,0x18,0xC1,0x1A,0x18,0xC2,0xFE,0x4C,0x07,0x9D,0xEE,0xFE,0x6D,0x69,0x18,0xC0,
+0x8B,0xBF,0x19,0x37,0xB0,0x43,0xAD,0x53,0xA7,0x86,0x1A,0x0D,0xFE,0x23,0x03,0xFE,0x00,0x20,0xC0,0x06,0x13,0x98,0xBC,0xA9,0xD9,0xC3,0xA7,0x87,0x9F,0x75,0x05,0xDA,
+0x06,0x19,0x3B,0xAA,0x76,0x2C,0x1A,0x2C,0x8D,0xAD,0x28,0xC0,0x37,0x06,0x2E,0x0C,0xFE,0x5D,0xA5,0x18,0xC0,0x1A,0x18,0xC3,0x8F,0xAD,0x16,0xA3,0x21,0xFE,0x76,0x87,
+0x18,0x25,0x8D,0xBE,0xB1,0x62,0x1A,0x18,0xC2,0x25,0x06,0x05,0xC0,0xAB,0x55,0x13,0xC1,0x0D,0x98,0x76,0x17,0x05,0xD8,0x0C,0x0E,0xA8,0x75,0x18,0xC1,0x1A,0x18,0x99,
+0x9C,0x88,0xAE,0x05,0xC2,0x28,0xAE,0x53,0x0E,0x06,0x18,0xC0,0x06,0x18,0xC1,0x25,0xFE,0x5B,0x8B,0xA4,0x42,0x1F,0x18,0x1A,0x0E,0x18,0xC0,0x1A,0x18,0xC0,0x1A,0x18,
+0x12,0x0F,0x05,0xC0,0x10,0x59,0x05,0xD7,0x22,0x9C,0x88,0x9D,0x9D,0xC0,0x41,0x07,0x3D,0xCC,0x2D,0x13,0xC1,0x27,0x8A,0x9D,0x05,0xD8,0xAF,0x54,0x36,0x18,0xC6,0x0A,
+0x06,0x05,0xC2,0xA5,0x88,0x12,0x0A,0x1A,0x18,0x9D,0x9A,0x18,0xC1,0x1A,0x12,0x39,0x1F,0x18,0x1A,0x25,0x6B,0x1A,0x18,0xC0,0x1A,0x18,0xC1,0xFE,0x0A,0x00,0x05,0xC1,
+0x2E,0x95,0xBB,0x05,0xD5,0x32,0xB2,0x74,0x3C,0x3D,0xC4,0x26,0xA4,0x87,0x3D,0xC2,0x9D,0xA8,0xA0,0xA8,0xA0,0xA6,0xA0,0xA9,0x9E,0xB6,0xA2,0xA7,0xA1,0xB8,0xFE,0x4A,
+0x25,0xC1,0xAB,0x75,0x17,0x05,0xD8,0xFE,0x3C,0x62,0x1F,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC1,0x12,0x05,0xC3,0x1D,0x2C,0x0A,0x1A,0x18,0xC8,0x06,0x12,0x1F,0x18,0xC4,
+0x12,0x0F,0x05,0x6E,0x32,0x10,0x05,0xD5,0xAC,0x87,0x22,0x3D,0xC4,0x41,0x69,0x3D,0x1E,0x2B,0x9E,0xB6,0x25,0xA1,0xA9,0x33,0xA1,0xA9,0xC1,0x56,0x05,0xFE,0x76,0xA7,
+0x18,0x15,0x39,0x18,0x06,0x18,0xC2,0x2C,0xFE,0x02,0x00,0xFE,0x00,0x20,0xC1,0xAB,0x55,0x59,0x05,0xD4,0x13,0x6C,0x1F,0x75,0x20,0xA0,0xA8,0x2B,0x70,0x12,0x25,0x37,
+0x7A,0x61,0xC1,0xA3,0x98,0x6E,0x05,0xFE,0x6E,0x27,0x18,0x9D,0x9A,0x18,0xC7,0x99,0x9B,0xFE,0x02,0x00,0xFE,0x00,0x20,0xC2,0x39,0xAE,0x73,0x0D,0x0E,0x06,0x24,0x18,
+0x06,0x18,0xC2,0x24,0x1A,0xFE,0x0A,0xA0,0x31,0xFE,0x65,0xA7,0x18,0x06,0x18,0xC2,0x15,0x05,0xC1,0xA5,0x87,0xA6,0x45,0x0F,0x05,0xD3,0x22,0xFE,0x61,0x43,0xA1,0xC7,
+0x37,0x33,0x3D,0x27,0x8C,0x9D,0x97,0x9C,0xD8,0x31,0x0D,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC0,0x8F,0xAD,0x0F,0x05,0xC1,0xB8,0x21,0x1A,0x18,0xC0,0x94,0x8B,
+0xA5,0x99,0x18,0xC2,0x1A,0x18,0xC1,0xFE,0x09,0x81,0x05,0xB4,0x42,0xBB,0x30,0x18,0xC1,0x1A,0x18,0x39,0xFE,0x00,0xA0,0x0F,0x05,0xC0,0xAA,0x64,0xA5,0x57,0x05,0xD3,
+0xB8,0x73,0x9C,0xF7,0x29,0xC0,0xA3,0x98,0xC0,0x3D,0x29,0x66,0x29,0xC1,0x3A,0xFE,0x6B,0x87,0x88,0x8D,0x9D,0x9A,0xD8,0xAF,0x53,0xFE,0x76,0x09,0x18,0xC2,0x1A,0x18,
+0xC4,0x9D,0x9A,0x0D,0xFE,0x23,0x03,0x05,0xC1,0xAB,0x55,0x36,0x18,0xC1,0x25,0x50,0x1A,0x18,0xC2,0x06,0x0E,0xFE,0x00,0xA0,0x62,0x05,0x1D,0x1A,0x18,0xC2,0x25,0xFE,
+0x01,0x60,0x05,0xC2,0xAF,0x33,0x05,0xD3,0x22,0x9F,0xF8,0xFE,0xA1,0x00,0xC0,0x29,0xC1,0x3D,0x24,0x29,0xC1,0x24,0x18,0xC1,0x06,0x0E,0x2C,0x18,0xC1,0x06,0x12,0xFE,
+0x00,0x40,0x05,0xC0,0xA8,0x55,0x12,0x1F,0x18,0xC0,0x06,0x18,0xFE,0x02,0x00,0x05,0xC2,0xA5,0x88,0x2E,0x05,0xD2,0x3C,0xAB,0xA4,0x33,0x29,0x7E,0x29,0xFE,0x52,0x26,
+0x13,0xC0,0xAD,0x65,0x99,0x97,0x05,0xD9,0xAB,0x55,0x2C,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x0C,0x0A,0x05,0xA2,0x77,0xBD,0x31,0x1F,0x18,0xC0,0x1A,0x18,0xC0,
+0x97,0x9A,0x0E,0x06,0x18,0x0A,0xFE,0x09,0x81,0x05,0xC2,0x06,0xBB,0x41,0x18,0xC1,0x1A,0x3E,0xFE,0x00,0x40,0x05,0xC2,0x10,0x18,0xC4,0x9D,0x9A,0x18,0xC3,0x1A,0x18,
+0x8F,0xAD,0xFE,0x01,0x00,0x05,0xC0,0xB8,0x21,0x1A,0x18,0x06,0x18,0xC3,0x92,0x9B,0x0E,0x8C,0x9D,0x05,0xC4,0x10,0xBB,0x41,0x1F,0x18,0x1A,0x15,0x0F,0x05,0xC2,0xA7,
+0x85,0xA8,0x57,0x0F,0x05,0xD1,0xB8,0x73,0x9C,0xF7,0xFE,0xB1,0x81,0x27,0x8A,0x9D,0x17,0x9D,0x9A,0xD8,0x37,0x0E,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC1,0x06,0x9C,
+0x8A,0xFE,0x02,0x00,0x0A,0x05,0xB4,0x42,0x0D,0x18,0x06,0x18,0xC3,0x1A,0x98,0x88,0x15,0x28,0x9B,0xBB,0x05,0xC2,0x6E,0xAE,0x33,0x1C,0x06,0xA4,0x77,0x15,0x0F,0x05,
+0xC3,0xAB,0x55,0xC0,0x05,0xC0,0xAF,0x33,0xB7,0x52,0x15,0x0F,0x05,0xC4,0xAA,0x66,0x4C,0x05,0xD1,0xAB,0x86,0xB2,0x74,0x93,0x9B,0x05,0xDB,0x08,0xFE,0x6E,0x26,0x18,
+0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC2,0xFE,0x02,0x00,0x05,0x24,0x0D,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x25,0x8D,0xBE,0x92,0xCF,0x05,0xC2,0xAB,0x55,0x08,0x19,
+0x05,0xC4,0xA5,0x87,0xAA,0x55,0x19,0x05,0xD1,0xB5,0x84,0x9F,0xF7,0x33,0x2E,0x13,0xC1,0x27,0x87,0xAF,0x05,0xDB,0x10,0x0E,0xA8,0x75,0xA4,0x77,0x18,0xC1,0x06,0x18,
+0xC3,0x1A,0x18,0xC1,0x8F,0xAD,0x0F,0x2A,0x0D,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC3,0x12,0xFE,0x0A,0x00,0x19,0x05,0x0A,0x1D,0x59,0x36,0xA2,0x76,0x05,0xDC,0x2B,
+0x12,0xB1,0x75,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC1,0x0E,0x19,0x2E,0xFE,0x65,0xA7,0x18,0xC0,0x06,0x18,0xC3,0x1A,0x18,0xC4,0x06,0x18,0xC0,0x25,0x8D,0xAE,0x28,
+0x05,0x1D,0x13,0xA8,0x74,0x39,0x8C,0x9D,0x05,0xDC,0xB7,0x10,0x06,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x25,0xFE,0x09,0x81,0x19,0x18,0xC5,0x9D,0x9A,0x18,0xC3,
+0x1A,0x18,0xC4,0x0D,0x15,0x0F,0xB9,0x93,0x98,0x88,0x05,0xDD,0xAF,0x33,0x0D,0x18,0xC0,0x1A,0x18,0xC6,0x06,0x18,0xC1,0xFE,0x0A,0xA0,0x32,0x1A,0x18,0xC0,0x06,0x18,
+0xC3,0x1A,0x18,0xC5,0x06,0x18,0xC1,0x25,0xFE,0x01,0x60,0x05,0x0A,0x0F,0x2A,0x9C,0x79,0x05,0xA5,0x88,0x2E,0xC0,0xA0,0x65,0x06,0x99,0xBB,0xA4,0x77,0x24,0xC0,0x0F,
+0x05,0xCD,0xB0,0x95,0xA9,0x94,0xA1,0x8A,0x91,0x7A,0x05,0xDD,0x37,0xFE,0x54,0xE7,0x18,0xC0,0x1A,0x18,0xC7,0x9D,0x9A,0x18,0xC0,0x8A,0x9E,0xA1,0xBC,0x1F,0x18,0x1A,
+0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC6,0x25,0xFE,0x09,0x81,0x05,0xC1,0x37,0x08,0x24,0x06,0x2E,0x24,0x06,0xC0,0x55,0x73,0x19,0x10,0x24,0x19,0x05,0xCC,0x20,0x0F,
+0x13,0x1A,0x18,0xC4,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0x8F,0xAD,0xA3,0x8A,0x1F,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC6,0x97,0x9A,0x28,0x9B,0xBB,0x05,0xC0,0x32,0x31,
+0x19,0x05,0xC2,0x2B,0x19,0x37,0xA3,0x77,0x2E,0x2B,0x31,0x19,0x05,0xCB,0xA9,0x97,0xB0,0x92,0xA2,0x67,0x17,0x05,0xDE,0x31,0x36,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,
+0x18,0xC2,0x0E,0xC0,0x18,0xC0,0x1A,0x18,0xC8,0x06,0x18,0xC3,0x1A,0x18,0x12,0xFE,0x00,0x60,0x05,0xC1,0xAA,0x66,0x19,0x0F,0x05,0x32,0x10,0x37,0x39,0x18,0x06,0x18,
+0xC3,0x1A,0x18,0xC7,0x06,0x18,0xC1,0xFE,0x23,0x41,0x0F,0x05,0xC0,0xAA,0x66,0x37,0x19,0x05,0xC1,0x19,0x32,0x10,0x37,0xA3,0x77,0x2E,0x24,0x48,0x9C,0xCC,0x28,0x0F,
+0x05,0xC2,0x6E,0x05,0xC5,0xB3,0x84,0xA6,0xC6,0x0E,0x1F,0x18,0x1A,0x18,0xC2,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC4,0x99,0x9C,0xFE,0x09,0x81,0x05,0xC0,0x2B,0x10,0x0A,
+0x05,0xC8,0x37,0x0C,0x24,0x37,0x05,0xCB,0xBB,0x83,0x9A,0xF8,0x05,0xC0,0x10,0x28,0x05,0xC3,0x37,0x24,0xC1,0x58,0x24,0x06,0x24,0x0C,0x28,0x0F,0x05,0xC2,0x0A,0x05,
+0xC4,0x20,0xB0,0x84,0x33,0x76,0xA3,0x88,0xC0,0x66,0x3D,0x0A,0xC0,0x9C,0x89,0xC1,0x3D,0x9D,0x99,0x3D,0xFE,0x00,0x20,0x37,0x06,0x05,0xCA,0x32,0x2E,0x3E,0x28,0x0F,
+0x05,0xC2,0x6E,0x05,0xC4,0xB5,0x84,0x1C,0xFE,0xB1,0x81,0xC0,0x3D,0xA2,0x87,0x05,0x0A,0x05,0xC0,0x3D,0x29,0xC0,0x05,0xC0,0x3A,0xFE,0x10,0xC1,0x0C,0x19,0x9C,0xAA,
+0x6E,0x05,0x0A,0x05,0xC4,0x19,0x37,0x0F,0x05,0xAF,0x33,0x2E,0x0F,0x05,0xC8,0x3C,0xB0,0x73,0xFE,0x99,0x61,0xA2,0xA7,0xC1,0x66,0x3D,0x0A,0xC0,0x05,0xC2,0x3D,0x0A,
+0x05,0xFE,0x0A,0xA0,0x3E,0x2C,0x0C,0x08,0x2E,0x24,0x06,0x28,0x7F,0x15,0x06,0x24,0x06,0x2E,0x0C,0x37,0x19,0x37,0x06,0x96,0xCC,0x66,0xC7,0xB8,0x73,0x1C,0x29,0xA3,
+0x98,0x6E,0xC1,0x05,0x3D,0x0A,0xC1,0x05,0xC1,0x0A,0xC0,0x1D,0xC0,0xAA,0x74,0x8D,0x7B,0x99,0x9C,0xE1,0x2B,0xB9,0x10,0x1F,0x18,0xC0,0x1A,0x18,0xC8,0x12,0x1F,0x9D,
+0x99,0x18,0xC0,0x99,0x9C,0x9E,0x86,0xC0,0x0E,0x44,0x39,0x12,0xC0,0xA3,0x87,0xC0,0x0E,0x35,0x92,0xAD,0x91,0xDF,0x73,0x28,0x05,0xA2,0x77,0xC0,0x05,0xC1,0x19,0x37,
+0xA7,0x66,0x58,0xA5,0x66,0x13,0x05,0xAD,0x87,0x42,0xA4,0x87,0xA6,0x78,0xA3,0x88,0xA3,0x89,0x7A,0x6E,0xF9,0x96,0x99,0x19,0x01,0xE0,0x00,0x98,0xA9,0x26,0xA5,0x78,
+0x7E,0xC0,0x07,0x26,0x3C,0x01,0xC0,0xA1,0xA6,0x6C,0x9C,0x9A,0x41,0x9D,0x97,0x9B,0x9A,0x9A,0x89,0x51,0x9C,0x8A,0x9D,0x9A,0xD6,0x31,0xA4,0x89,0xA8,0x84,0xA4,0x78,
+0xA4,0x96,0xA2,0x78,0xA2,0x78,0x9D,0x8C,0x38,0x1E,0x9B,0x87,0x97,0x9C,0x99,0x99,0x05,0xF0,0xA7,0x85,0x14,0x16,0x35,0x3E,0xC0,0x01,0xCD,0x93,0xA9,0x9C,0x88,0x10,
+0x3C,0x19,0x26,0x3D,0xA5,0x67,0x19,0x3D,0x1F,0x1D,0xC0,0x1F,0x07,0x18,0x1D,0xC0,0xA7,0xA5,0x18,0x1D,0xC0,0x5A,0x39,0x16,0x99,0x8B,0x1D,0x1A,0x05,0x20,0x35,0x20,
+0x1D,0x05,0xC0,0xAE,0x85,0xAD,0x85,0x39,0x05,0xC1,0xAB,0x86,0x24,0x05,0xC2,0xA7,0x87,0x01,0x3A,0x17,0x05,0xD2,0xA9,0x97,0xFE,0xAD,0x8E,0xC0,0x8C,0x7B,0x8F,0xAC,
+0x05,0xF3,0x16,0x24,0x98,0x8A,0x1D,0xC0,0xAB,0x85,0x8B,0xBA,0x17,0x05,0xD2,0x17,0xFE,0xA5,0x72,0xB4,0x85,0x9D,0x99,0x91,0x9A,0x89,0x88,0x8F,0x9B,0x05,0xC4,0xB0,
+0x95,0x44,0x17,0x05,0xE9,0x3C,0x24,0x39,0x1A,0x04,0x17,0x05,0xD4,0xB3,0x85,0xFE,0xE7,0x76,0xA4,0x8A,0xC2,0x61,0x15,0x8B,0x9A,0x8C,0x98,0x8F,0x9E,0x05,0xC1,0xBB,
+0x84,0x15,0x0B,0x98,0x87,0x8A,0x89,0x31,0x05,0x20,0xFE,0xCE,0xB3,0x04,0x0B,0xC3,0x3A,0x91,0x98,0x8B,0x79,0x8C,0x9B,0x05,0xC0,0xA9,0x85,0x3D,0x04,0x0B,0x2B,0x3D,
+0x13,0x08,0x5A,0xE5,0xA9,0x85,0x35,0xFE,0xFF,0xFA,0x0B,0xC0,0x34,0x8A,0x89,0x31,0x99,0x9C,0xC0,0x0F,0xBE,0x9A,0x0B,0x3A,0x04,0x0E,0x0B,0xC1,0x15,0x1F,0x31,0x05,
+0x3F,0xFE,0x9D,0x2D,0x04,0xC0,0x0B,0xFE,0x5B,0x6C,0x07,0x8A,0x9C,0x05,0xD6,0x21,0x04,0x0E,0xC3,0x0B,0xC0,0x0E,0x0B,0x15,0x8B,0x9A,0x86,0x89,0x05,0x36,0x15,0x9E,
+0x9B,0xC0,0x0B,0xC0,0x0E,0x3D,0x13,0x05,0x0E,0xC1,0x0B,0xC1,0x15,0x88,0x9A,0x87,0x8A,0x31,0x22,0xC0,0x2B,0xA3,0x8A,0x0B,0xC1,0x96,0x86,0x84,0x8A,0x8C,0x9B,0x9C,
+0x8A,0xE3,0x3F,0xB4,0x84,0x9C,0x76,0x1D,0xC0,0x1A,0x26,0x69,0xFE,0xB5,0xB2,0x99,0x87,0x24,0x31,0x2B,0x0F,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x34,0x87,0x89,0x05,0xC0,
+0xAF,0x84,0x39,0x20,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x0E,0x0B,0xC0,0x04,0x15,0x8C,0x9D,0x11,0xC0,0x21,0x1E,0xAF,0x86,0x04,0x0B,0xC5,0x20,0xA1,0x9A,0x6F,0x0B,0x0E,
+0x92,0x76,0x04,0x0B,0x0E,0xC1,0x0B,0x9A,0x99,0x88,0x77,0x94,0x87,0x05,0xD9,0x16,0x31,0x0B,0x9D,0x98,0x0C,0x55,0x0C,0x19,0x0B,0xC0,0x0E,0x0B,0xC2,0x0E,0xC0,0x0B,
+0x34,0x0B,0xC4,0x31,0x0B,0x0E,0x0B,0x0E,0xC0,0x22,0x3A,0x05,0xE1,0x3F,0xB7,0x82,0x29,0x04,0x2B,0x1F,0x12,0x0B,0xC0,0x0E,0xC3,0x0B,0x19,0x9C,0x75,0x0B,0xC0,0x04,
+0x0F,0x05,0xC0,0xA7,0x78,0xFE,0x1A,0xC1,0xB3,0xBD,0xB1,0xDC,0x1F,0x0B,0xC4,0x0E,0x0B,0x31,0xAC,0x9A,0x0B,0xC0,0x88,0x9B,0xFE,0x10,0xC1,0x0A,0x05,0xAB,0x44,0xAE,
+0x31,0xAD,0xDD,0xB7,0xDE,0x94,0x75,0x0A,0x6E,0x05,0xDB,0x1F,0x1B,0xA1,0x9A,0xC0,0x9B,0x87,0x1F,0x12,0x4A,0x3E,0x0C,0xA5,0xDB,0xB8,0xFE,0x3D,0x8B,0x99,0xBD,0x88,
+0x6D,0x3A,0x0B,0xC0,0x0E,0x9A,0x89,0xC0,0x0E,0x3D,0x30,0xC0,0x12,0x4A,0x3E,0x12,0x1D,0x3D,0x1B,0x11,0x21,0x87,0x9B,0x1B,0x13,0x1E,0x8B,0x9B,0x05,0xDC,0x35,0xBE,
+0x99,0x9B,0x9B,0x11,0x9C,0x99,0xC3,0x11,0xA2,0x97,0xA5,0x78,0x0C,0xA6,0x86,0xA2,0x78,0x0E,0x0B,0xC1,0x19,0x9C,0x75,0x04,0x0E,0x8F,0x9B,0x97,0x75,0x33,0x11,0xC0,
+0x33,0x30,0x21,0x0B,0xC0,0xFE,0x52,0x26,0x39,0x05,0xDD,0x24,0x15,0x0B,0xC4,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0x3A,0x0B,0x15,0x34,0x0B,0xC1,0x0E,0xC1,
+0x9C,0x79,0x2B,0xA3,0x8A,0x0B,0xC0,0x0E,0x39,0x17,0x05,0xDC,0x39,0xFE,0xE7,0x38,0x3A,0x0B,0xC3,0x0E,0x0B,0xC0,0x0E,0x0B,0xC5,0x2B,0x95,0x87,0x0B,0x34,0x0B,0xC0,
+0x0E,0x0B,0xC0,0x0E,0x0B,0xC6,0x0E,0x0B,0x0E,0xC0,0x31,0x0B,0xC0,0x0E,0x0B,0x0E,0xC3,0x0B,0x3A,0x0E,0x0B,0x93,0x89,0x0F,0x05,0xB5,0x84,0x92,0x89,0x05,0xDE,0xB8,
+0x73,0xC0,0x05,0x0E,0x92,0x76,0x2B,0x12,0x69,0xC7,0x95,0x8B,0x17,0x05,0xC2,0x36,0x8D,0x8C,0x05,0xDC,0xB3,0x84,0xA8,0x84,0x94,0x6E,0x9D,0xBB,0x26,0x69,0x26,0xC0,
+0xFE,0xBE,0x54,0x3A,0xA2,0x78,0x0E,0x0B,0xC4,0x0E,0xC0,0x0B,0xFE,0x6B,0xAB,0x84,0x9B,0xC3,0x36,0x8F,0x9B,0x05,0xDC,0xB8,0x73,0x39,0x1A,0xC0,0x7A,0x1A,0x1D,0x9D,
+0xA9,0x9B,0xD9,0x6B,0x24,0x1F,0x05,0xDF,0xB7,0x74,0x0B,0xC1,0x0E,0x0B,0x0E,0xC0,0x2B,0xFE,0x42,0xA9,0x05,0xC4,0x13,0x97,0x78,0x17,0x05,0xDA,0xAE,0x85,0x27,0x93,
+0x9D,0x0E,0x05,0xE0,0xA5,0x87,0x0F,0x93,0x59,0xAC,0xAB,0x2A,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x37,0xFE,0x31,0xA5,0x05,0xC0,0x2B,0x29,0x30,0x33,0x30,0x95,
+0x87,0x2A,0x0B,0xC0,0x0E,0x9D,0x88,0x81,0x8B,0x84,0x9B,0xC7,0x22,0x96,0x89,0x97,0x9C,0xD9,0xAF,0x84,0x24,0x95,0x8B,0x3D,0x41,0xC0,0x3D,0x26,0xC0,0x69,0xC0,0x7D,
+0x0B,0xC0,0x61,0x0B,0xC0,0x0E,0x0B,0x93,0x89,0xFE,0x21,0x24,0x0A,0x29,0x11,0x0C,0x3A,0xA2,0x78,0xC3,0x0E,0x0B,0x3A,0x80,0x8C,0x05,0xC8,0x36,0x31,0x05,0xD8,0x3F,
+0x35,0x32,0x3D,0xC4,0x0B,0x9A,0x99,0x13,0x29,0x21,0x3A,0x0B,0xC6,0x04,0x30,0x33,0x2B,0x0B,0xC1,0x04,0x9C,0x87,0x97,0x8B,0xA2,0x8A,0x12,0x69,0x12,0xC0,0x0B,0xC0,
+0x21,0x33,0xC0,0x11,0xAB,0x98,0x12,0x0B,0xC0,0x93,0x89,0xFE,0x42,0x28,0x91,0x99,0x05,0xC9,0xA6,0x87,0x13,0x0A,0x05,0xD6,0x3A,0x1E,0x22,0x0E,0x5A,0xC0,0x0E,0x51,
+0x0B,0x0E,0x0B,0xC1,0x33,0x80,0x89,0x05,0xCB,0x20,0x3C,0x05,0xD7,0x07,0x32,0xFE,0x31,0xA6,0x04,0x0B,0xC4,0x0E,0x2D,0x86,0x88,0x05,0xCD,0xAF,0x84,0x3F,0x14,0x05,
+0xD5,0x22,0x0F,0x3D,0xC0,0x12,0x0B,0x12,0x0B,0xC1,0x0C,0x30,0x86,0x8A,0x05,0xCE,0x20,0x08,0x05,0xD5,0x20,0x24,0x94,0x8D,0x3D,0xC0,0x99,0x87,0xB9,0x82,0x31,0x17,
+0x05,0xE0,0x3A,0x13,0x05,0xC0,0xB3,0x33,0x98,0x99,0x9C,0x99,0xC0,0x7F,0x9C,0x99,0x37,0x06,0xAC,0x54,0xAE,0x53,0xA7,0x97,0x39,0xFE,0x7C,0x2B,0x29,0x3A,0x05,0xEA,
+0x22,0x6D,0x3D,0xC0,0x31,0xFE,0x5D,0xA5,0x36,0xA7,0x74,0xC0,0x8F,0xAD,0x28,0x05,0xC4,0xA2,0x77,0xA2,0x77,0xBB,0x42,0x9D,0xCC,0xFE,0x6E,0x27,0x18,0x99,0x9C,0xFE,
+0x0A,0x00,0x05,0xC1,0x2B,0xAA,0x34,0xA8,0x65,0x7F,0x24,0xB0,0x75,0x9D,0xEE,0xFE,0x6D,0x69,0x18,0xC0,0x8B,0xBF,0xFE,0x00,0xA0,0x37,0x28,0x39,0xA7,0x86,0xA6,0x86,
+0x0D,0xFE,0x23,0x03,0x12,0x16,0xA3,0x21,0x18,0xC0,0x25,0x8D,0xBE,0xB1,0x62,0x1A,0x18,0xC2,0x25,0x18,0x2B,0x07,0x3C,0x9E,0x8B,0xC4,0x26,0xA4,0x87,0x3D,0xC2,0x9D,
+0xA8,0xA0,0xA8,0xA0,0xA6,0xA0,0xA9,0x9E,0xB6,0xA2,0xA7,0xA1,0xB8,0x7B,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xC1,0x8F,0xAD,0xFE,0x00,0x20,0xC3,0xFE,0x43,0xE6,0xAE,
+0x40,0x0A,0x1A,0x18,0xC8,0x9D,0x9A,0x12,0xB1,0x75,0x18,0xC4,0x12,0x0F,0x05,0x6E,0xA4,0x88,0xA6,0x55,0x0A,0x05,0xC2,0xAA,0x66,0x36,0x25,0x50,0x1A,0x18,0xC2,0x1A,
+0x18,0xC1,0x6F,0x18,0xFE,0x23,0x41,0x39,0x18,0x06,0x18,0xC2,0x0D,0xFE,0x02,0x00,0x05,0xC1,0x3F,0xA4,0x45,0x05,0xD4,0xB0,0x95,0x49,0x9A,0x8B,0x6B,0xA6,0xB6,0x27,
+0x8C,0x9D,0x97,0x9C,0xD8,0xAF,0x54,0x0D,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC0,0x12,0x0F,0x05,0xC1,0xB8,0x21,0x1A,0x18,0xC0,0x94,0x8B,0xA5,0x99,0x18,0x24,
+0x18,0xC0,0x1A,0x18,0xC1,0xFE,0x09,0x81,0x05,0xB4,0x42,0xBB,0x30,0x18,0xC1,0x1A,0x18,0x39,0xFE,0x00,0xA0,0x0F,0x05,0xC0,0x37,0xA7,0x66,0x05,0xD3,0xB8,0x73,0x9C,
+0xF7,0xFE,0xA1,0x20,0xC0,0xA3,0x98,0xC0,0x3D,0x29,0x66,0x29,0xC2,0x13,0xAB,0x73,0x88,0x8F,0x9D,0x9A,0xD8,0xAF,0x33,0xFE,0x76,0x09,0x18,0xC2,0x1A,0x18,0xC4,0x9D,
+0x9A,0x0D,0xFE,0x23,0x03,0x05,0xC0,0x6E,0xA9,0x77,0x36,0x18,0xC1,0x25,0x50,0x1A,0x18,0xC2,0x06,0x98,0x9B,0xFE,0x00,0xA0,0x62,0x05,0xFE,0x43,0xE6,0x1A,0x18,0xC2,
+0x25,0xFE,0x01,0x60,0x05,0xC2,0x24,0x05,0xD3,0xB5,0x84,0x35,0xFE,0xA1,0x00,0xC0,0x29,0xC1,0x3D,0x24,0x29,0xC1,0x24,0xFE,0x00,0x40,0x05,0xD8,0xAF,0x33,0x0D,0x18,
+0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x39,0x19,0x05,0xC0,0xA7,0x85,0x0E,0x06,0x18,0xC1,0x06,0x0E,0x2C,0x18,0xC1,0x06,0x12,0x0A,0x05,0xC0,0xA8,0x55,0x12,0xB1,0x75,
+0x18,0xC0,0x06,0x18,0xFE,0x0A,0x00,0x0D,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x0C,0x05,0xC0,0x0F,0x12,0xFE,0x73,0x67,0x95,0x7A,0x17,0x05,0xD8,0xAB,0x55,0xFE,
+0x55,0x63,0x18,0xC4,0x06,0x18,0xC3,0x1A,0x18,0x12,0xFE,0x01,0x00,0x05,0xC0,0x32,0x1A,0x18,0x06,0x18,0xC3,0x92,0x9B,0x0E,0x8C,0x9D,0x05,0xC4,0xAF,0x33,0xB7,0x63,
+0x1F,0x18,0x1A,0x87,0xBF,0x0F,0x05,0xC2,0x31,0xA8,0x57,0x0F,0x05,0xD1,0xB8,0x73,0x35,0xFE,0xB1,0x81,0x29,0xC0,0x05,0x18,0x0A,0x15,0x28,0x9B,0xBB,0x62,0xC2,0x6E,
+0x24,0x1C,0x06,0xA4,0x77,0x15,0x05,0x14,0x22,0x3A,0x05,0xDB,0xB5,0x20,0x06,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC2,0xFE,0x09,0x81,0x05,0xAF,0x33,0x0D,0x18,0xC2,
+0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC0,0x25,0x15,0x92,0xCF,0x05,0xC2,0x10,0x08,0x19,0x05,0xC4,0xA5,0x87,0x31,0x19,0x05,0xD0,0x17,0xAD,0xA7,0x22,0x8A,0x7C,0x36,0xA2,
+0x76,0x89,0xBF,0xB7,0x84,0x39,0x17,0x10,0xFE,0x6E,0x27,0x18,0xC0,0x1A,0x18,0xC6,0x9D,0x9A,0x18,0xC1,0x2C,0x32,0x1A,0x18,0xC0,0x06,0x18,0xC3,0x1A,0x18,0xC5,0x06,
+0x18,0xC1,0x25,0xFE,0x01,0x60,0x05,0x0A,0x0F,0xAD,0x64,0x9C,0x79,0x05,0xA8,0x55,0xA7,0x77,0xC0,0x24,0x06,0x19,0xC0,0x24,0xC0,0x0F,0x05,0xCD,0x13,0xA9,0x94,0xFE,
+0x99,0x61,0x7A,0x75,0x2B,0x15,0x1A,0x18,0xC4,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0x12,0xA3,0x8A,0xAE,0x73,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC6,0x97,0x9A,0x28,0x9B,
+0xBB,0x05,0xC0,0xA5,0x88,0xAA,0x54,0x19,0x05,0xC2,0x2B,0x19,0xA4,0x77,0xA3,0x77,0xC0,0x2B,0x2A,0x0C,0xFE,0x65,0xA7,0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC2,
+0x0A,0x14,0x19,0x32,0x10,0x37,0xC0,0x2E,0x24,0x48,0x05,0xC5,0xAA,0x64,0x2C,0xB8,0x62,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC2,0x12,0x1F,0x18,0xC4,0x06,0x18,0xC3,
+0x1A,0x18,0xC4,0x12,0x05,0xC8,0x37,0x2E,0x3E,0x28,0x0F,0x05,0xC2,0x6E,0x05,0xC4,0xB5,0x84,0x35,0x05,0xC5,0x19,0x37,0x0F,0x05,0x24,0x2E,0x0F,0x05,0xC8,0x3C,0x22,
+0xFE,0x99,0x61,0x05,0xE1,0xAB,0x55,0xFE,0x55,0x63,0x18,0x06,0x18,0xC3,0x1A,0x18,0xC4,0x0A,0x06,0xA4,0x77,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0x2C,0x0A,0xC0,0x9B,
+0x9A,0x94,0x9D,0x0C,0xC0,0xA1,0x54,0x3E,0x2C,0x0C,0xA2,0x75,0x2E,0x59,0x9C,0x99,0x28,0x32,0xA5,0x77,0x06,0x24,0x06,0x2E,0x0C,0x95,0xBB,0x19,0x37,0x06,0x96,0xCC,
+0x05,0xC7,0xB8,0x73,0xA1,0xD7,0x3D,0xFE,0x19,0x00,0x0C,0x06,0x37,0x10,0x2E,0x19,0x05,0xC6,0xA9,0x97,0xB2,0x73,0xFE,0x99,0x61,0xA1,0xB8,0xB2,0x67,0xA9,0x88,0x9A,
+0x88,0xA7,0x88,0x9C,0x88,0x01,0x3C,0x01,0x3C,0x01,0x93,0xA9,0x62,0x41,0x07,0x27,0x19,0x7F,0xA2,0x78,0x01,0xFD,0xCB,0x94,0x89,0x3D,0x00,0xC0,0x19,0x01,0xFD,0xC6,
+0x19,0x27,0x01,0xE4,0x00,0x3D,0x26,0x10,0xA2,0x77,0xC0,0x7A,0x3D,0x26,0x07,0x00,0x19,0x39,0x3C,0x01,0xF9,0x27,0x19,0x01,0xE0,0x00,0x3D,0x26,0x10,0x7E,0xC0,0x1D,
+0xC1,0x01,0xC0,0x19,0x00,0x18,0x26,0x3D,0x1D,0x00,0xC0,0x39,0x01,0xF4,0x3C,0x07,0x3C,0x01,0xDE,0x00,0x3D,0x26,0x07,0x27,0x1A,0xC0,0x1D,0xC2,0x01,0xC4,0x19,0x00,
+0x27,0x07,0x26,0xC0,0x3D,0x00,0x19,0x01,0xC0,0x3C,0xC0,0x01,0xED,0x27,0x3C,0x01,0xDC,0x19,0x3D,0x40,0x1A,0x27,0x1D,0xC6,0x01,0xC9,0x28,0x19,0x00,0x18,0x07,0x26,
+0x3D,0x1D,0x27,0x19,0x28,0xC0,0x39,0x01,0xE7,0x00,0xC0,0x3C,0x01,0x3C,0xC0,0x01,0xD8,0x18,0x1F,0x07,0x27,0x1D,0x07,0x1D,0xC6,0x3D,0x26,0x3D,0x1D,0x00,0x19,0x01,
+0x3C,0x01,0xCC,0x3C,0x01,0xD3,0x27,0x19,0x01,0xDA,0x18,0x99,0x99,0x3D,0x1D,0x1A,0xC0,0x01,0xC0,0x28,0x19,0x27,0x3D,0x07,0x26,0x07,0x18,0x00,0xC0,0x01,0xA1,0xA7,
+0x69,0xC6,0x6C,0x6B,0x35,0xC1,0x63,0x35,0xC1,0x47,0x9F,0x9B,0xC4,0x67,0x01,0xC3,0x27,0x01,0xD8,0x3C,0x00,0x3D,0x26,0x1D,0x18,0x1D,0xC1,0x39,0x01,0xC3,0x3E,0x9F,
+0x96,0x9D,0x8A,0x54,0x69,0x9E,0x9B,0x51,0xA3,0x85,0x53,0xC0,0x9B,0x9A,0x68,0x9F,0x9C,0xC0,0x9D,0x89,0x50,0x51,0x05,0xC0,0x31,0x05,0x20,0xA5,0x87,0xA4,0x86,0xC0,
+0x26,0x0F,0x24,0x35,0xA2,0x76,0x35,0x6B,0x9E,0x7B,0xC2,0x67,0x01,0x27,0x01,0xD8,0x07,0x1F,0x07,0x18,0x1D,0xC3,0x3C,0xC0,0x01,0x3E,0xC0,0x65,0x51,0x41,0x20,0x2C,
+0x05,0x31,0x9C,0x8A,0x9D,0x9A,0x6E,0x05,0xD4,0xA6,0x87,0x2C,0x3C,0x01,0xA1,0x85,0x3E,0x07,0x06,0x99,0x99,0x17,0x9D,0x9A,0xE9,0xA5,0x88,0xAA,0x84,0x39,0x35,0x38,
+0x31,0x9F,0x9B,0x01,0x24,0x20,0x97,0x9C,0x05,0x3A,0x01,0xC9,0x8F,0xAA,0x3D,0x9B,0x85,0x05,0xF9,0xAF,0x84,0x0F,0x24,0xA1,0x6A,0x01,0xC2,0x3C,0x01,0xC0,0x19,0x26,
+0xA4,0x87,0x18,0x1D,0xAC,0x94,0x01,0xC2,0x19,0x26,0x3D,0x1D,0xC1,0x1E,0x89,0x8C,0x05,0xFD,0xC0,0x20,0x24,0x38,0x9C,0x8E,0x67,0x19,0x1F,0xC0,0xAD,0x85,0x05,0xFD,
+0xC2,0x32,0x22,0x38,0x9C,0xAC,0x1F,0x3D,0x1D,0x1A,0x3C,0x22,0x05,0xFD,0xC5,0xA7,0x87,0x39,0xA4,0x96,0x98,0x8D,0x22,0xAA,0x74,0x3C,0x01,0x2C,0x05,0xFD,0xC8,0xAF,
+0x84,0x24,0x9D,0x8A,0x24,0x1D,0xC0,0x9D,0xA9,0x0F,0xC0,0x9B,0x69,0x1D,0x3C,0x01,0x3A,0x05,0xD3,0xA9,0x97,0xFE,0xAD,0x8E,0xC0,0x8C,0x7B,0x8E,0x9B,0x01,0x31,0x8B,
+0xBA,0x17,0x05,0xD2,0x17,0x3D,0xB3,0x8A,0x9D,0x99,0x91,0x9A,0x36,0x8F,0x9B,0x05,0xC4,0x06,0x3A,0x17,0x05,0xE9,0xAE,0x85,0x24,0x39,0x1D,0xA9,0x99,0x3E,0x89,0x9B,
+0x05,0xD4,0xFE,0x7C,0x2B,0x04,0xA0,0x8A,0x69,0x9A,0x99,0x8D,0x87,0x8C,0x98,0x17,0x05,0xC1,0x6E,0x16,0x24,0x1F,0x06,0x05,0xE9,0x06,0x24,0x1D,0x0B,0xC1,0x04,0x93,
+0x8A,0x8C,0x87,0x8C,0x9A,0x97,0x9C,0xC2,0xAE,0x85,0xBF,0x96,0xA9,0x78,0x8E,0x88,0x3A,0x17,0x05,0xE7,0xB3,0x84,0x35,0x06,0x1D,0x1A,0xA9,0xA9,0x9C,0x91,0x05,0xD5,
+0x29,0xFE,0xE7,0x76,0xA4,0x8A,0xC3,0x19,0x0F,0x8C,0x98,0x05,0xC2,0x32,0x15,0x04,0x96,0x87,0xFE,0x31,0xA5,0x19,0x04,0x0B,0x04,0x0B,0xC1,0x61,0x91,0x98,0x8B,0x79,
+0x8C,0x9B,0x05,0xC0,0xA9,0x85,0x3D,0x04,0x7B,0x9D,0x88,0x3D,0x85,0xAD,0x90,0x8B,0x5A,0xE5,0xA9,0x85,0x27,0x39,0x1D,0xC7,0x16,0xFE,0xBE,0x54,0xAD,0x98,0xC6,0x34,
+0x8A,0x89,0x31,0x9A,0x8B,0x66,0x0F,0xBE,0x9A,0x04,0x3A,0x04,0x19,0x35,0x31,0x17,0x05,0xE4,0xAE,0x85,0x24,0x99,0x89,0x1D,0xC5,0x1A,0x01,0x89,0xB8,0x05,0xD5,0xA5,
+0x87,0x21,0x0B,0xC3,0x0E,0x0B,0xC1,0x15,0x86,0x8A,0x31,0x0A,0x3F,0xFE,0x9D,0x2D,0x04,0xC0,0x0B,0x0E,0x15,0x8B,0x9A,0x86,0x89,0x05,0xE5,0x20,0x35,0x06,0x0B,0x0E,
+0xC3,0x0B,0x0E,0xC0,0x0B,0x15,0x0F,0x12,0x0A,0x07,0x0B,0x0E,0x0B,0x0E,0x0B,0x15,0x88,0x9A,0x87,0x8A,0x31,0x22,0xC0,0xAE,0x78,0xA3,0x8A,0x0B,0xC1,0x19,0x84,0x8A,
+0x8C,0x9B,0x9C,0x8A,0x0A,0x05,0xE1,0x3F,0x24,0x9C,0x77,0x18,0xFE,0xBE,0x54,0x99,0x9A,0x9C,0x99,0xC0,0x11,0xC0,0x9B,0x96,0x24,0x31,0xB4,0x86,0x0F,0xB9,0x89,0x0E,
+0x0B,0xC2,0x34,0x35,0x1F,0x05,0xE2,0x0A,0x3C,0x24,0x06,0xAA,0x7B,0x01,0xC6,0x1E,0x31,0x17,0x05,0xD6,0xBD,0x73,0x3A,0x0B,0xC0,0x0C,0x33,0x8A,0x8A,0x91,0x99,0x05,
+0xC4,0x06,0xA8,0x87,0x93,0x9B,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x0E,0x0B,0x0E,0x0B,0xFE,0x5B,0x6C,0x5A,0x3C,0x01,0x3C,0xC2,0x01,0xC3,0x3C,0x01,0xC3,0x39,0x07,0x0A,
+0x05,0xD7,0x0F,0x39,0x01,0x3C,0x01,0xC2,0x3C,0x01,0xC2,0x69,0x99,0xA5,0x05,0xD8,0xB3,0x84,0x11,0x25,0x14,0xA7,0x88,0xB1,0x76,0x33,0xA7,0x98,0xA8,0x77,0xA3,0x98,
+0xA4,0x87,0x0B,0xC3,0x96,0x86,0x8C,0x8A,0xBB,0x98,0x0B,0xC1,0x3A,0x0B,0xC2,0x2B,0x1F,0x8B,0x99,0x05,0xE2,0xAE,0x85,0x24,0x95,0xAE,0x25,0xC7,0x9C,0x88,0x15,0xA2,
+0x78,0x69,0x3D,0x1D,0xA3,0x99,0xC0,0xA3,0x88,0x28,0x39,0x7A,0xC0,0x01,0x69,0x94,0xA6,0x05,0xD8,0x06,0x20,0xAC,0x9B,0xB1,0x77,0xA7,0xA9,0xA4,0x87,0xA2,0x78,0xC3,
+0x0E,0xC0,0x0B,0xC1,0x3A,0x8C,0x76,0x34,0x0B,0xC3,0x0E,0xC1,0x8E,0x89,0x83,0x88,0xA8,0x76,0x92,0x9B,0x17,0x9D,0x9A,0xE1,0x07,0x0F,0x18,0x25,0xC4,0x3D,0x26,0x15,
+0xC0,0x1E,0x31,0x05,0xD8,0xAE,0x85,0xFE,0xBE,0x54,0xAD,0x98,0xC0,0x0E,0x0B,0x0E,0xC1,0x0B,0x61,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x34,0x9A,0x87,0x0B,0xC0,0x0E,0x0B,
+0xC2,0x37,0x3F,0x68,0x3C,0x24,0x9A,0x8A,0x17,0x05,0xD8,0xAB,0x86,0xFE,0xCE,0xB3,0x04,0x0B,0xC1,0x04,0x0E,0x0B,0x3A,0x0B,0x0E,0x0B,0xC3,0x0E,0x92,0x76,0x04,0x0B,
+0x0E,0xC0,0x0B,0xC0,0x9A,0x99,0x88,0x77,0xB1,0x89,0xA4,0x99,0x19,0x9C,0x75,0x22,0x05,0xD9,0x16,0x31,0xAE,0x8A,0x2B,0x0C,0x3D,0x0C,0xA2,0x87,0x0B,0xC5,0x0E,0xC0,
+0x0B,0x34,0x0B,0xC4,0x31,0x0B,0x0E,0x0B,0xC1,0xFE,0x3A,0x06,0x33,0xB4,0x76,0x0B,0xC2,0x0E,0x0B,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x96,0x86,0xA4,0x9B,0x3A,0x0B,0xC1,
+0x04,0x2B,0x87,0x99,0x0A,0x05,0xC1,0xA6,0x87,0x1F,0xB3,0x8B,0x3D,0xC0,0x2D,0x88,0x78,0x8C,0x77,0x9B,0xBB,0x25,0x2D,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0x0B,0x61,
+0x0B,0x0E,0x2B,0x31,0x0B,0xC2,0x0C,0x37,0x33,0x3E,0x32,0x17,0x05,0xE0,0x3F,0x35,0x92,0x49,0x05,0xA7,0x85,0x21,0xB2,0x78,0x0B,0x3A,0x0B,0xC0,0x0E,0x0B,0x0E,0xC0,
+0x0B,0x0E,0x92,0x76,0x2B,0x04,0xFE,0x31,0xA6,0xCC,0x13,0xA5,0x77,0x05,0xDA,0xA6,0x87,0xFE,0x9D,0x2D,0xB6,0x9F,0xC1,0x93,0x74,0x88,0x01,0x9E,0xAB,0x28,0x0F,0x05,
+0x3A,0xFE,0xB5,0xB2,0xB2,0x78,0x69,0xC0,0x0E,0xC3,0x0B,0x9A,0x99,0x9C,0x75,0x0E,0x0B,0x04,0x87,0x99,0x05,0xC0,0xA7,0x78,0xFE,0x1A,0xC1,0xB3,0xBD,0xB1,0xDC,0x86,
+0x83,0x1A,0x9C,0xB9,0xC0,0x3D,0x1D,0x02,0x3D,0xC3,0x26,0x3D,0xC0,0xA7,0x85,0x06,0x05,0xDA,0xA5,0x87,0xFE,0x9D,0x2D,0x31,0xC1,0x11,0x8F,0x00,0x9E,0xAB,0x28,0x05,
+0xA8,0x55,0xA7,0x54,0x9B,0xEF,0x2D,0x0B,0xC4,0x0E,0x0B,0x92,0x86,0xAB,0x9A,0x0B,0xC0,0x88,0x9B,0xFE,0x10,0xC1,0x05,0xC0,0xAB,0x44,0x12,0xAD,0xDD,0xB7,0xDE,0x94,
+0x75,0x1A,0x3D,0xC3,0xA2,0x77,0x3D,0xC0,0xAC,0x73,0x8F,0x9A,0x17,0x05,0xDA,0xFE,0x7C,0x2B,0x1B,0xA1,0x9A,0xC0,0x0B,0x12,0x4A,0x3E,0x45,0x3E,0x2C,0xFE,0x6B,0xAB,
+0x9B,0x7A,0xFE,0xE7,0x38,0xA4,0x87,0xA2,0x78,0xC3,0x9D,0x98,0x95,0x87,0x0B,0x0E,0x8E,0x89,0xFE,0x19,0x63,0x3E,0x06,0x95,0xDD,0x24,0x12,0x23,0xB6,0xDD,0x9B,0x87,
+0x82,0x84,0x17,0x05,0xDB,0x0A,0x05,0xC2,0x0F,0x3D,0xC7,0xAB,0x74,0x8B,0x9C,0x05,0x0A,0x05,0xD9,0x1F,0x1B,0x31,0xC0,0x33,0x1F,0x0C,0xC0,0x3E,0x0C,0xA5,0xDB,0xB8,
+0xFE,0x55,0x30,0xBD,0x88,0x0B,0xC3,0x19,0xC0,0x0E,0x3D,0x30,0xC0,0x12,0x4A,0x3E,0x12,0x1D,0x3D,0x1B,0x11,0x9E,0x84,0x87,0x99,0x05,0xE0,0xB4,0x72,0x0B,0xC0,0x0E,
+0x34,0x3A,0x55,0x8B,0x9C,0x1B,0x9C,0x88,0x30,0x8C,0xBB,0x7A,0xC2,0x06,0xC3,0x02,0xC0,0x66,0x02,0x3D,0x02,0x07,0x94,0x9A,0x05,0x0A,0x05,0xDA,0x35,0xA9,0xAD,0xA7,
+0x98,0xAC,0x79,0x1B,0x31,0xC0,0x9E,0x75,0xC0,0x0B,0x33,0xC0,0x2D,0x11,0xA7,0x87,0xAD,0x98,0xC0,0x0E,0x0B,0x04,0x92,0x87,0x0B,0x8E,0x99,0x37,0x1B,0xA1,0x9A,0xC0,
+0x33,0xC1,0x9D,0x97,0x11,0xAB,0x98,0xA9,0x88,0x0B,0x8D,0x96,0xFE,0x21,0x41,0x17,0x0A,0xFE,0xD6,0xD7,0x3A,0x0B,0x0E,0x0B,0xC1,0x19,0x9C,0x75,0x04,0x0E,0x37,0x97,
+0x75,0xA2,0x9C,0x11,0xC0,0x33,0x30,0x21,0x0B,0xC2,0x34,0x80,0x86,0xFE,0x59,0xE7,0x39,0x89,0xAF,0xDD,0xBB,0x82,0xBF,0x88,0x0B,0xC0,0x12,0x0B,0xC0,0x0E,0xC0,0x0B,
+0xC4,0x0E,0x0B,0x3A,0x0B,0x15,0x34,0x0B,0xC0,0x0E,0x0B,0x0E,0xC0,0x2B,0xC0,0x12,0x04,0x0E,0x0B,0xC1,0x2B,0x80,0x88,0x17,0x05,0xDF,0x24,0x26,0xFE,0x10,0xC2,0xB2,
+0x94,0x98,0x78,0x05,0xCC,0x0A,0x05,0xCE,0x1E,0xFE,0xEF,0x98,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x9A,0x99,0x34,0x0B,0xC0,0x0E,
+0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC3,0x2D,0x36,0x96,0x88,0x05,0xDE,0x0A,0xB7,0x84,0x39,0x8F,0xAE,0x20,0x22,0x05,0xDF,0x0F,0x9F,0x86,0x3F,0xA9,0xA7,0x14,0x0F,
+0x8A,0x8C,0xB6,0x92,0x39,0x34,0xA6,0x99,0x0B,0xC7,0x0E,0xC0,0x0B,0x0E,0x0B,0xC2,0x2B,0x95,0x87,0x0E,0x0B,0xC3,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0xFE,0x6B,0xAB,0x84,
+0x9B,0xC0,0x3C,0x6D,0x05,0x0B,0x0E,0x0B,0xC2,0x0E,0xC0,0x0B,0x0E,0x0B,0xFE,0x6B,0xAA,0x05,0xC1,0xA7,0x85,0x36,0x0F,0x05,0xDC,0xA9,0x85,0x24,0x20,0xA1,0x9B,0x0E,
+0x0B,0xC6,0x2D,0x17,0x9D,0x9A,0xC2,0x36,0x05,0xDD,0x22,0x24,0x94,0x6C,0x18,0x12,0x05,0xDF,0x07,0x15,0x0B,0xC3,0x0E,0x0B,0xC9,0x93,0x89,0xAB,0xA8,0xA2,0x78,0x0E,
+0x0B,0xC4,0x0E,0xC0,0x0B,0xFE,0x6B,0xAB,0x84,0x9B,0xC3,0x36,0x8F,0x9B,0x05,0xDC,0x07,0x39,0x1A,0x7A,0xC0,0x1A,0x1D,0x10,0x27,0x22,0x05,0xC4,0x13,0x31,0x17,0x05,
+0xDA,0x3C,0x27,0x18,0x05,0xE0,0xBB,0x83,0x15,0x0B,0xC9,0x0E,0x0B,0xC0,0x0E,0x19,0x33,0x8E,0x69,0x95,0xEA,0x69,0xAF,0x44,0x31,0x05,0xE0,0x24,0xB6,0x7A,0xAD,0x98,
+0x0E,0x0B,0x0E,0x0B,0x0E,0xC2,0x0B,0x3A,0x0B,0x0E,0x9D,0x88,0x33,0x3C,0x05,0xC1,0x31,0xFE,0xC6,0x97,0x0B,0x0E,0x0B,0x0E,0xC0,0x0B,0x93,0x89,0xFE,0x18,0xE2,0x05,
+0xC5,0x13,0x31,0x05,0xDA,0x16,0x27,0x92,0x9F,0x1D,0x98,0xEA,0x26,0x36,0x22,0x05,0xE0,0xA5,0x87,0xB3,0x85,0x93,0x59,0xAC,0xAB,0x2A,0xA4,0x87,0xC1,0x0E,0x0B,0xC0,
+0x0E,0x0B,0xC0,0x37,0xFE,0x31,0xA5,0x05,0xC0,0x2B,0x0F,0x30,0x33,0x9E,0x74,0x91,0x9A,0x2A,0x0B,0xC1,0x9D,0x98,0x81,0x8B,0x84,0x9B,0xC7,0x22,0x96,0x89,0x97,0x9C,
+0xD9,0x3C,0x24,0x95,0x8B,0x3D,0x41,0xA4,0x87,0x3D,0x26,0xC0,0x69,0xC1,0x2D,0x1E,0x20,0x05,0xE0,0xA5,0x88,0x24,0x94,0x39,0x05,0xBC,0x87,0x0B,0xC1,0x61,0x0B,0xC0,
+0x0E,0x0B,0x93,0x89,0xFE,0x29,0x43,0x05,0x25,0x11,0x0C,0xA8,0x76,0xC4,0x0E,0x13,0xAB,0x75,0x89,0x9D,0x05,0xE0,0x3F,0x39,0x98,0x37,0x05,0xC0,0x30,0x2B,0x0B,0x0E,
+0x0B,0x0E,0x0B,0x9A,0x99,0xFE,0x4A,0x25,0x25,0x21,0x3A,0x0B,0xC3,0x69,0x0B,0xC0,0x0E,0xFE,0x22,0x84,0x8F,0xDD,0x05,0xC0,0xBC,0x87,0x2A,0x0B,0xC1,0x04,0x30,0x33,
+0x2B,0x0B,0xC0,0x0E,0x0B,0x15,0x97,0x8B,0xA3,0x96,0xAA,0x8A,0xC1,0x98,0x9A,0x83,0x79,0x05,0xCA,0x22,0x05,0xD8,0x06,0xA8,0x95,0x99,0x9A,0x05,0xE1,0x3C,0xC0,0xA1,
+0x57,0x0F,0x05,0xC1,0x16,0x2A,0x0B,0xC0,0x0E,0x97,0x8A,0x0B,0xC1,0x21,0x33,0xC0,0x11,0x3D,0xA9,0x88,0x0B,0xC0,0x93,0x89,0x25,0x14,0x05,0xC9,0xA6,0x87,0x13,0x05,
+0xD7,0x3A,0x1E,0x9B,0x87,0x05,0xC2,0xB7,0x67,0x3D,0x12,0x69,0xC0,0x69,0x0B,0xC0,0x0E,0x51,0x0B,0x0E,0x0B,0xC1,0x33,0x80,0x89,0x05,0xCB,0xAB,0x86,0x3C,0x05,0xD7,
+0x39,0x36,0x96,0x59,0x59,0x05,0xC3,0x3C,0x21,0xB0,0x87,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x95,0x7B,0x29,0x8F,0x78,0xA7,0x66,0x05,0xC5,0xBC,0x75,0x3D,0x12,
+0x0B,0x12,0x0B,0xC1,0x0C,0x30,0x86,0x8A,0x9B,0x89,0xA4,0x87,0x31,0x91,0xCD,0xC6,0xAA,0x66,0x30,0x2A,0x0B,0x0E,0x3D,0x00,0x86,0x8D,0x05,0xC1,0xA9,0x85,0x13,0x90,
+0x7B,0x0A,0xB2,0x33,0x06,0x28,0xC0,0x37,0x9C,0x99,0x37,0x06,0xAC,0x54,0xAE,0x53,0xA7,0x97,0x9A,0x9B,0xFE,0x7C,0x2B,0x29,0x3A,0x0A,0x05,0xE9,0xB5,0x84,0xA2,0x76,
+0x0F,0x05,0xE1,0xA9,0x97,0x3C,0x05,0xC0,0xB5,0x20,0xB7,0x52,0x58,0x50,0x9E,0x9B,0xC1,0xA4,0x77,0xA6,0x86,0x6D,0xC2,0x0E,0xFE,0x02,0x00,0x05,0xE9,0xB0,0x74,0xA7,
+0x88,0x95,0xAD,0x05,0xC1,0x0C,0x1A,0x18,0xC0,0x1A,0x18,0xC2,0x1A,0x25,0x36,0x18,0xC0,0x8F,0xAD,0x28,0x05,0xC4,0x0F,0xA2,0x77,0xC0,0x05,0xDE,0x39,0x9D,0x99,0x3D,
+0x05,0xC1,0x31,0xFE,0x6E,0x27,0x18,0xC0,0x1A,0x18,0xC2,0x9D,0x9A,0xFE,0x43,0xE6,0x9E,0xCC,0x0D,0x18,0x2C,0xFE,0x0A,0x00,0x92,0xEF,0x05,0xC0,0x2B,0x24,0xA8,0x65,
+0xC0,0x24,0xC1,0x13,0x28,0x0A,0x05,0xD9,0x3C,0xAA,0x76,0x94,0x9C,0x3D,0x9D,0xC8,0xC0,0x6B,0xC0,0xA7,0x65,0xC0,0x7B,0xC0,0x39,0xA4,0x96,0x17,0x05,0xDC,0x37,0xA3,
+0x77,0xA4,0x65,0xA5,0x66,0x13,0xA0,0xBB,0xA1,0xDA,0x9C,0xAB,0x13,0xC4,0xA7,0x87,0x9F,0x75,0x05,0xDA,0xAB,0x44,0x19,0xA7,0x74,0x0E,0xA4,0x77,0x1A,0x2C,0x19,0x28,
+0x37,0xC0,0x06,0xA4,0x88,0x0C,0x25,0x18,0xC0,0x1A,0x18,0xC3,0xFE,0x4C,0x07,0xFE,0x73,0xAD,0x2C,0xFE,0x76,0x87,0x18,0x25,0x8D,0xBE,0xB1,0x62,0x1A,0x18,0xC2,0x25,
+0x06,0x05,0xC0,0xAB,0x55,0x24,0x92,0xDD,0xFE,0x76,0xA7,0x18,0x9D,0x9A,0x18,0xC1,0x25,0x3E,0x2C,0x1F,0x18,0x1A,0x0E,0x18,0xC0,0x1A,0x18,0xC2,0x12,0xFE,0x00,0x60,
+0x05,0xC0,0x10,0x59,0x05,0xD7,0x22,0x3D,0x1D,0x13,0x1D,0x13,0xC3,0x27,0x8A,0x9D,0x05,0xD8,0xAF,0x54,0xFE,0x65,0xA7,0x18,0xC6,0x97,0x9A,0x06,0x05,0xC2,0x32,0x12,
+0x0A,0x1A,0x18,0x9D,0x9A,0x18,0xC1,0x1A,0x12,0xA3,0x8A,0x1F,0x18,0x1A,0x25,0x6B,0x1A,0x18,0xC0,0x1A,0x18,0xC1,0xFE,0x0A,0x00,0x05,0xC1,0x2E,0x95,0xBB,0x05,0xD5,
+0x2B,0x07,0x3D,0xC5,0x41,0xA4,0x87,0x3D,0xC2,0x9D,0xA8,0xA7,0x86,0x1D,0x13,0xC0,0x22,0x13,0xC1,0xAB,0x73,0x17,0x05,0xD8,0x12,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,
+0xC1,0x12,0x05,0x6E,0x05,0xC1,0xFE,0x43,0xE6,0x25,0x50,0x1A,0x18,0xC9,0x12,0x1F,0x18,0xC4,0x12,0x0F,0x05,0x6E,0x32,0x10,0x0A,0x05,0xD4,0xAC,0x87,0xA7,0x86,0x3D,
+0xC4,0x26,0x69,0x3D,0x9D,0xE6,0xA0,0xA9,0x9E,0xB6,0xA3,0x99,0x74,0x29,0x9D,0xBA,0x13,0xC3,0xA5,0x77,0xA2,0x76,0x05,0xD8,0x37,0xFE,0x65,0xA7,0x18,0xC1,0x1A,0x18,
+0xC4,0x06,0x15,0x0A,0x05,0xC1,0xAF,0x33,0x36,0x58,0x50,0x1A,0x18,0xC2,0x1A,0x18,0xC3,0x15,0xAC,0x66,0x18,0x06,0x18,0xC2,0x2C,0xFE,0x02,0x00,0x05,0xC1,0xAB,0x55,
+0x59,0x05,0xD4,0xB4,0x72,0x9C,0x8A,0x1F,0x26,0x9F,0xB8,0xA0,0xA8,0x2B,0x70,0x12,0xA2,0xA7,0xA1,0xA9,0x7A,0x61,0x66,0x29,0xA3,0x98,0x18,0xC5,0x6F,0x1A,0xFE,0x0A,
+0xA0,0x31,0x36,0x18,0x9D,0x9A,0x18,0xC2,0x15,0xFE,0x00,0x20,0xC1,0xA5,0x87,0xA6,0x45,0x0F,0x05,0xD3,0x22,0xFE,0x61,0x43,0x35,0x37,0x79,0xA3,0x78,0xFE,0x4A,0xA4,
+0x27,0x8C,0x9D,0x97,0x9C,0xD8,0x31,0xFE,0x6E,0x27,0x18,0xC1,0x9D,0x9A,0x18,0xC6,0x8F,0xAD,0x0F,0x05,0xC1,0xB8,0x21,0x1A,0x18,0xC0,0x94,0x8B,0xA5,0x99,0x18,0x24,
+0x18,0xC0,0x1A,0x18,0xC1,0xFE,0x09,0x81,0x05,0xB4,0x42,0xBB,0x30,0x18,0xC1,0x1A,0x18,0x39,0xFE,0x00,0xA0,0x05,0xC1,0xA5,0x88,0xAA,0x53,0xFE,0x76,0x09,0x18,0xC2,
+0x1A,0x18,0xC4,0x9D,0x9A,0x0D,0xFE,0x23,0x03,0x05,0xC1,0xAA,0x66,0x36,0x18,0x6B,0x18,0x99,0x9B,0x0A,0x1A,0x18,0xC2,0x06,0x0E,0xFE,0x00,0xA0,0x0F,0x05,0xFE,0x43,
+0xE6,0x1A,0x18,0xC2,0x25,0xFE,0x01,0x60,0x05,0xC2,0xAF,0x33,0x05,0xD3,0x22,0x9F,0xF8,0x93,0x2C,0x0E,0x06,0x18,0xC1,0x06,0x0E,0x2C,0x18,0xC1,0x06,0x12,0xFE,0x00,
+0x40,0x05,0xC0,0xA8,0x55,0x12,0x1F,0x18,0xC0,0x06,0x18,0xFE,0x0A,0x00,0x05,0xC2,0x32,0x24,0x22,0x05,0xD9,0x10,0x0D,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x0C,
+0x05,0xC0,0x0F,0xBD,0x31,0x1F,0x18,0xC0,0x1A,0x18,0xC0,0x97,0x9A,0x0E,0x06,0x18,0x0A,0xFE,0x09,0x81,0x05,0xC2,0x06,0xBB,0x41,0x18,0xC1,0x1A,0xFE,0x1A,0xC1,0x05,
+0xC3,0x10,0x9C,0x88,0x05,0xD1,0x2B,0xB5,0xA4,0xFE,0x99,0x61,0x3A,0x29,0xC0,0x66,0xA4,0x87,0x51,0xC1,0x29,0x22,0x8D,0x7B,0x9C,0x8A,0x9D,0x9A,0xD8,0xA8,0x55,0x12,
+0x18,0xC1,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC1,0x06,0x9C,0x8A,0xFE,0x02,0x00,0x05,0xC0,0xB4,0x42,0x1A,0x18,0x06,0x18,0xC4,0x0A,0x8F,0xBF,0x05,0x0F,0x05,0xC3,0xAF,
+0x33,0xB7,0x63,0x06,0xA4,0x77,0x15,0x05,0xC4,0x2E,0x9C,0x99,0x05,0xD1,0xAC,0x87,0xAF,0x83,0xFE,0x99,0x61,0x9F,0xB8,0xC1,0x6F,0x29,0xFE,0x6B,0x85,0x05,0xDA,0xA6,
+0x87,0xFE,0x3C,0x62,0x1F,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC2,0x8A,0x9E,0x05,0xC0,0x17,0x06,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x39,0x0C,0x05,0xC3,0x6E,0xAE,0x33,
+0x0E,0x18,0x29,0x0F,0x05,0xC4,0xAF,0x54,0x0F,0x05,0xD1,0xB8,0x73,0x9C,0xF7,0x3D,0x7E,0xC0,0x3D,0x05,0x06,0x18,0xC0,0x06,0x18,0xC3,0x1A,0x18,0xC1,0x12,0xFE,0x02,
+0x00,0xFE,0x00,0x20,0xC3,0x24,0x39,0x15,0xFE,0x00,0x60,0x05,0xC4,0xAA,0x66,0x4C,0x05,0xD1,0xAB,0x86,0xAE,0xA3,0x9B,0x6A,0x9C,0xAB,0xAB,0x75,0x94,0x8A,0x0A,0x05,
+0xDA,0x08,0xFE,0x6E,0x26,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC2,0x10,0x05,0xAF,0x33,0x0D,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x25,0x8D,0xBE,0x92,0xCF,0x0A,
+0x05,0xC1,0xAB,0x55,0x3E,0x19,0x05,0xC4,0x2B,0x0C,0x24,0x0A,0x05,0xC3,0xA7,0x85,0x0C,0x19,0x05,0xD1,0xB7,0x71,0x35,0x3D,0x18,0xC3,0x9D,0x9A,0x18,0xC3,0x1A,0x18,
+0xC1,0x0E,0x19,0x2E,0xFE,0x65,0xA7,0x18,0xC0,0x06,0x18,0xC3,0x1A,0x18,0xC4,0x06,0x18,0xC0,0x25,0x8D,0xAE,0x28,0x05,0xC0,0x10,0x24,0x0A,0x05,0x0A,0x05,0xC1,0x24,
+0x9B,0x99,0x0A,0xB7,0x92,0x32,0x0A,0x05,0xDC,0xB7,0x10,0x06,0x18,0xC3,0x06,0x18,0xC3,0x1A,0x18,0xC0,0x25,0xFE,0x09,0x81,0x19,0x0D,0x18,0xC4,0x9D,0x9A,0x18,0xC3,
+0x1A,0x18,0xC4,0x0D,0x15,0xFE,0x00,0x60,0x05,0xC0,0x10,0x24,0x05,0xC1,0x0A,0xC0,0x2A,0x3E,0x9A,0x9A,0xC0,0x9C,0xAB,0x05,0xCF,0xB8,0x73,0x35,0x3D,0x7E,0x9D,0x89,
+0x2C,0x18,0xC0,0x1A,0x18,0xC6,0x9D,0x9A,0x18,0xC1,0xFE,0x0A,0xA0,0xA4,0xBB,0x1A,0x18,0xC0,0x06,0x18,0xC3,0x1A,0x18,0xC5,0x06,0x18,0xC1,0x25,0x37,0x96,0xDD,0xC0,
+0xA2,0x77,0x2A,0x9C,0x79,0x05,0xA8,0x55,0x10,0x2E,0x13,0x27,0x8E,0x9C,0x05,0xDD,0x37,0xFE,0x54,0xE7,0x18,0xC0,0x1A,0x18,0xC7,0x9D,0x9A,0x18,0xC0,0x8A,0x9E,0xA1,
+0xBC,0x1F,0x18,0x1A,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC6,0x99,0x9C,0xFE,0x09,0x81,0x05,0xC1,0xA6,0x87,0x08,0x24,0x06,0x2E,0x24,0x06,0xC0,0x55,0x73,0x9C,0x99,
+0x10,0x2E,0x19,0x05,0xCC,0xAB,0x86,0xAE,0xA3,0x27,0x31,0x0A,0x05,0xDD,0x15,0x1A,0x18,0xC4,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0x8F,0xAD,0xC0,0x1F,0x18,0xC3,0x06,0x18,
+0xC3,0x1A,0x18,0xC6,0x97,0x9A,0x28,0x9B,0xBB,0x05,0xC0,0x37,0x2E,0x19,0x05,0xC2,0x2B,0x19,0x37,0xA3,0x77,0xC0,0x2B,0x24,0x19,0x05,0xCB,0xA9,0x97,0xB4,0x63,0x8D,
+0x8D,0x37,0x39,0x1F,0x18,0xC0,0x1A,0x18,0xC8,0x2C,0x39,0x18,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC7,0x06,0x18,0xC0,0x1A,0x87,0xBF,0x0F,0x05,0xC0,0xAA,0x66,0x37,0x99,
+0xBB,0x05,0xC0,0x0F,0x2B,0xB0,0x85,0xA2,0x76,0x05,0xE0,0xFE,0x23,0x41,0x1A,0x18,0xC0,0x1A,0x18,0xC8,0x06,0x0E,0x1F,0x18,0x1A,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,
+0xC4,0x2C,0xFE,0x09,0x81,0x05,0xC0,0x2B,0xAA,0x55,0x0A,0x05,0xC3,0x0A,0x05,0xC2,0xAA,0x64,0xAA,0x12,0x24,0x28,0x06,0x24,0x58,0x24,0x06,0x24,0x0C,0x28,0x0F,0x05,
+0xC2,0x0A,0x05,0xC4,0x20,0xB0,0x84,0x33,0x76,0xA3,0x88,0xC0,0x66,0x3D,0x0A,0xC0,0x9C,0x89,0xC1,0x31,0xFE,0x4A,0xA4,0x9C,0xAB,0xC0,0xAB,0x73,0x98,0x8A,0x8D,0x9F,
+0xE0,0x37,0xFE,0x54,0xE7,0x18,0xC6,0x1A,0x18,0xC3,0x8F,0xAD,0x0D,0x18,0xC5,0x9D,0x9A,0x18,0xC3,0x1A,0x18,0xC3,0xFE,0x0A,0x00,0x92,0xEF,0x05,0x37,0xA3,0x77,0x05,
+0xCA,0xA5,0x88,0x2E,0x3E,0x28,0x0F,0x05,0xC2,0x0A,0x05,0xC4,0x36,0xA4,0xC6,0xFE,0xB1,0x81,0xC0,0x3D,0xA2,0x87,0x05,0x0A,0x05,0xC0,0x3D,0x29,0xC0,0x3D,0x05,0x46,
+0x3D,0xFE,0x08,0x41,0xFE,0x23,0x03,0xFE,0x6E,0x26,0x18,0x06,0x18,0xC3,0x1A,0x18,0xC3,0x97,0x9A,0xA2,0x8A,0x1A,0x18,0xC1,0x06,0x18,0xC3,0x1A,0x18,0xC5,0x12,0x28,
+0x99,0xCC,0x6E,0x0C,0x91,0xCC,0x05,0x0A,0x05,0x0A,0x05,0xC4,0x19,0x37,0x0F,0x0A,0xAF,0xA6,0x24,0x8E,0x8B,0x97,0x9C,0xE1,0x10,0xFE,0x55,0x63,0x18,0x06,0x18,0xC3,
+0x1A,0x18,0xC4,0x0A,0x18,0x6F,0x18,0xC2,0x06,0x18,0xC3,0x1A,0x18,0x2C,0x0A,0xC0,0x9B,0x9A,0x94,0x9D,0x0C,0xC0,0xA1,0x54,0x3E,0x2C,0x0C,0x08,0x2E,0x59,0x9C,0x99,
+0x28,0x32,0x24,0x06,0x24,0x06,0x2E,0x0C,0x37,0x19,0x37,0x06,0x13,0xAB,0x75,0x8C,0x8B,0x05,0xE1,0x2B,0xB9,0x10,0x1F,0x18,0xC0,0x1A,0x18,0xC8,0x8F,0xAD,0x1F,0x9D,
+0x99,0x18,0xC0,0x99,0x9C,0x0A,0xC0,0x0E,0x44,0x61,0x12,0xC0,0x24,0xC0,0x0E,0x35,0x92,0xAD,0x91,0xDF,0x73,0x28,0x05,0x0F,0xC0,0x05,0xC1,0x19,0x37,0xA7,0x66,0x58,
+0xA5,0x66,0x13,0x05,0xC1,0x37,0x0C,0x98,0x99,0x37,0x10,0x13,0xBC,0x56,0x99,0x99,0xC0,0xA6,0x88,0x01,0x96,0x99,0x3C,0x01,0xC0,0x93,0xA9,0x3C,0x01,0xC0,0x95,0x99,
+0x3C,0x01,0x9C,0x88,0x00,0x3C,0x01,0xC0,0x9D,0x99,0xA2,0x78,0x01,0xFD,0xD0,0x18,0x3C,0x01,0xE7,0x00,0x98,0xA9,0x18,0x3C,0x01,0x19,0xC0,0x00,0x18,0x3D,0x41,0x07,
+0x00,0xC0,0x19,0x28,0x39,0x01,0xFD,0xC4,0x19,0x27,0x3C,0x01,0xE3,0x00,0x3D,0x26,0xA5,0x78,0xA2,0x87,0xC4,0x19,0x00,0x18,0x3D,0x26,0x3D,0x00,0xC0,0x01,0xFB,0x27,
+0x3C,0x01,0xE0,0x00,0x3D,0x26,0x07,0x27,0x1D,0x01,0xC3,0x19,0x00,0x18,0x26,0x3D,0x1D,0x00,0xC0,0x01,0xF6,0x07,0x3C,0x01,0xDE,0x19,0x3D,0x26,0x07,0x27,0x1D,0xC1,
+0x01,0xC7,0x28,0x00,0x27,0x07,0x26,0x3D,0x1D,0x00,0xC0,0x3C,0x01,0x3C,0x01,0xEE,0x27,0x3C,0x01,0xDC,0x19,0x3D,0x40,0x10,0x1D,0xC4,0x01,0xCC,0x28,0x00,0xC0,0x27,
+0x3D,0x26,0xC0,0x3D,0x1D,0x00,0x28,0x39,0x01,0xE8,0x00,0xC0,0x3C,0x01,0x3C,0x01,0xD8,0x28,0x18,0x99,0x99,0x07,0x27,0x1D,0xC5,0x01,0xD2,0x19,0xC0,0x00,0x18,0x3D,
+0x26,0xC0,0x3D,0x00,0x19,0x28,0x39,0x01,0xE2,0x27,0x3C,0x01,0xDA,0x27,0x1F,0x10,0x1D,0x5A,0xC1,0x1D,0xC4,0x01,0xCE,0x00,0x19,0x27,0x07,0x26,0xC0,0x3D,0x1D,0x00,
+0x28,0xC0,0x39,0x01,0xC9,0x69,0xC1,0x3C,0x01,0xCD,0x07,0x3C,0x01,0xD8,0x00,0x3D,0x26,0x10,0x18,0x01,0xD3,0x28,0x00,0xC0,0x9F,0xA6,0x9D,0x88,0xC0,0x29,0xA4,0x77,
+0x7E,0xA3,0x98,0xA2,0x78,0xC1,0x67,0xC4,0x3C,0xC0,0x3E,0xC2,0x3A,0xC0,0x67,0x3A,0xC0,0x3C,0x3A,0x01,0xC3,0x93,0xA9,0x3C,0x01,0xD7,0x07,0x26,0xC0,0x1D,0xC1,0x01,
+0xCF,0x3A,0xC0,0x3E,0x6C,0x61,0xC1,0x9C,0x78,0x9C,0x9A,0x6D,0x9B,0x9A,0x9C,0x8A,0xC4,0x50,0xC4,0xA5,0x99,0x06,0xC2,0x22,0xA4,0x78,0x0F,0xA5,0x85,0xA2,0x78,0x35,
+0x3E,0xC0,0x47,0xC0,0x67,0x3A,0x00,0xC0,0x01,0xD6,0x19,0x3D,0x1F,0x1D,0x1A,0x1D,0xC1,0x01,0xCB,0x3E,0xC0,0x2B,0x0F,0x22,0x06,0x9B,0x98,0x9C,0x89,0x53,0x51,0xC1,
+0x9D,0x9A,0xD5,0x2B,0xA4,0x86,0xA6,0x87,0xA7,0x85,0xA5,0x98,0x27,0x38,0x35,0x3E,0x18,0x3C,0x01,0xD5,0x00,0x1F,0x10,0x1D,0xC4,0x01,0xC7,0x3E,0xC0,0x0F,0x22,0x3A,
+0x05,0x17,0xC0,0x9D,0x9A,0xE2,0x2B,0xA9,0x97,0xA9,0x74,0x27,0x16,0xA1,0x6C,0x9F,0x9B,0xC0,0x67,0x3A,0x01,0xD0,0x00,0x1F,0x10,0x1D,0xC5,0x01,0xC4,0x3E,0x35,0x0F,
+0x06,0x97,0x99,0x9B,0x8B,0x05,0xEA,0x2B,0xA9,0x97,0x39,0x27,0x38,0x35,0x3A,0xC0,0x67,0x3A,0x01,0xCC,0x96,0x99,0x1F,0x10,0x1D,0xC6,0x01,0xC3,0x60,0x06,0x31,0x05,
+0xF1,0xA5,0x88,0x06,0x16,0xA2,0x78,0x9F,0x7C,0x3A,0x01,0xCB,0x19,0x93,0xAA,0x3D,0x1D,0xC8,0x01,0xC3,0x22,0x0F,0x05,0xF5,0x20,0xAD,0x86,0xA3,0x98,0x35,0x3E,0x01,
+0xC9,0x26,0x3D,0x1D,0xC9,0x01,0xC3,0x95,0xC7,0x05,0xF8,0x20,0x0F,0x35,0x3E,0x01,0xC3,0x3A,0x01,0xC0,0x19,0x3D,0x1F,0x1D,0xCA,0x01,0xC3,0x06,0x91,0x9C,0x05,0xF9,
+0x20,0x0F,0x35,0x31,0x3A,0x01,0xC2,0x19,0x3D,0x1F,0x1D,0xCB,0x01,0xC2,0x29,0x20,0x05,0xFC,0x06,0x16,0x38,0x3A,0xC0,0x3C,0x19,0x1F,0x10,0x1D,0xCC,0x01,0xC3,0x8F,
+0x96,0x05,0xFD,0xA6,0x87,0xAF,0x85,0x38,0x35,0x19,0x1F,0xA4,0x88,0xA3,0x89,0x1D,0xCC,0x01,0xC2,0x29,0x8C,0x99,0x17,0x05,0xFD,0xC0,0x20,0x0F,0x35,0x06,0x1D,0xCE,
+0x01,0xC2,0x19,0x8B,0xA9,0x05,0xFD,0xC2,0x32,0x22,0xAA,0x74,0x22,0x1D,0x1A,0x1D,0xCB,0x01,0xC2,0x9C,0x95,0x0F,0x05,0xFD,0xC4,0xAF,0x84,0x27,0x07,0x1A,0x1D,0xCB,
+0x01,0xC2,0x22,0x0A,0x05,0xFD,0xC5,0xA9,0x97,0xAF,0x75,0xA3,0x98,0x98,0x59,0x1A,0xC0,0x1D,0xC8,0x01,0xC2,0x3A,0x05,0xFD,0xC7,0x32,0xB2,0x71,0x27,0x19,0x1A,0x1D,
+0xC8,0x01,0xC2,0x8E,0xA6,0x17,0x9D,0x9A,0xFD,0xC8,0x36,0x38,0x94,0xAD,0x1D,0xC8,0x01,0xC1,0x60,0x8B,0xA9,0x05,0xFD,0xCA,0x22,0x27,0x97,0x9B,0x1D,0x1A,0x1D,0xC5,
+0x01,0xC1,0x0F,0x8A,0x8C,0x05,0xFD,0xCB,0x20,0x27,0x22,0x1D,0x1A,0x1D,0xC4,0x01,0xC1,0x9D,0xA5,0x0A,0x05,0xFD,0xCC,0x20,0x27,0x96,0x9D,0x1D,0xC5,0x01,0xC1,0x98,
+0xA3,0x05,0xD5,0xA5,0x87,0x17,0x05,0xF3,0x22,0x27,0x29,0x1D,0xC4,0x01,0xC0,0x60,0x92,0x98,0x05,0xD5,0xB3,0x85,0xAA,0x76,0x3A,0x05,0xF3,0x32,0x27,0xFE,0x3A,0x48,
+0x9D,0x98,0x1D,0xC2,0x01,0xC0,0x31,0x1F,0x05,0xD5,0xAF,0x87,0xFE,0xD6,0xF5,0xC0,0x8C,0x99,0x12,0x05,0xF2,0x39,0xA6,0x86,0x1A,0x1D,0xC2,0x01,0xC0,0x9D,0xA5,0x8A,
+0x8C,0x05,0xD5,0x16,0xFE,0xCE,0xB3,0xAA,0x89,0x62,0x91,0x98,0x86,0x79,0x0F,0x05,0xF1,0xB8,0x73,0x22,0x18,0x1D,0xC1,0x01,0xC0,0x99,0xA4,0x05,0xD6,0xA6,0x87,0xFE,
+0xBD,0xD1,0xB1,0x79,0x7A,0x04,0x34,0x89,0x98,0x8A,0x8B,0x17,0x9D,0x9A,0xC2,0x16,0xA2,0x77,0x05,0xE9,0xA5,0x88,0x24,0x39,0x18,0x1D,0xC0,0x01,0x31,0x12,0x05,0xD6,
+0x2B,0xFE,0xAD,0x8E,0x0B,0x0E,0x0B,0xC0,0x9D,0x98,0x8D,0x87,0x87,0x9B,0x05,0xC2,0xA5,0x87,0x24,0xC0,0x8E,0x8B,0x17,0x9D,0x9A,0xE7,0x20,0x27,0x96,0x9C,0x1D,0xC0,
+0x01,0xC0,0x31,0x17,0xC0,0x05,0xD5,0x2B,0x3D,0x04,0x62,0x0B,0xC1,0x9D,0x98,0x92,0x98,0x86,0x79,0x17,0xC0,0x05,0xC0,0x22,0xBD,0x86,0x3D,0x22,0x8F,0x8C,0x05,0xE7,
+0x13,0x27,0x22,0x1D,0xCA,0x26,0x55,0x01,0xC0,0x9C,0x95,0x0F,0x05,0xD7,0x21,0x04,0x3A,0x0B,0x0E,0x04,0x0B,0xC0,0x31,0x88,0x8A,0x1F,0x05,0xC0,0xA5,0x87,0x36,0xB9,
+0x88,0x19,0x3C,0x8A,0x9A,0x9B,0x8B,0x05,0xE6,0x13,0x27,0x18,0x1D,0xC6,0x9B,0xBA,0x26,0xC0,0x3D,0xA4,0x88,0x01,0xC0,0x99,0xA4,0x05,0xD8,0xFE,0x94,0xCD,0x0B,0x0E,
+0x0B,0x0E,0x04,0x0B,0xC0,0x0E,0x34,0x0C,0x31,0x9B,0x8B,0x05,0x29,0x34,0x0B,0x9C,0x86,0x36,0x12,0x05,0xE6,0xA5,0x87,0xB4,0x85,0x24,0x1A,0x1D,0xC3,0x26,0x17,0x26,
+0x3D,0x00,0x25,0xC0,0x01,0xC0,0x12,0x05,0xD8,0xFE,0x7C,0x2B,0x04,0x3A,0x0B,0x0E,0xC0,0x04,0x0B,0xC1,0x15,0x0C,0x8A,0x8B,0x97,0x9C,0xA6,0x87,0x21,0x04,0x0E,0x9D,
+0x88,0x21,0x86,0x9C,0x05,0xE6,0xA9,0x85,0x27,0x22,0x1D,0xC1,0x26,0x17,0x3D,0x25,0xC4,0x01,0x60,0x8C,0x99,0x9B,0x9A,0xD8,0x1F,0x04,0x0E,0x04,0x0B,0xC1,0x0E,0x04,
+0x0B,0xC0,0x9A,0x99,0x85,0x77,0x31,0x05,0x1E,0x15,0x0B,0x0E,0x04,0x8F,0xA9,0x84,0x88,0x8F,0x9E,0x05,0xE5,0x06,0xAB,0x94,0x93,0x9E,0x9C,0x7A,0xC0,0x10,0x25,0xC6,
+0x01,0xD4,0x07,0x0F,0x05,0xD8,0x0C,0x04,0x62,0x0B,0x0E,0xC1,0x04,0x0B,0xC1,0x0E,0x34,0x1E,0x08,0x3C,0xFE,0xBE,0x54,0xAD,0x98,0x0E,0x0B,0x0E,0x92,0x76,0x88,0x8A,
+0x8B,0x9C,0xC0,0x05,0xE4,0x0F,0x9B,0x99,0x18,0x25,0xC9,0xA7,0x67,0x28,0xA2,0x78,0x01,0xC1,0x66,0x01,0xC9,0x69,0x01,0xC1,0x20,0x05,0xD9,0xBD,0x73,0xBF,0xA9,0x0B,
+0x0E,0x0B,0x0E,0xC0,0x04,0x0B,0xC1,0x0E,0x0B,0x96,0x86,0x20,0x2B,0x21,0x04,0x0E,0xC2,0x31,0x0F,0x17,0x05,0xE4,0xAB,0x86,0x27,0x96,0x9D,0x25,0xC9,0x26,0x55,0x26,
+0xA2,0x97,0xA2,0x78,0xA3,0x89,0x00,0xC0,0x01,0xCB,0xA1,0x85,0x12,0x05,0xD9,0xBB,0x83,0xFE,0xEF,0x98,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0xC0,0x8F,
+0x98,0x20,0x0F,0x2B,0x0E,0x0B,0x0E,0x0B,0x0E,0x92,0x76,0x83,0x9B,0x8F,0x8C,0x05,0xE4,0x22,0xAA,0x74,0x13,0x25,0xC7,0x36,0x3D,0xC0,0x26,0x07,0x36,0x07,0x36,0x9C,
+0x89,0x26,0x17,0x3D,0x18,0x1D,0x00,0xC0,0x01,0xC4,0x1E,0x8B,0x9B,0x05,0xD9,0x1E,0xFE,0xE7,0x76,0x0E,0x04,0x0B,0xC0,0x9A,0x99,0x3A,0x0B,0xC0,0x0E,0x04,0x0B,0xC1,
+0x84,0x98,0x8D,0x89,0x34,0x0B,0xC0,0x0E,0x0B,0x0E,0xC0,0x8F,0x98,0x87,0x78,0x05,0xE4,0xA5,0x87,0x1E,0x9E,0x75,0x25,0xC5,0x9C,0x87,0x9C,0x89,0x26,0x3D,0xC0,0x26,
+0x07,0x36,0x3D,0x26,0x07,0x36,0x3D,0xC0,0x26,0x07,0x36,0x26,0x17,0x26,0x36,0x18,0x1D,0x00,0x32,0x05,0xDA,0xB8,0x73,0xB9,0x89,0x9C,0xAA,0x99,0x89,0x96,0x89,0x29,
+0x06,0x25,0xC0,0xB4,0x72,0xAF,0x8C,0xA9,0xA6,0xA2,0x78,0xC0,0x0E,0x9D,0x88,0x80,0x89,0x22,0x0B,0xC2,0x0E,0x04,0x0B,0x22,0x86,0x79,0x90,0x8B,0x05,0xE3,0x13,0x27,
+0xFE,0x4A,0x27,0x25,0xC3,0x36,0x15,0xC1,0x3D,0xC1,0x26,0x07,0x36,0x3D,0xC1,0x26,0x07,0x36,0x3D,0xC2,0x26,0x07,0x36,0x3D,0x29,0x06,0x05,0xDA,0x0F,0x22,0x13,0x47,
+0x36,0x15,0x17,0xC0,0x05,0xC1,0xB9,0x76,0xB1,0x98,0xB0,0x87,0x0B,0x0E,0x96,0x76,0x94,0x88,0x04,0x0E,0xC1,0x04,0x0B,0xC1,0x8D,0x96,0x84,0x8B,0x05,0xE3,0xA9,0x85,
+0xB2,0x86,0x9D,0x89,0x25,0xC1,0x36,0x15,0xC3,0xA4,0x88,0xC1,0x26,0x07,0x36,0x3D,0xCA,0x26,0x07,0x0F,0x1F,0x9C,0x8A,0xDA,0xB7,0x72,0x34,0x0B,0x61,0x55,0x9D,0x9A,
+0x2D,0x99,0xA7,0x33,0x8E,0x69,0x92,0xA8,0x05,0xC0,0xAF,0x87,0x33,0x19,0x04,0x8F,0xA9,0x9E,0x76,0x0B,0xC0,0x0E,0xC0,0x04,0x0B,0xC1,0x84,0x98,0x89,0x8B,0x05,0xE3,
+0xB3,0x84,0x27,0x18,0x25,0x9C,0x88,0x15,0xC4,0x3D,0xC0,0x26,0x07,0x61,0x3D,0xC4,0x26,0x07,0x36,0x3D,0xC4,0xAB,0x74,0x8B,0x9C,0x05,0xDA,0xB8,0x73,0xFE,0xE7,0x76,
+0x0B,0x04,0x62,0x0B,0x0E,0xC1,0x0B,0x97,0x9A,0x33,0x89,0x89,0x96,0x88,0x17,0x0F,0x33,0x9A,0x87,0xA4,0x75,0xBA,0x8A,0x0B,0x0E,0xC1,0x04,0x0B,0xC0,0x00,0x94,0x89,
+0x1F,0x05,0xE2,0x2B,0xB6,0x84,0x0F,0x94,0x9D,0x9C,0x88,0xC5,0x3D,0xCB,0x26,0xA4,0x87,0x36,0x3D,0xC1,0xA7,0x85,0x22,0x8F,0x8C,0x05,0xDA,0x1E,0xFE,0xEF,0x98,0x0E,
+0x0B,0xC0,0x0E,0x0B,0x0E,0xC1,0x04,0x0B,0xC0,0x97,0x9A,0x30,0x89,0x9A,0x08,0xB4,0x57,0xFE,0xE7,0x5B,0xA5,0x96,0x12,0x0E,0x04,0x0B,0xC0,0x19,0x84,0x8B,0x05,0x0A,
+0xA5,0x76,0x08,0x05,0xE2,0x29,0x24,0x8C,0x8D,0xA1,0x9A,0xC5,0xA4,0x88,0xCF,0x41,0x07,0xAA,0x84,0x20,0x05,0xDB,0x0C,0x2B,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0xC1,0x0E,
+0x0B,0xC1,0x0E,0x2A,0x9B,0x99,0x2B,0x0E,0x0B,0xC0,0x0E,0xC0,0x04,0x2B,0xFE,0x5B,0x4A,0x08,0x29,0x37,0x9E,0x73,0x84,0x8B,0x05,0xE2,0xA6,0x87,0x35,0x20,0x15,0xC5,
+0xA4,0x88,0xD0,0xA0,0xB8,0x24,0x1F,0x05,0xDB,0x3C,0xBF,0xA9,0x0B,0xC0,0x0E,0xC0,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0x0E,0xC2,0x04,0x0B,0xC0,0x16,0x36,0x11,
+0x2A,0x0B,0x2B,0x85,0x89,0x87,0x9A,0x9B,0x8B,0x05,0xE1,0xB8,0x73,0x9E,0x85,0x3F,0x15,0xC4,0x3D,0xD0,0xA4,0xA6,0xA8,0x63,0x08,0x05,0xDB,0x3C,0x34,0x9F,0x9B,0xC1,
+0x19,0xA6,0x76,0x0B,0x0E,0xC2,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x04,0x93,0x8A,0x3E,0x3D,0x12,0x69,0x0E,0x04,0x96,0x87,0x39,0x08,0x05,0xE1,0xAE,0x85,0x27,0x20,
+0x15,0xC4,0xA4,0x88,0xD0,0xA9,0x84,0x14,0x05,0xDC,0x1E,0x90,0x89,0x17,0x9D,0x9A,0x17,0xA7,0x89,0x25,0xB6,0x86,0xB2,0x86,0x12,0x2B,0x19,0x0B,0xC1,0x0E,0xC0,0x04,
+0x0B,0xC1,0x0E,0x19,0x11,0x2A,0x0B,0xC2,0x0E,0xC0,0x8D,0x86,0x20,0x05,0xE1,0xA5,0x88,0x27,0x0A,0x15,0xC4,0xA4,0x88,0xD0,0x36,0x94,0x89,0x17,0x9D,0x9A,0xDB,0xBD,
+0x73,0x30,0x33,0x30,0x16,0x29,0x1F,0x05,0xAA,0x78,0x33,0x19,0x21,0x2B,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0x0E,0x8F,0x98,0x2B,0x0E,0x0B,0x2B,0x0E,0x0B,0xC0,
+0x0E,0x2B,0x85,0x89,0x84,0x9B,0x05,0xE1,0x0F,0x78,0x3F,0x15,0xC3,0x06,0xC3,0xA1,0x58,0xC1,0x3D,0xC8,0x0F,0x1F,0x05,0xDC,0xFE,0x8C,0x6C,0xBB,0x8C,0xA1,0x9A,0xC1,
+0x1B,0x33,0x89,0x23,0x9B,0xAB,0x98,0xCC,0xB5,0x78,0xB6,0xB7,0x21,0x12,0x0B,0x0E,0x0B,0xC1,0x0E,0xC0,0x92,0x76,0x34,0x0B,0xC0,0x93,0x89,0x37,0x2B,0x21,0x30,0x58,
+0xC0,0x9B,0x98,0x14,0x05,0xE1,0xAE,0x85,0x27,0x8E,0x9C,0x15,0xC3,0x06,0xC5,0x7A,0x06,0xC1,0x02,0xC0,0x3D,0xC2,0xA7,0x85,0x69,0x05,0xDC,0xA5,0x87,0x36,0x1B,0xA1,
+0x9A,0xC1,0x97,0x85,0x84,0x00,0xA0,0x58,0x9C,0xCA,0x13,0x9B,0xAB,0xA5,0xDC,0xAD,0x87,0x2A,0xA4,0x87,0xC0,0x0E,0xC2,0x9C,0x76,0x9A,0x88,0xAA,0x89,0xC0,0x93,0x8A,
+0x9C,0xAA,0x11,0x86,0xA8,0x90,0x7B,0x6E,0xA7,0x99,0xB4,0x75,0x33,0x99,0x84,0x85,0x9D,0x9C,0x8A,0xE0,0x2B,0x27,0x94,0xAB,0x15,0xC3,0x06,0x09,0x06,0x09,0x06,0x09,
+0xC0,0x06,0x09,0xC1,0x06,0x09,0xC1,0x06,0x02,0xAB,0x84,0x12,0x05,0xDC,0x2B,0xB8,0x74,0x3D,0x31,0xC1,0x33,0xFE,0x0B,0x41,0x3E,0x92,0xCE,0x9B,0xBB,0xB1,0x44,0x9C,
+0x76,0x2B,0x37,0xB1,0x76,0x0E,0xC2,0x0B,0x92,0x86,0x3A,0x0B,0x98,0x9A,0x21,0x8D,0x7A,0x08,0x2B,0xAA,0x34,0xA4,0x88,0xA5,0x87,0x2D,0x1B,0x11,0x0A,0x08,0x05,0xE0,
+0xB8,0x73,0x9E,0x85,0x3F,0x15,0xC2,0x09,0x06,0x09,0xC1,0x06,0x09,0x06,0x09,0xC1,0x06,0x09,0xC0,0x06,0x09,0x1D,0xA8,0x63,0x08,0x05,0xDC,0x2B,0xFE,0x94,0xCD,0xAC,
+0x79,0x37,0xA9,0x88,0xA6,0x78,0x88,0x85,0x95,0x03,0x9B,0x9A,0xFE,0x00,0x60,0x62,0x24,0xA9,0x76,0x33,0x16,0xFE,0xF7,0xFA,0x0E,0x59,0x0B,0xC0,0x9A,0x99,0x9C,0x75,
+0x04,0xC0,0x21,0xFE,0x21,0x65,0x55,0x13,0xA0,0xBB,0x9C,0x78,0xA8,0x77,0xA6,0x22,0xAF,0xFF,0x2D,0x21,0x94,0x77,0x83,0x9C,0xC0,0x05,0xDF,0xB4,0x72,0xA7,0x96,0x3F,
+0x15,0xC2,0x09,0x5A,0x09,0xC1,0x06,0x09,0xC1,0x06,0x09,0xC1,0x06,0x09,0xC0,0xA7,0x77,0x14,0x05,0xDD,0xA6,0x87,0xFE,0xAD,0x8E,0x0B,0xC0,0x97,0x9A,0x21,0x98,0x76,
+0x98,0x8B,0x29,0x9C,0x96,0x29,0x05,0x30,0x21,0x2D,0xA9,0xA6,0x0E,0x04,0x0B,0xC0,0x34,0xA4,0x87,0x0B,0x00,0x05,0x3D,0x33,0x12,0x92,0xDF,0x0F,0xA9,0x66,0xAC,0x43,
+0x9C,0xCC,0xBE,0xA8,0xAD,0x98,0x93,0x89,0xFE,0x3A,0x01,0x91,0x9F,0xE0,0xAF,0x84,0x27,0x8C,0x9D,0x9F,0x9C,0xC2,0x09,0xC0,0x5A,0x09,0xC1,0x06,0x09,0xC2,0x06,0x09,
+0xC1,0x06,0xAE,0x62,0x05,0x17,0x9D,0x9A,0xDC,0xA9,0x97,0xFE,0xBD,0xD1,0xB1,0x79,0xC1,0x0E,0xC2,0x0B,0x67,0x6E,0xC0,0x0E,0x0B,0x0E,0xC2,0x0B,0x92,0x86,0xAC,0x9A,
+0x9C,0x89,0x11,0x33,0x2D,0x30,0x97,0x13,0x13,0x0F,0xAA,0x98,0x33,0xB2,0x86,0x12,0x7A,0x9D,0x87,0x1E,0x08,0x05,0xDF,0xAE,0x85,0xAD,0x83,0x3F,0xA1,0x9A,0xC2,0x09,
+0x06,0x09,0xC1,0x06,0x09,0xC3,0x06,0x09,0xC2,0xAF,0x42,0x89,0x9D,0x05,0xDD,0xAB,0x86,0x22,0x0B,0xC1,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0x0E,0x0B,0x0E,
+0x31,0x3A,0x0B,0xC0,0x0E,0x98,0x8A,0x37,0x33,0x11,0x21,0x2B,0x12,0x0B,0x0E,0x0B,0x34,0x1E,0x8E,0x89,0x0F,0x05,0xDE,0xA9,0x97,0x27,0x18,0x02,0xC0,0x25,0xC0,0x99,
+0xC9,0xC1,0x06,0xC2,0x09,0xC0,0x06,0x09,0xC1,0x06,0x09,0xAB,0x54,0x9C,0x78,0x0F,0x05,0xDD,0x36,0xFE,0xBE,0x31,0x3A,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,
+0xC2,0x0E,0xC0,0x31,0x04,0x3A,0x0B,0x0E,0xC1,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC0,0x21,0x84,0x78,0xC0,0x91,0x9C,0x05,0xDE,0x20,0xB3,0x83,0x95,0x9D,0x25,0xC2,0x2D,
+0xC8,0xA3,0x88,0xC2,0x09,0xAF,0x43,0x90,0x89,0x05,0xDE,0xAC,0x87,0xFE,0xCE,0xB3,0x04,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0xC2,0x0E,0xC0,0x31,0x04,
+0x0B,0xC1,0x0E,0xC0,0x0B,0xC3,0x0E,0xC0,0x0B,0x30,0x86,0x8A,0xAF,0x85,0x05,0xDF,0x20,0x27,0x29,0x25,0xC2,0x2D,0xC9,0x69,0x2D,0xC0,0x06,0x1E,0x08,0x05,0xDE,0xB0,
+0x95,0x34,0x0B,0xC1,0x0E,0xC2,0x0B,0x67,0x0B,0xC1,0x0E,0xC0,0x0B,0xC2,0x31,0xAC,0x9A,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0xC2,0x0B,0x9D,0x98,0x20,0x05,0xB7,
+0x74,0x90,0x99,0x0F,0x05,0xDD,0x13,0x27,0xFE,0x4A,0x27,0x25,0xC2,0x2D,0xC5,0x26,0x2D,0xC4,0x36,0x14,0x05,0xDF,0x29,0x34,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,
+0x0B,0xC3,0x0E,0xC0,0x19,0x2B,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0xC2,0x0E,0xC0,0x0B,0x11,0x05,0xC0,0x13,0x44,0x05,0xDE,0x39,0xC0,0x95,0xAE,0xA2,0x78,0x25,0xC1,0x2D,
+0xC4,0x26,0x2D,0xC5,0xAF,0x51,0x3F,0x05,0xDF,0xB8,0x73,0xFE,0xE7,0x76,0x0B,0x69,0x0B,0xC1,0x0E,0xC0,0x0B,0xC3,0x0E,0x0B,0x0E,0xC2,0x15,0x19,0x0B,0x0E,0x0B,0x0E,
+0xC2,0x0B,0xC2,0x2B,0x25,0x05,0xC0,0x20,0x13,0x05,0x0A,0x05,0xDC,0x24,0x99,0x89,0x36,0x9C,0x89,0xA2,0x78,0x15,0x26,0x2D,0xC4,0x69,0x2D,0xC0,0x26,0x2D,0x26,0x2D,
+0x26,0xAF,0x52,0x08,0x05,0xDF,0xBB,0x84,0x2B,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0xC3,0x0E,0xC0,0x0B,0xC4,0x0E,0x92,0x76,0xAC,0x9A,0x0E,0x0B,0x0E,0x59,0x0B,0xC1,0x0E,
+0x0B,0xC0,0x8E,0x99,0x08,0x05,0xC0,0xA6,0x87,0xAF,0x85,0x05,0xDD,0x3F,0x27,0x22,0x9E,0x6B,0xC1,0x18,0x9C,0xA9,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC0,0x2D,0x26,0x36,
+0x22,0x8F,0x8C,0x05,0xDF,0xBD,0x73,0xBF,0xA9,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0xC4,0x0E,0xC0,0x31,0x04,0x0B,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC1,0x36,
+0x05,0xC2,0x22,0x0F,0x05,0xDC,0x13,0x27,0x18,0x1D,0xC3,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC1,0x2D,0xAE,0x53,0x2C,0x05,0xE0,0xFE,0x7C,0x2B,0x04,0x0E,0x0B,0xC1,0x0E,
+0xC0,0x0B,0xC7,0x0E,0xC0,0x0B,0x31,0xAA,0x88,0x0B,0x04,0x0B,0xC2,0x0E,0xC0,0x0B,0xC0,0x93,0x89,0xFE,0x10,0xC1,0x17,0x05,0xC1,0x20,0x05,0xDD,0x39,0xC0,0x1D,0x1A,
+0x1D,0xC2,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC1,0x2D,0x24,0x89,0x9D,0x05,0xE0,0xFE,0x94,0xCD,0xB9,0x89,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0xC4,0x34,0x0B,
+0xC4,0x0E,0xC0,0x0B,0xC2,0xFE,0x5B,0x4A,0x08,0x05,0xC2,0x14,0x05,0xDC,0x16,0x27,0x93,0x9D,0x1D,0xC4,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC1,0xA7,0x77,0xA8,0x63,0x08,
+0x05,0xDF,0x2B,0xFE,0xAD,0x8E,0xB3,0x8A,0x0B,0x0E,0x0B,0x0E,0xC2,0x0B,0xC3,0x0E,0xC0,0x0B,0xC8,0x0E,0xC0,0x0B,0xC1,0x21,0x08,0x05,0xC3,0x20,0x05,0xDC,0xB8,0x73,
+0x39,0x18,0x6E,0xC4,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xC1,0x0D,0x14,0x05,0xE0,0xA9,0x85,0x3D,0x0B,0xC3,0x0E,0xC0,0x0B,0xC7,0x0E,0x95,0x7B,0x37,0xA4,0x66,0xAD,0x98,
+0x6B,0x0E,0x0B,0x0E,0x04,0x0B,0xC1,0x9A,0x99,0x13,0x90,0x7B,0x0A,0x05,0xC2,0xB1,0x93,0x08,0x05,0xDA,0xAC,0x87,0x24,0x90,0x8C,0x9D,0x9B,0x36,0x07,0x36,0x1D,0x1A,
+0x1D,0x98,0xEA,0xC4,0x26,0x2D,0xC0,0x26,0xC1,0x0D,0x92,0x79,0x17,0x9D,0x9A,0xDF,0x20,0xBD,0x84,0x04,0x0E,0xC1,0x0B,0xC1,0x0E,0xC0,0x0B,0xC4,0x8E,0x99,0x89,0x88,
+0x05,0xC1,0xBC,0x87,0xFE,0xEF,0xBB,0x0B,0x0E,0x0B,0xC3,0x16,0x84,0x89,0xC5,0x22,0x8F,0x8C,0x05,0xD9,0x2B,0x24,0x99,0x89,0x98,0x9E,0x41,0x07,0x61,0x26,0x69,0xC1,
+0x2D,0xC4,0x69,0x2D,0xC0,0x26,0xC0,0x13,0x24,0x08,0x05,0xE0,0xAE,0x85,0xA9,0x74,0xBC,0x8D,0x1B,0x0B,0x0E,0x0B,0x0E,0xC2,0x0B,0xC2,0x97,0x9A,0x29,0x08,0x05,0xC3,
+0x37,0x0B,0xC0,0x0E,0x0B,0xC1,0x11,0x05,0xC5,0x2B,0x22,0x0F,0x05,0xD9,0x13,0x27,0x18,0x9C,0xA9,0xC6,0x9D,0xC9,0xC4,0x26,0x2D,0xC0,0x26,0xC0,0xAC,0x44,0x14,0x05,
+0xE1,0xAF,0x84,0x20,0x98,0x9D,0xFE,0xD6,0xD7,0x12,0x0B,0x0E,0xC2,0x0B,0x67,0x0B,0xC0,0x93,0x89,0x36,0x05,0xC0,0x2B,0xA7,0x9A,0xA8,0x67,0x9D,0x99,0x95,0xA8,0x16,
+0xFE,0xEF,0xBB,0x0E,0x04,0x6B,0xC0,0x21,0x3A,0x9A,0x89,0xC5,0x2B,0x20,0x05,0xD9,0x3A,0x35,0x20,0x36,0x3D,0xC6,0x2D,0xC5,0x26,0x2D,0xC0,0x26,0xAE,0x54,0x2C,0x05,
+0xE1,0xB3,0x85,0xA1,0x56,0x90,0xAC,0x25,0xFE,0xD6,0xD7,0x12,0x0B,0xC2,0x0E,0xC0,0x0B,0x11,0x3A,0x05,0xAF,0x87,0x33,0x3D,0x12,0x0B,0x61,0x0C,0x33,0x04,0x3A,0x0B,
+0x0E,0x21,0xFE,0x18,0xE2,0x05,0xC6,0xA9,0x97,0x06,0x91,0x9C,0x05,0xD8,0xB8,0x73,0x39,0x98,0x9D,0x36,0x6B,0xC7,0x2D,0xC6,0x26,0x2D,0xC0,0x24,0x89,0x9D,0x05,0xE1,
+0x22,0x9C,0x58,0x9C,0x78,0x05,0x0F,0xFE,0xD6,0xD7,0x12,0x0B,0xC1,0x0E,0x0B,0x21,0x3A,0x0F,0x11,0x2A,0x0B,0xC0,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC0,0x21,0x3F,0x05,
+0xC7,0x3C,0x9C,0x7A,0x05,0xD8,0xAF,0x84,0xAE,0x74,0x93,0x9D,0x9C,0x9C,0xC9,0x2D,0xC4,0x26,0x2D,0xC0,0x26,0xA7,0x77,0xA8,0x63,0x08,0x05,0xE1,0x22,0x97,0x7B,0x10,
+0x05,0xC0,0x18,0xFE,0xD6,0xD7,0x12,0x0B,0xC1,0x95,0x8B,0x16,0x33,0xB2,0x86,0x12,0x7A,0x0E,0x59,0x9D,0x99,0x96,0x79,0x19,0x04,0x6B,0x0E,0x04,0x33,0x80,0x89,0x05,
+0xC8,0x13,0x3A,0x05,0xD7,0x3A,0x24,0x20,0x98,0x9E,0xCA,0x9D,0xC9,0xC5,0x26,0x2D,0xC0,0x24,0x94,0x8A,0x05,0xE1,0xA5,0x88,0x22,0x95,0x6A,0xA7,0x66,0x05,0xC1,0x36,
+0xFE,0xBE,0x54,0xAD,0x98,0x12,0x19,0x81,0x7A,0xB4,0xA8,0x12,0x0B,0x2B,0x21,0xC0,0x33,0xC0,0x19,0x12,0x15,0x0E,0x2A,0x30,0x81,0x9C,0x05,0xC9,0x13,0x05,0x0A,0x05,
+0xD5,0xA5,0x87,0xB2,0x75,0x7E,0x36,0xA2,0x78,0x36,0xA5,0x68,0x3D,0x41,0x07,0x36,0x3D,0xC3,0x2D,0xC4,0x69,0x2D,0xC0,0x26,0x0D,0x92,0x79,0x9A,0x8A,0x9D,0x9A,0xE0,
+0xAB,0x86,0x13,0x05,0x24,0x05,0xC2,0x16,0x37,0x0B,0x9D,0x98,0x19,0x0B,0xC0,0x0E,0xC0,0x19,0xC0,0x04,0x0B,0x0E,0x0B,0x0E,0x95,0x7B,0x80,0x97,0x05,0xCA,0xA6,0x87,
+0xA9,0x88,0x05,0xD7,0x22,0xA4,0x78,0x36,0xA2,0x78,0x36,0x1D,0x3D,0xC0,0x41,0x07,0x36,0x3D,0xC3,0x9D,0xC9,0x69,0x2D,0x26,0xC0,0x2D,0x26,0xC1,0x13,0x1E,0x08,0x05,
+0xE1,0x3C,0xC0,0x05,0xAF,0x44,0x93,0xCC,0x05,0xC2,0x3A,0x33,0x04,0x0B,0x0E,0xC2,0x0B,0x67,0x0B,0xC1,0x2B,0x33,0x3A,0x05,0xCB,0x3A,0x32,0x05,0xD6,0x13,0xAB,0x75,
+0x20,0x3D,0xC1,0x41,0x07,0x36,0x3D,0xC6,0x2D,0xC4,0x69,0x2D,0xC0,0xAC,0x43,0x22,0x05,0xE2,0x13,0x3A,0x05,0x2E,0x9B,0x88,0x0F,0x0A,0x05,0xC2,0xBC,0x87,0x19,0x04,
+0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x8F,0x98,0x29,0x05,0xE6,0xA9,0x85,0xAF,0x87,0x06,0x3D,0x41,0x07,0x61,0x3D,0xC6,0x26,0x07,0x36,0x2D,0xC4,0x69,0x2D,0xC0,0x24,
+0x90,0x8A,0x95,0x9D,0xE2,0x29,0x91,0x9A,0x05,0x2E,0xFE,0x3C,0x62,0x9C,0x9A,0x3E,0x9A,0x9A,0x37,0x98,0xCC,0xA2,0x77,0x32,0x18,0xBD,0xB7,0x0B,0xC1,0x0E,0xC0,0x93,
+0x79,0x8B,0x99,0x14,0x05,0xE6,0xA5,0x87,0x1E,0x9B,0x87,0x36,0x3D,0xC0,0x41,0x07,0x36,0x3D,0xC8,0x2D,0x69,0x2D,0x26,0xC2,0x2D,0x26,0xAF,0x52,0x1F,0x05,0xE2,0x29,
+0x08,0x05,0x10,0xFE,0x65,0xA7,0xA7,0x74,0x67,0x52,0x9C,0x88,0x50,0xC2,0x9B,0x9D,0xFE,0x5B,0xA9,0x21,0xA7,0x7A,0x21,0x00,0x05,0xC5,0x2B,0xA6,0x45,0x10,0x9D,0x99,
+0x99,0xBB,0x05,0xDD,0xB7,0x72,0xC0,0x3D,0x41,0x07,0x61,0x3D,0xC8,0x26,0x07,0x36,0x9D,0xCA,0x69,0x2D,0x26,0xC3,0xA7,0x66,0x04,0x08,0x05,0xE2,0x29,0x05,0xC0,0x2B,
+0xFE,0x55,0x25,0x18,0xC7,0x1A,0x0E,0x9E,0x9B,0xC0,0x89,0xBD,0x0F,0x05,0xC2,0x13,0xA6,0x87,0x13,0x10,0x37,0x10,0xA4,0x66,0x05,0xDC,0xB0,0x95,0xA8,0x66,0x36,0x07,
+0x36,0x1D,0x3D,0xC1,0x41,0x07,0x36,0x3D,0xC6,0x2D,0xC4,0x69,0x2D,0x1E,0x98,0x97,0x8F,0x9E,0x05,0xDA,0x2B,0x19,0x32,0x37,0x06,0x9C,0x99,0x9B,0xBB,0x3A,0xAA,0x95,
+0x05,0xC1,0xFE,0x3C,0x62,0xB1,0x75,0x18,0xC5,0x0E,0x9E,0x9B,0x1A,0x18,0xC0,0x8A,0x9E,0x19,0x05,0xC0,0x24,0x3B,0xAE,0x65,0x25,0x88,0xAF,0x0F,0x05,0xC0,0xA7,0x78,
+0xA8,0x64,0x0F,0x05,0xD9,0x3A,0xB5,0x83,0x94,0x8D,0x36,0x3D,0xC0,0x41,0x07,0x36,0x3D,0xCA,0x2D,0x69,0x2D,0x13,0xC1,0x7B,0xC0,0xAA,0x74,0x8F,0x7B,0x97,0x9C,0xD9,
+0x37,0xAD,0x53,0xAD,0x52,0xA3,0x8A,0xC2,0x3B,0x97,0xAC,0x9E,0xAC,0xA1,0xA8,0x06,0x97,0xCC,0x66,0xBD,0x20,0x1F,0x18,0xC5,0xFE,0x3B,0xE5,0x9E,0xFF,0xAA,0x10,0x18,
+0xC0,0x0E,0xFE,0x01,0x60,0x06,0xAE,0x41,0xB3,0x64,0x18,0x1A,0x18,0x97,0x9A,0x37,0x0F,0x66,0x66,0x10,0xA4,0x66,0x0F,0x05,0xD8,0xB7,0x74,0x9C,0x98,0x3D,0xCC,0x41,
+0xA4,0x87,0x36,0x3D,0xC0,0xA0,0xB8,0xC0,0xA4,0x65,0xC4,0xAB,0x75,0x89,0x9D,0x05,0xD8,0x10,0x12,0xB1,0x75,0x18,0xC1,0x1A,0x18,0xC0,0x39,0x8A,0xCE,0x10,0x2E,0x31,
+0x9C,0x78,0xB3,0x53,0x1A,0x18,0xC2,0x1A,0x18,0xC0,0xFE,0x4C,0x07,0x16,0x9D,0x77,0x0D,0x18,0xC0,0xFE,0x1B,0x41,0xA9,0x85,0x1F,0x18,0xC2,0x1A,0x3B,0x19,0x05,0xC1,
+0xAF,0x33,0x99,0xBB,0x0A,0x05,0xD6,0xA9,0x97,0x27,0x92,0x9F,0x36,0x3D,0xC1,0x26,0x07,0x36,0x3D,0xCA,0xA4,0xA6,0xC0,0x59,0xC3,0xA5,0x77,0x22,0x05,0xD9,0xFE,0x3B,
+0xE5,0x1A,0x18,0xC6,0x39,0xFE,0x01,0x60,0x98,0xCC,0x0A,0x10,0xAC,0x43,0xB5,0x51,0x18,0xC2,0x1A,0x18,0xC0,0x39,0xFE,0x5B,0xA9,0xA0,0xAA,0xFE,0x65,0xA7,0x18,0xC0,
+0x12,0x1F,0x18,0xC3,0x1A,0x2C,0xFE,0x0A,0x00,0x0F,0x62,0xC0,0x32,0xAA,0x54,0x0F,0x05,0xD6,0xB5,0x84,0x22,0x3D,0x26,0x07,0x61,0x3D,0xCA,0x36,0x07,0x2D,0x69,0x1D,
+0xC0,0x59,0xC3,0xAB,0x75,0x20,0x05,0xD8,0xAA,0x64,0xFE,0x65,0xA7,0x18,0xC3,0x1A,0x18,0xC2,0x12,0x28,0x0F,0x0A,0x05,0xAF,0x21,0x12,0x1F,0x18,0xC3,0x0D,0xFE,0x43,
+0xE6,0x9E,0xEE,0xFE,0x6D,0x69,0x18,0xC1,0x0E,0x18,0xC5,0x3B,0xFE,0x00,0xA0,0x9C,0xAA,0xC1,0x10,0xA4,0x66,0x0F,0x05,0xD4,0xAB,0x86,0xAD,0x86,0x98,0x89,0x9C,0x9C,
+0xC0,0x41,0xA4,0x87,0x61,0x3D,0xC5,0x9D,0xA8,0xA0,0xA8,0xA0,0xA6,0xA0,0xA9,0x9E,0xB6,0xA2,0xA7,0xA1,0xB8,0x7B,0xFE,0x4A,0x25,0xC5,0x27,0x8E,0x9E,0x05,0xD8,0x31,
+0x0D,0x18,0xC2,0x1A,0x18,0xC4,0x3B,0x19,0x05,0xC1,0xA5,0x87,0xB9,0x10,0x1A,0x18,0xC3,0x0E,0x39,0xAA,0x97,0x18,0xC1,0x94,0x8B,0x2C,0x18,0xC4,0x99,0x9B,0x37,0x98,
+0xCC,0x0A,0x05,0x0F,0x0C,0x91,0xCC,0x05,0xD4,0xB7,0x74,0x9D,0x97,0x36,0x6B,0xC1,0x41,0xA4,0x87,0x36,0x26,0x3D,0x1E,0xA0,0xA9,0x12,0xA3,0x99,0x74,0x33,0xA1,0xA9,
+0xC1,0x56,0x05,0xC0,0xFE,0x52,0x26,0xC0,0x59,0xC3,0xAB,0x75,0x89,0x9D,0x9C,0x8A,0xD8,0x0C,0x0D,0x18,0xC9,0x0D,0x3E,0x0A,0x05,0xC1,0x2E,0xFE,0x3C,0x62,0x2C,0x18,
+0xC8,0x0E,0x15,0x0D,0x18,0xC4,0xFE,0x23,0x03,0x05,0xC2,0x10,0xA4,0x66,0x0F,0x05,0xD2,0x32,0xB6,0x82,0x36,0x07,0x9D,0x97,0x73,0xA0,0xA8,0x2B,0x70,0x79,0x35,0xA0,
+0xB7,0x7A,0x61,0xC1,0xA3,0x98,0xC0,0x3D,0xA2,0x87,0x05,0xC0,0x3D,0x0A,0x1D,0xC0,0x13,0xC2,0xA5,0x77,0x04,0x88,0x9F,0x5A,0xC0,0x6B,0x05,0xD5,0xB5,0x20,0x1A,0x18,
+0xC3,0x1A,0x18,0xC4,0x0E,0xFE,0x01,0x60,0x97,0xDD,0x05,0xC0,0x32,0xFE,0x54,0xE7,0xA4,0x62,0xC0,0x1A,0x18,0xC6,0x0E,0x37,0xAE,0x65,0xB7,0x62,0x18,0xC3,0x0E,0xFE,
+0x00,0xA0,0x05,0xC2,0x31,0x98,0x89,0x0F,0x66,0x05,0xD0,0xAB,0x86,0xAC,0x96,0xFE,0x61,0x01,0x35,0xA0,0xB7,0x33,0x3D,0x7E,0xC0,0x29,0xC5,0x05,0xC1,0x6E,0x05,0xC1,
+0x29,0x1D,0xC0,0x59,0xC2,0x04,0x9C,0x79,0x8C,0x9E,0xD9,0xB7,0x10,0x1A,0x18,0xCB,0x8A,0x9E,0xFE,0x00,0xA0,0x05,0xC1,0xFE,0x43,0xE6,0xFE,0x76,0x87,0x9D,0x9A,0x97,
+0x89,0xA9,0x97,0x18,0xC1,0x1A,0x18,0xC1,0x8F,0xAD,0x0F,0x05,0x15,0x0D,0x18,0xC2,0x99,0x9B,0xFE,0x01,0x60,0x0F,0x66,0x05,0x0F,0xA6,0x66,0xA7,0x66,0x0F,0x05,0xD1,
+0x36,0xFE,0x8A,0x21,0x3A,0x61,0xC9,0x7E,0xA2,0x88,0xC0,0x6E,0xC0,0x05,0xC0,0x0A,0x05,0xC0,0xFE,0x52,0x26,0xC0,0x13,0xC2,0xAA,0x85,0x91,0x7C,0x95,0x9B,0xD9,0xB7,
+0x10,0x0D,0x18,0xCB,0x2C,0xFE,0x0A,0x00,0x92,0xEF,0x05,0xC0,0xB3,0x33,0x0D,0x18,0xC0,0x39,0x2C,0x18,0xC4,0x19,0x05,0xC1,0xB8,0x10,0xB7,0x62,0x18,0xC1,0x0D,0x84,
+0xAF,0xFE,0x00,0x60,0x05,0xC2,0x2E,0x9B,0x88,0x05,0xD1,0xB7,0x94,0xFE,0x89,0x40,0x33,0x9D,0xAA,0x29,0xC3,0x31,0x24,0x29,0xC1,0xA3,0x98,0xC0,0x6E,0xC1,0x05,0xC0,
+0x0A,0x29,0xC0,0x1D,0xC0,0x59,0xC2,0x22,0x8D,0x7B,0x0F,0x62,0xD8,0x0C,0x06,0x18,0xCC,0x3B,0xFE,0x00,0xA0,0x05,0xC0,0x10,0xFE,0x65,0xA7,0x18,0xC1,0x35,0xA5,0x98,
+0x18,0x1A,0x18,0xC0,0x99,0x9C,0xFE,0x09,0x81,0x0F,0x66,0x05,0xC0,0x28,0x36,0x18,0xC1,0x8A,0x9E,0x19,0x05,0xC2,0x10,0xA4,0x54,0x0F,0x05,0xD0,0x0D,0xFE,0x89,0x40,
+0xA0,0xC8,0xA2,0x88,0x9D,0x89,0xC0,0x05,0x29,0xC2,0x05,0xC0,0x3D,0xA2,0x87,0xC0,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x29,0xC0,0xFE,0x4A,0x25,0xC3,0xA5,0x77,0xA6,0x84,
+0xFE,0x08,0x20,0x5A,0xD9,0xAF,0x54,0xFE,0x6E,0x27,0x18,0xC1,0x1A,0x18,0xC8,0x2C,0xFE,0x0A,0x00,0x92,0xEF,0x05,0x32,0x1C,0x18,0xC2,0x99,0x9B,0x99,0x99,0x0D,0x18,
+0xC0,0x3B,0x19,0x05,0xC3,0xB5,0x20,0xB5,0x75,0x18,0xC0,0x12,0x0F,0x05,0xC3,0x2E,0x37,0x05,0xD0,0x1D,0xA0,0xF3,0x3A,0xA2,0x97,0x66,0x29,0xC0,0x05,0x29,0xA2,0x88,
+0x29,0xC0,0x05,0x0A,0x05,0xC0,0x0A,0xC1,0x05,0xC0,0x0A,0x29,0xC0,0xFE,0x4A,0x25,0xC3,0x04,0x9C,0x79,0x8C,0x9E,0xDA,0x10,0xFE,0x65,0xA7,0x18,0xCD,0x3B,0xFE,0x00,
+0x60,0x05,0xC0,0xBF,0x20,0x18,0xC4,0x35,0xA3,0x97,0x39,0x37,0x0F,0x66,0x05,0x0F,0x05,0xC1,0x10,0x1C,0x18,0x0E,0x37,0x0A,0x05,0xC2,0x10,0xA4,0x66,0x0F,0x05,0xCF,
+0xAB,0x86,0xA9,0xF5,0x3D,0x7E,0xC1,0x3D,0xA2,0x87,0x29,0xC3,0x05,0xC0,0x3D,0x0A,0xC1,0x05,0xC0,0x0A,0xC1,0x13,0xC3,0xAB,0x75,0x99,0x89,0x8C,0x9E,0xDA,0xA8,0x55,
+0x0E,0x18,0xCD,0x0E,0xFE,0x01,0x00,0x0F,0x66,0x2C,0x18,0xC2,0x1A,0x18,0xC0,0x25,0x91,0x9C,0xFE,0x01,0x60,0x0F,0x0A,0x05,0x0F,0x05,0xC2,0x10,0x12,0x39,0x37,0x0F,
+0x0A,0x05,0x0F,0x05,0xC0,0x0C,0x28,0x0F,0x0A,0x05,0xCE,0xB7,0x94,0xFE,0x8A,0x21,0x3A,0xA2,0x97,0x9C,0x89,0xC0,0xA3,0x98,0x29,0x3D,0x29,0xC3,0x05,0xC2,0x3D,0x0A,
+0xC1,0x29,0x13,0x1D,0xC0,0x13,0xC0,0x27,0x8C,0x9D,0x9A,0x8A,0x9D,0x9A,0xD9,0x28,0x39,0x18,0xC1,0x1A,0x18,0xCA,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xFE,0x43,0xE6,0x1F,
+0x18,0xC6,0x0E,0x3E,0xFE,0x00,0x40,0x05,0xC5,0x32,0xB2,0x10,0x06,0x0F,0x0A,0x05,0xC2,0x10,0x13,0x0F,0x05,0xCF,0xB0,0x74,0x35,0x3D,0x29,0xC0,0xA3,0x98,0x6E,0x05,
+0xC0,0x3D,0x0A,0x29,0xC4,0x7E,0xC0,0x05,0x29,0x05,0xC0,0xFE,0x4A,0x25,0xC3,0x16,0xFE,0x08,0x20,0x5A,0xDB,0xFE,0x3B,0xE5,0x1A,0x18,0xCD,0x15,0x0F,0x05,0x1D,0x1F,
+0x18,0xC7,0x9D,0x9B,0x12,0xFE,0x02,0x00,0x92,0xFF,0x05,0xC4,0xA5,0x87,0xAA,0x55,0x28,0x05,0xC4,0x31,0x28,0x05,0xCF,0x2B,0xB4,0x85,0xFE,0x8A,0x21,0x3A,0x29,0xA3,
+0x98,0xC0,0x3D,0xA2,0x87,0xC1,0x29,0x7E,0x05,0x29,0x05,0x31,0x05,0x0A,0x05,0xC0,0x0A,0x29,0xFE,0x4A,0x25,0xC2,0xA8,0x66,0x04,0x88,0x8F,0xDC,0x19,0x1A,0x18,0xCD,
+0x12,0xFE,0x00,0xA0,0x05,0x1D,0x1F,0x18,0xC9,0x97,0x9A,0xFE,0x22,0xC2,0x19,0x05,0xC4,0x2B,0xAA,0x55,0x28,0x9B,0xBB,0x66,0x05,0xC1,0x2E,0x9C,0x88,0x0F,0x0A,0x05,
+0xCE,0xA9,0x97,0x27,0xFE,0x81,0x62,0xA0,0xB7,0x9F,0xB8,0x29,0xC0,0xA3,0x98,0xC1,0x29,0xC0,0x05,0x29,0x3D,0x29,0x05,0xC0,0x6E,0xC1,0x29,0x13,0xC2,0x04,0x20,0x8C,
+0x9E,0xDC,0xAF,0x54,0x0D,0x18,0xCC,0x25,0x99,0x99,0x19,0x05,0xB8,0x10,0x1F,0x18,0xCB,0x12,0x10,0x92,0xFF,0x05,0xC3,0xA8,0x55,0xA7,0x66,0x0F,0x05,0xC2,0xAB,0x55,
+0x0C,0x0F,0x05,0xD0,0xB0,0x74,0x22,0xFE,0x89,0x40,0x33,0x9D,0xAA,0x29,0xC3,0x7E,0x24,0x29,0xC0,0xA3,0x98,0xC1,0x6E,0x05,0xC0,0x0A,0x13,0xC2,0x22,0x97,0x89,0x8F,
+0x9E,0x5A,0xDB,0xAA,0x64,0xFE,0x55,0x63,0x18,0xCC,0x9D,0x9A,0x8D,0x9C,0x19,0x05,0x28,0x1F,0x18,0xCC,0x99,0x9B,0x91,0x9C,0xFE,0x01,0x00,0x0F,0x66,0x05,0xC1,0x37,
+0xA7,0x66,0x0F,0x05,0xC2,0x2E,0x9B,0x88,0x0F,0x0A,0x05,0x0F,0x05,0xCD,0x13,0xA9,0xB5,0xFE,0xA1,0x20,0xA3,0x98,0xC0,0x3D,0xA2,0x87,0x29,0xC4,0x05,0xC1,0x0A,0xC1,
+0x05,0x13,0xC2,0xAA,0x85,0x91,0x7A,0x95,0x9D,0xDC,0x2B,0xFE,0x3C,0x62,0x1F,0x18,0xCC,0x3B,0x19,0x05,0xFE,0x3B,0xE5,0x1A,0x18,0xCE,0x12,0x28,0x05,0xC3,0x10,0x24,
+0x0F,0x05,0xC1,0x10,0x24,0x0F,0x05,0xD1,0xB7,0x94,0xFE,0x8A,0x21,0x3A,0x0A,0x66,0xC0,0x29,0x66,0x29,0xC2,0x05,0xC1,0x0A,0xC0,0x05,0xC0,0xFE,0x52,0x26,0xC1,0xA5,
+0x66,0x38,0x85,0xBF,0x9C,0x8A,0xDD,0xB8,0x10,0xB7,0x62,0x18,0xCC,0x25,0xFE,0x09,0x81,0x97,0xCC,0x2C,0x18,0xD0,0x0E,0xFE,0x12,0x02,0x05,0xC3,0x24,0x99,0xBB,0x05,
+0xC2,0x0C,0x94,0xAA,0xC2,0x9A,0xBB,0x05,0xCD,0xAB,0x86,0xAE,0xA3,0xFE,0xA1,0xC1,0x9E,0xB9,0xC0,0x3D,0x29,0xC3,0x31,0x52,0x05,0xC0,0x3D,0xA2,0x87,0xC1,0x1D,0xC0,
+0x59,0xA8,0x66,0x04,0x88,0x8F,0xDE,0x2E,0xFE,0x5D,0xA6,0x18,0xCD,0x3E,0x37,0xFE,0x6D,0x69,0x18,0xD0,0x1A,0x98,0x88,0xFE,0x02,0x00,0x92,0xFF,0x05,0xC1,0xAB,0x55,
+0xA4,0x54,0x93,0xEF,0x37,0x06,0xA4,0x77,0x0C,0x2E,0x7A,0xA0,0x45,0x2E,0x31,0x0F,0x05,0xCD,0x0D,0xFE,0x8A,0x21,0x29,0xC0,0xA3,0x98,0x29,0xA2,0x88,0x29,0x05,0xC0,
+0x29,0xC0,0x05,0x6E,0x05,0x0A,0x05,0xC0,0x1D,0xC0,0x59,0x1E,0x9E,0x75,0xFE,0x00,0x20,0xDE,0x37,0xFE,0x54,0xE7,0x18,0xC1,0x1A,0x18,0xC9,0x3B,0x0C,0xFE,0x6E,0x27,
+0x18,0xD2,0x3B,0xFE,0x00,0xA0,0x05,0xC2,0x0C,0x9C,0x76,0x9C,0xBC,0x37,0x10,0x06,0x28,0x9B,0xBB,0x05,0xC0,0x10,0x24,0x0F,0x05,0xCC,0x36,0xFE,0x8A,0x21,0xFE,0xB1,
+0x81,0xC0,0x29,0x66,0x29,0xC0,0x05,0x0A,0x05,0x29,0xC0,0x05,0xC1,0x0A,0xC0,0x1D,0xC0,0x59,0xA8,0x66,0x9B,0x97,0x8D,0x9F,0xDE,0x2B,0xB9,0x10,0x1A,0x18,0xCC,0x94,
+0x8B,0x12,0x18,0xD3,0x35,0x28,0x9B,0xBB,0x66,0x05,0xC0,0x0C,0x06,0x0F,0x0A,0x05,0x37,0x06,0x10,0xA4,0x66,0xC0,0x10,0x24,0x0F,0x05,0xCC,0x36,0x9F,0xF7,0x3D,0xA2,
+0x87,0x66,0xC0,0x29,0xC0,0x05,0xC0,0x29,0x3D,0x05,0xC2,0x0A,0xC0,0x1D,0xC0,0x59,0x27,0x92,0x9A,0x91,0x9F,0xDF,0x0C,0x0D,0x18,0xCC,0x99,0x9C,0x0E,0x18,0xD3,0x8F,
+0xAD,0x0F,0x05,0xC1,0x2B,0x31,0x0F,0x05,0xC5,0x19,0xAB,0x75,0x10,0x9E,0xAB,0x05,0xCC,0x36,0xA4,0xA5,0x09,0x0A,0x66,0xC0,0x29,0xC0,0x3D,0x29,0xC1,0x05,0x29,0x3D,
+0x0A,0x05,0xC0,0x1D,0xC0,0x13,0xAE,0x63,0x8B,0x9D,0x9A,0x8A,0x9D,0x9A,0xDE,0x10,0x0E,0x18,0xCD,0x12,0xB1,0x75,0x18,0xD2,0x15,0xFE,0x00,0x60,0x05,0xC1,0x2E,0x9B,
+0x88,0x05,0xC1,0x10,0x77,0x2E,0x31,0x10,0x24,0xC0,0xA6,0x75,0x07,0x05,0xCC,0xB5,0x84,0x35,0xFE,0xB1,0x81,0xC0,0x0A,0xC1,0x29,0xC3,0x05,0xC0,0x3D,0x0A,0x29,0xC0,
+0x13,0xC0,0x36,0x38,0x85,0xBF,0x9C,0x8A,0xDF,0x2B,0xB9,0x10,0x1A,0x18,0xCC,0x12,0xB1,0x75,0x18,0xD1,0x9D,0x9A,0xFE,0x0A,0x00,0x0F,0x05,0xC0,0x10,0x9D,0x99,0x05,
+0xC5,0x2B,0x6B,0x37,0x24,0x08,0x07,0x05,0xCC,0x04,0xFE,0x8A,0x21,0x3A,0x0A,0x66,0x0A,0x05,0xC0,0x29,0xC0,0x3D,0xC0,0x29,0xC0,0x3D,0x05,0xC1,0xFE,0x4A,0x25,0xC0,
+0xAB,0x75,0x68,0xFE,0x08,0x20,0x5A,0xE0,0xB5,0x20,0x1A,0x18,0xCC,0x97,0x9A,0xC0,0x1A,0x18,0xD0,0x0E,0xFE,0x01,0x60,0x97,0xDD,0x05,0x15,0x10,0x0A,0x05,0xC3,0xA8,
+0x55,0x15,0x10,0xC0,0x37,0x10,0x59,0x55,0x98,0xCC,0x0A,0x05,0x0F,0x05,0xC7,0x2B,0x22,0xFE,0x99,0x61,0xA2,0xA7,0x66,0xC0,0x0A,0xC1,0x3D,0x29,0xC0,0x3D,0xC0,0x29,
+0xC0,0x3D,0xC0,0x0A,0x13,0xC0,0x24,0x16,0xFE,0x00,0x20,0xE1,0x10,0x0E,0x18,0xC1,0x1A,0x18,0xC8,0x0D,0x12,0x1F,0x18,0xD0,0x8A,0x9E,0x19,0x05,0x10,0xA4,0x66,0x0F,
+0x05,0xC4,0x17,0x32,0xA3,0x66,0x2B,0x17,0x32,0x31,0x2E,0x0F,0x05,0xCA,0x3C,0xAB,0xA4,0x09,0x0A,0xC0,0x66,0xC0,0x0A,0xC1,0x3D,0x51,0xC0,0x05,0x0A,0x05,0x29,0x05,
+0xC0,0x13,0xC0,0xAB,0x75,0x9C,0x78,0x89,0xBF,0x5A,0xE1,0xFE,0x3B,0xE5,0x1A,0x18,0xCC,0x12,0x1F,0x18,0xC8,0x1A,0x2C,0x0D,0xC0,0x25,0x2C,0x25,0x0E,0xFE,0x0A,0x00,
+0x10,0x2E,0x0C,0x06,0x2B,0x17,0x05,0xC9,0xA6,0x87,0xA9,0x34,0x10,0x96,0xBB,0x05,0xC9,0xB8,0x73,0x35,0x3D,0xA2,0x87,0xC0,0x66,0xC0,0x0A,0xC1,0x3D,0x05,0xC0,0x3D,
+0x0A,0x29,0xC0,0x05,0xC0,0xFE,0x4A,0x25,0xC0,0x1E,0x9E,0x75,0xFE,0x00,0x20,0xE2,0x2E,0x2C,0x18,0xCC,0x97,0x9A,0x0E,0x0D,0xC0,0x2C,0x25,0x0E,0xC0,0x9E,0x9B,0x9F,
+0x74,0x9D,0x9A,0x24,0x12,0x24,0x12,0x24,0xA2,0x78,0x3B,0x3E,0x9A,0x9A,0x10,0x06,0x10,0xA4,0x66,0x0C,0x2E,0x31,0x2E,0x31,0xA0,0x45,0x06,0x28,0x9B,0xBB,0xA9,0x66,
+0x37,0x10,0x2E,0x31,0xA0,0x45,0x19,0xA7,0x77,0x37,0x05,0xC8,0xA9,0x97,0x27,0xFE,0x99,0x61,0xA2,0xA7,0xC0,0x66,0xC0,0x0A,0xC1,0x3D,0x05,0x0A,0x05,0xC0,0x0A,0xC1,
+0x3D,0x05,0xFE,0x4A,0x25,0xC0,0xAB,0x75,0x14,0x8D,0x9F,0xE2,0x2B,0xFE,0x44,0xC5,0x18,0xCC,0x25,0x91,0x9C,0xAD,0x84,0xC1,0x2C,0x18,0x9D,0x9A,0x18,0x06,0x18,0xC6,
+0xFE,0x0A,0x00,0x0F,0x05,0xC7,0xA8,0x55,0xA7,0x66,0x13,0xA5,0x66,0x28,0x0F,0x66,0xA4,0x88,0x31,0x2E,0x15,0x2E,0x9C,0x88,0x0F,0x0A,0x05,0xC6,0xB8,0x73,0x1C,0xFE,
+0xA1,0x20,0xA4,0x87,0x66,0xC0,0x0A,0x29,0x05,0xC0,0x0A,0xC1,0x05,0x0A,0x05,0xC0,0x0A,0xC1,0xBB,0x67,0x6E,0x9C,0x88,0x9D,0x99,0x9C,0x88,0x9A,0x99,0xA2,0x98,0xA5,
+0x67,0x00,0xC0,0x01,0xF6,0x93,0xA9,0x3C,0x01,0xDE,0x19,0x3D,0x40,0x3D,0x26,0xC0,0x07,0x00,0xC0,0x3C,0x01,0x3C,0x01,0xC7,0x9D,0x99,0x00,0xC0,0x9D,0x99,0x07,0x26,
+0xC0,0x18,0x1D,0x00,0x28,0xA2,0x78,0x01,0xC8,0x19,0xC0,0x00,0x18,0x3D,0x26,0xC0,0x18,0x19,0x00,0x18,0x9C,0xA8,0x26,0x07,0x1D,0x00,0x28,0xC0,0x39,0x3C,0x01,0xDB,
+0x07,0x39,0x01,0xDA,0x3C,0xC0,0x39,0x00,0xC0,0x27,0x07,0x26,0xC0,0x18,0xC0,0x27,0x00,0x19,0x28,0x39,0x3C,0x01,0xD4,0x07,0x3C,0x01,0xD7,0x18,0x01,0xC3,0x69,0xC1,
+0x6C,0xC1,0x9F,0xB7,0x9D,0x8A,0x54,0x9C,0x9B,0x69,0xC1,0x0F,0xA3,0x98,0xA2,0x77,0xC7,0x31,0xC0,0x3A,0xC0,0x3C,0x01,0xC4,0x00,0xC0,0x01,0xD6,0x19,0x3D,0x1F,0x01,
+0xC8,0x3A,0xC0,0x31,0x35,0xC1,0x39,0xC1,0x9D,0x99,0x65,0x9C,0x8A,0xC0,0x9C,0x8A,0xA4,0x84,0x20,0x50,0x53,0xC1,0xA4,0x85,0x2C,0x20,0x12,0x2C,0x3A,0xC0,0xA5,0x87,
+0x14,0x39,0xC0,0xA4,0x96,0xA2,0x78,0x35,0xC1,0x31,0x9F,0x9B,0xC0,0x3C,0xC0,0x18,0x3C,0x01,0xC8,0xA1,0xA6,0x65,0x24,0x0F,0x22,0x14,0x9C,0x8A,0x12,0x9C,0x89,0x9D,
+0x9A,0x9C,0x8A,0xC1,0x6E,0x05,0xD4,0xA5,0x87,0xA4,0x86,0x3A,0xA7,0x85,0x0F,0xA3,0x98,0x35,0x9A,0x8A,0x99,0x99,0x9E,0x8B,0x3C,0x5A,0x01,0xC3,0x3E,0x32,0x51,0x22,
+0x9B,0x9A,0x97,0x8B,0x9D,0x88,0x62,0xE4,0x31,0x3C,0xA9,0x74,0x24,0x9D,0x8A,0xA4,0x68,0xC0,0x9E,0x9C,0x01,0xC3,0x1E,0x22,0x96,0x89,0x9A,0x8A,0x9D,0x9A,0xEB,0xA5,
+0x87,0x06,0x0F,0xA3,0x98,0x35,0x9E,0x7C,0xC0,0x3C,0xC0,0x01,0xCB,0x19,0x3D,0xC0,0x01,0xC1,0x8C,0xA6,0x05,0xF0,0x7F,0xA8,0x74,0x32,0x24,0x35,0x3E,0x3C,0x01,0xCB,
+0x8F,0xAA,0x3D,0x1D,0x01,0xC0,0x3E,0x17,0x9D,0x9A,0xF3,0xA6,0x87,0xAD,0x83,0x24,0x35,0x3E,0x3C,0x01,0xC4,0x69,0x01,0xC0,0x19,0x3D,0x40,0x1D,0xC0,0x01,0xC0,0x9C,
+0x95,0x8B,0x9C,0x05,0xF5,0xA5,0x87,0x06,0x24,0x35,0x3A,0xC0,0x3C,0xC0,0x01,0xC2,0x19,0x3D,0x1F,0x1D,0xC1,0x01,0xC0,0x22,0x05,0xF8,0xA6,0x87,0x14,0x27,0x35,0x9E,
+0x7C,0xC0,0x3C,0xC0,0x01,0x19,0x26,0xA5,0x78,0x1D,0xC2,0x01,0xC0,0x06,0x05,0xFA,0x31,0x20,0xAB,0x76,0x9E,0x9B,0x3A,0xC0,0x19,0x26,0xA4,0x87,0xA3,0x89,0x1D,0xC2,
+0x01,0x3E,0x12,0x05,0xFC,0xAB,0x86,0xAD,0x86,0xA3,0x98,0x35,0x1F,0x07,0x1D,0xC4,0x01,0x3E,0x12,0x05,0xC0,0x0A,0x05,0xFB,0x06,0xAD,0x84,0x0F,0x9B,0x69,0x1D,0xC0,
+0x5A,0x1D,0xC1,0x01,0x1E,0x8B,0x9B,0x05,0xFD,0xC1,0x3F,0xB0,0x73,0x27,0x97,0x9B,0x1D,0xC3,0xA9,0x99,0x9D,0x95,0x8B,0x9C,0x05,0xFD,0xC3,0xAF,0x84,0x24,0x9D,0x8A,
+0x1A,0x1D,0xC1,0x01,0x22,0x05,0xC0,0x0A,0x05,0xFD,0xC2,0x31,0x0F,0x2B,0x19,0x1D,0x1A,0xAA,0x97,0x06,0x05,0xC1,0x0A,0x05,0xFD,0xC2,0xA5,0x87,0xB0,0x85,0x16,0x20,
+0x1D,0x01,0xC2,0x90,0xA7,0x05,0xFD,0xC8,0x06,0x27,0x39,0x1A,0x1D,0xC6,0x01,0xC1,0x3E,0x17,0x05,0xFD,0xC9,0x20,0x0F,0x39,0x1A,0x1D,0xC5,0x01,0xC1,0x07,0x8B,0x9C,
+0x05,0xFD,0xCA,0x20,0x27,0x9B,0x9C,0x1D,0xC5,0x01,0xC1,0x22,0x05,0xC0,0x0A,0x05,0xFD,0xC9,0x20,0x0F,0x39,0x1A,0x1D,0xC3,0x01,0xC0,0x3E,0x12,0x05,0xFD,0xCD,0x20,
+0x0F,0x39,0x1A,0x9D,0xB9,0x1D,0xC1,0x01,0xC0,0x1E,0x1F,0x05,0xD7,0xAE,0x85,0x97,0x8B,0x05,0xF1,0x20,0x0F,0x39,0x1A,0x1D,0xC1,0x01,0xC0,0x22,0x05,0xD8,0xBF,0x82,
+0xA6,0x89,0x3C,0x05,0xF1,0x20,0x27,0x9A,0x89,0x1D,0xC1,0x01,0x3E,0x2C,0x05,0xD8,0xBC,0x75,0xBF,0x96,0x95,0x87,0x88,0x8A,0x1F,0x9C,0x8A,0xF0,0xAF,0x84,0x24,0x99,
+0x89,0x1D,0xC0,0x01,0xA0,0xA4,0x1F,0x05,0xD8,0x36,0xFE,0xEF,0x98,0xA3,0x99,0x98,0x77,0x0C,0x88,0x8B,0x05,0xF0,0x20,0x38,0x06,0x07,0x01,0xC2,0x66,0x9D,0x95,0x05,
+0xD9,0x29,0x2B,0x0E,0x5A,0x9C,0x86,0x8A,0x89,0x12,0x05,0xF0,0x0F,0x39,0x18,0x1D,0xCA,0x26,0x69,0x01,0xC2,0x3E,0x3A,0x05,0xD9,0xB0,0x95,0xFE,0xE7,0x38,0x0B,0xC1,
+0x2B,0x8D,0x87,0x2C,0x05,0xC2,0x31,0xA2,0x9A,0x05,0xE9,0x3F,0x27,0x20,0x1A,0x1D,0xC6,0x3D,0x26,0xC0,0x3D,0xA4,0x88,0x01,0xC1,0x3C,0xA2,0x74,0x8B,0xBA,0x05,0xD9,
+0xAE,0x85,0x19,0x0B,0xC2,0x61,0x8F,0x86,0x20,0x17,0x05,0xC0,0xA5,0x87,0x1E,0x22,0x17,0x05,0xE8,0xAF,0x84,0x24,0x20,0x1D,0xC4,0x26,0x55,0x26,0xA2,0x98,0xA8,0x67,
+0x25,0xC0,0x01,0xC0,0x66,0x01,0x0F,0x05,0xDA,0x06,0x34,0x0E,0xC2,0x0B,0xC0,0x8F,0xA8,0x86,0x79,0x05,0xC1,0x06,0xBD,0xA7,0x90,0x68,0x87,0xAC,0x05,0xE8,0x36,0xA6,
+0x84,0x18,0x7F,0x1D,0xC0,0x26,0x17,0x3D,0x25,0xC4,0x01,0xC1,0x66,0x13,0x05,0xC0,0x0A,0x05,0xD7,0x13,0x34,0x0E,0x0B,0xC3,0x61,0x8F,0x86,0x06,0x05,0xC0,0x7F,0xFE,
+0x94,0xCD,0x15,0x86,0x8A,0x89,0x9A,0x9A,0x8A,0x9D,0x9A,0xE6,0x2B,0x1E,0x9D,0x85,0x98,0x8F,0x9C,0x88,0xC0,0x10,0x25,0xC6,0x3C,0xC1,0x3E,0x31,0x05,0xDA,0x13,0x34,
+0x0E,0xC6,0x3D,0x06,0x05,0xC0,0x29,0xFE,0xEF,0x98,0x15,0x86,0x8A,0x89,0x9A,0x17,0x9D,0x9A,0xC0,0x17,0x05,0xE3,0xAE,0x85,0x24,0x90,0x8C,0xA2,0x8A,0x25,0xC8,0x01,
+0xC0,0x69,0x9C,0x96,0x8B,0x9C,0x05,0xDA,0xB3,0x84,0x19,0x0B,0xC0,0x0E,0xC0,0x0B,0xC1,0x0E,0x51,0x3D,0x06,0x90,0xAC,0x3F,0xFE,0xBD,0xD1,0x0E,0x2B,0x87,0x99,0x31,
+0x05,0xE7,0xB5,0x84,0x16,0x25,0xC9,0x01,0xC0,0x69,0x98,0xA4,0x05,0xDB,0xB3,0x84,0x15,0x0E,0x0B,0xC0,0x0E,0x0B,0x61,0x0E,0xC0,0x0B,0x3A,0x88,0x77,0x31,0x05,0x1F,
+0x3A,0x0E,0x2B,0x87,0x99,0x31,0x05,0xE6,0xA6,0x87,0x24,0x9D,0x8A,0x25,0xC8,0x01,0xC0,0xA1,0x85,0x12,0x05,0xDB,0x0F,0x15,0x0E,0x5B,0x0E,0xC0,0x0B,0x61,0x0E,0xC0,
+0x0B,0x3A,0x19,0x83,0x87,0x08,0x13,0x34,0x0E,0xC0,0x9D,0x88,0x82,0x78,0x87,0xAC,0x05,0xC0,0x0A,0x05,0xE3,0xAE,0x85,0x24,0x29,0x25,0xC5,0x9C,0x88,0x9C,0x88,0xA2,
+0x77,0x6B,0xA2,0x97,0x18,0xA4,0x88,0xA3,0x88,0x0F,0x8C,0x9B,0x05,0xDB,0xBB,0x84,0x2B,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0x3A,0x0E,0x96,0x76,0x22,0x3F,
+0xFE,0xAD,0x8E,0x0E,0xC1,0x34,0x32,0x17,0x05,0xE5,0x17,0x0F,0x39,0x25,0xC3,0x02,0x9D,0x88,0xA2,0x99,0x26,0xA4,0x87,0x36,0x26,0x3C,0xA9,0x74,0x05,0xDC,0xFE,0x8C,
+0x6C,0x3A,0x0E,0xC1,0x0B,0x3A,0x0E,0x0B,0xC1,0x3A,0x0B,0xC0,0x8D,0x96,0xFE,0x21,0x41,0xB7,0x87,0x3A,0x0E,0xC1,0x34,0x1E,0x8B,0x9B,0x9C,0x8A,0xE5,0x20,0x35,0x9A,
+0x8A,0x25,0xC1,0x9C,0x88,0x15,0xC0,0x3D,0xC1,0x26,0x3D,0xA9,0x84,0x9A,0x88,0x05,0xDC,0xFE,0x94,0xCD,0xB9,0x88,0x0B,0x0E,0xC1,0x0B,0x61,0x0E,0x0B,0xC2,0x3A,0x0B,
+0x82,0x88,0x98,0x88,0xFE,0xE7,0x76,0x0B,0xC1,0x3A,0x19,0x22,0x08,0x05,0xE5,0x0F,0x39,0x18,0x25,0x3C,0x9A,0x8B,0xC1,0x3D,0xC3,0x36,0x8F,0x9B,0x05,0xDB,0xA5,0x87,
+0xB8,0x74,0xAF,0xAA,0xA9,0x89,0x12,0x0B,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0xC3,0x34,0x85,0x9A,0x34,0x0E,0x0B,0x0E,0xC0,0x0B,0x92,0x86,0x2C,0x05,0xE5,0x20,0xB2,0x72,
+0x29,0x99,0x9B,0x15,0xC2,0x36,0x6B,0xC1,0xA3,0x87,0x07,0x8B,0x9C,0x05,0xDB,0x20,0xB7,0x96,0x93,0x89,0x91,0x9C,0xB6,0x76,0xB7,0x89,0xAA,0x97,0x0B,0x0E,0x0B,0x0E,
+0xC2,0x0B,0x61,0x0E,0x8D,0x86,0x19,0x0E,0xC2,0x0B,0xC0,0x8A,0x86,0x81,0x9C,0x17,0x9D,0x9A,0xE4,0xB8,0x73,0x39,0x3F,0x15,0xC2,0xA4,0x88,0xC2,0x36,0x54,0x17,0x05,
+0xDB,0x06,0x34,0x3A,0x95,0x79,0x86,0x7B,0x2B,0xB4,0x77,0xB4,0xA8,0xB1,0x76,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0xC1,0x9A,0x99,0x31,0x0E,0xC2,0x0B,0x0E,0x9D,0x88,0x3C,
+0x88,0x9C,0x05,0xE4,0xAB,0x86,0x27,0x8C,0x9D,0x15,0xC2,0x3D,0xC1,0xA0,0xB8,0x1E,0x05,0x17,0x9D,0x9A,0xDB,0x22,0x34,0x0E,0x0B,0x9C,0x89,0x90,0x89,0xFE,0x29,0x43,
+0x2B,0xB7,0x87,0x2D,0x0B,0x0E,0x0B,0x0E,0xC1,0x0B,0xC0,0x34,0x0E,0x0B,0x0E,0xC1,0x0B,0x0E,0x96,0x76,0x0F,0x1F,0x9C,0x8A,0xE3,0x7F,0x0F,0x99,0xA8,0x15,0xC2,0x3D,
+0xC1,0xA4,0x97,0xA8,0x72,0x17,0x05,0xDC,0x0F,0xFE,0xE7,0x76,0x0E,0x12,0x0E,0xC0,0x2D,0x25,0x05,0xA6,0x87,0xFE,0x9C,0xF1,0x2A,0x12,0x0E,0x0B,0x0E,0xC1,0x0B,0xC2,
+0x61,0x0B,0x0E,0xC0,0x93,0x79,0x24,0x0A,0x05,0xC0,0x6E,0x05,0xE1,0x22,0x04,0x3F,0xA1,0x9A,0xC1,0x3D,0xC1,0x36,0x54,0x17,0x05,0xDC,0x0C,0x3A,0x0E,0xC2,0x5A,0x2A,
+0x82,0x89,0x0A,0x66,0x00,0x2D,0x0D,0x0B,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x3A,0x0E,0xC0,0x9D,0x88,0x87,0x99,0x83,0x8C,0xC0,0xB0,0x85,0x96,0x88,0x05,0xE3,0x3F,0x27,
+0x12,0x15,0xC1,0x3D,0xC1,0x1E,0x90,0x89,0x97,0x9C,0xC0,0x0A,0x05,0xD9,0x2B,0xBD,0x95,0xB4,0x8A,0x55,0x0C,0xA6,0x78,0x0B,0x0E,0x0B,0x05,0x33,0x3F,0x99,0x9A,0x15,
+0x33,0xB3,0x89,0xA5,0x96,0x5A,0x9D,0x97,0x91,0x9A,0x0B,0xC0,0x0E,0xC0,0x34,0xFE,0x52,0xC6,0x05,0xA5,0x87,0xAE,0x86,0xAD,0x87,0x0F,0x17,0x05,0xE3,0x0F,0x20,0x94,
+0x9E,0xC1,0xA4,0x88,0xC0,0x0F,0x8C,0x9B,0x05,0xDC,0xA5,0x88,0x0F,0x3F,0x05,0xA6,0x87,0x00,0xB2,0xA7,0x2A,0x12,0x0B,0x12,0x93,0x88,0xFE,0x39,0xE4,0x05,0xA2,0x77,
+0xBA,0x86,0x0C,0x55,0x3E,0x3D,0x12,0x0E,0xC0,0x2D,0x29,0x15,0xB8,0x85,0x3D,0x12,0x0E,0x31,0x81,0xAA,0x8F,0x8E,0xE3,0xB0,0x74,0xA8,0x87,0x3F,0x15,0xA4,0x88,0x29,
+0x22,0x05,0xC0,0x6E,0x05,0xDA,0x3C,0x24,0xA1,0x8C,0x9D,0x89,0x25,0x15,0x14,0xAB,0x87,0x11,0xB2,0x88,0xA2,0x86,0xC0,0x2D,0x13,0x90,0x7B,0xC0,0x15,0x3F,0xFE,0xBD,
+0xD1,0x12,0x0B,0x12,0x9A,0x98,0xFE,0x52,0xC6,0x30,0xB5,0x88,0x0B,0x0E,0x0B,0xC1,0x86,0x87,0x83,0x9B,0x05,0xE2,0x3F,0x27,0x8E,0x9C,0x15,0x02,0x0F,0x91,0x9A,0x17,
+0x9D,0x9A,0xDC,0xB3,0x84,0x34,0xA8,0x8A,0x0E,0x43,0x2A,0x37,0x29,0x17,0xB9,0x87,0x0C,0x12,0x0E,0x0C,0x25,0x90,0x88,0x25,0xFE,0xBE,0x54,0x12,0x69,0x0E,0x0B,0x84,
+0x98,0x37,0x0B,0xC0,0x0E,0xC1,0x0B,0xC0,0x34,0x85,0x9A,0x17,0x05,0xE2,0xBB,0x83,0x2C,0x15,0xA4,0xC8,0x04,0x08,0x05,0xDD,0xB5,0x84,0xFE,0xEF,0x98,0x0B,0x0E,0xC1,
+0x0B,0xC0,0x93,0x89,0x36,0x25,0x0C,0xA6,0x78,0xA2,0x97,0x0C,0x21,0x2A,0x12,0x69,0x0E,0x0B,0x92,0x86,0x34,0x0E,0x0B,0x0E,0xC0,0x2D,0x11,0x33,0x11,0xA7,0x87,0x94,
+0x97,0x2C,0x91,0x9F,0xE2,0xB8,0x73,0x99,0xA8,0x3F,0xB0,0x95,0x9C,0x76,0x05,0xDE,0xBB,0x83,0xFE,0xEF,0x98,0x0E,0x5A,0xC3,0x61,0xA0,0x7A,0x33,0x29,0x19,0x0B,0xC0,
+0x0E,0x0B,0x0E,0x0B,0x0E,0x34,0xC0,0x0E,0x0B,0x0E,0x21,0x87,0x89,0x8E,0x9C,0xC0,0xA8,0x74,0xA1,0x8B,0x9C,0x98,0x22,0x04,0x8C,0x8D,0x9C,0x8A,0xE1,0x36,0xA1,0x85,
+0x3F,0x05,0xFE,0x7C,0x2B,0xBC,0x98,0x0E,0x0B,0xC1,0x34,0x21,0x3D,0xA8,0x88,0x0B,0x93,0x89,0x30,0x3A,0x0E,0xC1,0x5A,0x0E,0xC0,0x31,0x0E,0x0B,0x2D,0x84,0x79,0x8E,
+0xA8,0xB4,0x77,0x11,0x2D,0x2A,0xC1,0x61,0x31,0x06,0x05,0xC0,0x14,0x05,0xDE,0x13,0x04,0x3F,0xA1,0x9A,0x3F,0xA3,0x89,0x6B,0xA4,0x87,0x09,0xC0,0x04,0x8C,0x8D,0x05,
+0xDE,0xFE,0x94,0xCD,0xB9,0x88,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0x93,0x89,0x33,0x37,0xB1,0x76,0x2D,0xC0,0x0D,0x0B,0xC0,0x0E,0x0B,0x34,0xC0,0x04,0x37,0x82,0x79,0x30,
+0x3D,0xA7,0x89,0x0B,0xC0,0x0E,0xC0,0x0B,0x3A,0x0E,0x84,0x88,0x85,0x8A,0x99,0x9C,0xE0,0x13,0xA8,0x74,0x3C,0x02,0x25,0x09,0xAB,0x54,0x9C,0x76,0x05,0xDE,0x3F,0xFE,
+0xAD,0x8E,0x0E,0xC2,0x0B,0x0E,0x0B,0x0E,0xC1,0x0B,0xC1,0x0E,0x0B,0xC2,0x93,0x89,0x12,0x34,0x30,0x37,0x2A,0xC0,0x19,0x12,0x0E,0x5A,0xC0,0x0E,0xC1,0x93,0x79,0x20,
+0x17,0x05,0xDF,0x13,0x27,0x25,0xC1,0x09,0x24,0x31,0x05,0xDE,0xAC,0x87,0x0B,0x12,0x68,0x6B,0xC1,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0x0E,0xC1,0x0B,0xC0,0x92,
+0x86,0x0E,0x0B,0x19,0x37,0x11,0xC0,0x0C,0xA6,0x78,0xA2,0x97,0x0E,0xC0,0x0B,0x3A,0x0E,0x19,0x83,0x87,0x17,0x9D,0x9A,0xDF,0x13,0x27,0x25,0xC1,0xA0,0xA6,0xA8,0x55,
+0x05,0xDF,0x13,0x34,0x0E,0x0B,0xC0,0x0E,0xC2,0x0B,0x67,0x0B,0xC1,0x0E,0xC2,0x0B,0x3A,0x95,0x79,0x12,0x69,0xC2,0x0E,0x0B,0x0E,0x0B,0xC2,0x3A,0x0B,0x37,0x1E,0x06,
+0x05,0xC0,0x7F,0x05,0xDC,0x22,0xA5,0x96,0x25,0xC1,0x24,0x94,0x8A,0x05,0xDF,0xB3,0x85,0x34,0x0E,0x59,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0xC2,0x0E,0xC0,0x0B,0x31,
+0x0B,0xC1,0x61,0x0B,0x0E,0x0B,0xC2,0x0E,0xC0,0x0B,0xC0,0xFE,0x73,0xAD,0x06,0x0F,0x17,0x05,0xDE,0xB7,0x74,0x9F,0x95,0x36,0xA2,0x78,0x25,0x99,0xC9,0xC6,0x24,0x8C,
+0x8B,0x05,0xDF,0x0F,0xFE,0xE7,0x76,0x0B,0x04,0x0B,0xC1,0x0E,0xC0,0x0B,0xC3,0x0E,0x0B,0x0E,0xC1,0x0B,0x92,0x86,0x0B,0xC2,0x0E,0xC2,0x0B,0xC3,0x15,0xFE,0x29,0x43,
+0x9C,0x78,0x24,0x8C,0x8B,0x05,0xDE,0x24,0x20,0x98,0x9E,0x9C,0x88,0xA2,0x78,0x15,0x26,0x3D,0x9D,0xC8,0x2D,0xC0,0x26,0x2D,0x26,0xC0,0x1D,0x0F,0x05,0xE0,0xFE,0x7C,
+0x2B,0x3A,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0xC3,0x0E,0xC0,0x0B,0xC2,0x0E,0xC0,0x92,0x76,0x0E,0x0B,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0xC1,0x0E,0xC1,0x11,0x05,0xC0,0x1E,
+0x90,0x89,0x97,0x9C,0xDD,0x3F,0x27,0x06,0x07,0xA3,0x78,0xC0,0x18,0x3D,0xC0,0x26,0x2D,0xC0,0x26,0xC0,0x2D,0xC0,0xAE,0x53,0x98,0x78,0x05,0xE0,0xFE,0x94,0xCD,0x04,
+0x0E,0xC1,0x0B,0x61,0x0E,0x0B,0xC1,0x0E,0x0B,0x0E,0xC1,0x0B,0xC1,0x0E,0x31,0x0E,0x0B,0x0E,0x0B,0xC1,0x3A,0x0B,0x0E,0xC3,0x29,0x14,0x05,0x29,0x36,0x05,0xDD,0x06,
+0x27,0x18,0x1D,0xC4,0x26,0x2D,0xC0,0x26,0x2D,0xC1,0x24,0x8C,0x8B,0x05,0xDF,0xA5,0x88,0xFE,0xAD,0x8E,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0x0E,0xC1,0x0B,0xC1,0x0E,0x0B,
+0xC1,0x3A,0x0B,0x0E,0x93,0x79,0x3A,0x0E,0xC1,0x5A,0xC0,0x0E,0xC1,0x0B,0xC1,0x93,0x89,0x14,0xC0,0x05,0x29,0x13,0x05,0xDD,0xB8,0x73,0x39,0x1D,0x1A,0x1D,0xC3,0x26,
+0x2D,0xC0,0x26,0x2D,0xC0,0x0D,0x9F,0x75,0x05,0xC0,0x6E,0x05,0xDD,0xA9,0x85,0xFE,0xBE,0x31,0x0E,0xC0,0x04,0x6B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0xC3,0x0E,0x0B,0x34,
+0xA4,0x87,0x0E,0x12,0x0E,0x0B,0x0E,0xC1,0x0B,0xC1,0x0E,0xFE,0x6B,0xAB,0x0A,0x66,0xC0,0x3C,0xA9,0x74,0x05,0xDC,0xA9,0x85,0xB5,0x84,0x20,0x1D,0xC5,0x98,0xE9,0x2D,
+0xC0,0x26,0xC0,0x2D,0x1E,0x2C,0x91,0x9F,0xE0,0x3C,0xFE,0xCE,0xB3,0x0E,0xC1,0x0B,0x3A,0x0E,0x0B,0xC1,0x0E,0x0B,0xC2,0x3A,0x0B,0x0E,0xC0,0x3A,0x19,0x15,0x0E,0x12,
+0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0xC0,0x95,0x8B,0xFE,0x10,0xC2,0x9D,0x88,0x05,0xC0,0x3C,0x20,0x17,0x05,0xDB,0x22,0xA5,0x96,0x97,0x8E,0x1D,0xC5,0x26,0x6B,0xC0,0x26,
+0xC0,0x2D,0x1E,0x8B,0x9B,0x05,0xE0,0x29,0x34,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0xC1,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC1,0x9A,0x89,0x9C,0x75,0x15,0x0B,0xC1,0x3A,0x0B,
+0x0E,0xC0,0x0B,0x0E,0xC1,0x3E,0x05,0xC2,0xAB,0x86,0x22,0x08,0x05,0xDA,0x3F,0x27,0x2C,0x99,0x9F,0xA4,0x87,0x07,0x36,0x1D,0x1A,0x1D,0xC0,0x26,0x2D,0xC0,0x26,0xC0,
+0xA7,0x77,0xA8,0x55,0x05,0xE1,0xB5,0x84,0xFE,0xEF,0x98,0x0B,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0xC1,0x0E,0x0B,0xC3,0x3A,0x0B,0x0E,0xC0,0x0B,0xC0,0x0E,0xC1,0x0B,0xC1,
+0x0E,0x0B,0xC0,0x21,0x17,0x05,0xC2,0x3C,0x13,0x05,0xDB,0x22,0x04,0x94,0x8F,0x41,0xA2,0x97,0xC0,0x26,0x69,0xC2,0x9F,0xD9,0x2D,0xC0,0x26,0xC0,0x0D,0x9C,0x76,0x05,
+0xE1,0xBB,0x83,0xBF,0x87,0x0E,0x12,0x0E,0x0B,0xC1,0x0E,0xC1,0x0B,0xC1,0x0E,0x0B,0xC1,0x9A,0x99,0x9D,0x89,0x42,0x2A,0xA4,0x98,0x12,0x0B,0x0E,0xC1,0x0B,0xC1,0x0C,
+0xFE,0x3A,0x06,0x05,0xC3,0x13,0x06,0x05,0xC0,0x7F,0x05,0xD7,0xA9,0x85,0x27,0x06,0x07,0x62,0xC6,0x26,0x6B,0xC0,0x26,0x2D,0x24,0x8C,0x8B,0x99,0x9C,0xE1,0xB5,0x84,
+0xBC,0x78,0x12,0x69,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0xC1,0x0E,0x0B,0xC1,0x95,0x8B,0x30,0x3F,0x05,0x0A,0xB8,0x76,0xFE,0xEF,0xBB,0x0B,0xC0,0x0E,0xC1,0x0B,0x3A,0x0E,
+0xFE,0x6B,0xAB,0x0A,0x66,0xC3,0xB3,0x85,0x99,0x9B,0x05,0xDA,0xB8,0x73,0x39,0x3D,0xC8,0x9D,0xC9,0x26,0x2D,0xC0,0x1D,0x0F,0x05,0xE2,0xB7,0x74,0x25,0x0C,0x0B,0x0E,
+0x0B,0x0E,0x0B,0xC1,0x0E,0xC1,0x0B,0x97,0x9A,0x87,0x89,0x89,0x9A,0x9B,0x9A,0xC3,0x11,0xB2,0x88,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0x33,0xFE,0x00,0x20,0xC5,0x13,0x31,
+0x05,0xD9,0x3C,0x27,0x92,0x9F,0x36,0x6B,0xC7,0x2D,0xC0,0x26,0x2D,0x0D,0x9C,0x76,0x05,0xE2,0x07,0x94,0x58,0xB1,0xDC,0x0B,0x0E,0x0B,0xC3,0x0E,0x0B,0x0E,0x11,0xFE,
+0x29,0x43,0x05,0xC2,0x3F,0xC0,0x2B,0xB0,0x85,0x0B,0x0E,0x0B,0xC2,0x11,0x2B,0x05,0xC5,0x13,0x17,0x05,0xD8,0xA6,0x87,0x24,0x22,0x3D,0xC9,0x26,0x2D,0xC1,0x1E,0x90,
+0x89,0x17,0x9D,0x9A,0xE1,0x07,0x98,0x25,0x93,0xFF,0x33,0x12,0x0B,0x12,0x0B,0x0E,0xC1,0x19,0x84,0x8B,0x85,0x9A,0xC0,0xA7,0x88,0xB4,0x75,0x11,0xA9,0x89,0x19,0xC0,
+0x9D,0x89,0x21,0x0B,0x0E,0xC0,0x0B,0x0E,0x11,0x2B,0x9B,0x9A,0xC5,0x2B,0xAB,0x86,0x05,0xD9,0x07,0x9F,0x95,0x02,0x66,0xC9,0x9D,0xC9,0xC1,0x13,0x24,0x17,0x05,0xE1,
+0x32,0x22,0x9C,0x25,0x0F,0x3A,0x37,0x0B,0xC1,0x0E,0xC0,0x0C,0x36,0x3A,0x36,0x11,0x0C,0x0B,0x0E,0x0B,0xC5,0x61,0x0B,0x33,0x2B,0x05,0xC6,0x20,0xC0,0x05,0xD8,0xB0,
+0x95,0x1E,0x06,0x9E,0x8B,0x61,0xA5,0x68,0x3D,0x41,0x07,0x36,0x3D,0xC3,0x2D,0x69,0xC0,0xAC,0x44,0x22,0x05,0xE2,0x3F,0x29,0x9C,0x36,0x95,0xCC,0x05,0xAC,0x87,0xFE,
+0xC6,0x97,0xAA,0x97,0x0B,0xC0,0x9D,0x98,0xFE,0x5B,0x4A,0xC0,0x37,0x3A,0x0E,0xC1,0x0B,0x0C,0x21,0x7D,0x0E,0xC1,0x0B,0x3A,0x30,0x14,0xC0,0x05,0xC6,0x25,0x05,0xD8,
+0x3C,0xAD,0x85,0x94,0x8D,0x07,0x36,0x1D,0x3D,0xC0,0x41,0x07,0x36,0x3D,0xC3,0x9D,0xC8,0xC1,0x1E,0x90,0x89,0x97,0x9C,0xE2,0xA6,0x87,0xAD,0x85,0x98,0x59,0x9C,0x88,
+0x05,0xC0,0x36,0xFE,0xBE,0x54,0xAD,0x98,0x0E,0x93,0x79,0x37,0xB1,0x76,0xC1,0x9A,0x99,0x33,0xC0,0x11,0x37,0x2A,0x12,0x0B,0x12,0x0B,0x0C,0x86,0x78,0x0A,0x66,0xC8,
+0x20,0x05,0xD7,0xA9,0x97,0x24,0x0F,0x3D,0xC1,0x41,0x07,0x36,0x3D,0xC6,0x9D,0xC8,0x6B,0xC0,0x1E,0x8B,0x9B,0x05,0xE2,0x3A,0x22,0x10,0xA4,0x77,0x95,0xBB,0x05,0xC0,
+0x36,0xFE,0xBE,0x54,0xAD,0x98,0xC2,0x61,0x0B,0x0E,0xC0,0x0B,0xC0,0x12,0x0E,0x0B,0xC0,0x69,0x21,0x36,0x05,0xE4,0xB8,0x73,0x39,0x3D,0x41,0x07,0x36,0x3D,0xC6,0x26,
+0x07,0x36,0x2D,0xC0,0x69,0xC3,0x22,0xA5,0x96,0x05,0xE3,0x32,0xAE,0x85,0x14,0xFE,0x3C,0x62,0xC0,0xFE,0x12,0x02,0x19,0x05,0x15,0x37,0x0B,0xC2,0x0E,0xC1,0x0B,0xC1,
+0x0E,0x0B,0x2A,0x30,0x14,0x05,0xE3,0xA5,0x87,0xB0,0x85,0xA2,0x78,0x2D,0xC4,0x26,0x1E,0x2C,0x05,0xE4,0x13,0x92,0x6A,0xBD,0x31,0xFE,0x76,0x86,0x9D,0x9B,0x12,0x95,
+0xBF,0x98,0x99,0x24,0x33,0xB8,0x76,0x0B,0x0E,0x0B,0x0E,0x0B,0xC1,0x0E,0xC0,0x21,0x80,0x8B,0x98,0x67,0x10,0xA4,0x86,0x24,0x2A,0x24,0x99,0xBB,0x0A,0x05,0xDD,0x22,
+0x1E,0x3D,0x26,0x2D,0x26,0xC3,0xB2,0x42,0x31,0x05,0xDA,0x19,0x10,0x44,0x28,0x05,0x0F,0x05,0xC2,0x3C,0x05,0xB8,0x21,0xFE,0x76,0x87,0x18,0x0D,0x69,0xC1,0x98,0x9B,
+0x30,0x3A,0x12,0x79,0x0B,0xC0,0x69,0x0B,0x95,0x8B,0x84,0x79,0x17,0xA5,0x67,0xB1,0x30,0xAC,0x66,0x92,0xBD,0x8D,0xEF,0x05,0xC0,0x10,0x28,0x0A,0x05,0xDB,0x20,0x27,
+0x92,0x9F,0x56,0x9B,0xDA,0xC3,0x26,0x22,0x24,0x17,0x0A,0x05,0xD7,0x37,0xB0,0x43,0x39,0xA3,0x97,0xC1,0x9A,0x88,0x97,0x9C,0x13,0x9B,0xAB,0x98,0xCC,0x05,0xA8,0x88,
+0x14,0xAE,0x43,0x0D,0x18,0xC4,0x0D,0xFE,0x5B,0xA9,0xB7,0xAB,0xAA,0x97,0x0B,0xC0,0x93,0x89,0x8B,0x9A,0x2B,0x9B,0x9A,0xAF,0x33,0xFE,0x3C,0x62,0x06,0xC0,0x9A,0x88,
+0xFE,0x02,0x00,0x0F,0x05,0xC0,0xAB,0x55,0x9C,0x88,0x9A,0xBB,0x05,0xDA,0xB7,0x74,0x99,0xBA,0x3D,0xC0,0x9D,0xC9,0x26,0x2D,0x13,0xC2,0xA7,0x87,0xA0,0x65,0x05,0xD9,
+0xB8,0x10,0xFE,0x6E,0x27,0x18,0xC3,0x06,0x97,0x8A,0x92,0xBD,0x9A,0xBE,0x10,0x9C,0x88,0x0A,0x10,0xFE,0x65,0xA7,0x18,0xC5,0x0E,0x0C,0x30,0x11,0x93,0x86,0x9B,0x47,
+0x93,0xAB,0x0F,0xAD,0x65,0xB7,0x31,0xAC,0x62,0x18,0xC1,0x8F,0xAD,0x19,0x05,0xC0,0x17,0x31,0x99,0x9A,0x0A,0x05,0xD8,0x22,0xA2,0x88,0x3D,0x41,0xA2,0x97,0x3D,0x26,
+0x36,0x3D,0xC0,0x26,0x36,0x3D,0xC1,0x26,0x36,0x3D,0xC2,0x13,0xC5,0xAB,0x75,0x20,0x05,0xD8,0x19,0xFE,0x54,0xE7,0x1A,0x18,0xC5,0x97,0x9A,0xFE,0x23,0x03,0x2A,0xA0,
+0x8A,0x10,0x28,0x0A,0x18,0xC4,0x1A,0xFE,0x3B,0xE5,0x9E,0xDD,0x2C,0xAD,0x52,0x18,0x0D,0x19,0x98,0x99,0x0E,0x1F,0x18,0xC2,0x9D,0x9A,0xFE,0x1A,0xC1,0x05,0xC0,0x6E,
+0xA4,0x88,0x2E,0x95,0xBB,0x0A,0x05,0xD6,0xA9,0x85,0xAF,0x87,0x96,0x9A,0x53,0x3D,0xC1,0x26,0xA4,0x87,0x36,0x3D,0xCA,0xA4,0xA6,0xC0,0x59,0xC3,0xA7,0x87,0x8D,0x8B,
+0x9C,0x8A,0xD8,0x10,0xFE,0x65,0xA7,0x18,0xC8,0x15,0x28,0xA3,0xAA,0x0C,0x12,0x1A,0x18,0xC4,0x2C,0xFE,0x73,0xAD,0x9F,0x67,0x36,0x18,0x9D,0x9B,0x95,0x99,0x12,0x1A,
+0x18,0xC4,0x39,0x19,0x05,0xC0,0x17,0x10,0x2A,0x0A,0x05,0xD6,0xB7,0x74,0x9F,0x95,0x3D,0x41,0xA4,0x87,0x61,0x3D,0xCA,0x36,0x07,0x2D,0xA0,0xA5,0x1D,0xC0,0x13,0xC2,
+0xA5,0x77,0xA6,0x84,0x05,0xD9,0xAF,0x54,0x0D,0x18,0xC1,0x06,0x18,0xC4,0x06,0xFE,0x22,0xC2,0xFE,0x00,0x60,0x37,0x0C,0xFE,0x55,0x63,0x18,0xC4,0x0E,0xFE,0x6B,0xAB,
+0xA0,0x9A,0xFE,0x5C,0xE8,0x18,0xC1,0x8F,0xAD,0xB1,0x75,0x18,0xC4,0x0D,0xFE,0x0A,0x00,0x0F,0x62,0xC1,0x31,0x37,0x0F,0x05,0xC7,0x6E,0x05,0xCA,0xB0,0x74,0xA7,0x88,
+0x3D,0xC1,0x26,0xA4,0x87,0x61,0x3D,0xC5,0x9D,0xA8,0xA0,0xA8,0x1E,0x9E,0xB8,0xA0,0xA7,0xA2,0xA7,0xA1,0xB8,0x7B,0xFE,0x4A,0x25,0xC4,0xA9,0x77,0x9A,0x86,0x05,0xD9,
+0x31,0x0D,0x18,0xC1,0x9D,0x9A,0x18,0xC5,0x99,0x9B,0xFE,0x02,0x00,0x0F,0x05,0xAF,0x33,0xFE,0x3C,0x62,0x0D,0x18,0xC2,0x99,0x9C,0xFE,0x4C,0x07,0x16,0xA3,0x61,0x1F,
+0x18,0xC0,0x97,0x9A,0xC0,0x18,0xC4,0x0D,0x8D,0x9C,0x0F,0x05,0xC1,0x32,0x0C,0x19,0x05,0xD3,0x17,0xB5,0x85,0x97,0x9C,0x36,0x6B,0xC1,0x41,0x07,0x36,0x26,0x3D,0x9D,
+0xE6,0xA0,0xA9,0x9E,0xB6,0xA3,0x99,0xA0,0xB7,0x33,0xA1,0xA9,0xC1,0x56,0x05,0xC0,0x1D,0xC0,0x13,0xC2,0xAA,0x85,0x91,0x7A,0x95,0x9D,0xD9,0x0C,0x18,0xC5,0x1A,0x18,
+0xC3,0x94,0x8B,0xFE,0x09,0x21,0x99,0xBB,0x05,0x28,0xB1,0x54,0x0D,0x18,0xC2,0x99,0x9C,0xFE,0x4C,0x07,0x1C,0x18,0xC1,0x99,0x9C,0x3E,0x0E,0x1F,0x18,0xC3,0x35,0x37,
+0x0A,0x05,0xC1,0x2E,0x9C,0x88,0x97,0xCC,0x0A,0x05,0xD1,0xB0,0x74,0xA3,0x98,0x3C,0x9D,0x89,0x73,0xC0,0xA0,0xA8,0x2B,0x70,0x79,0xA3,0x99,0xA0,0xB7,0x7A,0x61,0xC1,
+0xA3,0x98,0xC0,0x3D,0x05,0xC1,0x51,0xA3,0x88,0x1D,0xC0,0x13,0xC2,0xAB,0x75,0x17,0x52,0x66,0xC0,0x6B,0x05,0xD5,0x08,0x1A,0x18,0xC3,0x1A,0x18,0xC5,0x8A,0x9E,0x0F,
+0x05,0xC1,0x28,0x39,0x18,0x9D,0x9A,0x18,0xC1,0x06,0x18,0xC1,0x25,0xFE,0x01,0x60,0xA5,0x76,0xB7,0x64,0x1A,0x18,0xC2,0x2C,0xFE,0x09,0x81,0x0F,0x0A,0x05,0xC0,0xA5,
+0x87,0xAA,0x55,0x0F,0x05,0xD2,0xB7,0x94,0x92,0xFB,0x16,0x35,0xA0,0xB7,0x33,0x3D,0x7E,0xC0,0x9D,0x89,0xC5,0x05,0xC1,0x6E,0x05,0xC1,0x29,0x1D,0xC0,0x59,0xC1,0xA5,
+0x77,0xA2,0x78,0x89,0xAD,0xDA,0xB7,0x10,0x1A,0x18,0xCB,0x25,0xFE,0x01,0x60,0x05,0xC0,0x6E,0xB2,0x33,0xFE,0x65,0xA7,0x0E,0x1F,0x18,0xC2,0x9D,0x9A,0x18,0xC0,0x97,
+0x9A,0xFE,0x01,0x00,0x05,0xAF,0x33,0xB0,0x75,0x18,0xC2,0x06,0xFE,0x0A,0xA0,0x05,0xC0,0x6E,0x05,0x0F,0x24,0x9C,0x99,0x0F,0x0A,0x05,0xCF,0xA9,0x97,0xB0,0x92,0xFE,
+0x99,0x61,0x29,0xC1,0x7E,0x29,0xC6,0x31,0xA2,0x88,0xC0,0x6E,0xC0,0x05,0xC0,0x0A,0x05,0xC0,0x1D,0xC0,0x13,0xC1,0xA9,0x77,0x14,0x8D,0x9F,0xDA,0x19,0xB9,0x50,0x18,
+0xCC,0x8A,0x9E,0xFE,0x00,0x60,0x05,0xC0,0xA5,0x87,0xFE,0x6D,0x69,0xA6,0x52,0x97,0x8A,0x0D,0x18,0xC4,0x39,0xFE,0x00,0xA0,0x05,0xC0,0xA8,0x55,0xB6,0x31,0x0D,0x18,
+0xC1,0x29,0x0F,0x05,0xC2,0x2B,0x2E,0x19,0x05,0xD0,0xB0,0x74,0xA2,0xF7,0x33,0x62,0x66,0x29,0xC3,0x31,0x24,0x29,0xC1,0xA3,0x98,0xC0,0x0A,0xC1,0x05,0xC0,0x0A,0x29,
+0xC0,0x1D,0xC0,0x59,0xC1,0xA7,0x87,0x94,0x78,0x95,0x9D,0x0F,0x05,0xD8,0x0C,0xFE,0x6E,0x26,0x18,0xCC,0x25,0xFE,0x01,0x60,0x0F,0x05,0xC0,0xBF,0x20,0x18,0xC0,0x97,
+0x9A,0xC0,0x18,0x06,0x18,0xC1,0x8A,0x9E,0x05,0xC0,0x6E,0x05,0xA8,0x55,0xB0,0x43,0x36,0x18,0xC0,0x8F,0xAD,0x19,0x0A,0x05,0xC2,0x2E,0x9C,0x88,0x05,0xC0,0x0A,0x05,
+0xC7,0x0A,0x05,0xC3,0xB3,0x85,0xA1,0xF6,0x33,0x62,0xC2,0xA3,0x98,0x29,0xC2,0x05,0xC0,0x56,0xA2,0x87,0xC0,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x29,0xC0,0x13,0x1D,0xC2,
+0xAB,0x62,0x89,0x9F,0x9C,0x8A,0xDA,0x2E,0xFE,0x5D,0xA6,0x18,0xCD,0xFE,0x23,0x41,0x0F,0x05,0xC0,0xB8,0x21,0xFE,0x76,0x87,0x18,0xC0,0x2C,0x9B,0x88,0xA9,0x97,0xC0,
+0x18,0x25,0xFE,0x01,0x60,0x05,0xC4,0xAF,0x54,0xB7,0x31,0x1F,0x35,0xFE,0x09,0x21,0x99,0xBB,0x05,0xC2,0x37,0xA7,0x54,0x0F,0x05,0xC1,0x0A,0x05,0xC7,0x0A,0x05,0xC1,
+0xB5,0x84,0xFE,0x8A,0x21,0x29,0xC0,0xA3,0x98,0xC0,0x29,0xC0,0x05,0x29,0x3D,0x29,0xC0,0x05,0x6E,0x05,0xC0,0x0A,0xC1,0x05,0xC1,0x29,0xC0,0xFE,0x4A,0x25,0xC2,0x0D,
+0x6C,0x17,0x9D,0x9A,0xDA,0xAB,0x55,0xFE,0x55,0x63,0x18,0xCD,0x0E,0xFE,0x01,0x00,0x05,0xA2,0x77,0x31,0xFE,0x6E,0x27,0x18,0xC2,0x35,0x25,0x2C,0xFE,0x23,0x03,0x8D,
+0xEF,0x9D,0xAA,0x05,0xC4,0xAF,0x33,0xB0,0x75,0xA3,0x52,0x19,0x0A,0x05,0xC3,0x0C,0x28,0x05,0x0F,0x05,0xCD,0x22,0xFE,0x8A,0x21,0x29,0xA4,0x87,0xC0,0x66,0xC0,0x3D,
+0x0A,0x29,0xC3,0x05,0xC0,0x3D,0x0A,0xC1,0x05,0xC0,0x0A,0xC1,0x13,0x1D,0xC1,0x04,0x40,0xFE,0x00,0x20,0xDB,0x10,0xBB,0x30,0x1A,0x18,0xCC,0x0D,0xFE,0x0A,0x00,0x93,
+0xEF,0x05,0xAA,0x66,0xFE,0x76,0x09,0x18,0xC3,0x35,0x92,0xBD,0x28,0x05,0x0F,0x66,0x05,0x0F,0x05,0xC2,0x37,0x13,0x9C,0xAB,0x0F,0x0A,0x05,0xC2,0x10,0x24,0x95,0xCC,
+0x05,0x0A,0x05,0xCC,0xAB,0x86,0xA7,0xF6,0x33,0xA1,0xA9,0xC1,0x29,0xC0,0x05,0x29,0x3D,0x29,0xC3,0x05,0xC2,0x3D,0xA2,0x87,0xC1,0x29,0xFE,0x4A,0x25,0x1D,0xC0,0x13,
+0xA7,0x87,0x98,0x78,0x91,0x9D,0xDB,0xA5,0x88,0xFE,0x3C,0x62,0x18,0xC1,0x1A,0x18,0xCA,0x8A,0x9E,0x0F,0x05,0xAA,0x64,0xFE,0x65,0xA7,0x18,0xC4,0x9D,0x9B,0x29,0xFE,
+0x01,0x60,0x0F,0x05,0xC6,0x2B,0x31,0x10,0x96,0xBB,0x05,0xC3,0x31,0x0F,0x05,0xCE,0x2B,0xB0,0x85,0xFE,0x89,0x40,0xA0,0xC8,0x3D,0x51,0xC0,0xA3,0x98,0x6E,0x05,0xC0,
+0x3D,0x0A,0x29,0xC4,0x31,0xC0,0x05,0x29,0x05,0xC0,0x13,0xC2,0x27,0x8C,0x9D,0x17,0x9D,0x9A,0xDB,0x15,0x1A,0x18,0xCB,0x0D,0x9C,0x89,0x39,0x19,0x05,0xA8,0x55,0xFE,
+0x65,0xA7,0x18,0xC5,0x0D,0x12,0xFE,0x02,0x00,0x0F,0x05,0xC7,0x20,0x24,0x19,0x05,0x6E,0x05,0xC0,0xAF,0x54,0x37,0x05,0xCF,0xB0,0x74,0xA4,0xF6,0x33,0x29,0xC1,0xA3,
+0x98,0xC1,0x6E,0xC1,0x29,0x7E,0x05,0x29,0x05,0x31,0x05,0x0A,0x05,0xC0,0x0A,0x29,0x13,0xC1,0xA7,0x87,0x04,0x8C,0x8D,0x9C,0x8A,0xDC,0x08,0xBB,0x40,0x18,0xCC,0x12,
+0x39,0x19,0x05,0x37,0x36,0x18,0xC7,0x97,0x9A,0xFE,0x23,0x03,0x8D,0xEF,0x05,0xC0,0x17,0x05,0xC4,0x2A,0x24,0x0F,0x05,0xC1,0xAB,0x55,0x2A,0x92,0xBD,0x05,0xCE,0xA7,
+0x85,0x1E,0x35,0x33,0x29,0xC3,0xA3,0x98,0xC1,0x29,0xC0,0x05,0x29,0x3D,0x29,0x05,0xC0,0x6E,0xC1,0x29,0x13,0xC1,0xA5,0x77,0x16,0xFE,0x00,0x20,0xDD,0x2E,0x0D,0x18,
+0xCC,0x97,0x9A,0x94,0xAD,0x19,0x05,0x37,0xFE,0x65,0xA7,0x18,0xC4,0x1A,0x18,0xC1,0x0D,0x8D,0x9C,0x0F,0x05,0xC7,0x2A,0x10,0x96,0xBB,0x05,0xC1,0xAF,0x54,0x0F,0x05,
+0xCF,0xA9,0x97,0xB2,0x73,0xFE,0x8A,0x21,0x98,0xFB,0xC0,0x33,0x9D,0xAA,0x29,0xC3,0x7E,0x24,0x29,0xC0,0xA3,0x98,0xC1,0x6E,0x05,0xC0,0x0A,0x13,0xC1,0x1E,0x04,0x17,
+0x9D,0x9A,0xDC,0xAB,0x44,0xBB,0x41,0x1A,0x18,0xCB,0x0D,0x8D,0x9C,0x19,0x05,0x06,0x36,0x18,0xCA,0x8F,0xAD,0x06,0x97,0xCC,0x66,0x05,0xC5,0xAF,0x54,0x37,0x05,0xC1,
+0x10,0xA4,0x66,0x05,0xD0,0x20,0x27,0xFE,0x8A,0x21,0x98,0xFB,0xA4,0x87,0x66,0xC0,0x3D,0x0A,0x29,0xC4,0x05,0xC1,0x0A,0xC1,0x05,0x13,0xC1,0xAB,0x76,0x99,0x88,0x17,
+0x9D,0x9A,0xDC,0xA5,0x87,0xB9,0x10,0x0D,0x18,0xCC,0x3B,0x19,0x05,0x0C,0x36,0x18,0xCB,0x0E,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xC5,0x2B,0x31,0x19,0x05,0xC0,0x10,0x13,
+0x0F,0x05,0xD0,0x16,0xB2,0x73,0x9A,0xF9,0x3D,0x7E,0xC2,0x29,0x66,0x29,0xC2,0x05,0xC1,0x0A,0xC0,0x05,0xC0,0x1D,0xC1,0x27,0x93,0x9D,0x90,0x9C,0xDE,0xB4,0x42,0x0D,
+0x18,0xCC,0x97,0x9A,0xFE,0x01,0x00,0x9A,0xBB,0xBD,0x20,0xFE,0x76,0x87,0x18,0xCC,0x97,0x9A,0xFE,0x02,0x00,0x0F,0x05,0xC5,0xAB,0x55,0xA4,0x66,0x05,0xC1,0x2E,0x19,
+0x05,0x0F,0x05,0xC0,0x6E,0x05,0xCC,0x16,0xB2,0x73,0xFE,0x99,0x61,0xA1,0xB8,0xC1,0x3D,0x29,0xC3,0x7E,0x52,0x05,0xC0,0x3D,0xA2,0x87,0xC1,0xFE,0x52,0x26,0xC0,0x59,
+0xAE,0x63,0x8D,0x9C,0x95,0x9D,0xDE,0xAF,0x54,0xFE,0x55,0x63,0x18,0xCD,0x3E,0x19,0xFE,0x54,0xE7,0x18,0xCE,0x99,0x9B,0x0C,0x0F,0x05,0xC4,0x32,0xAA,0x21,0x0F,0xA6,
+0x66,0xA7,0x66,0x0C,0xC0,0x2E,0xA0,0x55,0x13,0x24,0x19,0x05,0xC0,0xA3,0x87,0x05,0xCA,0x3A,0x35,0x33,0x29,0xC0,0xA3,0x98,0x29,0x3D,0x29,0x05,0xC0,0x29,0xC0,0x05,
+0x6E,0x05,0x0A,0x05,0xC0,0x1D,0xC0,0xA5,0x66,0xA6,0x84,0x89,0x9F,0x9C,0x8A,0xDE,0xA7,0x78,0xFE,0x3C,0x62,0xAE,0x75,0x18,0xCB,0x0D,0x8D,0x9C,0x13,0xBD,0x51,0x18,
+0xCF,0x25,0x88,0xAF,0x05,0xC4,0x3F,0x24,0x9C,0x99,0x24,0x06,0x37,0x99,0xBB,0x05,0x28,0x0A,0x37,0x2E,0x19,0x05,0x0F,0x05,0xCA,0x2B,0x1E,0xFE,0x99,0x61,0xA1,0xB8,
+0xC0,0x9D,0x89,0x66,0x29,0xC0,0x05,0x6E,0x05,0x29,0xC0,0x05,0xC1,0x0A,0xC0,0x1D,0x59,0xA7,0x87,0x6C,0x1F,0x9C,0x8A,0xDE,0x2B,0xB3,0x22,0xFE,0x6E,0x27,0x18,0xCC,
+0x0E,0x12,0xAE,0x75,0x18,0xD0,0x99,0x9C,0x3E,0x0F,0x05,0x0F,0x66,0x05,0xAA,0x66,0x2E,0xC0,0x19,0x2B,0xA4,0x86,0xA2,0x58,0x2A,0x4A,0x9C,0x99,0x9D,0xAA,0x10,0x0A,
+0x66,0xCD,0xB7,0x74,0x35,0xFE,0xB1,0x81,0x6E,0x05,0xC0,0x29,0xC0,0x05,0xC0,0x29,0x3D,0x05,0xC2,0x0A,0xC0,0x1D,0x13,0xA7,0x87,0x04,0x88,0x8F,0xE0,0x31,0xFE,0x6E,
+0x27,0x18,0xCC,0x0D,0x39,0xAE,0x73,0x18,0xD1,0x97,0x9A,0xFE,0x01,0x00,0x9A,0xBB,0x05,0xC1,0xAB,0x86,0xA9,0x55,0x2B,0x05,0xC4,0x06,0x24,0x0C,0x19,0x05,0xCD,0xB5,
+0x84,0x35,0xFE,0xA1,0xC1,0x9F,0xB9,0x66,0xC0,0x29,0xC0,0x3D,0x29,0xC1,0x05,0x29,0x3D,0x0A,0x05,0xC0,0x1D,0xC0,0x27,0x26,0xFE,0x00,0x20,0xE0,0x32,0x12,0xAE,0x75,
+0x18,0xCC,0x12,0x18,0xD2,0x0D,0xFE,0x0A,0x00,0x05,0xC2,0x31,0x37,0x05,0xC0,0x0F,0xAA,0x98,0x31,0x24,0x9C,0x99,0x37,0x19,0x10,0x44,0x05,0xCD,0xB8,0x73,0xFE,0x8A,
+0xC5,0xFE,0xB1,0x81,0xC0,0x0A,0xC1,0x29,0xC3,0x05,0xC0,0x3D,0x0A,0x29,0xC0,0xFE,0x4A,0x25,0xC0,0x27,0x93,0x9D,0x90,0x9C,0xC0,0x7F,0x05,0xDE,0xB8,0x10,0x0D,0x18,
+0xCC,0x0E,0x25,0x18,0xD1,0x2C,0xFE,0x01,0x00,0x9B,0xBB,0x05,0xC0,0x10,0x3F,0x9A,0x89,0x05,0xC2,0x2B,0xC0,0x10,0xC1,0x2E,0xA0,0x55,0x0F,0x05,0xCC,0xBB,0x82,0xFE,
+0x99,0x61,0x7A,0xA2,0x97,0x66,0x0A,0x05,0xC0,0x29,0xC1,0x3D,0x29,0xC0,0x3D,0x05,0xC1,0x13,0xC0,0x27,0x8C,0x9D,0x97,0x9C,0xE1,0xAF,0x33,0x25,0x18,0xCC,0x2C,0x39,
+0x18,0xD1,0x39,0x19,0x05,0x6E,0xA7,0x66,0xA3,0x88,0x0A,0x05,0xC3,0x2B,0x03,0xC3,0xA8,0x31,0x0F,0x05,0xCB,0xA9,0x85,0xB5,0x84,0x09,0x9F,0xB9,0x66,0xC0,0x0A,0xC1,
+0x3D,0x29,0xC0,0x3D,0xC0,0x29,0xC0,0x3D,0xC0,0x0A,0xFE,0x4A,0x25,0xC0,0x36,0x89,0x9D,0x99,0x9C,0xE1,0x37,0x12,0xAE,0x75,0x18,0xCC,0x8F,0x9C,0x1A,0x18,0xD0,0xFE,
+0x23,0x41,0x19,0x05,0x10,0x24,0x05,0xC5,0x3F,0x10,0xC0,0x03,0xC1,0x0C,0x10,0x05,0xCB,0xB0,0x74,0xA9,0xB5,0xFE,0x99,0x61,0xA1,0xB8,0x0A,0x05,0xC0,0x0A,0xC1,0x3D,
+0x29,0xC0,0x05,0x0A,0x05,0x29,0x05,0xC0,0x13,0xA5,0x77,0x16,0x89,0x9F,0x9C,0x8A,0xE2,0xB5,0x20,0x0D,0x18,0xCC,0x92,0x9B,0xA1,0xAD,0x0E,0xC0,0x44,0x0E,0x35,0xC1,
+0x24,0xC6,0x39,0x0E,0x9A,0x88,0x92,0x9D,0x9B,0xCD,0x2A,0x0C,0x28,0x2B,0x51,0x05,0xC3,0x6E,0x05,0xC0,0x19,0x28,0x05,0x24,0x2E,0x19,0x05,0xC9,0x0A,0x1E,0x9B,0xF7,
+0xFE,0xB1,0x81,0x6E,0xC0,0x05,0xC0,0x0A,0xC1,0x3D,0x05,0xC0,0x3D,0x0A,0x29,0xC0,0x05,0xC0,0x13,0xA7,0x87,0x16,0xFE,0x08,0x20,0x5A,0xE2,0x24,0x0E,0xAB,0x75,0x18,
+0xCB,0x97,0x9A,0x39,0x1F,0x9D,0x9A,0x18,0x9D,0x9A,0xC0,0x18,0x1A,0x18,0xC0,0x1A,0x18,0xC0,0x1A,0xC0,0x18,0x0D,0x8D,0x9C,0xFE,0x09,0x81,0xC1,0x24,0x2A,0x2E,0xC0,
+0x7A,0x0C,0x2E,0xA0,0x55,0x06,0x28,0x24,0x06,0x24,0xC0,0x0C,0xC0,0x98,0xAA,0x06,0xC0,0x97,0xCC,0x05,0xC8,0x20,0xAE,0xA3,0x37,0xA2,0xA7,0xC0,0x66,0xC0,0x0A,0xC1,
+0x3D,0x05,0x0A,0x05,0xC0,0x0A,0xC1,0x3D,0x05,0x13,0x1E,0x22,0x17,0x9D,0x9A,0xE3,0xFE,0x3B,0xE5,0x0D,0x18,0xCC,0x8F,0x9C,0xB1,0x88,0xC1,0x18,0xC4,0x1A,0x18,0xC4,
+0x12,0x19,0x9D,0xAA,0x05,0x0A,0x05,0xC4,0xA8,0x55,0x24,0x2C,0xC0,0x28,0x9B,0xBB,0x0A,0x3F,0xA8,0x22,0x9B,0xAB,0xA0,0xBB,0x10,0x0A,0x05,0xC7,0x2B,0x1E,0x35,0xFE,
+0xB1,0x81,0x6E,0x05,0xC0,0x0A,0x9C,0x89,0x05,0xC0,0x0A,0xC1,0x05,0x0A,0x05,0xC0,0x0A,0xC1,0xB5,0x67,0xA4,0x88,0x9B,0xA5,0xC2,0xA5,0x88,0xA3,0x98,0xA2,0x77,0xC7,
+0x47,0xC0,0x9F,0x9B,0xC0,0x6B,0xC3,0x90,0xA7,0x50,0x53,0xC1,0xA4,0x85,0xA4,0x86,0x20,0x12,0x2C,0xA0,0x8A,0xC0,0xA5,0x87,0x65,0xA4,0x78,0xC0,0xA4,0x96,0xA2,0x78,
+0x35,0xC1,0x31,0x9F,0x9B,0x01,0xC0,0x96,0x88,0x5A,0x1D,0xC6,0x0F,0x1A,0x1D,0xC5,0x0F,0x2B,0x98,0x59,0x1D,0x1A,0x1D,0xC2,0x94,0xA8,0xB0,0x85,0x16,0x20,0x1D,0xC3,
+0x8F,0xBA,0xC0,0xB0,0x74,0x27,0x39,0x1A,0x1D,0xC1,0x05,0xC1,0xAB,0x86,0x27,0x39,0x1A,0x1D,0xC0,0x05,0xC2,0x20,0xB0,0x84,0x0F,0x1A,0x1D,0x05,0xC3,0x20,0x27,0x39,
+0x1D,0x20,0x9A,0x8A,0x05,0xF1,0x20,0x27,0x9A,0x89,0x1A,0xAF,0xB5,0xA5,0x98,0x89,0x9B,0x05,0xF1,0x20,0x27,0x22,0x06,0x31,0x88,0xBB,0x05,0xD8,0x36,0xFE,0xEF,0x98,
+0xA3,0x99,0x98,0x77,0x89,0x98,0x88,0x8B,0x05,0xEF,0x7F,0x22,0xA4,0x78,0x05,0xD9,0xB3,0x85,0x2B,0x0E,0xC0,0x9C,0x76,0x8A,0x89,0x12,0x05,0xEF,0xA5,0x87,0x0E,0xC0,
+0x9D,0x88,0x8D,0x87,0x2C,0x05,0xC2,0x31,0xA2,0x9A,0x05,0xE9,0xA9,0x85,0x27,0x97,0x9B,0x1D,0xC7,0x9B,0xBA,0x9D,0x78,0x06,0x35,0x19,0x01,0xC0,0x9D,0xA5,0x88,0x9D,
+0xDA,0x06,0xFE,0xE7,0x38,0x0E,0xC1,0x5A,0xC1,0x8F,0xA8,0x86,0x79,0x05,0xC1,0x06,0xBD,0xA7,0x90,0x68,0x1F,0x05,0xE7,0x14,0x07,0x01,0x66,0x96,0xB6,0x05,0xC0,0x6E,
+0x05,0xD7,0x13,0xFE,0xDE,0xF8,0x0B,0xC4,0x61,0x8F,0x86,0x06,0x05,0xC0,0x14,0xFE,0x94,0xCD,0x15,0x86,0x8A,0x31,0x9C,0x8A,0x05,0xE6,0xA6,0x87,0x01,0xC0,0x3C,0xA2,
+0x95,0x31,0x05,0xDA,0x13,0x34,0x0E,0xC6,0x3D,0x06,0x05,0xC0,0x29,0x2B,0x15,0x1F,0x31,0x05,0x01,0xC0,0x3C,0x07,0x8B,0x9C,0x05,0xDA,0xB3,0x84,0x19,0x0B,0xC0,0x0E,
+0xC1,0x0B,0xC0,0x0E,0x51,0x3D,0x06,0x90,0xAC,0x3F,0xFE,0xBD,0xD1,0x0E,0x2B,0x87,0x99,0x31,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0x3A,0x00,0x31,0x05,0x1F,0x3A,
+0x0E,0x2B,0x36,0x31,0x05,0xE6,0xA6,0x87,0x24,0x9D,0x8A,0x98,0x9D,0xC8,0x9A,0x78,0x0E,0x5B,0x0E,0xC0,0x0B,0x61,0x0E,0xC0,0x0B,0x0E,0x19,0x83,0x88,0x08,0x13,0x34,
+0x0E,0xC0,0x19,0x87,0x86,0x85,0x9D,0x05,0xC0,0x0A,0x05,0xE3,0xAF,0x84,0x24,0x29,0x25,0xC5,0x9C,0x88,0x9C,0x88,0x26,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x61,
+0x0E,0x96,0x76,0xFE,0x4A,0x85,0x3F,0xFE,0xAD,0x8E,0x0E,0x0B,0x0E,0x98,0x8A,0xFE,0x3A,0x06,0xA6,0x85,0x05,0xDC,0xFE,0x8C,0x6C,0x3A,0x0E,0xC1,0x0B,0x3A,0x0E,0x0B,
+0xC1,0x3A,0x0B,0xC0,0x3D,0xFE,0x21,0x41,0xB7,0x87,0x3A,0x0B,0x0E,0x0B,0xFE,0x5B,0x27,0xA7,0x97,0xAD,0x9B,0xA9,0x89,0x12,0x0B,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0xC0,
+0x0E,0x0B,0xC0,0x34,0x32,0x34,0x0E,0x0B,0x0E,0xC0,0x0B,0x92,0x86,0x2C,0x91,0x9F,0xC0,0x36,0x93,0x89,0x91,0x9C,0xB6,0x76,0xB7,0x89,0xAA,0x97,0x0B,0x0E,0x0B,0x0E,
+0xC2,0x0B,0x61,0x0E,0x8D,0x86,0x19,0x0E,0xC1,0x0B,0xC1,0x8A,0x86,0x81,0x9C,0x17,0x34,0x3A,0x95,0x79,0x86,0x7B,0x8E,0xA8,0xB4,0x77,0xB4,0xA8,0xB1,0x76,0x0E,0xC0,
+0x0B,0x3A,0x0B,0xC2,0x9A,0x99,0x31,0x0E,0xC2,0x0B,0x0E,0x19,0x85,0x77,0x2B,0x34,0x0E,0x0B,0x9C,0x89,0x90,0x89,0x16,0x2B,0xB7,0x87,0x2D,0x0B,0xC1,0x0E,0xC1,0x0B,
+0xC0,0x34,0x0E,0x0B,0x0E,0xC1,0x0B,0xC0,0x96,0x86,0x0F,0xFE,0xE7,0x76,0x0E,0xC2,0x2D,0x25,0x90,0x88,0xA6,0x87,0x00,0x2A,0x0E,0xC0,0x0B,0xC0,0x0E,0xC0,0x0B,0xC2,
+0x61,0x0B,0x0E,0xC0,0x93,0x79,0x88,0x98,0x3A,0x0E,0xC2,0x5A,0x2A,0x82,0x89,0x0A,0x66,0xB4,0x67,0x2D,0x0D,0x0B,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x3A,0x0E,0x0B,0x9D,
+0x98,0x87,0x99,0x83,0x8C,0xC0,0xFE,0xDE,0xF8,0x55,0x0C,0x3A,0x0B,0x0E,0x0B,0x53,0x8A,0x99,0x3F,0x99,0x9A,0xA8,0x88,0x33,0xB3,0x89,0x0B,0x12,0x9D,0x97,0x91,0x9A,
+0x0B,0xC0,0x0E,0xC0,0x34,0xFE,0x52,0xC6,0x05,0xA5,0x87,0xAE,0x86,0x0B,0x0E,0xC0,0x2D,0x29,0x15,0xB8,0x85,0x3D,0x12,0x0E,0x31,0x81,0xAA,0x05,0xE3,0x06,0xAB,0x94,
+0x25,0x92,0x77,0x05,0x15,0x3F,0xFE,0xBD,0xD1,0x12,0x0E,0x12,0x9A,0x98,0x36,0x30,0x3D,0x0B,0xC0,0xFE,0x31,0xC6,0xAB,0x84,0x91,0x9A,0x97,0x9C,0xDD,0xB3,0x84,0x34,
+0x12,0x0E,0x43,0x19,0x37,0x8C,0x68,0x17,0xB9,0x87,0x0C,0x12,0x0E,0x0C,0x25,0x90,0x88,0x25,0xFE,0xBE,0x54,0x12,0xC0,0x0E,0x5A,0x84,0x98,0x37,0x0B,0xC0,0x0E,0x0B,
+0xFE,0x52,0x26,0xA8,0x63,0x08,0x05,0xDD,0xB5,0x84,0xFE,0xEF,0x98,0x0B,0x0E,0xC1,0x0B,0xC0,0x93,0x89,0x36,0x25,0x0C,0xA6,0x78,0x0E,0x0C,0x21,0x2A,0x12,0x69,0x0E,
+0x0B,0x31,0x34,0x0E,0x0B,0x0E,0xC0,0x2D,0x88,0x95,0xFE,0xEF,0x98,0x0B,0x0E,0xC4,0x3A,0x8A,0x8B,0x29,0x19,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0x0E,0x34,0xC0,0x0E,0x0B,
+0x0E,0x21,0x87,0x89,0x14,0xC0,0xA8,0x74,0xB9,0x97,0x3A,0x0E,0x0B,0xC1,0x34,0x21,0x3D,0x0D,0x0B,0x93,0x89,0x30,0x3A,0x0E,0xC1,0x5A,0x0E,0xC0,0x31,0x0E,0x0B,0x2D,
+0x82,0x96,0x90,0x8B,0xB4,0x77,0x11,0x2D,0x19,0x90,0x75,0xB6,0x89,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0x93,0x89,0x33,0x37,0xB1,0x76,0x2D,0xC0,0x0D,0x0B,0xC0,0x0E,0x0B,
+0x34,0xC0,0x04,0x37,0x82,0x79,0x30,0xB1,0x77,0x3A,0xA2,0x78,0xC0,0x0E,0xC1,0x3A,0x0E,0x84,0x88,0x85,0x8A,0x99,0x9C,0xE0,0x13,0xA8,0x74,0x94,0x8E,0x0A,0x05,0xDE,
+0x3F,0xFE,0xAD,0x8E,0x0E,0xC2,0x0B,0x0E,0x0B,0x0E,0xC1,0x0B,0xC6,0x93,0x89,0x12,0x34,0x30,0x37,0x2A,0xC0,0x19,0xA6,0x77,0xFE,0x39,0xE4,0xFE,0xBE,0x54,0x0E,0x59,
+0x6B,0xC1,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0x0E,0xC1,0x0B,0xC0,0x92,0x86,0x0E,0x0B,0x19,0x37,0x11,0xC0,0x0C,0x0B,0x7B,0x13,0x34,0x0B,0xC1,0x0E,0xC2,0x0B,
+0x0D,0x0B,0xC1,0x0E,0xC2,0x0B,0x3A,0x95,0x79,0x12,0x69,0xC2,0x0E,0x0B,0x0E,0xC0,0xFE,0x41,0x44,0x24,0x94,0x8A,0x05,0xDF,0xB5,0x84,0x32,0xBF,0x86,0x0B,0x04,0x0B,
+0xC1,0x0E,0xC0,0x0B,0xC3,0x0E,0x0B,0x0E,0xC1,0x0B,0x31,0x0B,0xC2,0x0E,0xC2,0x0B,0xC3,0x15,0xFE,0x29,0x43,0x2B,0x24,0x8C,0x8B,0x05,0xDE,0xBB,0x83,0x9C,0x76,0x05,
+0xE0,0x1F,0xBC,0x98,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0xC3,0x0E,0xC0,0x0B,0xC2,0x0E,0xC0,0x92,0x76,0x0E,0x0B,0x0E,0xC0,0x0B,0x3A,0x0E,0x0B,0xC1,0x0E,0xC1,0x11,0x05,
+0xC0,0x1E,0x90,0x89,0x97,0x9C,0xDD,0xA6,0x87,0x17,0xFE,0x94,0xCD,0x04,0x0E,0xC1,0x0B,0x61,0x0E,0x0B,0xC1,0x0E,0x0B,0x0E,0xC1,0x0B,0xC1,0x0E,0x31,0x0B,0xC0,0x93,
+0x89,0x04,0x6B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0xC1,0x93,0x89,0x14,0xC0,0x05,0xB3,0x85,0x13,0x05,0xDD,0xB8,0x73,0x39,0x1A,0x26,0xAE,0x54,0x9F,0x75,0x05,0xC0,
+0x6E,0x05,0xDD,0xA9,0x85,0x31,0x0E,0x5A,0x04,0x0B,0xC1,0x0E,0x0B,0xC2,0x0E,0x0B,0xC3,0x0E,0x0B,0x34,0x15,0x0E,0xC1,0x0B,0x0E,0xC1,0x0B,0xC1,0x0E,0xFE,0x6B,0xAB,
+0x0A,0x66,0xC0,0x3C,0x32,0x05,0xDC,0xA9,0x85,0xB2,0x83,0x3A,0x0E,0x0B,0xC0,0x3A,0x0B,0x0E,0xC0,0x0B,0x0E,0xC1,0xFE,0x6B,0xAB,0x84,0x9B,0xC2,0xAB,0x86,0x22,0x08,
+0x05,0xDA,0x3F,0x27,0x2C,0x99,0x9F,0xA4,0x88,0x9D,0xC9,0x0D,0x06,0x05,0xE1,0x1E,0x07,0x31,0x0E,0xC2,0x0B,0x3A,0x0E,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x95,0x8B,0x30,
+0x3F,0x05,0x0A,0xB8,0x76,0xFE,0xEF,0x98,0x0F,0x9B,0x97,0x05,0xE2,0x07,0x94,0x58,0xB1,0xDC,0x0B,0x0E,0x0B,0xC3,0x0E,0x0B,0x0E,0x11,0xFE,0x29,0x43,0x05,0xC2,0x3F,
+0xC0,0x51,0x28,0x0E,0xC1,0x19,0x84,0x8B,0x85,0x9A,0x0A,0x15,0xB4,0x75,0x11,0x2D,0x19,0xC0,0x9D,0x89,0x97,0x98,0x0B,0x0E,0xC0,0x0B,0x0E,0x11,0x2B,0x9B,0x9A,0xC5,
+0x2B,0xAB,0x86,0x05,0xD9,0x36,0x0B,0x0E,0x0C,0x36,0x91,0x9C,0x36,0x11,0x0C,0x0B,0x0E,0x0B,0xC5,0x61,0x0B,0x33,0x2B,0x05,0xC6,0x20,0xC0,0x05,0xD8,0x13,0x0F,0x91,
+0xDD,0xC0,0x0F,0x22,0x05,0xE2,0x3F,0xAC,0x86,0x9C,0x47,0x95,0xBB,0x05,0xAC,0x87,0x2D,0x0B,0xC0,0x12,0x9D,0x97,0xFE,0x5B,0x4A,0xC0,0x37,0x3A,0x0E,0xC1,0x0B,0x0C,
+0x21,0x7D,0x0E,0x12,0xFE,0x41,0x45,0x26,0x24,0x8E,0x8B,0x97,0x9C,0xE2,0xA6,0x87,0xAD,0x85,0x97,0x7B,0x9D,0x77,0x05,0xC0,0x36,0xFE,0xBE,0x54,0xAD,0x98,0x0E,0x93,
+0x79,0x37,0xB1,0x76,0xC1,0x9A,0x99,0x33,0xC0,0x11,0x37,0x2A,0x12,0x0B,0x0E,0x2D,0x3C,0x1E,0x8B,0x9B,0x05,0xE2,0x3A,0x22,0x98,0x59,0x2E,0x95,0xBB,0x05,0xC0,0x36,
+0xFE,0xBE,0x54,0xAD,0x98,0xC2,0x04,0x0B,0x0E,0xC0,0x0B,0xC0,0x12,0x0E,0x0B,0xC1,0xFE,0x4A,0x86,0x14,0xFE,0x4C,0x07,0xA3,0x52,0xFE,0x12,0x02,0x19,0x05,0xA8,0x88,
+0x37,0x0B,0xC2,0x0E,0xC1,0x0B,0xC1,0x0E,0x0B,0x2B,0x30,0x14,0x05,0xC6,0x13,0x92,0x6A,0x2C,0xFE,0x76,0x86,0x9D,0x9B,0x12,0x95,0xBF,0x98,0x99,0x24,0x33,0xB8,0x76,
+0x0B,0x0E,0x0B,0x0E,0x0B,0xC1,0x0E,0xC0,0x21,0x84,0x99,0x94,0x59,0x10,0xA4,0x86,0x24,0x2A,0x24,0x99,0xBB,0x0A,0x05,0xC0,0xAF,0x84,0x05,0xB8,0x21,0xFE,0x76,0x87,
+0x18,0x0D,0x69,0xC1,0x98,0x9B,0x30,0xBC,0x86,0x12,0x79,0x0B,0xC2,0x95,0x8B,0x84,0x79,0x14,0x37,0xB1,0x30,0xAC,0x66,0x92,0xBD,0x8D,0xEF,0x05,0xC0,0x10,0x28,0x05,
+0xC0,0xA8,0x88,0x14,0xAE,0x43,0x0D,0x18,0xC4,0x0D,0xFE,0x5B,0xA9,0x2D,0xAA,0x97,0x0B,0xC0,0x93,0x89,0x3E,0x89,0x9B,0x05,0x10,0xFE,0x3C,0x62,0x06,0x18,0x97,0x9A,
+0xFE,0x02,0x00,0x0F,0x14,0x59,0xAA,0x55,0x28,0x05,0xA9,0xC9,0x13,0xC0,0x22,0xA4,0x98,0xA0,0x65,0x05,0xD9,0xB8,0x10,0xFE,0x6E,0x27,0x18,0xC3,0x06,0x97,0x8A,0x92,
+0xBD,0x9A,0xBE,0x10,0x0F,0x05,0x10,0xFE,0x65,0xA7,0x18,0xC5,0x95,0xAD,0x0C,0x30,0x11,0x93,0x86,0x9B,0x47,0x93,0xAB,0x14,0x2E,0x0E,0x1F,0x18,0xC2,0x9D,0x9A,0xFE,
+0x1A,0xC1,0x05,0xC0,0x0A,0xA4,0x88,0x2E,0x19,0x05,0xD7,0xA9,0x85,0xAF,0x87,0x97,0x9C,0x17,0x9D,0x9A,0xD8,0x10,0x36,0x18,0xC8,0x15,0xFE,0x01,0x00,0x10,0x0C,0xB3,
+0x52,0xAC,0x62,0x18,0xC4,0x2C,0x16,0x9F,0x67,0x36,0x18,0x0D,0x95,0x99,0x12,0x1A,0x18,0xC4,0x39,0x19,0x05,0xC0,0x17,0x10,0x2A,0x0A,0x05,0xD6,0xB7,0x72,0x06,0x18,
+0xC4,0x06,0xFE,0x22,0xC2,0xFE,0x00,0x60,0x37,0x0C,0xFE,0x55,0x63,0x1F,0x18,0xC3,0x0E,0xFE,0x6B,0xAB,0x16,0xFE,0x5C,0xE8,0x18,0xC0,0x0D,0x92,0x9A,0x1F,0x18,0xC4,
+0x0D,0xFE,0x0A,0x00,0x0F,0x62,0xC1,0xAF,0x54,0x37,0x0F,0x05,0xC7,0x6E,0x05,0xCA,0xB0,0x74,0x39,0x18,0xC6,0x99,0x9C,0xFE,0x02,0x00,0x0F,0x05,0xAF,0x33,0x12,0x0D,
+0x18,0xC2,0x2C,0xFE,0x4C,0x07,0x16,0xA3,0x61,0x1F,0x18,0xC0,0x97,0x9A,0xC0,0x18,0xC4,0x0D,0x8D,0x9C,0x0F,0x05,0xC1,0x32,0x0C,0x19,0x05,0xD3,0x17,0xB5,0x85,0x06,
+0x05,0xC0,0x28,0xB1,0x54,0x0D,0x18,0xC2,0x99,0x9C,0xFE,0x4C,0x07,0x1C,0x18,0xC1,0x99,0x9C,0x3E,0x0E,0x1F,0x18,0xC3,0x0E,0x37,0x99,0xBB,0x05,0x14,0x0A,0x2E,0x9C,
+0x88,0x97,0xCC,0x14,0x0A,0x05,0xD0,0xB0,0x74,0x22,0x9B,0x9A,0x53,0x9D,0xA9,0xC0,0x26,0xA0,0xC7,0x70,0x79,0xA3,0x99,0xA0,0xB7,0x7A,0x61,0xC1,0xA3,0x98,0xC0,0x56,
+0x05,0xC1,0x29,0x18,0xC2,0x99,0x9B,0xFE,0x01,0x60,0x13,0xB7,0x64,0x0D,0x18,0xC2,0x2C,0xFE,0x09,0x81,0x0F,0x62,0xC1,0xA5,0x87,0x31,0x0F,0x05,0xD2,0x1E,0x55,0x07,
+0x05,0xDA,0x28,0x1A,0x18,0xCB,0x25,0x37,0x05,0xC0,0x0A,0x0C,0xFE,0x65,0xA7,0x0E,0x1F,0x18,0xC2,0x9D,0x9A,0x18,0xC0,0x97,0x9A,0xFE,0x01,0x00,0x05,0x24,0xB0,0x75,
+0x18,0xC2,0x06,0xFE,0x0A,0xA0,0x05,0xC0,0x6E,0x05,0xC0,0xB4,0x42,0x0D,0x18,0xCC,0x8A,0x9E,0xFE,0x00,0x60,0x05,0xC0,0x2B,0xFE,0x6D,0x69,0x06,0x97,0x8A,0x0D,0x18,
+0xC4,0x92,0x9E,0x19,0x05,0xC0,0xA8,0x55,0xB6,0x31,0x0D,0x18,0xC1,0x29,0x0F,0x05,0xC2,0x2B,0x2E,0x19,0x05,0xD0,0xB0,0x74,0xA2,0xF7,0xFE,0x99,0x61,0x71,0xC0,0x25,
+0xFE,0x01,0x60,0x0F,0x05,0xC0,0xBF,0x20,0x18,0xC0,0x97,0x9A,0xC0,0x18,0x9D,0x9A,0x18,0xC1,0x8A,0x9E,0xFE,0x00,0x40,0x05,0x0A,0x05,0xA8,0x55,0xB0,0x43,0x36,0x18,
+0xC0,0x8F,0xAD,0x19,0x0A,0x05,0xC2,0x2E,0x9C,0x88,0x05,0xC0,0x14,0x1A,0x15,0x0F,0x05,0xC0,0xB8,0x21,0x1F,0x18,0xC0,0x99,0x9C,0x35,0xA9,0x97,0x18,0xC0,0x25,0xFE,
+0x01,0x60,0x05,0xC4,0x31,0xB7,0x31,0x1F,0x35,0xFE,0x09,0x21,0x0A,0x05,0xC2,0x37,0xA7,0x54,0x0F,0x05,0x14,0x05,0xC5,0xAA,0x66,0xB5,0x42,0xA3,0x52,0x19,0x0A,0x05,
+0xC2,0x0A,0x0C,0x94,0xAA,0x05,0xCF,0x22,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xFE,0x00,0x20,0x0A,0x05,0xA2,0x77,0x05,0xC2,0x37,0x13,0x9C,0xAB,0x0A,0xC0,0x05,0xC2,0xAB,
+0x55,0x24,0x19,0x05,0x0A,0x05,0xCC,0xAB,0x86,0xA7,0xF6,0xFE,0xA1,0x60,0x05,0xC5,0x14,0x20,0x24,0x19,0x05,0x0A,0x05,0xC0,0x31,0x37,0x05,0xC2,0xA3,0x87,0x05,0xC4,
+0x2A,0x24,0x0F,0x05,0xC1,0x10,0x2A,0x0A,0x05,0x0F,0x05,0xC7,0x2A,0x10,0x14,0x05,0xC1,0x31,0x0F,0x05,0x12,0x06,0x0F,0x0A,0x05,0xC5,0x31,0x37,0x05,0xC1,0x10,0x24,
+0x17,0x1A,0x0E,0x13,0x0F,0x05,0xC5,0x2B,0x31,0x19,0x05,0xC0,0x10,0x2E,0x0F,0x37,0x05,0x0F,0x05,0xC1,0x0C,0x2E,0xA0,0x55,0x13,0x24,0x19,0x0A,0x14,0xA6,0x44,0x0A,
+0x37,0x2E,0x05,0x14,0x0A,0x05,0x15,0x2E,0xC0,0x14,0x2B,0xA6,0x56,0xC0,0x2A,0x24,0x06,0x37,0x10,0x0A,0x05,0xCD,0xB5,0x84,0x05,0xC2,0x20,0xA9,0x55,0x19,0x05,0xC4,
+0x06,0x24,0x0C,0x19,0x05,0xCD,0x36,0x27,0x97,0x9B,0x05,0xE0,0xA5,0x88,0x12,0xAE,0x75,0x18,0xCC,0x12,0x18,0xD2,0x0D,0x13,0x05,0xC2,0x31,0x37,0x05,0xC0,0x0F,0xAA,
+0x98,0x31,0x10,0x59,0x37,0x19,0x10,0x44,0x05,0xBB,0x83,0x95,0x8A,0x05,0xC0,0x14,0x05,0xDE,0xB8,0x10,0x0D,0x18,0xCC,0x0E,0x25,0x18,0xD1,0x99,0x9C,0xFE,0x01,0x00,
+0x05,0xC1,0x10,0x59,0x0A,0x05,0xC2,0xA5,0x87,0xC0,0x10,0xC1,0x2E,0xA0,0x55,0x05,0x14,0x05,0xC0,0x2B,0xA2,0x79,0xC3,0x13,0x0F,0x05,0xCB,0xA9,0x85,0xB1,0xA6,0x1F,
+0x18,0xCC,0x8F,0x9C,0x1A,0x18,0xD0,0xFE,0x23,0x41,0x19,0x9C,0xAA,0xAB,0x55,0x24,0x05,0xC4,0x0F,0x3F,0x10,0xC0,0x03,0x32,0x03,0x0C,0x10,0x05,0xCB,0xB0,0x74,0xA9,
+0xD6,0x0D,0x18,0xCC,0x92,0x9B,0xA1,0xAD,0x0E,0xC0,0x35,0xC3,0x24,0xC4,0x9D,0x9A,0x24,0x39,0x0E,0x12,0x92,0x9D,0x9B,0xCD,0x2A,0x0C,0x28,0x2B,0x51,0x05,0xC3,0x0A,
+0x05,0xC0,0x2B,0x28,0x05,0x24,0x2E,0x19,0x05,0xCA,0x1E,0x9B,0xF7,0x0E,0x1F,0x18,0xCB,0x97,0x9A,0x39,0x1F,0x0D,0xC1,0x69,0x18,0x1A,0x18,0xC0,0x1A,0x18,0xC0,0x1A,
+0xC0,0x18,0x0D,0x29,0xFE,0x09,0x81,0xC1,0x2E,0x2A,0xC0,0x2E,0x31,0x0C,0x2E,0xA0,0x55,0x06,0x05,0x24,0x06,0x24,0xC0,0x0C,0xC0,0x06,0xC1,0x0F,0x05,0xC8,0xAB,0x86,
+0x22,0xFE,0x99,0x61,0x0F,0xA6,0x66,0x24,0x0C,0xAF,0x77,0x9C,0x89,0xC0,0xA6,0x77,0x6E,0xA3,0x99,0xA4,0x88,0xA2,0x78,0x7E,0x66,0xC2,0x01,0x9C,0x88,0xC0,0x00,0x18,
+0x9C,0xA8,0x26,0xC0,0x07,0x00,0x19,0x01,0xC9,0x19,0x00,0x9D,0x99,0x07,0x26,0xC0,0xA2,0x98,0x1D,0x00,0x28,0xC0,0x39,0xC0,0x3C,0xC9,0x01,0xD0,0x07,0x39,0x01,0xC8,
+0x3C,0x01,0xC1,0x3C,0xC0,0x64,0x00,0xC0,0x9F,0xA6,0x9D,0xA9,0xA3,0x77,0xA4,0x78,0x7E,0xA3,0x98,0xC1,0x69,0xC1,0xA2,0x78,0x2B,0xC0,0x24,0x35,0x2B,0x4F,0xC1,0x9F,
+0x9B,0xC1,0x3C,0x01,0xC8,0x93,0xA9,0x3C,0x01,0xCA,0xA1,0xA6,0xC1,0x2B,0x9C,0x77,0x69,0x65,0x53,0x13,0x49,0x9B,0x9A,0xC0,0x50,0x51,0xC4,0x05,0x20,0xA4,0x84,0x06,
+0xA4,0x86,0x26,0x39,0xA4,0x96,0xA2,0x78,0x35,0x2B,0x4F,0x3A,0xC0,0x3C,0x01,0xC4,0x00,0xC0,0x01,0xC6,0x3E,0xC0,0x2B,0x0F,0x26,0x06,0x9B,0x9A,0x9C,0x87,0x9C,0x8A,
+0x9D,0x9A,0x6E,0x05,0xD3,0xA5,0x87,0xA2,0x88,0xA8,0x85,0xA5,0x87,0x0F,0xA3,0x98,0x35,0x2B,0x4F,0x9F,0x9B,0x01,0xC1,0x18,0x3C,0x01,0xC0,0x3A,0xC0,0x3E,0x2B,0x39,
+0x63,0x06,0x9B,0x9A,0x9C,0x87,0x05,0xD6,0x0A,0x05,0xC7,0x31,0xA8,0x87,0x26,0x16,0x27,0x0F,0x06,0x47,0x07,0x3C,0x01,0x69,0x24,0x22,0x20,0x50,0x17,0x9D,0x9A,0xC7,
+0x0A,0x05,0xC6,0x0A,0x05,0xC7,0x0A,0x05,0xC8,0x0A,0x05,0xC0,0xA9,0x85,0xAB,0x86,0x0F,0x16,0xA1,0x6C,0xC0,0x3C,0x3E,0x05,0x97,0x9C,0xC9,0x0A,0x05,0xD4,0x0A,0x05,
+0xC9,0x0A,0x05,0xC0,0xAB,0x86,0x22,0x24,0xC0,0x01,0xC1,0x31,0x88,0xBB,0x05,0xCA,0x0A,0x05,0xCA,0x0A,0x05,0xCB,0x0A,0x05,0xC9,0xA5,0x87,0xAA,0x85,0x0F,0xA3,0x98,
+0x35,0x9E,0x7C,0xC0,0x01,0xCB,0x8F,0xAA,0xA2,0x97,0x1D,0xC5,0x01,0xC1,0x0F,0x17,0x05,0xC8,0x0A,0x05,0xCD,0x0A,0x05,0xCE,0x0A,0x05,0xC7,0x7F,0x20,0x0F,0x2B,0x35,
+0x3E,0x3C,0x01,0xC4,0x3A,0x01,0xC0,0x19,0x3D,0x40,0x18,0x1D,0xC5,0x01,0xC1,0x0F,0x17,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC7,0x0A,
+0x05,0xC6,0xAB,0x84,0x39,0xA8,0x76,0x31,0xC0,0x3C,0x01,0x3C,0x01,0xC2,0x19,0x3D,0x1F,0x1D,0xC7,0x01,0xC0,0x3C,0x9D,0x95,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC8,
+0x0A,0x05,0xC7,0x14,0x05,0xC9,0x0A,0x05,0xC2,0xAF,0x84,0x0F,0x35,0x9E,0x7C,0xC0,0x3C,0xC1,0x01,0x19,0x1F,0xA4,0x88,0x1D,0xC8,0x01,0xC0,0x3A,0x22,0x05,0xF7,0x0A,
+0x05,0xC0,0xA6,0x87,0x22,0x24,0x3E,0xC0,0x01,0xC0,0x19,0x26,0x07,0xA3,0x89,0x1D,0xC8,0x01,0xC0,0x69,0x06,0x05,0x0A,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x0A,
+0x05,0xC7,0x14,0x05,0xCB,0x0A,0x05,0xC1,0x20,0x0F,0x38,0x31,0x28,0x26,0x07,0x1D,0xCA,0x01,0xC1,0x20,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x0A,0x05,0xC7,0x14,
+0x05,0xCD,0x0A,0x05,0xC1,0xA5,0x87,0x22,0x24,0x99,0x89,0x02,0x1D,0xCB,0x01,0xC0,0x3E,0x8D,0x99,0x97,0x9C,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCE,0x0A,0x05,0xC7,0x14,
+0x05,0xCF,0x0A,0x05,0xAE,0x85,0x24,0xC0,0x06,0x1D,0xCA,0x01,0x3A,0x9E,0xA6,0x17,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xD0,0x0A,0x05,0xC7,0x14,0x05,0xCD,0xA6,0x87,
+0x22,0xAA,0x74,0x20,0x1D,0xC9,0x01,0x66,0x9D,0x95,0x0A,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xD2,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x0A,0x05,0xC0,0x14,0xB2,0x71,0x27,
+0x20,0x9D,0x6D,0x1D,0xC7,0x3C,0x6D,0x22,0x0A,0x05,0xC8,0x0A,0x05,0xC7,0xA6,0x87,0x22,0x2B,0x05,0xCB,0x0A,0x05,0xC7,0x7F,0x05,0xD4,0xAE,0x85,0x24,0x0F,0x1A,0x1D,
+0xC6,0x01,0xC0,0x90,0xA7,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0x2B,0xB8,0x74,0xA2,0x97,0x12,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xD5,0xA9,0x97,0x24,0xC0,0x1A,0x1D,
+0xC5,0x01,0x3E,0x8D,0x99,0x97,0x9C,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC0,0xFE,0x7C,0x2B,0xBA,0x86,0x8B,0x9A,0x8B,0xAA,0x90,0x8C,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,
+0xCF,0x0A,0x05,0xC0,0x14,0x05,0xC3,0x3F,0xB1,0x85,0xA3,0x95,0x98,0x5C,0x1D,0xC4,0x01,0x31,0x88,0xBB,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC1,0x1E,0x15,0xA2,0x9A,
+0x91,0x98,0x86,0x79,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xD7,0x0A,0xA5,0x98,0x0F,0x16,0x19,0x1D,0xC3,0xA9,0x99,0x07,0x0A,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC1,
+0x13,0x15,0xA2,0x9A,0xA2,0x77,0x93,0x8A,0x24,0x1F,0x05,0xC2,0xA5,0x88,0xAB,0x99,0x96,0x87,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xD1,0x3A,0x0F,0xC0,0x1A,0x1D,0xC2,
+0xAA,0x87,0x22,0x0A,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC1,0x36,0xFE,0xD6,0xF5,0xA8,0x99,0xC1,0x34,0x87,0x89,0x8A,0x9A,0x17,0x05,0xC1,0x20,0x0F,0x97,0x99,0x05,
+0xCB,0x0A,0x05,0xC7,0x14,0x05,0xCC,0xA6,0x87,0x0F,0x16,0x19,0x1D,0xC0,0x9D,0xA9,0x3E,0x8D,0x99,0x97,0x9C,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC0,0xA9,0x97,0x0B,0xAD,
+0x98,0x0E,0xC1,0x9A,0x89,0x88,0x77,0x89,0x9A,0x97,0x9C,0xC2,0x1E,0xB2,0x85,0x22,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCF,0x3F,0x0F,0xA3,0x95,0x98,0x5C,0x1D,0xC0,
+0xAB,0x85,0x17,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x3F,0xFE,0xBE,0x31,0x0B,0x0E,0x0B,0x0E,0x0B,0x15,0x1F,0x89,0x9A,0x97,0x9C,0xC1,0xAE,0x85,0xFE,0xBE,0x54,0xA3,0x96,
+0x1E,0x17,0x05,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x3F,0x0F,0x16,0x1D,0xC0,0xA9,0x99,0x9D,0x95,0x0A,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC1,0x2B,0x3D,0xB3,0x8B,
+0x0E,0x0B,0x0E,0x0B,0xC0,0x15,0x8B,0x9A,0x84,0x8A,0x97,0x9C,0xC0,0x2B,0xBF,0x84,0xB8,0x99,0x34,0x87,0x89,0x87,0xAC,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCE,0xA9,
+0x97,0x24,0x39,0x18,0x1D,0xC1,0xAA,0x87,0x22,0x0A,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC2,0xFE,0x9D,0x2D,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x9D,0x88,0x00,0x12,0x05,
+0xC0,0xB5,0x84,0xFE,0xE7,0x38,0x0B,0x34,0x3C,0x1F,0x05,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x20,0x27,0x97,0x9B,0x1A,0x1D,0xC0,0x3A,0x2C,0x05,0xC6,0x0A,0x05,0xC7,
+0x14,0x05,0xC4,0x00,0xB8,0x99,0x0E,0xC1,0x0B,0x0E,0x0B,0xC0,0x2B,0x00,0x83,0x9B,0x17,0xA3,0x99,0x3D,0x0B,0x0E,0x19,0x3C,0x31,0x05,0x0A,0x05,0xC0,0x14,0x05,0xC7,
+0x0A,0x05,0xC7,0x14,0x05,0xCA,0x06,0x27,0x20,0x1A,0x1D,0xAB,0x85,0x1F,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xFE,0x7C,0x2B,0x04,0x0E,0xC1,0x0B,0x0E,0x0B,0xC0,
+0x0E,0x2B,0x87,0x99,0x85,0x8A,0x17,0xB5,0x85,0x15,0xA2,0x9A,0x04,0x34,0x1F,0x89,0x9A,0x97,0x9C,0xD0,0x0A,0x05,0xC7,0x14,0x05,0xC6,0xB5,0x84,0xA6,0x84,0x18,0x1D,
+0x01,0xC1,0x66,0x01,0xC1,0x3C,0x01,0xC2,0x3C,0x01,0xC3,0x3C,0x01,0xC1,0x0F,0x17,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xBD,0x73,0x04,0x0E,0x0B,0x2B,0x9A,0x8A,
+0x42,0xA3,0xA8,0x0B,0xC1,0x15,0x1F,0x84,0x9B,0xA5,0x87,0xFE,0xBD,0xD1,0x0B,0x0E,0x0B,0x15,0x3C,0x31,0x99,0x9C,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCE,0xA5,0x87,0x24,
+0xC0,0x1A,0x1D,0xC3,0x01,0xD1,0x66,0x01,0xC0,0x98,0xA5,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC2,0xBB,0x84,0xFE,0xEF,0x98,0x92,0x9B,0x93,0x88,0x8F,0x8A,0x17,0x05,
+0x3F,0xAD,0x79,0xB2,0xA7,0x2D,0x3A,0x0C,0x8A,0x76,0x85,0x9C,0xB7,0x87,0xBF,0x96,0x04,0x0E,0x0B,0x34,0x1E,0x17,0x9D,0x9A,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCE,0xA9,
+0x97,0x27,0x20,0x1A,0x1D,0xC2,0x01,0xD3,0x3E,0x8D,0x99,0x97,0x9C,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC2,0x07,0x7E,0x97,0x9C,0x36,0xA4,0x7A,0xC0,0x93,0xAA,0x14,0x05,
+0xC1,0x25,0x33,0xAB,0x76,0x24,0x90,0x8C,0xFE,0xBE,0x31,0x9B,0x98,0xB3,0x8B,0x0E,0xC0,0x93,0x79,0x80,0xA7,0x05,0xCD,0x6E,0x05,0xC7,0x14,0x05,0xC9,0x22,0x24,0x99,
+0x89,0x1D,0xC0,0x26,0xC0,0x01,0xD2,0x3C,0x1E,0x17,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xB5,0x84,0xBF,0x86,0x3A,0xA2,0x78,0xC1,0x2B,0x9A,0x8A,0x97,0x98,0x29,
+0x8C,0x9A,0x05,0xC0,0x3F,0xAC,0x86,0x13,0x07,0xB6,0xA7,0x0B,0x0E,0xC1,0x22,0x06,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCF,0xB8,0x73,0xA3,0x98,0x8F,0x8D,0x56,0xA4,
+0x98,0x25,0xA7,0x67,0x28,0x3C,0x01,0xC0,0x3C,0x01,0xC9,0x69,0x01,0xC0,0x3C,0x20,0x05,0xCD,0x0A,0x05,0xC7,0x14,0x05,0x07,0xFE,0xEF,0x98,0x04,0x0B,0x0E,0x0B,0xC1,
+0x0E,0x0B,0x0C,0x33,0x89,0x89,0x94,0x88,0x05,0x06,0x27,0x34,0x0E,0xC2,0x0B,0x8D,0x96,0x2C,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCE,0x16,0x27,0x13,0x25,0xC1,0x99,
+0x78,0x26,0xA2,0x97,0xA2,0x78,0xA3,0x89,0x00,0xC0,0x01,0xCB,0x3E,0x8F,0x9A,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x1E,0x15,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC1,
+0x7B,0x9B,0x8B,0x91,0x87,0x13,0x3F,0xBD,0x84,0x31,0x0B,0xC0,0x0E,0x0B,0xC0,0x2B,0x80,0x88,0x8C,0x8A,0x9C,0x8A,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCD,0xB3,0x84,
+0x24,0x25,0xC1,0x01,0xC1,0xA1,0x85,0x88,0xBB,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x1E,0xFE,0xEF,0x98,0x04,0x0B,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC0,0x15,0xC0,
+0x9C,0x78,0x9B,0x99,0xA7,0x97,0x34,0x04,0x0E,0x0B,0x0E,0x0B,0x30,0x8F,0x87,0xA9,0x88,0x17,0x05,0xCB,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x1E,0x9C,0x88,0x25,0xC7,0x9C,
+0x87,0x18,0x27,0xA3,0x88,0xA3,0x95,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC6,0xBF,0x82,0xBD,0x9A,0x0B,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC0,
+0x0B,0xC1,0x0E,0xC0,0x88,0x8B,0x17,0xB9,0x87,0xAF,0x94,0x86,0x9A,0x8F,0x8E,0xC7,0x6E,0x05,0xC7,0x14,0x05,0xCE,0xAE,0x85,0x24,0x0F,0x25,0xC5,0x9A,0x77,0x62,0xA4,
+0x88,0x36,0x06,0x65,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC6,0x0C,0x2B,0x9A,0x8A,0x2D,0xC0,0xA3,0xA8,0x0B,0xC1,0x0E,0xC0,0x0B,0xC0,0x61,0x0B,0x0E,0x0B,0x0E,0x0B,
+0xC1,0x93,0x89,0xFE,0x18,0xE2,0x30,0xBC,0x78,0x04,0x8A,0x87,0x81,0x9C,0x97,0x9C,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCD,0x1E,0x9C,0x88,0x25,0xC3,0x9C,0x88,0x15,0xC1,
+0x26,0x3D,0x36,0x92,0x89,0x17,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xA5,0x87,0x22,0x13,0x3F,0x05,0x0A,0x15,0x30,0x2A,0xA4,0x87,0x7B,0x0B,0x0E,0x0B,0xC0,0x0E,
+0x0B,0xC1,0x0E,0xC0,0x9D,0x88,0x36,0xA7,0x9C,0xFE,0xEF,0xBB,0x04,0x0E,0x9A,0x89,0x88,0x77,0x85,0x9C,0x9B,0x9A,0xC6,0x0A,0x05,0xD8,0x06,0xAD,0x84,0x29,0x25,0xC1,
+0x3D,0x9C,0x88,0xC2,0x3D,0x02,0x22,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xC3,0x2B,0xB8,0x74,0x33,0x2D,0xC0,0x11,0x00,0x14,0xB8,0x65,0x2A,0x0B,0xC0,0x0E,0x0B,0xC0,
+0x0E,0x0B,0xC1,0x0E,0x0B,0x8E,0x99,0x25,0x19,0x0B,0xC0,0x0E,0x0B,0x93,0x89,0x80,0xA7,0x05,0xE1,0x14,0x0F,0xA3,0x95,0x25,0xC0,0x02,0x15,0xC3,0x3D,0xA7,0x85,0x0A,
+0x05,0xC8,0x6E,0x05,0xC7,0x14,0x05,0xC5,0x3F,0xBD,0x84,0xBA,0x9E,0xC2,0x54,0x37,0x82,0x79,0x36,0x0C,0xA8,0x76,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC0,0xFE,
+0x6B,0xAB,0x2D,0xAB,0xA7,0xC0,0x0B,0x9C,0x86,0x33,0x0F,0xA9,0x85,0x91,0x9A,0x97,0x9C,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xCB,0x20,0x27,0x29,0x02,0x9B,0x99,0xC4,0x3D,
+0x36,0x92,0x89,0x17,0x05,0xD9,0x31,0xFE,0xAD,0x8E,0xFE,0xFF,0xFF,0xC3,0x1B,0x0C,0x81,0x6A,0x28,0xFE,0xEF,0xBB,0x04,0x0E,0x5B,0x0B,0x7B,0x0B,0x0E,0xC0,0x34,0x11,
+0xB3,0x98,0x0B,0x0E,0x21,0x82,0x89,0x3A,0x19,0x3E,0x39,0x8B,0x9E,0x62,0xE0,0x14,0xB7,0x73,0x9E,0x85,0x94,0x8F,0x56,0x76,0xC3,0x13,0x22,0x90,0x8B,0x05,0xCC,0x0A,
+0x05,0xC7,0x14,0x05,0xC1,0xA9,0x97,0xFE,0xBD,0xD1,0x31,0xC1,0x1B,0x37,0x8F,0x56,0xA3,0x55,0xA9,0xAC,0x8C,0xBC,0x33,0x12,0x7A,0xC0,0x0B,0xC0,0x15,0x0B,0x0E,0x92,
+0x76,0x0B,0xC1,0x33,0x32,0xB7,0x98,0xB9,0x86,0x0D,0x0B,0x21,0x3C,0x05,0xE1,0x06,0x27,0x8C,0x9D,0x9F,0x9C,0xC4,0x13,0x6C,0x8F,0x8E,0xC9,0x6E,0x05,0xC7,0x14,0x05,
+0xC5,0x3F,0x22,0xB1,0x8E,0xC1,0x3D,0x83,0x24,0x55,0x50,0x28,0x23,0x18,0x0C,0x0B,0xC0,0x7B,0xC0,0x0B,0xC0,0x04,0x92,0x87,0x0B,0xC0,0x11,0x3A,0x33,0xB3,0x89,0xA5,
+0x87,0x1B,0xC0,0x33,0x83,0x86,0x08,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x3A,0x24,0x06,0x98,0x9C,0xC4,0xA4,0x87,0x6B,0xCC,0xA9,0x84,0x94,0x89,0x97,0x9C,0xCA,
+0x0A,0x05,0xC7,0x14,0x05,0xC4,0x20,0x31,0xAE,0x9F,0xC1,0x21,0xFE,0x1B,0x41,0x96,0xBC,0x93,0xEF,0xB1,0x44,0x30,0x37,0x30,0xBE,0x77,0x7A,0xC1,0x0B,0xC0,0x9C,0x86,
+0x34,0x0E,0x93,0x79,0x3A,0xA9,0x54,0x07,0xA5,0x79,0x2D,0xAB,0xA7,0x31,0xC0,0x11,0xFE,0x29,0x43,0x05,0xCE,0x0A,0x05,0xC7,0x14,0x05,0xC6,0x36,0xA3,0x88,0x91,0x9A,
+0x9F,0x9C,0xC1,0x3D,0xCB,0x69,0xA3,0x88,0xA6,0x85,0x08,0x5A,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC6,0x3C,0xB7,0x86,0xB7,0x8B,0x31,0xC0,0x0B,0x88,0x01,0x9B,0x9A,0x97,
+0xDE,0xAA,0x53,0x23,0x1B,0xFE,0x6B,0xAB,0x33,0x19,0x68,0x7B,0x0B,0x0E,0x34,0xA4,0x87,0xA2,0x9A,0xFE,0x5B,0x4A,0x05,0x99,0x33,0x9A,0x79,0xA0,0xBB,0xAD,0xA8,0xFE,
+0xEF,0xBB,0xA2,0x9B,0xC0,0x98,0x85,0x07,0x89,0xAD,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCC,0xA6,0x87,0x27,0x8E,0x9C,0x9D,0x9D,0xC1,0xA4,0xB8,0xC0,0x02,0xC1,0x3D,0xC7,
+0xA7,0x85,0x9D,0xA9,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x05,0xC0,0xB0,0x74,0xBB,0x95,0x97,0x9B,0xB3,0x8A,0x31,0x33,0x83,0x86,0x9D,0x01,0x2C,0xA5,0x97,0x2D,0x31,0x37,
+0x2D,0xAB,0xA7,0x0B,0x0E,0x0B,0xC0,0x92,0x86,0x0B,0x11,0x9C,0x99,0xAB,0x76,0x08,0x92,0xBD,0xA8,0x66,0xAA,0x52,0xFE,0xE7,0x79,0xA4,0x9C,0xC0,0x3D,0x86,0x87,0x8C,
+0x89,0x17,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x1E,0x98,0x97,0x97,0x8E,0xC1,0xA4,0xB8,0xC2,0x7A,0x06,0xC1,0x02,0xC0,0x66,0x02,0xC1,0xAB,0x84,0x91,0x9A,0x97,
+0x9C,0xC0,0x6E,0x05,0xD9,0x13,0xFE,0xCE,0xB3,0xA8,0x9A,0x11,0x30,0x2D,0x0C,0x33,0x23,0x2D,0xAB,0xA7,0xA0,0x8C,0x9B,0x87,0x11,0xB4,0x87,0x69,0xC0,0x0E,0x0B,0x92,
+0x86,0xAB,0x9A,0x30,0xBC,0x78,0x33,0x3E,0x9D,0x01,0xC0,0x23,0x1B,0xC0,0x37,0x21,0xA5,0x78,0x80,0xA7,0x8F,0x8E,0xC7,0x6E,0x05,0xC7,0x14,0x05,0xCD,0xB3,0x84,0xA5,
+0x96,0x3F,0xA1,0x9A,0xC0,0x09,0x06,0x09,0xC0,0x06,0x09,0xC1,0x06,0x09,0x06,0xC1,0xA3,0x57,0xA6,0x85,0x8B,0xAD,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC9,0x22,0x34,
+0x0E,0xC0,0x2A,0x0B,0x95,0xAB,0xC0,0x11,0x37,0x2D,0xA2,0x97,0x37,0x33,0xB8,0x76,0x69,0xC0,0x0E,0xC0,0x31,0x3D,0x30,0xBC,0x78,0xA2,0x9B,0x9B,0x87,0x21,0xA5,0x78,
+0x33,0x2D,0x93,0xA9,0x2D,0x12,0x3A,0x84,0x78,0x17,0x9D,0x9A,0xE0,0x20,0x27,0x3F,0x15,0xC0,0x09,0xC0,0x06,0x09,0x06,0x09,0xC1,0x06,0x09,0xC0,0x06,0xC0,0x36,0x22,
+0x05,0xCB,0x0A,0x05,0xC7,0x14,0x05,0xC5,0x36,0xFE,0xE7,0x38,0xA6,0x77,0x0E,0x0B,0xC0,0x0E,0x0B,0x2A,0x3D,0x2D,0x9E,0x86,0x3D,0x3A,0xA2,0x78,0x0E,0x0B,0xC0,0x0E,
+0x92,0x76,0x0B,0x3D,0x33,0x11,0x37,0xC0,0x33,0xC0,0x2D,0x12,0xC0,0x0B,0xC0,0x8F,0xA8,0xFE,0x29,0x81,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCB,0xA6,0x87,0x35,0x12,
+0x15,0xC0,0x09,0xC0,0x06,0x09,0xC1,0x06,0x09,0xC1,0x06,0x09,0xC0,0xAC,0x33,0x91,0x9A,0x97,0x9C,0xCB,0x0A,0x05,0xC7,0x14,0x05,0xC5,0x1E,0xFE,0xE7,0x76,0x0E,0xC2,
+0x0B,0x0E,0xC0,0x0B,0xC1,0x7B,0x0B,0x0E,0xC2,0x0B,0x31,0x0B,0xC1,0x2A,0x3D,0x19,0x0B,0xC1,0x15,0x0B,0x0E,0xC0,0x34,0xFE,0x4A,0x85,0x05,0xCC,0x0A,0x05,0xC7,0x14,
+0x05,0xC7,0xA5,0x87,0xB8,0x74,0x92,0x97,0x99,0x9F,0xC0,0x09,0xC0,0x06,0x09,0xC1,0xA2,0x88,0x04,0x17,0x05,0xCD,0x0A,0x05,0xC7,0x14,0x05,0xC3,0x3C,0xBE,0x98,0xA3,
+0x88,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x31,0x0B,0xC2,0x7B,0x0B,0x0E,0xC0,0x0B,0x15,0x0B,0x0E,0xC0,0x2B,0x83,0x86,0x17,
+0x05,0xCE,0x0A,0x05,0xC7,0x14,0x05,0xC5,0x1E,0x98,0x97,0x97,0x8E,0xC4,0xA4,0x88,0x09,0xC0,0x06,0x09,0xC1,0xA9,0x44,0x0A,0x05,0xCA,0x6E,0x05,0xC7,0x14,0x05,0xC7,
+0x3C,0x2B,0x04,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC1,0x0B,0x0E,0x96,0x76,0xA8,0x9A,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC2,0x0E,0x0B,0x2B,0x83,
+0x86,0x8B,0x9D,0x97,0x9C,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xC7,0x0F,0x26,0x02,0xC1,0x25,0xC2,0x06,0x09,0xC1,0x06,0x09,0xAB,0x54,0x90,0x79,0x17,0x05,0xCA,0x0A,0x05,
+0xC7,0x14,0x05,0xC6,0xBF,0x82,0x2B,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC3,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x9A,0x99,0xA2,0x75,0x3A,0x04,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,
+0xC2,0x93,0x89,0x29,0x9E,0x96,0x05,0xC6,0x6E,0x05,0xC7,0x14,0x05,0xCD,0x0F,0xA3,0x95,0x25,0xC5,0x99,0xC9,0xC0,0x06,0xC2,0x22,0x05,0xCD,0x0A,0x05,0xC7,0x14,0x05,
+0xC5,0x1F,0x04,0x0E,0xC1,0x5A,0x0E,0xC0,0x0B,0xC4,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x96,0x86,0x3A,0x0E,0xC2,0x0B,0x0E,0xC0,0x0B,0xC2,0x30,0x20,0x22,0x05,0xC6,0x0A,
+0x05,0xC7,0x14,0x05,0xCD,0x0F,0x78,0x25,0xC5,0x2D,0xC0,0x69,0x2D,0xC0,0xAC,0x43,0x9B,0x89,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCB,0xA6,0x87,0xBE,0x73,0xB8,0x99,
+0x0E,0xC0,0x0B,0x0E,0xC2,0x0B,0x67,0x0B,0xC1,0x0E,0xC1,0x0B,0x0E,0xC0,0x92,0x76,0x0B,0xC3,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x9A,0x99,0xFE,0x31,0xA5,0x14,0xB4,0x73,
+0x05,0xCE,0x0A,0x05,0xC7,0x14,0x05,0xC5,0x1E,0x9E,0x75,0x25,0xC5,0x2D,0xC3,0xAE,0x53,0x90,0x79,0x17,0x05,0xCB,0x0A,0x05,0xC7,0x14,0x05,0xC5,0x3F,0xFE,0x9D,0x2D,
+0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x2B,0x95,0x87,0x2B,0x0B,0x0E,0x0B,0x3A,0x0B,0x0E,0x0B,0xC1,0x0E,0xC0,0x11,0x05,0xC0,
+0x07,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC9,0xA6,0x87,0x35,0x20,0xC0,0x3D,0xA2,0x77,0x25,0xC2,0x2D,0xC2,0x13,0x22,0x05,0xCE,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x3F,
+0xFE,0xAD,0x8E,0x0B,0x0E,0x59,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x0B,0x0E,0x15,0x31,0x2B,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC2,0x0B,0xC0,0x2B,0x25,0x05,
+0xC0,0x36,0x8F,0x9B,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC8,0x06,0x27,0x92,0x9F,0x4B,0x9D,0xB9,0x9C,0x88,0xA2,0x78,0x55,0x26,0x3D,0x9D,0xC8,0x2D,0x26,0xC0,0xAF,
+0x44,0x91,0x9A,0x97,0x9C,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x20,0x31,0x0B,0x0E,0x0B,0xC1,0x0E,0xC0,0x0B,0xC2,0x0E,0xC0,0x0B,0xC0,0x04,0x34,0x0E,0xC0,0x2A,0x0B,
+0xC0,0x0E,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x8E,0x89,0x08,0x05,0xC0,0x36,0x94,0x89,0x97,0x9C,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCB,0x0F,0xA3,0x98,0x18,0x6E,0xC3,0x3D,
+0xC0,0x26,0xC0,0x2D,0x26,0xAF,0x52,0x8B,0x8E,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x20,0x31,0x0B,0xC4,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,
+0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC1,0x9D,0x88,0xFE,0x4B,0x0A,0x05,0xC1,0x29,0x96,0x9A,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC9,0x3A,0x27,0x97,0x9B,0x1A,
+0x1D,0xC5,0x26,0x2D,0xA3,0x57,0x13,0xA6,0x63,0x05,0xD0,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xAE,0x85,0xFE,0xCE,0xB3,0xA8,0x9A,0x0E,0xC3,0x0B,0x0E,0xC0,0x0B,0xC1,0x0E,
+0x0B,0x0E,0x0B,0x2B,0x9A,0x8A,0x2B,0xA3,0x88,0x0B,0x0E,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x21,0x14,0x05,0xC1,0x13,0x12,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC7,0xAB,
+0x86,0x27,0x29,0x9E,0x7B,0x07,0x1D,0xC4,0x98,0xE9,0x2D,0x26,0x0D,0x2C,0x05,0xC0,0x0A,0x05,0xDD,0x06,0x34,0x0E,0xC3,0x0B,0x0E,0xC0,0x0B,0xC4,0x95,0x8B,0x89,0xAA,
+0x8D,0x98,0x9C,0x78,0xB2,0x68,0xBF,0xB7,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0xC1,0x9A,0x89,0xFE,0x3A,0x06,0x17,0x05,0xC1,0x13,0x20,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,
+0xC7,0xB8,0x73,0xA3,0x95,0x18,0x27,0x07,0x1D,0xC4,0x26,0x6B,0x26,0x1E,0x17,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x29,0x34,0x0E,0xC1,0x0B,0x0E,0x0B,0xC0,0x0E,
+0x0B,0xC1,0x0E,0x9D,0x88,0x87,0x99,0x85,0x8A,0x05,0xC2,0xB7,0x67,0x0C,0x0B,0x7B,0x0B,0x0E,0xC0,0x0B,0xC0,0x36,0x05,0xC3,0x13,0x12,0x05,0x0A,0x05,0xC0,0x14,0x05,
+0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC2,0xA9,0x85,0xB4,0x73,0x97,0x9B,0x1A,0x1D,0xC6,0x2D,0x26,0x13,0x0F,0x17,0x9D,0x9A,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCB,0x0F,0x34,
+0x0E,0xC1,0x0B,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0x3D,0x19,0x05,0xC5,0x33,0xB8,0x76,0x0B,0x0E,0x0B,0xC0,0x0E,0x93,0x79,0xFE,0x18,0xE2,0x05,0xC3,0x29,0x96,0x9A,0x05,
+0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC9,0x22,0xA5,0x96,0x3F,0xA3,0x8A,0xC0,0xA2,0x98,0x07,0x1D,0x10,0x1A,0x1D,0xC0,0x2D,0x69,0xAC,0x44,0x9C,0x97,0x05,0xC6,0x6E,0x05,
+0xC7,0x14,0x05,0xCE,0xB7,0x74,0xA4,0x98,0x2B,0x12,0x69,0xC0,0x0E,0xC2,0x0B,0x0E,0x97,0x8A,0xFE,0x3A,0x06,0x17,0x05,0xC0,0xB4,0x67,0x30,0x11,0xC0,0x92,0x88,0x90,
+0x9A,0xFE,0xE7,0x38,0x0B,0xC2,0x0C,0x0F,0x17,0x9D,0x9A,0xC3,0x29,0x96,0x88,0x97,0x9C,0xCD,0x0A,0x05,0xC7,0x14,0x05,0xC1,0x16,0x27,0x06,0x1D,0x9B,0xBA,0x36,0x0F,
+0x36,0x42,0x69,0xC2,0x9F,0xD9,0xC0,0x1E,0x90,0x89,0x97,0x9C,0xCE,0x0A,0x05,0xC7,0x14,0x05,0xC6,0xB5,0x84,0x96,0x88,0xB1,0x9C,0xFE,0xF7,0xB9,0x0B,0x0E,0x0B,0x0E,
+0x0B,0xC0,0x0E,0x97,0x8A,0x0F,0x05,0xA6,0x87,0xB3,0x77,0xB8,0x86,0xAD,0x98,0x6B,0x15,0xC0,0x0B,0x21,0x3D,0xA7,0x97,0x0B,0xC0,0x0C,0x29,0x05,0xC5,0xB3,0x85,0x31,
+0x17,0x05,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xC1,0x39,0xA4,0x96,0x0F,0x10,0x9D,0xB9,0xC2,0x69,0x0F,0x36,0x3D,0xC0,0x26,0x13,0x04,0x17,0x05,0xC7,0x0A,0x05,0xC7,0x14,
+0x05,0xCD,0xB8,0x73,0x24,0x0A,0x30,0xBC,0x78,0x0B,0x15,0x0B,0x0E,0xC0,0x2B,0x29,0x17,0xB9,0x87,0xB7,0x89,0x15,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x2B,
+0xFE,0x5B,0x4A,0x87,0xAB,0xC6,0x22,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x05,0xAB,0x86,0x27,0x06,0x1D,0x3D,0xC2,0x36,0xA3,0x88,0x36,0x3D,0xC1,0x9D,0xC9,0x0D,0x9D,0x77,
+0x05,0xE1,0x17,0x1E,0x96,0x25,0x93,0xEF,0x05,0x33,0x12,0x0B,0xC0,0x0E,0x9C,0x76,0x3E,0x93,0x9B,0x37,0x12,0x7A,0xC0,0x0B,0xC0,0x0E,0x95,0x7B,0x3A,0x0B,0x0E,0x0B,
+0xC0,0x2B,0x81,0x9D,0x05,0xC6,0x0A,0x22,0x05,0xD0,0x0A,0x05,0xC7,0xA6,0x87,0xB5,0x83,0x22,0x02,0xC0,0x3D,0xC8,0x9D,0xC9,0xB2,0x42,0x90,0x89,0x05,0xCA,0x0A,0x05,
+0xC7,0x14,0x05,0xCB,0xB8,0x73,0x9B,0x48,0x8F,0xDD,0x05,0xC0,0x30,0x2A,0x0B,0x15,0x33,0x30,0x2A,0x0B,0xC0,0x0E,0x95,0x7B,0x11,0xC0,0x9B,0x96,0x2D,0x15,0x0B,0xC1,
+0x9D,0x98,0x16,0x05,0xC7,0xA5,0x88,0xAB,0xA6,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x22,0x24,0x3C,0x02,0xC0,0x3D,0xC8,0x13,0x04,0x17,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x05,
+0xC5,0xA5,0x87,0x22,0x9C,0x37,0x0A,0x05,0x0A,0x05,0xB7,0x67,0xBF,0xB7,0x0B,0x97,0x9A,0xA7,0x97,0x0B,0xC1,0x0E,0x9C,0x76,0x0C,0xA5,0x86,0xA3,0x88,0x0B,0x0E,0x0B,
+0xC0,0x9A,0x99,0x84,0x79,0x84,0x9B,0xC6,0x0A,0x05,0x3C,0xA1,0x8A,0x17,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC2,0xAB,0x86,0x27,0x06,0x9C,0x9C,0xCB,0x9D,0xC9,0xC2,
+0x26,0xC2,0xAC,0x44,0xA1,0x85,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCE,0xA6,0x87,0x22,0x98,0x59,0x99,0xAA,0x05,0xC2,0x0F,0xFE,0xC6,0x97,0xAB,0xA7,0x0B,0xC2,0x0E,
+0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x2D,0x80,0x97,0x17,0x05,0xC6,0x0A,0x05,0x29,0x96,0x9A,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC4,0xA5,0x87,0xB6,0x83,0x22,0x3D,0x69,
+0xA2,0x78,0x36,0x1D,0x3D,0x41,0x07,0x36,0x3D,0xC3,0x9D,0xC9,0xC3,0x69,0xC1,0xAF,0x52,0x2C,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCD,0xA8,0x88,0x13,0x3F,0x28,0x05,
+0xC3,0xAA,0x78,0xFE,0xBE,0x54,0xAD,0x98,0x6B,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x11,0x16,0x05,0xC6,0x0A,0x05,0xC0,0x2B,0x22,0x08,0x05,0xC9,0x0A,0x05,0xC7,
+0x14,0x05,0xC2,0x22,0xA4,0x78,0x3D,0x36,0xA2,0x78,0x36,0x1D,0x3D,0xC0,0x26,0x07,0x36,0x3D,0xC3,0x9D,0xC8,0x2D,0x26,0xC0,0x2D,0x26,0xC1,0x24,0x89,0x9D,0x05,0xE1,
+0x17,0x20,0x06,0x9A,0x78,0x4E,0x97,0xCC,0x05,0xC3,0x20,0x21,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0xC0,0x97,0x9A,0x82,0x6A,0x14,0x05,0xC8,0x0A,0x05,0x3C,0xA1,0x8A,0x05,
+0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC3,0x3C,0x24,0x95,0x8B,0x9C,0x9C,0x36,0x0F,0x36,0x3D,0x36,0x0F,0x36,0x3D,0xC0,0x36,0x0F,0x36,0x3D,0xC0,0x2D,0x26,0xC4,0xA7,0x77,
+0xA8,0x55,0x17,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x20,0xC0,0x2B,0xB9,0x10,0x9B,0x87,0x91,0xCF,0x98,0xCC,0x05,0xC1,0x0A,0x2B,0x30,0x2A,0x0B,0xC1,0x0E,0x9C,
+0x76,0x30,0x3A,0x05,0xC0,0x0A,0x05,0xC0,0x14,0x05,0xC6,0x25,0x2B,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC3,0x3F,0xB1,0x85,0x06,0x47,0x3D,0x41,0xA4,0x87,0x36,0x3D,
+0xC6,0x26,0x07,0x36,0x2D,0xC0,0x69,0xC3,0x04,0x06,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCE,0x3C,0x31,0x17,0xFE,0x44,0xC5,0xAD,0x84,0x9A,0x8A,0x39,0x98,0x88,0x9C,
+0xAA,0xC0,0x13,0xAA,0x63,0xC0,0xFE,0x5B,0xA9,0x21,0x2A,0x9B,0x99,0x33,0x84,0x7A,0x05,0xC6,0x0A,0x05,0xC4,0x3A,0x26,0x05,0xC0,0x0A,0x05,0xC0,0x14,0x05,0xCA,0x0A,
+0x05,0xC5,0x0F,0x22,0x99,0x9D,0x36,0x3D,0xC0,0x26,0x07,0x36,0x3D,0xC8,0x2D,0xC0,0x69,0xC3,0x24,0x1F,0x0A,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x20,0x17,0x05,
+0xFE,0x3C,0x62,0xB1,0x74,0xC7,0x1A,0x0E,0x12,0xFE,0x22,0x84,0x8F,0xDD,0x05,0xCE,0xA7,0x85,0x14,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC1,0xB0,0x95,0xA8,0x66,0x3D,
+0x36,0xA3,0x88,0x36,0x3D,0xC9,0x41,0x07,0x36,0x9D,0xC9,0x2D,0x26,0xC2,0x06,0x04,0x17,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCE,0x3C,0x05,0xC0,0xFE,0x43,0xE6,0xFE,
+0x76,0x87,0x18,0xC2,0x1A,0x18,0xC1,0x1A,0x18,0xC0,0x99,0xAD,0xFE,0x09,0x81,0x97,0xCC,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xD4,0x20,0x24,0x95,0x8B,0x3D,0x07,0x61,
+0xA5,0x68,0x3D,0xC1,0x41,0x07,0x36,0x3D,0xC6,0x2D,0xC2,0x69,0xC0,0xAC,0x44,0x22,0x17,0x0A,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCD,0x3C,0x05,0xC0,0xB4,0x42,0x1A,
+0x18,0xC1,0x1A,0x18,0xC0,0x9D,0x9B,0x12,0xAA,0x88,0x1F,0x18,0x1A,0x29,0x0F,0x05,0xC5,0x28,0xA4,0x77,0x37,0xC0,0x0F,0x0A,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xC3,
+0xB8,0x73,0x22,0x3D,0x69,0xA3,0x88,0x36,0x3D,0xC1,0x36,0x0F,0x36,0x3D,0xC2,0x36,0x0F,0x36,0x3D,0xC0,0x2D,0xC0,0xA3,0x88,0x13,0x7B,0xC0,0xAA,0x74,0x95,0x78,0x05,
+0xDD,0x28,0xA4,0x77,0xA4,0x55,0xC0,0x06,0x37,0x06,0x9F,0xB9,0x98,0x9B,0x05,0xAF,0x54,0xFE,0x76,0x09,0x18,0xC1,0x1A,0x18,0xC0,0x92,0x9B,0xFE,0x6B,0xAB,0x48,0xFE,
+0x5D,0xA5,0x18,0x1A,0x0E,0x37,0x0F,0x0A,0xC0,0xA7,0x66,0x0C,0x15,0x9C,0x9A,0x10,0x06,0x55,0xA5,0x88,0x2E,0x06,0x0F,0x62,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC4,0xAF,
+0x84,0xA9,0x88,0x3D,0x36,0xA3,0x88,0x36,0x3D,0xC3,0x36,0x0F,0x36,0x3D,0xC4,0x36,0x0F,0x13,0xC3,0xA3,0x77,0xA8,0x86,0x89,0x9D,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,
+0xC3,0x06,0x3E,0xA9,0x75,0x39,0x0E,0xC2,0x3B,0x91,0xBE,0xA0,0xBB,0x2E,0x06,0x31,0x19,0x18,0xC1,0x1A,0x18,0xC0,0x92,0x9B,0xFE,0x6B,0xAB,0xC0,0xA3,0x33,0x1A,0x18,
+0x9D,0x9A,0x15,0xFE,0x00,0xA0,0xA4,0x77,0xB0,0x43,0x0E,0x0D,0x1A,0x0E,0x10,0x0A,0x66,0xC0,0x2B,0xAA,0x56,0x9C,0x77,0x97,0xCC,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,
+0xC2,0xB7,0x74,0x99,0x99,0x02,0x36,0x3D,0xC1,0x41,0xA4,0x87,0x36,0x3D,0xCA,0x1D,0x59,0x9C,0xAB,0x13,0xC0,0xA3,0x78,0xA5,0x87,0x8B,0x9C,0x05,0xCA,0x0A,0x05,0xC7,
+0x14,0x05,0xC1,0x2B,0x15,0xB1,0x62,0xA6,0x88,0x18,0xC1,0x1A,0x18,0xC0,0x0D,0x39,0xFE,0x01,0x60,0x98,0xCC,0x2B,0xAA,0x34,0xAF,0x64,0x0D,0x1A,0x18,0xC1,0x1A,0x0E,
+0xFE,0x6B,0xAB,0xC1,0xFE,0x76,0x09,0x18,0xC0,0x0A,0x3E,0x39,0x1A,0x6E,0x18,0xC1,0x39,0x37,0x96,0xDD,0xC1,0x32,0x31,0x95,0xAB,0x05,0xD6,0xB0,0x95,0x22,0x3D,0x36,
+0xA3,0x88,0x36,0xC0,0x3D,0xCA,0x36,0x07,0x2D,0xA0,0xA5,0x1D,0xC0,0x13,0xC0,0x1D,0xAB,0x64,0x98,0x88,0x05,0xD9,0xB5,0x20,0x0D,0x1A,0x18,0xC2,0x1A,0x18,0xC1,0x1A,
+0x12,0xFE,0x01,0x00,0x05,0xC0,0x28,0xB1,0x54,0xB4,0x51,0x1F,0x18,0xC1,0x99,0x9C,0xFE,0x4C,0x07,0xFE,0x73,0xAD,0x58,0xFE,0x76,0x09,0x18,0xC1,0x8F,0x9C,0x0D,0x1A,
+0x18,0xC1,0x1A,0x06,0x3E,0xFE,0x00,0x40,0x66,0xC1,0xAB,0x55,0x2E,0x93,0xCC,0x05,0xCA,0x0A,0x05,0xC7,0xA6,0x87,0xB2,0x74,0x3D,0xC2,0x26,0x07,0x61,0x3D,0xC5,0x9D,
+0xA8,0xA0,0xA8,0x1E,0xA0,0xA9,0x9E,0xB6,0xA2,0xA7,0xA1,0xB8,0x7B,0x13,0xC3,0xAA,0x85,0x91,0x7A,0x05,0xCB,0x0A,0x05,0xC7,0x7F,0x05,0xC1,0xFE,0x3B,0xE5,0x0D,0x18,
+0xC1,0x1A,0x18,0xC2,0x1A,0x18,0x1A,0x8B,0x9D,0xFE,0x00,0x60,0x05,0xC1,0x31,0x0E,0x0D,0x18,0x1A,0x18,0x0E,0x2C,0xC0,0x1A,0x18,0xC1,0x99,0x9C,0x39,0x1A,0x1F,0x18,
+0x1A,0x18,0xC0,0x39,0xFE,0x00,0xA0,0x05,0xC0,0x0A,0x05,0x31,0x19,0x05,0xC9,0x0A,0x05,0xC8,0xAF,0x84,0xA5,0x87,0x98,0x9E,0x36,0xA3,0x88,0x3D,0xC0,0x41,0x07,0x36,
+0x26,0x3D,0x1E,0x2B,0x9E,0xB6,0xA3,0x99,0xA0,0xB7,0x33,0x7B,0x7E,0xC0,0x3D,0x05,0xC0,0x1D,0x59,0xC0,0xA3,0x77,0x1D,0xAA,0x74,0x8A,0x7C,0x9C,0x8A,0xCB,0x0A,0x05,
+0xC7,0x14,0x05,0xC1,0xFE,0x3C,0x62,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xC2,0x1A,0x06,0xFE,0x22,0xC2,0xFE,0x00,0x60,0x05,0xC1,0x0C,0xFE,0x44,0xC2,0x1A,0x18,0xC0,
+0x1A,0x18,0xC3,0x1A,0x06,0x89,0xAF,0xB1,0x72,0x06,0x18,0xC1,0x1A,0x2C,0xFE,0x0A,0x00,0x0F,0x05,0xC1,0xA6,0x87,0x2E,0x0F,0x05,0xC6,0x6E,0x05,0xC7,0x14,0x05,0xC0,
+0xB5,0x84,0x9B,0x89,0x3C,0x53,0x9D,0xA9,0xC0,0x1E,0x2B,0x70,0x79,0x35,0x37,0x7A,0x61,0xC1,0xA3,0x98,0xC0,0x3D,0xA2,0x87,0x05,0xC0,0x29,0x0A,0xFE,0x4A,0x85,0x9D,
+0xAA,0xC1,0xA5,0x77,0xA6,0x84,0xFE,0x00,0x20,0xC9,0x6E,0x05,0xC6,0x0A,0x05,0xC5,0xFE,0x54,0xE7,0x18,0xC1,0x1A,0x18,0xC3,0x1A,0x18,0xC1,0x97,0x9A,0xFE,0x01,0x60,
+0x0F,0x66,0xC0,0x10,0xFE,0x55,0x63,0x24,0x1A,0x18,0xC1,0x1A,0x18,0xC2,0x0D,0xFE,0x02,0x00,0x3E,0xB7,0x63,0xA7,0x75,0x18,0xC0,0x1A,0x18,0x8A,0x9E,0x0F,0x05,0xC2,
+0xAB,0x55,0x59,0x0F,0x05,0xC9,0x6E,0x05,0xC5,0xAB,0x86,0xAD,0x86,0x2B,0x9E,0xB6,0x25,0xA1,0xA9,0x33,0x3D,0x7E,0x51,0x56,0xC5,0x05,0xC1,0x6E,0x05,0xC1,0x29,0x1D,
+0x13,0x1D,0xC0,0x0F,0x22,0x8D,0x9D,0xD1,0x6E,0x05,0xC6,0xFE,0x3C,0x62,0x18,0xCC,0x3B,0xFE,0x00,0x60,0x05,0xC0,0xA5,0x87,0xFE,0x5C,0xE8,0x1A,0x0E,0x2C,0x18,0xC1,
+0x1A,0x18,0xC1,0x2C,0xFE,0x01,0x60,0x0F,0x08,0x0D,0x18,0x1A,0x18,0xC0,0x0E,0x37,0x05,0xC3,0xAF,0x54,0x19,0x05,0xC0,0x0A,0x05,0xC0,0x14,0x05,0xCB,0xB3,0x85,0xA1,
+0xF6,0x33,0x62,0xCA,0x7E,0xA2,0x88,0xC0,0x6E,0xC0,0x05,0xC0,0x0A,0x05,0xC0,0xFE,0x59,0xE7,0x13,0xC1,0xAB,0x75,0x94,0x88,0x91,0x9F,0xC9,0x6E,0x05,0xC7,0x14,0x05,
+0xC4,0xFE,0x3B,0xE5,0x0D,0x18,0xC2,0x1A,0x18,0xC4,0x1A,0x18,0x99,0x9C,0xFE,0x0A,0x00,0x05,0xC1,0xFE,0x43,0xE6,0x1F,0x18,0x99,0x9B,0x0E,0x0D,0x18,0xC2,0x1A,0x98,
+0x88,0x37,0x05,0x6E,0x28,0x36,0x18,0x1A,0x18,0xC0,0xFE,0x02,0x00,0x0A,0x05,0xC2,0xAB,0x55,0x2E,0x0A,0x05,0xCC,0x0A,0x05,0xC1,0xB8,0x73,0xFE,0x8A,0x21,0x29,0xC6,
+0x31,0x52,0x29,0xC1,0xA3,0x98,0xC0,0x6E,0xC1,0x05,0xC0,0x0A,0x29,0xC0,0xFE,0x52,0x26,0x59,0xA3,0x78,0x13,0xAA,0x85,0x8D,0x7B,0x17,0x9D,0x9A,0xCD,0x6E,0x05,0xC7,
+0x14,0x05,0x15,0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x1A,0x18,0xC1,0x3B,0xFE,0x00,0x60,0x05,0xC0,0xB4,0x42,0x0D,0x1A,0x18,0xC0,0x94,0x8B,0x0D,0x1A,0x18,0xC1,0x12,0x0F,
+0x05,0xC0,0x2B,0xB9,0x10,0x0D,0x18,0xC0,0x1A,0xFE,0x23,0x03,0x0A,0x05,0xC3,0xAF,0x54,0x95,0xAB,0x05,0xC0,0x14,0x05,0xCC,0x2B,0xB6,0x84,0xFE,0x8A,0x21,0x98,0xFB,
+0xC8,0xA3,0x98,0xC0,0x3D,0xA2,0x87,0xC0,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x29,0xC0,0x1D,0x59,0x1D,0xA3,0x66,0xA8,0x86,0x85,0x9F,0xD2,0x6E,0x05,0xC6,0x0C,0xFE,0x6E,
+0x26,0x18,0xC0,0x1A,0x18,0xC5,0x1A,0x18,0xC1,0x2C,0xFE,0x0A,0x00,0x05,0xC0,0xAA,0x66,0x36,0x1F,0x18,0xC0,0x1A,0x0E,0xA2,0x75,0x06,0x18,0xC0,0x3B,0xFE,0x00,0x60,
+0x05,0xC1,0xA5,0x87,0xFE,0x23,0x41,0x1A,0x18,0x1A,0x8B,0x9D,0x0F,0x05,0xC3,0x10,0x59,0x96,0xCC,0x05,0xCD,0x0A,0xA5,0x98,0xB4,0x93,0xFE,0x89,0x40,0xA1,0xA9,0x3D,
+0x7E,0x3D,0x51,0xC0,0x05,0xC1,0x29,0xC0,0x05,0x6E,0x05,0xC0,0x0A,0xC1,0x05,0xC1,0x29,0xC0,0xFE,0x4A,0x25,0xC1,0xA8,0x66,0x9B,0x99,0x8D,0x9D,0xC7,0x6E,0x05,0xC7,
+0x14,0x05,0xC7,0x31,0x36,0x18,0xCD,0x3B,0xFE,0x00,0x60,0x05,0x32,0xFE,0x55,0x63,0xA6,0x88,0x18,0xC1,0x1A,0x06,0x35,0x0D,0xC0,0xFE,0x02,0x00,0x92,0xFF,0x05,0xC2,
+0x2B,0x28,0x36,0x18,0x39,0x19,0x05,0xC4,0x31,0x19,0x05,0xC8,0x0A,0x05,0xC4,0xB7,0x94,0x37,0xA1,0xB8,0x6E,0x05,0x51,0x29,0xC0,0x05,0x29,0xC3,0x05,0xC0,0x3D,0x0A,
+0xC1,0x05,0xC0,0x0A,0xC1,0x1D,0xC0,0x13,0xAA,0x85,0x97,0x89,0x8F,0x8E,0xDB,0xAB,0x55,0xFE,0x55,0x63,0x06,0x18,0xC2,0x1A,0x18,0xC6,0x1A,0x0A,0xFE,0x01,0x60,0x05,
+0xA3,0x87,0x1C,0x1A,0x18,0x1A,0x18,0xC2,0x35,0x3B,0x0F,0x05,0xC4,0x2B,0xB2,0x11,0x36,0x39,0xFE,0x00,0xA0,0x05,0xC4,0x10,0xA4,0x66,0x19,0x05,0x6E,0x05,0xC0,0x14,
+0x05,0xC9,0x0D,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xC2,0x29,0x05,0x3D,0x29,0x3D,0x29,0xC3,0x05,0xC2,0x3D,0xA2,0x87,0xC1,0x29,0x1D,0xC0,0x13,0x27,0x8E,0x9C,0x95,0x9D,
+0xDB,0x32,0x39,0x1A,0x1F,0x18,0xC0,0x1A,0x18,0xC7,0x1A,0x06,0x08,0xFE,0x00,0x60,0x05,0xFE,0x3C,0x62,0x18,0xC1,0x1A,0x18,0xC2,0x35,0x08,0x92,0xBD,0x9A,0xBB,0x05,
+0xC4,0x0C,0xAB,0x64,0x19,0x05,0xC5,0x0C,0x0F,0x05,0xCE,0x3C,0xA4,0xE6,0x33,0x29,0xC1,0xA3,0x98,0xC0,0x6E,0x05,0xC0,0x3D,0x0A,0x29,0xC4,0x31,0xC0,0x05,0x29,0x05,
+0xC0,0xFE,0x4A,0x25,0xC0,0xA3,0x78,0x27,0x8A,0x9D,0x17,0x9D,0x9A,0xCE,0x6E,0x05,0xC7,0x14,0x05,0xC0,0xB8,0x10,0x1A,0x18,0xCD,0x39,0x19,0x05,0xBF,0x20,0x1A,0x18,
+0xC0,0x1A,0x18,0xC3,0x9D,0x9B,0x3B,0x91,0xBE,0x0A,0x05,0xC4,0x0C,0x24,0x0A,0x05,0xC0,0x0A,0x05,0xC0,0x14,0x24,0x9C,0x99,0x0F,0x05,0xCA,0x0A,0x05,0xC1,0xB3,0x84,
+0xA1,0xF7,0x33,0x62,0xC0,0xA3,0x98,0xC2,0x6E,0xC1,0x29,0x7E,0x05,0x29,0x05,0x31,0x05,0x0A,0x05,0xC0,0x0A,0x29,0xFE,0x4A,0x25,0xC0,0xA7,0x87,0x16,0x17,0x9D,0x9A,
+0xD0,0x6E,0x05,0xC7,0x14,0x05,0x0C,0xFE,0x6E,0x27,0x18,0xCD,0x99,0x9C,0x37,0x0F,0x12,0x18,0xC2,0x1A,0x18,0xC4,0x99,0x9B,0x15,0x37,0x0A,0x05,0xC3,0x10,0x2E,0x0A,
+0x05,0xC3,0x2B,0x2E,0x0F,0x05,0xCE,0xA7,0x85,0xB0,0x97,0xFE,0x8A,0x21,0xFE,0xA9,0x40,0x29,0xC1,0xA3,0x98,0x29,0x05,0xC1,0x29,0xC0,0x05,0x29,0x3D,0x29,0x05,0xC0,
+0x6E,0xC1,0x29,0x13,0xC0,0x0D,0x04,0x17,0x9D,0x9A,0xC9,0x6E,0x05,0xC7,0x14,0x05,0xC6,0x24,0xFE,0x55,0x63,0xA6,0x88,0x18,0xC3,0x1A,0x18,0xC6,0x0E,0x3E,0xFE,0x00,
+0x40,0xFE,0x54,0xE7,0x18,0xC5,0x1A,0x18,0xC2,0x1A,0x8B,0x9D,0xFE,0x09,0x81,0x97,0xCC,0x05,0xC3,0x10,0x2E,0x0A,0x05,0xC3,0xAF,0x54,0x19,0x05,0xC9,0x0A,0x05,0xC3,
+0xA9,0x85,0x27,0xFE,0x89,0x40,0xA1,0xA9,0x71,0x33,0x9D,0xAA,0x29,0xC3,0x7E,0x24,0x29,0xC0,0xA3,0x98,0xC1,0x6E,0x05,0xC0,0x0A,0x13,0xC0,0xAB,0x75,0x98,0x88,0x17,
+0x9D,0x9A,0xDC,0xA8,0x55,0x39,0x1A,0x1F,0x18,0xC1,0x1A,0x18,0xC7,0x97,0x9A,0x93,0x9D,0x0F,0x12,0x18,0xCB,0x1A,0x0E,0x0C,0x0F,0x05,0xC3,0x10,0x2E,0x0F,0x05,0xC2,
+0x10,0xA4,0x66,0x92,0xDD,0x05,0xC8,0x0A,0x05,0xC4,0xB0,0x94,0x35,0x33,0x62,0xA4,0x87,0x66,0xC0,0x3D,0x0A,0x29,0xC4,0x05,0xC1,0x0A,0xC1,0x05,0x13,0xC0,0x16,0x96,
+0x9B,0x8F,0x8E,0xCC,0x6E,0x05,0xC7,0x7F,0x05,0xC4,0x2B,0xB9,0x10,0xB2,0x51,0x18,0xCC,0x36,0x3B,0x06,0x0E,0x18,0x1A,0x18,0xC8,0x1A,0x18,0xC0,0x2C,0x15,0x19,0x05,
+0xC3,0x3F,0x24,0x0A,0x05,0xC1,0x17,0xB0,0x34,0x0F,0x05,0xC8,0x0A,0x05,0xC5,0xB8,0x73,0x35,0x33,0xA1,0xA9,0x31,0x05,0xC1,0x29,0x66,0x29,0xC2,0x05,0xC1,0x6E,0xC0,
+0x05,0xC0,0x1D,0xC0,0xAA,0x74,0x91,0x7A,0x95,0x9D,0xDE,0x0C,0x0D,0x18,0xCD,0x3B,0x91,0xBE,0x36,0x1F,0x18,0xC0,0x1A,0x18,0x1A,0x18,0xC8,0x0D,0x3B,0xFE,0x01,0x00,
+0x05,0xC3,0xAF,0x54,0x06,0x97,0xCC,0x05,0xC1,0x2E,0x06,0x96,0xCC,0x05,0xCE,0x0A,0x3A,0x22,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xC2,0x3D,0x29,0xC3,0x7E,0x24,0x05,0xC0,
+0x3D,0xA2,0x87,0xC1,0x1D,0x59,0xAE,0x63,0x89,0x9D,0x17,0x9D,0x9A,0xCF,0x6E,0x05,0xC7,0x14,0x05,0xC1,0x10,0xFE,0x55,0x63,0x18,0xC1,0x1A,0x18,0xC5,0x1A,0x18,0xC1,
+0x0A,0xFE,0x0A,0xA0,0xB8,0x73,0x1F,0x18,0xC0,0x1A,0x18,0xC0,0x1A,0x18,0xC8,0x0D,0x3B,0xFE,0x00,0x60,0x05,0xC3,0xAF,0x54,0x19,0x05,0xC1,0x37,0xA7,0x54,0x0F,0x05,
+0x19,0x05,0xC9,0x6E,0x05,0xC2,0xB3,0x85,0xA6,0xA4,0x3D,0x7E,0x3D,0x51,0x05,0x29,0x3D,0x29,0x05,0xC0,0x29,0xC0,0x05,0x6E,0x05,0x0A,0x05,0xC0,0x14,0x2B,0xFE,0x3C,
+0x62,0xAE,0x75,0x18,0xCC,0x99,0x9C,0x91,0x9B,0x1A,0x18,0xC2,0x1A,0x18,0xC9,0x1A,0x18,0xC0,0x29,0xFE,0x00,0x60,0x62,0xC2,0xAF,0x33,0x2E,0x92,0xCC,0x05,0xC0,0x31,
+0x0C,0x13,0xC1,0x24,0x2E,0x9B,0x88,0x0F,0x0A,0xC0,0x05,0xC6,0x0A,0x05,0x3C,0xAB,0xA4,0x3D,0x51,0xFE,0x4A,0x25,0xA5,0x77,0x16,0x17,0x0A,0x05,0xCF,0x0A,0x05,0xC7,
+0x14,0x05,0xC2,0x08,0x0D,0x18,0xC0,0x1A,0x18,0xC9,0x06,0x12,0x18,0xC3,0x1A,0x18,0xC9,0x06,0x18,0x1A,0x06,0x0C,0x8F,0xDD,0x05,0xC1,0x32,0xAA,0x21,0x0F,0x05,0xAA,
+0x66,0x9D,0x9A,0x0A,0x05,0xC3,0x24,0x9C,0x99,0x0F,0x05,0xC9,0xA7,0x85,0xB4,0x85,0xFE,0x99,0x61,0x33,0xA1,0xA9,0x51,0xFE,0x4A,0x25,0xA9,0x77,0x9E,0x75,0xFE,0x00,
+0x20,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCD,0xA8,0x55,0x39,0x18,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0x92,0x9B,0x1A,0x18,0xC0,0x1A,0x18,0xC9,0x06,0x18,0xC0,0x1A,0x18,0xC0,
+0x0E,0x37,0x05,0xC1,0x2B,0xAA,0x34,0x0F,0x24,0x9C,0x99,0x0F,0x3F,0xA8,0x55,0x2E,0x10,0x06,0xC0,0x0F,0x06,0x55,0x0A,0x05,0xC8,0x14,0xB7,0x73,0xFE,0x8A,0x21,0xFE,
+0xB1,0x81,0x6E,0xC0,0x1D,0x22,0x99,0x78,0x8D,0x9F,0xC6,0x6E,0x05,0xC7,0x7F,0x05,0xCE,0xFE,0x3B,0xE5,0x0D,0x18,0xC0,0x1A,0x18,0x1A,0x18,0xC7,0x97,0x9A,0x2C,0x18,
+0xC0,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0xC1,0x1A,0x18,0xC0,0xFE,0x02,0x00,0x05,0xC1,0xA5,0x88,0x31,0x9C,0x89,0x59,0x96,0xCC,0x05,0xC2,0x28,0x2B,0xA3,0x67,0xA7,0x54,
+0x93,0xEF,0x24,0x19,0x05,0xC9,0xB8,0x73,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xC1,0xFE,0x4A,0x25,0xAB,0x76,0x20,0x95,0x9B,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x31,0xFE,
+0x65,0xA7,0x18,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0x92,0x9B,0x18,0x1A,0x18,0xC9,0x06,0x18,0xC2,0x1A,0x18,0x2C,0xFE,0x09,0x81,0x97,0xCC,0x05,0xC0,0x15,0x31,0x06,0x0F,
+0x05,0xC0,0xA5,0x87,0x3F,0x10,0x06,0xC0,0x37,0x10,0x06,0xA4,0x97,0x28,0x05,0xC9,0xBB,0x82,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0x46,0xA2,0x97,0x1D,0xAE,0x52,0x89,0x9D,
+0x99,0x9C,0xC6,0x6E,0x05,0xC7,0x14,0x05,0xCE,0x10,0x39,0x1A,0x1F,0x18,0xC2,0x1A,0x18,0xC6,0x12,0x18,0xC4,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0x0E,0xFE,0x01,0x60,0x05,
+0xC0,0x0A,0x38,0x48,0x0A,0x05,0xC1,0x17,0x0A,0x05,0x17,0x05,0xA8,0x55,0xA7,0x54,0x0C,0x13,0x19,0x05,0xC8,0x3F,0x22,0xFE,0x99,0x61,0x33,0xA2,0x98,0x66,0xFE,0x4A,
+0x25,0x27,0x31,0x99,0x9C,0xDF,0x14,0x05,0xC0,0xB8,0x10,0x06,0x18,0xC1,0x1A,0x18,0xC8,0x94,0x8B,0x0D,0xC0,0x18,0x1A,0x18,0xC9,0x06,0x18,0xC2,0x3B,0xFE,0x00,0x60,
+0x05,0xC0,0x10,0x59,0x96,0xCC,0x05,0xC3,0x10,0x2E,0xC0,0x24,0x06,0x55,0x0C,0x2E,0x0F,0x05,0xC8,0xB3,0x85,0xA6,0xA4,0x3D,0x7E,0xC0,0x6E,0x1D,0x16,0x89,0x9F,0x9C,
+0x8A,0xE2,0x24,0xFE,0x55,0x63,0x18,0x1A,0x18,0xC9,0x9D,0x9A,0x9C,0x89,0x0E,0x18,0x1A,0x18,0xC9,0x06,0x18,0xC2,0x0D,0xFE,0x02,0x00,0x92,0xFF,0x17,0x24,0x9C,0x99,
+0x97,0xCC,0x0A,0x05,0xC5,0x17,0x05,0xA8,0x55,0x15,0x03,0x24,0x0A,0x05,0xC1,0x17,0x0A,0x05,0xC3,0xB7,0x94,0x9D,0xE7,0x33,0xA1,0xA9,0x6E,0xC0,0xFE,0x52,0xC6,0x16,
+0xFE,0x08,0x20,0x5A,0xE2,0x2B,0xB9,0x10,0x1A,0x18,0xC3,0x1A,0x18,0xC6,0x3B,0x39,0xA5,0x84,0x9B,0x9A,0xC5,0x12,0xC1,0x59,0x12,0xC0,0x08,0x12,0x3B,0x45,0x3E,0x9A,
+0xCD,0x0C,0x3E,0x10,0xA0,0xAA,0x2E,0x9B,0x88,0x73,0x05,0x0F,0x05,0xC0,0x2B,0x32,0x05,0x0F,0x05,0x15,0x31,0x98,0x89,0x05,0xC7,0x20,0x27,0xFE,0x99,0x61,0x33,0xA2,
+0x98,0xC0,0x66,0x36,0x16,0x17,0x9D,0x9A,0xCB,0x6E,0x05,0xC0,0x14,0x05,0xCD,0x0A,0x05,0xC2,0x2E,0xFE,0x65,0xA7,0xA7,0x75,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xC4,
+0x08,0x2C,0xA4,0x87,0x1A,0x51,0x18,0x06,0x18,0xC1,0x1F,0x18,0xC0,0x1A,0x18,0xC1,0x3B,0x0F,0x19,0x05,0x19,0xA4,0x77,0x19,0x05,0x19,0x28,0xA4,0x77,0x7B,0x06,0x2A,
+0x31,0x2E,0x10,0x2E,0x24,0x0C,0x97,0x99,0x0F,0x38,0x24,0x0A,0x05,0xC6,0xB5,0x84,0x16,0x3D,0x7E,0x6E,0x05,0xC0,0xBC,0x56,0xCD,0x93,0xA9,0xAC,0x78,0xA2,0x75,0x67,
+0xC0,0x01,0x3C,0x01,0xC8,0x07,0x3C,0xA1,0xA1,0xA2,0x78,0xA0,0x8A,0x62,0x4F,0x3A,0xC0,0x3C,0x01,0xC3,0x38,0x98,0x9B,0xC0,0x01,0x85,0xBA,0xA5,0x87,0xA4,0x86,0xA6,
+0x87,0xA5,0x87,0xA4,0x89,0xA3,0x97,0x35,0x62,0x31,0x9F,0x9B,0x01,0x38,0x3C,0x96,0x88,0x3C,0x01,0x35,0x9F,0x9B,0xC0,0x01,0xC0,0x9C,0x88,0x93,0xA9,0xA9,0x96,0x92,
+0x8A,0x9B,0x9A,0xCB,0x6E,0x05,0xC7,0x7F,0x05,0xD4,0xAE,0x85,0x24,0x9C,0x78,0x94,0x9C,0xA6,0x95,0x05,0x20,0xA9,0x85,0x05,0xC9,0x6E,0x05,0xC7,0x14,0x05,0xC2,0xBB,
+0x84,0xFE,0xEF,0x98,0x92,0x9B,0x93,0x88,0x8F,0x8A,0x94,0x88,0x05,0xA7,0x87,0x00,0xB2,0xA7,0xAD,0x78,0xA9,0xA6,0x9A,0x8A,0x8A,0x76,0x86,0x9C,0xB6,0x76,0x2B,0xA3,
+0x88,0x7B,0x5A,0x98,0x87,0x83,0x9A,0x17,0x9D,0x9A,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCE,0xA9,0x97,0x35,0x0A,0xAF,0xA6,0xAA,0x4A,0x01,0xC0,0x66,0x01,0xC9,0x69,0x01,
+0xC0,0x3C,0x20,0x05,0xCD,0x0A,0x05,0xC7,0x14,0x05,0xB7,0x74,0x2B,0x04,0x0B,0x0E,0x0B,0xC1,0x0E,0x0B,0x0C,0x33,0x0F,0x05,0xC0,0xB0,0x74,0x27,0x34,0x0E,0xC2,0x0B,
+0x8D,0x96,0x84,0x89,0x05,0xC0,0xAA,0x78,0xA4,0x87,0xA3,0x89,0x00,0xC0,0x01,0xCB,0x3E,0x8F,0x9A,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x1E,0xFE,0xE7,0x76,0x0E,
+0xC1,0x0B,0x0E,0xC0,0x0B,0xC1,0x7B,0x9B,0x8B,0x91,0x87,0x13,0x3F,0xBD,0x84,0xAC,0x87,0x0B,0xC0,0x0E,0x0B,0xC0,0x2B,0x80,0x88,0x8C,0x8A,0x05,0xB7,0x74,0x0B,0xFE,
+0x31,0xA5,0x6B,0x17,0xB6,0x77,0xFE,0xE7,0x79,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x0B,0x8E,0x99,0x84,0x8C,0xFE,0xE7,0x38,0x0B,0xC0,0x0E,0x0B,0x93,0x89,
+0x80,0xA7,0x05,0xE1,0x17,0x16,0xFE,0xAD,0x8E,0xFE,0xFF,0xFF,0xC3,0x54,0x0C,0x81,0x6A,0x7F,0xFE,0xEF,0xBB,0x04,0x0E,0x5B,0x69,0x15,0x0B,0x0E,0xC0,0x34,0x11,0xB3,
+0x98,0x0B,0x0E,0x21,0x82,0x89,0x98,0x8A,0x19,0x3E,0x9B,0x86,0x89,0xBF,0xB7,0x61,0x17,0x9D,0x9A,0xCC,0x6E,0x05,0xC7,0x14,0x05,0xC1,0x16,0xFE,0xBD,0xD1,0x31,0xC1,
+0x1B,0x37,0x92,0x12,0xC0,0xA9,0xAC,0x8C,0xBC,0xB2,0xA7,0x8D,0x84,0x05,0xC9,0x0A,0x05,0xC7,0x7F,0x05,0xC5,0x3F,0x22,0x31,0xC1,0x97,0x85,0x83,0x24,0x55,0x50,0x28,
+0x23,0x0F,0xB7,0x43,0x37,0x30,0x12,0x15,0xC1,0x0B,0xC0,0x9C,0x86,0x34,0x0B,0x23,0x1B,0xFE,0x6B,0xAB,0xBD,0x9A,0xA5,0x87,0x0B,0x7B,0x0B,0x0E,0x34,0xA4,0x87,0xA2,
+0x9A,0x3D,0x31,0x37,0x2D,0xAB,0xA7,0x0B,0x0E,0x0B,0xC0,0x92,0x86,0x0B,0x21,0x81,0x8C,0xA8,0x84,0x08,0x5A,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC9,0xB3,0x84,0x34,0x0E,
+0x12,0x33,0x98,0x75,0x94,0x97,0x0E,0xC0,0x5A,0xC0,0x0E,0x0B,0x2A,0x3D,0x2D,0x9E,0x86,0x3D,0x3A,0xA2,0x78,0x0E,0x0B,0xC0,0x0E,0x31,0x0B,0x3D,0x91,0x9A,0x11,0x37,
+0xC0,0x0E,0xC2,0x0B,0x0E,0x0B,0xC2,0x15,0x0B,0x0E,0xC2,0x0B,0x31,0x0B,0xC1,0x2A,0x3D,0x2A,0x0B,0xC0,0x0E,0xC0,0x0B,0x15,0x0B,0x0E,0xC0,0x9D,0x88,0x83,0x86,0x17,
+0x05,0xCE,0x0A,0x05,0xC7,0x14,0x05,0xC5,0xBB,0x83,0x3A,0x0E,0xFE,0x63,0x25,0x8F,0x8C,0x17,0x05,0xCB,0x0A,0x05,0xC7,0x14,0x05,0xC5,0x3F,0xFE,0x9D,0x2D,0x0B,0xC0,
+0x0E,0x0B,0xC1,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x9D,0x88,0x95,0x87,0x2B,0x0B,0x0E,0x0B,0x3A,0x0B,0x0E,0x0B,0xC1,0x0E,0xC0,0x11,0x05,0xC0,0x07,
+0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC9,0x3F,0x36,0x91,0x7E,0x0B,0x8E,0x99,0x14,0x05,0xC0,0xB5,0x84,0x94,0x89,0x97,0x9C,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCB,0xB8,
+0x73,0xA3,0x98,0x93,0x8D,0x3A,0x3C,0x17,0x06,0x34,0x0E,0x05,0xB3,0x85,0x34,0x0B,0x07,0x0E,0x0B,0xC0,0x0E,0xC2,0x0B,0x0E,0x3D,0xFE,0x3A,0x06,0x17,0x05,0xC0,0x00,
+0x30,0x11,0xC0,0x92,0x88,0x90,0x9A,0xFE,0xE7,0x38,0x0B,0xC2,0x0C,0x18,0x17,0x9D,0x9A,0xC3,0x29,0x96,0x88,0x97,0x9C,0xCD,0x0A,0x05,0xC7,0x14,0x05,0xC1,0xA9,0x85,
+0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x3D,0x0F,0x91,0x9A,0xA6,0x87,0xB3,0x77,0xB8,0x86,0xAD,0x98,0x12,0x15,0x0B,0xC0,0x21,0x34,0xA6,0x99,0x0B,0xC0,0x0C,0x29,0x05,
+0xC5,0xB5,0x84,0x92,0x89,0x0B,0xC0,0x15,0x0B,0x0E,0xC0,0x9D,0x88,0xFE,0x4A,0x86,0x17,0xB9,0x87,0x2D,0x15,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x2B,0xFE,
+0x5B,0x4A,0x87,0xAB,0xC6,0x22,0x91,0x9B,0x0B,0xC0,0xFE,0x6B,0xAA,0x0F,0x37,0x0B,0xC0,0x15,0x0B,0xC0,0x0E,0x2D,0x3A,0x0B,0x0E,0x0B,0x12,0x2B,0x81,0x9D,0x05,0xC6,
+0x0A,0x22,0x05,0xD0,0x0A,0x05,0xC7,0xA6,0x87,0x24,0x22,0x99,0x9D,0xAB,0x74,0x9C,0x47,0x8F,0xDD,0x05,0xC0,0x30,0x2A,0x0B,0x15,0x33,0x30,0x2A,0x0B,0xC0,0x0E,0x2D,
+0x11,0xC0,0x9B,0x96,0x2D,0x15,0x0B,0xC1,0x2B,0x30,0x22,0x9C,0x37,0x93,0xDD,0x05,0x0A,0x05,0xB7,0x67,0xBF,0xB7,0x0B,0x97,0x9A,0xA7,0x97,0x0B,0xC1,0x0E,0x9C,0x76,
+0x0C,0x2B,0xA3,0x88,0x0B,0x0E,0x0B,0xC0,0x9A,0x99,0x84,0x79,0x84,0x9B,0x22,0x98,0x59,0x99,0xAA,0x05,0xC2,0xAF,0x87,0x2D,0x3A,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x0B,
+0x12,0x0B,0x0E,0x2D,0x80,0x97,0x17,0x05,0x10,0x97,0xBB,0x05,0xC3,0x20,0x21,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0xC0,0x3D,0x82,0x6A,0x0A,0x05,0xC8,0x0A,0x05,0x3C,0xA1,
+0x8A,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xAF,0x84,0xAC,0x86,0x3C,0x15,0x30,0x86,0x8A,0x05,0x0A,0x20,0x05,0xC2,0x1F,0x05,0x17,0x05,0xC0,0x0A,0xA7,0x66,0xA4,
+0xEB,0xAC,0x51,0x17,0x0A,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC1,0xA5,0x87,0xFE,0x23,0x41,0xB1,0x62,0xA6,0x88,0xA3,0x88,0x69,0xC0,0x67,0x18,0xC0,0x9D,0x9B,0x95,
+0x9C,0xFE,0x01,0x60,0x98,0xCC,0x2B,0xAA,0x34,0xAF,0x64,0x0D,0x1A,0x18,0xC1,0x1A,0x96,0x9B,0xFE,0x6B,0xAB,0xC1,0xFE,0x76,0x09,0x18,0xC0,0x0A,0xFE,0x1A,0xC1,0x39,
+0x1A,0x1F,0x18,0xC1,0x39,0x37,0x96,0xDD,0xC1,0x2B,0xAE,0x83,0x17,0x05,0xD8,0xB5,0x20,0x0D,0x1A,0x18,0xC2,0x1A,0x18,0xC1,0x1A,0x90,0x9B,0xFE,0x01,0x00,0x9A,0xBB,
+0x05,0x28,0xB1,0x54,0xB4,0x51,0x18,0xC2,0x99,0x9C,0xFE,0x4C,0x07,0x16,0x58,0x19,0x18,0xC1,0x8F,0x9C,0x0D,0x1A,0x18,0xC1,0x1A,0x06,0x3E,0x0A,0x66,0xC1,0x3C,0xA6,
+0x75,0x98,0x9E,0x69,0xA3,0x88,0x3D,0xC0,0x26,0xA4,0x87,0x36,0x26,0x3D,0x9D,0xE6,0xA0,0xA9,0x9E,0xB6,0xA2,0xA7,0xA1,0xA9,0x79,0xA1,0xA9,0xFE,0x6B,0xC6,0x0A,0x15,
+0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x1A,0x18,0xC1,0x8B,0xBF,0xFE,0x00,0x60,0x62,0xC0,0xB4,0x42,0x0D,0x1A,0x18,0xC0,0x94,0x8B,0x06,0x10,0xFE,0x65,0xA7,0x1F,0x18,0xC0,
+0x1A,0x0E,0xA2,0x75,0x06,0x18,0xC0,0x3B,0x0F,0x05,0xC1,0xA5,0x87,0x15,0x1A,0x18,0x1A,0x8B,0x9D,0x0F,0x05,0xC3,0x10,0x59,0x96,0xCC,0x05,0xCD,0x0A,0x3A,0xB4,0x93,
+0x37,0xFE,0x10,0xC2,0xFE,0x6D,0x69,0xA6,0x52,0x18,0xC1,0x1A,0x06,0x35,0x0D,0xC0,0xFE,0x02,0x00,0x05,0xA3,0x87,0xFE,0x5C,0xE8,0x1A,0x18,0x1A,0x18,0xC2,0x35,0x3B,
+0x0F,0x05,0x0F,0xFE,0x3C,0x62,0x18,0xC1,0x1A,0x18,0xC2,0x35,0xFE,0x22,0xC2,0x92,0xBD,0x9A,0xCC,0x18,0xFE,0x3A,0x03,0x05,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x2B,
+0x13,0x0D,0x18,0xCC,0x36,0x3B,0xFE,0x09,0x81,0x0E,0x18,0x1A,0x18,0xC8,0x1A,0x18,0xC0,0x99,0x9C,0x15,0xFE,0x00,0xA0,0x05,0xC3,0x3F,0x24,0x0A,0x05,0xC1,0x17,0xAC,
+0x55,0x29,0x0D,0x18,0xC2,0x1A,0x18,0xC9,0x1A,0x18,0xC0,0x29,0x0F,0x05,0xC2,0x24,0x7B,0x05,0xC1,0x31,0xA4,0x67,0x9C,0x76,0xC1,0x24,0x2E,0x9B,0x88,0x1F,0x18,0xC2,
+0x1A,0x18,0xC9,0x9D,0x9A,0x18,0x1A,0x06,0x0C,0x0F,0x05,0xC1,0x32,0x13,0x0F,0x05,0xAA,0x66,0x9D,0x9A,0x0A,0xC0,0x05,0xC2,0x15,0x05,0x0F,0xBC,0x20,0x0D,0x18,0xC0,
+0x1A,0x18,0x1A,0x18,0xC7,0x97,0x9A,0x2C,0x18,0xC0,0x1A,0x18,0xC9,0x06,0x18,0xC1,0x1A,0x18,0xC0,0x10,0x05,0xC1,0x32,0x31,0x9C,0x89,0x59,0x96,0xCC,0x05,0xC2,0x28,
+0x2B,0xA3,0x67,0x13,0x0F,0x24,0x19,0x05,0xC9,0x04,0x93,0x8B,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x31,0x36,0x18,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0x92,0x9B,0x18,
+0x1A,0x18,0xC9,0x06,0x18,0xC2,0x1A,0x18,0x2C,0xFE,0x09,0x81,0x0A,0x15,0x0A,0x05,0xC3,0x10,0xA4,0x86,0x31,0x49,0x06,0x55,0x0C,0x2E,0x0F,0x05,0xC8,0xB3,0x85,0xA6,
+0xA4,0xFE,0xA9,0x61,0xFE,0x00,0x60,0x05,0xC6,0x17,0x2B,0xA3,0x67,0x2E,0x03,0x24,0x0A,0x05,0xC1,0x17,0x0A,0x05,0xC3,0xB7,0x94,0x9D,0xE7,0xFE,0xB1,0x81,0x0C,0x31,
+0x2C,0x1F,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x8F,0x9C,0x2C,0xA4,0x87,0x1A,0x51,0x18,0x06,0x18,0xC1,0x1F,0x18,0xC0,0x1A,0x18,0xC1,0x3B,0x0F,0x19,0x9C,0xAA,
+0x19,0x37,0x19,0x05,0x19,0x28,0xA4,0x77,0x10,0x06,0x2A,0x31,0x2E,0x10,0x2E,0x24,0x0C,0x97,0x99,0x0F,0xAD,0x66,0x24,0x0A,0x05,0xC5,0x0A,0xBC,0x56,0xC0,0x95,0x99,
+0x6E,0xC0,0x5A,0xA9,0xA9,0x94,0x98,0xAC,0x68,0x3C,0x01,0xC0,0x3C,0x01,0xC3,0x39,0x90,0xA9,0x07,0xA6,0x78,0xA3,0x88,0x7F,0x39,0x01,0xC1,0x39,0x3C,0x01,0x28,0x00,
+0x9D,0x99,0x07,0x26,0xC0,0xA2,0x98,0x1D,0x00,0x28,0xC0,0x39,0x3C,0xC5,0x01,0x3C,0xC2,0x01,0xD0,0x07,0x39,0x01,0xC5,0xA1,0xA6,0xC1,0x9F,0x96,0x9C,0x78,0x69,0x65,
+0x53,0x9C,0xAB,0x49,0x9B,0x9A,0xC0,0x50,0x51,0xC4,0x05,0xA2,0x87,0xA4,0x86,0x06,0xA4,0x86,0x26,0x39,0xA4,0x96,0xA2,0x78,0xA0,0x8A,0x62,0x4F,0x9F,0x9B,0xC0,0x3C,
+0x01,0xC4,0x3C,0x01,0x3E,0xC0,0x2B,0x9D,0x89,0x26,0x06,0x9B,0x9A,0x9C,0x87,0x9C,0x8A,0x9D,0xAA,0x5A,0xD3,0x08,0xA5,0x77,0xA4,0x86,0xA6,0x87,0xA5,0x87,0x39,0xA4,
+0x99,0x35,0x2B,0x4F,0x9F,0x9B,0x01,0x6C,0x9E,0x8B,0x94,0xB6,0x26,0x16,0x27,0x0F,0x06,0x47,0x07,0x39,0x8C,0xB8,0x9C,0x78,0x62,0xC7,0x6E,0x05,0xC6,0x0A,0x05,0xC7,
+0x0A,0x05,0xC8,0x0A,0x05,0xC0,0xA9,0x85,0x20,0xA5,0x9A,0x16,0x2B,0x31,0x39,0x01,0x9D,0xA5,0x2B,0x35,0x9E,0x7C,0x67,0x01,0xCB,0x8F,0xAA,0x3D,0x17,0xA8,0x87,0x0F,
+0x2B,0x31,0x3E,0x3C,0x01,0xC4,0x3A,0x01,0xC0,0x19,0x3D,0x40,0x1D,0x8F,0xBA,0xC1,0x20,0xAC,0x74,0xA8,0x76,0x3E,0x31,0x3C,0x01,0x3C,0x01,0xC2,0x19,0x3D,0x1F,0x1D,
+0xC0,0x0A,0x05,0xC2,0xAF,0x84,0x0F,0xA5,0x88,0x9E,0x7B,0xC0,0x67,0xC1,0x01,0x19,0x26,0x07,0x1D,0xC1,0x05,0xC8,0x0A,0x05,0xC7,0x7F,0x05,0xCA,0x0A,0x05,0xC7,0x14,
+0x05,0xCB,0x0A,0x05,0xC1,0x20,0x0F,0x38,0x31,0x28,0x26,0x07,0x18,0x05,0xC0,0xAE,0x85,0x24,0xC0,0x98,0x5A,0x1D,0xC0,0x05,0xC1,0xA6,0x87,0xAD,0x85,0x27,0x97,0x9B,
+0x1D,0x05,0x0A,0x05,0xC0,0x08,0x13,0x27,0x96,0x9D,0x01,0x69,0x22,0x05,0xC9,0x0A,0x05,0xC7,0xA6,0x87,0x13,0xB8,0x64,0x1A,0x01,0x05,0xC2,0xAB,0x86,0x0F,0x97,0x99,
+0x05,0xCB,0x0A,0x05,0xC7,0x14,0x05,0xCC,0xA6,0x87,0x24,0xA0,0x6C,0x8E,0xA7,0x97,0x9C,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC0,0xA9,0x97,0xFE,0xBE,0x54,0xAD,0x98,0x7A,
+0xC1,0x9A,0x89,0x88,0x77,0x89,0x9A,0x97,0x9C,0xC0,0x0A,0x31,0x17,0x05,0xCA,0x0A,0x05,0xC7,0x14,0xA6,0x76,0xFE,0xBE,0x31,0x0E,0xC0,0x0B,0xC0,0x0E,0x9C,0x76,0x88,
+0x9A,0x87,0x8A,0x97,0x9C,0xC0,0x01,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC2,0x21,0x0B,0xC0,0x0E,0xC3,0x9D,0x88,0x89,0x88,0x12,0x05,0x0A,0xB4,0x84,0x19,0x0B,0x98,
+0x87,0x87,0x89,0x87,0xAC,0x05,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x20,0x27,0x97,0x9B,0x18,0x2C,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x00,0x0E,0xFE,0x5B,0x6C,
+0xA2,0x74,0x1F,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xFE,0x7C,0x2B,0xBE,0x87,0x0E,0xC1,0x0B,0x0E,0x0B,0xC1,0x2B,0x87,0x99,0x85,0x8A,0x05,0x0F,0x15,0xA2,0x9A,
+0x04,0x34,0x1F,0x89,0x9A,0x97,0x9C,0xD0,0x0A,0x05,0xC7,0x14,0x05,0xC6,0xB5,0x84,0xA6,0x84,0x18,0xC0,0x01,0x0F,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC3,0xBD,0x73,
+0x3A,0x0B,0xC0,0x2B,0x9A,0x8A,0x42,0xA3,0xA8,0x0B,0xC0,0x6B,0x2B,0x1F,0x84,0x9B,0xA5,0x87,0xFE,0xBD,0xD1,0x0B,0x0E,0x0B,0x15,0x3C,0x31,0x99,0x9C,0xC7,0x0A,0x05,
+0xC7,0x14,0x05,0xC3,0x0A,0x05,0xC8,0xA5,0x87,0x24,0xC0,0x1D,0x2B,0xB7,0x87,0xBF,0x96,0x04,0x0B,0x0E,0x34,0x1E,0x08,0x5A,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCE,0xA9,
+0x97,0x27,0x20,0x1A,0x1D,0xC1,0x24,0x90,0x8C,0xFE,0xBE,0x31,0x9B,0x98,0x0B,0x0E,0x0B,0x93,0x89,0x82,0x96,0x05,0xCD,0x0A,0x05,0xC7,0x7F,0x05,0xC8,0x0A,0xB2,0x84,
+0x24,0x99,0x89,0x1D,0x9B,0xBA,0x40,0x29,0x13,0xA7,0x67,0xB6,0xA7,0xB1,0x79,0x0E,0x0B,0x0E,0x22,0x06,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCF,0x0F,0xA3,0x98,0x1F,
+0x62,0xA5,0x88,0x01,0x56,0x01,0x66,0xC0,0x28,0x01,0xC7,0x3C,0x01,0xC1,0x3C,0x20,0x05,0xCD,0x0A,0x05,0xC7,0x14,0x05,0x07,0xFE,0xEF,0x98,0x0B,0xC0,0x0E,0x0B,0xC1,
+0x0E,0x0B,0x0C,0x90,0x89,0x89,0x89,0x05,0xC0,0x06,0x27,0x34,0x0E,0xC0,0x0B,0x0E,0x0B,0x8D,0x96,0x2C,0x05,0x26,0xA2,0x97,0xA2,0x78,0xA3,0x89,0xA3,0x88,0xC0,0x01,
+0xC0,0x3C,0x01,0xC7,0x3C,0x3E,0x8F,0x9A,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x1E,0xFE,0xE7,0x76,0x0E,0xC1,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x12,0x9B,0x9B,0x91,
+0x87,0x13,0x3F,0xBD,0x84,0x31,0x0B,0x0E,0xC1,0x0B,0x2B,0x80,0x88,0x8C,0x8A,0x26,0x07,0x36,0x07,0x26,0x61,0x26,0x55,0xA3,0xA9,0x18,0x1D,0xA3,0x99,0xC0,0x01,0xC4,
+0xA1,0x85,0x88,0xBB,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x1E,0xFE,0xEF,0x98,0x04,0x0B,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC0,0x7B,0xC0,0x9C,0x78,0x9B,0x99,0x3A,
+0x34,0x3A,0x0B,0xC0,0x0E,0x0B,0x82,0x9A,0x8F,0x87,0xA9,0x88,0x26,0x07,0x36,0x6B,0x26,0x07,0x36,0x3D,0xC0,0x26,0x07,0x36,0x26,0x69,0x26,0x36,0x18,0x27,0x00,0xA3,
+0x93,0x0A,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xC6,0xBD,0x73,0xBF,0xA9,0x0B,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC1,0x0B,0xC0,0x0E,0xC1,0x88,
+0x8B,0xFE,0x08,0x80,0xB9,0x87,0xAF,0x94,0xFE,0x31,0xA6,0x26,0x07,0x36,0x3D,0xC1,0x26,0x07,0x36,0x3D,0xC2,0x26,0x07,0x3D,0x1F,0x06,0x65,0x91,0x9D,0xC7,0x0A,0x05,
+0xC7,0x14,0x05,0xC6,0xBF,0x82,0x2B,0x9A,0x8A,0x2D,0xC0,0xA3,0xA8,0x0B,0xC1,0x0E,0xC0,0x0B,0xC0,0x61,0x0B,0x0E,0x0B,0x0E,0x0B,0xC1,0x93,0x89,0xFE,0x18,0xE2,0x30,
+0xBC,0x78,0x78,0xFE,0x10,0xC1,0x0A,0xC0,0x3F,0xB5,0x99,0x2A,0x0E,0x15,0x59,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC0,0x9D,0x88,0xFE,0x52,0xC6,0x16,0x05,0x12,0xFE,
+0x10,0xC1,0x3C,0x33,0x2D,0xC0,0x11,0x00,0x17,0xB6,0x77,0x2A,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x0B,0x8E,0x99,0x87,0x89,0x19,0x12,0x0B,0x0E,0xC0,0x93,
+0x79,0x80,0xA7,0x8F,0x8E,0xE2,0x0F,0xA3,0x95,0xFE,0x42,0x28,0x99,0x97,0xBB,0x74,0xBA,0x9E,0xC2,0x54,0x90,0x97,0x82,0x79,0x36,0x0C,0xA8,0x76,0xC0,0x0E,0x0B,0xC0,
+0x0E,0x0B,0x0E,0x0B,0xC0,0xFE,0x6B,0xAB,0x2D,0x0B,0x15,0x0E,0x9C,0x76,0x33,0x0F,0xA9,0x85,0x91,0x9A,0x08,0x5A,0xC8,0x6E,0x05,0xC7,0x14,0x05,0xCB,0xAC,0x87,0xB1,
+0x71,0x96,0x9C,0x05,0xDA,0xA9,0x85,0xFE,0xAD,0x8E,0x31,0xC3,0x1B,0x0C,0x81,0x6A,0x28,0xFE,0xEF,0xBB,0x04,0x0E,0x12,0x0B,0x7B,0x0B,0x0E,0xC0,0x0C,0x11,0xB3,0x98,
+0x0B,0xC0,0x06,0x02,0x66,0xC6,0x13,0xA3,0x75,0x8D,0x9F,0xC9,0x0A,0x05,0xC7,0x7F,0x05,0xC5,0x3F,0xFE,0xBD,0xD1,0x31,0xC1,0x97,0x85,0x84,0x00,0x9E,0x9B,0x50,0xA3,
+0x9A,0x33,0x18,0x0C,0x0B,0xC0,0x7B,0xC0,0x0B,0xC0,0x04,0x92,0x87,0x0E,0x0B,0x11,0x3F,0x33,0xB3,0x89,0x1B,0xC1,0x33,0x83,0x86,0x05,0xA2,0x77,0xB1,0x44,0x30,0x37,
+0x30,0x12,0x15,0xC1,0x0B,0xC0,0x9C,0x86,0x34,0x0E,0x93,0x79,0xFE,0x18,0xE2,0xA9,0x54,0xA8,0xA9,0xA5,0x79,0x2D,0xAB,0xAB,0xC1,0x11,0x16,0x05,0xAB,0x44,0xAA,0x53,
+0xB3,0xBD,0x1B,0xFE,0x6B,0xAB,0xBE,0x87,0xA4,0x87,0xC0,0x7B,0x0B,0x0E,0x34,0xA4,0x87,0xA2,0x9A,0xFE,0x5B,0x4A,0x05,0x99,0x33,0x9A,0x79,0x7A,0xAD,0xCB,0xFE,0xEF,
+0xBB,0xA2,0x9B,0xC0,0x98,0x85,0x07,0x89,0xAD,0xFE,0x1B,0x41,0x7A,0x3D,0x31,0x37,0x2D,0x0B,0xC0,0x0E,0x0B,0xC0,0x92,0x86,0x0B,0x21,0x9A,0x8A,0xAB,0x76,0x19,0x90,
+0xCD,0xA8,0x66,0x15,0x2A,0xA4,0x9C,0xC0,0x3D,0x86,0x87,0x8C,0x89,0x23,0x2D,0xAB,0xA7,0xA0,0x8C,0x9B,0x87,0x11,0xB4,0x87,0x69,0xC0,0x0E,0x0B,0x92,0x86,0xAB,0x9A,
+0x30,0xBC,0x78,0x33,0x83,0x86,0xFE,0x0B,0x41,0xA0,0xA8,0x23,0x1B,0xC0,0x37,0xC0,0xA4,0x66,0x82,0x96,0x9D,0xAC,0xA5,0x77,0x8B,0xAD,0x5A,0xC6,0x0A,0x05,0xC7,0x7F,
+0x05,0xC9,0xB3,0x84,0x34,0x0E,0x5B,0x2A,0x0B,0x95,0xAB,0xB8,0x75,0x12,0x0B,0xC1,0x2A,0x3D,0x2D,0x9E,0x86,0x3D,0x3A,0xA2,0x78,0x0E,0x0B,0xC0,0x0E,0x31,0x0B,0x3D,
+0x33,0x11,0x37,0xC0,0x33,0xC0,0x2D,0x12,0xC0,0x0B,0xC0,0x8F,0xA8,0xFE,0x29,0x81,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xCB,0xA6,0x87,0xB8,0x71,0x08,0x1E,0xFE,0xE7,
+0x76,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0xC2,0x61,0x0B,0x0E,0xC2,0x0B,0x31,0x0B,0xC1,0x2B,0x3D,0x2A,0x0E,0xC0,0x0B,0x0E,0x0B,0x0E,0xC0,0x05,0x3C,0x2B,0x0E,0x0B,
+0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x31,0x0B,0xC1,0x6B,0x0B,0xC1,0x12,0x0B,0x7B,0x0B,0x0E,0x0B,0x05,0x3C,0x3A,0x0B,0x12,0x0E,
+0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0x0E,0xC0,0x0B,0x0E,0x96,0x76,0x3A,0x0B,0x12,0x0B,0xC0,0x0E,0xC0,0x0B,0x12,0x0B,0xC0,0x0E,0x0B,0x05,0xCB,0x0A,0x05,0xC7,
+0x14,0x05,0xC6,0xBF,0x82,0x2B,0x0E,0xC1,0x0B,0x0E,0xC0,0x0B,0xC3,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x98,0x9A,0xA4,0x74,0x0B,0x12,0x0B,0xC0,0x12,0x0E,0x0B,0x0E,0xC0,
+0x0B,0xC4,0x0E,0x0B,0xC0,0x0E,0x0B,0x3A,0x19,0x0B,0x12,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0xC2,0x30,0x20,0xA8,0x86,0x05,0x0B,0x0E,0x0B,0x0E,0xC2,0x0B,0x0D,0x0B,
+0xC1,0x0E,0xC1,0x0B,0x0E,0xC0,0x31,0x0B,0xC3,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x9A,0x99,0xFE,0x31,0xA5,0x14,0xB4,0x73,0x08,0x19,0x0E,0xC0,0x0B,0x3A,0x0B,0x0E,0x0B,
+0xC1,0x0E,0xC0,0x11,0x05,0xC0,0x07,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC9,0x3F,0x27,0x20,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC2,0x0B,0xC0,0x2B,0x25,0x05,0x08,0x36,
+0x8F,0x9B,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC8,0xB0,0x74,0x27,0x92,0x9F,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0xC0,0x21,0x14,0x05,0xC0,0x36,0x94,0x89,
+0x97,0x9C,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCB,0xB8,0x73,0xA3,0x98,0x18,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC1,0x9D,0x88,0x36,0x05,0xC1,0xB3,0x85,0x16,0x05,0xC7,
+0x0A,0x05,0xC7,0x14,0x05,0xC9,0xA6,0x87,0x27,0x36,0x1A,0x0B,0xC0,0x2B,0x3D,0x2B,0x04,0x0B,0x0E,0x0B,0xC1,0x0E,0xC0,0xFE,0x6B,0x87,0x8E,0xCE,0x6B,0x24,0x17,0x05,
+0xC9,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x29,0x34,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x2A,0x88,0x97,0x85,0x8A,0x05,0xC2,0xB7,0x67,0x0C,0x12,0x7A,
+0x0B,0xC0,0x12,0x0B,0xC0,0x36,0x05,0xC3,0x13,0x9B,0x77,0x05,0x0A,0x05,0xC0,0x14,0x05,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC2,0xA9,0x85,0x27,0x22,0x0B,0x6B,0x0B,0x0E,
+0xC1,0x0B,0x0E,0xC0,0x0B,0x3D,0x80,0x87,0x8B,0x9D,0xC5,0x33,0x12,0x0B,0x0E,0x0B,0x0E,0xC0,0x93,0x79,0x3A,0x05,0xC3,0x29,0x16,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,
+0xC9,0x22,0xA5,0x96,0x3F,0xA3,0x8A,0xC0,0x61,0x0E,0x5A,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0x0E,0x3D,0xFE,0x3A,0x06,0x17,0x05,0xC0,0xB4,0x67,0x30,0x11,0xC0,0x92,0x88,
+0x90,0x9A,0xFE,0xE7,0x38,0x0B,0xC2,0x0C,0x18,0x17,0x9D,0x9A,0xC3,0x29,0x96,0x88,0x97,0x9C,0xCD,0x0A,0x05,0xC7,0x14,0x05,0xC1,0x3F,0x27,0x06,0x1A,0x9B,0xCA,0x36,
+0x0F,0x0B,0xC0,0x12,0x0E,0x97,0x8A,0x0F,0x05,0x3A,0xB3,0x77,0xB8,0x86,0xAD,0x98,0x12,0x0B,0xC1,0x21,0x3D,0xA7,0x97,0x0B,0xC0,0x0C,0x29,0x05,0xC5,0xB3,0x85,0x31,
+0x05,0x1E,0x17,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCD,0xB8,0x73,0x97,0x48,0x0A,0x30,0x0B,0xC3,0x0E,0x0C,0x29,0x17,0xB9,0x87,0xB7,0x89,0xAB,0xA7,0x0B,0xC2,0x0E,
+0xC0,0x12,0x0B,0xC0,0x12,0x2B,0xFE,0x5B,0x4A,0x87,0xAB,0xC6,0x22,0x1F,0x05,0xCE,0x0A,0x05,0xC7,0x14,0x05,0x20,0x27,0x06,0x9C,0x9C,0xA9,0x84,0x22,0x05,0xE1,0x14,
+0x1E,0x96,0x25,0x93,0xEF,0x05,0x33,0x0B,0xC2,0x2B,0x3E,0x93,0x9B,0x37,0x0B,0xC0,0x15,0x0B,0xC0,0x0E,0x2D,0x3A,0x0B,0x0E,0xC0,0x0B,0xFE,0x6B,0x87,0x90,0x8A,0x05,
+0xCA,0x0A,0x05,0xC7,0x14,0x05,0xCB,0x39,0x9C,0x49,0x8F,0xDD,0x05,0xC0,0x30,0x2A,0x0B,0x15,0x33,0x30,0x2A,0x0B,0xC0,0x0E,0x2D,0x11,0xC0,0x9B,0x96,0x2D,0x15,0x0B,
+0xC0,0x0E,0x2B,0x81,0x9D,0x05,0xC7,0xA5,0x88,0xAB,0xA6,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x22,0x24,0x93,0x9C,0x3D,0x9D,0xC8,0xC0,0x6B,0xC0,0x13,0x04,0x1F,0x05,0xCF,
+0x0A,0x05,0xC7,0x14,0x05,0xC5,0xA5,0x87,0x22,0x9C,0x37,0x93,0xDD,0x05,0x0A,0x05,0xB7,0x67,0xBF,0xB7,0x0B,0x97,0x9A,0x3A,0x0B,0xC1,0x0E,0x9C,0x76,0x0C,0xA5,0x86,
+0xA3,0x88,0x0B,0x0E,0x0B,0xC0,0x9A,0x99,0x84,0x79,0x84,0x9B,0xC6,0x0A,0x05,0x3C,0xC0,0x26,0xC2,0x36,0xA2,0x75,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x05,0xCE,0xA6,0x87,
+0xAD,0x86,0x98,0x58,0x99,0xAA,0x05,0xC2,0xAF,0x87,0xFE,0xC6,0x97,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0x2D,0x29,0x05,0xC7,0x0A,0x05,0x29,0x96,0x9A,
+0x4E,0x28,0x05,0xC3,0xAA,0x78,0xFE,0xBE,0x54,0xAD,0x98,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x6B,0x0E,0x11,0x80,0x77,0x10,0x17,0x05,0xC3,0x20,0x21,0x0B,0xC1,0x0E,
+0x0B,0x0E,0x0B,0xC0,0x3D,0x82,0x6A,0x8B,0xA9,0x18,0xA7,0xB5,0x9A,0x87,0x05,0xC8,0x6E,0x05,0xC7,0x14,0x05,0xCE,0x3C,0x31,0x17,0xFE,0x44,0xC5,0xAD,0x84,0x9A,0x8A,
+0x39,0x98,0x88,0x9C,0xAA,0xC0,0xA5,0x9A,0xA8,0x76,0x31,0x0A,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xCC,0x20,0x17,0x05,0xFE,0x3C,0x62,0xB1,0x74,0xC7,0x1A,0x96,0x9B,
+0x12,0xFE,0x22,0x84,0x0F,0x05,0xC0,0x08,0x05,0xCB,0x31,0x14,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC1,0xB0,0x95,0xA8,0x66,0x94,0x9C,0xFE,0x3B,0xE5,0xB5,0x50,0x18,
+0xC2,0x1A,0x18,0xC1,0x1A,0x18,0xC0,0x97,0x9A,0xFE,0x09,0x81,0x08,0x05,0xC1,0x08,0xA9,0xB9,0xC3,0x69,0xC0,0xAC,0x44,0xA1,0x85,0x05,0x6E,0x05,0xC8,0x0A,0x05,0xC7,
+0x14,0x05,0xCD,0x3C,0x05,0xC0,0xB4,0x42,0x1A,0x18,0xC1,0x1A,0x18,0xC0,0x9D,0x9B,0x12,0xAA,0x88,0x18,0xC0,0x1A,0x29,0xFE,0x00,0x60,0x05,0x0A,0xA8,0xC8,0x2D,0xC0,
+0xA3,0x88,0xA4,0x65,0xC0,0x7B,0xAB,0x65,0x94,0x89,0x05,0xDD,0x28,0xA4,0x77,0xA4,0x55,0xC0,0x06,0x55,0x06,0x07,0x0F,0x05,0xAF,0x54,0xFE,0x76,0x09,0x18,0xC1,0x1A,
+0x18,0xC0,0x92,0x9B,0xFE,0x6B,0xAB,0x48,0xFE,0x5D,0xA5,0x18,0xC0,0x0E,0x37,0x0A,0xC0,0x13,0xC4,0x22,0xA8,0x86,0x89,0x9D,0x9C,0x8A,0xCA,0x0A,0x05,0xC7,0x14,0x05,
+0xC3,0x06,0xAA,0x53,0xA9,0x75,0x39,0x0E,0xC2,0x3B,0x91,0xBE,0xA0,0xBB,0x69,0x06,0x31,0x19,0x18,0xC1,0x1A,0x18,0xC0,0x92,0x9B,0xFE,0x6B,0xAB,0xC0,0xA3,0x33,0x1A,
+0x18,0xC0,0x15,0xFE,0x00,0xA0,0xA4,0x77,0xA8,0xC8,0xA3,0x78,0xA5,0x95,0x88,0x8F,0x0A,0x05,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC1,0xA5,0x87,0x15,0xB1,0x62,0xA6,0x88,
+0x18,0xC1,0x1A,0x18,0xC0,0x0D,0x39,0xFE,0x01,0x60,0x0F,0x2B,0xAA,0x34,0xAF,0x64,0x0D,0x1A,0x18,0xC1,0x1A,0x0E,0xFE,0x6B,0xAB,0xC1,0xFE,0x76,0x09,0x18,0xC0,0x0A,
+0x3E,0x39,0x1A,0x6E,0x18,0xC1,0x39,0x37,0x96,0xDD,0xC1,0x2B,0x31,0x95,0xAB,0x05,0xD6,0xB0,0x95,0x22,0x99,0x9D,0x69,0xA3,0x88,0x36,0xC0,0x3D,0xCA,0x36,0xA2,0x78,
+0x3D,0x13,0x1E,0x9A,0x86,0x90,0x8D,0x05,0xD8,0xB5,0x20,0x0D,0x1A,0x18,0xC2,0x1A,0x18,0xC1,0x1A,0x12,0x28,0x05,0xC0,0x28,0xB1,0x54,0xB4,0x51,0x18,0xC2,0x99,0x9C,
+0xFE,0x4C,0x07,0xFE,0x73,0xAD,0x58,0xFE,0x76,0x09,0x18,0xC1,0x8F,0x9C,0x0D,0x1A,0x18,0xC1,0x1A,0x06,0x3E,0xFE,0x00,0x40,0x66,0xC1,0xAB,0x55,0xA4,0x77,0x93,0xCC,
+0x05,0xCA,0x0A,0x05,0xC7,0xA6,0x87,0xB2,0x74,0x3D,0xC2,0x41,0x07,0x61,0x3D,0xC3,0x36,0x3D,0x9D,0xA8,0xA0,0xA8,0xA0,0xA6,0xA0,0xA9,0x9E,0xB6,0xA2,0xA7,0xA1,0xB8,
+0x18,0xC0,0x0E,0x2C,0xC0,0x1A,0x18,0xC1,0x99,0x9C,0x39,0x1A,0x1F,0x18,0x1A,0x18,0xC0,0x39,0xFE,0x00,0xA0,0x05,0xC2,0x31,0x19,0x05,0x7A,0x05,0xC7,0x08,0x05,0xC8,
+0x3C,0xA6,0x75,0x3D,0x36,0xA3,0x88,0x3D,0xC0,0x41,0x07,0x36,0x26,0x3D,0x1E,0x2B,0x12,0x25,0xC0,0xFE,0x10,0xC1,0x05,0xCB,0x0A,0x05,0xC7,0x7F,0x05,0xC1,0xFE,0x3C,
+0x62,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xC2,0x1A,0x06,0xFE,0x22,0xC2,0xFE,0x00,0x60,0x05,0xC1,0x0C,0xFE,0x44,0xC2,0x1A,0x18,0xC7,0x0D,0x89,0xAE,0xB1,0x72,0x06,
+0x18,0xC2,0x2C,0xFE,0x0A,0x00,0x0F,0x05,0xC1,0x3A,0x2E,0x0F,0x05,0xC6,0x6E,0x05,0xC7,0x14,0x05,0xC0,0xB5,0x84,0x9A,0x88,0x3C,0x53,0x9D,0xA9,0xC0,0x1E,0xA0,0xA9,
+0x9D,0xB7,0x7E,0xA3,0x99,0xA0,0xB7,0x7A,0x61,0xC1,0xA3,0x98,0xC0,0x56,0x05,0xFE,0x00,0x20,0x6E,0xC0,0x10,0xFE,0x55,0x63,0x24,0x1A,0x18,0xC1,0x1A,0x18,0xC2,0x0D,
+0xFE,0x02,0x00,0x3E,0xB7,0x63,0x1F,0x18,0xC2,0x8A,0x9E,0x0F,0x05,0xC2,0xAB,0x55,0x59,0x05,0xCA,0x6E,0x05,0xC5,0xAB,0x86,0xAD,0x86,0x2B,0x12,0x25,0x37,0x33,0x3D,
+0x7E,0x51,0x56,0xC4,0x3D,0x18,0xC1,0x0E,0xFE,0x01,0x60,0x96,0xDD,0xC3,0xAF,0x54,0x19,0x05,0xC0,0x0A,0x05,0xC0,0x14,0x05,0xCB,0x22,0x18,0x1A,0x18,0xC0,0xFE,0x02,
+0x00,0x0A,0x05,0xC1,0x0A,0xAA,0x55,0x2E,0x91,0xED,0x05,0xCC,0x0A,0x05,0xC1,0x0F,0x9B,0x9A,0x9D,0xA9,0xAA,0x85,0x8D,0x7B,0x17,0x05,0xCD,0x0A,0x05,0xC7,0x14,0x05,
+0x28,0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x1A,0x18,0xC1,0x3B,0xFE,0x00,0x60,0x05,0xC0,0xB4,0x42,0x0D,0x1A,0x18,0x2C,0x9B,0x88,0x0D,0x1A,0x18,0xC1,0x8F,0xAD,0x0F,0x05,
+0xC0,0xA5,0x87,0xB9,0x10,0x0D,0x18,0xC0,0x1A,0xFE,0x23,0x03,0x05,0xC4,0xAF,0x54,0x95,0xAB,0x05,0xC0,0x14,0x05,0xCC,0x2B,0xB6,0x84,0xFE,0x81,0x62,0xFE,0x4A,0x25,
+0xA3,0x77,0xA8,0x86,0x05,0xD2,0x0A,0x05,0xC6,0x0C,0xFE,0x6E,0x26,0x18,0xC0,0x1A,0x18,0xC5,0x1A,0x18,0xC1,0x2C,0xFE,0x0A,0x00,0x0A,0x05,0x10,0x36,0x1F,0x18,0xC0,
+0x1A,0x0E,0xA2,0x75,0x06,0x18,0xC0,0x3B,0x0F,0x05,0xC1,0xA5,0x87,0x15,0x1A,0x18,0x1A,0x8B,0x9D,0x0F,0x05,0xC3,0x10,0x59,0x96,0xCC,0x05,0xCD,0x0A,0xA4,0x88,0xB5,
+0xA3,0x25,0x08,0x32,0x0E,0xA8,0x75,0x18,0xC1,0x1A,0x9A,0x89,0x92,0xBF,0x0F,0x0A,0x05,0xC4,0xB7,0x10,0x36,0x39,0xFE,0x00,0xA0,0x05,0xC4,0x10,0xA4,0x66,0x05,0xC0,
+0x0A,0x05,0xC0,0x14,0x05,0xC9,0x04,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xC2,0x9D,0x89,0x05,0x3D,0x29,0x3D,0x29,0xC0,0x66,0x12,0x1A,0x1F,0x18,0xC0,0x1A,0x18,0xC7,0x1A,
+0x06,0xFE,0x22,0xC2,0xFE,0x00,0x60,0x62,0xBF,0x20,0x18,0xC1,0x1A,0x18,0xC2,0x94,0x8B,0x08,0x92,0xBD,0x0A,0x05,0xC4,0xB7,0x10,0x13,0xFE,0x00,0xA0,0x05,0xC5,0x0C,
+0x0F,0x72,0x05,0xCC,0x08,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x05,0xC0,0xB8,0x10,0x1A,0x18,0xCD,0x39,0x19,0x05,0x2C,0x18,0xC1,0x1A,0x18,0xC3,0x0D,0x3B,0x91,0xBE,0x0A,
+0x05,0x08,0x05,0x25,0x06,0x18,0xC3,0x1A,0x18,0xC6,0x0E,0x3E,0x0A,0xFE,0x54,0xE7,0x18,0xC5,0x1A,0x18,0xC2,0x1A,0x8B,0x9D,0xFE,0x09,0x81,0x0F,0x05,0xC3,0x10,0x2E,
+0x0A,0x05,0xC3,0x31,0x19,0x05,0xC9,0x0A,0x05,0xC3,0x3F,0xA3,0x78,0x2E,0x0F,0x05,0xC2,0x10,0xA4,0x66,0x05,0xC9,0x0A,0x05,0xC4,0xB0,0x95,0x08,0xFE,0x3B,0xE5,0x0D,
+0x18,0xCC,0x36,0x3B,0x06,0x0E,0x18,0xCA,0x1A,0x18,0xC0,0x99,0x9C,0x8D,0xBD,0x19,0x05,0xC3,0x3F,0x24,0x0A,0x05,0xC1,0xA3,0x87,0x31,0x0F,0x05,0xC8,0x0A,0x05,0xC5,
+0xB5,0x84,0x0A,0x05,0x2E,0x06,0x05,0xCF,0x0A,0x3F,0x22,0xFE,0x8A,0x21,0x05,0xC0,0xA8,0x55,0xA7,0x54,0x93,0xEF,0x05,0x19,0x05,0xC1,0x0A,0x05,0xC5,0x0A,0x05,0xC2,
+0xB3,0x85,0xA1,0xF6,0x0A,0x05,0xDD,0x14,0x2B,0xFE,0x3C,0x62,0xAE,0x75,0x18,0xCC,0x2C,0x91,0x9B,0x0D,0x18,0xC2,0x1A,0x18,0xC9,0x1A,0x18,0xC0,0x29,0x0F,0x05,0xC2,
+0x24,0x2E,0x05,0xC1,0x31,0x0C,0x13,0xC1,0x24,0x2E,0x9B,0x88,0x0F,0x05,0xC0,0x0A,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x05,0xC2,0xB5,0x20,0x0D,0x18,0xC0,0x1A,0x18,0xC9,
+0x06,0x12,0x1A,0x18,0xC2,0x1A,0x18,0xC9,0x06,0x18,0x1A,0x06,0x0C,0x0F,0x05,0xC1,0x2B,0x13,0x0F,0x05,0xAA,0x66,0x9D,0x9A,0x0A,0x05,0xC2,0x0F,0x15,0x4C,0x05,0x18,
+0xC1,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0xC0,0x1A,0x18,0xC0,0x0E,0xFE,0x09,0x21,0x0A,0x05,0xC0,0x2B,0x24,0x0F,0x24,0x9C,0x99,0x05,0xA8,0x88,0x31,0x2E,0x06,0xC1,0x0F,
+0x06,0x3F,0x2C,0x18,0xC0,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0xC1,0x1A,0x18,0xC0,0xFE,0x02,0x00,0x05,0xC1,0x32,0x31,0x9C,0x89,0x59,0x05,0xC1,0x7A,0x05,0xA7,0x55,0x2B,
+0x06,0x10,0x0F,0x24,0x20,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xCA,0x31,0xFE,0x65,0xA7,0x18,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0x92,0x9B,0x18,0x1A,0x18,0xC9,0x06,0x18,
+0xC2,0x1A,0x18,0x2C,0xFE,0x09,0x81,0x0A,0x05,0xC0,0xAA,0x66,0x31,0x06,0x0F,0x05,0xC0,0x32,0xFE,0xB1,0x81,0xFE,0x45,0x03,0x36,0x0D,0x18,0x1A,0x18,0xC9,0x9D,0x9A,
+0x18,0xC2,0x3B,0x0F,0x62,0xC0,0x10,0x15,0x0A,0x05,0xC0,0x0A,0x05,0xC0,0x10,0x31,0xC0,0x49,0x9C,0x99,0x37,0x0C,0x2E,0x0F,0x05,0xC8,0xB0,0x74,0x25,0x0E,0x18,0x1A,
+0x18,0xC9,0x9D,0x9A,0x18,0x1F,0x18,0xC0,0x0D,0xFE,0x02,0x00,0x05,0x17,0x24,0x9C,0x99,0x0F,0x0A,0x05,0xC5,0x17,0x2B,0x37,0x15,0x03,0x24,0x0A,0x05,0xC1,0x17,0x0A,
+0x05,0xC3,0xB7,0x94,0xFE,0x6E,0x27,0x3B,0x39,0xA5,0x84,0x9B,0x9A,0xC6,0x12,0xC0,0x59,0x12,0xC0,0x08,0x12,0x3B,0x29,0x0C,0x31,0x0C,0x3E,0x10,0xA0,0xAA,0x2E,0x9B,
+0x88,0x73,0x05,0x0F,0x05,0xC0,0x2B,0xC0,0x05,0x0F,0x14,0x15,0x2E,0x28,0x05,0xC7,0x20,0x27,0x36,0x1F,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x08,0x25,0x0D,0x1A,
+0x51,0x18,0x06,0x18,0xC1,0x1F,0x18,0xC0,0x1A,0x18,0xC1,0x3B,0x0F,0x19,0x05,0x19,0x37,0x19,0x05,0x19,0x28,0xA4,0x77,0x7B,0x06,0x2A,0x31,0x2A,0x10,0x2E,0x31,0x0C,
+0x06,0xAF,0x77,0xAC,0x78,0x6E,0x9C,0x88,0x9D,0x99,0x9C,0x88,0x9C,0xA9,0x41,0x3D,0x00,0xC0,0x01,0xFB,0x96,0x99,0x3C,0x01,0xE0,0x00,0x3D,0x26,0x07,0x18,0x3C,0x01,
+0xED,0x27,0x3C,0x01,0xDB,0x3C,0x51,0xA2,0x78,0x3C,0xC2,0x01,0xC6,0x26,0xC1,0x18,0x00,0x19,0x28,0x39,0x3C,0xC1,0x01,0x3C,0xC0,0x01,0xC8,0x39,0x28,0x19,0x00,0x27,
+0x60,0x64,0xA2,0x77,0xA3,0x99,0xA4,0x77,0xA4,0x97,0xA2,0x77,0x2B,0x35,0x2B,0x35,0x2B,0x35,0x2B,0x35,0x2B,0x35,0xC0,0x2B,0x35,0xC0,0x9E,0x7C,0xC1,0x39,0x28,0x01,
+0xCB,0x93,0xA9,0x39,0x01,0xCF,0xA1,0xA6,0x35,0x2B,0x35,0x9B,0x9A,0x9B,0x99,0x6D,0x06,0x65,0x9C,0x8A,0x50,0x51,0xC6,0xA4,0x87,0x3C,0x06,0xA4,0x86,0x0F,0xA3,0x97,
+0x35,0x2B,0x35,0x3E,0x47,0xC0,0x39,0x01,0xC8,0x07,0xAC,0x78,0x01,0xCA,0x3E,0x49,0x9D,0xB9,0x0F,0x22,0x9C,0x88,0x05,0x51,0x9C,0x8A,0x9D,0x9A,0xD3,0xA5,0x87,0x12,
+0xA3,0x9A,0xA9,0x74,0xA4,0x97,0xA2,0x78,0x35,0x9E,0x7C,0xC0,0x39,0x01,0xC2,0x39,0x01,0x00,0xC0,0xA6,0x88,0x01,0xC6,0xA1,0x85,0x1E,0x0F,0x22,0x9C,0x88,0x98,0x89,
+0x17,0x05,0xDE,0x31,0x3A,0x32,0x16,0xA4,0x68,0x3E,0x47,0xC1,0x6D,0x39,0x18,0x3C,0x39,0x01,0xC3,0x3C,0xA2,0x74,0x99,0xB9,0x99,0x9A,0x2B,0x05,0xE6,0x2B,0x12,0x20,
+0x0F,0x24,0x29,0x9C,0x69,0xC0,0x07,0x01,0xC5,0x66,0x20,0x05,0xEC,0x2B,0xA9,0x97,0xA9,0x77,0xA4,0x97,0x0F,0x31,0x3A,0xC0,0x39,0x01,0xC0,0x3A,0x67,0xC0,0x29,0x05,
+0xEF,0xA7,0x87,0xAC,0x83,0x24,0x35,0x31,0x3A,0x01,0xC4,0x3A,0x22,0x05,0xF1,0xA7,0x85,0x20,0x27,0x35,0x3A,0xC0,0x39,0x01,0xCB,0x19,0x26,0x3D,0xA5,0x67,0xC3,0x01,
+0xC1,0x06,0x05,0xF3,0xA6,0x87,0x14,0x24,0x35,0x9E,0x7C,0x3C,0xC0,0x01,0xC5,0x3A,0x01,0xC0,0x19,0x3D,0x40,0x1D,0xC4,0x01,0xC0,0x3A,0x90,0xA8,0x05,0xF5,0x31,0xAD,
+0x86,0xAB,0x76,0x3E,0x3A,0xC0,0x39,0x01,0xC0,0x3C,0x01,0xC2,0x19,0x3D,0x1F,0x1D,0xC5,0x01,0xC1,0x31,0x17,0x05,0xF6,0xAB,0x86,0x1E,0x35,0x3A,0x3C,0x01,0xC4,0x19,
+0x26,0xA4,0x87,0x1D,0xC6,0x01,0xC0,0x6C,0x31,0x17,0x05,0xCF,0x22,0x31,0x17,0x05,0xE3,0xA5,0x87,0x06,0xAB,0x97,0x35,0x3A,0xC0,0x39,0x01,0xC0,0x28,0x26,0xA5,0x78,
+0xA2,0x98,0x1D,0xC6,0x01,0x3C,0x64,0x17,0x05,0xD0,0xBB,0x84,0xAA,0x87,0x8F,0x88,0x90,0x9C,0x05,0xE4,0x3F,0xB0,0x73,0xA8,0x76,0x3E,0x3A,0x3C,0xC0,0x26,0x07,0x1D,
+0xC8,0x01,0xC1,0x17,0x05,0xD0,0xB7,0x74,0xFE,0xE7,0x76,0x9A,0x88,0x89,0x8A,0x8C,0x9A,0x97,0x9C,0xC4,0x22,0x06,0x05,0xDD,0xB0,0x95,0x38,0x35,0x3A,0x93,0xAA,0x3D,
+0x1D,0xC9,0x01,0xC0,0x9C,0x95,0x05,0xD1,0xAC,0x87,0xFE,0xD6,0xF5,0xA8,0x99,0x15,0x0F,0x8A,0x89,0x05,0xC3,0x06,0xB8,0x85,0x9A,0x9A,0x89,0x8B,0x05,0xDC,0x20,0x1E,
+0x39,0x20,0x10,0x1D,0xC9,0x01,0x66,0x99,0xA6,0x8E,0x8B,0x05,0xD0,0xA6,0x87,0xFE,0xBE,0x31,0x0E,0xC0,0x51,0x8F,0x86,0x22,0x05,0xC3,0xBF,0x82,0x15,0x31,0x84,0x89,
+0x1F,0x05,0xDB,0xA5,0x87,0xB0,0x85,0x24,0x20,0x1D,0xC9,0x01,0x3C,0x29,0x05,0xD2,0x0F,0xB9,0x88,0x0E,0x3A,0xA2,0x78,0x93,0x89,0x07,0x05,0xC2,0xAB,0x86,0xFE,0xBD,
+0xD1,0x04,0x34,0x87,0x89,0x1F,0x05,0xDC,0x13,0x38,0x95,0xAB,0x1D,0x5A,0x1D,0xC6,0x01,0x69,0x06,0x05,0xD2,0x3C,0xBF,0xA9,0xA2,0x78,0xC2,0x93,0x89,0x07,0x1F,0x05,
+0xC1,0x1E,0x15,0x0E,0x34,0x8C,0x99,0x87,0x8A,0x97,0x9C,0xC7,0x7F,0x05,0xD2,0x06,0xAB,0x97,0x9C,0x76,0x1A,0xC0,0x1D,0xC5,0x01,0xC0,0x8E,0xA6,0x97,0x9C,0xD2,0xB5,
+0x84,0xFE,0xEF,0x98,0x0E,0x3A,0xA2,0x78,0x0E,0x3A,0x19,0x84,0x8A,0x1F,0x05,0xC0,0xA9,0x85,0x3D,0x04,0x88,0x9C,0x34,0x21,0x83,0x9D,0x95,0x9B,0xDC,0x20,0x1E,0x39,
+0x9C,0x6A,0x1D,0xC5,0x01,0xA1,0x85,0x1F,0x05,0xC7,0x0A,0x05,0xC7,0x14,0x13,0xFE,0xE7,0x38,0x0E,0xC1,0x3A,0x0B,0x0E,0x22,0x89,0x76,0x1F,0x05,0xC0,0x1E,0x21,0x06,
+0x2B,0x0E,0x21,0x20,0x05,0xDC,0x3F,0x39,0x16,0x98,0x5C,0x1D,0xC4,0x01,0x1E,0x87,0xAD,0x05,0xD2,0x20,0xFE,0xCE,0xB3,0x0E,0xC1,0x98,0x8A,0x94,0x78,0x8F,0x89,0x20,
+0xA8,0x86,0x36,0x17,0x05,0xA9,0x97,0x22,0xA9,0x9C,0x0B,0x0E,0x15,0x21,0x20,0x05,0xDC,0xA5,0x87,0x0F,0x24,0x98,0x5A,0x1D,0xC3,0xA9,0x99,0x99,0xA6,0x0A,0x05,0xD2,
+0xA6,0x87,0xFE,0xBE,0x31,0x0E,0x97,0x8A,0x8B,0x99,0x8A,0x7A,0x05,0x2B,0xA3,0x9A,0x3F,0x39,0x22,0x05,0xC0,0x0F,0x34,0x0E,0xC0,0x51,0x0B,0x87,0x98,0x84,0x8A,0x97,
+0x9C,0xDC,0x2B,0x36,0xA6,0x84,0x19,0x1D,0xC2,0xAA,0x87,0x94,0xA6,0x0A,0x05,0xC6,0x0A,0x05,0xC9,0x2B,0x0F,0x55,0x3F,0xA9,0x9A,0x30,0xAD,0x99,0x3D,0xA3,0x98,0xC1,
+0x95,0x97,0x3A,0x05,0x29,0x19,0x0E,0x0B,0xC1,0x9D,0x98,0x00,0x3F,0x05,0xDC,0xA5,0x87,0xB3,0x85,0x24,0x98,0x5A,0x1D,0xC1,0xAB,0x85,0x88,0xBB,0x05,0xD4,0x07,0xA5,
+0x9A,0xB7,0x89,0xA9,0xA6,0x0B,0x0E,0x3A,0x0B,0x0E,0x0B,0xC0,0x22,0x82,0x79,0x2B,0xFE,0xB5,0xB2,0x04,0x0E,0x0B,0xC0,0x0E,0x9A,0x89,0x88,0x77,0x84,0x9B,0x9C,0x8A,
+0xDC,0xA5,0x88,0x0F,0x24,0x98,0x5A,0x1D,0xC0,0x0F,0x05,0xD5,0xFE,0x7C,0x2B,0xBC,0x98,0x0B,0x0E,0xC0,0x3A,0x0B,0x0E,0x0B,0xC1,0x0E,0x8A,0x76,0x20,0xB0,0x86,0xFE,
+0xEF,0x98,0x0E,0x0B,0xC0,0x0E,0xC0,0x9A,0x89,0x32,0x89,0x9B,0x05,0xD1,0x14,0x05,0xC8,0xA6,0x87,0x24,0x0F,0x18,0x1D,0x01,0xC1,0x3C,0x29,0x0A,0x05,0xD4,0xBF,0x82,
+0xBD,0x9A,0x0B,0x0E,0xC1,0x3A,0x0B,0x0E,0x0B,0xC0,0x0E,0x3A,0x89,0x88,0x8A,0x89,0xFE,0xBE,0x54,0xAD,0x98,0xC0,0x0E,0xC1,0x51,0x95,0x79,0x82,0x98,0x05,0xDD,0xA9,
+0x85,0xB2,0x86,0x39,0x18,0x1D,0xD2,0x01,0xC1,0x69,0x94,0xA6,0x91,0x9D,0xD5,0x1E,0xFE,0xE7,0x76,0xA4,0x8B,0xC1,0x0E,0x51,0xA2,0x78,0x0E,0x0B,0xC0,0x0E,0x0B,0x9D,
+0x98,0x85,0x89,0x00,0x04,0x0E,0x0B,0xC2,0x00,0x22,0x06,0x08,0x05,0xDC,0x20,0x1E,0x39,0x9C,0x6A,0x1D,0xD0,0x9D,0xA9,0x01,0xC1,0x69,0x8E,0xA7,0x97,0x9C,0xD5,0x36,
+0x34,0x3D,0x2D,0x9E,0x86,0x3D,0xA3,0x98,0x12,0x69,0xC2,0x0E,0xC0,0x34,0x87,0x89,0x19,0x0E,0x0B,0xC1,0x2B,0xFE,0x39,0xE4,0x06,0xB2,0x97,0x8D,0x89,0x05,0xDD,0x06,
+0xAB,0x97,0x9C,0x76,0x18,0x1D,0xCD,0x99,0xAA,0x69,0x26,0x01,0xC0,0x66,0x1E,0x08,0x05,0xD5,0x06,0x2B,0x8A,0x8D,0x14,0x05,0xC0,0xAF,0x87,0x30,0xB6,0x88,0x12,0xC0,
+0x0E,0x0B,0xC0,0x0E,0x92,0x76,0x9D,0xAA,0x04,0x0B,0xC1,0x8E,0x99,0xFE,0x18,0xE2,0x37,0x15,0x8B,0x9A,0x82,0x8A,0x05,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xC4,0x13,0xAD,
+0x63,0x06,0x1D,0xCA,0x9B,0xBA,0x9D,0x78,0x26,0x3D,0x25,0xC0,0x01,0xC0,0x3C,0x29,0x05,0xC8,0x0A,0x05,0xCB,0xAE,0x85,0x0F,0x2D,0xC0,0x9E,0x86,0x33,0x87,0x8A,0x05,
+0xAC,0x87,0x37,0x12,0x69,0xC2,0x61,0x8F,0x86,0x04,0x0E,0x0B,0xC0,0x3E,0x30,0x12,0x0B,0x34,0x82,0x89,0x8C,0x9B,0x05,0xDC,0xA5,0x87,0xB0,0x85,0x16,0x18,0x1D,0xC7,
+0x26,0x17,0x26,0xA2,0x98,0xA8,0x67,0x25,0xC1,0x01,0xC0,0x69,0x20,0x05,0xD6,0x3C,0xFE,0xCE,0xB3,0xAA,0x9F,0xC2,0x9B,0x87,0x30,0x14,0x26,0x2D,0xAB,0xA7,0x0E,0x51,
+0x0B,0x0E,0x9C,0x76,0x0E,0x0B,0xC0,0x9D,0x98,0x3C,0x0C,0x12,0x0B,0x9A,0x99,0x85,0x77,0x06,0x05,0xDD,0xA9,0x85,0xB2,0x86,0x9C,0x76,0x1A,0x1D,0xC3,0x07,0x26,0x17,
+0x3D,0x25,0xC5,0x01,0x66,0xA2,0x74,0x1F,0x9C,0x8A,0xD6,0xAE,0x85,0xFE,0xCE,0xB3,0xAA,0x9F,0xC4,0x88,0x86,0x0A,0x00,0xFE,0xEF,0xBB,0x0B,0xC4,0x3A,0x0B,0x93,0x89,
+0x30,0x12,0x69,0x9D,0x98,0xFE,0x5B,0x4A,0x8A,0x99,0x0F,0x91,0x9A,0x97,0x9C,0xC9,0x0A,0x05,0xC7,0x14,0x05,0xC7,0x06,0xAB,0x97,0x32,0x18,0x1D,0xC1,0x99,0xA9,0x26,
+0x10,0x25,0xC7,0xAA,0x67,0x01,0xD0,0x69,0x1E,0x08,0x05,0xD6,0x20,0xFE,0xBE,0x54,0x31,0xC4,0x54,0xFE,0x73,0xAD,0x14,0x0B,0xAD,0x98,0x0E,0x51,0x0B,0x0E,0x0B,0xC0,
+0x0E,0x11,0xAB,0x98,0x0B,0x9D,0x98,0x30,0x14,0xA4,0x76,0xB7,0x87,0x0F,0x88,0x9D,0xDD,0x14,0x0F,0x24,0x18,0x1D,0x98,0x99,0x1F,0x02,0x25,0x28,0xA2,0x78,0x28,0x01,
+0x3C,0xC0,0x01,0x3C,0x01,0xC5,0x3C,0x01,0xC1,0x3C,0x9A,0x93,0x05,0xD7,0xAB,0x86,0xFE,0xBE,0x54,0x31,0xC5,0x0C,0xFE,0x31,0xA5,0xB0,0x76,0x12,0x7A,0x0E,0x5A,0xC2,
+0x0E,0x8D,0x86,0x04,0x0B,0x21,0xFE,0x08,0x80,0x36,0x2D,0x31,0x21,0x83,0x88,0x91,0x9D,0xDD,0xA9,0x85,0x27,0x99,0x99,0xFE,0x21,0x24,0xA4,0x88,0x25,0xC1,0x9A,0x78,
+0xC0,0x07,0xA3,0x89,0x00,0xC0,0x01,0xC0,0x3C,0xA2,0x75,0x01,0xC6,0x3C,0x3E,0x20,0x95,0x9B,0xC8,0x0A,0x05,0xC7,0x14,0x05,0xC2,0x20,0x22,0x31,0xC6,0x11,0xFE,0x18,
+0xE2,0xFE,0xE7,0x79,0x12,0xC0,0x0E,0x0B,0x0E,0x51,0x0B,0x93,0x89,0xAD,0x98,0x9A,0x99,0xFE,0x3A,0x06,0x26,0x37,0x31,0xC0,0x1B,0x83,0x85,0x84,0x9B,0x05,0xDC,0x14,
+0x13,0xAF,0x53,0x95,0xAB,0x25,0xC2,0x26,0x07,0x3D,0x07,0x26,0x15,0x26,0x55,0x3D,0x07,0x1D,0x00,0xC0,0x01,0xC2,0x39,0x3C,0xA2,0x74,0x1F,0x05,0xC8,0x0A,0x05,0xCC,
+0xA9,0x85,0xFE,0xAD,0x8E,0xFE,0xFF,0xFF,0xC3,0x1B,0xC1,0x9C,0x88,0x18,0x21,0x04,0x0B,0xC2,0x0E,0x19,0x34,0x0E,0x88,0x8B,0x80,0x89,0x37,0x1B,0x31,0xC1,0x37,0x81,
+0x88,0x92,0x8B,0xDC,0x14,0xA2,0x76,0x24,0x9D,0x8A,0x25,0xC2,0x26,0x07,0x36,0x6B,0x26,0x07,0x36,0x3D,0xC1,0x07,0x36,0x26,0x69,0x26,0x36,0x18,0x00,0xA3,0x88,0x9E,
+0xA5,0x17,0x0A,0x05,0xD6,0x3F,0xFE,0xAD,0x8E,0x31,0xC2,0x2D,0x30,0x9C,0x78,0xB5,0x87,0xAD,0x98,0x33,0x05,0x12,0x0B,0xC0,0x0E,0xC1,0x34,0xA5,0x99,0xC0,0xFE,0x3A,
+0x06,0x33,0x2A,0x2D,0x0C,0x12,0x31,0x9B,0x87,0x82,0x85,0x08,0x5A,0xDD,0x06,0xAE,0x84,0x95,0x9D,0x25,0xC1,0x9C,0x88,0x26,0x07,0x61,0x3D,0xC1,0x26,0x07,0x3D,0xC3,
+0x26,0x07,0x3D,0x1F,0x29,0x9C,0x87,0x05,0xD8,0xA6,0x87,0xFE,0xAD,0x8E,0x31,0xC1,0x33,0xFE,0x33,0x25,0xA1,0x54,0x9E,0xAB,0xA2,0x75,0xB8,0xFF,0xA4,0x99,0x1F,0x0C,
+0xA8,0x77,0x69,0xC1,0x0E,0x96,0x76,0x0E,0x22,0x00,0x3D,0x8A,0x23,0x98,0x78,0x7F,0x21,0x31,0xC0,0x11,0x81,0x97,0x05,0xDC,0x14,0x17,0x1E,0x55,0x25,0xC1,0x9C,0x88,
+0x26,0x07,0x36,0x3D,0xCA,0x26,0x3D,0xAB,0x74,0x90,0x99,0x17,0x05,0xD7,0x3A,0xFE,0xAD,0x8E,0xFE,0xFF,0xFF,0xC1,0x37,0xFE,0x1B,0x41,0x96,0xBC,0x98,0xBC,0xAE,0x53,
+0xB3,0xAC,0x1B,0x16,0x37,0xB1,0x77,0x0E,0x51,0x0B,0x0E,0x22,0x3A,0x30,0x37,0x21,0x19,0x91,0xDE,0xA7,0x66,0xAF,0x75,0xBE,0xEE,0x31,0x9A,0x84,0x0F,0x88,0x9D,0xDE,
+0xB0,0x95,0xAE,0x63,0x29,0x25,0xC0,0x9C,0x88,0x26,0xA4,0x87,0x61,0x3D,0xC3,0x02,0xA6,0x84,0x05,0xD9,0xA6,0x87,0xFE,0x9D,0x2D,0x31,0xC1,0x2D,0xFE,0x1B,0x41,0x9B,
+0x9A,0x97,0xDE,0xAC,0x54,0x23,0x31,0x8F,0x96,0x99,0x89,0xB8,0x76,0xC0,0x0E,0x0B,0x0E,0x92,0x76,0x2B,0xFE,0x5B,0x4A,0xFE,0xEF,0xBB,0x95,0x87,0x19,0x91,0xDE,0xA7,
+0x54,0xAE,0x42,0xFE,0xE7,0x5B,0xA5,0x9A,0x9F,0x85,0x88,0x86,0x84,0x8A,0x97,0x9C,0xDC,0x14,0x17,0x1E,0xC0,0x25,0xC2,0x3D,0x9C,0x88,0x3D,0xC1,0x26,0x07,0x36,0x3D,
+0xC1,0xA7,0x85,0x20,0x05,0xC8,0x0A,0x05,0xCE,0xA5,0x87,0x0F,0x31,0xC1,0x9E,0x75,0x81,0x86,0x9C,0x02,0xC1,0xFE,0xD6,0xD7,0x31,0x33,0x83,0x87,0xFE,0xF7,0xFB,0x69,
+0xC1,0x0E,0x96,0x76,0xA4,0x9B,0x8E,0x8A,0x31,0x9B,0x87,0x86,0x21,0x98,0x78,0xA2,0x65,0xFE,0x9C,0xF1,0xB8,0x76,0x31,0x0D,0x94,0x77,0xFE,0x3A,0x24,0x90,0x9C,0xDE,
+0xA9,0x85,0xB4,0x73,0x29,0x25,0xC0,0x02,0x15,0xC0,0xA4,0x88,0xC7,0xAB,0x72,0x94,0x9C,0x95,0x9B,0xD9,0xA5,0x88,0x21,0x31,0xC2,0x9E,0x75,0x91,0xA9,0x11,0xAB,0x98,
+0x1B,0x31,0xC0,0x16,0xFE,0xF7,0xFA,0x12,0x0B,0xC1,0x96,0x86,0xA4,0x9B,0x33,0x31,0x0D,0x2A,0x37,0x3D,0x0D,0x31,0xC1,0x0C,0x82,0x76,0x88,0x9D,0xDE,0x2B,0x0F,0xA3,
+0x97,0x18,0x25,0x26,0x55,0x15,0xA4,0x88,0xC6,0xA3,0x87,0xA9,0x85,0x8C,0x9B,0x05,0xCC,0x0A,0x05,0xC7,0x14,0x05,0xC0,0x2B,0xFE,0x94,0xCD,0x1B,0x31,0xC8,0x8E,0x84,
+0x2A,0x12,0xC1,0x0E,0x96,0x76,0x0E,0x11,0xAF,0x9A,0x31,0xC6,0x88,0x86,0x99,0x84,0x1F,0x05,0xDE,0x36,0x35,0x22,0x3D,0x15,0xC1,0x3D,0xC6,0xA4,0x95,0xA6,0x63,0x05,
+0xDA,0x2B,0x0C,0xBA,0x8D,0x31,0xC8,0x37,0xAD,0x74,0xA4,0x9B,0x0E,0x0B,0xC0,0x34,0xA5,0x99,0x2A,0x8C,0x9A,0x12,0x31,0xC4,0x37,0xA8,0x77,0x96,0x84,0xFE,0x21,0x41,
+0x97,0x9C,0xDF,0xB8,0x73,0x22,0x9C,0x88,0x99,0x9D,0xC1,0xA4,0x88,0xC6,0xA9,0x84,0x20,0x05,0xDA,0xA5,0x87,0x0C,0x33,0x2D,0x31,0xC5,0x9B,0x87,0x37,0x11,0x0B,0x0E,
+0x12,0xC0,0x0E,0x9A,0x89,0x34,0x0B,0x98,0x9A,0x90,0x89,0xB3,0x89,0x31,0xC2,0x2D,0x11,0x12,0x92,0x85,0x3A,0x05,0xDF,0x3A,0xAC,0x84,0x8C,0x8D,0x15,0x3F,0x15,0x3D,
+0xC6,0x0F,0x1F,0x05,0xDA,0x32,0xBB,0x84,0xBC,0x98,0x95,0x79,0x95,0xAB,0x2D,0xA6,0x99,0x1B,0xC0,0x33,0x11,0xC0,0xAB,0x98,0x1B,0xA1,0x85,0xC2,0x0E,0x0B,0x92,0x86,
+0x0E,0x0B,0x9D,0x98,0x8B,0x9C,0x21,0x3D,0x2D,0x11,0xC0,0x12,0x0B,0x34,0x36,0x8E,0x8B,0x0A,0x05,0xDC,0x14,0x17,0x1E,0x96,0x86,0x15,0x3F,0x15,0xA4,0x88,0xC6,0x22,
+0x05,0xDB,0xA6,0x87,0x1F,0xBC,0x98,0x0E,0x43,0x2D,0x9E,0x86,0x21,0xC0,0x0B,0x2A,0x12,0xC0,0x69,0xC2,0x0E,0x0B,0xC0,0x93,0x89,0xAD,0x98,0x0E,0xC0,0x3A,0x0B,0x97,
+0x9A,0x2D,0x2A,0x12,0xC0,0x0B,0x2B,0x3C,0x83,0xAE,0xE0,0x39,0x26,0x15,0xC1,0xA4,0xB8,0x02,0xC0,0x66,0x02,0xC0,0x3D,0x36,0x99,0x9A,0x05,0xDB,0xA5,0x87,0xBA,0x83,
+0x04,0x0E,0x0B,0xC0,0x12,0xC0,0x0E,0x0B,0x0E,0x0B,0xC1,0x3A,0x0B,0x0E,0x3A,0x0B,0x0E,0x9C,0x76,0x34,0x0E,0xC0,0x0B,0xC0,0x0E,0xC1,0x0B,0xC1,0x3A,0x89,0x88,0xFE,
+0x10,0xA0,0x05,0xDF,0xAF,0x84,0x16,0x3F,0xA1,0x9A,0x3F,0xA5,0xDA,0x06,0x09,0x06,0xC1,0x3D,0xAC,0x73,0x1F,0x05,0xDB,0x32,0xBB,0x84,0x04,0x0E,0x0B,0xC0,0x12,0x0E,
+0x51,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x3A,0x0B,0x0E,0x0B,0xC0,0x31,0x0E,0x0B,0xC0,0x0E,0x3A,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x8A,0x86,0x81,0x9C,0x97,0x9C,0xDF,
+0x32,0x24,0x90,0x8A,0x15,0x3F,0x09,0x06,0x09,0xC0,0x06,0xC0,0xA4,0x76,0x0F,0x05,0xDD,0x1F,0x3A,0x0E,0x0B,0x0E,0x0B,0xC2,0x0E,0x0B,0xC2,0x3A,0x0B,0x0E,0x0B,0xC0,
+0x9D,0x98,0x99,0x87,0x0E,0x0B,0x0E,0x0B,0xC3,0x0E,0x0B,0xC0,0x1F,0x8F,0x99,0x05,0xE0,0x0F,0x99,0xA8,0x3F,0x15,0x09,0xC1,0x06,0x09,0xC0,0xAB,0x54,0x3A,0x05,0xDC,
+0xA5,0x87,0x1F,0xBC,0x98,0x0E,0x0B,0xC1,0x0E,0xC1,0x0B,0xC2,0x3A,0x0B,0x0E,0x0B,0xC0,0x9A,0x99,0x99,0x78,0xAD,0x98,0x0E,0xC0,0x0B,0xC1,0x3A,0x0B,0x0E,0x0B,0xC0,
+0x97,0x9A,0x29,0x22,0x05,0xE0,0x36,0x39,0x90,0x9B,0x15,0x09,0x06,0x09,0xC2,0x24,0x89,0x9D,0x05,0xDC,0x2B,0xBD,0x95,0x04,0x0E,0x0B,0xC0,0x6B,0x0E,0x0B,0xC2,0x0E,
+0x0B,0xC3,0x3A,0x98,0x76,0x0E,0x0B,0xC1,0x0E,0xC1,0x0B,0xC3,0x33,0x83,0x99,0x22,0x05,0xDC,0x14,0x17,0x05,0xC0,0x22,0x24,0x16,0x15,0x09,0x06,0x09,0xC1,0x1D,0x0F,
+0x05,0xDD,0xA6,0x87,0x21,0x04,0x0E,0x0B,0xC0,0x12,0x0E,0x0B,0xC1,0x0E,0xC1,0x0B,0xC2,0x9A,0x99,0x04,0x0E,0x0B,0xC0,0x12,0x0E,0x0B,0xC3,0x61,0x0B,0x25,0x96,0x87,
+0x13,0x05,0xDC,0x14,0x17,0x05,0xC0,0xB0,0x74,0xAB,0x97,0x94,0x8C,0x25,0x09,0xC1,0x5A,0x1D,0x0D,0x98,0x78,0x05,0xDC,0x14,0xA5,0x87,0x21,0x04,0x0E,0x51,0x0B,0x0E,
+0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC1,0x3A,0x0B,0x0E,0x0B,0xC2,0x0E,0xC1,0x0B,0xC4,0x93,0x89,0x17,0xA2,0x88,0x13,0x05,0xDD,0x14,0x17,0x05,0xB0,0x74,0xAB,0x97,0x13,
+0x25,0x99,0xC9,0xA3,0x88,0xC2,0x24,0x1F,0x05,0xDC,0x14,0xA5,0x87,0x21,0x04,0x0E,0x5A,0xC1,0x0E,0xC1,0x51,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC2,0x3A,0x0B,
+0x0E,0x0B,0xC4,0xFE,0x73,0xAD,0x14,0x17,0x22,0x05,0xE0,0xB0,0x74,0xAE,0x84,0x13,0x25,0x2D,0x69,0x2D,0xC0,0xAC,0x43,0xA3,0x88,0x05,0xDE,0x3F,0x21,0x04,0x0E,0x3A,
+0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC2,0x0E,0xC0,0x3D,0x9C,0x77,0x2A,0x12,0xC0,0x0E,0x5A,0x0E,0x0B,0xC2,0x3D,0xFE,0x18,0xE2,0x05,0xC0,0x13,0x90,0x8B,0x05,
+0xDF,0x06,0x2B,0x94,0x8C,0x25,0x2D,0xC2,0x0D,0x98,0x78,0x05,0xDD,0x14,0xA5,0x87,0x21,0x0B,0xC0,0x0E,0x0B,0xC1,0x0E,0xC0,0x0B,0x0E,0xC0,0x51,0x0B,0x0E,0x3D,0x87,
+0x89,0x32,0x14,0x0F,0x3D,0x0B,0xC3,0x0E,0x0B,0xC0,0x30,0x14,0x55,0xC0,0x13,0x08,0x05,0xDC,0x14,0x17,0x05,0x06,0xA8,0x87,0x91,0x9A,0xA1,0x8B,0x2D,0xC2,0x2B,0x31,
+0x17,0x9D,0x9A,0xDD,0xA9,0x97,0xFE,0xAD,0x8E,0x0B,0x0E,0x04,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0xC0,0x3A,0x0B,0x93,0x89,0xFE,0x21,0x65,0x05,0xC2,0xB9,0x76,0xFE,0xEF,
+0xBB,0xA2,0x86,0xC1,0x0E,0xC1,0x97,0x8A,0xFE,0x18,0xE2,0x9A,0x89,0xC1,0xB3,0x85,0x91,0x9A,0x05,0xDF,0x0F,0x22,0x9E,0x6B,0xC0,0x2D,0x69,0x2D,0x13,0x39,0x05,0xC6,
+0x6E,0x05,0xC7,0x14,0x05,0xCC,0x20,0xFE,0xBD,0xD1,0x04,0x0E,0x0B,0xC1,0x0E,0xC0,0x0B,0xC3,0x93,0x89,0x3F,0x05,0xC4,0xFE,0xC6,0x97,0xAB,0xA7,0x59,0xC1,0x61,0x0B,
+0xFE,0x6B,0xAB,0x84,0x9B,0xC2,0xB3,0x84,0x31,0x05,0xDC,0x14,0x17,0xA3,0x99,0x24,0x29,0x1D,0xC0,0x26,0x6B,0xC0,0x36,0x3C,0x05,0xC6,0x0A,0x05,0xC7,0x14,0x05,0xCC,
+0x20,0xFE,0xBE,0x31,0x0E,0x51,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC0,0x3D,0xFE,0x3A,0x06,0x05,0xC5,0x30,0x12,0x0B,0x0E,0x3A,0x0B,0x93,0x89,0xFE,0x10,0xC1,
+0x05,0xC2,0x22,0x94,0x89,0x05,0xDD,0x14,0x3C,0x27,0x06,0x1D,0xC0,0x2D,0x26,0xC0,0x36,0x17,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x05,0xC3,0x3C,0xB2,0x76,0x19,0x0E,0x5A,
+0xC3,0x3A,0x0B,0x0E,0x0B,0xFE,0x4B,0x0A,0x05,0xC1,0x25,0x30,0x11,0x33,0x02,0xC0,0x2A,0x12,0xC0,0x0B,0x9D,0x98,0x29,0x05,0xC3,0x29,0x91,0x9A,0x05,0xDE,0x39,0xC0,
+0x18,0x1D,0xC0,0x2D,0x26,0x13,0x39,0x05,0xE0,0xAF,0x84,0x06,0x30,0x12,0x0B,0x0E,0x0B,0xC1,0x61,0x0B,0x0E,0x30,0x14,0x05,0x00,0xB8,0xA5,0x2A,0x12,0xC0,0x0B,0x98,
+0x9A,0x29,0xFE,0xE7,0x38,0x0B,0xC1,0x33,0x0A,0x05,0xC3,0x13,0x1F,0x05,0xDD,0xA9,0x85,0xB2,0x86,0x9C,0x76,0x1D,0xC1,0x26,0xC0,0x36,0x9A,0x88,0x91,0x9D,0xE0,0x06,
+0xA4,0x56,0x8E,0xBD,0x11,0x12,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0x93,0x89,0xFE,0x08,0x80,0xA9,0x99,0x11,0x2A,0x12,0xC0,0x69,0xC1,0x0E,0x0C,0xA6,0x86,0x0B,0x0E,0x93,
+0x79,0x3F,0x05,0xC4,0x29,0x1F,0x05,0xDC,0x14,0xB4,0x73,0x24,0x94,0x8D,0x1D,0xC1,0x26,0xC0,0xAF,0x52,0x31,0x17,0x05,0xDF,0xAF,0x84,0xA5,0x57,0x8E,0xBD,0xA3,0x99,
+0x11,0x12,0x0E,0x5A,0xC0,0x0E,0xC0,0xFE,0x5B,0x4A,0xC0,0x0C,0x12,0x0B,0xC0,0x0E,0x51,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x3D,0xFE,0x3A,0x06,0x05,0xC5,0xB3,0x85,0x05,
+0xDD,0xA9,0x85,0x27,0x3C,0x9C,0x7A,0xC1,0x6B,0x2D,0x13,0x39,0x89,0xAF,0xDD,0x14,0xA2,0x76,0x05,0xC0,0x29,0xA5,0x35,0x8A,0xDE,0x05,0xA6,0x87,0x21,0xB2,0x76,0x0B,
+0xC1,0x37,0x8F,0x8A,0x0B,0xC2,0x9D,0x98,0xC0,0x96,0x79,0x11,0x12,0x0E,0x5A,0xC0,0x19,0xFE,0x4B,0x0A,0x05,0xC6,0x13,0x05,0xDD,0xB8,0x73,0x22,0x1D,0x9B,0xBA,0xC1,
+0x69,0x2D,0xAC,0x43,0x9C,0x97,0x05,0xE1,0x29,0xA1,0x56,0x8E,0xBD,0x05,0xC0,0xA5,0x88,0x11,0x0B,0x0E,0x12,0x34,0x2B,0x0B,0xC1,0x34,0x11,0x37,0xA8,0x77,0xA7,0x97,
+0x0B,0x0E,0xC0,0x2B,0xFE,0x5B,0x4A,0x05,0xC6,0x14,0x13,0x05,0xDC,0x13,0x38,0x06,0x1D,0x9B,0xBA,0xC2,0x2D,0xB2,0x42,0x8E,0x8A,0x97,0x9C,0xE1,0xB3,0x85,0x9C,0x56,
+0x28,0x05,0xC2,0x30,0x0C,0x0B,0xC2,0x0E,0x0B,0xC5,0x0E,0x9A,0x89,0x84,0x79,0x84,0x9B,0xC8,0x22,0x05,0xDB,0xA5,0x87,0x27,0x99,0x99,0x3D,0xC4,0xA4,0xA6,0xA8,0x63,
+0x08,0x05,0xE0,0x14,0x36,0x9A,0x37,0x9C,0x99,0x05,0xC3,0x00,0xFE,0xD6,0xD7,0x0B,0xC2,0x0E,0x0B,0xC4,0x3D,0x00,0x05,0xC6,0x14,0x05,0x2B,0x29,0x05,0xDB,0x22,0xA8,
+0x86,0x3C,0x9E,0x8B,0xC0,0x02,0x3D,0xC1,0x36,0x0A,0x05,0xCA,0x6E,0x05,0xC7,0x14,0x05,0xCA,0x14,0xB7,0x73,0x92,0x7B,0xA5,0x55,0x05,0xC4,0xA9,0x97,0x21,0xB2,0x76,
+0x0B,0xC3,0x3A,0x0B,0x0E,0x37,0x3C,0x05,0xC9,0x2B,0xAB,0x86,0x05,0xDA,0x3F,0x1E,0x96,0x8B,0x3C,0x3D,0xC0,0x02,0x3D,0xC1,0x9D,0xC8,0xC0,0x2D,0xC0,0x26,0xB2,0x43,
+0x90,0x89,0x05,0xCF,0x0A,0x05,0xC7,0x14,0x05,0xC5,0xA5,0x87,0x22,0x95,0x6A,0x24,0x05,0xC6,0xBC,0x75,0xB7,0x89,0xAB,0x97,0x0B,0xC2,0x9D,0x98,0x30,0x32,0x14,0x55,
+0xC9,0x20,0x3C,0x05,0xDA,0xB8,0x73,0x22,0x3D,0xC0,0x26,0xC2,0x13,0xAB,0x75,0x89,0x9D,0x05,0xDD,0x14,0xA2,0x76,0x05,0xC0,0xA9,0x85,0x22,0x8D,0x9D,0xAF,0x54,0x93,
+0xBC,0x05,0xC6,0xA8,0x88,0x30,0x0C,0x0B,0x2B,0x21,0x25,0x05,0xC6,0x14,0x05,0xC3,0x20,0x50,0x97,0x9C,0xC6,0x14,0x05,0xD0,0xAF,0x84,0xA9,0x88,0x18,0x3D,0xC0,0x9D,
+0xC9,0x26,0xC1,0x13,0xA6,0x63,0x05,0xDD,0x14,0x17,0x05,0xC1,0xAC,0x87,0x06,0x05,0x31,0x28,0x05,0xC7,0xAB,0x55,0x77,0x00,0x25,0x05,0xCE,0xA7,0x85,0x17,0x05,0xD8,
+0xA6,0x87,0x1E,0x96,0x8B,0x3D,0xC1,0x2D,0x69,0xC1,0xAF,0x52,0x2C,0x05,0xDC,0x14,0x17,0x05,0xC2,0x06,0x20,0x05,0xAF,0x54,0xFE,0x44,0xC5,0x9D,0x97,0x97,0x9C,0x9B,
+0x9A,0x9B,0xBB,0xC0,0xA4,0x9A,0xA4,0x65,0xA2,0x75,0xA5,0x87,0xAA,0x76,0x2C,0xFE,0x00,0x60,0x05,0xE4,0x14,0x17,0x05,0xC3,0x22,0x6D,0x3D,0xC2,0x26,0xC2,0x24,0x1F,
+0x05,0xDE,0x14,0x17,0x05,0xC0,0xB0,0x95,0x95,0x7A,0x05,0x31,0xFE,0x6E,0x27,0xA3,0x86,0xC0,0x9D,0x9A,0xC4,0x18,0xC0,0x8A,0x9E,0xFE,0x00,0xA0,0x05,0xDC,0x14,0x17,
+0x05,0xCA,0xA9,0x85,0xB2,0x86,0x3C,0x3D,0xC1,0x41,0x9F,0xD8,0xC1,0x1D,0xA7,0x76,0x89,0x8D,0xE3,0xB7,0x72,0x05,0xC0,0x31,0xFE,0x6E,0x27,0x18,0xC8,0x0E,0xFE,0x01,
+0x60,0x05,0xD3,0x0A,0x05,0xC0,0x14,0x05,0xCA,0x0A,0x05,0xC3,0x14,0x13,0xC0,0x3D,0xC0,0x36,0x3D,0xC0,0x26,0x2D,0x26,0xAC,0x44,0x20,0x05,0xDD,0x14,0x17,0x05,0xC1,
+0x3F,0x39,0x05,0xC0,0xAF,0x33,0x0D,0x18,0xC8,0x06,0x15,0x0F,0x05,0xDF,0x14,0x17,0x05,0xC5,0xAC,0x87,0xAB,0x75,0x36,0x3D,0x36,0xA3,0x88,0x36,0x3D,0x26,0xC0,0x2D,
+0xB2,0x41,0x90,0x8A,0x05,0xDC,0x14,0x17,0x05,0xC2,0x3C,0xA2,0x77,0x05,0xC0,0xAF,0x44,0x0D,0x18,0xC0,0x6F,0x18,0xC1,0x0E,0x9A,0x88,0xA8,0x75,0xA9,0x88,0x18,0x0E,
+0xFE,0x02,0x00,0x05,0xE7,0xA5,0x87,0xB3,0x85,0x06,0x3D,0xC0,0xA2,0x77,0x36,0xA5,0x68,0x3D,0x2D,0x26,0x13,0xAB,0x75,0x89,0x9D,0x05,0xE2,0x22,0x98,0x8A,0x05,0xC0,
+0xAF,0x55,0x0D,0x18,0xC0,0x6F,0x18,0xC1,0xFE,0x4C,0x07,0x9D,0xEE,0x46,0xFE,0x65,0xA7,0x18,0xC0,0x29,0xFE,0x00,0x60,0x62,0x6E,0x05,0xDC,0x14,0x17,0x05,0xC4,0x22,
+0xA8,0x86,0x3D,0xC1,0xA3,0x87,0x9D,0x99,0x3D,0xC0,0x13,0x7B,0xA5,0x66,0x39,0x05,0xE3,0xB7,0x74,0x90,0x99,0x14,0x05,0xB4,0x42,0x0D,0x18,0xC0,0x6F,0x18,0xC1,0xFE,
+0x5B,0xA9,0xA0,0xBC,0xC0,0xFE,0x5C,0xE8,0x18,0xC0,0x0E,0x10,0x05,0xDD,0x14,0xA2,0x76,0x05,0xC4,0xA6,0x87,0xB5,0x83,0x3C,0x3D,0x69,0x0F,0x36,0x3D,0xC1,0x13,0x1D,
+0xA8,0x55,0x9C,0x87,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xC8,0x2B,0xA6,0x56,0xA4,0x54,0x0C,0xA0,0xA9,0x9C,0x67,0x9B,0xCC,0x38,0x0C,0x0E,0xAB,0x75,0x18,0xC3,0x2C,
+0x9D,0xEE,0x16,0x2C,0x1F,0x18,0xC0,0x29,0xFE,0x00,0xA0,0x9C,0xAA,0xC1,0x2B,0x28,0xC0,0x05,0xC0,0xA2,0x77,0x05,0xDB,0x22,0xA3,0x85,0x3D,0xA3,0x66,0x36,0x3D,0xC1,
+0x41,0xA4,0x87,0x9E,0xC9,0xA4,0x65,0xAB,0x75,0x94,0x88,0x05,0xDD,0xA8,0x55,0x0C,0xAB,0x64,0x0E,0xA2,0x75,0x3B,0xFE,0x09,0x81,0x05,0x0F,0x05,0xC0,0x2E,0x0A,0x1F,
+0x18,0xC2,0x12,0x16,0xC0,0xA3,0x21,0x1F,0x18,0x9D,0x9A,0x9C,0x89,0xFE,0x02,0x00,0x05,0xAF,0x54,0xAA,0x21,0x29,0x3B,0x29,0x92,0xCE,0xC3,0x28,0x05,0xC0,0x0F,0x05,
+0xD4,0x3A,0x1E,0x3C,0x3D,0x36,0xA3,0x88,0x36,0xC0,0x3D,0xC1,0xA4,0x95,0x1D,0x13,0xC2,0x27,0x87,0xAF,0x05,0xDB,0xAB,0x44,0xAC,0x54,0x0E,0xAB,0x75,0x18,0x9D,0x9A,
+0x18,0xC0,0x0A,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xC1,0x0C,0x0E,0x18,0xC2,0x99,0x9C,0xFE,0x4C,0x07,0x01,0x1C,0x1F,0x18,0xC1,0x3B,0x0E,0xA4,0x88,0x18,0x67,0x18,0x06,
+0xFE,0x22,0xC2,0xFE,0x00,0x40,0x05,0x0F,0x37,0x0C,0x37,0x05,0xD6,0x22,0x9D,0xAA,0x3D,0xC2,0x26,0x07,0x61,0x3D,0x13,0xC3,0x39,0xA4,0x96,0xFE,0x08,0x20,0x05,0xDA,
+0x2E,0xFE,0x44,0xC5,0x06,0xC0,0x18,0xC3,0x06,0x9A,0x88,0xFE,0x0A,0x00,0x05,0xC2,0x0C,0x0E,0x1F,0x18,0xC2,0x99,0x9C,0x1A,0x18,0xC2,0x0A,0x39,0x06,0x18,0xC2,0x0E,
+0xFE,0x01,0x60,0x05,0xC1,0x2B,0x31,0x28,0x05,0xD4,0x3A,0xB1,0x75,0x36,0x3D,0x36,0xA3,0x88,0x3D,0xC0,0x26,0xA4,0x87,0x36,0x1D,0x59,0xC2,0xA7,0x65,0x16,0x05,0xDA,
+0xB5,0x20,0x0A,0x1F,0x18,0xC4,0x06,0x18,0xC0,0x0E,0x10,0x05,0xC2,0xFE,0x23,0x41,0x0A,0x1F,0x18,0xC7,0x0D,0x15,0x2C,0x1A,0x18,0xC1,0x06,0x19,0xFE,0x00,0x40,0x05,
+0xC1,0x32,0xA5,0x77,0x9A,0x88,0x05,0xD3,0xAB,0x86,0x22,0x3D,0x36,0x3D,0x9D,0x97,0x7B,0xA0,0xA8,0xA0,0xC7,0x9D,0xB7,0x7E,0x13,0xC3,0x24,0x99,0x89,0x05,0xD9,0xAB,
+0x55,0x25,0x18,0xC3,0x06,0x18,0xC4,0x92,0x9E,0x28,0x05,0x6E,0xC0,0xFE,0x3B,0xE5,0x0E,0x44,0x1A,0x18,0xC1,0x1A,0x18,0xC3,0xFE,0x0A,0xA0,0x3B,0x1A,0x18,0xC2,0x97,
+0x9A,0x28,0x05,0xC0,0xA2,0x77,0x05,0xA7,0x78,0x10,0x0F,0x05,0xD2,0xB7,0x74,0x92,0xFA,0x2B,0x70,0xA3,0xA8,0xA0,0xB7,0xC1,0xA1,0xB8,0x56,0x51,0x1D,0x9C,0x9A,0x1D,
+0xC0,0x59,0x27,0x8E,0x9C,0x95,0x9D,0xD9,0x38,0x0D,0x18,0xCA,0x9D,0x9A,0x89,0xBF,0x0F,0x05,0xC0,0x31,0x0D,0x9C,0x89,0x9B,0x88,0x1A,0x18,0xC6,0xFE,0x0A,0x00,0x28,
+0xBF,0x30,0x1F,0x18,0xC1,0x06,0xFE,0x0A,0xA0,0x0F,0x05,0xC2,0x3F,0xA3,0x45,0x05,0xD2,0xBA,0x92,0xFE,0x89,0x40,0xA1,0xB8,0x9D,0xAA,0x29,0xC1,0x7E,0x29,0xC1,0xFE,
+0x59,0xE7,0xA2,0x55,0xC1,0xA3,0x77,0xA8,0x86,0x89,0x9D,0x05,0xD9,0x02,0xFE,0x76,0x09,0x18,0xC2,0x1A,0x18,0xC4,0x1A,0x18,0x99,0x9C,0xFE,0x0A,0x00,0x05,0xC0,0xA8,
+0x55,0xFE,0x6D,0x69,0x18,0xC0,0x39,0xA7,0x85,0x18,0xC4,0x06,0xFE,0x23,0x03,0x14,0x0C,0xFE,0x65,0xA7,0x18,0x1A,0x18,0xC0,0x8F,0xAD,0x0F,0x05,0xC2,0xA5,0x87,0x2E,
+0x95,0xBB,0x05,0xD0,0x3F,0xB2,0x85,0x33,0x9D,0xAA,0x29,0x24,0x29,0xC0,0x24,0x29,0xC0,0x24,0xFE,0x52,0x26,0x59,0xC1,0xA5,0x77,0xA2,0x76,0x05,0xDA,0x38,0x0D,0x18,
+0xC1,0x1A,0x18,0xC4,0x1A,0x18,0xC1,0x12,0x0F,0x05,0xC0,0x12,0x18,0xC1,0x25,0x35,0x1A,0x18,0xC2,0x06,0xFE,0x0A,0x00,0x0F,0xC0,0xB5,0x21,0xB5,0x62,0x18,0x1A,0x18,
+0x25,0xFE,0x01,0x60,0x05,0xC3,0x10,0x2E,0x95,0xBB,0x05,0xCF,0xA9,0x97,0xB0,0x92,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x29,0xC0,0x31,0x6F,0x29,0xC1,0xFE,0x49,0xA6,0xA4,
+0x65,0xC1,0x1E,0x20,0x8C,0x9E,0xD1,0x6E,0x05,0xC6,0xAF,0x33,0x0D,0x18,0xCA,0x9D,0x9A,0x18,0x0D,0x0C,0x0A,0x05,0xFE,0x43,0xE6,0xFE,0x76,0x87,0x18,0xC1,0x06,0x35,
+0x2C,0x1A,0x18,0xC0,0x0D,0xFE,0x0A,0x00,0x93,0xEF,0xC0,0x2B,0xB3,0x22,0x0D,0x18,0xC0,0x6F,0xFE,0x1A,0xC1,0x0A,0x05,0xC3,0xAF,0x54,0x98,0x89,0x05,0xCF,0x3F,0xB2,
+0xA2,0x37,0xC0,0x3D,0x9D,0x99,0xA4,0x87,0x29,0xC0,0x05,0xC1,0xFE,0x4A,0x25,0xC0,0x7B,0x13,0x27,0x8E,0x9C,0x95,0x9D,0xDA,0x10,0x25,0x18,0xCB,0x06,0x18,0x92,0x9E,
+0x28,0x05,0xB8,0x21,0x1A,0x18,0xC3,0x97,0x9A,0x0E,0x1F,0x18,0x2C,0xFE,0x09,0x81,0x05,0xA2,0x77,0x05,0x2B,0xB9,0x21,0x1F,0x18,0xC0,0x8F,0xAD,0x0F,0x05,0xC3,0xA8,
+0x55,0xA7,0x66,0x05,0xC9,0x6E,0x05,0xC4,0xB7,0x94,0xFE,0x89,0x40,0x33,0xA2,0x98,0x66,0xC0,0x29,0xC0,0x05,0x29,0xC0,0xFE,0x52,0x26,0xC0,0x13,0xC0,0x27,0x87,0xAF,
+0x9C,0x8A,0xDA,0x10,0xBB,0x30,0xAD,0x62,0x18,0xC3,0x9D,0x9A,0x18,0xC4,0x06,0x18,0xC0,0xFE,0x0A,0x00,0x0F,0xB2,0x53,0xFE,0x6E,0x27,0x18,0xC0,0x1A,0x18,0xC2,0x35,
+0xA3,0x97,0x35,0x28,0x05,0xC0,0x0F,0x05,0x03,0xFE,0x3B,0xE5,0x1A,0x18,0x0A,0x28,0x05,0xC0,0x0F,0x05,0xC1,0x2E,0x19,0x05,0xC0,0x6E,0x05,0xC0,0x14,0x05,0xC9,0xB5,
+0x84,0x9F,0xF7,0x3D,0x29,0x7E,0xA2,0x88,0x29,0x05,0x3D,0x29,0x3D,0xFE,0x4A,0x25,0x1D,0xC0,0x22,0xC0,0xA8,0x86,0x89,0x9D,0x9C,0x8A,0xDB,0xFE,0x3C,0x62,0x18,0x6B,
+0x18,0xC0,0x1A,0x18,0xC7,0x1A,0x18,0x12,0x0F,0x0C,0xFE,0x65,0xA7,0x18,0xC1,0x1A,0x18,0xC2,0x2C,0x96,0x88,0xFE,0x12,0x02,0x05,0xC3,0x2B,0xB9,0x21,0x1F,0x2C,0xFE,
+0x09,0x81,0x05,0xC4,0xA7,0x85,0x2E,0x19,0x05,0xCE,0x31,0xB2,0xA4,0xFE,0x99,0x61,0x29,0xC0,0x7E,0x3D,0x7E,0x6E,0x05,0xC0,0x3D,0x0A,0x29,0xC3,0x3D,0x29,0x13,0xC0,
+0xA3,0x78,0x13,0xA8,0x66,0xA3,0x97,0x85,0x9F,0xCF,0x6E,0x05,0xC7,0x14,0x05,0xC0,0xB8,0x10,0x1A,0x18,0xCC,0x9D,0x9A,0x2C,0xFE,0x02,0x00,0x2A,0xFE,0x76,0x09,0x18,
+0xC1,0x1A,0x18,0xC3,0x1A,0x2C,0x91,0x9B,0xFE,0x01,0x60,0x05,0xC2,0x2B,0x1D,0x2C,0x10,0x05,0xC5,0x2E,0x95,0xBB,0x05,0xCF,0x22,0x35,0xFE,0xA1,0x00,0xA4,0x87,0x9D,
+0x89,0x05,0xC2,0x6E,0xC1,0x29,0x31,0x05,0x29,0x05,0x31,0x05,0x13,0xC0,0x22,0x13,0x0F,0x9E,0x85,0xFE,0x00,0x20,0xDC,0x2E,0x0D,0x18,0xC3,0x06,0x18,0xC5,0x06,0x18,
+0xC0,0xFE,0x1B,0x41,0x96,0xBC,0xFE,0x76,0x09,0x18,0xC4,0x06,0x18,0xC3,0x39,0x8F,0xAC,0xFE,0x00,0x60,0x05,0xC1,0xA8,0x55,0xFE,0x23,0xC1,0x13,0x92,0xEF,0x05,0xC4,
+0x2B,0xAA,0x55,0x0A,0x05,0xCE,0x3A,0x1E,0x9C,0xF7,0x3D,0x51,0x7E,0x29,0xA3,0x98,0x29,0x05,0xC1,0x29,0xC0,0x05,0x29,0x3D,0x29,0x05,0xFE,0x4A,0x25,0xC0,0x7B,0x13,
+0xAB,0x75,0x95,0x8B,0x90,0x9C,0xDC,0xAB,0x44,0x0E,0x1F,0x18,0xC4,0x9D,0x9A,0x18,0xC6,0x39,0xFE,0x09,0x81,0x36,0x18,0x1A,0x18,0xC4,0x9D,0x9A,0x18,0xC3,0x8F,0xAD,
+0x10,0x05,0xC1,0x37,0x0C,0x91,0xCC,0x05,0xC5,0xAF,0x33,0x19,0x05,0xC9,0x0A,0x05,0xC3,0x16,0xB1,0x94,0xFE,0x8A,0x21,0x9A,0xDB,0x29,0x33,0x9D,0xAA,0x29,0xC4,0x24,
+0x29,0xC0,0xA3,0x98,0xC0,0x1D,0x13,0xC1,0x27,0x8C,0x9D,0x97,0x9C,0xDD,0xFE,0x3B,0xE5,0x1A,0x18,0xC3,0x06,0x18,0xC7,0x99,0x9B,0x2C,0x36,0x18,0x1A,0x18,0xC5,0x06,
+0x18,0xC3,0x25,0x15,0xFE,0x01,0x00,0x05,0xC0,0xA8,0x55,0x0C,0x19,0x05,0xC4,0x03,0x2E,0x19,0x05,0xCF,0xB3,0x84,0xA6,0xC6,0xFE,0x99,0x61,0xC0,0xA1,0xB8,0x29,0x05,
+0x3D,0xA2,0x87,0x29,0xC4,0x05,0xC0,0xFE,0x4A,0x25,0xC1,0x1D,0xAB,0x64,0x89,0x9D,0x9C,0x8A,0xDD,0x0C,0xFE,0x76,0x09,0x18,0xC5,0x06,0x18,0xC5,0x0D,0x15,0x0D,0x18,
+0xC0,0x6F,0x18,0xC5,0x06,0x18,0xC4,0x3B,0x28,0x05,0xC0,0xA8,0x55,0x2E,0x95,0xBB,0x05,0xC4,0x2E,0x37,0x05,0xCF,0x2B,0x1E,0x04,0xFE,0xB1,0x81,0xC0,0x31,0x05,0xC1,
+0x29,0x66,0x29,0xC2,0x05,0xC0,0x1D,0xC1,0xA5,0x66,0xA6,0x86,0x88,0x8D,0x9D,0x9A,0xDD,0xAB,0x55,0x0E,0xAB,0x75,0x18,0xC5,0x06,0x18,0xC5,0x08,0x0D,0x18,0xC0,0x6F,
+0x18,0xC6,0x06,0x18,0xC4,0x3B,0xFE,0x01,0x60,0x05,0xC0,0xAA,0x66,0xA5,0x55,0x93,0xDD,0x05,0xC3,0xA8,0x55,0xA7,0x54,0x0F,0xC0,0x05,0xCE,0x22,0x1C,0xFE,0x99,0x61,
+0xA1,0xB8,0x3D,0xC0,0x05,0x3D,0x29,0xC3,0x31,0x52,0x05,0x1D,0xC0,0x59,0x36,0xA6,0x86,0x17,0x9D,0x9A,0xDC,0x14,0x17,0xBC,0x21,0x1F,0x18,0xC4,0x06,0x18,0xC6,0x94,
+0x8B,0xA5,0x99,0x18,0xC3,0x06,0x18,0xCB,0x12,0x28,0x05,0xC0,0x15,0xA5,0x55,0x0F,0x05,0xC3,0x0C,0x28,0x05,0xC0,0x0F,0x05,0x03,0x10,0x59,0x05,0x0F,0x05,0xC6,0x2B,
+0xB5,0xA4,0xFE,0x8A,0x21,0x31,0xC0,0x3D,0x29,0xA3,0x98,0x29,0x3D,0x29,0x05,0xC0,0x29,0xC0,0x05,0x13,0xC1,0x36,0xA2,0x76,0x89,0xAF,0xDE,0x14,0x0C,0xFE,0x76,0x09,
+0x18,0xC3,0x9D,0x9A,0x18,0xC7,0x2C,0x25,0x18,0xC5,0x06,0x18,0xCA,0x3B,0x28,0x05,0xC0,0x24,0x9C,0x99,0x05,0xA2,0x77,0x05,0xC1,0x10,0xA4,0x54,0x0F,0xA6,0x66,0x15,
+0xC1,0x10,0x2E,0x7A,0x28,0x05,0xC7,0x07,0xFE,0x82,0xA4,0x3D,0x29,0xA3,0x98,0xC0,0x29,0x66,0x29,0xC0,0x05,0x0A,0x05,0x29,0xC0,0xFE,0x4A,0x25,0xC1,0x1E,0x20,0x8C,
+0x9E,0xDE,0x14,0x17,0xFE,0x54,0xE7,0x1F,0x18,0xC4,0x9D,0x9A,0x18,0xC6,0x94,0x8B,0x1A,0x18,0xC5,0x06,0x18,0xC9,0x0D,0x89,0xBE,0x0F,0x05,0x2B,0x31,0x28,0x05,0xC2,
+0x2B,0xB0,0x21,0x2E,0x10,0x0F,0x05,0xC2,0x2B,0x2E,0x37,0x05,0xC6,0xB3,0x84,0xA1,0xF7,0x3D,0x29,0xA3,0x98,0x51,0x05,0xC0,0x29,0xC0,0x05,0xC0,0x29,0x3D,0x05,0x1D,
+0x13,0xC0,0xAB,0x76,0x96,0x98,0x8F,0x8E,0xDD,0x14,0x17,0x05,0xFE,0x43,0xE6,0x1F,0x18,0xC4,0x06,0x18,0xC6,0x94,0x8B,0x1F,0x18,0xC6,0x06,0x18,0xC9,0x97,0x9A,0xFE,
+0x09,0x81,0x05,0x0F,0x37,0xA7,0x66,0x05,0xC1,0xA5,0x88,0xA5,0x77,0x06,0x05,0x0F,0x37,0xC1,0x15,0x24,0x37,0xC0,0x10,0x2E,0x0F,0x05,0xC4,0xB3,0x82,0x1C,0xFE,0x99,
+0x61,0xA1,0xB8,0xC0,0x6E,0x05,0xC0,0x29,0xC0,0x3D,0x29,0xC1,0x05,0xFE,0x52,0x26,0xC0,0x9C,0x9A,0xB2,0x40,0x8D,0x9C,0x95,0x9D,0xDE,0x7F,0x17,0x38,0x0D,0x18,0xC4,
+0x9D,0x9A,0x18,0xC6,0x35,0x1F,0x18,0xC3,0x06,0x18,0xCD,0xFE,0x23,0x03,0xFE,0x00,0x40,0x05,0xC0,0x0C,0x28,0x0A,0x10,0x15,0x9A,0x88,0x03,0xA2,0x95,0x15,0xC0,0x10,
+0x24,0x9C,0x99,0x9D,0xAA,0x24,0xC1,0x06,0x95,0xDD,0xC5,0x20,0xA5,0xB7,0xFE,0x99,0x61,0xA1,0xB8,0xC1,0x6E,0xC1,0x31,0x29,0xC2,0x05,0x13,0x1D,0x13,0x36,0x89,0x9D,
+0x17,0x9D,0x9A,0xDF,0x10,0xFE,0x3C,0x62,0x18,0xC4,0x9D,0x9A,0x18,0xC6,0x25,0x35,0x18,0xC3,0x06,0x18,0xCD,0x08,0xFE,0x00,0x40,0x05,0xC0,0x2E,0x99,0xAA,0xA3,0x77,
+0x10,0x97,0xBB,0x05,0x0A,0x05,0xC3,0x15,0xC0,0x0F,0x05,0xC8,0x07,0xFE,0x82,0xA4,0x3D,0x7E,0x46,0xA2,0x97,0x05,0x0A,0x05,0xC0,0x29,0xC1,0x3D,0x29,0x13,0xC0,0xA5,
+0x77,0xA6,0x86,0x17,0x9D,0x9A,0xDD,0x14,0x17,0x05,0xC0,0x0C,0xFE,0x76,0x09,0x18,0xC4,0x9D,0x9A,0x18,0xC6,0x92,0x9E,0x06,0x18,0xC4,0x06,0x18,0xCA,0x97,0x9A,0x28,
+0x05,0xC0,0x32,0xAA,0x54,0x9C,0x78,0x10,0x0F,0x05,0xC0,0xA5,0x87,0xA3,0x9A,0xA2,0x78,0xC0,0x58,0x9A,0x88,0x17,0x10,0x06,0x0F,0x05,0xC6,0x2B,0xB3,0x85,0x04,0x3D,
+0x33,0xA2,0x98,0x66,0xC0,0x0A,0xC1,0x3D,0x29,0xC0,0x3D,0xC0,0x13,0xC0,0x36,0x24,0x17,0x9D,0x9A,0xDE,0x14,0x17,0x05,0x10,0x0E,0x18,0xC3,0x9D,0x9A,0x18,0xC7,0x8F,
+0x9C,0x0D,0x18,0xC3,0x06,0x18,0xCB,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0xC0,0x2A,0x0C,0x9C,0x88,0x05,0xC6,0xA7,0x85,0x37,0xC0,0x10,0x59,0x28,0x05,0xC0,0x0F,0x05,
+0xC3,0xA9,0x85,0xB1,0xA6,0xFE,0x99,0x61,0xA1,0xB8,0xC1,0x0A,0x05,0xC0,0x0A,0xC1,0x3D,0x29,0xC0,0x05,0x13,0x9C,0xAB,0xAC,0x43,0xA3,0x97,0x85,0x9F,0xDD,0x14,0x17,
+0x05,0xC2,0xB8,0x10,0x0D,0x18,0xC3,0x9D,0x9A,0x18,0xC6,0x12,0x0D,0x18,0xC0,0x6F,0x18,0xC7,0x06,0x18,0xC3,0x25,0xFE,0x01,0x60,0x05,0xC1,0x38,0x48,0x05,0xC4,0x10,
+0x03,0x10,0x9D,0x99,0x05,0xC0,0x2B,0xAA,0x55,0x9B,0x78,0x05,0xC6,0xB0,0x74,0xA9,0xB5,0xFE,0x99,0x61,0xA1,0xB8,0x3D,0x0A,0xC0,0x05,0xC0,0x0A,0xC1,0x3D,0x05,0xC0,
+0x3D,0x13,0x9C,0xAB,0xAC,0x43,0x78,0x88,0x9F,0x5A,0xDC,0x14,0x17,0x05,0xC2,0x24,0xB7,0x52,0x18,0xC3,0x1A,0x18,0xC6,0x0E,0xA2,0x75,0x18,0xC8,0x1A,0x18,0x9D,0x9A,
+0xC1,0x18,0x06,0xC0,0x8D,0x9D,0x19,0xC0,0x05,0x24,0x0C,0x94,0xAA,0x9A,0xBB,0xC0,0x05,0xC3,0x2B,0x10,0x59,0x10,0x24,0x06,0x9D,0xAA,0x10,0x97,0xBB,0x05,0x0A,0x05,
+0xC3,0x1E,0x9C,0xF7,0xFE,0xB1,0x81,0x33,0xA2,0x98,0xC0,0x05,0xC0,0x0A,0xC1,0x3D,0x05,0x0A,0x05,0xC0,0x13,0x1D,0xAB,0x64,0x9C,0x78,0x89,0xAF,0xDF,0x14,0x17,0x05,
+0xC1,0xB8,0x10,0x0D,0x18,0xC4,0x9D,0x9A,0x18,0xC4,0x2C,0x99,0x9B,0x06,0x18,0x2C,0x25,0x50,0x39,0xA2,0x75,0x39,0x9D,0x97,0xC0,0x39,0x12,0x39,0x12,0xC0,0x15,0x9B,
+0x8A,0xC0,0x0C,0x9C,0x88,0x0C,0x24,0x0C,0x2E,0x10,0xC0,0x77,0x10,0x2E,0x9C,0x88,0x10,0x37,0x05,0xC3,0x2E,0x37,0x06,0x0F,0x05,0xC4,0xAB,0x86,0x1E,0xFE,0x99,0x61,
+0xA1,0xB8,0xC0,0x6E,0x05,0xC0,0x0A,0x9C,0x89,0x05,0xC0,0x0A,0xC1,0x05,0x0A,0xBB,0x67,0xC2,0x9D,0x88,0xC0,0x9D,0x99,0x9C,0x88,0x9C,0xA9,0x41,0x18,0xC0,0xA8,0x88,
+0x19,0x00,0x18,0x3D,0x69,0x3D,0x00,0xC0,0xA7,0x88,0xFB,0x96,0x99,0x3C,0x01,0xDF,0x3C,0x5A,0x27,0x3D,0x26,0xC0,0xA4,0x87,0xA3,0x78,0x00,0x19,0x28,0x3C,0xC2,0x01,
+0xD7,0x3C,0xC0,0x01,0x19,0xC0,0x00,0x18,0xC0,0x26,0xC0,0x18,0x00,0x19,0x28,0x39,0x3C,0xC0,0x01,0xCC,0x3C,0xC0,0x01,0xCC,0x19,0x00,0x19,0x18,0x3D,0x26,0x07,0x18,
+0x00,0x19,0x28,0xC0,0x3C,0x6D,0x61,0x3A,0x29,0x3C,0xC6,0x01,0xD3,0x3A,0x29,0x3C,0x29,0x9E,0x86,0x61,0x51,0x07,0x36,0xA3,0x88,0xC1,0xA3,0x98,0xA2,0x77,0xC7,0x3A,
+0x29,0x3C,0x29,0x3C,0xC1,0x01,0xC2,0x3C,0x01,0xC3,0x93,0xA9,0x3C,0xC0,0x01,0xC9,0x28,0x01,0xC4,0x3A,0xA1,0xA7,0xC0,0x2B,0x0F,0xC0,0x22,0x6D,0x9C,0xAB,0x44,0x9C,
+0x8A,0x50,0x53,0x51,0xC1,0xA2,0x86,0xC3,0x20,0xC0,0x3A,0x6F,0xA4,0x86,0xA3,0x87,0xA4,0x97,0xA2,0x78,0x35,0xC1,0x9E,0x7C,0xC0,0x29,0x3C,0xC2,0x01,0xC2,0x00,0xC0,
+0x3C,0x01,0xCD,0x3E,0x64,0x69,0x0F,0x22,0x9C,0x88,0x9C,0x8A,0x9A,0x8A,0x50,0x9D,0x9A,0xD5,0xA5,0x87,0x3F,0x3A,0xA5,0x87,0xA3,0x87,0x24,0x35,0xC1,0x9E,0x7C,0xC0,
+0x3C,0xC1,0x39,0x18,0x3C,0x39,0x01,0xC5,0x3C,0xC0,0x01,0xC0,0x3E,0x64,0x24,0x22,0x9C,0x88,0x9A,0x89,0x17,0x9D,0x9A,0xE0,0xA5,0x87,0xA6,0x87,0xA8,0x84,0xA4,0x78,
+0x27,0x35,0x96,0x9B,0x9C,0x8A,0x4B,0x07,0xC0,0x01,0xC8,0xA1,0x85,0x35,0x39,0x06,0x97,0x99,0x05,0xE9,0x31,0x06,0x39,0x27,0x16,0x9D,0x8C,0xA1,0x8B,0xA2,0x78,0xC0,
+0x57,0x01,0x3C,0x3A,0x3C,0x3A,0x01,0x3C,0xA1,0xA5,0x90,0x88,0x05,0xEF,0x31,0x06,0x0F,0x27,0x35,0x47,0x3A,0x01,0xC4,0x39,0x0F,0x8A,0x8C,0x05,0xF2,0x12,0xAB,0x85,
+0x27,0x35,0x3E,0xC0,0x01,0xC2,0x3A,0x9C,0x96,0x05,0xF5,0x2B,0x06,0x24,0x35,0x3E,0x3C,0xC2,0x9A,0x93,0x05,0xC3,0x6E,0x05,0xF2,0xAE,0x85,0xAB,0x87,0x35,0xC0,0x9D,
+0x8E,0x01,0xC1,0x3A,0x06,0x05,0xC3,0x0A,0x05,0xF4,0x06,0x24,0xA4,0x66,0x3A,0x29,0x3C,0xC0,0x01,0xC1,0x19,0x93,0xAA,0x18,0x1D,0xCB,0x01,0xC1,0x3A,0x06,0x05,0xC3,
+0x0A,0x05,0xF5,0xA6,0x87,0x22,0x35,0xC0,0x3C,0x39,0x01,0xC0,0x28,0x26,0xA4,0x87,0xA3,0x89,0x1D,0xCB,0x01,0xC1,0x69,0x90,0xA8,0x05,0xC3,0x0A,0x05,0xF7,0x20,0xAD,
+0x86,0xA5,0x85,0x31,0x39,0x28,0x3D,0x07,0x18,0x1D,0xCC,0x01,0xC1,0x3E,0x8D,0x99,0x17,0x9D,0x9A,0xFD,0xC0,0xAF,0x84,0xAC,0x87,0x35,0x06,0x26,0x1D,0xCE,0x01,0xC1,
+0x3E,0x8D,0x99,0x0A,0x66,0xCF,0xA9,0x97,0x05,0xED,0xA6,0x87,0x22,0x24,0x99,0x89,0x9D,0x6D,0x1D,0xCD,0x01,0xC1,0x69,0x8C,0xA7,0x05,0xD0,0x0F,0xA8,0x88,0x06,0x05,
+0xED,0xAF,0x84,0x2B,0x9C,0x77,0x1A,0x1D,0xCC,0x01,0xC1,0x1E,0x17,0x05,0xD0,0x13,0xFE,0xD6,0xF5,0xC0,0x1F,0x12,0x05,0xC3,0xA5,0x88,0x3A,0x31,0x05,0xE4,0x31,0x0F,
+0x27,0x96,0x6C,0x1D,0xCB,0x01,0x69,0x01,0x0F,0x8A,0x8C,0x05,0xD0,0xA6,0x87,0xFE,0xBE,0x31,0xAE,0x9A,0x9D,0x88,0x31,0x1E,0x8E,0x89,0x05,0xC1,0xA5,0x87,0xB3,0x85,
+0xAD,0x98,0x98,0x78,0x16,0x05,0xE4,0x36,0x27,0x19,0x1D,0xCA,0x01,0xC0,0x66,0x9D,0x95,0x05,0xD2,0xFE,0x9D,0x2D,0xB6,0x89,0x0E,0x04,0x34,0x8C,0x99,0x12,0x05,0xC1,
+0x16,0x21,0xB2,0x88,0x96,0x88,0x8D,0x8A,0x12,0x05,0xE3,0x06,0x24,0x39,0x1A,0x1D,0xC8,0x01,0xC0,0x69,0x20,0x05,0xD2,0x1F,0xBC,0x98,0x0E,0x04,0x6B,0x9D,0x98,0x21,
+0x06,0x05,0xC0,0x7F,0x13,0x31,0x0E,0x3A,0x31,0x1E,0x8B,0x9B,0x05,0xC3,0x0A,0x05,0xDC,0xAE,0x85,0x27,0x39,0x1A,0x1D,0xC7,0x01,0xC0,0x69,0x90,0xA8,0x0A,0x05,0xD1,
+0xB8,0x73,0x2B,0x0E,0x04,0x0B,0xC0,0x04,0x31,0x22,0x17,0x05,0xC0,0x1E,0xBF,0x99,0x0E,0x04,0x15,0x8B,0x9A,0x20,0x05,0xE2,0x16,0x24,0x68,0x98,0x5C,0x1D,0xC6,0x01,
+0xC0,0x66,0x8D,0xA6,0x05,0xD2,0x13,0xFE,0xE7,0x38,0x0E,0x0B,0xC2,0x04,0x93,0x8A,0x07,0x05,0xC0,0xA9,0x97,0x21,0x04,0x0E,0x5A,0x2B,0x92,0x98,0x88,0x79,0x1F,0x05,
+0xE1,0xA6,0x87,0xB2,0x74,0x27,0x96,0x6C,0x1D,0xC5,0x01,0xC0,0xA1,0x85,0x89,0xBC,0x05,0xD2,0x20,0x34,0x0E,0x04,0x0B,0xC3,0x93,0x89,0x07,0x17,0x05,0x36,0x34,0x0E,
+0x04,0x9D,0x99,0x0E,0x34,0x8A,0x89,0x89,0x9A,0x17,0x9D,0x9A,0xE0,0xA5,0x87,0x0F,0x27,0x19,0x1D,0xC0,0x9D,0xA9,0x1D,0xC1,0x01,0x3C,0x9D,0x95,0x05,0xD3,0x3A,0xFE,
+0xBE,0x31,0x0E,0x04,0x6B,0xC1,0x0E,0xC1,0x96,0x76,0x07,0x05,0x2B,0xBF,0x84,0x04,0x98,0x9B,0x9B,0x77,0xAD,0x98,0x04,0x15,0x8B,0x9A,0x89,0x9B,0x0A,0x05,0xE0,0x2B,
+0x07,0x24,0x98,0x5A,0x1D,0xC3,0xA9,0x99,0x6D,0x98,0xA6,0x17,0x05,0xD2,0x17,0xFE,0xAD,0x8E,0x0E,0x04,0x0B,0x9C,0x89,0x97,0x88,0x95,0xAB,0x9A,0x87,0xC1,0x9B,0x86,
+0x99,0x88,0x05,0x13,0x21,0x3E,0x2A,0xA4,0x87,0xC2,0x3D,0x06,0x05,0xC0,0x14,0x05,0xD1,0x14,0x05,0xCB,0xB7,0x71,0xA4,0x97,0x19,0x1D,0xC2,0x01,0xC0,0x06,0x05,0xC0,
+0x14,0x05,0xD1,0x00,0x04,0x97,0x9B,0x00,0x88,0x9E,0x17,0xA2,0x88,0xC0,0xA2,0x86,0x3F,0xC0,0x13,0x44,0x17,0x1E,0xB4,0x97,0x0B,0xC0,0x0E,0xC0,0x0B,0xC0,0x92,0x86,
+0x83,0x9B,0x05,0xE1,0x2B,0xB3,0x85,0x27,0x19,0x1D,0xC1,0x01,0x69,0x8E,0xA7,0x17,0x9D,0x9A,0xD3,0x1E,0x00,0x3D,0xB0,0x87,0xAE,0x76,0xA7,0x87,0xA4,0x99,0x0C,0xC1,
+0xA2,0x87,0x0C,0x97,0x96,0x81,0x8B,0x13,0x34,0x0E,0xC0,0x5A,0x0E,0xC0,0x0B,0x0E,0x31,0x83,0x9B,0x05,0xE1,0xA6,0x87,0x0F,0x1E,0x18,0x1D,0xC0,0x01,0x1E,0x17,0x05,
+0xC3,0x0A,0x05,0xCE,0x22,0xB2,0x87,0x0C,0xA8,0x77,0x0B,0xC0,0x0E,0x0B,0xC2,0x04,0xC0,0x8D,0x97,0xFE,0x21,0x41,0x21,0x04,0x0E,0xC0,0x0B,0x0E,0x0B,0xC1,0x31,0x22,
+0x8D,0x9D,0xE1,0x3F,0x24,0x9D,0x8A,0x18,0x1D,0xAA,0x87,0x07,0x05,0xD5,0x06,0x0C,0x12,0x0B,0xC0,0x0E,0x0B,0xC3,0x0E,0xC0,0x0B,0x1F,0x93,0x9A,0x0C,0x12,0x0B,0xC3,
+0x0E,0x0C,0x1E,0x06,0x05,0xCE,0x0A,0x05,0xC7,0x14,0x05,0xC6,0xAB,0x86,0x27,0x39,0x18,0x01,0xC2,0x3A,0x06,0x05,0xC0,0x14,0x05,0xD2,0x3C,0xFE,0xCE,0xB3,0x12,0x7A,
+0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0x9A,0x99,0x1E,0x3D,0x0E,0xC1,0x0B,0x0E,0x0B,0x61,0x80,0x7A,0x17,0x1E,0x06,0x90,0x9C,0xC0,0x14,0x05,0xDE,0x06,
+0x24,0x06,0x1D,0xC3,0x01,0x66,0x01,0xC0,0x69,0x20,0x05,0xD5,0x20,0x31,0xAB,0x9A,0x0C,0xC0,0x19,0xA4,0x87,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x96,0x86,0x8B,
+0x99,0x2B,0x0E,0x0B,0xC2,0x8E,0x99,0x17,0x16,0xB7,0x77,0x95,0x94,0x20,0x05,0xE1,0x39,0x27,0x06,0x1D,0xC1,0x9D,0xA9,0x01,0xC2,0x0F,0x8C,0x9B,0x05,0xD5,0x20,0xB2,
+0x75,0x92,0x9C,0x96,0x88,0x05,0x2B,0x06,0x33,0x2A,0x0B,0xC0,0x04,0xC0,0x0B,0x04,0xC0,0x3D,0x19,0x12,0x0B,0xC1,0x9D,0x98,0x0F,0x30,0x2B,0x0E,0x2B,0x87,0x99,0x85,
+0x8A,0x05,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xC9,0xA5,0x88,0x24,0x9D,0x8A,0x18,0x10,0x9B,0xA8,0x26,0x01,0xC2,0x9A,0xA5,0x05,0xD6,0xA6,0x87,0x1E,0x30,0x33,0x30,0x97,
+0x6A,0x14,0x05,0xB0,0x88,0xFE,0xD6,0xD7,0x12,0x15,0x0E,0xC0,0x0B,0x0E,0x9A,0x89,0x93,0x85,0x0E,0xC0,0x0B,0xC0,0x33,0xC0,0xB6,0x77,0x0B,0xC0,0x0E,0x34,0x0F,0x8A,
+0x8C,0x62,0xE0,0x20,0x27,0x91,0xAE,0x26,0xA3,0x98,0x25,0xAA,0x67,0x01,0xC1,0x06,0x05,0xC0,0x14,0x05,0xD3,0x32,0x21,0xB5,0x9E,0xA1,0x9A,0xC0,0x1B,0x2D,0x86,0x88,
+0x05,0x25,0xFE,0xD6,0xD7,0x12,0x0B,0xC0,0x0E,0x0B,0xC0,0x93,0x89,0xAD,0x98,0xC1,0x2B,0x21,0x0B,0xC1,0x0E,0x3D,0x30,0x36,0x06,0x05,0xC0,0x14,0x05,0xDE,0x36,0xA3,
+0x88,0x25,0xC1,0x01,0xC0,0x3C,0x3E,0x8D,0x99,0x0A,0x66,0xD5,0x32,0x21,0x1B,0x31,0xC2,0x1B,0x30,0x14,0xB6,0x56,0x2A,0x0B,0xC4,0x0E,0x0B,0x04,0x96,0x87,0x2B,0x0E,
+0x0B,0xC0,0x8F,0xAB,0xFE,0x31,0xA5,0x99,0x88,0xB7,0x87,0xA6,0x96,0x89,0x89,0x95,0x9D,0xE0,0x3A,0x35,0x96,0x9B,0x25,0xC0,0xAA,0x57,0x28,0x3C,0x1E,0x17,0x05,0xD6,
+0x32,0x21,0x1B,0x31,0xC3,0x1B,0x33,0x2B,0x33,0xB6,0x77,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x61,0x94,0x76,0x0B,0xC1,0x93,0x89,0x3F,0x25,0x3D,0xA9,0x9C,0x9B,0x87,
+0x84,0x74,0x87,0xAC,0x9C,0x8A,0xE0,0xB5,0x84,0x27,0x25,0xC0,0x9C,0x87,0x18,0xA4,0x88,0x29,0x05,0xD7,0xA6,0x87,0x21,0x1B,0x31,0xC4,0x1B,0x30,0x26,0xFE,0xDE,0xF8,
+0xA8,0x77,0x69,0xC1,0x04,0x0E,0xC0,0x34,0xC0,0x0B,0xC0,0x3D,0xFE,0x3A,0x06,0x30,0x33,0x31,0xC1,0x37,0x06,0x05,0xE0,0xA9,0x97,0x35,0x29,0x25,0x07,0x62,0x29,0x9C,
+0x87,0x05,0xC3,0x0A,0x05,0xD1,0x2B,0xBF,0x84,0x1B,0x31,0xC5,0x9E,0x75,0xFE,0x42,0xA9,0x30,0x12,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x92,0x76,0x0E,0x51,0x0B,0xFE,0x73,
+0xAD,0x9D,0x77,0x33,0xA5,0x9A,0xC2,0x05,0x84,0x86,0x2B,0x9B,0x9A,0xE0,0xB8,0x73,0xC0,0x22,0x26,0x07,0xA9,0x85,0x90,0x99,0x05,0xD7,0x2B,0xBF,0x84,0x1B,0xA1,0x9A,
+0xC2,0x33,0x98,0x75,0xC0,0x2A,0x0B,0x36,0x0C,0x12,0x69,0xC1,0x0E,0xC0,0x92,0x76,0x0E,0x3A,0x2D,0x3D,0xFE,0xD6,0xD7,0x0C,0x3D,0x12,0xA0,0x9C,0xC1,0x37,0x87,0x75,
+0x05,0xE0,0xAB,0x86,0x27,0x96,0x9D,0x99,0x9C,0xC0,0x26,0xA4,0x87,0x3D,0x26,0x07,0x3D,0x26,0x07,0xA9,0x85,0x17,0x05,0xD7,0x2B,0x00,0x1B,0x31,0xC1,0x33,0x86,0x21,
+0x9A,0x55,0xC0,0x2C,0xB6,0xED,0x30,0xA6,0x89,0xB6,0x77,0x0B,0x0E,0xC0,0x0B,0x9D,0x98,0x19,0xAA,0x8B,0x0B,0x30,0x11,0xA7,0x87,0x87,0x35,0xA1,0x65,0xFE,0x5B,0xAA,
+0xBD,0xBB,0x31,0xC0,0x1B,0x85,0x95,0x85,0x8A,0x99,0x9C,0xE0,0x24,0x0F,0x18,0x25,0x9C,0x88,0xC3,0x26,0x3D,0xC0,0x26,0xA4,0x87,0x13,0xA4,0x65,0x05,0xD8,0x32,0x00,
+0x1B,0xA1,0x9A,0xC1,0x8E,0x84,0x12,0x9A,0xCE,0x9C,0x88,0xA8,0x65,0x11,0xAB,0x98,0xFE,0x42,0xA9,0xFE,0xEF,0xBB,0xA2,0x86,0xC0,0x04,0xC0,0x0B,0x34,0x0E,0x9A,0x89,
+0x00,0x2A,0x82,0x67,0x98,0x23,0x96,0xCD,0xAD,0x65,0x11,0xB4,0x9B,0xC1,0x93,0x74,0x06,0x90,0x9C,0xE0,0x22,0x35,0x25,0x02,0x9B,0x99,0xA4,0x88,0xC5,0x26,0x07,0xA9,
+0x85,0x98,0x96,0x05,0xC3,0x0A,0x05,0xD2,0xA5,0x87,0xBF,0x84,0x1B,0x31,0xC1,0x21,0x12,0x96,0xAC,0x99,0xDD,0x19,0xB1,0xBC,0x1B,0x16,0x2D,0xAB,0x97,0x7A,0x0E,0x5A,
+0x9D,0x98,0x99,0x87,0x0B,0x8F,0xAB,0x21,0xB1,0x89,0xFE,0x5B,0xA9,0x98,0x23,0x97,0xDE,0xAC,0x54,0x11,0xB4,0x9B,0xC1,0x98,0x85,0x1E,0x17,0x05,0xDF,0xA9,0x97,0x27,
+0x92,0x9F,0x9B,0x89,0x56,0x3D,0xC5,0x26,0xA4,0x87,0xA9,0x85,0x8D,0xAB,0x05,0xD8,0xA5,0x87,0x00,0x1B,0x31,0xC1,0x0C,0x28,0x19,0xC0,0xA2,0x75,0xB8,0xFF,0x31,0x2D,
+0x30,0x12,0x69,0x04,0xC0,0x0B,0x96,0x86,0x12,0x88,0x9A,0xB6,0x77,0x31,0x21,0x28,0xA1,0x65,0xA6,0xBB,0x2A,0x31,0xC1,0x37,0x9B,0x74,0x83,0x9D,0x95,0x9B,0xE0,0xBB,
+0x82,0x99,0x89,0x94,0x9E,0xC0,0x02,0x3D,0xC5,0x13,0xA5,0x77,0x05,0xD9,0x32,0x21,0x1B,0x31,0xC2,0x2D,0x30,0x58,0x37,0x1B,0x31,0x9E,0x75,0xFE,0x5B,0x4A,0xFE,0xE7,
+0x5B,0x0B,0xC0,0x0E,0x0B,0x93,0x89,0xAD,0x98,0x30,0xBE,0x77,0x31,0x1B,0x0C,0x2D,0x33,0x31,0xC1,0x33,0x93,0x96,0xAC,0x88,0x1E,0x87,0x9D,0xE0,0xB8,0x73,0x9E,0x85,
+0x15,0xC0,0x3D,0xC6,0x07,0x94,0x9A,0x05,0xD9,0x32,0xFE,0x9D,0x2D,0x1B,0x31,0xC4,0x1B,0x31,0xC2,0x30,0xBB,0x86,0x12,0x7A,0x0E,0x0B,0x92,0x86,0x0E,0x88,0x8B,0xB6,
+0x77,0xA2,0x9B,0xC6,0x8E,0x84,0x05,0x0B,0x00,0x83,0x9B,0x99,0x9C,0xDF,0xB0,0x74,0xA8,0x95,0x3F,0xC0,0x3D,0xC5,0x02,0x0F,0x8C,0x9B,0x05,0xD9,0x3F,0x00,0x1B,0xA1,
+0x9A,0xC9,0x21,0x0C,0x12,0x0B,0xC1,0x92,0x86,0x0E,0x97,0x8A,0x11,0x1B,0xA1,0x9A,0xC4,0x37,0x0C,0x12,0x0B,0x87,0x98,0x8A,0x89,0x05,0xDF,0x20,0x27,0x91,0xAE,0x3F,
+0xA5,0x9A,0xC5,0x13,0xA4,0x65,0x05,0xC3,0x0A,0x05,0xD4,0xA6,0x87,0xBA,0x74,0x33,0xB6,0x77,0x31,0xC7,0x97,0x85,0x33,0x2A,0x12,0x15,0x0E,0x0B,0x96,0x86,0x2B,0x0B,
+0x0C,0x11,0x3D,0x1B,0x31,0xC0,0x05,0x37,0x2D,0x12,0x15,0x2B,0x1E,0x36,0x8B,0x9D,0xDF,0xA9,0x85,0xB5,0x84,0x91,0x9C,0x99,0x9D,0xA4,0xB8,0xC0,0x02,0x66,0xC1,0x02,
+0xAB,0x84,0x93,0x9B,0x95,0x9B,0xDA,0x32,0xFE,0x9D,0x2D,0x2B,0x91,0x9A,0x11,0xAB,0x98,0x1B,0xC2,0x0C,0x9B,0x77,0x11,0x3D,0x12,0x69,0xC1,0x0E,0x0B,0x9C,0x86,0x19,
+0x12,0x0B,0xC0,0x2D,0x33,0x11,0x33,0x11,0x0C,0x12,0x0B,0xC0,0x0C,0x20,0x0F,0x05,0xDF,0xA6,0x87,0x36,0x95,0x9A,0x95,0x9F,0xA4,0xC8,0xC0,0x06,0xC3,0x1E,0x8A,0x8B,
+0x05,0xDA,0x3F,0xFE,0x9D,0x2D,0xB6,0x89,0x0E,0x2B,0x96,0x79,0x9B,0xA9,0x33,0xC0,0x21,0x2D,0x2A,0xA4,0x87,0xC2,0x04,0xC0,0x0B,0xC0,0x04,0x8F,0xA9,0x0B,0xC2,0x12,
+0x0B,0xC0,0x12,0x7A,0x0E,0x0B,0xC0,0x93,0x89,0x17,0x07,0x90,0x99,0x05,0xDE,0xA5,0x87,0x27,0x14,0x95,0x9F,0x09,0xC0,0x06,0x09,0xC0,0x06,0xA4,0x76,0x26,0x05,0xDB,
+0x3F,0xFE,0xAD,0x8E,0x0E,0xC0,0x5A,0xC1,0x0E,0x0B,0xC0,0x0E,0x0B,0x61,0x0B,0x04,0xC0,0x0B,0xC2,0x12,0x34,0xC0,0x0B,0xC1,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0x3A,
+0x33,0x05,0xB3,0x85,0x31,0x05,0xDF,0xBB,0x83,0x99,0x88,0x15,0x06,0x09,0xC1,0x06,0x09,0xAB,0x54,0x94,0x78,0x05,0xDB,0x16,0x3D,0x0E,0xC0,0x0B,0xC1,0x04,0xC0,0x0B,
+0x0E,0xC0,0x0B,0xC2,0x3A,0x0B,0x0E,0x0B,0xC0,0x3A,0x94,0x76,0x0B,0xC0,0x04,0xC0,0x0B,0xC2,0x04,0xC0,0x0B,0xFE,0x4B,0x0A,0x8A,0xBA,0x29,0x98,0x89,0x05,0xDF,0x24,
+0x99,0x89,0x15,0x09,0xC0,0x06,0x09,0xC1,0x1E,0x17,0x05,0xDB,0x3F,0x21,0xB1,0x89,0x0B,0x04,0xC0,0x0B,0xC0,0x6B,0x0E,0x0B,0xC2,0x0E,0x0B,0xC2,0x3A,0x0B,0x34,0xA4,
+0x87,0x0B,0xC0,0x12,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x97,0x9A,0xFE,0x18,0xE2,0x05,0xB0,0x74,0xC0,0x05,0xC0,0x14,0x05,0xDC,0x24,0x20,0x94,0x9E,0x09,0xC0,0x5A,
+0x09,0xC0,0xA9,0x44,0x0F,0x05,0xDC,0xAB,0x86,0x22,0x0B,0xC1,0x04,0xC0,0x0B,0xC3,0x04,0xC0,0x0B,0xC3,0x04,0x34,0xA2,0x9A,0x0E,0x0B,0xC1,0x12,0x0B,0xC0,0x04,0xC0,
+0x0B,0xC0,0x33,0x05,0xC0,0x16,0xAA,0x75,0x17,0x05,0xDD,0x32,0x24,0x22,0x25,0x06,0x09,0xC1,0x06,0x1E,0x20,0x05,0xDC,0x20,0x31,0x0B,0xC2,0x0E,0x0B,0xC0,0x04,0xC0,
+0x0B,0xC3,0x04,0x0B,0x04,0x9C,0x87,0xC0,0x0B,0xC3,0x0E,0x0B,0xC1,0x04,0xC0,0x0B,0x25,0x05,0xC0,0xA9,0x85,0x36,0x8B,0x9D,0xDE,0x3F,0xB7,0x82,0x13,0x25,0x99,0xC9,
+0x13,0x06,0xC1,0x1E,0x17,0x05,0xDC,0x20,0xFE,0xBD,0xD1,0x0B,0xC1,0x0E,0xC0,0x0B,0x0E,0x0B,0x61,0x0B,0x04,0xC0,0x0B,0xC3,0x04,0x0B,0xC0,0x04,0xC0,0x0B,0xC3,0x04,
+0x0B,0xC0,0x93,0x89,0x17,0x05,0xC0,0xA6,0x87,0xAD,0x85,0x17,0x05,0xDD,0xB4,0x72,0x24,0x25,0xC0,0x2D,0xC2,0xAC,0x43,0x22,0x05,0xDD,0xAB,0x86,0x31,0x0E,0x51,0xA2,
+0x78,0xC0,0x04,0xC0,0x0B,0xC3,0x04,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x0B,0x3A,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0x3A,0x0B,0xFE,0x6B,0xAB,0x17,0x9D,0x9A,0xC1,0x22,0x17,
+0x05,0xDD,0x0F,0x22,0x99,0x9D,0x25,0x2D,0xC2,0x24,0x8E,0x8B,0x17,0x9D,0x9A,0xDC,0x3C,0xFE,0xCE,0xB3,0x12,0x0B,0xC2,0x12,0x0B,0xC1,0x04,0xC0,0x0B,0xC3,0x04,0x97,
+0x9B,0x37,0x0C,0x12,0x0B,0xC0,0x12,0x0B,0x04,0xC0,0x0B,0xC0,0x3D,0xFE,0x18,0xE2,0x05,0xC2,0x22,0x17,0x05,0xDC,0x20,0x27,0x3C,0x9C,0x7B,0xC0,0x2D,0xC1,0x13,0xA7,
+0x64,0x05,0xDE,0xB0,0x74,0x19,0x12,0x0B,0xC2,0x04,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0xC2,0x2A,0x30,0x3A,0x05,0x3A,0x11,0x0B,0xC1,0x04,0xC0,0x0B,0xC1,0x30,0x14,0x05,
+0xC2,0x22,0x17,0x05,0xDC,0xB7,0x72,0xC0,0x1A,0x7A,0xC0,0x98,0xE9,0x2D,0xC0,0x36,0x9A,0x88,0x05,0xDE,0x13,0x34,0x0E,0x0B,0x04,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0xC3,
+0x3D,0x29,0x05,0xC2,0xA5,0x87,0x37,0x1B,0x7C,0x0B,0x0E,0x0B,0x04,0x9C,0x87,0x20,0x05,0xC3,0x13,0x05,0xDC,0x20,0x27,0x96,0x6C,0x1D,0xC1,0x26,0xC0,0x2D,0xAF,0x51,
+0x8C,0x8D,0x05,0xDE,0x13,0x34,0x0E,0x0B,0xC0,0x69,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0x0E,0x0C,0x25,0x05,0xC4,0x25,0xFE,0xE7,0x5B,0x0B,0xC0,0x0E,0x0B,0xC0,
+0x88,0x9B,0x05,0xC4,0x22,0x8D,0xAD,0x05,0xDB,0x0F,0xC0,0x1D,0xC2,0x26,0x2D,0xA7,0x76,0xA6,0x52,0x05,0xDF,0x22,0xBA,0x97,0x0B,0xC1,0x0E,0x0B,0x04,0xC0,0x0B,0xC3,
+0x2A,0x36,0x05,0xC2,0x3F,0x13,0x9C,0x7A,0x2B,0x37,0x1B,0x0B,0xC0,0x12,0x34,0x3F,0x05,0xC4,0xB5,0x84,0x08,0x05,0xDA,0x3C,0x27,0x19,0x9E,0x9B,0xC2,0x2D,0xC0,0xAE,
+0x53,0x94,0x78,0x05,0xDF,0xB3,0x84,0xC0,0x0C,0xA8,0x77,0x0B,0xC1,0x0E,0x0B,0xC1,0x61,0x0B,0x04,0x30,0x14,0x05,0x14,0xB6,0x56,0x21,0xAC,0x88,0xA3,0x87,0x0C,0x11,
+0x30,0x12,0x0B,0xC0,0x2B,0xFE,0x5B,0x4A,0x05,0xC5,0x36,0x08,0x05,0xD9,0xA5,0x87,0x27,0x32,0x18,0x1D,0xC2,0x2D,0xC0,0x0D,0x17,0x05,0xDF,0xB3,0x85,0x9C,0x87,0xAA,
+0x7A,0x2A,0x0B,0xC3,0x04,0xC0,0x0B,0xC0,0x21,0x17,0x05,0x25,0x37,0xAF,0x86,0x0E,0x0B,0xC0,0x04,0xC0,0x9D,0x99,0x0E,0x0B,0xC0,0x33,0x05,0xC5,0xA5,0x88,0x22,0x17,
+0x05,0xD9,0x22,0xA8,0x84,0x20,0xA1,0x9B,0xA2,0x77,0xC0,0x18,0x1D,0x2D,0x13,0x22,0x17,0x05,0xDF,0x36,0x22,0x05,0x29,0x2A,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x19,
+0xFE,0x3A,0x06,0x96,0x88,0x30,0xBB,0x86,0x12,0x0B,0x04,0xC0,0x2B,0x3A,0x0E,0x0B,0xC1,0x0C,0x3F,0x05,0xC5,0xA7,0x85,0x22,0x17,0x05,0xD8,0xA6,0x87,0x1E,0x98,0x97,
+0x9B,0x8D,0x42,0xC1,0x69,0xC0,0x2D,0x1E,0x92,0x88,0x05,0xE0,0xB3,0x85,0xA1,0x56,0x94,0x9B,0x99,0xBB,0xB4,0x84,0x0C,0xA8,0x77,0x0B,0xC1,0x0E,0x0B,0x33,0x86,0x89,
+0x21,0xB1,0x89,0x64,0x2B,0x0C,0x9B,0x77,0x33,0x21,0x0D,0x6D,0xC1,0x0C,0x25,0x05,0xC6,0x32,0x22,0x05,0xD9,0x22,0xA4,0x78,0x3D,0xC0,0x02,0x3D,0xA2,0x77,0x3D,0xC0,
+0x9D,0xC8,0x24,0x88,0x8D,0x05,0xE0,0x29,0x97,0x7A,0x4C,0x05,0xC0,0x02,0xFE,0xC6,0x97,0x12,0x0B,0xC0,0x0E,0x19,0x29,0x2D,0x12,0x0B,0x34,0x33,0x11,0x2D,0x2A,0x0B,
+0xC2,0x0C,0xFE,0x52,0xC6,0x05,0xC7,0xA9,0x85,0x3C,0x0A,0x66,0xD7,0xA9,0x97,0x27,0x0F,0x3D,0xC0,0x02,0x3D,0xC0,0x07,0x3D,0x36,0x22,0x05,0xE1,0x29,0x31,0xA8,0x47,
+0x93,0xCC,0x05,0xC0,0xAA,0x78,0xFE,0xBD,0xD4,0x1B,0x0B,0xC0,0x97,0x9A,0x0C,0x12,0x7A,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x19,0xFE,0x42,0xA9,0x05,0xC8,0x16,0xA2,
+0x75,0x05,0xD8,0xB7,0x74,0xA0,0x85,0x95,0xAF,0x6B,0xC0,0x02,0x3D,0xC2,0x9D,0xC9,0xC3,0x69,0xC0,0x24,0x8E,0x8B,0x97,0x9C,0xE1,0x29,0x93,0x9B,0x2E,0x0F,0x05,0xC1,
+0xA5,0x88,0x33,0x2A,0xA4,0x88,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x61,0x0B,0x0E,0x0B,0xC0,0x0C,0x25,0x05,0xC9,0x20,0x50,0x97,0x9C,0xD7,0x20,0x27,0x3C,0x9C,0x7B,
+0x3D,0xA2,0x77,0x2D,0xC4,0x69,0x24,0x17,0x05,0xE1,0xB0,0x74,0x32,0x2E,0x98,0x99,0x05,0xC2,0x14,0xBB,0x75,0x0C,0x12,0x0B,0xC1,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,
+0x97,0x9A,0x00,0x8C,0xA9,0xCA,0xAA,0x78,0x9B,0x97,0x05,0xD6,0x2B,0x1E,0x9C,0x88,0x97,0x9D,0x07,0xC0,0x3C,0x2D,0xC2,0x69,0xC0,0xA7,0x77,0xA6,0x52,0x05,0xE2,0x29,
+0x31,0xA4,0x58,0x59,0x05,0xC4,0xAC,0x87,0x21,0x3A,0x0E,0x0B,0xC3,0x0E,0x0B,0x21,0xFE,0x21,0x65,0x05,0xE5,0xAF,0x84,0xAC,0x87,0x3D,0xC0,0x02,0x3D,0xC0,0x2D,0xC3,
+0x69,0x24,0x3A,0x05,0xE2,0x22,0x93,0x9C,0x32,0x2E,0x05,0xC3,0x0A,0x05,0xC0,0xB9,0x76,0xBA,0x88,0x12,0x0B,0xC1,0x0E,0x19,0x30,0x14,0x05,0x14,0x05,0xE3,0xA5,0x87,
+0x1E,0x97,0x89,0x3D,0xC0,0x02,0x3D,0xC0,0x9D,0xC9,0xC2,0x26,0x2D,0x24,0x8E,0x8B,0x97,0x9C,0xE2,0xB3,0x85,0x2B,0xC0,0x2E,0x0F,0x05,0xC6,0x2B,0xB7,0x99,0xB5,0x75,
+0x2A,0x19,0x11,0x85,0x9A,0x05,0xE7,0x22,0x39,0x3D,0x07,0xC0,0x3D,0xC1,0x2D,0x26,0xC1,0x2D,0x1D,0xA8,0x63,0x05,0xE3,0x22,0x17,0x05,0x2E,0x28,0x05,0xC8,0xA8,0x55,
+0xA2,0xAB,0xC0,0x05,0xE8,0xA9,0x97,0x24,0x0F,0x4B,0x3D,0xC3,0x9D,0xC8,0xC0,0x2D,0x26,0x2D,0x24,0x98,0x88,0x05,0xE3,0x13,0x08,0x05,0xAF,0x54,0xFE,0x3C,0x62,0x9C,
+0x9A,0x99,0xAD,0x98,0x99,0x9B,0xAB,0x28,0x05,0xA8,0x55,0xA3,0x77,0x2E,0x2C,0xA7,0x65,0x89,0xAD,0x05,0xE9,0xB5,0x84,0x22,0x3D,0x41,0x07,0x3D,0xC1,0x26,0x9F,0xD8,
+0x2D,0x26,0xC0,0x2D,0x24,0x90,0x8A,0x05,0xE3,0xB0,0x95,0x08,0x05,0xAF,0x33,0xFE,0x65,0xA7,0xA7,0x74,0x67,0x52,0x9C,0x89,0x9E,0x86,0x9E,0x9B,0x0A,0xA2,0x89,0xA4,
+0x87,0x18,0x1A,0x87,0xBF,0xFE,0x00,0x60,0x05,0xE7,0xA9,0x85,0xB5,0x84,0x3C,0x9C,0x7B,0x3D,0xC1,0x69,0x3D,0xC0,0x2D,0x69,0xC1,0x2D,0xB2,0x41,0x89,0x9D,0x9C,0x8A,
+0xE3,0x13,0x08,0x05,0xAB,0x55,0xFE,0x65,0xA7,0x18,0xC0,0x1A,0x18,0x1A,0x18,0xC0,0x1A,0x18,0xC1,0x94,0x8B,0xFE,0x01,0x60,0x05,0xE7,0xB8,0x73,0x22,0x3D,0xC0,0x02,
+0x3D,0xC2,0x07,0x2D,0x26,0xC1,0x1D,0x04,0x05,0xE4,0x13,0x05,0xC0,0x2B,0x0A,0x18,0xC0,0x1A,0x18,0xC2,0x25,0x0A,0x0D,0x18,0x1A,0xFE,0x0A,0xA0,0xFE,0x00,0x40,0x05,
+0xE5,0xA9,0x85,0xB5,0x84,0x3C,0x3D,0xC2,0x07,0x61,0xA5,0x68,0x3D,0x2D,0xC1,0x26,0xAC,0x44,0x14,0x8D,0x9F,0xE4,0xAC,0x87,0x2B,0x05,0x2B,0xFE,0x55,0x63,0x18,0xC1,
+0x1A,0x18,0xC0,0x99,0x9C,0xFE,0x5B,0xA9,0x9E,0x8C,0xA5,0x51,0x1A,0x18,0x8F,0xAD,0x28,0x05,0xE5,0x22,0x6D,0x3D,0xC0,0x02,0x3D,0xC0,0xA3,0x87,0x36,0x3D,0xC0,0x2D,
+0xA3,0x88,0x13,0xC0,0xAB,0x76,0x94,0x87,0x05,0xE4,0xA5,0x87,0x17,0x05,0xA8,0x55,0x0A,0x18,0xC3,0x1A,0x0A,0xFE,0x6B,0xAB,0xA0,0x9A,0x05,0xFE,0x65,0xA7,0x18,0x99,
+0x9C,0xFE,0x22,0x84,0x8F,0xDD,0x62,0xE4,0xB8,0x73,0x3C,0x3D,0xC1,0x69,0xA3,0x88,0x36,0x3D,0xC1,0x13,0xC1,0x7B,0x27,0x1F,0x05,0xE1,0x2B,0x28,0xA4,0x77,0x10,0x06,
+0x10,0x06,0xBB,0x41,0xAD,0x62,0x18,0x1A,0x18,0xC1,0x2C,0x31,0x16,0x58,0xAA,0x10,0x18,0x1A,0x93,0x9D,0x28,0x99,0xCC,0xC0,0xA4,0x66,0x37,0x06,0xC0,0x10,0xC0,0x06,
+0x10,0x28,0x05,0xC0,0x19,0x05,0xD5,0xAB,0x86,0x1E,0x97,0x7C,0x3D,0xC0,0x02,0x36,0x3D,0xC1,0x41,0x07,0x13,0x9C,0xAB,0x13,0xA5,0x77,0x04,0x05,0xDE,0x32,0x2E,0x0C,
+0x15,0x3B,0x45,0x92,0xCE,0xA0,0x9A,0x10,0x59,0x10,0x0C,0x0E,0xAB,0x74,0x1A,0x18,0x1A,0x18,0xC0,0xFE,0x4C,0x07,0x16,0x58,0x1C,0x1A,0x18,0x0D,0xFE,0x1A,0xC1,0x24,
+0xA8,0x65,0x3B,0x12,0x0A,0x0E,0x06,0x10,0x37,0x06,0xC0,0x24,0x95,0xCC,0x9C,0xAA,0xD6,0x3C,0xA5,0x88,0x0F,0x3D,0x26,0x07,0x3D,0xC0,0x69,0x3D,0xC1,0x1D,0x59,0xC0,
+0xA7,0x87,0x9F,0x75,0x05,0xDC,0x28,0x0C,0xFE,0x3C,0x62,0x0A,0xA6,0x89,0x1A,0x18,0x0D,0x3B,0x28,0x05,0xC0,0x19,0x05,0x24,0x39,0x1A,0x18,0xC0,0x1A,0x18,0x25,0x2C,
+0x55,0xAC,0x75,0x1F,0x18,0xC0,0x39,0x0E,0x18,0xC3,0x15,0xFE,0x00,0x60,0x05,0xC1,0x37,0x0C,0x28,0x05,0xD5,0xB4,0x72,0x13,0x9C,0x7B,0x07,0x3D,0xC1,0x41,0x07,0x36,
+0x3D,0xC0,0x13,0xC1,0xAB,0x76,0x96,0x98,0x05,0xDB,0x2E,0x12,0x0D,0x18,0xC0,0x1A,0x18,0xC1,0x1A,0x3B,0x28,0x05,0xC2,0xAF,0x54,0x39,0x1A,0x18,0x1A,0x18,0xC1,0x99,
+0x9C,0x1F,0x18,0xC2,0x12,0x0D,0x18,0x1A,0x18,0xC0,0x25,0x06,0x05,0xC2,0x3A,0x31,0x17,0x05,0xD4,0xB8,0x73,0x98,0x89,0x26,0x3D,0xC0,0x02,0x3D,0xC0,0x26,0x07,0x36,
+0x26,0x3D,0x9D,0xE6,0xA0,0xA9,0x9E,0xB6,0xA3,0x99,0xFE,0x52,0x26,0x13,0xC0,0xAB,0x75,0x8E,0x8B,0x97,0x9C,0xDA,0xAF,0x33,0xFE,0x55,0x63,0x18,0xC1,0x1A,0x18,0xC1,
+0x1A,0x18,0x1A,0x8B,0x9D,0x19,0x05,0xC1,0xA9,0x97,0xFE,0x54,0xE7,0x9F,0x74,0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x8F,0xAD,0xC0,0x0D,0x18,0xC0,0x1A,0x18,0x15,0xFE,0x00,
+0x60,0x05,0xC2,0xA7,0x78,0x10,0x05,0xD4,0xBB,0x82,0x06,0x26,0x3D,0x36,0x26,0x9F,0xB8,0xA0,0xA8,0x2B,0x9D,0xB7,0x7E,0x35,0xA0,0xB7,0x7A,0x61,0xC1,0x13,0xC1,0x24,
+0x17,0x05,0xDA,0xB8,0x10,0x1A,0x18,0xC9,0x0C,0x0F,0x05,0xC1,0x39,0x1A,0x93,0x9A,0x2C,0x18,0xC2,0x1A,0x18,0xC2,0x8A,0x9E,0x10,0x0E,0x18,0xC2,0x0E,0xFE,0x01,0x60,
+0x05,0xC3,0xAF,0x33,0x19,0x05,0xD3,0xB7,0x74,0x1E,0x61,0x12,0x35,0xA0,0xB7,0xC0,0xA3,0x87,0x9E,0xB9,0x56,0x51,0xC4,0x3D,0x13,0xC0,0xA5,0x77,0xA3,0x88,0x88,0x9D,
+0xDB,0xFE,0x3C,0x62,0xAE,0x76,0x18,0xC1,0x1A,0x18,0xC1,0x1A,0x18,0xC1,0x0E,0xFE,0x09,0x81,0x05,0xC1,0x28,0x1A,0x51,0x97,0x8A,0x25,0x06,0x18,0xC5,0x3E,0xFE,0x00,
+0x40,0x2E,0xBB,0x51,0x1F,0x18,0x1A,0x18,0x3E,0x0A,0x67,0x05,0xC1,0xA6,0x87,0x31,0x93,0xBC,0x05,0xD2,0x13,0xA2,0xD6,0x37,0x9D,0xB9,0x29,0xC1,0x7E,0x29,0xC5,0xA2,
+0x88,0x7E,0x13,0xC0,0x04,0x9C,0x79,0x8C,0x9E,0xDB,0x1C,0x18,0xCB,0x3B,0xFE,0x01,0x00,0x05,0xC0,0xAF,0x33,0xFE,0x76,0x09,0x18,0xC0,0x25,0x50,0x0D,0x18,0xC3,0x2C,
+0xFE,0x09,0x81,0x05,0xC0,0xB3,0x33,0xFE,0x65,0xA7,0x18,0x1A,0x18,0x12,0x28,0x05,0xC3,0x10,0x06,0x05,0xC3,0x6E,0x05,0xCC,0xA7,0x85,0xB2,0xA4,0xFE,0x89,0x40,0x29,
+0xC2,0x66,0x29,0xC0,0x24,0xC0,0x29,0xC1,0xA3,0x98,0xC0,0x13,0xC0,0x27,0x92,0x9C,0x91,0x9D,0xDB,0x1C,0x18,0xCC,0xFE,0x0A,0xA0,0x0A,0x05,0xAF,0x33,0x36,0x18,0xC2,
+0x12,0xAA,0x76,0xA4,0x87,0x18,0xC1,0x0E,0xFE,0x00,0xA0,0x05,0xC0,0x17,0xB2,0x21,0x36,0x18,0x1A,0x25,0xFE,0x01,0x60,0x05,0xC3,0xA5,0x87,0xAA,0x55,0x17,0x05,0xD2,
+0x07,0xFE,0x8A,0x21,0x29,0xC1,0x7E,0x3D,0x29,0xC2,0xA3,0x98,0xC1,0x6E,0xC0,0xFE,0x49,0xA6,0x13,0x1D,0x27,0x8E,0x9C,0x95,0x9D,0xDB,0x39,0x1A,0x18,0xCB,0x39,0x28,
+0x05,0x2B,0xFE,0x54,0xE7,0x1F,0x18,0xC2,0x25,0x50,0x0D,0x18,0xC0,0x3B,0xFE,0x00,0x60,0x05,0xC2,0x08,0x36,0x18,0xC0,0x2C,0xFE,0x00,0x40,0x05,0xC3,0x32,0x24,0x19,
+0x05,0xD1,0xAB,0x86,0xAE,0xA3,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x29,0xC0,0x05,0xC1,0x29,0xC0,0x05,0x6E,0x05,0xC0,0x0A,0xC1,0x05,0xC1,0x29,0x31,0x13,0xC0,0x22,0xA8,
+0x84,0x89,0x9F,0x9C,0x8A,0xDB,0xFE,0x3B,0xE5,0xB5,0x50,0x18,0xCC,0x08,0xFE,0x00,0x60,0x05,0xFE,0x43,0xE6,0x1F,0x18,0xC4,0x35,0x25,0xC0,0xFE,0x02,0x00,0x05,0xC4,
+0x08,0x36,0x1A,0x3B,0x0F,0x05,0xC4,0xAF,0x54,0x17,0x05,0xD2,0x22,0xA1,0xF7,0x09,0x9E,0xB9,0x29,0xC0,0x05,0x29,0xC3,0x05,0xC0,0x3D,0x0A,0xC1,0x05,0xC0,0x0A,0xC1,
+0xFE,0x52,0x26,0x59,0xA5,0x77,0x27,0xFE,0x08,0x20,0x5A,0xDB,0x15,0x1A,0x18,0xCC,0x0E,0xFE,0x01,0x60,0x05,0xB7,0x10,0x1A,0x18,0xC5,0x25,0x3B,0x28,0x05,0xC5,0xB5,
+0x20,0xB7,0x52,0x96,0x88,0x28,0x05,0xC4,0xAB,0x55,0x24,0x95,0xCC,0x05,0xD1,0x32,0x04,0xFE,0x8A,0x21,0x29,0x7E,0xA2,0x88,0x3D,0x29,0x3D,0x29,0xC0,0x66,0x29,0xC0,
+0x05,0xC2,0x3D,0x0A,0xC1,0x29,0x1D,0xC0,0x04,0x46,0x89,0xAF,0xDC,0x08,0xFE,0x6E,0x26,0x18,0xCD,0x3E,0xFE,0x00,0x40,0xAE,0x54,0x0D,0x18,0xC7,0x0E,0x2C,0x0A,0x05,
+0xC3,0x2B,0x31,0xA9,0x55,0x8F,0xCD,0x05,0xC0,0x19,0x05,0xC2,0x31,0x17,0x05,0xD2,0x3C,0xAB,0xA4,0xFE,0x99,0x61,0x3D,0x7E,0x6E,0x05,0xC0,0x3D,0x0A,0x29,0xC3,0x3D,
+0x29,0xC0,0x05,0x29,0x05,0xC0,0x13,0xA3,0x78,0xA8,0x85,0x99,0x89,0x8C,0x9E,0xDC,0xAF,0x33,0x36,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC7,0x92,0x9E,0x28,0x24,0xFE,0x76,
+0x09,0x18,0xC9,0x39,0x2C,0xFE,0x00,0x40,0x05,0xC3,0x10,0x24,0x95,0xCC,0x05,0xC4,0x2B,0x31,0x93,0xBC,0x05,0xD2,0x07,0xFE,0x8A,0x21,0xFE,0xA1,0x00,0x3D,0x7E,0xC0,
+0x6E,0xC1,0x9C,0x89,0x7E,0x05,0x29,0x05,0x31,0x05,0x0A,0x05,0xC0,0x0A,0x29,0x13,0xC0,0x27,0x3A,0x91,0x9D,0xDC,0xAB,0x44,0x0E,0x18,0xCD,0x99,0x9C,0xFE,0x02,0x00,
+0x99,0xDD,0x36,0x18,0xC5,0x9D,0x9A,0x18,0xC2,0x0D,0x12,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xC2,0xAB,0x55,0xA4,0x66,0x0F,0x05,0xC4,0xAA,0x66,0x4C,0x05,0xC3,0x6E,0x05,
+0xCC,0xAB,0x86,0xAE,0xA3,0xFE,0x99,0x61,0x31,0xA2,0x88,0x29,0x05,0xC1,0x29,0xC0,0x05,0x29,0x3D,0x29,0x05,0xC0,0x6E,0xC1,0x29,0xFE,0x4A,0x25,0x1D,0xAE,0x52,0x8D,
+0x9C,0x95,0x9D,0xDD,0xFE,0x3C,0x62,0x0D,0x18,0xCD,0x8A,0x9E,0x10,0xFE,0x65,0xA7,0x18,0xCC,0x2C,0x3B,0x06,0x05,0xC1,0x6E,0x2E,0xC0,0x93,0xCC,0x05,0xC3,0x2B,0xAA,
+0x55,0x0F,0x05,0xD2,0x07,0x35,0x09,0x9A,0xBA,0x6E,0xC4,0x24,0x29,0xC0,0xA3,0x98,0xC1,0x6E,0x05,0xC0,0x0A,0x13,0xC0,0x27,0x87,0xAF,0x9C,0x8A,0xDD,0xB8,0x10,0x1A,
+0x51,0x18,0xCC,0x0E,0xFE,0x02,0x00,0x36,0x18,0xC0,0x1A,0x18,0xC5,0x06,0x18,0xC3,0x97,0x9A,0xFE,0x23,0x03,0x17,0x05,0xC1,0xAB,0x55,0xA4,0x66,0x0F,0x05,0xC3,0x10,
+0x24,0x92,0xDD,0x05,0xD1,0xA6,0x87,0xB4,0x93,0xFE,0xA1,0x60,0xA1,0xA9,0xC1,0x6E,0x29,0xC4,0x05,0xC1,0x0A,0xC1,0x05,0x13,0xA5,0x77,0x27,0x1F,0x9C,0x8A,0xDD,0x2E,
+0xFE,0x65,0xA7,0x18,0xCD,0x0D,0x3E,0x36,0x18,0xC1,0x6F,0x18,0xC5,0x06,0x18,0xC4,0xFE,0x3B,0xE5,0x8C,0xBD,0x05,0xC1,0x10,0xA4,0x66,0x0F,0x05,0xC2,0x03,0xA8,0x31,
+0x0F,0x05,0xD2,0xB9,0x84,0xFE,0x99,0x61,0xA1,0xB8,0x0A,0x05,0xC0,0x29,0x66,0x29,0xC2,0x05,0xC1,0x0A,0xC0,0x05,0xC0,0x1D,0xA8,0x55,0x27,0x17,0x9D,0x9A,0xDD,0x2B,
+0xFE,0x54,0xE7,0xAD,0x62,0x18,0xCD,0x3B,0x0D,0x18,0xC1,0x6F,0x18,0xC6,0x06,0x18,0xC3,0x1A,0x98,0x88,0xFE,0x02,0x00,0x05,0xC1,0x31,0x9C,0x78,0x05,0xC1,0x6E,0xC0,
+0x2E,0x9B,0x88,0x05,0xC1,0x17,0x05,0xCE,0xB5,0x84,0xA0,0xF7,0xFE,0xB1,0x81,0xC1,0x3D,0x29,0xC3,0x7E,0x52,0x05,0xC0,0x3D,0xA2,0x87,0xC1,0x1D,0xA7,0x76,0x16,0xFE,
+0x08,0x20,0x5A,0xDE,0xFE,0x43,0xE6,0x1F,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC7,0x94,0x8B,0xA9,0x98,0x18,0xD2,0x0E,0x06,0x05,0xC1,0xAF,0x54,0x06,0x05,0xC1,0x6E,0xAA,
+0x55,0xA4,0x66,0x93,0xDD,0xA6,0x66,0x15,0xC1,0x10,0x06,0x10,0x9C,0x88,0x0F,0x05,0xC8,0xAF,0x84,0xA5,0xF7,0x29,0x3D,0x29,0xA3,0x98,0x29,0x3D,0x29,0x05,0xC0,0x29,
+0xC0,0x05,0x6E,0x05,0x0A,0x05,0xC0,0xFE,0x4A,0x25,0x1E,0x9F,0x96,0x88,0x8F,0xDF,0x31,0x0D,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC7,0x2C,0x9E,0x86,0x18,0xD3,0x8F,0xAD,
+0x28,0x05,0xC0,0x32,0x2E,0x05,0xC2,0x03,0xAE,0x30,0x2E,0x06,0x05,0xC1,0x6E,0xC0,0x03,0x10,0x2E,0x06,0x05,0xC3,0x0A,0x05,0xC1,0xB3,0x84,0x35,0x29,0xA3,0x98,0xC0,
+0x29,0x66,0x29,0xC0,0x05,0x6E,0x05,0x29,0xC0,0x05,0xC1,0x0A,0xC0,0x13,0x1E,0x9D,0x85,0xFE,0x00,0x20,0xDF,0x32,0xFE,0x54,0xE7,0x1F,0x18,0xCD,0x39,0x1A,0xC0,0x18,
+0xC5,0x9D,0x9A,0x18,0xC9,0x0D,0x08,0x0F,0x05,0xC0,0x31,0x9B,0x78,0x05,0xC0,0x2B,0x3F,0xA4,0x45,0x05,0xC1,0x03,0xA3,0x99,0xC1,0x15,0xC0,0x2E,0x06,0x05,0xC7,0x36,
+0x35,0x29,0xA3,0x98,0x51,0x05,0xC0,0x29,0xC0,0x05,0xC0,0x29,0x3D,0x05,0xC2,0x0A,0xC0,0xFE,0x52,0x26,0xA8,0x55,0x14,0x8D,0x9F,0xE0,0xB8,0x10,0x1A,0x51,0x18,0xCC,
+0x92,0x9B,0x1A,0x18,0xD3,0xFE,0x23,0x41,0xFE,0x00,0x60,0x05,0xC0,0x10,0x59,0x05,0x2B,0xAA,0x56,0x99,0x99,0x99,0xBB,0x0F,0x05,0x2E,0xC0,0x06,0x05,0x17,0x2B,0x45,
+0x05,0xC0,0x17,0x05,0xC5,0x2B,0xB6,0x83,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xC0,0x6E,0x05,0xC0,0x29,0xC0,0x3D,0x29,0xC1,0x05,0x29,0x3D,0x0A,0x05,0xC0,0x13,0x27,0x14,
+0x8D,0x9F,0xE0,0xAF,0x54,0xBB,0x41,0x1F,0x18,0xCC,0x92,0x9B,0x0D,0x18,0xD3,0xFE,0x1B,0x41,0x05,0xC1,0xAA,0x64,0x10,0x05,0x2E,0x98,0x99,0x05,0x3F,0xC0,0x10,0x06,
+0x10,0x28,0x10,0x28,0x05,0xC0,0x19,0x05,0xC7,0xA9,0x97,0xB2,0x73,0xFE,0x99,0x61,0xA1,0xB8,0x0A,0x05,0x0A,0xC1,0x9D,0x99,0x29,0xC2,0x05,0xC0,0x56,0x0A,0x29,0xC0,
+0x1D,0xAE,0x52,0x3A,0x91,0x9D,0xE0,0xA8,0x55,0xB7,0x53,0x1A,0x18,0xCC,0x25,0x6B,0x18,0xD3,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xC0,0x16,0xA6,0x24,0x10,0x19,0x05,0xC0,
+0x17,0x05,0x0F,0x05,0xC1,0x32,0x10,0x05,0xCA,0xB5,0x84,0xA4,0xC6,0x3D,0x7E,0x46,0x0A,0x05,0x0A,0x05,0xC0,0x29,0xC1,0x3D,0x29,0xC0,0x3D,0x05,0xC1,0xFE,0x4A,0x25,
+0xAE,0x63,0x91,0x9A,0x91,0x9F,0xE1,0xB8,0x21,0xB7,0x51,0x18,0xCC,0x0D,0x0E,0x18,0xD2,0x25,0x06,0x05,0xC1,0x03,0x08,0x28,0x05,0xC0,0xA4,0x66,0xA2,0xA9,0x26,0xC0,
+0x10,0x06,0x10,0xC0,0x24,0x28,0x05,0xC0,0x19,0x05,0xC5,0xA5,0x88,0xB6,0x82,0x9A,0xF9,0xFE,0xB1,0x81,0x0A,0xC0,0x05,0xC0,0x0A,0xC1,0x3D,0x29,0xC0,0x3D,0xC0,0x29,
+0xC0,0x3D,0xC0,0x0A,0x13,0x27,0x92,0x9C,0x91,0x9D,0xE1,0x37,0xFE,0x54,0xE7,0x1F,0x18,0xCC,0x39,0x1A,0x18,0xD1,0x8F,0xAD,0x28,0x05,0xC0,0x0F,0x38,0x37,0x99,0xBB,
+0x05,0xC3,0x0A,0x05,0xC2,0x10,0xA4,0x66,0x0F,0x05,0xC7,0x3A,0xAA,0xA5,0xFE,0x99,0x61,0xA2,0xA7,0xC2,0x66,0xC0,0x0A,0xC0,0x05,0x3D,0x29,0xC0,0x05,0x0A,0x05,0x29,
+0x05,0xC0,0x1D,0x27,0x8E,0x9C,0x95,0x9D,0xE1,0x2B,0xB3,0x22,0x1A,0x51,0x18,0xCB,0x92,0x9B,0x1A,0x18,0xD0,0x0D,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xC0,0xA8,0x55,0xA2,
+0x99,0x0F,0x05,0xC3,0x2B,0x3F,0xA4,0x45,0x19,0x05,0xC0,0x17,0x10,0x05,0xC7,0x2B,0xB6,0x83,0x35,0x29,0xA3,0x98,0x0A,0xC1,0x05,0xC0,0x0A,0xC1,0x3D,0x05,0xC0,0x3D,
+0x0A,0x29,0xC0,0x05,0xC0,0x1D,0x36,0x12,0x95,0x9D,0xE2,0xAF,0x33,0xFE,0x55,0x63,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC6,0x94,0x8B,0x0D,0x18,0xD0,0x39,0xFE,0x01,0x00,
+0x05,0xC1,0xAF,0x54,0x19,0x05,0xC0,0x17,0x05,0x0F,0x05,0xC1,0x03,0x13,0x10,0x06,0x10,0x06,0x37,0x05,0xC3,0x6E,0x05,0xC0,0xB0,0x74,0xA9,0xB5,0xFE,0x99,0x61,0xA2,
+0xA7,0xC2,0x66,0xC0,0x0A,0xC1,0x3D,0x05,0x0A,0x05,0xC0,0x0A,0xC1,0x3D,0x05,0x1D,0x36,0x8B,0x9D,0x17,0x9D,0x9A,0xE1,0x28,0xB7,0x42,0x1F,0x18,0xC5,0x9D,0x9A,0x18,
+0xC3,0x97,0x9A,0x0E,0xA4,0x88,0x59,0xC0,0x0A,0x0E,0x39,0x0E,0x39,0x0E,0x9D,0x87,0xC3,0x9D,0x9A,0xC2,0x95,0xBF,0x2E,0xC0,0x59,0x58,0xA5,0x66,0x9B,0xAB,0x24,0x9C,
+0xAA,0x99,0xAA,0xC0,0xA4,0x77,0x17,0x05,0xC4,0x15,0xC0,0x10,0x05,0xC3,0x6E,0x05,0x32,0xB6,0x82,0x04,0xFE,0xB1,0x81,0xC1,0x6E,0x05,0xC0,0x0A,0x29,0x05,0xC0,0x0A,
+0xC1,0x05,0x0A,0x05,0xC0,0x0A,0xC1,0xBB,0x67,0x6E,0xE7,0x56,0x97,0x88,0x7A,0x1A,0x3C,0x9D,0x88,0x7F,0x3C,0xC0,0x01,0xED,0x96,0x99,0x3C,0x01,0xDC,0x1D,0xC0,0xAA,
+0xA3,0x6B,0x9D,0x89,0x9B,0x99,0x9C,0x88,0x9C,0x8A,0x9A,0x8A,0x50,0x9D,0x9A,0xD4,0x7A,0xA5,0x77,0xA2,0x88,0x3A,0xA5,0x87,0xA3,0x87,0x24,0xA2,0x78,0xC1,0x9E,0x7C,
+0xC0,0x3C,0xC0,0x01,0x3A,0x39,0x01,0xC1,0xA1,0x85,0x3C,0x01,0xC1,0xA2,0x91,0x35,0x9F,0x9B,0xC0,0x3C,0x8A,0xA7,0xAC,0x76,0x24,0x35,0x3E,0x39,0x3C,0xA2,0x75,0x3C,
+0xC0,0x91,0xA5,0x1A,0x17,0x05,0xDF,0xAF,0x84,0xAC,0x87,0x9C,0x77,0x99,0x8E,0xFE,0xCE,0xB3,0xFE,0x10,0xC1,0xBF,0x84,0xBA,0x89,0x9D,0x98,0xA3,0x99,0x98,0x77,0x8A,
+0x89,0x89,0x9A,0x97,0x9C,0xE1,0xA5,0x87,0x39,0x17,0xB4,0x75,0x27,0x05,0xD3,0x17,0xFE,0xAD,0x8E,0x0E,0x59,0x0B,0x9C,0x89,0x97,0x88,0x95,0xAB,0x9A,0x87,0xC0,0x00,
+0x80,0x9C,0x3F,0xC0,0xA9,0xA7,0x3A,0x17,0xB6,0x85,0xB4,0x97,0xB1,0x79,0xC0,0x0E,0xC0,0x0B,0xC0,0x92,0x86,0x83,0x9B,0x05,0xE1,0x2B,0x0F,0x27,0x18,0x0B,0xC0,0x0E,
+0xC0,0x0B,0x0E,0x31,0x22,0x05,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0xC1,0x31,0x22,0x17,0x34,0x0B,0xC1,0x0E,0x0B,0xC3,0x0E,0xC0,0x0B,0x82,0x88,0x93,0x9A,0xFE,0xDE,0xF8,
+0xA8,0x77,0x0B,0xC3,0x0E,0x0C,0x1E,0x06,0x05,0xCE,0x6E,0x05,0xC7,0x7F,0x05,0xC6,0xAB,0x86,0x27,0x39,0x18,0x1D,0xC7,0x9B,0xBA,0x40,0x0B,0x7B,0x0B,0xC0,0x0E,0x0B,
+0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0x9A,0x99,0x1E,0xB2,0x85,0x0E,0xC1,0x0B,0xC0,0x39,0x27,0x18,0x1D,0x95,0xB9,0xB5,0x84,0x0F,0x1D,0x3C,0xC0,0x92,0xA8,0xFE,0x23,0x41,
+0x5A,0x38,0xBD,0xBB,0xA5,0x9A,0xC0,0x54,0x85,0x95,0x85,0x8A,0x05,0xDF,0xA4,0x86,0xFE,0x0B,0x41,0x9E,0xCB,0x15,0xB8,0xFF,0xAD,0xAD,0x95,0x76,0x30,0xBE,0x77,0x69,
+0x04,0xC0,0x0B,0x96,0x86,0x12,0x88,0x9A,0xB6,0x77,0x31,0x8E,0x84,0x8C,0x14,0xA1,0x65,0xA6,0xBB,0x2A,0x31,0xC1,0x8F,0x96,0x9B,0x74,0x83,0x9B,0x95,0x9D,0xDF,0x3A,
+0xA6,0x89,0xC6,0x13,0xA5,0x77,0x05,0xD9,0xA5,0x88,0x21,0x1B,0x31,0xC2,0x2D,0x30,0x58,0x37,0x1B,0x31,0x9E,0x75,0xFE,0x5B,0x4A,0x0B,0x30,0xBB,0x86,0x0B,0xC0,0x0E,
+0x04,0x92,0x87,0x0E,0x33,0x05,0xA2,0x9B,0x37,0xA9,0x88,0x04,0x0B,0xC1,0x92,0x86,0x0E,0x97,0x8A,0x95,0x89,0xB4,0x9B,0x0B,0xC0,0x0E,0x0B,0x93,0x89,0x2B,0xA3,0x89,
+0x0C,0x11,0x3D,0x1B,0x31,0xC0,0x05,0x37,0x2D,0xAB,0x97,0x0B,0x2B,0x1E,0x36,0x8B,0x9D,0xDF,0xA9,0x97,0x11,0x3D,0x12,0x0B,0xC1,0x0E,0x0B,0x9C,0x86,0x19,0x0B,0xC1,
+0x2D,0x33,0x11,0x33,0x12,0x0B,0xC1,0x04,0xC0,0x0B,0xC0,0x04,0x8F,0xA9,0x0B,0xC2,0x12,0x0B,0xC0,0x61,0x0B,0x04,0xC0,0x0B,0xC2,0x12,0x34,0xC0,0x0B,0xC1,0x0E,0x0B,
+0xC0,0x05,0x24,0x17,0x05,0xDB,0x3F,0xFE,0xB5,0xB2,0xB1,0x89,0x0B,0x04,0xC0,0x0B,0xC0,0x12,0x0E,0x0B,0xC2,0x0E,0x0B,0xC2,0x3A,0x0B,0x34,0x15,0x0B,0xC0,0x12,0x0B,
+0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x3D,0xFE,0x18,0xE2,0x05,0x06,0xC0,0x05,0xC0,0x14,0x05,0xDC,0x24,0x98,0x8A,0x6B,0x0B,0xC1,0x0E,0xC0,0x0B,0x0E,0x0B,0x61,0x0B,0x04,
+0xC0,0x0B,0xC3,0x04,0x0B,0xC0,0x04,0xC0,0x0B,0xC6,0x93,0x89,0x17,0x05,0xC0,0xA6,0x87,0x22,0x17,0x05,0xDD,0xB4,0x72,0x27,0xFE,0xF7,0xFA,0x61,0x0B,0xC0,0x04,0xC0,
+0x0B,0xC3,0x04,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x0B,0x3A,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0x3A,0x0B,0xFE,0x6B,0xAB,0x17,0x9D,0x9A,0xC1,0x22,0x05,0xDD,0x17,0x0F,0x22,
+0xFE,0xEF,0xBB,0x08,0x5A,0xDE,0x22,0xBA,0x97,0x0B,0xC1,0x0E,0x0B,0x04,0xC0,0x0B,0xC3,0x2A,0x36,0x05,0xC2,0x3F,0xA5,0x99,0x17,0x20,0x05,0xDA,0xB3,0x84,0xA8,0x84,
+0x90,0x8E,0xA1,0x9B,0xA2,0x77,0x5F,0x18,0x1D,0x05,0xD9,0xA6,0x87,0x1E,0x98,0x97,0x36,0x42,0xC1,0x69,0x26,0xFE,0xD6,0xD7,0x0B,0xC2,0x0E,0x0B,0x33,0x36,0x21,0x0D,
+0x64,0x2B,0x0C,0x9B,0x77,0x97,0x96,0xA4,0x9B,0x0D,0x6D,0xC1,0x0C,0xFE,0x42,0x28,0x08,0x05,0xC5,0x32,0x22,0x05,0xD9,0x22,0xA4,0x78,0x95,0xAD,0xC0,0x6E,0x3D,0xA2,
+0x77,0x10,0x0B,0xC1,0x97,0x9A,0x0C,0x12,0x7A,0x0E,0x0B,0xC2,0x0E,0x0B,0xC0,0x0E,0x9A,0x89,0xFE,0x42,0xA9,0x05,0xC8,0xA9,0x85,0xA2,0x87,0x95,0x9D,0xD8,0x0F,0x97,
+0x99,0xAC,0x87,0x91,0x9E,0xC1,0x24,0x06,0x3D,0xC0,0x02,0xA2,0x21,0x2C,0xA7,0x65,0x89,0xAD,0x05,0xE9,0xB5,0x84,0xA1,0x85,0x93,0xAF,0x99,0x79,0x05,0xA5,0x87,0xFE,
+0x55,0x63,0xA9,0x87,0xC0,0x67,0x18,0xC2,0x0A,0xC0,0xA6,0x89,0x18,0x1A,0xFE,0x1A,0xC1,0xFE,0x00,0x40,0x05,0xE5,0xA9,0x85,0x1E,0x0A,0x66,0xDC,0xB8,0x73,0x97,0x9C,
+0xAC,0x84,0x89,0x9C,0x05,0xE1,0xA5,0x87,0xA2,0x56,0xA4,0x77,0x7B,0x06,0x10,0x06,0x12,0xAD,0x62,0x18,0x1A,0x18,0xC1,0x99,0x9B,0x2B,0xAA,0x45,0xA4,0x77,0xA6,0x52,
+0xA5,0x87,0x45,0x13,0xA0,0x9A,0x10,0x06,0x10,0x0C,0xFE,0x55,0x25,0x18,0x1A,0x18,0x1A,0x18,0xC0,0x2C,0xFE,0x73,0xAD,0x58,0xAA,0x10,0x1A,0x18,0x0D,0x3E,0x24,0xA8,
+0x65,0x3B,0x12,0xA4,0x62,0x0E,0x06,0x10,0x9D,0x99,0x06,0x10,0xB0,0xB5,0x26,0xFE,0x00,0x20,0xDC,0x28,0x0C,0xFE,0x3C,0x62,0x0A,0x0D,0x1A,0x18,0x0D,0x3B,0x28,0x05,
+0xC0,0xA4,0x66,0x05,0xAF,0x33,0xB6,0x30,0x1A,0x18,0xC0,0x1A,0x18,0x25,0x2C,0x55,0xAC,0x75,0x1F,0x18,0xC0,0x39,0x0E,0x18,0xC3,0x15,0xFE,0x00,0x60,0x05,0xC1,0x37,
+0x0C,0x28,0x05,0xD5,0xB4,0x72,0x9C,0xAB,0x9C,0x7B,0xC0,0x32,0x27,0x8C,0x9D,0x97,0x9C,0xDA,0x24,0x0A,0x18,0xC1,0x1A,0x18,0xC1,0x1A,0x18,0x1A,0x29,0x19,0x05,0xC1,
+0xA9,0x97,0xFE,0x54,0xE7,0x9F,0x74,0x1A,0x18,0xC1,0x1A,0x18,0xC4,0x8F,0xAD,0xC0,0x0D,0x18,0xC0,0x1A,0x18,0x15,0x0F,0x05,0xC2,0xA7,0x78,0x10,0x05,0xD4,0xB7,0x74,
+0x99,0x99,0x9A,0x8C,0x3D,0x69,0x26,0x9F,0xB8,0xA0,0xA8,0xA0,0xC7,0x70,0x05,0xC2,0x39,0x1A,0x24,0xA7,0x89,0x18,0xC2,0x1A,0x18,0xC2,0x29,0x10,0x0E,0x18,0xC2,0x0E,
+0xFE,0x01,0x60,0x05,0xC3,0xAF,0x33,0x19,0x05,0xD3,0x07,0x92,0xFA,0x61,0xA0,0xC7,0xA2,0xA7,0xA1,0xA9,0x79,0xC0,0x62,0xFE,0x6E,0x26,0x18,0xC3,0x2C,0xFE,0x09,0x81,
+0x05,0xC0,0xB4,0x42,0xA6,0xD8,0x3A,0x05,0xDB,0x1C,0x18,0xCC,0xFE,0x0A,0xA0,0xFE,0x00,0x40,0x05,0x24,0xFE,0x65,0xA7,0x18,0xC2,0x8F,0xAD,0xAA,0x76,0xA4,0x87,0x18,
+0xC1,0x0E,0x19,0x05,0xC1,0xB5,0x20,0x36,0x18,0x1A,0x25,0xFE,0x01,0x60,0x05,0xC4,0xAF,0x54,0x28,0xB7,0xB4,0x8D,0x9C,0x05,0xDB,0x39,0x1A,0x18,0xCB,0x39,0x28,0x05,
+0xA5,0x87,0xFE,0x54,0xE7,0x1F,0x18,0xC2,0x25,0x50,0xA6,0x89,0x18,0xC0,0x3B,0x0F,0x05,0xC2,0x08,0xB7,0x52,0x18,0xC0,0x2C,0xFE,0x00,0x40,0x05,0xC3,0x10,0x24,0xAF,
+0x64,0x1F,0x18,0xC4,0x94,0x8B,0x25,0xC0,0xFE,0x02,0x00,0x05,0xC4,0x08,0x36,0x1A,0x3B,0x0F,0x05,0xC3,0x0A,0x2E,0x94,0xCB,0x05,0xD2,0xB3,0x84,0xA1,0xF7,0xFE,0xA9,
+0x61,0x2E,0x05,0x2E,0x0C,0x0A,0x05,0xC3,0xAB,0x55,0x24,0x05,0xA9,0x85,0xB0,0xA4,0xFE,0x99,0x61,0x33,0x29,0x3B,0xFE,0x09,0x81,0x95,0xDD,0xC1,0x0A,0xA9,0x77,0x2E,
+0x93,0xCC,0x05,0xC3,0x2B,0x31,0x0F,0x05,0x1A,0x98,0x88,0xFE,0x23,0x03,0x17,0x05,0xC1,0x10,0x24,0x0F,0x05,0xC3,0x10,0x24,0x05,0xCD,0xB9,0x84,0xFE,0x8A,0x21,0xFE,
+0xB1,0x81,0xFE,0x00,0x40,0x66,0xCB,0xB5,0x84,0xA0,0xF7,0xFE,0xB1,0x81,0x06,0x10,0x28,0x9B,0xBB,0x62,0xC8,0xB3,0x82,0x35,0x33,0xFE,0x6B,0x87,0x9D,0x98,0x05,0xDF,
+0x31,0x0D,0x18,0x1A,0x18,0xC1,0x1A,0x18,0xC7,0x99,0x9C,0x9E,0x86,0x18,0xD3,0x8F,0xAD,0x28,0x05,0xC0,0x32,0x2E,0x05,0xC2,0x03,0x08,0x9A,0x89,0x39,0x1F,0x18,0xCD,
+0x39,0x1A,0x18,0xC6,0x9D,0x9A,0x18,0xC9,0x0D,0x08,0x05,0xC1,0x31,0x9B,0x78,0x05,0xC0,0x2B,0x3F,0xA4,0x45,0x05,0xC1,0x03,0xA3,0x99,0xC0,0x55,0x31,0x99,0x9A,0x05,
+0x0F,0x05,0x2E,0xC0,0x06,0x05,0x2B,0xAC,0x94,0x05,0xE0,0xAF,0x53,0xBB,0x42,0x1F,0x18,0xCC,0x92,0x9B,0x0D,0x18,0xD3,0xFE,0x1B,0x41,0xFE,0x00,0x40,0x05,0xC0,0xAA,
+0x64,0x10,0x05,0x2E,0x28,0x05,0x2B,0x07,0x10,0x06,0x10,0x28,0x10,0x2B,0x0A,0x05,0xC0,0xA9,0x97,0xA6,0x24,0x10,0x99,0xAA,0x05,0xC0,0x0F,0xFE,0x54,0xE7,0x18,0xCD,
+0x39,0x1A,0x18,0xD1,0x8F,0xAD,0x28,0x05,0xC0,0x0F,0xAD,0x66,0x37,0x05,0xC4,0x0A,0x0F,0x05,0xC1,0x10,0x24,0x05,0xFE,0x23,0x41,0x1A,0x51,0x18,0xCB,0x92,0x9B,0x1A,
+0x18,0xCF,0x1A,0x0D,0x13,0x05,0xC1,0x37,0xA2,0x99,0x0F,0x05,0xC3,0x2B,0x3F,0xA4,0x45,0x19,0x05,0x0A,0xA2,0x87,0x10,0x05,0x28,0x24,0x0E,0x24,0xC3,0x12,0xC2,0x95,
+0xBF,0x2E,0xC0,0x59,0x13,0xA5,0x66,0x9B,0xAB,0x24,0x9C,0xAA,0x99,0xAA,0xC0,0x37,0x17,0x05,0xC1,0x17,0xB2,0x46,0x76,0x9C,0xA9,0x40,0x6B,0xA4,0x87,0xA3,0x78,0xA3,
+0x99,0xA3,0x88,0x7F,0xA2,0x88,0x6E,0xD8,0x19,0xC0,0x00,0x18,0xC0,0x26,0xC0,0x18,0x00,0x19,0x28,0xA2,0x78,0x3C,0xC0,0x01,0xD4,0x3C,0x01,0xC0,0x19,0x00,0x19,0x18,
+0x3D,0x26,0x3D,0x18,0x00,0xC0,0x28,0xC0,0x39,0x3C,0xC1,0x01,0xC1,0x3C,0xC3,0x01,0xCB,0x3C,0x01,0xC1,0x3C,0x39,0x3C,0x28,0x19,0x00,0x18,0x3D,0xA4,0x74,0xA3,0x99,
+0xA5,0x87,0xC0,0xA3,0x98,0xA2,0x77,0xC2,0x47,0xA0,0xA9,0x47,0xC1,0x3C,0xC0,0x01,0xC2,0x3C,0x01,0xC2,0x3C,0x01,0xC3,0x07,0x3C,0x39,0x01,0xC3,0x28,0x01,0xC7,0x3E,
+0x3A,0xA2,0x95,0xC1,0x62,0x2B,0x52,0x0F,0xC3,0x9E,0x85,0x9D,0x9A,0xC0,0xA4,0x77,0x6B,0xC1,0xA4,0x96,0xC1,0xA2,0x78,0xA2,0x78,0x35,0x3C,0xC0,0x47,0x3A,0xC0,0x67,
+0x01,0xC0,0x3C,0xC0,0x01,0xC2,0x00,0xC0,0x3C,0x01,0xCA,0x3E,0x2B,0x1E,0x39,0x9D,0x99,0x9B,0x9A,0x9C,0x8A,0x50,0x9C,0x8B,0x7E,0x9D,0x88,0x9D,0x9A,0xC1,0x6E,0xC1,
+0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x0A,0xC0,0x05,0xA4,0x86,0xA3,0x87,0x20,0xA4,0x86,0xA4,0x88,0x0F,0x16,0xC0,0x27,0x35,0x6B,0x35,0x9E,0x7C,0xC0,0x67,0xC0,0x01,0x56,
+0x18,0x3C,0x39,0x01,0xC6,0x3E,0x2B,0x9C,0x79,0x06,0x20,0x9A,0x89,0x9B,0xAA,0x05,0x0A,0x05,0xCD,0x0A,0x05,0x0A,0x05,0xC0,0x0A,0x05,0xC4,0x17,0x31,0x20,0xA4,0x86,
+0x22,0x0F,0x16,0x35,0x07,0x06,0x9E,0x8B,0xC1,0x01,0xC4,0x3E,0x64,0x1E,0x9B,0x87,0x95,0x9B,0x17,0x9D,0x9A,0xE6,0x31,0x3A,0x22,0xA8,0x86,0x16,0x0F,0xA1,0x8B,0xA2,
+0x78,0x01,0x3C,0x01,0xC0,0x3C,0xA2,0x74,0x0F,0x06,0x97,0x99,0x05,0x0A,0x05,0xEB,0xA5,0x87,0xA9,0x97,0xA9,0x74,0x6B,0x35,0x47,0x9E,0x8C,0x7A,0xC1,0x01,0xC7,0x3C,
+0x39,0x01,0xC1,0x19,0x3D,0xC0,0x1D,0xC2,0x01,0xC0,0x31,0x93,0xB9,0x17,0x05,0xF3,0xAB,0x84,0x32,0x27,0xA2,0x78,0x9C,0x8E,0xC0,0x3C,0x01,0xCA,0x19,0x93,0xAA,0x3D,
+0xC0,0x1D,0xC2,0x01,0xC0,0x1E,0x05,0xF7,0xA7,0x85,0x20,0x24,0x35,0x3A,0xC0,0x3C,0x01,0xC7,0x19,0x3D,0x40,0x1D,0xC4,0x01,0xC0,0x1E,0x0A,0xC0,0x05,0xF7,0x2B,0xA9,
+0x97,0x24,0x35,0x47,0x3E,0x9E,0x7B,0xC1,0x01,0xC2,0x19,0x3D,0x1F,0x1D,0xC5,0x01,0xC0,0x1E,0x0A,0x05,0xC3,0x0A,0x05,0xF4,0x2B,0xA9,0x97,0x24,0x38,0x35,0x9D,0x8E,
+0xC0,0x01,0xC1,0x19,0x26,0x1D,0xC7,0x01,0xC0,0x1E,0x0A,0x05,0xFD,0x06,0x27,0x38,0x3A,0x3C,0x01,0x28,0x26,0x07,0x1D,0xC7,0x01,0x3C,0x0F,0x05,0xC0,0x0A,0x05,0xFC,
+0xA7,0x87,0xAF,0x82,0x38,0x35,0x3C,0x90,0x99,0x07,0x1D,0xC8,0x01,0x3C,0x9B,0xA5,0x0A,0xC0,0x05,0xFC,0x0A,0x05,0xC0,0xAF,0x84,0x16,0xC0,0x94,0x6E,0x1D,0xC9,0x01,
+0x3C,0x36,0x05,0x0A,0x05,0xFD,0xC2,0x2B,0x0F,0x16,0x20,0x1A,0xC0,0x1D,0xC6,0x01,0x3C,0x06,0x05,0x0A,0x05,0xFD,0xC4,0xAE,0x85,0x24,0x0F,0x1A,0xC0,0x1D,0xC5,0x01,
+0xC0,0x3C,0x05,0x0A,0x05,0xCE,0xAB,0x86,0x0F,0x12,0x05,0xC0,0x0A,0x05,0xED,0x3F,0xAF,0x82,0x24,0x98,0x5A,0x1D,0xC5,0xAA,0x87,0xC0,0x8E,0xA7,0x17,0x9D,0x9A,0xCF,
+0xA6,0x87,0xBE,0x73,0xA4,0x87,0x22,0x94,0x89,0x05,0xF0,0x22,0x27,0x97,0x9B,0x1A,0x1D,0xC3,0x01,0xA1,0x85,0x88,0xBB,0x05,0xD1,0xFE,0x8C,0x6C,0xB9,0x88,0x99,0x87,
+0x36,0x8D,0x89,0x17,0x05,0xC2,0x3C,0x06,0x97,0x99,0x05,0xC0,0x0A,0x05,0xE5,0x06,0x24,0x0F,0x1A,0xC0,0x1D,0xC1,0x01,0x1E,0x05,0xD2,0xB5,0x84,0xFE,0xE7,0x76,0xA4,
+0x8A,0x2B,0x90,0x86,0x22,0x17,0x05,0xC1,0xAB,0x86,0xBA,0x85,0xAB,0x87,0x90,0x8A,0x3C,0x05,0x0A,0x05,0xC5,0x0A,0x05,0xDD,0x20,0xAD,0x86,0x54,0x1A,0xC0,0x1D,0xC0,
+0x01,0x1E,0x05,0xC0,0x0A,0x05,0xCF,0x20,0x19,0xAA,0x9A,0xC1,0x19,0x87,0x9A,0x8B,0x9D,0x17,0x05,0xC0,0x36,0x19,0x0E,0x19,0x1F,0x3C,0x17,0x05,0xD7,0x0A,0x05,0xCB,
+0xA9,0x85,0x0F,0x16,0x98,0x5C,0x1D,0xC0,0xA9,0x99,0x99,0xA6,0x0A,0x66,0xD1,0xA5,0x87,0xFE,0xBD,0xD1,0x0E,0xC2,0x96,0x76,0x8B,0x99,0x8A,0x8B,0x17,0x9D,0x9A,0x2B,
+0x1F,0xBB,0x98,0x0B,0x2B,0x96,0x79,0x1F,0x12,0x05,0xE5,0xA5,0x87,0x0F,0x16,0x98,0x5C,0x1D,0x3C,0x06,0x05,0xD3,0x21,0xB6,0x89,0x0E,0xC2,0x15,0x88,0x9A,0x12,0x05,
+0xC0,0xAE,0x85,0x31,0x04,0x0E,0x5A,0x9D,0x98,0x22,0x86,0x79,0x17,0x05,0xC0,0x0A,0x05,0xD6,0x0A,0x05,0xC9,0x39,0x24,0x19,0x01,0x69,0x20,0x05,0x0A,0x05,0xD1,0x1F,
+0x2B,0x0E,0xC3,0x15,0x00,0x12,0x05,0xC0,0xBB,0x84,0x15,0x0B,0x0E,0xC1,0x98,0x77,0x1F,0x12,0x05,0xC0,0x0A,0x05,0xE2,0x22,0x27,0x97,0x9B,0x1A,0x1D,0xC2,0x3A,0x3E,
+0x8D,0x99,0x17,0x9D,0x9A,0xD2,0xB5,0x84,0x15,0x0B,0x0E,0xC3,0x2B,0x00,0x12,0x05,0xA9,0x85,0x21,0x04,0x0B,0x0E,0xC1,0x2B,0x21,0x06,0x90,0x9C,0xC1,0x0A,0x7B,0x05,
+0xCA,0x0A,0x05,0xD3,0x22,0x27,0x20,0x18,0x1D,0xC1,0x01,0x0F,0x05,0xC0,0x0A,0x05,0xD1,0x06,0x34,0x0B,0x0E,0xC4,0x2B,0x00,0x85,0x9B,0x17,0x36,0xBF,0x86,0x0B,0x2B,
+0x19,0x0E,0xC0,0x04,0x19,0x83,0x8B,0x8D,0xAB,0x9C,0x8A,0xE4,0x06,0x24,0x20,0x1D,0xC1,0xA9,0x99,0x29,0x05,0x0A,0x05,0xD2,0x3F,0x19,0x0E,0xC0,0x2B,0x91,0x9A,0x94,
+0x89,0x9C,0x8A,0xC0,0x30,0x32,0x69,0x8C,0x8A,0x9E,0x8B,0xFE,0x9D,0x2D,0xB0,0x9B,0x92,0x79,0xAC,0x98,0x0B,0x0E,0x04,0x0B,0x96,0x86,0x2B,0x31,0x05,0xC1,0x0A,0x05,
+0xE0,0x22,0x27,0x20,0x18,0x1D,0x01,0x06,0x05,0xD4,0xA6,0x87,0xFE,0xBD,0xD1,0x0E,0x8E,0x89,0x83,0x8B,0x05,0xC0,0x0A,0x05,0xC1,0xAE,0x85,0x36,0x1F,0x29,0x69,0x30,
+0x0B,0xC0,0x0E,0xC0,0x04,0x0B,0x9A,0x99,0x8A,0x87,0x12,0x0A,0x05,0xE3,0x07,0xA4,0x94,0x18,0x1D,0xAB,0x85,0x12,0x05,0xD5,0x36,0x9A,0x8C,0x3A,0xB1,0x68,0x00,0x21,
+0xA5,0x78,0xA2,0x8A,0xA2,0x97,0xC0,0x0B,0x21,0x8F,0x88,0x3A,0xBA,0x74,0xBB,0x98,0x0E,0x5A,0xC4,0x15,0x36,0x89,0x8B,0x05,0xE3,0xA5,0x87,0x24,0x9D,0x8A,0x1A,0x01,
+0xC0,0x66,0x0F,0x8C,0x9B,0x05,0xD5,0x1E,0x3E,0xB5,0x88,0xAB,0xA8,0xA2,0x78,0x0E,0xC0,0x0B,0xC3,0x34,0x0F,0xC0,0xFE,0xE7,0x38,0x0E,0x04,0x0B,0xC4,0x0C,0x85,0x86,
+0x12,0x05,0xD9,0x17,0x05,0x0A,0x05,0xC5,0xA9,0x97,0x27,0x97,0x9B,0x18,0x1D,0xC3,0x99,0xAA,0x69,0x01,0xC1,0x9C,0x92,0x05,0x0A,0x05,0xD4,0xFE,0x7C,0x2B,0xBB,0x98,
+0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x04,0x0B,0xC1,0x96,0x86,0x29,0xBA,0x96,0x0E,0x0B,0xC4,0x2B,0x81,0x8B,0x8F,0x99,0x0F,0x91,0x9A,0x17,0x9D,0x9A,0xE2,0xB0,0x95,
+0x24,0x18,0x1D,0xC1,0x26,0x69,0xA2,0x99,0xA4,0x88,0x01,0xC0,0x3E,0x06,0x05,0xD6,0xFE,0x7C,0x2B,0x2B,0x0E,0x0B,0xC9,0x22,0x92,0x77,0x3A,0x0B,0xC0,0x0E,0xC0,0x0B,
+0x0E,0x30,0x05,0xC0,0x29,0xAA,0x76,0x8C,0x9A,0x17,0x9D,0x9A,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xC2,0x0A,0x05,0xC6,0x0F,0xC0,0x02,0x9B,0xAA,0xC0,0xA5,0x79,0x25,0xC1,
+0x01,0xC0,0x3E,0x8D,0x99,0x17,0x9D,0x9A,0xD5,0xBB,0x84,0x15,0xA0,0x8B,0x9C,0x99,0xA2,0x87,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x04,0x0B,0xC0,0x8A,0x86,0xAC,0x88,
+0x0E,0xC0,0x0B,0xC1,0x22,0xFE,0x10,0xC1,0xB7,0x87,0xB5,0x87,0x3A,0x9C,0x89,0x87,0x86,0x8A,0x8B,0x97,0x9C,0x0A,0x05,0xE0,0x16,0x27,0x06,0x9D,0x9C,0x25,0xC3,0x28,
+0xA2,0x78,0x7A,0xC1,0x01,0xC0,0x3C,0x01,0xC5,0x3C,0x01,0xC0,0x1E,0x8B,0x9B,0x05,0xD6,0x1E,0x32,0x26,0x9B,0x98,0x7E,0xA9,0x88,0x30,0xB5,0x88,0xA9,0x88,0x69,0x0E,
+0xC0,0x0B,0x0E,0xC0,0x19,0x21,0x04,0x0B,0x0E,0x04,0x19,0x29,0xBA,0x99,0x0B,0xC2,0x34,0x1E,0x05,0xC1,0x0A,0x05,0xDF,0xB5,0x84,0x24,0x18,0x25,0xC3,0x26,0xC0,0xA4,
+0x87,0x18,0xA4,0x88,0xC0,0xA3,0x88,0x01,0x3C,0xA2,0x75,0x01,0xC5,0x3C,0x29,0x05,0xC0,0x0A,0x05,0xD4,0xB7,0x74,0xA2,0x8A,0xAD,0xA9,0xC0,0x96,0x89,0x90,0x88,0x05,
+0xA8,0x88,0x33,0xB6,0x77,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x22,0xAD,0x77,0x0B,0xC0,0x04,0x8E,0x9A,0x3D,0x12,0x0B,0xC1,0x15,0x8A,0x89,0x07,0x9D,0x97,0x8C,0x9E,0xC0,
+0x0A,0x05,0xDF,0xA9,0x85,0x27,0x20,0x25,0xC3,0x26,0xA4,0x87,0x62,0x07,0x36,0x9C,0x89,0x26,0x55,0x3D,0x07,0x1D,0xA3,0x99,0xC0,0x01,0xC0,0x39,0x3C,0x01,0x94,0xA5,
+0x94,0x8B,0x9D,0x9A,0xD6,0x1E,0xBF,0x99,0xA6,0x8C,0xC1,0x9B,0x87,0x8D,0x98,0x15,0x14,0x33,0xB6,0x77,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x19,0x0B,0xC0,0x9D,0x98,0x99,
+0x87,0x0B,0xC2,0x93,0x89,0x25,0x90,0x88,0x25,0xB0,0x73,0x8E,0x9A,0x17,0x05,0xE1,0xB7,0x74,0xA4,0x94,0x25,0xC3,0x26,0xA4,0x87,0x36,0x3D,0x26,0x07,0x36,0x3D,0xC1,
+0x07,0x36,0x26,0x69,0x26,0x36,0x18,0xA7,0x95,0x8D,0xAB,0x05,0xD7,0x1E,0xBF,0x99,0x31,0xC3,0x97,0x85,0x00,0x14,0x33,0x12,0x69,0xC0,0x0E,0xC0,0x0B,0x0E,0xC1,0x96,
+0x76,0x2B,0x0B,0xC1,0x34,0x3C,0x36,0x37,0xAC,0x79,0xC0,0x89,0x95,0x85,0x8A,0x05,0xE1,0xAB,0x86,0xB3,0x83,0x95,0x9D,0x25,0xC2,0x9C,0x88,0x26,0xA4,0x87,0x61,0x3D,
+0xC1,0x26,0x07,0x3D,0xC3,0x26,0x07,0x3C,0xA7,0x87,0x17,0x05,0xD7,0xB7,0x74,0xFE,0xE7,0x38,0xA6,0x8C,0xC4,0x33,0x80,0x77,0x8D,0xAA,0x37,0x0B,0xC0,0x0E,0x0B,0x0E,
+0x0B,0x0E,0x04,0x92,0x87,0x04,0x0B,0xC0,0x2B,0xFE,0x4A,0x86,0xA4,0x6A,0xBF,0xB7,0xA8,0x8B,0xC1,0x97,0x85,0x1E,0x05,0xE2,0x24,0x9D,0x8A,0x1A,0x25,0xC1,0x9C,0x88,
+0x26,0xA4,0x87,0x61,0x3D,0xC9,0x26,0x29,0x69,0x05,0xC0,0x0A,0x05,0xD5,0x0F,0xFE,0xE7,0x38,0x31,0xC5,0x33,0xFE,0x4B,0x0A,0x00,0x33,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,
+0x9A,0x89,0x9C,0x75,0x0E,0xC0,0x0B,0x88,0x9B,0x18,0x0C,0x31,0xC3,0x21,0x83,0x88,0x17,0x05,0xE0,0x22,0x27,0x25,0xC0,0x00,0x3D,0x26,0x07,0x36,0x3D,0xCB,0xA9,0x84,
+0x20,0x05,0xD8,0x0F,0xFE,0xE7,0x38,0x31,0xC3,0x9E,0x75,0x99,0x98,0xA4,0x8A,0x3D,0x26,0x11,0xB4,0x97,0x0B,0x0E,0xC0,0x0B,0x0E,0x34,0xA4,0x87,0x0B,0x0E,0x19,0xFE,
+0x3A,0x06,0x37,0x33,0xC0,0x0B,0x31,0xC1,0x33,0x87,0x85,0x87,0x9A,0x99,0x9C,0xE0,0xA9,0x85,0x27,0x13,0x25,0x02,0x9B,0x99,0xA4,0x88,0xC9,0x26,0x3D,0xC0,0x26,0x3D,
+0xAC,0x73,0x8C,0x9B,0x9C,0x8A,0xD8,0xB7,0x74,0x2A,0xA4,0x9C,0xC2,0x2D,0x8C,0x32,0x9A,0x55,0xA5,0xBB,0xB3,0xED,0x21,0x80,0x8B,0x2A,0xA4,0x88,0x69,0xC0,0x04,0x0E,
+0x96,0x76,0x2B,0x0B,0x0E,0x11,0x92,0x88,0xB5,0x87,0x1D,0x9B,0x76,0xAD,0xCD,0xB6,0xCC,0x31,0xC1,0x0B,0x06,0x90,0x9C,0xE1,0x1E,0x22,0x02,0x9B,0x99,0xC0,0x3D,0xCC,
+0x26,0xA5,0x97,0x22,0x17,0x05,0xD8,0x1E,0x2B,0x31,0xC1,0x54,0x38,0x9B,0x44,0x98,0x99,0xA6,0x76,0x1D,0x2A,0x82,0x89,0x11,0xB4,0x97,0x59,0x0E,0xC0,0x0B,0x96,0x86,
+0x0E,0xC0,0x2B,0xFE,0x4B,0x0A,0x2D,0x89,0x76,0x98,0x23,0x97,0xDE,0xAC,0x54,0xBA,0xEC,0xAD,0xAD,0xC1,0x33,0x84,0x74,0x17,0x9D,0x9A,0xE0,0xB0,0x95,0x16,0xFE,0x21,
+0x64,0x56,0x76,0x3D,0xCC,0x26,0x29,0x3A,0x94,0x8B,0x05,0xD8,0x1E,0xFE,0xEF,0xBB,0x31,0xC1,0x1B,0xFE,0x5B,0xA9,0x3E,0xFE,0x00,0xA0,0xAB,0x66,0xAA,0x41,0x0C,0x55,
+0x29,0x05,0xA2,0x86,0x0E,0x04,0x0B,0x96,0x86,0x2B,0x0B,0x3D,0x87,0x89,0x33,0x31,0x3E,0x06,0xAC,0x54,0x21,0xB2,0x8C,0xC0,0x1B,0x3D,0x8D,0x97,0x3A,0x91,0x9D,0xE0,
+0x3A,0x16,0x3F,0xA1,0x9A,0xC0,0xA4,0x88,0xCD,0xAC,0x73,0x93,0x99,0x05,0xD9,0xBB,0x84,0xFE,0xEF,0xBB,0x31,0xC2,0x8A,0x33,0x91,0x42,0x3E,0x12,0x1D,0x05,0x31,0x30,
+0xB5,0x88,0x0B,0x0E,0xC0,0x0B,0x96,0x86,0xA6,0x88,0x0B,0x11,0x37,0x31,0x21,0x8D,0x01,0x12,0x1D,0x05,0x31,0xC1,0x88,0x86,0xB2,0x86,0x32,0x08,0x5A,0xDF,0xA9,0x97,
+0x27,0x16,0x57,0xC0,0xA4,0x88,0x69,0x3D,0xCB,0x0F,0x8C,0x9B,0x05,0xD9,0x32,0xFE,0xEF,0xBB,0x31,0xC2,0x9B,0x87,0x8D,0x98,0x96,0x55,0x30,0xB5,0x88,0xA9,0x9C,0xC0,
+0x2D,0x11,0xB4,0x97,0x0B,0xC0,0x0E,0x34,0xC0,0x0B,0x30,0xB9,0x8A,0x31,0x1B,0x3D,0x2D,0x33,0x31,0xC1,0x0C,0x9B,0x77,0xAB,0xA8,0x84,0x78,0x8B,0x99,0x95,0x9D,0xDF,
+0x3F,0x35,0x92,0x98,0x3F,0xA1,0x9A,0xA4,0x88,0xCC,0x29,0x22,0x05,0xDA,0x3C,0xBF,0x9B,0x31,0xC4,0x1B,0xC0,0x31,0xC1,0x1B,0x30,0xBE,0x76,0xC2,0x9C,0x86,0x9A,0x88,
+0x0E,0x30,0x31,0xC6,0x33,0x8D,0x98,0x05,0x9C,0x97,0x29,0x13,0x90,0x7B,0xDF,0xA6,0x87,0x27,0x2C,0x3F,0xA1,0x9A,0xA4,0xB8,0xC1,0x02,0xC2,0x3D,0xC5,0x0F,0x12,0x05,
+0xC3,0x0A,0x05,0xD4,0x32,0x2A,0x31,0xCA,0x33,0x04,0x0E,0x0B,0xC0,0x2B,0x92,0x98,0x0E,0x33,0x19,0x31,0xC4,0x1B,0x11,0x0C,0xA8,0x87,0x97,0x89,0x3F,0xAC,0x85,0x17,
+0x05,0xDE,0x3A,0x27,0x2C,0x99,0x9F,0xC0,0x06,0x7A,0x06,0xC1,0x09,0x06,0xC0,0x1A,0x02,0x66,0xC1,0xA3,0x87,0xA9,0x85,0x05,0xDB,0x32,0x33,0x19,0x31,0xC7,0x1B,0x11,
+0xC0,0xB4,0x97,0x0B,0xC0,0x0E,0x04,0x92,0x87,0xAC,0x9A,0x0B,0x37,0xC0,0xAC,0x79,0x1B,0xA1,0x9A,0x1B,0x98,0x86,0x91,0x9A,0x19,0x0B,0xC0,0x21,0x05,0xB5,0x84,0x8F,
+0x9B,0x05,0xDE,0xA6,0x87,0x27,0x2C,0x99,0x9F,0x3F,0x06,0x09,0x06,0x09,0xC0,0x06,0x09,0xC1,0x06,0xC2,0x36,0x22,0x17,0x05,0xDA,0xFE,0x8C,0x6C,0x2B,0x96,0x79,0x33,
+0x2D,0xA6,0x99,0x31,0xC0,0x1B,0x33,0x3D,0x11,0xC0,0x0C,0xA8,0x76,0x0E,0x04,0x0B,0xC1,0x34,0xC0,0x0B,0x6B,0x2B,0x96,0x79,0x21,0x9A,0x8A,0xC0,0x2D,0xA6,0x99,0x12,
+0x69,0xC0,0x88,0x9B,0x05,0xB0,0x74,0x65,0x17,0x05,0xDD,0xA6,0x87,0x27,0x20,0x15,0x3F,0x09,0xC1,0x5A,0x09,0x06,0x09,0xC1,0x06,0x09,0xC0,0x06,0xAB,0x64,0x92,0x79,
+0x17,0x9D,0x9A,0xDA,0xFE,0x8C,0xAC,0x04,0x0E,0x0B,0x2D,0x11,0x33,0xC0,0x11,0xC0,0x0C,0xA6,0x78,0x0B,0x0E,0x0B,0xC5,0x8F,0xA8,0x0E,0x0B,0xC0,0x12,0xC0,0x0B,0x12,
+0x0B,0x12,0x0B,0xC1,0xFE,0x6B,0xAB,0x84,0x9B,0x15,0xAB,0x84,0x17,0x05,0xDD,0x3F,0x35,0x8E,0x9A,0x15,0xC0,0x09,0xC1,0x06,0x09,0xC1,0x06,0x09,0xC1,0x06,0xC0,0x0F,
+0x05,0xDB,0xA5,0x87,0x00,0x04,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0x6B,0xC0,0x0B,0xC5,0x0E,0x04,0x0B,0xC0,0x92,0x86,0xAB,0x9A,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,
+0xC0,0x2B,0xFE,0x3A,0x06,0x05,0xA5,0x88,0x07,0x05,0xC0,0x0A,0x05,0xDB,0x16,0x27,0x8E,0x9C,0x15,0xC0,0x09,0xCA,0x0D,0x9A,0x87,0x05,0x6E,0x05,0xD9,0x3A,0x00,0x04,
+0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0xC5,0x0E,0x0B,0xC2,0x0E,0xC0,0x9C,0x76,0x97,0x8B,0xAB,0xA8,0x0E,0x04,0x6B,0xC5,0x3D,0x32,0x05,0xC0,0xB5,0x84,0x17,0x05,0xDD,0xB0,
+0x94,0x24,0x18,0x98,0xA9,0xC0,0x09,0xC1,0x06,0x09,0xC3,0x06,0x09,0xC0,0xB0,0x13,0x8D,0xBA,0x17,0x9D,0x9A,0xDA,0xA6,0x87,0xFE,0x9D,0x2D,0x04,0x0B,0x0E,0xC0,0x04,
+0x0B,0xCA,0x0E,0x0B,0xC0,0x96,0x86,0x2B,0x0B,0x0E,0x04,0x0B,0xC5,0x33,0x17,0x05,0xC0,0x07,0x1F,0x05,0xDD,0xB8,0x73,0xC0,0x25,0xC0,0x02,0x9C,0xC9,0xC0,0x06,0xC4,
+0x09,0xC1,0xA7,0x77,0xA5,0x63,0x05,0xC0,0x0A,0x05,0xD9,0x3A,0xFE,0xAD,0x8E,0x0B,0xC1,0x0E,0x59,0x0B,0xCB,0x0E,0x19,0x2B,0x0B,0x0E,0xC0,0x04,0x0B,0xC5,0xFE,0x5B,
+0x4A,0x05,0xC1,0x22,0x94,0x89,0x05,0xDC,0x3A,0x27,0x36,0x25,0xC1,0x2D,0xC8,0x06,0x0D,0x99,0x79,0x05,0xDC,0x16,0x3D,0x0B,0x0E,0x04,0x0B,0x0E,0xC1,0x0B,0xC5,0x0E,
+0x0B,0xC1,0x34,0x2B,0x0B,0xC8,0x0E,0x97,0x8A,0x3F,0x05,0xC1,0x06,0x31,0x05,0xDC,0xAF,0x84,0xAC,0x87,0x25,0xC2,0x2D,0xC9,0x1E,0x1F,0x05,0xDC,0x20,0xFE,0xBD,0xD1,
+0x0E,0x0B,0xC7,0x0E,0x0B,0xC7,0x0E,0x0B,0xC8,0x86,0x87,0x05,0x0A,0x05,0xC0,0xAE,0x85,0x53,0x05,0xDC,0x1E,0x9E,0x75,0x26,0xA4,0x87,0x02,0x25,0x2D,0xC3,0x69,0x2D,
+0xC2,0xAC,0x43,0xA1,0x85,0x05,0x0A,0x05,0xDB,0x20,0x22,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC6,0x0E,0x0B,0xC3,0x6B,0xC0,0x0B,0xC1,0x12,0x0B,0x04,0xC0,0x0B,0x0E,0x2A,
+0xFE,0x3A,0x06,0x05,0xC2,0x20,0x3A,0x05,0xC0,0x0A,0x05,0xD8,0x16,0x27,0x96,0x9D,0x07,0x62,0x41,0x69,0x2D,0xC8,0xAF,0x51,0x91,0x8C,0x17,0x9D,0x9A,0xDC,0x20,0xFE,
+0xBE,0x54,0xAB,0xA8,0x0E,0x5A,0xC2,0x69,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0x95,0x8B,0x89,0xAA,0x29,0x33,0xB2,0x86,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0xC0,
+0x11,0x05,0xC0,0x0A,0x05,0xC0,0xA9,0x97,0xA6,0x75,0x17,0x05,0xDA,0x36,0xA3,0x88,0x1A,0x7A,0xC2,0x98,0xEA,0xC2,0x69,0x2D,0xC0,0x26,0x2D,0x13,0xA8,0x74,0x05,0xDE,
+0x3C,0xFE,0xBE,0x31,0x0B,0x0E,0x0B,0x69,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0xC4,0x33,0xFE,0x10,0xC2,0x05,0xC1,0xBC,0x75,0x2A,0x12,0x0B,0x0E,0xC0,0x0B,0x0E,0x9D,0x88,
+0xFE,0x3A,0x06,0x91,0x9A,0xC3,0xA9,0x85,0x3A,0x17,0x9D,0x9A,0xD9,0x20,0x27,0x36,0x1D,0xC3,0x2D,0xC2,0x26,0x2D,0xC0,0x26,0x2D,0x36,0x9C,0x97,0x05,0xDE,0x3C,0xFE,
+0xBE,0x54,0xAB,0xA8,0x0E,0x5A,0xC0,0x04,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC0,0x2B,0x30,0x05,0xC4,0xBC,0x87,0xFE,0xF7,0xDB,0x0B,0xC3,0x11,0x05,0xC0,0x6E,
+0x05,0xC1,0xA9,0x85,0xA6,0x87,0x91,0x9D,0x0A,0x05,0xD8,0xB8,0x73,0xA3,0x95,0x18,0x1D,0xC3,0x2D,0xC2,0x26,0x2D,0xC0,0x26,0x2D,0xAF,0x51,0x91,0x8C,0x97,0x9C,0xDE,
+0x06,0xBB,0x95,0x0B,0x0E,0xC0,0x59,0x0B,0xC7,0x2B,0x30,0x05,0xC4,0xA5,0x87,0x14,0xFE,0xB5,0xB2,0x0B,0x12,0xC0,0x0B,0x19,0xFE,0x3A,0x06,0x05,0xC4,0xA9,0x85,0x3A,
+0x91,0x9D,0xD9,0x20,0xB3,0x83,0x96,0x8A,0x1A,0x1D,0xC3,0x2D,0xC2,0x26,0x2D,0xC1,0x13,0xA5,0x77,0x0A,0x05,0xDE,0x06,0x20,0xBF,0x8C,0x12,0xC0,0x0B,0xC0,0x0E,0xC0,
+0x0B,0x0E,0xC0,0x0B,0xC1,0x33,0x05,0x0A,0x05,0xAA,0x78,0x30,0x37,0xA8,0x77,0xC0,0x21,0x33,0x12,0x0B,0xC0,0x9D,0x98,0x81,0x9D,0x05,0xC5,0xA9,0x85,0x3A,0x91,0x9D,
+0xD8,0xA5,0x87,0xB3,0x85,0xA3,0x95,0x94,0x8F,0x1D,0xC4,0x98,0xEA,0xC2,0x69,0x2D,0xC1,0x36,0x06,0x05,0xDF,0x0C,0xA3,0x76,0xA4,0x6D,0xBF,0xB7,0xA8,0x87,0x0B,0xC6,
+0x0E,0x93,0x79,0xFE,0x18,0xE2,0x17,0x1F,0x33,0xB2,0x86,0xA6,0x77,0xC0,0x12,0xC0,0x0B,0xC0,0x0E,0xC0,0x0B,0x21,0x17,0x05,0xC5,0x06,0x3C,0x05,0x0A,0x05,0xD6,0x20,
+0x24,0x90,0x8C,0x9F,0x8B,0xA2,0x98,0x07,0x10,0x1D,0xC1,0x98,0xE9,0x2D,0xC1,0x24,0x8C,0x8B,0x05,0xDF,0x29,0x69,0x94,0x59,0xB5,0xCB,0xFE,0xF7,0xB9,0x0B,0xC6,0x9D,
+0x98,0x29,0x0A,0xBB,0x86,0xB9,0x98,0x12,0x0B,0xC0,0x0E,0x34,0x3A,0x0E,0x0B,0x0E,0x0B,0x3D,0xFE,0x21,0x65,0x96,0x98,0xC6,0x3C,0x53,0x05,0xD7,0xA5,0x87,0xB6,0x84,
+0x96,0x98,0x9B,0x8E,0x36,0x26,0xC1,0x1F,0xC1,0x36,0x9D,0xC9,0x2D,0xC0,0xA7,0x76,0xA7,0x54,0x05,0xC0,0x6E,0x05,0xDD,0x13,0x06,0x9B,0x69,0x05,0x30,0x0B,0xC6,0x16,
+0x8A,0x88,0x33,0x04,0x0B,0x12,0xC0,0x19,0x11,0xA7,0x87,0xAB,0xA8,0x0E,0x5A,0xC0,0x9D,0x98,0xFE,0x4B,0x0A,0x05,0xC7,0x13,0x31,0x05,0xD7,0xB5,0x84,0xA1,0x85,0x96,
+0x9F,0x3D,0xC2,0x07,0x3D,0xC0,0x36,0x0F,0x9A,0xC9,0x2D,0xC0,0xAE,0x53,0x06,0x05,0xE0,0x29,0x9C,0x56,0x2E,0x93,0xCC,0x77,0x30,0x2B,0x0B,0xC3,0x21,0x3F,0x21,0x0B,
+0xC0,0x34,0x33,0x9F,0x85,0x11,0x0C,0x15,0x0B,0xC1,0x9C,0x86,0x82,0x8C,0x84,0x9B,0xC8,0x13,0x05,0xD7,0x20,0x24,0x3C,0x36,0x3D,0xC7,0x26,0x2D,0xC0,0xAF,0x51,0x31,
+0x05,0xE0,0x29,0x20,0xA4,0x57,0x95,0xAA,0x05,0xC0,0xBC,0x75,0xBC,0x97,0x0E,0x0B,0xC1,0x05,0xB5,0x87,0x12,0x7A,0x0E,0xC0,0x5A,0xC0,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,
+0x05,0x84,0x9B,0xC8,0xA5,0x87,0x3C,0x05,0xD6,0x2B,0xB3,0x85,0x22,0x3D,0xC9,0x2D,0x26,0x13,0x0F,0x05,0xE1,0x29,0x20,0x2E,0x28,0x05,0xC1,0xB4,0x67,0x0C,0x0B,0x0E,
+0x0B,0x9D,0x98,0x0B,0xC9,0x2B,0x30,0x05,0xC9,0x3F,0x20,0x05,0xD6,0x22,0x0F,0x3D,0xC0,0x41,0x3D,0x07,0x3D,0xC0,0x02,0x3D,0xC2,0x2D,0x69,0x0F,0x99,0xA8,0x05,0xE1,
+0x29,0x20,0x9D,0x68,0xC0,0x05,0xC0,0x6E,0x05,0xAF,0x87,0xBE,0x97,0x0B,0xC1,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0xC2,0x33,0x05,0xCA,0xA5,0x87,0x32,0x05,0xD5,
+0x20,0x27,0x06,0x3D,0xC0,0x07,0xC0,0x3C,0x3D,0xC0,0x02,0x3D,0xC2,0x2D,0xC0,0x24,0x31,0x05,0xE1,0x29,0x20,0x31,0x10,0x17,0x05,0xC2,0x31,0x30,0xB5,0x88,0x0B,0xC0,
+0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x9D,0x88,0x30,0x05,0xE4,0x1E,0x22,0x99,0x9D,0xCB,0x2D,0xA3,0x88,0x24,0x08,0x05,0xE1,0x29,0x20,0x05,0xAF,0x33,0x93,0xDD,
+0x14,0x05,0xC3,0xAF,0x87,0x11,0x0C,0x15,0x0B,0xC4,0x95,0x8B,0x84,0x79,0x05,0xE4,0xB0,0x74,0xAB,0x96,0x3C,0x36,0x3D,0xC0,0x02,0x3D,0xC0,0x36,0x07,0x36,0xA5,0x68,
+0x3D,0x41,0x07,0x9B,0xD9,0xAC,0x44,0x22,0x17,0x05,0xE1,0x3C,0x53,0x05,0xAF,0x33,0x93,0xDD,0x05,0xC6,0x25,0x33,0x2D,0x3A,0x0B,0xC0,0x9A,0x99,0x33,0x82,0x8A,0x05,
+0xE4,0x31,0xB4,0x85,0x3C,0x3D,0xC0,0x07,0xC0,0x3D,0xC1,0x07,0x36,0x1D,0x3D,0xC0,0x41,0x07,0x9B,0xDA,0xAF,0x43,0x93,0x99,0x05,0xE2,0x3C,0x36,0x05,0xAF,0x33,0x99,
+0xBB,0x05,0xC8,0x31,0x00,0x30,0xC0,0x36,0x05,0xE6,0xB5,0x84,0xC0,0x3D,0xC6,0xA3,0x87,0x9D,0x99,0x3D,0x36,0x0F,0x36,0x3D,0x13,0xAB,0x76,0x89,0x9C,0x05,0xE2,0xA9,
+0x85,0x3C,0x92,0x8B,0x37,0xAB,0x66,0x98,0x99,0x99,0xBB,0x05,0xC1,0x0A,0x05,0xC2,0x10,0xAD,0x54,0x24,0x93,0xDD,0x05,0xE6,0xA5,0x87,0xB3,0x85,0x97,0x9C,0x3D,0xC0,
+0x26,0x07,0x3D,0xC1,0x26,0x07,0x36,0x3D,0xC3,0xAC,0x73,0xC0,0x05,0xE3,0x3F,0x13,0x05,0x2B,0xB9,0x10,0xAE,0x52,0x9C,0x99,0x96,0x9A,0x97,0xBD,0x9A,0x89,0x5A,0xC1,
+0xA8,0x87,0xAB,0x62,0xAA,0x88,0xA4,0x76,0x89,0xBE,0xFE,0x00,0xA0,0x05,0xE6,0x3C,0xAD,0x85,0x91,0x9E,0x3D,0x26,0x3D,0xC1,0x36,0x3D,0xC0,0x26,0x07,0x36,0x3D,0xC2,
+0x2D,0xC3,0x69,0xAE,0x54,0x9A,0x87,0x05,0xE4,0xB0,0x74,0x05,0xC0,0x15,0xB9,0x62,0x6D,0xC0,0x1A,0x18,0x9D,0x9B,0x69,0x1A,0x18,0x0D,0x18,0x1A,0x12,0xFE,0x01,0x00,
+0x05,0xE6,0x39,0x9D,0x99,0x3D,0xC1,0x02,0x3D,0xC1,0x2D,0x26,0x2D,0xC0,0x26,0xC0,0x0F,0x91,0x9A,0x17,0x9D,0x9A,0xE3,0x3C,0x05,0xC0,0x08,0x06,0x1A,0x18,0xC4,0x0D,
+0x06,0x18,0x1A,0x9A,0x89,0x10,0x05,0x6E,0x05,0xE3,0x2B,0x0F,0x97,0x9C,0x3D,0xC3,0x07,0x36,0x2D,0xC4,0x24,0x85,0xAF,0x05,0xE7,0x0C,0x0D,0x06,0x18,0xC3,0x0E,0xFE,
+0x5B,0xA9,0xA3,0x55,0xAD,0x52,0x0D,0x06,0x15,0x19,0x05,0xE4,0xA9,0x97,0xAF,0x75,0x3D,0xC1,0x02,0x3D,0xC0,0xA3,0x87,0x9D,0x99,0x26,0x2D,0xC0,0xA3,0x88,0xA4,0x65,
+0xA5,0x77,0x24,0x05,0xE5,0x0A,0xC0,0x05,0xAB,0x55,0xFE,0x65,0xA7,0x18,0xC4,0x12,0xFE,0x6B,0xAB,0xA0,0x9A,0x2C,0x1A,0x18,0x0E,0xFE,0x09,0x81,0x19,0x9C,0xAA,0xC6,
+0xA2,0x77,0x14,0x05,0xD9,0xAB,0x86,0xAA,0x86,0x3D,0xC2,0x69,0xA3,0x88,0x36,0x3D,0x13,0xC1,0x7B,0xC0,0x1E,0x98,0x97,0x05,0xE3,0x19,0x28,0x37,0xC1,0xA7,0x66,0xFE,
+0x65,0xA7,0xA7,0x75,0x18,0x1A,0x18,0xC1,0xFE,0x54,0xE7,0xFE,0x6B,0xAB,0x16,0xC0,0x36,0x18,0x9D,0x9A,0x15,0xFE,0x00,0x60,0x14,0x55,0x37,0xC0,0xA7,0x54,0x2E,0xC1,
+0x24,0x10,0x59,0x19,0x05,0xD7,0xB4,0x72,0x22,0x3D,0xC1,0x02,0x65,0x3D,0xC1,0xA4,0x95,0xC3,0xAB,0x76,0x90,0x89,0x05,0xDF,0x37,0x24,0x0C,0xA1,0x54,0x0C,0x2E,0x0C,
+0xC1,0x38,0xA9,0x54,0xB4,0x51,0x18,0x9D,0x9A,0x18,0xC1,0x99,0x9C,0x31,0x16,0xC0,0x36,0x18,0x1A,0x25,0xFE,0x0A,0x00,0x3E,0xA9,0x88,0xA4,0x63,0xA8,0x75,0x25,0x91,
+0x9C,0xFE,0x01,0x00,0x05,0xC0,0x19,0x10,0x24,0x19,0x05,0xD6,0x22,0x9D,0x89,0x3D,0xC0,0x41,0x07,0x3D,0xC0,0x69,0x3D,0x1D,0x59,0xC2,0x2B,0x89,0x9C,0x05,0xDC,0xAB,
+0x44,0xAC,0x54,0x3B,0xA9,0x65,0x25,0x0D,0x2C,0x0E,0x06,0x99,0xBB,0x05,0xC0,0x6E,0xC0,0xB7,0x21,0xB7,0x62,0x18,0xC3,0x92,0x9E,0x31,0xA3,0x55,0x19,0x18,0xC1,0x8F,
+0x9C,0xAA,0x99,0x18,0xC2,0x0D,0x0C,0x05,0x0A,0x05,0xC0,0x10,0x2E,0x98,0x99,0x05,0xD5,0xB5,0x84,0x13,0x3D,0xC3,0x26,0x07,0x61,0x13,0xC2,0xA5,0x77,0xA6,0x86,0x05,
+0xDB,0xA6,0x87,0xB2,0x11,0x0E,0xA8,0x75,0x1A,0x18,0xC3,0x39,0xFE,0x09,0x81,0x99,0xBB,0x05,0xC0,0x0A,0x37,0xB6,0x31,0x0D,0x69,0x18,0xC2,0x0D,0x9C,0x89,0xA7,0x86,
+0x18,0xC1,0x25,0x39,0x18,0x1A,0x18,0xC1,0x0E,0xFE,0x01,0x00,0x05,0xC0,0x19,0x05,0xA7,0x78,0x2E,0x0F,0x05,0xD4,0x3C,0x36,0x26,0x3D,0xC0,0x02,0x3D,0xC0,0x26,0x07,
+0x1D,0xC0,0x59,0xC0,0x2B,0x20,0x05,0xDB,0x0C,0x0D,0x18,0xC7,0x39,0xFE,0x09,0x81,0x05,0x0A,0x05,0xC0,0xB8,0x21,0x39,0x2C,0x18,0x1A,0x18,0xC6,0x0D,0x3E,0x0E,0x0D,
+0x18,0xC0,0x1A,0x18,0xFE,0x0A,0xA0,0x05,0x0A,0x05,0xC1,0x10,0x06,0x0A,0xC0,0x05,0xD2,0x3F,0xB0,0x75,0x95,0xAC,0x3D,0x36,0x9D,0x98,0x7B,0xA0,0xA8,0xA0,0xC7,0x70,
+0x1D,0x13,0x1D,0xC0,0x27,0x92,0x9A,0x05,0xDB,0x12,0x18,0xC9,0x3B,0x28,0x05,0xC0,0x19,0x2A,0xFE,0x65,0xA7,0x9E,0x75,0x35,0xA9,0x97,0x1A,0x18,0xC5,0x25,0x37,0xA7,
+0x66,0xBB,0x62,0x18,0xC2,0x12,0x28,0x05,0xC3,0xA9,0x85,0x10,0x95,0xCC,0xD4,0x1E,0x98,0x97,0x16,0x79,0xA3,0xC8,0x79,0x76,0xA2,0x88,0x56,0x1D,0xC0,0x13,0x22,0x27,
+0x8A,0x9D,0x99,0x9C,0xDA,0x03,0x0E,0x06,0x18,0xC9,0xFE,0x23,0x03,0x0F,0x14,0x05,0xA8,0x55,0xFE,0x54,0xE7,0x1A,0x9A,0x8A,0x99,0x98,0x2C,0x18,0xC4,0x6F,0x39,0xFE,
+0x00,0xA0,0x05,0x0C,0x0D,0x18,0xC1,0x2C,0xFE,0x02,0x00,0x92,0xFF,0x67,0x17,0x05,0xC1,0x2E,0x28,0x05,0xD3,0x3C,0xAB,0xA4,0xFE,0x99,0x61,0x9F,0xB8,0x56,0xC0,0x31,
+0x29,0xC0,0x1D,0x73,0x13,0xC0,0xAB,0x73,0x17,0x05,0xC5,0x0A,0x05,0xD2,0x3F,0x36,0x18,0x06,0x18,0xC8,0x97,0x9A,0x10,0x05,0xC1,0xFE,0x43,0xE6,0x1F,0x18,0xC0,0x0A,
+0x0E,0x06,0x18,0xC3,0xFE,0x2B,0x24,0xFE,0x00,0x40,0xC0,0x05,0xB4,0x42,0x36,0x18,0x1A,0x18,0x15,0x19,0x05,0xC3,0xA5,0x87,0xAA,0x55,0x93,0xBC,0x14,0x05,0xD2,0x22,
+0xA1,0xF7,0x33,0x29,0xC0,0x66,0x29,0xC0,0xFE,0x52,0x26,0xC0,0x13,0xA8,0x66,0xC0,0x05,0xC0,0x0A,0x05,0xD8,0x3F,0x36,0x18,0x06,0x18,0xC9,0x8F,0xAD,0x19,0x05,0xC0,
+0xB5,0x20,0x06,0x18,0xC2,0x12,0x25,0x0D,0x18,0xC0,0x2C,0xFE,0x09,0x81,0x19,0x05,0xC1,0x08,0x36,0x0D,0x18,0x39,0x19,0x05,0x0A,0x05,0xC2,0xAB,0x55,0x06,0x0A,0x05,
+0x0A,0x05,0xD0,0x2B,0xB2,0x95,0xFE,0x8A,0x21,0x29,0x7E,0x3D,0x29,0xC0,0x13,0x9C,0xAB,0x13,0xAB,0x75,0x99,0x89,0x05,0xDB,0x2B,0x2C,0x18,0xCB,0x9D,0x9B,0xFE,0x0A,
+0x00,0x05,0xC0,0xAF,0x33,0x36,0x18,0xC3,0x25,0x0E,0xA8,0x75,0x18,0x3B,0xFE,0x00,0x60,0x14,0x05,0xC1,0x0F,0x08,0x36,0x18,0x25,0xFE,0x09,0x21,0x05,0x0A,0x05,0xC3,
+0xAF,0x54,0x98,0x89,0x05,0xC0,0x19,0x05,0xD0,0xAB,0x86,0xAE,0xA3,0xFE,0x89,0x40,0x29,0x7E,0xA2,0x88,0xC0,0xFE,0x4A,0x25,0xC0,0x1D,0x27,0x92,0x9A,0x91,0x9F,0xDB,
+0x37,0x0E,0x06,0x18,0xCB,0x12,0x28,0x05,0x37,0x0E,0x18,0xC5,0x97,0x9A,0x39,0x8A,0xCE,0x05,0xC5,0x08,0x36,0x0D,0x84,0xAF,0x05,0xC5,0x37,0x24,0x92,0xDD,0xC0,0x05,
+0xD2,0x22,0x35,0x33,0x31,0xA2,0x88,0x29,0xFE,0x4A,0x25,0x1D,0xC0,0xAE,0x52,0x8D,0x9C,0x95,0x9D,0xDB,0x28,0x39,0x18,0xCC,0x0D,0xFE,0x0A,0x00,0x0A,0xC0,0xFE,0x3C,
+0x62,0x18,0xC7,0x39,0x13,0x19,0x05,0xC4,0xB3,0x33,0x0E,0x08,0x0A,0xC0,0x05,0xC4,0xAF,0x54,0x28,0x0A,0xC0,0x05,0xD1,0x2B,0xB6,0x83,0xFE,0x8A,0x21,0x3D,0x7E,0x29,
+0xFE,0x4A,0x25,0xC1,0x27,0x8A,0x9D,0x99,0x9C,0xDC,0xFE,0x3B,0xE5,0x0D,0x18,0xCC,0x8F,0x9C,0x19,0x05,0x15,0x1A,0x18,0xC8,0x12,0xFE,0x02,0x00,0x05,0xC4,0x2E,0x0C,
+0x8F,0xDD,0x0A,0xC0,0x05,0xC3,0x37,0xA7,0x66,0x0A,0x05,0x0A,0x05,0xD1,0xAF,0x87,0xAA,0xC3,0x3D,0xA2,0x87,0x66,0xFE,0x4A,0x25,0xC0,0xA5,0x77,0xA6,0x86,0x85,0x9F,
+0xDD,0xB8,0x10,0xB7,0x62,0x18,0xCC,0x99,0x9C,0x10,0x05,0xB7,0x10,0x1A,0x18,0xC9,0x2C,0x91,0x9B,0xFE,0x01,0x00,0x9A,0xBB,0x05,0xC2,0xAB,0x44,0xA4,0x98,0x28,0x0A,
+0xC1,0x05,0xC2,0x31,0x28,0x0A,0xC0,0x05,0xD2,0xBB,0x84,0xFE,0x8A,0x21,0x3D,0x7E,0x13,0xC0,0xA8,0x66,0xC0,0x88,0x9D,0xDD,0x31,0x0D,0xA4,0x76,0x18,0xCC,0x3B,0x28,
+0x0C,0x0D,0x18,0xCB,0x97,0x9A,0x19,0x28,0x05,0xC0,0xA4,0x66,0x05,0x37,0x0C,0x37,0x05,0xC4,0x2B,0x31,0x93,0xBC,0x14,0x05,0xC1,0x0F,0x05,0xCE,0xAF,0x84,0x16,0xFE,
+0xA1,0x20,0xC0,0x13,0xC0,0xAB,0x75,0x9B,0x87,0x05,0xDD,0xAB,0x55,0x0A,0x0D,0x18,0xCC,0x99,0x9B,0xFE,0x02,0x00,0x0C,0x0D,0x18,0xCD,0x39,0x0C,0x05,0xC2,0x2B,0x31,
+0x9C,0x89,0x05,0xC4,0x2E,0x9B,0x88,0x05,0xD3,0x03,0x24,0xFE,0x99,0x61,0x29,0x1D,0x13,0xAB,0x76,0x96,0x98,0x05,0xDD,0xA5,0x87,0x12,0x18,0xCE,0x15,0x0C,0x0D,0x18,
+0xCE,0x2C,0x99,0x98,0xFE,0x0A,0x00,0x05,0xC2,0x0C,0x10,0x05,0xC3,0xA7,0x85,0xA8,0x36,0x0F,0x05,0xD3,0x04,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xFE,0x4A,0x25,0xC0,0x27,
+0x92,0x9A,0x91,0x9F,0xDE,0xB8,0x10,0xB7,0x62,0x18,0xCD,0x94,0x8B,0xFE,0x23,0x03,0x1A,0x18,0xD0,0x25,0x19,0x90,0xCD,0x05,0xC0,0x31,0x24,0x99,0xBB,0x05,0xC3,0x24,
+0x28,0x05,0xC0,0xA4,0x66,0x05,0xD0,0x1E,0x0F,0x3D,0x1D,0xC0,0x27,0x20,0x05,0xDE,0x0C,0xFE,0x65,0xA7,0x18,0x9D,0x9A,0x18,0xCC,0x8A,0x9E,0x0D,0x18,0xD1,0x0D,0x29,
+0x28,0x9A,0xBB,0x05,0x2B,0xAA,0x55,0x28,0x0A,0xC0,0x05,0xC0,0x10,0x2E,0x2B,0x10,0x59,0x10,0x06,0x10,0x98,0xBA,0x05,0xCC,0xB7,0x72,0x0F,0xFE,0xB1,0x81,0x1D,0xC0,
+0x27,0x8E,0x9C,0x95,0x9D,0xDE,0x2B,0xFE,0x5C,0xE8,0x18,0xC3,0x6F,0x18,0xC8,0x8F,0xAD,0x1A,0x18,0xD3,0xFE,0x3B,0xE5,0xFE,0x00,0x60,0x14,0x05,0x37,0x2E,0x0F,0x05,
+0xC2,0xB5,0x20,0x9A,0x89,0x37,0x05,0x19,0x28,0x10,0x06,0x10,0xC0,0x05,0xC3,0x0A,0x05,0xC4,0x1E,0xFE,0x8A,0x21,0x98,0xFB,0xFE,0x4A,0x25,0x1D,0x27,0x8A,0x9D,0x05,
+0xDF,0xFE,0x43,0xE6,0x1F,0x18,0xCD,0x35,0xA9,0x97,0x18,0xD3,0x25,0xFE,0x09,0x81,0x19,0x05,0xC0,0x38,0x19,0x05,0xC1,0x10,0x2E,0x2B,0x0A,0xC0,0x05,0xA4,0x86,0xA1,
+0x8A,0x7E,0x37,0xA7,0x66,0x37,0x05,0xC4,0x0A,0x05,0xC1,0xA8,0x88,0xB1,0xA1,0xFE,0x99,0x61,0xA1,0xB8,0x13,0x7B,0x27,0x31,0x99,0x9C,0x0A,0x05,0xDD,0xAF,0x54,0x0D,
+0x18,0xCD,0x35,0xA5,0x99,0x1A,0x18,0xC6,0x9D,0x9A,0x18,0xCA,0xFE,0x23,0x03,0x05,0xC0,0x17,0x2A,0x99,0x9B,0x05,0xC0,0x10,0x59,0x0A,0x05,0xC0,0x03,0xA3,0x98,0xC0,
+0x59,0xC1,0x37,0x05,0xC9,0x13,0xA9,0xB5,0x3D,0x7E,0x1D,0x13,0x27,0x8A,0x9D,0x99,0x9C,0xDF,0x37,0x12,0x18,0xCE,0x0E,0xA8,0x75,0x18,0xD3,0x3E,0xFE,0x00,0xA0,0x05,
+0xC0,0x15,0x4C,0x19,0x10,0x06,0x0A,0x05,0xC0,0x2E,0xA0,0x65,0x06,0x19,0x05,0xC0,0x0A,0xC1,0x05,0x17,0x05,0xC5,0x2B,0xB6,0x83,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xC0,
+0x1D,0x59,0x27,0x87,0xAF,0x9C,0x8A,0xE0,0xB8,0x10,0xB7,0x62,0x18,0xCD,0x92,0x9B,0xAE,0x76,0x18,0xD2,0x0D,0xFE,0x0A,0x00,0x05,0xC1,0x03,0x2E,0x06,0x99,0xBB,0x05,
+0x15,0xC0,0x2E,0xC0,0x06,0x10,0x06,0x10,0x17,0x05,0xCA,0x20,0xAF,0xA5,0x33,0xA1,0xA9,0x6E,0xFE,0x4A,0x25,0xC0,0x27,0x87,0xAF,0x9C,0x8A,0x6E,0x05,0xDE,0xAF,0x54,
+0x0E,0xA8,0x75,0x18,0xCC,0x12,0x1A,0x18,0xD2,0x2C,0xFE,0x01,0x60,0x05,0xC1,0xA7,0x85,0x0C,0x98,0x99,0x05,0xC1,0x2B,0x19,0x05,0xC1,0x0A,0x15,0x9D,0x77,0x05,0xC0,
+0x19,0x05,0xC6,0x2B,0xB2,0x95,0x9D,0xE7,0x33,0xA1,0xA9,0x46,0x13,0xC0,0xAB,0x75,0x1F,0x9C,0x8A,0xE0,0x2B,0xB9,0x10,0xB2,0x51,0x18,0xCC,0x0E,0x2C,0x18,0xD2,0x92,
+0x9E,0x19,0x05,0xC1,0xAF,0x33,0x28,0x0A,0xC0,0x05,0xC0,0xA6,0x87,0x15,0xC0,0x40,0x10,0x06,0xA4,0x98,0x10,0x0A,0xC0,0x05,0xC7,0x15,0x22,0x33,0xA1,0xA9,0x6E,0xC0,
+0xFE,0x4A,0x25,0xC0,0x27,0x1F,0x9C,0x8A,0xE1,0x0C,0x0D,0x18,0xCC,0x2C,0x0E,0xAB,0x75,0x18,0xD1,0xFE,0x23,0x41,0x19,0x05,0xC0,0x17,0x31,0x28,0x9A,0xBB,0xC0,0x05,
+0xC0,0x0A,0xC0,0x05,0xC2,0x17,0x2A,0x93,0xBD,0x14,0x05,0xC7,0xB5,0x84,0x1C,0x3D,0xA2,0x87,0xC1,0x13,0xC0,0xAB,0x75,0x89,0x9D,0x05,0xE1,0x06,0x12,0x18,0xCD,0x94,
+0x8B,0xA9,0x97,0x18,0xD0,0x25,0x37,0x05,0xC1,0xAA,0x66,0x10,0x05,0xC4,0x2B,0x32,0x05,0xC1,0x6E,0x15,0x28,0x05,0xC0,0x19,0x05,0xC4,0x20,0xB3,0x83,0xFE,0x99,0x61,
+0x9F,0xB8,0xA2,0x88,0x6E,0xC0,0x13,0xA5,0x77,0x27,0x8A,0x9D,0x99,0x9C,0xE2,0x0C,0x0D,0x06,0x18,0xCB,0x12,0x1A,0x18,0xD0,0xFE,0x23,0x41,0x0F,0x14,0x05,0xA8,0x55,
+0xA2,0x99,0x0F,0x14,0x05,0xC1,0x0F,0x05,0x2B,0x10,0xC0,0x59,0x10,0xC0,0x06,0x10,0x96,0xBB,0xC0,0x05,0xC5,0xB8,0x73,0x9C,0xF7,0xFE,0xAA,0x03,0x9D,0xB8,0xC2,0x13,
+0xA3,0x77,0x27,0x31,0x05,0xE2,0x37,0x0E,0xA8,0x75,0x18,0xCB,0x12,0xA8,0x75,0x0D,0x06,0x2C,0x18,0x0D,0x06,0x0D,0x06,0x0D,0xC0,0x06,0x0D,0xC1,0x06,0x0D,0x2C,0x0E,
+0xFE,0x0A,0x00,0x05,0x37,0xC0,0xA7,0x87,0x28,0x19,0x05,0xC1,0x6E,0x05,0xC5,0x2B,0x31,0x49,0x93,0xDD,0x05,0xC1,0x0A,0xC0,0x05,0xC0,0x3C,0xAD,0x85,0xFE,0x99,0x61,
+0x9F,0xB8,0xA2,0x88,0xC0,0x6E,0x05,0xB1,0x67,0xAB,0x88,0xC3,0x66,0x01,0xC0,0x9D,0x99,0x9C,0x88,0xA3,0x88,0x18,0x9C,0xA9,0x41,0x3D,0x18,0x00,0xC0,0x28,0xC0,0xA2,
+0x78,0x3C,0x01,0x3C,0x01,0xC1,0x3C,0xC0,0x01,0x3C,0xC0,0x01,0xD0,0x93,0xA9,0x39,0x01,0xC5,0x28,0x01,0xC2,0x39,0x28,0xC0,0x19,0x00,0x18,0x3D,0xA4,0x74,0xA3,0x99,
+0xA5,0x87,0xC0,0xA3,0x98,0xA2,0x77,0xC2,0x47,0x9F,0x9B,0xC2,0x28,0x3C,0xC0,0x01,0xC1,0x3C,0x01,0xC8,0x07,0x3C,0x01,0xC7,0xA1,0xA6,0x3A,0xA2,0x95,0x35,0x3C,0x2B,
+0xC0,0x52,0x0F,0xC3,0x9E,0x85,0x9D,0x9A,0xC0,0xA4,0x77,0x6B,0xC1,0xA4,0x96,0xC1,0xA2,0x78,0xA2,0x78,0x35,0xC0,0x3C,0x3A,0xC1,0x67,0x01,0xC0,0x3C,0x01,0xC3,0x00,
+0xC0,0x3C,0x01,0xC2,0x3E,0xC0,0x2B,0x1E,0x39,0x9D,0x99,0x9B,0x9A,0x9C,0x88,0x52,0x9C,0x8B,0x7E,0x9D,0x88,0x9D,0x9A,0xC3,0x6E,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0x0A,
+0xC0,0x05,0xA4,0x86,0xA3,0x87,0xA4,0x89,0xA4,0x86,0xA4,0x88,0x0F,0x16,0xC0,0x27,0x35,0x6B,0x35,0x9E,0x7C,0x67,0xC1,0x01,0x56,0x18,0x3C,0x39,0x01,0x3E,0x2B,0x9C,
+0x79,0x06,0x20,0x9A,0x89,0x05,0x0A,0x05,0x0A,0x05,0xCC,0x0A,0x05,0xC2,0x0A,0x05,0xC4,0x17,0x31,0x20,0xA4,0x86,0x26,0x0F,0x16,0x35,0x07,0x06,0x9E,0x8B,0xC1,0x39,
+0x3C,0x06,0x99,0x99,0x17,0x9D,0x9A,0xC8,0x0A,0x05,0xDB,0x31,0x3A,0x22,0x16,0xC0,0x0F,0x01,0x69,0x01,0xC0,0x3C,0xA2,0x74,0x0F,0x06,0x2B,0x05,0xED,0x2B,0xA9,0x97,
+0xA9,0x74,0x16,0x35,0x3E,0x39,0xC0,0x7A,0x01,0xC4,0x28,0x01,0xC1,0x3C,0x39,0x01,0xC1,0x19,0x3D,0xC0,0x01,0xA0,0xA5,0x94,0x88,0x17,0x05,0xF3,0x12,0xAC,0x75,0x27,
+0x38,0x9C,0x8E,0x3C,0x01,0xCB,0x19,0x93,0xAA,0x3D,0xA5,0x67,0x01,0x0F,0x05,0xF6,0x0A,0xA6,0x85,0xAD,0x86,0xA7,0x98,0x35,0x3A,0xC0,0x3C,0x01,0xC7,0x19,0x3D,0x40,
+0x1D,0xC0,0x01,0x9C,0x95,0x05,0x0A,0x05,0xF7,0x2B,0xA9,0x97,0x16,0x35,0x47,0x3E,0x9E,0x7B,0x01,0x3C,0x01,0xC2,0x19,0x3D,0x1F,0x1D,0xC1,0x01,0x07,0x0A,0x05,0xC3,
+0x0A,0x05,0xF4,0x2B,0xA9,0x97,0x24,0x38,0x35,0x9D,0x8E,0x01,0xC2,0x19,0x26,0x1D,0xC3,0x28,0x07,0x05,0xFD,0xC0,0x06,0x27,0x38,0x3A,0x01,0xC0,0x28,0x26,0xA4,0x87,
+0x1D,0xC3,0xA6,0x95,0x22,0x0A,0x05,0xFD,0x0A,0x05,0xC0,0xAF,0x84,0x27,0x16,0x3A,0x1D,0xC1,0x20,0x05,0xFD,0xC4,0x2B,0x0F,0x35,0x29,0x9E,0x5A,0x1D,0x06,0x05,0xFD,
+0xC6,0x3A,0xAC,0x87,0x0F,0x9B,0x69,0x01,0x93,0xB7,0x05,0x0A,0x05,0xCE,0xAB,0x86,0x07,0x12,0x05,0xC0,0x0A,0x05,0xC5,0x3E,0x8D,0x99,0x97,0x9C,0xD0,0xA6,0x87,0xBE,
+0x73,0x7F,0x8F,0x88,0x93,0x9B,0x05,0xC5,0x0A,0xBB,0x64,0x17,0x05,0xD1,0xFE,0x8C,0x6C,0xB9,0x88,0x99,0x87,0x36,0x3C,0x0A,0x05,0xC2,0x3C,0xA3,0x96,0x90,0x7D,0x05,
+0xC0,0xAB,0x86,0x0F,0xAB,0x87,0x90,0x8A,0x3C,0x05,0xC0,0x1E,0x05,0xC0,0x0A,0x05,0xCF,0x20,0x19,0xAA,0x8A,0xC0,0x7A,0x19,0x87,0x9A,0x3A,0x05,0xC1,0xB5,0x84,0x19,
+0x0E,0x19,0x1F,0x3C,0x17,0x05,0xD7,0x0A,0x05,0xC9,0x6B,0x05,0xA7,0x87,0xB1,0x85,0x2B,0x98,0x59,0x1D,0x22,0x05,0xD2,0xA5,0x87,0xFE,0xBD,0xD1,0x0E,0xC0,0x0B,0xC0,
+0x96,0x86,0x8B,0x99,0x8A,0x8B,0x17,0x9D,0x9A,0x2B,0x1F,0xBC,0x98,0x0B,0x9D,0x98,0x96,0x79,0x1F,0x12,0x05,0xE5,0xA5,0x87,0xB2,0x73,0x24,0x98,0x5A,0x06,0x05,0xD3,
+0xFE,0x9D,0x2D,0xB6,0x89,0x0E,0xC1,0x5A,0x9C,0x86,0x88,0x9A,0x12,0x05,0xC0,0x3C,0x31,0x04,0x0E,0x0B,0x9D,0x98,0x22,0x88,0x79,0x17,0x05,0xC0,0x0A,0x05,0xD6,0x0A,
+0x05,0xC9,0x32,0x27,0x0B,0x0E,0xC2,0x15,0x88,0x9A,0x12,0x05,0xC0,0xBB,0x84,0x15,0x0B,0xC0,0x0E,0xC0,0x98,0x77,0x1F,0x12,0x05,0xC1,0x3E,0x8D,0x99,0x17,0x9D,0x9A,
+0xD2,0xB5,0x84,0x15,0x0E,0xC3,0x0B,0x2B,0x00,0x85,0xAD,0x05,0xA9,0x85,0x21,0x04,0x0E,0xC2,0x2B,0x21,0x06,0x90,0x9C,0x0A,0x05,0x0A,0x7B,0x05,0xCA,0x0A,0x05,0xD3,
+0xB3,0x84,0x27,0x97,0x9B,0x1D,0xC0,0x1E,0x05,0xC0,0x0A,0x05,0xD1,0x06,0x34,0x0B,0x0E,0xC2,0x0B,0xC0,0x2B,0x00,0x85,0x9B,0x97,0x9C,0x36,0xBF,0x86,0x0B,0x2B,0x19,
+0x0B,0xC0,0x04,0x19,0x07,0x8D,0xAB,0x0A,0x05,0xE3,0xB0,0x95,0x24,0x20,0x1D,0x29,0x0A,0xC0,0x05,0xD2,0x3F,0x19,0x0E,0xC0,0x9A,0x89,0x94,0x88,0x94,0x89,0x9C,0x8A,
+0xC0,0x30,0x32,0x69,0x8C,0x8A,0x9E,0x8B,0xFE,0x9D,0x2D,0x19,0x94,0x88,0xAA,0x89,0x0E,0xC1,0x0B,0x96,0x86,0x2B,0x31,0x05,0xC1,0x0A,0x05,0xE0,0x22,0x27,0x29,0x06,
+0x05,0xD4,0xA6,0x87,0xFE,0xBD,0xD1,0x0E,0x8C,0x7A,0x85,0x9A,0x05,0xC0,0x0A,0x05,0xC1,0x3C,0x36,0x1F,0x29,0x20,0x30,0x0B,0xC0,0x0E,0xC0,0x0B,0xC0,0x9A,0x99,0x8A,
+0x87,0x12,0x05,0xE4,0x07,0x24,0x12,0x05,0xD5,0x36,0x16,0x3A,0xAF,0x85,0x00,0x21,0xA5,0x78,0xA2,0x8A,0xA2,0x97,0xC0,0x0B,0x21,0x8F,0x88,0x3A,0xBA,0x74,0xBB,0x98,
+0x0E,0x5A,0xC4,0x15,0x88,0x9A,0x89,0x8B,0x05,0xE3,0xA5,0x88,0x24,0x01,0x1E,0x8B,0x9B,0x05,0xD5,0x1E,0x3E,0x2D,0xA9,0xA6,0x0B,0x0E,0xC0,0x0B,0xC1,0x0E,0x0B,0x34,
+0x82,0x89,0xC0,0x34,0x0A,0x05,0xD4,0xFE,0x7C,0x2B,0x2B,0x0E,0xC3,0x0B,0x0E,0x04,0x0B,0x0E,0x0B,0x96,0x86,0x29,0x22,0x0E,0x0B,0xC4,0x2B,0x81,0x8B,0x20,0x0F,0x91,
+0x9A,0x17,0x9D,0x9A,0xE2,0x13,0xAB,0x73,0x18,0x1D,0xC0,0x9D,0xA9,0x0A,0x05,0xD4,0x1F,0x2B,0x0E,0x0B,0xC0,0x0E,0xC0,0x0B,0xC5,0x22,0x1F,0x3A,0x0B,0xC0,0x0E,0xC0,
+0x0B,0x0E,0x30,0x05,0xC0,0x29,0xAA,0x76,0x8C,0x9A,0x17,0x9D,0x9A,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xC2,0x0A,0x05,0xC4,0x0A,0x05,0x0F,0xC0,0x97,0x7B,0x9B,0xAA,0xC0,
+0x0E,0xC0,0x13,0x30,0x3D,0xA9,0x88,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x9A,0x89,0x90,0x75,0x04,0x0B,0x0E,0x04,0x19,0x29,0xBA,0x99,0x0B,0xC2,0x34,0x1E,0x05,0xC1,0x0A,
+0x05,0xDF,0xB7,0x71,0x01,0x29,0x05,0xC0,0x0A,0x05,0xD4,0xB7,0x74,0xA2,0x8A,0xAD,0xA9,0xC0,0x96,0x89,0x90,0x88,0x0A,0xA7,0x99,0x33,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,
+0xC0,0x22,0x2B,0x0B,0xC0,0x04,0x8E,0x9A,0x3D,0x0B,0xC0,0x01,0x94,0xA5,0x17,0x05,0xD6,0x1E,0xFE,0xE7,0x79,0xA4,0x9C,0xC1,0x9B,0x87,0x8D,0x98,0x15,0x14,0x33,0xB6,
+0x77,0x12,0x0E,0xC0,0x0B,0xC0,0x0E,0x19,0x0B,0xC0,0x2B,0x99,0x87,0x0B,0xC0,0x61,0x0B,0x0E,0xC0,0x19,0x2B,0x0E,0x0B,0xC0,0x34,0xFE,0x39,0xE4,0x36,0x37,0x0B,0x9B,
+0x9C,0x89,0x95,0x85,0x8A,0x99,0x9C,0xE1,0x20,0x35,0x88,0x9E,0x37,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0x0E,0x04,0x92,0x87,0x04,0x0B,0xC0,0x2B,0xFE,0x4A,0x86,0xA4,0x6A,
+0x0C,0xA8,0x8B,0xC1,0x3D,0x1E,0x87,0xAD,0x19,0x9D,0x99,0x33,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x9A,0x89,0x9C,0x75,0x0E,0xC0,0x0B,0x88,0x9B,0x18,0x0C,0x31,0xC3,0x21,
+0x83,0x86,0x9C,0x8A,0x05,0xD8,0x0F,0xFE,0xE7,0x38,0x31,0xC3,0x9E,0x75,0x3D,0xA4,0x8A,0x3D,0x26,0xBC,0x96,0xB8,0x76,0x0B,0x0E,0xC0,0x0B,0xC0,0x34,0xA4,0x87,0x0B,
+0xC0,0x19,0xFE,0x3A,0x06,0x37,0xAC,0x79,0xC0,0x0B,0x31,0xC1,0x33,0x87,0x85,0x87,0x9A,0x99,0x9C,0xE0,0x3F,0x27,0xFE,0x4A,0x27,0x95,0x78,0x05,0xD8,0x07,0x2A,0xA4,
+0x9C,0xC2,0x2D,0x8C,0x32,0x9A,0x55,0xA5,0xBB,0xB3,0xED,0x9B,0xA9,0x80,0x8B,0x2A,0xA4,0x88,0x69,0xC0,0x04,0x0B,0x96,0x86,0xA7,0x9A,0x0B,0x0E,0x11,0x92,0x88,0xB5,
+0x87,0x1D,0x9B,0x76,0xAD,0xCD,0xB6,0xCC,0x31,0xC1,0x2D,0x81,0x11,0x1D,0x0C,0x86,0x78,0x11,0x0E,0x5A,0x0E,0xC0,0x0B,0x19,0x0E,0xC0,0x2B,0xFE,0x4B,0x0A,0x2D,0x89,
+0x76,0x2C,0x97,0xDE,0xAC,0x54,0xBA,0xEC,0xAD,0xAD,0xC1,0x33,0x84,0x74,0x17,0x9D,0x9A,0xE0,0x13,0x24,0x91,0x9F,0x29,0x9C,0x87,0x05,0xD9,0x1E,0xFE,0xEF,0xBB,0x31,
+0xC1,0x54,0xFE,0x5B,0xA9,0x99,0x44,0xFE,0x00,0xA0,0xAB,0x66,0x15,0x0C,0x55,0x29,0x05,0xA2,0x86,0x0E,0x04,0x0B,0x96,0x86,0x2B,0x0B,0x2D,0x89,0x98,0xFE,0xEF,0xBB,
+0xFE,0x6B,0x88,0xA4,0x87,0x8C,0x8A,0x95,0x9D,0xDF,0x3F,0x27,0x0B,0x35,0x2A,0xA4,0x9C,0xCA,0x88,0x86,0x04,0x0E,0x0B,0xC0,0x9D,0x98,0x22,0x0E,0x33,0xB2,0x86,0x31,
+0xC4,0x1B,0x11,0xAC,0x98,0xA8,0x77,0x3D,0x3F,0xAC,0x85,0x17,0x05,0xDE,0xA6,0x87,0x27,0x92,0x9C,0x0B,0x92,0x86,0xAC,0x9A,0x0B,0x37,0xC0,0xAC,0x79,0xA5,0x9A,0xC0,
+0x1B,0x3D,0x91,0x9A,0x19,0x0B,0xC0,0x21,0x05,0x22,0x99,0xDD,0x5A,0xC1,0xA9,0x54,0x22,0x05,0xDB,0xFE,0x8C,0x6C,0x2B,0x96,0x79,0x33,0x2D,0xA6,0x99,0x31,0xC0,0x1B,
+0x33,0x3D,0x11,0xC0,0x0C,0xA8,0x76,0xC0,0x04,0x0B,0xC1,0x34,0xC0,0x0E,0x0B,0x2B,0x96,0x79,0x21,0x9A,0x8A,0xC0,0x2D,0xAA,0x97,0x36,0x04,0x6B,0xC0,0x2D,0x11,0x33,
+0xC0,0x11,0xC0,0x0C,0xA6,0x78,0x0B,0x0E,0x0B,0xC5,0x8F,0xA8,0x0E,0x0B,0xC0,0x12,0x0B,0xC1,0xFE,0x63,0x25,0x88,0x8F,0xDB,0xA5,0x87,0xBF,0x84,0xBA,0x88,0x0B,0xC0,
+0x0E,0x0B,0x0E,0x0B,0x12,0xC0,0x0B,0x0E,0x0B,0xC3,0x0E,0x04,0x0B,0xC0,0x92,0x86,0xAB,0x9A,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0xC0,0x2B,0x0F,0x05,0x32,0xB0,
+0x84,0xC0,0x9E,0x86,0x05,0x0A,0x05,0xD9,0xA6,0x87,0x00,0x04,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0xC5,0x0E,0x0B,0xC0,0x0E,0xC2,0x9C,0x76,0x97,0x8B,0xAB,0xA8,0xA2,0x78,
+0x04,0x0B,0xC5,0x3D,0x32,0x05,0xC0,0x36,0x17,0x05,0xDD,0xB0,0x74,0x0E,0xFE,0x52,0x26,0xA8,0x63,0x05,0xC0,0x0A,0x05,0xD9,0xA6,0x87,0xFE,0xAD,0x8E,0xB3,0x8A,0x0B,
+0xC0,0x0E,0x0B,0xCC,0x0E,0x96,0x76,0x2B,0x0B,0xC0,0x0E,0xC0,0x0B,0xC1,0x0E,0xC0,0x0B,0xC5,0x0E,0x0B,0xC1,0x34,0x2B,0x0B,0xC9,0xFE,0x41,0x44,0x6B,0x1E,0x8B,0x9B,
+0x05,0xDC,0x20,0x22,0x0E,0x0B,0xC7,0x0E,0x0B,0xC7,0x0E,0x0B,0x0E,0x1D,0xA6,0x52,0x05,0x0A,0x05,0xDB,0x20,0x22,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC6,0x0E,0x0B,0xC8,
+0x12,0x0B,0x04,0xC0,0x0B,0x0E,0x2A,0x0F,0x05,0xC2,0x20,0xA4,0x86,0x05,0xC0,0x0A,0x05,0xD8,0xA9,0x97,0x27,0x97,0x9B,0xA3,0xAA,0x94,0x78,0x05,0xDD,0xAE,0x85,0xFE,
+0xBE,0x54,0xAB,0xA8,0x0E,0x5A,0xC2,0x04,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0x95,0x8B,0x89,0xAA,0x29,0x33,0xB2,0x86,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0xC0,
+0x11,0x05,0xC0,0x0A,0x05,0xC0,0xA9,0x97,0xA6,0x75,0x0A,0x05,0xDA,0x36,0xA3,0x88,0x1A,0x98,0xFA,0xAF,0x51,0x05,0xDE,0x3C,0x31,0x0B,0xC1,0x69,0xC0,0x0B,0xC1,0x0E,
+0xC0,0x0B,0xC4,0x33,0x32,0x05,0xC1,0xBC,0x75,0x2A,0xA4,0x88,0xC0,0x0E,0xC0,0x0B,0xC0,0x2A,0x2D,0x36,0x14,0x8D,0x9F,0xDE,0x3C,0xFE,0xBE,0x54,0xAB,0xA8,0xA2,0x78,
+0xC1,0x04,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0x0E,0x2B,0x30,0x05,0xC4,0xBC,0x87,0xFE,0xF7,0xDB,0x0B,0xC2,0x12,0x11,0x05,0xC0,0x0A,0x05,0xC1,0xA9,0x85,0xA6,
+0x87,0x91,0x9D,0x0A,0x05,0xD8,0x0F,0xA3,0x95,0x96,0x6F,0x98,0xE9,0x0F,0x91,0x9A,0x97,0x9C,0xDE,0x06,0x3D,0x0B,0xC0,0x0E,0x04,0x0B,0xC7,0x2B,0x30,0x05,0xC4,0xA5,
+0x87,0x9C,0x9A,0x21,0x0B,0x12,0xC0,0x0B,0x19,0xFE,0x3A,0x06,0x05,0xC4,0xA9,0x85,0x3A,0x91,0x9D,0xD9,0xAB,0x86,0xB3,0x83,0x96,0x8A,0x1D,0x0B,0xC0,0x0E,0xC1,0x0B,
+0x0E,0xC0,0x0B,0xC1,0x33,0x05,0x0A,0x05,0xAA,0x78,0x30,0xB1,0x77,0x3A,0x05,0xDF,0xB0,0x94,0x20,0xA3,0x7D,0xBF,0xB7,0xA8,0x76,0xC7,0x0E,0x93,0x79,0x3F,0x17,0x26,
+0x33,0xB2,0x86,0xA6,0x77,0xC0,0x12,0x0B,0xC1,0x0E,0xC0,0x0B,0x21,0x17,0x05,0xC5,0x06,0x3C,0x05,0x0A,0x05,0xD6,0xB3,0x84,0x24,0x90,0x8C,0x26,0xA2,0x97,0xA2,0x78,
+0x1D,0xA5,0xA2,0x91,0x6D,0xB5,0xCB,0xFE,0xF7,0xB9,0x0B,0xC6,0x2A,0x29,0x0A,0xBB,0x86,0xB9,0x98,0x12,0x0B,0xC0,0x0E,0x34,0x3A,0x0E,0x0B,0x0E,0x0B,0x3D,0xFE,0x21,
+0x65,0x96,0x98,0xC6,0x3C,0x36,0x05,0xD7,0x2B,0xB6,0x84,0x96,0x98,0x9B,0x8E,0x36,0x26,0xC1,0x69,0xC1,0x26,0x2D,0xC0,0xA7,0x76,0xA8,0x63,0x05,0xC0,0x6E,0x05,0xDD,
+0x13,0x06,0x9B,0x69,0x05,0x30,0xBC,0x78,0x0B,0xC5,0x16,0x8A,0x88,0x33,0xB8,0x74,0x0B,0x0E,0x12,0x19,0x11,0xA7,0x87,0xAB,0xA8,0x0E,0x5A,0x0E,0x2A,0xFE,0x4B,0x0A,
+0x92,0xE9,0x2D,0xAE,0x53,0x06,0x90,0x9C,0xE0,0x29,0x9C,0x56,0x6B,0x05,0x14,0x30,0xBB,0x86,0x0B,0xC1,0x0E,0x0B,0x21,0x3F,0x21,0x0E,0x0B,0x34,0x33,0x9F,0x85,0x11,
+0x0C,0x0B,0xC2,0x15,0x82,0x8C,0x0A,0x17,0x9D,0x9A,0xC0,0xBC,0x75,0xBC,0x97,0x0E,0x0B,0xC1,0x05,0xB5,0x87,0x0E,0x5A,0x0E,0xC0,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,
+0xC0,0x05,0x84,0x9B,0xC8,0xA5,0x87,0x06,0x26,0xC1,0xAF,0x44,0x99,0xA8,0x05,0xE1,0x29,0x20,0x9D,0x68,0xA3,0x77,0x05,0xC0,0x6E,0x05,0xAF,0x87,0xBE,0x97,0x0B,0xC0,
+0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x0B,0x0E,0x12,0x0E,0xC0,0x0B,0x0E,0xC0,0x9C,0x79,0x26,0x2D,0x13,0x24,0x08,0x05,0xE1,0xB0,0x74,0x20,0x05,0xAF,0x33,0x93,
+0xDD,0x05,0xC4,0xAF,0x87,0x11,0x0C,0xA8,0x87,0x0B,0xC4,0x97,0x9A,0x82,0x6A,0x05,0xE4,0x06,0xA8,0x95,0x26,0xC0,0x0D,0x22,0x05,0xE2,0x3C,0x36,0x05,0x24,0x93,0xDD,
+0x05,0x0A,0x05,0xC4,0xB0,0x88,0x33,0xAD,0x78,0x3A,0x0B,0xC0,0xFE,0x41,0x45,0xC0,0xAF,0x43,0x93,0x99,0x05,0xE2,0x3C,0x20,0x05,0x24,0x99,0xBB,0x05,0xC8,0xA7,0x85,
+0x29,0x30,0xC0,0x26,0x13,0x27,0x87,0xAF,0x05,0xE2,0xA9,0x85,0x3C,0x92,0x8B,0x37,0xAB,0x66,0x98,0x99,0x99,0xBB,0x17,0x0A,0x05,0x0A,0x05,0xC2,0x10,0xAC,0x43,0x24,
+0x05,0x6B,0x2B,0xB9,0x10,0xAE,0x52,0x9C,0x99,0x95,0x8A,0x98,0xCD,0x9A,0x89,0x5A,0xC1,0x08,0xAD,0x52,0xAA,0x88,0xA4,0x76,0x89,0xBE,0xFE,0x00,0xA0,0x05,0xE6,0x3C,
+0xAD,0x85,0x91,0x9F,0xFE,0x6E,0x26,0x26,0x2D,0xC0,0x26,0x2D,0x24,0x85,0xAF,0x05,0xE7,0xAF,0x54,0x0D,0xA3,0x86,0xC4,0x0E,0xFE,0x5B,0xA9,0xC0,0x36,0x0D,0x06,0x15,
+0x0A,0xAE,0x33,0x36,0x18,0xC4,0x12,0xFE,0x6B,0xAB,0x16,0xA3,0x21,0xFE,0x76,0x67,0x18,0x0E,0xFE,0x09,0x81,0x19,0x9C,0xAA,0xC3,0x0A,0xAF,0xA6,0x1E,0x98,0x97,0x05,
+0xE3,0x19,0x05,0x37,0xC1,0x24,0x36,0xA7,0x75,0x18,0x1A,0x18,0xC1,0xFE,0x54,0xE7,0xFE,0x6B,0xAB,0x16,0xC0,0x36,0x18,0x9D,0x9A,0x15,0xFE,0x00,0x60,0x14,0x08,0x37,
+0xC0,0xA7,0x54,0x2E,0xC1,0x24,0x9C,0xAA,0x59,0x19,0x9C,0xAA,0xD7,0xB4,0x72,0xC0,0x3D,0x6E,0x9D,0x44,0xA5,0x66,0xA4,0xAA,0xA1,0x54,0x0C,0x2E,0x0C,0xC1,0x9C,0xAA,
+0xA9,0x54,0x36,0x18,0x9D,0x9A,0x18,0xC1,0x99,0x9C,0x31,0x16,0xC0,0x36,0x18,0x1A,0x9A,0x89,0x13,0x0C,0xAB,0x64,0xA4,0x63,0xA8,0x75,0x25,0x29,0xFE,0x01,0x00,0x05,
+0xC0,0x19,0xA7,0x77,0x24,0xFE,0x45,0x03,0x25,0x0D,0x2C,0x0E,0xFE,0x09,0x81,0x19,0x05,0xC0,0x6E,0xC0,0xB7,0x21,0x0D,0x18,0xC3,0x92,0x9E,0x31,0xA3,0x55,0xB0,0x52,
+0x18,0xC1,0x8F,0x9C,0x36,0x18,0xC2,0x0D,0x0C,0x05,0x0A,0x05,0xC0,0x37,0x18,0xC3,0x39,0x06,0x0A,0x05,0xC1,0x06,0x13,0xB2,0x50,0x18,0xC3,0x0D,0x9C,0x89,0x1F,0x18,
+0xC1,0x25,0x39,0x1F,0x1A,0x18,0xC1,0x0E,0xFE,0x01,0x00,0x05,0xC0,0xA4,0x66,0x05,0x06,0x3E,0x0E,0x0D,0x18,0xC0,0x1A,0x18,0x3E,0x05,0x0A,0x05,0xC1,0x10,0x59,0x0A,
+0xC0,0x05,0xD2,0x3F,0xAE,0x85,0x0A,0x1E,0x98,0x97,0xFE,0x69,0x01,0x79,0xA2,0xA7,0xA1,0xB8,0x7B,0x1D,0x27,0x8A,0x9D,0x05,0xDA,0xA7,0x78,0x0E,0xA8,0x75,0x18,0xC9,
+0xFE,0x23,0x03,0x0F,0x05,0x6E,0xA7,0x66,0xFE,0x54,0xE7,0x1A,0x2C,0x99,0x98,0x2C,0x18,0xC5,0x39,0xFE,0x00,0xA0,0x0A,0x0C,0x0D,0x18,0xC1,0x2C,0xFE,0x02,0x00,0x0A,
+0x67,0x17,0x05,0xC1,0x2E,0x28,0x05,0xD3,0x3C,0xAB,0xA4,0xFE,0x99,0x61,0x9F,0xB8,0x56,0xC0,0x3D,0x03,0xFE,0x65,0xA7,0x18,0x06,0x18,0xC8,0x97,0x9A,0x10,0x05,0x6E,
+0x05,0x13,0x1F,0x18,0xC0,0x97,0x9A,0x0E,0x06,0x18,0xC3,0xFE,0x23,0x03,0x04,0x05,0xC0,0x6E,0x05,0xD8,0x3F,0x36,0x18,0xCB,0x8F,0xAD,0xFE,0x00,0xA0,0x05,0xC0,0xB5,
+0x20,0x06,0x18,0xC2,0x12,0xAA,0x76,0x0D,0x18,0xC0,0x2C,0xFE,0x09,0x81,0x19,0x05,0xC1,0x08,0x36,0x18,0xC0,0x39,0x19,0x05,0x0A,0x05,0xC2,0xAB,0x55,0x06,0x0A,0x05,
+0x0A,0x05,0xC0,0x7A,0x05,0xCD,0x2B,0xB2,0x72,0x05,0xC0,0xAF,0x33,0x36,0x18,0xC3,0x25,0x50,0xA6,0x88,0x18,0x8B,0xBF,0xFE,0x00,0x60,0x66,0x05,0xC1,0x0F,0xB3,0x31,
+0x36,0x18,0x25,0xFE,0x09,0x21,0x05,0x0A,0x05,0xC3,0xAF,0x54,0x28,0x05,0xC0,0x28,0x0A,0x37,0x0E,0x18,0xC5,0x97,0x9A,0x39,0x8A,0xCE,0x05,0xC5,0x08,0x36,0x0D,0x84,
+0xAF,0x05,0xC5,0x37,0x24,0x05,0x6E,0xB2,0x33,0x0A,0xC0,0x12,0x18,0xC7,0x39,0x92,0xBD,0x8D,0xEF,0x05,0xC4,0x0C,0x0E,0x08,0xFE,0x08,0x20,0x05,0xC5,0x31,0x28,0x05,
+0xB5,0x84,0x27,0x8A,0x9D,0x05,0xDC,0xFE,0x3B,0xE5,0x0D,0x18,0xCC,0x8F,0x9C,0x19,0x05,0x15,0x1A,0x18,0xC8,0x12,0xFE,0x02,0x00,0x05,0x0A,0x05,0xC2,0x2E,0x0C,0x0F,
+0x05,0xC4,0x0A,0x37,0x24,0x0A,0x05,0x0A,0x05,0xD1,0xAF,0x87,0x36,0xA6,0x86,0x05,0x0A,0x05,0xDB,0xB8,0x10,0xB7,0x62,0x18,0xCC,0x99,0x9C,0x10,0x05,0xB7,0x10,0x1A,
+0x18,0xC9,0x2C,0x91,0x9B,0xFE,0x01,0x00,0x0A,0x05,0xC2,0x37,0x2E,0x28,0x0A,0xC1,0x05,0xC2,0xAF,0x54,0x28,0x99,0xDC,0x0A,0x05,0xD1,0x0A,0x18,0xCD,0x3B,0x28,0x0C,
+0x0D,0x18,0xCA,0x1A,0x0E,0x19,0x28,0x05,0xC0,0xA4,0x66,0x05,0x37,0x2E,0x37,0x0A,0x05,0xC3,0x03,0x31,0x19,0x20,0x24,0x9B,0x87,0x05,0xDD,0xAB,0x55,0xFE,0x55,0x63,
+0x18,0xCD,0x25,0xFE,0x02,0x00,0x0C,0x0D,0x18,0xCD,0x39,0x0C,0x05,0xC2,0x2B,0x31,0x9C,0x89,0x05,0xC4,0x2E,0x9B,0x88,0x05,0xD3,0x03,0x04,0x28,0x12,0x18,0xCE,0x15,
+0x0C,0x0D,0x18,0xCE,0x0D,0x95,0x99,0xFE,0x0A,0x00,0x05,0xC2,0xAF,0x53,0x9C,0x79,0x05,0xC3,0xA7,0x85,0x2E,0x93,0xCC,0x05,0xD3,0x04,0xFE,0x99,0x61,0x0D,0x18,0xD0,
+0x25,0xFE,0x23,0x03,0x28,0x05,0xC0,0x31,0xA8,0x36,0x99,0xBB,0x05,0xC3,0x24,0x37,0x05,0xC0,0xA4,0x66,0x05,0xC4,0x0D,0x18,0xD1,0x0D,0x3B,0x28,0x9A,0xBB,0x05,0x2B,
+0xAA,0x55,0x28,0x0A,0x05,0x0A,0x05,0x06,0x2E,0x19,0x10,0x06,0x10,0x37,0x10,0x05,0xC0,0x0A,0xFE,0x5C,0xE8,0x1F,0x18,0xC2,0x6F,0x18,0xC8,0x12,0x1A,0x18,0xD3,0x29,
+0x0F,0x14,0x05,0x37,0x2E,0x0F,0x05,0xC2,0xB5,0x20,0x13,0x37,0x05,0x19,0xA1,0xAA,0x10,0x06,0x10,0xC0,0x05,0xFE,0x3B,0xE5,0x1F,0x18,0xCD,0x35,0xA9,0x97,0x18,0xD3,
+0x25,0xFE,0x09,0x81,0x05,0xC1,0x38,0x19,0x05,0xC1,0x10,0x2E,0x2B,0x05,0x0A,0x05,0xA4,0x86,0x32,0x28,0x37,0xA7,0x66,0x3F,0x0A,0x05,0x10,0x06,0x0A,0x05,0xC0,0x03,
+0xA3,0x87,0x7B,0x15,0x37,0x10,0x39,0x18,0xCE,0x0E,0x18,0xD4,0x0C,0x05,0xC1,0x15,0x06,0x19,0x24,0x06,0x0A,0x05,0xC0,0x2E,0xA0,0x65,0x06,0x19,0x05,0xC0,0x0A,0xC1,
+0x05,0x17,0x05,0xC6,0xBB,0x82,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0xFE,0x2B,0x24,0x18,0xCE,0x39,0xAE,0x73,0x18,0xD2,0x0D,0x13,0xFE,0x00,0x20,0xC1,0x03,0x2E,0x06,0x19,
+0x05,0x15,0xC0,0x2E,0xC0,0x06,0x10,0x06,0x10,0x05,0xCB,0xAB,0x86,0xAF,0xA5,0x3D,0xA2,0x87,0xFE,0x6B,0x85,0x89,0x9F,0x05,0x6E,0x05,0xDE,0x31,0xFE,0x55,0x63,0xA6,
+0x88,0x18,0xCC,0x12,0x1A,0x18,0xD2,0x2C,0xFE,0x01,0x60,0x05,0xC1,0xA7,0x85,0x0C,0x98,0x99,0x05,0xC1,0x2B,0x05,0xC2,0x6E,0x2E,0x98,0x99,0x05,0xC0,0x19,0x05,0xC6,
+0x7A,0xB7,0x64,0xFE,0x82,0xA4,0x3D,0x7E,0x6E,0x04,0x1F,0x9C,0x8A,0xE0,0x2B,0xB9,0x10,0x1A,0x18,0xCC,0x0E,0xA4,0x88,0x18,0xD2,0x39,0x19,0x05,0xC1,0xAF,0x33,0x28,
+0x9A,0xBB,0x05,0xC1,0xA8,0x55,0x15,0xC0,0x37,0x10,0x06,0xA4,0x98,0x10,0x0A,0xC0,0x05,0xC7,0xA9,0x85,0x22,0x33,0xA1,0xA9,0x6E,0xC0,0xFE,0x6B,0xC8,0x1F,0x9C,0x8A,
+0xE1,0x0C,0x0D,0x18,0xCC,0x2C,0x0E,0x18,0xD2,0xFE,0x23,0x41,0x19,0x9D,0xAA,0x05,0x17,0x31,0x28,0x0A,0xC0,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0xA2,0x77,0x05,0x17,0x2A,
+0x0F,0x14,0x05,0xC7,0xB5,0x84,0xA4,0xC6,0x3D,0xA2,0x87,0xC1,0x37,0x12,0x18,0xCD,0x94,0x8B,0xA9,0x97,0x18,0xD0,0x25,0x37,0x05,0xC1,0xAA,0x66,0x10,0x05,0xC4,0x2B,
+0x32,0x05,0xC0,0x6E,0xC0,0x03,0x37,0x05,0xC0,0x19,0x05,0xC4,0x20,0xB3,0x83,0xFE,0x99,0x61,0x05,0xB5,0x20,0x0D,0x06,0x18,0xCB,0x12,0x1A,0x18,0xC6,0x1A,0x18,0xC7,
+0xFE,0x23,0x41,0x0F,0x05,0xC0,0xA8,0x55,0xA2,0x99,0x0F,0x14,0x05,0xC1,0x0F,0x05,0x37,0x10,0xC0,0x59,0x10,0xC0,0x06,0x10,0x05,0x0A,0x05,0x0A,0x05,0xC2,0x17,0xB5,
+0x85,0xFE,0x8A,0xC5,0xFE,0xB1,0x81,0x0A,0x37,0xFE,0x54,0xE7,0xAA,0x62,0x18,0xCA,0x0D,0x92,0x9A,0xA8,0x75,0x0D,0x06,0x2C,0x18,0x0D,0x06,0x0D,0x06,0x0D,0xC0,0x06,
+0x0D,0xC1,0x06,0x0D,0x2C,0x0E,0xFE,0x0A,0x00,0xFE,0x00,0x20,0x37,0xC0,0x0C,0x28,0x19,0x05,0xC1,0xA2,0x77,0x05,0xC5,0x2B,0x31,0x2E,0x0F,0x66,0x05,0xC0,0x0A,0xC0,
+0x05,0xC0,0xB0,0x74,0xA9,0xB5,0xFE,0xA1,0xC1,0x9C,0xB9,0xB5,0x67,0xA6,0x88,0xC0,0x6E,0xDE,0x96,0x99,0x3C,0xC0,0x9D,0x88,0x99,0x99,0x9C,0xA9,0x41,0x3D,0x18,0x00,
+0xC0,0xA4,0x88,0xC0,0xA2,0x78,0x3C,0x01,0xC0,0x3C,0xC0,0x01,0x3C,0xC0,0x01,0x3C,0xC0,0x39,0x28,0xC0,0x19,0x00,0x18,0x3D,0xA4,0x74,0xA3,0x99,0xA5,0x87,0xC0,0xA3,
+0x98,0xA2,0x77,0xC1,0x47,0xC0,0xA0,0xA9,0x01,0xC4,0x3E,0x47,0xA2,0x95,0x35,0x3C,0x2B,0xC0,0x52,0x0F,0xC3,0x9E,0x85,0x9D,0x9A,0x6F,0xA3,0x87,0x6B,0xC1,0xA4,0x96,
+0xC1,0xA2,0x78,0xA2,0x78,0x35,0xC0,0x3C,0x3A,0xC1,0x67,0x01,0xC6,0x3E,0xC0,0x2B,0x1E,0x39,0x20,0x9B,0x9A,0x9C,0x88,0x52,0x9C,0x8B,0x7E,0x55,0x9B,0x9A,0xC6,0x6E,
+0x05,0xC2,0x0A,0x05,0x2B,0xA2,0x86,0xA4,0x89,0xA4,0x86,0xA4,0x88,0x0F,0x16,0xC0,0x27,0x35,0x6B,0x35,0x9E,0x7C,0x67,0xC1,0x01,0x9C,0x95,0x06,0x20,0x2B,0x9B,0xAA,
+0x05,0xCF,0x0A,0x05,0xC2,0x0A,0x05,0xC3,0x0A,0xA2,0x87,0x31,0x20,0xA4,0x86,0x26,0x0F,0x16,0x35,0x07,0x06,0x9E,0x8B,0x0A,0x05,0xC7,0x0A,0x05,0xDB,0x31,0x3A,0x22,
+0x16,0x0F,0xA3,0x97,0x35,0x3E,0x9E,0x6B,0x3C,0xC0,0x01,0x3C,0x01,0xC6,0x3C,0x39,0x01,0xC1,0x19,0x3D,0xC0,0x18,0x17,0x12,0xAC,0x76,0x27,0x38,0x9C,0x8E,0x3C,0x01,
+0xCB,0x19,0x93,0xAA,0x3D,0xA5,0x67,0xC0,0x05,0xC1,0x31,0x14,0x24,0x35,0x3A,0xC0,0x3C,0x01,0xC7,0x19,0x3D,0x40,0x1D,0xC1,0x05,0xC3,0x2B,0xA9,0x97,0x16,0x35,0x47,
+0x3E,0x01,0xC0,0x66,0x01,0xC2,0x19,0x3D,0x1F,0x1D,0xC2,0x05,0xA7,0x87,0xAF,0x82,0x38,0x35,0x3C,0x90,0x99,0x3D,0x1D,0xC0,0x05,0xC1,0xAF,0x84,0x16,0xC0,0x3A,0x1D,
+0xC1,0x05,0xC2,0x2B,0x0F,0x16,0x29,0x9E,0x5A,0x1D,0x05,0xC4,0x3A,0x24,0x0F,0x18,0x0F,0x12,0x05,0xC0,0x0A,0x05,0xED,0x3F,0xAF,0x82,0x24,0x29,0x1D,0x1A,0xAA,0xB5,
+0x17,0x05,0xD1,0xFE,0x8C,0x6C,0xB9,0x88,0x99,0x87,0x36,0x8C,0x8A,0x0A,0x05,0xC2,0x3C,0xA3,0x96,0x96,0x7A,0x05,0xC0,0x6E,0x05,0xE4,0x7F,0x16,0x0A,0x05,0xD2,0xFE,
+0x9D,0x2D,0xB6,0x89,0x7B,0xC2,0x9C,0x76,0x86,0x8A,0x12,0x05,0xC0,0x3C,0xFE,0xBE,0x31,0x04,0x0E,0x5A,0x2B,0x92,0x98,0x88,0x79,0x17,0x05,0xC0,0x0A,0x05,0xD6,0x0A,
+0x05,0xC9,0x39,0x3E,0x20,0x05,0x0A,0x05,0xD1,0x1F,0x2B,0x0B,0x0E,0x0B,0x0E,0x0B,0x15,0x88,0x9A,0x12,0x05,0xC0,0x32,0x15,0x0E,0x0B,0x0E,0xC0,0x98,0x77,0x3E,0x8D,
+0x99,0x17,0x9D,0x9A,0xD2,0xB5,0x84,0x15,0x0B,0x0E,0xC2,0x0B,0x2B,0x89,0x88,0x85,0x9B,0x97,0x9C,0xA9,0x85,0x21,0x04,0x0B,0x0E,0xC0,0x0B,0x1E,0x87,0x9D,0xC0,0x0A,
+0x05,0xD1,0x06,0x34,0x0B,0x0E,0x0B,0x0E,0xC0,0x0B,0xC0,0x2B,0x00,0x85,0x9B,0x97,0x9C,0x36,0x19,0x0E,0x2B,0x19,0x0B,0xFE,0x6B,0xAB,0xA4,0x98,0x32,0x69,0x8C,0x8A,
+0x9E,0x8B,0x21,0xB0,0x9B,0x94,0x88,0xAA,0x89,0x0B,0xC0,0x0E,0x0B,0x96,0x86,0x87,0x9B,0x31,0x99,0x9C,0xC1,0x0A,0x05,0xE0,0x36,0x21,0x83,0x8B,0x05,0xC0,0x0A,0x05,
+0xC1,0x3C,0x36,0x8F,0x9B,0x29,0x6C,0x30,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0xFE,0x18,0xE2,0xB1,0x68,0x00,0x21,0xA5,0x78,0xA2,0x8A,0xA2,0x97,0xC0,0x0B,0x21,0x32,0x3A,
+0xBA,0x74,0xBB,0x98,0x0E,0x5A,0xC2,0x0E,0xC0,0x0B,0x0E,0x0B,0x34,0x82,0x89,0xC0,0x34,0x0E,0x04,0x0B,0xC4,0x0C,0x85,0x86,0x12,0x05,0xD9,0x17,0x05,0x0A,0x05,0xC2,
+0x6B,0x05,0xC0,0xA9,0x97,0x27,0x20,0x1D,0x0E,0x05,0xD5,0x1F,0xBB,0x98,0x0E,0x0B,0xC1,0x0E,0x0B,0xC5,0x22,0x1F,0xBC,0x98,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x30,0x05,
+0xC0,0x29,0xAA,0x76,0x8C,0x9A,0x17,0x9D,0x9A,0xCA,0x0A,0x05,0xC7,0x14,0x05,0xC2,0x0A,0x05,0xC4,0x0C,0x14,0xFE,0xDE,0xF8,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x04,
+0x0B,0xC0,0x8A,0x86,0xAC,0x88,0x0B,0x0E,0x0B,0x0E,0x0B,0x01,0x66,0xC0,0x01,0xC0,0x3C,0x01,0xC2,0x3C,0x01,0xC0,0x3C,0x01,0xC0,0x1E,0x8B,0x9B,0x05,0xD6,0x1E,0x32,
+0x8F,0x8D,0x9B,0x98,0x7E,0xAA,0x96,0xB2,0x76,0x3D,0xA9,0x88,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x9A,0x89,0x21,0x04,0x0B,0x0E,0x0B,0x19,0x29,0xBA,0x99,0x0B,0xC0,0x0E,
+0x07,0xA3,0x89,0xA3,0x88,0xC0,0xA3,0x88,0x01,0x3C,0xC1,0x01,0xC5,0x9A,0xA5,0x05,0xC0,0x0A,0x05,0xD4,0xB7,0x74,0xA2,0x8A,0xAD,0xA9,0xC0,0x96,0x89,0x90,0x88,0x0A,
+0xA7,0x99,0x33,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0xC0,0x22,0x2B,0x0B,0xC0,0x04,0x8E,0x9A,0x3D,0x0B,0xC3,0x0E,0xC0,0x0B,0xC0,0x0E,0x9A,0x89,0x0B,0xC0,0x2B,0x99,0x87,
+0x0B,0xC0,0x0E,0x0B,0x93,0x89,0xFE,0x42,0x28,0x05,0x25,0xB0,0x73,0x8E,0x9A,0x05,0x0F,0xFE,0xE7,0x38,0xA6,0x8C,0xC3,0x3D,0x00,0x14,0x33,0x12,0x69,0xC0,0x0E,0xC0,
+0x0B,0xC1,0x0E,0x96,0x76,0x2B,0x0B,0xC1,0x34,0x3C,0x36,0x37,0x0B,0x9B,0x9C,0x89,0x95,0x85,0x8A,0x05,0xE1,0xAB,0x86,0xB3,0x83,0x12,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,
+0x04,0x92,0x87,0x04,0x0B,0xC0,0x2B,0xFE,0x4A,0x86,0xA4,0x6A,0x0C,0xA8,0x8B,0xC1,0x3D,0x1E,0x17,0x05,0x33,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,0x9A,0x89,0x9C,0x75,0x0E,
+0xC0,0x0B,0x88,0x9B,0x18,0x0C,0x31,0xC3,0x21,0x83,0x86,0x05,0xFE,0xEF,0xBB,0x9D,0x9A,0x0B,0x31,0xC1,0x33,0x1F,0x87,0x9A,0x99,0x9C,0xE0,0xA9,0x85,0x16,0x90,0x89,
+0xA3,0x87,0xA4,0x85,0x17,0x9D,0x9A,0xD8,0x1E,0x2B,0xA3,0x9E,0xC1,0x54,0xFE,0x5B,0xAA,0x9B,0x44,0x98,0x99,0xA5,0x66,0xAA,0xA9,0xBC,0xED,0x82,0x89,0xAE,0x88,0x0B,
+0xC0,0x0E,0xC0,0x0B,0x96,0x86,0x0E,0xC0,0x2B,0xFE,0x4B,0x0A,0x2D,0x38,0x93,0x67,0xAA,0x52,0x0C,0x55,0x29,0xFE,0xEF,0xBB,0x0B,0x0E,0x04,0x0B,0x96,0x86,0x0B,0xFE,
+0x1B,0x41,0x1D,0x05,0x31,0x30,0x3D,0x0B,0x0E,0xC0,0x5B,0x19,0xA6,0x88,0x0B,0x34,0xC0,0x0B,0x30,0x33,0x31,0x1B,0x3D,0x2D,0x33,0x31,0xC1,0x0C,0x9B,0x77,0xAB,0xA8,
+0x83,0x87,0x8C,0x8A,0x14,0x0E,0x15,0x19,0xAA,0x8A,0x30,0x31,0xC6,0x1B,0x89,0x98,0x05,0x9C,0x97,0x29,0x9D,0xA9,0x90,0x7B,0xBB,0x84,0x0E,0x0B,0xC0,0x0E,0x0B,0x92,
+0x86,0x3A,0x0B,0x37,0xC0,0xAC,0x79,0xA5,0x9A,0xC0,0x1B,0x3D,0x91,0x9A,0x19,0xA6,0x78,0x0E,0x0B,0x04,0x0B,0xC1,0x34,0xC0,0x0E,0x0B,0x2B,0x96,0x79,0x21,0x33,0xC0,
+0x2D,0xAB,0x96,0x12,0x0B,0xC0,0xFE,0x49,0xA6,0xAB,0x64,0x92,0x79,0x97,0x9C,0xDA,0x14,0xFE,0x8C,0x6C,0x04,0x0E,0x0B,0x2D,0x11,0x33,0xC0,0x11,0xC0,0xAC,0x98,0xA6,
+0x78,0x0E,0xC0,0x0B,0xC5,0x8F,0xA8,0x0E,0x0B,0xC5,0x12,0x0B,0xC1,0xFE,0x6B,0xAB,0x17,0xA5,0x9A,0xAB,0x84,0x9B,0xDD,0xAA,0x41,0x88,0x8F,0xDB,0xA5,0x87,0xBF,0x84,
+0xBA,0x88,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0x12,0x0B,0xC0,0x0E,0x0B,0xC3,0x0E,0x04,0x0B,0xC0,0x92,0x86,0xAB,0x9A,0x0B,0xC1,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0xC0,0x2B,
+0x0F,0x05,0xA5,0x88,0x07,0x9C,0xCB,0xA0,0x53,0x05,0x0A,0x05,0xD9,0xA6,0x87,0xBE,0x73,0x04,0x0E,0x0B,0xC0,0x0E,0x04,0x0B,0xC5,0x0E,0x0B,0xC0,0x0E,0xC2,0x9C,0x76,
+0x97,0x8B,0xAB,0xA8,0xA2,0x78,0x04,0x0B,0xC5,0x3D,0xFE,0x10,0xC1,0x05,0xC0,0xB5,0x84,0x0E,0xFE,0x5B,0x27,0x08,0x05,0x0A,0x05,0xD9,0xA6,0x87,0xFE,0xAD,0x8E,0x0B,
+0xC1,0x0E,0x0B,0xCC,0x0E,0x96,0x76,0xA7,0x9A,0x0B,0xC0,0x12,0x0E,0x0B,0xC0,0x0E,0x0B,0xC2,0xFE,0x5B,0x4A,0x05,0xC1,0x22,0x94,0x89,0x05,0xDC,0x3A,0x35,0x0B,0xC2,
+0x0E,0xC0,0x0B,0xC5,0x0E,0x0B,0xC1,0x34,0x15,0x88,0x9A,0x05,0x0A,0x05,0xC0,0x3C,0x53,0x05,0xDC,0x1E,0x9E,0x75,0x93,0x9F,0x9F,0xD9,0xA7,0x77,0xA6,0x52,0x05,0x0A,
+0x05,0xDB,0x20,0xFE,0xBD,0xD1,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC6,0x0E,0x0B,0xC8,0x12,0x0B,0x04,0xC0,0x0B,0xC0,0x25,0x33,0xB2,0x86,0x0B,0x0E,0xC0,0x0B,0x0E,0xC0,
+0x0B,0xC0,0x11,0x05,0xC0,0x0A,0x05,0xC0,0x20,0x05,0xC0,0xBC,0x75,0x2A,0x0E,0x0B,0x0E,0xC0,0x0B,0xC0,0x2A,0xFE,0x3A,0x06,0x91,0x9A,0xC3,0xA9,0x85,0xA0,0xCC,0xAA,
+0x43,0x14,0x8D,0x9F,0xDE,0x3C,0xFE,0xBE,0x54,0xAD,0x98,0xC2,0x04,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0x0E,0x2B,0x30,0x05,0xC4,0x16,0xFE,0xF7,0xDB,0x0B,0xC3,
+0x2D,0xAF,0x51,0x91,0x8C,0x97,0x9C,0xDE,0xB0,0x74,0x3D,0x0B,0xC0,0x0E,0x59,0x0B,0xC7,0x2B,0x30,0x05,0xC4,0xA5,0x87,0x9C,0x9A,0x21,0x0B,0x12,0x0B,0xC0,0x0C,0x37,
+0xA8,0x77,0x0C,0x21,0x33,0x12,0x0B,0xC0,0x9D,0x98,0x16,0x05,0xC5,0xA9,0x85,0xA6,0x87,0x91,0x9D,0xD7,0x14,0xA4,0x76,0xB3,0x85,0x32,0x98,0x7F,0x0E,0x0B,0xC0,0x9D,
+0x98,0xFE,0x4A,0x86,0x0A,0xBB,0x86,0x3D,0x12,0x0B,0x0E,0x13,0x39,0x89,0xAF,0xC0,0x0A,0x05,0xDD,0x13,0x06,0x9B,0x69,0x05,0x30,0xBC,0x86,0x0B,0xC5,0x16,0x8A,0x88,
+0x33,0x04,0x0B,0x0E,0x12,0x19,0x11,0xA7,0x87,0xAB,0xA8,0xA2,0x78,0x2A,0x0B,0xC1,0x0E,0xC0,0xFE,0x41,0x44,0x9E,0x15,0x05,0xC1,0xB4,0x67,0x0C,0x12,0x0E,0x0B,0x2B,
+0x0B,0xC1,0xFE,0x09,0x21,0x05,0xC0,0x0A,0x05,0xAF,0x87,0xBE,0x97,0x0B,0x0E,0xC1,0x0B,0x0E,0x10,0x17,0x05,0xC2,0x31,0x30,0x3D,0x0B,0xC2,0x1D,0xAB,0x64,0x08,0x05,
+0xE1,0x13,0x20,0x05,0xAF,0x33,0x93,0xDD,0x05,0xC4,0xAF,0x87,0x11,0x0C,0xA8,0x87,0x0B,0xC4,0x3D,0x82,0x6A,0x05,0xE4,0x06,0xA8,0x87,0x3C,0x9E,0x8B,0x10,0x97,0xBB,
+0x05,0x0A,0x05,0xC4,0x25,0x33,0xAD,0x78,0x3A,0x0B,0xC0,0x9A,0x99,0x33,0x82,0x8A,0x05,0xE4,0x31,0x1E,0x26,0x6B,0xAF,0x43,0x93,0x99,0x05,0xE2,0x3C,0x20,0x05,0xAA,
+0x66,0x74,0x3C,0x92,0x8B,0xA8,0x55,0xAB,0x66,0x98,0x99,0x99,0xBB,0x17,0x0A,0x05,0x0A,0x05,0xC2,0x06,0x9A,0xCC,0xAB,0x85,0x05,0xA5,0x87,0xB9,0x10,0xAE,0x52,0x9C,
+0x99,0x95,0x8A,0x98,0xCD,0x9A,0x89,0x5A,0xC1,0x08,0xAD,0x52,0xAA,0x88,0x0F,0x99,0xA8,0x05,0xE4,0x06,0x05,0x6E,0x05,0xE4,0x3C,0x05,0xC0,0x08,0xFE,0x6E,0x26,0xA2,
+0x88,0x6D,0xC4,0x9D,0x9B,0x06,0x18,0x1A,0x9A,0x89,0x10,0x05,0x0A,0x05,0xE3,0x2B,0x0F,0x3D,0x05,0xC1,0x0C,0x0D,0x18,0xC4,0x0E,0xFE,0x5B,0xA9,0xC0,0x36,0x0D,0x06,
+0x89,0xBF,0x0A,0x05,0xE4,0x3F,0x0F,0x88,0x9E,0x0A,0x05,0x24,0x36,0x18,0xC4,0x12,0x16,0xC0,0xA3,0x21,0x1A,0x18,0x0E,0xFE,0x09,0x81,0x05,0xC4,0x0A,0x05,0xC0,0xA2,
+0x77,0x14,0x05,0xD9,0x20,0xA5,0xA8,0x18,0xC0,0x1A,0x18,0xC1,0xFE,0x54,0xE7,0xFE,0x6B,0xAB,0x16,0xC0,0x36,0x18,0x9D,0x9A,0x15,0x0F,0x62,0x7A,0x37,0xC0,0xA7,0x54,
+0xA0,0xAB,0xC2,0xAC,0xC6,0x90,0x8A,0x05,0xDF,0xAA,0x33,0x10,0xA4,0xAA,0xA1,0x54,0x0C,0x2E,0x0C,0xC1,0x9C,0xAA,0xA9,0x54,0x36,0x18,0x06,0x18,0xC1,0x99,0x9C,0x31,
+0x16,0xC0,0x36,0x18,0x1A,0x25,0x13,0x0C,0xAB,0x64,0xA4,0x63,0xA8,0x75,0x25,0x29,0xFE,0x01,0x00,0x05,0x0F,0x05,0xC0,0x6E,0xC0,0xB7,0x21,0xB7,0x62,0x18,0xC3,0x92,
+0x9E,0x31,0xA3,0x55,0x19,0x18,0xC1,0x8F,0x9C,0x36,0x18,0xC2,0x0D,0x0C,0x05,0x0A,0x05,0xC0,0x37,0x05,0xC2,0xAB,0x44,0x13,0xB2,0x50,0x18,0xC3,0x0D,0x9C,0x89,0x18,
+0xC2,0x25,0x39,0x18,0x1A,0x18,0xC1,0x0E,0xFE,0x01,0x00,0x05,0xC0,0xA4,0x66,0x17,0x24,0x99,0x89,0x05,0xDB,0x0C,0x0D,0x18,0xC7,0x39,0xFE,0x09,0x21,0x05,0x0A,0x05,
+0xC0,0xB8,0x21,0x39,0x2C,0x18,0x1A,0x18,0xC6,0x06,0xFE,0x1A,0xC1,0x0E,0x18,0xC1,0x1A,0x18,0x3E,0x05,0x0A,0x05,0xC1,0xAB,0x55,0x59,0x0A,0xC0,0x05,0xD2,0x3F,0xAE,
+0x85,0x97,0x9C,0x3D,0x36,0x9D,0xA9,0xC0,0x26,0xA0,0xC7,0x9D,0xB7,0x05,0xAA,0x64,0xFE,0x65,0xA7,0x18,0x9D,0x9A,0x18,0xC8,0x25,0xFE,0x02,0x00,0x05,0xC1,0x13,0xB5,
+0x50,0x18,0xC0,0x97,0x9A,0x0E,0x06,0x18,0xC3,0xFE,0x23,0x03,0xFE,0x00,0x40,0xC0,0x05,0xB4,0x42,0x36,0x18,0x1A,0x18,0x15,0xFE,0x00,0xA0,0x05,0xC3,0x37,0xA7,0x87,
+0x0F,0x14,0x05,0xD1,0x14,0xB4,0x73,0xA2,0x98,0x6C,0x05,0xC0,0x0A,0x05,0xD8,0x3F,0xFE,0x65,0xA7,0x18,0xCB,0x12,0x19,0x05,0xC0,0xB5,0x20,0x06,0x18,0xC2,0x12,0x25,
+0xA4,0x88,0x18,0xC0,0x2C,0xFE,0x09,0x81,0x19,0x05,0xC1,0x08,0x36,0x18,0xC0,0x39,0x19,0x05,0x0A,0x05,0xC2,0xAB,0x55,0x06,0x0A,0x05,0x0A,0x05,0xC0,0x7A,0x05,0xCD,
+0xA5,0x87,0xB2,0x72,0xFE,0x8A,0x21,0x98,0xFB,0xC0,0x0A,0x05,0xAF,0x33,0x36,0x18,0xC3,0x25,0x0E,0xA8,0x75,0x18,0x8B,0xBF,0xFE,0x00,0x60,0x0A,0x05,0xC1,0x0F,0xB3,
+0x31,0x36,0x18,0x25,0xFE,0x09,0x81,0x05,0x0A,0x05,0xC3,0x31,0x28,0x05,0xC0,0x28,0x05,0x37,0x0E,0x18,0xC5,0x97,0x9A,0x39,0x8A,0xCE,0x05,0xC5,0x08,0x36,0x0D,0x84,
+0xAF,0x05,0xC5,0x37,0x24,0x05,0xC1,0x6E,0x12,0x18,0xC7,0x39,0x92,0xBD,0x8D,0xEF,0x05,0x0A,0x05,0xC2,0x0C,0x0E,0x08,0xFE,0x08,0x20,0x05,0xC3,0xA3,0x87,0x05,0x31,
+0x28,0x05,0x0A,0x05,0xD1,0x2B,0xB5,0xA4,0x1D,0xA3,0x66,0xAA,0x74,0x8A,0x9D,0x05,0xDC,0xFE,0x3B,0xE5,0x0D,0x18,0xCC,0x8F,0x9C,0x19,0x05,0x13,0x1A,0x18,0xC8,0x12,
+0xFE,0x02,0x00,0x05,0x0A,0x05,0xC2,0x2E,0x0C,0x0F,0x05,0xC4,0x0A,0x37,0x24,0x0A,0x05,0x0A,0x05,0xD1,0xAF,0x87,0xAA,0xC3,0xFE,0xA9,0x61,0x7E,0x3D,0xFE,0x23,0xC1,
+0x28,0x0A,0x66,0xC2,0x37,0x2E,0x28,0x0A,0x05,0x0A,0x05,0xC2,0xAF,0x54,0x28,0x99,0xDC,0x0A,0x05,0xD1,0x0A,0xBA,0x84,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0x3D,0x18,0x0E,
+0x8F,0xBF,0x28,0x99,0xCC,0xC0,0xA4,0x66,0x05,0x37,0x31,0x37,0x05,0xC4,0xA7,0x78,0x31,0x19,0x05,0xC2,0xA2,0x77,0x05,0xCE,0xB0,0x74,0xAB,0x94,0xFE,0xA1,0x20,0xC0,
+0x31,0x9C,0x78,0x05,0xC3,0xA7,0x85,0xA8,0x24,0x0F,0x05,0xD3,0x1E,0xFE,0x99,0x61,0xA1,0xB8,0x31,0x24,0x99,0xBB,0x98,0xBB,0xC3,0x24,0x17,0x05,0xC0,0x19,0x05,0xD0,
+0x1E,0xFE,0x8A,0x21,0x3D,0x05,0x2B,0xAA,0x55,0x28,0x0A,0x05,0x0A,0x05,0x06,0x2E,0x19,0xA7,0x77,0x06,0x10,0x37,0x10,0x05,0xCD,0xB7,0x72,0x0F,0x3D,0x0E,0x1F,0x18,
+0xC2,0x6F,0x18,0xC8,0x12,0x1A,0x18,0xD2,0x9D,0x9A,0x8D,0x9D,0xFE,0x00,0x60,0x14,0x05,0x37,0x2E,0x0F,0x05,0xC2,0xB5,0x20,0x13,0x37,0x05,0x19,0xA1,0xAA,0x10,0x59,
+0x10,0xC0,0x05,0xC3,0x0A,0x05,0xC4,0x04,0xA6,0x16,0x1F,0x18,0xCD,0x94,0x8B,0xA9,0x97,0x18,0xD3,0x25,0xFE,0x09,0x81,0x05,0xC1,0x38,0x19,0x05,0xC1,0x10,0x2E,0x2B,
+0x05,0xC1,0x32,0xC1,0x37,0xA7,0x66,0x3F,0x05,0xC4,0x0A,0x05,0xC1,0xA8,0x88,0xB1,0xA1,0xFE,0x23,0x03,0x05,0xC0,0x17,0xAC,0x54,0x37,0x05,0xC0,0x10,0x06,0x0A,0x05,
+0xC0,0x03,0xA3,0x87,0x7B,0x15,0x37,0x10,0x37,0x05,0xC7,0x0A,0x3E,0x05,0xC1,0x15,0x06,0x05,0x24,0x06,0x0A,0x05,0xC0,0x24,0x13,0x06,0x99,0xBB,0x05,0xC0,0x0A,0x05,
+0x0A,0x05,0x17,0x05,0xC5,0xB0,0x95,0xA8,0x66,0x8C,0x9B,0x05,0xE0,0xB8,0x10,0x18,0xCE,0x92,0x9E,0xAE,0x73,0x18,0xD2,0x0D,0xFE,0x0A,0x00,0x05,0xC1,0x03,0x2E,0x06,
+0x19,0x05,0x15,0xC0,0x2E,0xC0,0x06,0x10,0x06,0x10,0x17,0xB2,0x85,0x16,0x89,0x9F,0x05,0x0A,0x05,0xDE,0x31,0xFE,0x55,0x63,0xA6,0x88,0x18,0xCC,0x12,0x0D,0x18,0xD2,
+0x99,0x9C,0xFE,0x01,0x60,0x97,0xDD,0x05,0xC0,0xA7,0x85,0x0C,0x98,0x99,0x0A,0x2B,0x05,0x2B,0x05,0xC2,0x0A,0xAA,0x86,0x9C,0x57,0x0E,0x18,0xD2,0xFE,0x23,0x41,0x19,
+0x05,0xC0,0x17,0xAC,0x55,0x28,0x05,0x0A,0xC0,0x05,0xC1,0xA2,0x77,0xC1,0x05,0x17,0x24,0x39,0xAB,0x84,0x18,0xD0,0x25,0xFE,0x09,0x21,0x05,0xC1,0xAA,0x66,0x10,0x05,
+0xC4,0x2B,0x32,0x05,0xC0,0x0A,0x05,0x10,0x14,0x05,0xE1,0x08,0x0D,0x06,0x18,0xCB,0x12,0x1A,0x18,0xC6,0x1A,0x18,0xC7,0xFE,0x23,0x41,0x0F,0x05,0xC0,0x37,0x10,0x0F,
+0x14,0x05,0xC1,0x0F,0x05,0x2B,0x18,0x12,0xA8,0x75,0x0D,0x06,0x2C,0x18,0x0D,0x06,0x0D,0x06,0x0D,0xC0,0x06,0x0D,0xC1,0x06,0x0D,0x2C,0x0E,0x13,0x05,0x37,0xC0,0x31,
+0x28,0x19,0x05,0xC9,0x2B,0xA5,0x78,0x2E,0x0F,0x66,0x05,0xC0,0x0A,0xC0,0x05,0xC0,0xB0,0x74,0xAA,0xA6,0xAF,0x77,0xAC,0x68,0x97,0xA9,0xA9,0x88,0x9A,0x88,0x3C,0x9D,
+0x88,0xA4,0x88,0x39,0x01,0xEB,0x39,0x01,0xFD,0xD0,0x95,0x99,0x3C,0x92,0xA9,0x41,0x07,0x00,0xC0,0x01,0x39,0x01,0xFD,0xCB,0x07,0x39,0xC0,0x01,0x19,0x00,0x18,0x3D,
+0x26,0x07,0x00,0xC0,0x19,0x01,0x39,0x01,0xFD,0xC5,0x27,0x3C,0x01,0xE3,0x00,0x3D,0x26,0x07,0xA3,0x68,0xC0,0x01,0xC5,0x19,0x00,0x18,0x3D,0x26,0x07,0x1A,0x00,0x3C,
+0x01,0x3C,0x01,0xFD,0x00,0xC0,0x01,0x39,0x01,0xE0,0x00,0x3D,0x26,0x07,0x1A,0x7A,0x1A,0xC0,0x39,0x01,0xC9,0x19,0x00,0x18,0x3D,0x69,0x18,0x00,0xC0,0x01,0x39,0x01,
+0xF9,0x27,0x19,0x01,0xE0,0x00,0x3D,0x26,0x07,0x1D,0xC0,0x1A,0x1D,0x1A,0x1D,0x39,0x01,0xCE,0x19,0x00,0x18,0x26,0x3D,0x1D,0x00,0xC0,0x01,0x39,0x01,0xF4,0x07,0x39,
+0x01,0xDE,0x19,0x3D,0x26,0x07,0x1A,0x1D,0xC0,0x1A,0x1D,0xC2,0x01,0xD3,0x9D,0x99,0x00,0x27,0x3D,0x26,0xC0,0x3D,0x00,0xC0,0x01,0x39,0x01,0xEF,0x27,0x3C,0x01,0xDC,
+0x19,0x07,0x9C,0x88,0xA5,0x79,0x1D,0x1A,0x1D,0xC0,0x39,0x01,0xD7,0x28,0x00,0xC0,0x27,0x3D,0x26,0xC0,0x07,0x1D,0x00,0xC0,0x01,0x39,0x01,0xE7,0x00,0xC0,0x3C,0x01,
+0x3C,0x01,0xD9,0x07,0x9B,0x89,0x07,0x1D,0x1A,0xC0,0x1D,0xC0,0x1A,0x01,0xC6,0x28,0x00,0xC0,0x18,0x3D,0x26,0x3D,0x1D,0x00,0x19,0x01,0x39,0x01,0xE2,0x27,0x19,0x01,
+0xDA,0x27,0x1F,0x10,0x1D,0xC1,0x1A,0x1D,0xC7,0x01,0xCC,0x19,0x00,0x27,0x3D,0x36,0x26,0x3D,0x1D,0x00,0x19,0xC0,0x01,0x39,0x01,0xDB,0x07,0x3C,0x01,0xD8,0x27,0x26,
+0x3D,0x1D,0xC0,0x1A,0x1D,0xC5,0x1A,0x1D,0xC2,0x01,0xD2,0x28,0x00,0xC0,0x18,0x3D,0x26,0xC0,0x07,0x00,0xC0,0x19,0x39,0x01,0xC0,0x69,0xC1,0x3C,0x01,0xD0,0x07,0x3C,
+0x01,0xD7,0x18,0x17,0x07,0x1D,0x1A,0x1D,0xCB,0x1A,0x01,0xD1,0x3A,0xC0,0x3C,0xA2,0x74,0xC1,0xA1,0xA7,0x61,0x9D,0x8A,0xC1,0x24,0x0F,0x35,0x24,0x35,0x24,0x35,0xC0,
+0x24,0x35,0x31,0xC0,0x3C,0x01,0xCA,0x00,0xC0,0x01,0x39,0x01,0xD4,0x19,0x26,0x3D,0x1D,0xC1,0x1A,0x1D,0xCC,0x01,0xCB,0x31,0xC0,0x35,0xC0,0x24,0x0F,0xC0,0x9F,0x86,
+0x65,0x53,0x9C,0x8A,0x65,0x68,0x9C,0x8A,0x52,0xC1,0x12,0x05,0x12,0x3A,0x2C,0x06,0xA3,0x96,0x20,0x32,0x26,0x0F,0xA5,0x85,0x35,0x24,0x35,0x31,0x9F,0x9B,0xC0,0x3C,
+0xC0,0x01,0xC0,0x3C,0x01,0xC0,0x96,0x99,0x19,0x01,0xD5,0x00,0x1F,0x10,0x1D,0xC0,0x1A,0x1D,0xCE,0x01,0xC7,0xA1,0xA6,0x9D,0x98,0x0F,0x32,0x26,0x99,0x9C,0x12,0x05,
+0x9C,0x8A,0x9D,0x89,0x62,0xD5,0xA6,0x87,0xA5,0x87,0x06,0x14,0xA5,0x8A,0xA5,0x85,0x35,0x24,0x0F,0x9B,0x9A,0x18,0x3D,0x07,0x1D,0x3C,0x01,0xD4,0x18,0x1F,0x10,0x1D,
+0xC1,0x1A,0x1D,0xC9,0x1A,0x1D,0xC2,0x01,0xC3,0x3E,0x1E,0x41,0x06,0x99,0x99,0x9A,0x8A,0x9D,0x9A,0xE2,0x2B,0x12,0x14,0x0F,0x27,0x35,0x9E,0x96,0x0F,0xA3,0x7B,0xC0,
+0x3C,0xC0,0x01,0xD1,0x18,0x3D,0xA2,0x77,0x1D,0x1A,0x1D,0xD1,0x01,0xC1,0x60,0x26,0x20,0x99,0x99,0x9D,0x8A,0x05,0xE9,0xA6,0x87,0x12,0x14,0x0F,0x27,0x35,0x31,0xC0,
+0x3C,0x01,0xCF,0x8F,0xAA,0x3D,0x1D,0xC2,0x1A,0x1D,0xCB,0x1A,0x1D,0xC2,0x01,0x31,0x0F,0x06,0x2B,0x9D,0x89,0x05,0xF0,0xA9,0x85,0xAB,0x86,0x16,0xA4,0x68,0x35,0x31,
+0xC0,0x3C,0x01,0xCA,0x19,0x26,0x31,0x2C,0x17,0x9D,0x9A,0x0A,0x05,0xF4,0x12,0x14,0x27,0x35,0x31,0xC0,0x3C,0x01,0xC7,0x19,0x26,0x3D,0x01,0xC0,0x31,0x1F,0x0A,0x05,
+0xF8,0x3A,0x06,0x16,0x38,0x31,0xC0,0x3C,0x01,0xC4,0x19,0x3D,0x07,0x1D,0x1A,0x1D,0x1A,0x1D,0xCC,0x1A,0x1D,0xC1,0x01,0xC0,0x31,0x17,0x05,0x0A,0x05,0xF9,0x2B,0x06,
+0x16,0x38,0x35,0x9E,0x7C,0xC0,0x3C,0xC0,0x01,0x19,0x93,0xA9,0x10,0x1D,0xD5,0x01,0xC0,0x31,0x17,0x05,0xFD,0x2B,0xAA,0x85,0x16,0x38,0x31,0x9F,0x9B,0xC0,0x3C,0x26,
+0x3D,0x1D,0xC5,0x1A,0x1D,0xCD,0x1A,0x01,0xC0,0xA0,0xA4,0x17,0x05,0x0A,0x05,0xFD,0xC0,0x06,0x16,0x38,0x31,0x26,0x3D,0x1D,0xD7,0x01,0xC0,0x31,0x17,0x05,0xFD,0xC3,
+0xA7,0x85,0xAF,0x84,0x27,0x32,0x18,0x1D,0x1A,0x1D,0xD5,0x01,0xC0,0x9D,0xA5,0x05,0xFD,0xC6,0xAB,0x86,0x24,0x27,0x32,0x1A,0xC1,0x1D,0xD3,0x01,0xC0,0x9C,0x95,0x05,
+0xFD,0xC7,0xA5,0x87,0xAE,0x85,0x27,0x07,0x1A,0xC0,0x1D,0x1A,0x1D,0xD1,0x01,0xC0,0x32,0x05,0xFD,0xC9,0x12,0xB0,0x87,0x24,0x99,0x89,0x1D,0x1A,0x1D,0xD1,0x01,0xC0,
+0x0F,0x05,0xD1,0xAF,0x84,0x12,0x05,0xF3,0xA6,0x87,0xB1,0x73,0x38,0x39,0x1A,0xC0,0x1D,0xC0,0x1A,0x1D,0xCD,0x01,0xC0,0x06,0x05,0xD1,0x07,0xAB,0xA8,0x14,0x17,0x05,
+0x0A,0x05,0xF1,0x20,0x16,0x0F,0x06,0x1A,0xC0,0x1D,0xCE,0x01,0xA1,0x85,0x2C,0x05,0xD1,0xAE,0x85,0xFE,0xD6,0xF5,0x50,0x2B,0x8C,0x8A,0x05,0xF3,0xAB,0x86,0x24,0x16,
+0x98,0x5C,0x1D,0xCF,0x01,0xC0,0x8E,0xA6,0x17,0x9D,0x9A,0xD0,0x3A,0xFE,0xBE,0x54,0xAD,0x97,0x34,0x36,0x12,0x05,0xC2,0xA9,0x97,0x24,0x0F,0x91,0x9A,0x17,0x9D,0x9A,
+0xEA,0x3A,0x24,0x27,0x22,0x1D,0xCE,0x01,0xA1,0x85,0x88,0xBB,0x0A,0x05,0xD1,0xFE,0x9D,0x2D,0x04,0x6B,0x9D,0x98,0x90,0x86,0x06,0x05,0xC2,0x22,0xBD,0x86,0xC0,0x90,
+0x8A,0x2C,0x17,0x05,0xE9,0xA5,0x87,0x39,0x38,0x26,0x18,0x1D,0xC0,0x1A,0x1D,0xC9,0x01,0xA1,0x85,0x88,0xBB,0x0A,0x05,0xD1,0xBD,0x73,0xBF,0xA9,0x0B,0x7A,0x04,0x93,
+0x8A,0x07,0x05,0xC1,0x2B,0x3C,0xBD,0x97,0x3A,0x98,0x76,0x8C,0x8A,0x2C,0x17,0x05,0x0A,0x05,0xE7,0xB4,0x72,0x38,0x39,0x18,0x1D,0xCB,0x01,0x07,0x05,0xD3,0xB5,0x84,
+0x15,0x3A,0xA2,0x78,0x0E,0x0B,0x19,0x87,0x9A,0x89,0x9C,0x0A,0x05,0xAB,0x86,0x21,0x04,0x0B,0x0E,0x34,0x8C,0x99,0x8C,0x8A,0x92,0x9B,0x05,0xE8,0x06,0xAB,0x94,0x39,
+0x1A,0x1D,0x1A,0x1D,0xC8,0x01,0x07,0x05,0xD3,0xB0,0x95,0x34,0x0B,0x0E,0x0B,0x0E,0x04,0x34,0x87,0x89,0x8A,0x9A,0x05,0xC0,0xB5,0x84,0xBB,0x86,0x04,0x0B,0xC0,0x9D,
+0x98,0x96,0x79,0x8A,0x98,0x8C,0x89,0x05,0xE8,0x06,0x16,0x39,0x18,0x1D,0xC9,0x01,0x06,0x05,0xD3,0xAE,0x85,0x34,0xA8,0x89,0x0E,0x0B,0x0E,0x0B,0x0E,0x9A,0x89,0x88,
+0x77,0x31,0x05,0xA5,0x88,0x1F,0x2B,0x0B,0x0E,0x0B,0x0E,0x15,0x3D,0x89,0x8A,0x17,0x05,0x0A,0x05,0xE5,0xAB,0x86,0x24,0x16,0x1D,0xC9,0xAB,0xA7,0x12,0x95,0x9D,0xD3,
+0x20,0xFE,0xBE,0x31,0x04,0x0E,0x04,0x0E,0x0B,0x0E,0x0B,0x2B,0x89,0x88,0x85,0x9B,0x17,0x3C,0x31,0x04,0x0E,0x3A,0x0B,0xC0,0x0E,0x34,0x85,0x9A,0x8C,0x89,0x99,0x9C,
+0xE7,0x3C,0x35,0x96,0x9B,0x18,0x1D,0x1A,0x1D,0xCA,0xAB,0x85,0x88,0xBB,0x05,0xD3,0xA7,0x87,0x3D,0x0B,0x0E,0x0B,0x0E,0x0B,0x0E,0x0B,0x0E,0x2B,0x00,0x83,0x9B,0x05,
+0xBD,0x73,0x3A,0x0E,0x8E,0x89,0x3A,0x0B,0xC1,0x2B,0x87,0x99,0x8C,0x8A,0x08,0x05,0xE6,0x06,0x35,0x29,0x1D,0x1A,0x1D,0xC7,0x99,0xAA,0x69,0x26,0x0F,0x05,0xD4,0xA5,
+0x87,0xFE,0x94,0xCD,0x04,0x0B,0xC0,0x9D,0x98,0x9A,0x8A,0x9C,0x77,0xC1,0xA2,0x8A,0x0B,0x32,0x8A,0x8B,0x12,0xFE,0xBE,0x31,0x04,0x88,0x9C,0xB8,0x76,0x0E,0x5A,0x0E,
+0x0B,0x9D,0x98,0x92,0x98,0x86,0x79,0x17,0x05,0x0A,0x05,0xE4,0x22,0x27,0x18,0x1D,0xC5,0x9B,0xBA,0x26,0xC0,0xA4,0x87,0xA2,0x99,0xC0,0x01,0xD2,0x9D,0xA5,0x05,0xD5,
+0x00,0x3A,0x19,0x33,0x25,0x95,0x87,0x9D,0x89,0x05,0xC1,0x2B,0x3C,0x22,0x17,0xBA,0x74,0x36,0x2D,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x04,0x93,0x8A,0x87,0x98,0x8C,0x9B,
+0x0A,0x05,0xE4,0x2B,0x24,0x0F,0x1D,0xC3,0x26,0x01,0xD1,0xA1,0xA7,0x95,0xA6,0x8F,0x8E,0xD5,0x3C,0x33,0x86,0x89,0x05,0x2B,0x26,0x25,0x54,0x25,0x29,0xA1,0x7B,0xC0,
+0x29,0x22,0x9B,0x9A,0xB4,0x86,0x04,0x6B,0xC0,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x93,0x79,0x86,0x88,0x90,0x99,0x05,0xE5,0x20,0x24,0x22,0x1D,0x10,0x26,0x69,0x26,0x01,
+0xD1,0xA1,0xA7,0x8D,0x98,0x17,0x9D,0x9A,0xD4,0xB8,0x73,0x91,0x9A,0xB0,0x79,0x21,0xA9,0x89,0xA5,0x88,0x3A,0xA2,0x78,0x3A,0x0B,0xC1,0x3A,0x98,0x76,0x06,0xAD,0x87,
+0x3A,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x9A,0x89,0x29,0x95,0xA8,0x22,0x05,0x17,0x9D,0x9A,0xE4,0x22,0x27,0x8D,0x8F,0x1F,0x10,0x25,0xC0,0x01,0xD1,0x0F,0x05,0xD6,
+0x0F,0xB8,0x86,0x04,0x0E,0x3A,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x04,0x0B,0x8F,0xA8,0x06,0x34,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x9D,0x98,0xFE,0x4B,0x0A,0x05,0x6E,
+0xB2,0x85,0xAC,0x85,0x8C,0x8A,0x05,0xE4,0xA6,0x87,0xB5,0x84,0x98,0x89,0x25,0xC2,0x00,0x28,0xA2,0x78,0x01,0xCE,0x99,0xA4,0x17,0x05,0xD5,0x0F,0xFE,0xE7,0x76,0xA2,
+0x9A,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x87,0x88,0xA3,0x87,0x04,0x0B,0xC0,0x04,0x0B,0xC0,0x82,0x9A,0x05,0x29,0xBA,0x99,0xAE,0x75,0xC0,
+0x89,0x88,0x83,0x9B,0x05,0xE4,0xB5,0x84,0x27,0x25,0xC2,0x26,0x1F,0x26,0xA2,0x97,0x18,0x7F,0x19,0xC0,0x01,0x39,0x01,0xC7,0x3E,0x12,0x05,0xD6,0xB8,0x73,0x15,0x2A,
+0x3D,0x2A,0x61,0x04,0x0B,0xC0,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x2B,0x87,0x99,0x2B,0x0B,0xC0,0x04,0x0B,0x34,0x3C,0xBC,0x78,0x2B,0x0B,0xC0,0x0E,0x2B,0x85,0x89,0x31,
+0x05,0xE3,0xA9,0x97,0x24,0x22,0x25,0xC7,0x9C,0x87,0x26,0xA2,0x98,0xC1,0x26,0xA4,0x87,0x36,0x26,0x3D,0x26,0x69,0x3D,0xC0,0xA8,0x67,0xC0,0xA3,0x88,0x39,0xC0,0x01,
+0xC0,0x1E,0x8B,0x9B,0x0A,0x05,0xD5,0x0F,0x32,0x36,0x9A,0x88,0xC0,0xA5,0x87,0xB1,0x88,0x37,0x2B,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x93,0x89,0xA3,0x96,0xAA,0x8A,
+0x04,0x0B,0xC0,0x21,0xAD,0x9C,0x0B,0x0E,0xC1,0x2B,0x37,0x93,0x76,0x24,0x31,0x99,0x9C,0xE3,0x24,0x0F,0x25,0xC5,0x26,0x61,0xC1,0xA4,0x88,0x26,0x07,0x36,0x3D,0x26,
+0x07,0x36,0x3D,0xC0,0x26,0x07,0x36,0x3D,0x26,0x69,0x26,0x36,0x18,0xA7,0x93,0x05,0xD7,0xB5,0x84,0x13,0x00,0x27,0x3D,0x99,0x88,0x05,0xC0,0xB9,0x76,0xBD,0xA8,0xA8,
+0x77,0x0E,0x0B,0x0E,0x0B,0xC0,0x2B,0x34,0x0B,0x0E,0x0B,0x9A,0x99,0x34,0x0B,0x0E,0x0B,0xC0,0x2D,0x36,0x90,0x8B,0x00,0x33,0x1E,0x8B,0x9B,0x05,0xE2,0xB4,0x72,0x38,
+0x94,0xAD,0x00,0x25,0xC2,0x9A,0x77,0x26,0x15,0xC1,0x3D,0x26,0x07,0x61,0x3D,0xC1,0x26,0x07,0x36,0x3D,0xC2,0x26,0x07,0x36,0x3D,0x29,0x06,0x05,0xD7,0x0F,0xBD,0x9A,
+0x0B,0x9F,0x9C,0x54,0x0C,0x11,0x25,0x90,0x88,0x25,0x2D,0x0B,0xC0,0x04,0x0B,0xC1,0x04,0x0B,0xC1,0x92,0x86,0x04,0x0E,0x51,0x0E,0x37,0x16,0x25,0x2D,0x1B,0xA1,0x9A,
+0x2D,0x82,0x96,0x05,0xE2,0x16,0x24,0x36,0x25,0xC1,0x9C,0x88,0x15,0xC4,0x3D,0x26,0x07,0x61,0x3D,0xCC,0xAB,0x74,0x90,0x99,0x05,0xD7,0x0F,0x2A,0xA4,0x9C,0xC3,0x9B,
+0x87,0x8D,0x98,0x32,0x3D,0xFE,0xD6,0xD7,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x9D,0x98,0x99,0x87,0x0B,0xC0,0x04,0x0C,0x3C,0xAE,0x8A,0xBD,0x88,0x31,0xC1,0x1B,
+0x89,0x98,0x85,0x86,0x05,0xE2,0xBB,0x83,0x24,0x25,0xC0,0x9C,0x88,0x26,0x15,0xC4,0x3D,0xC0,0x26,0xA4,0x87,0x36,0x3D,0xCB,0xA9,0x84,0x05,0xD8,0xB7,0x74,0x2A,0x31,
+0xC5,0x37,0xFE,0x29,0x43,0x25,0x0C,0xA8,0x77,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x19,0xA7,0x9A,0x0B,0xC0,0x0E,0x30,0x99,0x79,0xFE,0xEF,0xBB,0x31,0xC3,0x9B,0x87,0x82,
+0x85,0x17,0x9D,0x9A,0x0A,0x05,0xDF,0x39,0xA4,0x96,0x25,0x54,0x15,0xC6,0x3D,0xC5,0x26,0xA4,0x87,0x61,0x3D,0xC5,0xAB,0x74,0x20,0x17,0x05,0xC0,0x0A,0x05,0xD4,0xB8,
+0x73,0xFE,0xE7,0x76,0x31,0xC4,0x1B,0x54,0x37,0xFE,0x29,0x43,0xB3,0x89,0x12,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x92,0x86,0x04,0x0E,0x3A,0x0C,0x3C,0xFE,0xD6,0xD7,0x0B,
+0x05,0xA2,0x9B,0xC3,0x93,0x74,0x06,0x90,0x9C,0xE1,0x13,0xAB,0x73,0x3C,0x9A,0x8B,0xC7,0xA4,0x88,0xCF,0x0F,0x91,0x9A,0x97,0x9C,0xD8,0x0F,0x2A,0x31,0xC3,0x37,0x92,
+0x12,0xC0,0x11,0xC0,0x3F,0xFE,0xD6,0xD7,0xA9,0x87,0x0E,0xC0,0x0B,0x0E,0x2B,0x95,0x87,0x04,0x0E,0x3A,0x88,0x77,0xA2,0x9C,0x37,0x91,0x12,0x9B,0x76,0x11,0x1B,0xA1,
+0x9A,0xC1,0x9B,0x87,0x84,0x74,0x8A,0x9A,0x05,0xE0,0xAE,0x85,0x35,0x8C,0xAD,0x57,0xC7,0xA4,0x88,0xC0,0x6E,0xC1,0x3D,0xCA,0xAC,0x81,0x17,0x05,0x0A,0x05,0xD6,0x0F,
+0x2A,0xA4,0x9C,0xC2,0x0C,0x82,0x13,0x55,0x50,0xA4,0x66,0x37,0x8F,0x8A,0x30,0xBE,0x77,0x0E,0xC0,0x0B,0x0E,0x9A,0x89,0x34,0x0B,0x0E,0x19,0x25,0x0C,0x1D,0x91,0x9A,
+0xA0,0x9A,0xAA,0x52,0xFE,0xD6,0xD7,0x31,0xC1,0x3D,0x8B,0x87,0x91,0xA8,0x05,0xE0,0x3C,0x35,0x8C,0xAD,0x57,0xC7,0xA4,0x88,0x02,0xC0,0x3D,0x02,0xC0,0x3D,0x02,0xC1,
+0x3D,0x02,0xC0,0x3D,0xC1,0xA9,0x84,0x20,0x17,0x05,0xD8,0x0F,0x2A,0x31,0xC2,0x37,0xFE,0x1B,0x41,0x92,0xDF,0x99,0xBB,0xB3,0x32,0xB1,0xBC,0xAD,0xDA,0xFE,0x31,0xA5,
+0x0C,0xA8,0x77,0x0E,0xC0,0x0B,0x9A,0x99,0x34,0x0B,0x0E,0x8E,0x89,0x9A,0x8A,0x2A,0x28,0x13,0x06,0xAE,0x31,0x2D,0x31,0xC1,0x33,0x37,0x8E,0x74,0x8C,0x8B,0x05,0xDF,
+0x3C,0xAF,0x73,0x8C,0x9D,0x15,0xC7,0xA4,0x88,0xCE,0x0F,0x05,0x97,0x9C,0xD9,0x1E,0x2B,0xA3,0x9E,0xC2,0x2D,0x12,0x9B,0x9A,0x13,0x12,0x11,0x31,0x30,0x21,0xB2,0x78,
+0x0E,0xC0,0x0B,0x19,0x9C,0x75,0x0B,0xC0,0x30,0x0C,0x12,0x23,0x91,0x42,0xC0,0xA6,0xBB,0xBA,0xEF,0x31,0xC0,0x33,0x21,0xC0,0x22,0x3C,0x05,0xDF,0x3C,0x27,0x8C,0x9D,
+0x15,0xC7,0x02,0xC0,0x3D,0x02,0xC0,0x3D,0xC9,0x0F,0x88,0x9D,0xDA,0x1E,0x33,0x31,0xC2,0x1B,0x23,0x12,0xC0,0xA8,0xEA,0x2A,0x31,0x0C,0x86,0x78,0xFE,0xF7,0xFB,0x0E,
+0xC0,0x0B,0x3A,0x94,0x76,0xAE,0x89,0x0E,0xFE,0x73,0xAD,0xFE,0xFF,0xFF,0xC0,0x33,0x2D,0x9E,0x86,0x33,0x31,0xC1,0x88,0x86,0x2A,0x33,0xFE,0x10,0xC2,0x07,0x89,0xAD,
+0xDF,0x3C,0xAD,0x83,0x8E,0x8D,0x15,0xC7,0xA4,0xB8,0xC3,0xA1,0x58,0xC0,0x3D,0x02,0xC0,0x3D,0xC3,0xA9,0x84,0x20,0x8C,0x9E,0xDA,0x0F,0xFE,0xEF,0xBB,0x31,0xC3,0x1B,
+0x9C,0x88,0x9C,0x86,0xA9,0x87,0x31,0xC1,0x30,0x0C,0x0E,0x0B,0x0E,0x0B,0x8F,0xA8,0x04,0x2B,0x11,0x31,0xC6,0x37,0x2D,0x0B,0x30,0x80,0x8B,0x36,0x90,0x8B,0x05,0xDE,
+0xB0,0x95,0x16,0x8E,0x8D,0x15,0xC7,0xA4,0xC8,0xC8,0x06,0x02,0xC0,0x66,0x02,0x0F,0x05,0x97,0x9C,0xDA,0x07,0xBA,0x88,0x31,0xCA,0x2D,0xA2,0x97,0xA9,0x87,0x0E,0xC1,
+0x92,0x76,0xAB,0x9A,0x0B,0x11,0x33,0xA5,0x9A,0xC4,0x3D,0x21,0x12,0x0B,0x36,0x05,0xB0,0x74,0x65,0x05,0xDE,0x07,0xA1,0xA6,0x15,0xC8,0x09,0xC2,0x5A,0x09,0xC2,0x06,
+0x09,0xC2,0xA4,0x66,0x39,0x05,0xDB,0xBB,0x84,0x21,0x37,0x1B,0x31,0xC7,0x33,0x8D,0x98,0x2A,0xA2,0x97,0x0B,0x69,0x0B,0x34,0xC0,0x0B,0x0E,0x37,0x11,0x3D,0xA4,0x8A,
+0xC0,0x3D,0x91,0x9A,0x2D,0x0B,0xC0,0x2A,0xFE,0x31,0xA5,0x05,0xA9,0x97,0xAA,0x75,0x17,0x05,0xDD,0x24,0x20,0x15,0xC8,0x09,0xC2,0x06,0x09,0xC4,0x06,0x09,0xC0,0x1E,
+0x96,0x88,0x05,0x6E,0x05,0xD9,0x1F,0x2B,0x0C,0x33,0x37,0xAC,0x79,0x31,0xC1,0x1B,0x54,0x2D,0x11,0x37,0x2B,0x0B,0xC0,0x04,0x0B,0xC1,0x92,0x86,0x04,0x0B,0xC0,0x2B,
+0x96,0x79,0x21,0x37,0x3D,0xA9,0x87,0x0E,0xC1,0x3D,0xFE,0x10,0xC1,0x9D,0x89,0x2B,0x07,0x89,0xAD,0xDD,0x3F,0xB7,0x82,0x93,0xAB,0x15,0xC8,0x09,0xC3,0x06,0x09,0xC5,
+0x06,0x27,0x87,0xAF,0x9D,0x8A,0x05,0xDA,0xFE,0x8C,0x6C,0xB9,0x88,0x0E,0x0B,0x3D,0x21,0x9A,0x8A,0xC0,0x11,0xC0,0xA7,0x87,0x0C,0x12,0x0E,0xC0,0x5A,0x04,0x0B,0xC1,
+0x0E,0x93,0x79,0x0C,0xA8,0x76,0x0E,0x0B,0x0E,0x0B,0x0E,0x0B,0x04,0x0B,0xC1,0x21,0x05,0xC1,0xB5,0x84,0x90,0x8B,0x05,0xDC,0x3A,0xAF,0x85,0x92,0x8C,0x9A,0x8B,0x26,
+0x15,0xC6,0xA4,0xB8,0x09,0xC2,0x06,0x09,0xC5,0xA7,0x77,0xA3,0x52,0x05,0xDC,0xFE,0x8C,0x6C,0xBA,0x88,0x0B,0xC1,0x3A,0x0B,0x0E,0xC2,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,
+0xC1,0x0E,0x0B,0x9D,0x98,0x92,0x98,0x04,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x04,0xFE,0x6B,0xAA,0x05,0xC1,0xB3,0x84,0x91,0x9B,0x0A,0x05,0xDB,0xB8,0x73,0x24,
+0x25,0x54,0x15,0xC6,0xA4,0x88,0x06,0xC1,0x09,0xC2,0x06,0x09,0xC3,0x1E,0x92,0x88,0x05,0xDB,0xA5,0x87,0xFE,0x94,0xCD,0x04,0x0B,0xC0,0x0E,0xC1,0x0B,0x0E,0x0B,0xC0,
+0x0E,0x0B,0xC1,0x04,0x0B,0x04,0x0B,0xC1,0x9D,0x98,0x90,0x86,0x04,0x0B,0xC0,0x0E,0xC1,0x0B,0x04,0x0B,0xC0,0x9A,0x99,0x16,0x05,0xC1,0x22,0x96,0x89,0x17,0x9D,0x9A,
+0xDA,0xA5,0x87,0x24,0x9D,0x8A,0x25,0xC2,0x02,0xC0,0x66,0x25,0xC2,0x99,0xC9,0xC1,0x06,0xC1,0x09,0xC3,0x06,0x09,0xAC,0x41,0x17,0x05,0xDB,0xA6,0x87,0xBE,0x73,0xB8,
+0x99,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x69,0x0B,0xC0,0x04,0x0B,0xC1,0x0E,0x0B,0x04,0x8F,0xA9,0xAD,0x77,0x3A,0x0B,0x0E,0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0x21,
+0x05,0xC2,0x3C,0x9D,0x89,0x05,0xDB,0x20,0x24,0x98,0x8A,0x25,0xC9,0x2D,0xC8,0x06,0xC0,0xAB,0x64,0x99,0x79,0x05,0xDC,0xA6,0x87,0x00,0x04,0x0B,0xC0,0x0E,0xC1,0x0B,
+0xC0,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x31,0x15,0xA2,0x9A,0x0B,0x0E,0x0B,0xC0,0x0E,0xC2,0x0B,0x0E,0xFE,0x6B,0xAB,0x84,0x9B,0xC2,0x16,0xA6,0x75,
+0x05,0xDB,0x0F,0xC0,0x25,0xCA,0x2D,0xCA,0x24,0x8C,0x8B,0x05,0xDC,0xA6,0x87,0xFE,0x9D,0x2D,0x04,0x0B,0xC1,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x04,0x0B,0xC1,0x0E,
+0x0B,0x19,0xC0,0x04,0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0x9D,0x88,0x3F,0x05,0xC2,0x16,0x06,0x05,0xDA,0xA9,0x85,0x27,0x92,0x9C,0x9B,0x8C,0x6B,0x3D,0xC0,
+0x25,0xC6,0x2D,0xC9,0xAC,0x43,0xA2,0x75,0xFE,0x00,0x20,0xDD,0x16,0xFE,0xAD,0x8E,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x04,0x0B,0xC1,0x04,0x0B,0xC1,0x0E,
+0x0B,0x0E,0x0B,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x11,0x05,0xC3,0xA6,0x87,0x06,0x05,0xDA,0x22,0x27,0x18,0x10,0xA2,0x87,0x9B,0xBA,0x26,0x61,0x26,0x3D,
+0x1D,0x25,0xC2,0x2D,0xC9,0xAF,0x51,0x12,0x05,0xDD,0x20,0xFE,0xBE,0x31,0x0E,0x59,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x04,0x0B,0xC2,0x04,0x0B,0x34,0x37,
+0xA6,0x68,0x0B,0xC1,0x04,0x0B,0xC1,0x0E,0x0B,0xFE,0x4A,0x86,0x05,0xC3,0x3A,0x06,0x05,0xD9,0x3F,0x27,0x32,0x1A,0x1D,0x1A,0x1D,0xC2,0x3D,0x26,0x15,0x26,0xC0,0x3D,
+0x9D,0xC9,0xC7,0x69,0x13,0xA8,0x74,0x17,0x05,0xDD,0x16,0xFE,0xBD,0xD1,0xB1,0x78,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x04,0x0B,0xC3,0x93,0x89,0x88,0x8A,
+0x17,0x05,0xA5,0x87,0x33,0xB8,0x76,0x69,0x0E,0xC2,0x0B,0x8E,0x99,0x05,0xC5,0xB1,0x93,0x05,0xD9,0x36,0x27,0x1D,0xCB,0x9D,0xA9,0x2D,0xC7,0x26,0x0D,0x14,0x17,0x05,
+0xDD,0x3C,0x31,0x04,0x0E,0x51,0x0E,0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0xC0,0x3A,0x33,0xFE,0x10,0xC2,0x05,0xC3,0x33,0x12,0x0B,0x0E,0x0B,0x0E,0x9D,0x88,
+0xFE,0x4A,0x86,0x05,0xC4,0xA6,0x87,0x06,0x05,0xD8,0x20,0xB3,0x83,0x0A,0x1D,0x1A,0x1D,0xCA,0x2D,0xC7,0x26,0x0D,0x90,0x79,0x05,0xDE,0x3C,0xB4,0x86,0x2B,0x0B,0xC0,
+0x0E,0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0xC0,0x30,0x05,0xC3,0xA5,0x87,0x9C,0x9A,0x2B,0xFE,0xBE,0x54,0x04,0x0E,0x5A,0x0E,0x21,0x05,0xC5,0x2B,0x06,0x05,
+0xD8,0x0F,0xC0,0x1D,0xCD,0x2D,0xC7,0xA7,0x76,0x39,0x05,0xDF,0x3C,0xA8,0x73,0x33,0x12,0x0B,0x0E,0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0x82,0x78,0x05,0xC1,
+0xAF,0x87,0x33,0xAD,0x78,0x0C,0x55,0x33,0x36,0x04,0x0E,0x0B,0x19,0x0F,0x05,0xC5,0x3A,0x06,0x05,0xD7,0x20,0xB3,0x83,0x06,0x18,0x6E,0xC4,0x1A,0x1D,0xC5,0x98,0xEA,
+0xC7,0x0D,0x06,0x05,0xDF,0x20,0x39,0x20,0xFE,0xC6,0x97,0x0B,0xC2,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x00,0x05,0xC0,0x0F,0x11,0xB1,0x96,0x12,0x0E,0xC0,0x2B,0x0B,0xC0,
+0x0E,0x0B,0x61,0x80,0x7A,0x84,0x9B,0xC6,0xA6,0x87,0x06,0x05,0xD6,0xA5,0x87,0x24,0x99,0x89,0x15,0xA2,0x78,0x69,0xA2,0x99,0x07,0x1D,0x1A,0x1D,0xC0,0x1A,0x1D,0xC4,
+0x98,0xEA,0xC7,0x0D,0x31,0x05,0xDF,0x3C,0x20,0x9B,0x49,0xA8,0xBC,0x2A,0xA2,0x97,0x0B,0xC0,0x04,0x0B,0xC1,0x0E,0x0B,0x37,0x17,0x05,0xBC,0x87,0x0C,0x12,0x0E,0xC0,
+0x0B,0x21,0x34,0x0B,0x0E,0x0B,0xC0,0x33,0x14,0x05,0xC6,0xAB,0x86,0xC0,0x05,0xD6,0xB3,0x84,0x27,0xFE,0x31,0xA5,0x26,0x3D,0x26,0xC0,0x1F,0x26,0x36,0x1F,0x26,0x15,
+0x07,0x1D,0x1A,0x1D,0xC1,0x2D,0xC6,0xA7,0x76,0x39,0x05,0xE0,0xA9,0x97,0xA6,0x75,0xA0,0x25,0x93,0xEF,0x30,0x12,0x0B,0x0E,0xC2,0x0B,0xC0,0x9A,0x99,0xFE,0x4A,0x25,
+0x3F,0x11,0x0B,0xC0,0x0E,0x51,0x95,0x79,0x33,0x2A,0xA4,0x87,0x0E,0xC1,0x93,0x79,0x3F,0x05,0xC7,0x20,0x31,0x05,0xD5,0xA9,0x85,0x27,0x0A,0x3D,0xC8,0x36,0x26,0x3D,
+0x26,0xC0,0x1F,0x26,0x2D,0xC6,0x1E,0x96,0x88,0x91,0x9D,0xE0,0x3C,0x06,0x9F,0x58,0x95,0xBB,0x14,0x30,0x12,0x69,0x0E,0x0B,0x0E,0x0B,0xC0,0x11,0x85,0x9A,0xFE,0xBE,
+0x54,0x04,0x0E,0x21,0x33,0x11,0xAB,0x98,0xA9,0x87,0xC1,0x04,0x0B,0x3D,0x36,0x05,0xC8,0x20,0x05,0xD6,0xB8,0x73,0x78,0x94,0x8F,0x26,0x07,0x36,0x3D,0xC6,0x26,0x07,
+0x36,0x3D,0xC1,0x2D,0xC6,0x1E,0x8B,0x9B,0x9D,0x8A,0x05,0xDF,0x20,0x06,0x9B,0x69,0x44,0x0A,0x05,0xBC,0x87,0x0C,0x0B,0x0E,0xC1,0x9D,0x88,0xFE,0x4B,0x0A,0xBE,0xA6,
+0x0B,0x0E,0xC1,0x0B,0x0E,0x51,0x0E,0x0B,0x0E,0x0B,0x0C,0xFE,0x42,0xA9,0x05,0xE1,0xA9,0x97,0xB2,0x73,0x22,0x99,0x9D,0x26,0x07,0x36,0x3D,0xC7,0x26,0x07,0x36,0x3D,
+0xC0,0x2D,0xC5,0x1D,0x39,0x05,0xE1,0x16,0x06,0x95,0x9B,0xAA,0x34,0x0A,0x05,0xC0,0x00,0xFE,0xD6,0xD7,0x0B,0x0E,0xC0,0x9D,0x88,0xC0,0x0B,0x0E,0xC2,0x0B,0xC1,0x69,
+0x0B,0xC0,0x9A,0x99,0x00,0x05,0xE2,0x0F,0x9F,0x86,0xFE,0x31,0xA6,0x26,0x07,0x36,0x3D,0xC8,0x26,0x07,0x36,0x3D,0xC0,0x2D,0x69,0xC4,0x0D,0x9C,0x76,0x05,0xE1,0xA5,
+0x87,0x06,0x17,0x2E,0x95,0xBB,0x05,0xC1,0xAF,0x87,0xBE,0x97,0x0B,0xC2,0x0E,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x04,0x0B,0xC0,0x9A,0x99,0x00,0x05,0xE2,0x3C,0xAD,0x85,
+0x3C,0x3D,0x41,0x07,0x36,0x3D,0xC9,0x26,0x07,0x36,0x3D,0x2D,0xC5,0xB1,0x62,0x8F,0x7B,0x17,0x9D,0x9A,0xE1,0x06,0x05,0x2E,0x95,0xBB,0x05,0xC2,0x2B,0x30,0x0C,0x0E,
+0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0x95,0x7B,0x25,0x05,0xE3,0x1E,0x9A,0x88,0x3C,0x3D,0x26,0x07,0x36,0x3D,0xCD,0x9D,0xC9,0xC4,0x1D,0xAB,0x62,0x08,0x05,
+0xE2,0x22,0x05,0x10,0x44,0x05,0xC4,0x36,0x11,0xB1,0x96,0x12,0x0B,0x04,0x0B,0xC1,0x0E,0x0B,0x11,0x3F,0x05,0xE3,0xA9,0x97,0x1E,0x96,0x88,0x3D,0x26,0x07,0x36,0x3D,
+0xCE,0x2D,0x69,0xC3,0xAF,0x44,0x32,0x05,0xE3,0xB5,0x84,0x05,0xA5,0x87,0x10,0x0A,0x05,0xC5,0xAF,0x87,0x11,0x2A,0xA2,0x97,0x0B,0xC1,0x95,0x8B,0x89,0x98,0x84,0x9B,
+0xE5,0xB8,0x73,0x32,0x3D,0xC0,0x41,0x07,0x61,0x3D,0xCE,0x9D,0xC9,0xC4,0x1E,0x96,0x88,0x05,0xE3,0xB4,0x72,0x17,0x05,0x2E,0x19,0x05,0xC7,0xAF,0x87,0x30,0x21,0xA1,
+0x9A,0x30,0x15,0x05,0x0A,0x05,0xE3,0x16,0x24,0x3D,0xC3,0x26,0x07,0x36,0x3D,0xCC,0x2D,0xC4,0x27,0x8C,0x9D,0x97,0x9C,0xE3,0x06,0x99,0x99,0x97,0x9C,0x2E,0x19,0x05,
+0xC9,0xAB,0x44,0x19,0x05,0xE7,0x20,0x22,0x3C,0x3D,0xC0,0x26,0x07,0x36,0x3D,0xCE,0x2D,0xC3,0xAC,0x43,0x27,0x05,0xE4,0xAB,0x86,0xC0,0x05,0x2E,0xFE,0x23,0xC1,0x9A,
+0xBD,0x98,0x89,0x99,0xDD,0x9C,0x99,0x9D,0xBB,0x0A,0x05,0xC0,0x19,0x06,0xAE,0x31,0xA9,0x85,0x06,0x19,0x05,0xE6,0x1E,0x3A,0x3D,0xC0,0x26,0x07,0x61,0x3D,0xCF,0x2D,
+0x69,0xC2,0x0D,0x9C,0x76,0x05,0xE4,0xA6,0x87,0xC0,0x05,0xAB,0x55,0xFE,0x65,0xA7,0xA6,0x75,0x52,0x9A,0x87,0x9D,0x8A,0x12,0xC2,0xA6,0x88,0xA4,0x77,0xA7,0x85,0x9D,
+0x9A,0xFE,0x1A,0xC1,0xFE,0x00,0x60,0x05,0xE5,0x3A,0xB5,0x84,0x91,0x9D,0xA4,0x68,0x3D,0x41,0x07,0x36,0x3D,0xCF,0x2D,0xC3,0x24,0x3C,0x05,0xE7,0x37,0xFE,0x44,0xC5,
+0xAE,0x73,0x69,0xC5,0x06,0xC0,0x18,0xC0,0x8B,0xBF,0x19,0x9D,0xBB,0x59,0x05,0xE3,0x16,0x1E,0x3D,0x26,0x07,0x36,0x3D,0xD1,0x2D,0x69,0xC2,0x27,0x8C,0x9D,0x97,0x9C,
+0xE8,0xFE,0x3B,0xE5,0x1F,0x18,0xC4,0x99,0x9B,0xFE,0x4C,0x07,0xC0,0xAD,0x52,0x1A,0x25,0xFE,0x0A,0x00,0x0F,0x05,0xE4,0xAC,0x87,0xA7,0x86,0x9D,0x7B,0x3D,0x41,0x07,
+0x36,0x3D,0xD0,0x9D,0xC8,0x2D,0xC1,0x22,0x27,0x87,0xAF,0x0A,0x05,0xE7,0xB7,0x10,0x1A,0x6D,0xC4,0x39,0xFE,0x6B,0xAB,0xA0,0x9A,0xA0,0x54,0x1A,0x18,0x3B,0xFE,0x00,
+0xA0,0x9C,0xAA,0xC6,0xAB,0x44,0x0F,0x05,0xDA,0x3C,0xA6,0x75,0x3D,0x41,0x07,0x36,0x3D,0xD1,0xA0,0xB8,0xA4,0x65,0x1D,0x13,0xA8,0x66,0x32,0x05,0xE6,0x17,0x05,0x0A,
+0xAE,0x54,0x0D,0x18,0xC4,0x39,0xFE,0x6B,0xAB,0x16,0x05,0xFE,0x65,0xA7,0x1A,0x25,0xFE,0x0A,0x00,0x93,0xEF,0x62,0xAB,0x44,0x2E,0xA5,0x43,0xA3,0xAA,0x9C,0xAB,0x13,
+0xA0,0x9A,0xC1,0x06,0x99,0xBB,0x05,0xD7,0xA9,0x85,0xAC,0x87,0x3D,0xC4,0x26,0x07,0x61,0x3D,0xCC,0xA4,0x95,0x1D,0xC0,0x13,0xAB,0x75,0x20,0x8C,0x9E,0xDF,0xA5,0x87,
+0x06,0xA4,0x65,0x2C,0xC0,0xA3,0xAA,0x0C,0x13,0xC0,0xA0,0x9A,0x0C,0x39,0xAE,0x73,0x18,0xC3,0x25,0xFE,0x5B,0xA9,0x16,0x58,0xFE,0x65,0xA7,0x1A,0x18,0x12,0x97,0xAC,
+0xAD,0x88,0xA4,0x62,0xA2,0x8A,0x18,0x9D,0x9A,0x8D,0x9D,0x0F,0x62,0xC1,0x10,0x2E,0x95,0xBB,0x05,0xD7,0xB8,0x73,0x3C,0x3D,0xC0,0x26,0x07,0x61,0x3D,0xCE,0x9D,0xE6,
+0xA7,0x48,0x1D,0xC1,0xAB,0x62,0x94,0x8C,0x05,0xDD,0x24,0xA8,0x65,0x3B,0x39,0x25,0x0D,0x0A,0x19,0xFE,0x00,0x60,0x05,0xC1,0x0F,0x10,0xFE,0x3C,0x62,0x1A,0x18,0xC3,
+0x12,0xFE,0x5B,0xAA,0xA3,0x54,0x06,0x18,0xC0,0x0D,0x95,0x99,0x18,0x06,0x18,0xC1,0x25,0xFE,0x01,0x60,0x97,0xDD,0x05,0xC1,0x2B,0x2E,0x95,0xBB,0x05,0xD6,0x22,0x3C,
+0x3D,0xC1,0x26,0x07,0x36,0x3D,0xC6,0x9D,0xA8,0xA0,0xA8,0x1E,0x9E,0xB8,0xA0,0xA7,0xA2,0xA7,0xA1,0xB8,0x7B,0xFE,0x4A,0x25,0x1D,0xC1,0x27,0x8C,0x9D,0x97,0x9C,0xDB,
+0x10,0x29,0xAD,0x84,0x06,0x18,0xC4,0xFE,0x22,0xC2,0x0F,0x05,0xC1,0x0F,0x28,0x39,0x1F,0x18,0xC3,0x0D,0x18,0xC3,0x8F,0xAD,0x0A,0x06,0x18,0xC2,0x08,0x0F,0x05,0xC1,
+0x0F,0xA8,0x77,0x10,0x96,0xBB,0x05,0xD5,0xA9,0x85,0xAC,0x87,0x97,0x9C,0x42,0xA2,0x98,0xC0,0x26,0x07,0x36,0x3D,0x26,0x3D,0x1E,0x61,0xA0,0xB8,0xA3,0xA8,0x25,0x33,
+0xA1,0xA9,0xC1,0x56,0xA2,0x87,0xC0,0x13,0x1D,0xC1,0x27,0x87,0xAF,0x9D,0x8A,0x66,0xD9,0xA6,0x87,0x29,0xB3,0x85,0x18,0xC6,0x0D,0x89,0xAE,0x0F,0x05,0xC1,0xAF,0x53,
+0xFE,0x65,0xA7,0x9B,0x77,0x0D,0x18,0xC8,0x3B,0x0C,0x36,0x1A,0x18,0xC1,0x0E,0xFE,0x09,0x21,0x19,0x9C,0xAB,0x05,0xC1,0x15,0x10,0x0A,0x05,0xD5,0x13,0x49,0x9A,0x8B,
+0x75,0x20,0xA0,0xA8,0xA0,0xC7,0x9D,0xB7,0x7E,0xA3,0x99,0xA0,0xB7,0x33,0x3D,0x51,0xC0,0xA3,0x98,0xC0,0x3D,0xA2,0x87,0xC0,0x05,0x29,0x05,0x13,0x1D,0xC1,0x27,0x87,
+0xAF,0x9C,0x8A,0xDA,0x3F,0x36,0x1A,0x18,0xC7,0x0D,0x89,0xAE,0xFE,0x00,0x40,0x05,0xC0,0xA5,0x87,0xFE,0x54,0xE7,0x1A,0x0E,0xA4,0x77,0x18,0xC6,0x0D,0x84,0xAF,0x0F,
+0xB2,0x53,0x0D,0x18,0xC2,0x2C,0x0F,0x0C,0x05,0xC2,0xAF,0x55,0x99,0x99,0x19,0x0C,0x05,0xD3,0xA9,0x85,0xAF,0x87,0xFE,0x69,0x01,0x25,0x33,0xA3,0x78,0x9E,0xB9,0x29,
+0xC1,0x66,0x29,0xC0,0x24,0xA2,0x87,0x05,0xC1,0x6E,0xC0,0x05,0x31,0x05,0x13,0x1D,0xC0,0xA7,0x76,0x6C,0x8B,0x8E,0x9D,0x9A,0xDA,0xAF,0x54,0xFE,0x6E,0x27,0x18,0xC9,
+0x97,0x9A,0xFE,0x09,0x81,0x19,0x05,0xC0,0xB8,0x21,0x1A,0x18,0x99,0x9B,0x0A,0xA6,0x88,0x18,0xC4,0x0A,0xFE,0x09,0x81,0x05,0x2B,0x28,0x0D,0x18,0xC1,0x8F,0xAD,0x19,
+0x14,0x59,0x05,0xC1,0x2B,0x2E,0x19,0x05,0xD5,0x22,0x9F,0xF8,0x33,0x3D,0x29,0x3D,0x29,0xC0,0x24,0xA2,0x87,0x29,0xC0,0x24,0x31,0xA3,0x88,0xC0,0x66,0x31,0x05,0xC0,
+0x0A,0x05,0x13,0x1D,0xC0,0xA7,0x76,0xA0,0x65,0xFE,0x00,0x20,0xDB,0xAF,0x54,0xFE,0x6E,0x27,0x18,0xCA,0x12,0x19,0x05,0xC0,0x15,0x36,0x1A,0x18,0xC0,0x94,0x8B,0x0D,
+0x18,0xC3,0x3B,0xFE,0x00,0x60,0x05,0xC1,0xB8,0x10,0x0D,0x18,0xC0,0x25,0xFE,0x01,0x60,0x05,0xC4,0x10,0x2E,0x0F,0x05,0xC1,0x0F,0x05,0xD1,0xB8,0x73,0xFE,0x8A,0x21,
+0x29,0xC0,0x24,0xA2,0x87,0x29,0x24,0x29,0xC0,0xA3,0x98,0xC1,0x0A,0x05,0x0A,0xC0,0x05,0x31,0x05,0x31,0x13,0x1D,0xC0,0xA7,0x76,0x32,0xFE,0x00,0x20,0xDB,0xB3,0x33,
+0x36,0x18,0xCA,0x9D,0x9B,0x2C,0xFE,0x00,0x60,0x63,0x2B,0xFE,0x54,0xE7,0x18,0xC2,0x97,0x9A,0x0E,0xA8,0x75,0x18,0xC0,0x25,0xFE,0x0A,0x00,0x05,0xC3,0x08,0x36,0x1A,
+0x18,0x3E,0x0F,0x05,0xC4,0xAF,0x54,0x99,0x9A,0x19,0x0C,0x05,0xD3,0x3F,0xB0,0x95,0xFE,0x8A,0x21,0x29,0xC1,0x24,0xA2,0x87,0xA3,0x88,0x3D,0x0A,0xC1,0x66,0x31,0x05,
+0x0A,0xC0,0x05,0x31,0x29,0xFE,0x4A,0x25,0x1D,0xC0,0x27,0x92,0x9C,0x91,0x9D,0xDB,0xB3,0x33,0xFE,0x6E,0x27,0x18,0xCB,0x39,0xFE,0x01,0x00,0x05,0xC0,0xFE,0x3B,0xE5,
+0xB5,0x50,0x18,0xC3,0x0E,0xA4,0x77,0x06,0x8D,0x9D,0x19,0x14,0x59,0x05,0xC0,0x0A,0x05,0x0C,0x36,0x18,0x3B,0x19,0x05,0xC4,0xA6,0x87,0xA9,0x55,0x37,0x05,0xD5,0xAC,
+0x87,0xAD,0xA2,0xFE,0x99,0x61,0x33,0xA1,0xA9,0xC0,0x3D,0xC0,0xA2,0x87,0xC2,0x05,0x51,0x05,0x0A,0xC1,0x05,0x31,0xFE,0x4A,0x25,0xC0,0x1D,0xAE,0x52,0x8B,0x9D,0x17,
+0x9D,0x9A,0xDA,0xAF,0x33,0x0D,0x18,0xCB,0x06,0x3E,0xFE,0x00,0x60,0x05,0xB8,0x10,0x0D,0x18,0xC4,0x0D,0x95,0x99,0x8F,0xAF,0x0F,0x63,0x05,0xC4,0xAF,0x54,0x0E,0x39,
+0xFE,0x01,0x00,0x05,0xC5,0x10,0xC0,0x96,0xBB,0x05,0xD5,0xB8,0x73,0x9C,0xF7,0x3D,0x51,0xC1,0x66,0xA2,0x87,0xA3,0x88,0x3D,0x0A,0xC0,0x66,0x31,0x05,0x0A,0xC2,0x13,
+0x1D,0xC0,0x27,0x87,0xAF,0x9D,0x8A,0x66,0xDA,0x10,0xFE,0x55,0x63,0x06,0x18,0xC8,0x06,0x18,0xC0,0x39,0x19,0x14,0xAE,0x43,0x0D,0x18,0xC6,0x99,0x9C,0x91,0x9B,0xFE,
+0x01,0x60,0x97,0xDD,0x05,0xC4,0x10,0x29,0xFE,0x09,0x81,0x19,0x05,0xC4,0x2B,0x2E,0x19,0x14,0x0A,0x05,0xC0,0x0A,0x05,0xD0,0x3A,0xB4,0x93,0xFE,0x99,0x61,0x33,0x62,
+0xC0,0x24,0xA2,0x87,0x29,0x24,0x3D,0xA2,0x87,0xC1,0x3D,0x0A,0xC1,0x3D,0x13,0x1D,0x0F,0x27,0x17,0x05,0x6E,0x05,0xD9,0x10,0x12,0x1A,0x18,0xCB,0x0D,0xFE,0x0A,0x00,
+0x93,0xEF,0x06,0x2C,0x18,0x9D,0x9A,0x18,0xC6,0x97,0x9A,0xFE,0x23,0x03,0x28,0x05,0xC4,0x10,0xA4,0x87,0x99,0x9A,0x05,0xC5,0x10,0x13,0x0F,0x05,0xD5,0xB8,0x73,0xFE,
+0x8A,0x21,0xFE,0xB1,0x81,0xC0,0x6E,0x05,0x29,0xC0,0x24,0xA2,0x87,0x0A,0x3D,0x0A,0x29,0x05,0xC1,0x29,0xFE,0x4A,0x25,0xC0,0xA8,0x66,0x04,0x17,0x9D,0x9A,0xDC,0xFE,
+0x3C,0x62,0x1A,0x18,0xCC,0x12,0xFE,0x00,0xA0,0xA1,0xAA,0x0E,0x06,0x18,0xC6,0x06,0x18,0x06,0x39,0xFE,0x22,0x84,0x19,0x14,0x59,0x05,0xC0,0x0A,0x32,0x2E,0x9B,0x88,
+0x0A,0x05,0xC4,0x0C,0x19,0x05,0xD5,0xB3,0x84,0x35,0x3D,0x7E,0xC0,0x6E,0x29,0x05,0xC1,0x24,0x29,0x05,0xC0,0x0A,0x05,0x29,0x31,0x13,0xC0,0x0F,0x04,0x88,0x8F,0xDD,
+0xFE,0x23,0x41,0x1A,0x18,0xC8,0x06,0x18,0xC1,0x25,0xFE,0x02,0x00,0x93,0xFF,0xFE,0x54,0xE7,0x1A,0x18,0xC7,0x06,0x18,0xC0,0x06,0x39,0x8F,0xAC,0x0F,0x63,0x05,0xC1,
+0x2B,0xAA,0x34,0x9C,0x99,0x0F,0x05,0xC1,0x0F,0x05,0xAB,0x55,0xC0,0x05,0xD5,0xAB,0x86,0xAE,0xA3,0xFE,0x99,0x61,0x31,0xA2,0x88,0x3D,0x29,0xC0,0x05,0xC0,0x3D,0x29,
+0x05,0xC1,0x0A,0xC0,0x29,0x13,0xC0,0xAB,0x75,0x99,0x89,0x8C,0x9E,0xDD,0xB3,0x33,0xFE,0x65,0xA7,0x18,0xC7,0x9D,0x9A,0x18,0xC3,0x15,0x19,0xFE,0x3C,0x62,0x1A,0x18,
+0xCD,0x12,0x2C,0xFE,0x00,0x60,0x63,0x05,0xC0,0x6E,0xA9,0x77,0x2E,0x19,0x05,0xC3,0xAF,0x54,0x0F,0x05,0xC1,0x0F,0x05,0xD0,0xA9,0x85,0xB0,0xA4,0x37,0x9F,0xB8,0x29,
+0xC0,0x66,0x31,0x29,0x24,0x3D,0x31,0xA2,0x88,0x3D,0x05,0xC0,0x6E,0x29,0x13,0x1D,0xA8,0x55,0x9B,0x97,0x17,0x9D,0x9A,0xDC,0xAB,0x44,0xFE,0x5D,0xA6,0x18,0xC6,0x9D,
+0x9A,0x18,0xC4,0x0E,0xFE,0x09,0x21,0x12,0x1A,0x18,0xC8,0x06,0x18,0xC3,0x0D,0x39,0x8A,0xCE,0x93,0xEF,0x05,0xC0,0x6E,0x15,0xA5,0x55,0x0A,0x05,0xC2,0x24,0x9C,0x99,
+0x0F,0x05,0xD3,0x3C,0xAB,0xA4,0xFE,0x99,0x61,0x31,0x3D,0x29,0xC2,0x66,0x31,0xA3,0x88,0x3D,0x0A,0xC1,0x66,0x31,0xFE,0x4A,0x25,0xC0,0xAB,0x75,0x20,0x8C,0x9E,0xDD,
+0x3A,0x12,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0xC0,0x06,0xFE,0x0A,0xA0,0x12,0x1A,0x18,0xCA,0x06,0x18,0xC3,0x0D,0x3B,0x19,0x05,0xC1,0x10,0xA4,0x66,0x92,0xDD,0x05,0xC1,
+0x2B,0x24,0x93,0xDD,0x05,0x19,0x9D,0xBB,0x0A,0x05,0xC0,0x0A,0x05,0xCC,0xB0,0x74,0x35,0x3D,0x7E,0x31,0x29,0xC0,0x66,0x31,0x29,0x24,0x3D,0x31,0xA3,0x88,0xC0,0x05,
+0x31,0x05,0x13,0x1D,0xAE,0x52,0x91,0x9C,0x91,0x9D,0xDE,0xFE,0x23,0x41,0x1A,0x18,0xC6,0x9D,0x9A,0x18,0xC3,0x0D,0x3B,0x12,0x1A,0x18,0xCB,0x06,0x18,0xC3,0x0D,0x12,
+0x19,0x05,0xC1,0x2E,0x19,0x05,0xC2,0xAF,0x54,0x49,0xC5,0x99,0xBB,0x19,0x0C,0x05,0xCA,0xB7,0x74,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0x3D,0x29,0xC1,0x66,0x29,0xC2,0x05,
+0xC0,0x3D,0x0A,0xC1,0x13,0x1D,0xAB,0x62,0x3A,0x91,0x9D,0xDE,0x31,0x0D,0x18,0xC9,0x06,0x18,0xC1,0x97,0x9A,0x0E,0x18,0xC6,0x06,0x18,0xCB,0x2C,0xFE,0x00,0x60,0x0C,
+0x05,0x37,0xA7,0x66,0x92,0xDD,0x05,0xC0,0x17,0x2E,0xA0,0x65,0x0F,0x05,0xC0,0x0A,0x0F,0x32,0x10,0x2E,0x10,0x0A,0x05,0xC8,0x2B,0xB6,0x83,0xFE,0x89,0x40,0x33,0x29,
+0xA3,0x98,0xC0,0x51,0x29,0x05,0xC0,0x3D,0x29,0x31,0x05,0x3D,0x05,0x6E,0xC0,0xFE,0x4A,0x25,0x1D,0x27,0x3A,0x91,0x9D,0xDE,0xAA,0x64,0x0E,0x06,0x18,0xC7,0x06,0x18,
+0xC3,0x39,0xAE,0x73,0x18,0xC8,0x06,0x18,0xC8,0x3B,0x19,0x05,0xC1,0x2E,0x19,0x05,0xC0,0x2E,0x9B,0x88,0x0F,0x05,0xC0,0xA8,0x55,0xA3,0x77,0x19,0x06,0xC1,0x10,0x96,
+0xBB,0x05,0xC2,0x0A,0x05,0xC3,0xB0,0x74,0xA9,0xB5,0xFE,0x99,0x61,0x31,0x3D,0x29,0xA3,0x98,0x29,0x05,0xC1,0x9C,0x89,0x29,0xC0,0x05,0x6E,0xC0,0x05,0x31,0x13,0xC0,
+0x27,0x8C,0x9D,0x97,0x9C,0xDF,0xFE,0x43,0xE6,0x1A,0x18,0xC9,0x9D,0x9A,0x18,0xC1,0x92,0x9B,0x18,0xC7,0x06,0x18,0xCA,0x12,0x19,0x14,0x59,0x05,0xAF,0x54,0x99,0x9A,
+0x05,0xAF,0x33,0x0A,0x05,0xC0,0x17,0xA7,0x78,0x10,0x37,0x19,0xC0,0x14,0x0A,0x05,0xC0,0x0A,0x05,0xC0,0x0A,0x05,0xC4,0xB7,0x74,0x35,0x3D,0x7E,0x6E,0xC0,0x05,0x51,
+0x29,0x05,0xC0,0x3D,0x29,0x31,0x05,0xC0,0x3D,0x0A,0xC0,0x13,0x7B,0x36,0x8D,0x9C,0x95,0x9D,0xDF,0xAF,0x54,0xFE,0x65,0xA7,0x1A,0x18,0xC9,0x06,0x18,0xC0,0x0E,0x06,
+0x18,0xC8,0x06,0x18,0xC8,0x8F,0xAD,0x19,0x05,0xC1,0x2E,0x9B,0x88,0x24,0x92,0xDD,0x05,0x19,0xA7,0x66,0xA8,0x77,0xC0,0x9C,0x76,0xC0,0x28,0x05,0xCC,0x3F,0xB7,0x82,
+0xFE,0x8A,0x21,0xFE,0xB1,0x81,0x3D,0xA2,0x87,0xC0,0x05,0x51,0x29,0x05,0xC1,0x3D,0x29,0x31,0x05,0xC1,0x0A,0xFE,0x4A,0x25,0x1D,0x36,0x8D,0x9C,0x95,0x9D,0xDF,0x10,
+0x39,0x1F,0x18,0xC9,0x9D,0x9A,0x18,0xC0,0x06,0x9A,0x88,0x06,0x18,0xC9,0x06,0x18,0xC6,0x8A,0x9E,0xFE,0x00,0x60,0x05,0xC1,0x38,0xA0,0x54,0x0F,0x05,0x15,0x10,0x9D,
+0x99,0xC0,0x19,0x9C,0xAB,0x2B,0x2E,0x0F,0x05,0xC1,0x0F,0x05,0xC7,0x22,0xA6,0xA5,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x6E,0x05,0x0A,0x05,0x9D,0x89,0xC3,0x05,0x0A,0x05,
+0x29,0xC0,0x05,0xFE,0x4A,0x25,0x1D,0x36,0x8B,0x9D,0x97,0x9C,0xDF,0x2B,0xFE,0x23,0x41,0x1A,0x18,0xC7,0x06,0x18,0xC3,0x39,0x18,0xD0,0x06,0x18,0x06,0x2C,0xFE,0x00,
+0x60,0x0C,0x05,0xC0,0x2E,0x9B,0x88,0x0F,0x66,0x05,0xC0,0x19,0xA4,0x77,0xA3,0x77,0x37,0x19,0x24,0x06,0x0F,0x05,0xC9,0xA6,0x87,0xB5,0x84,0xFE,0x8A,0x21,0xFE,0xB1,
+0x81,0x3D,0xA2,0x87,0xC1,0x05,0x31,0x05,0x31,0x29,0x05,0xC1,0x9C,0x89,0x29,0x05,0xC0,0x3D,0x13,0xC0,0xAB,0x75,0x8E,0x8B,0x17,0x9D,0x9A,0xDF,0xAF,0x54,0xFE,0x55,
+0x63,0xAA,0x77,0x18,0xC6,0x9D,0x9A,0x18,0xC3,0x92,0x9B,0x18,0xC8,0x06,0x18,0xC7,0x99,0x9C,0xFE,0x02,0x00,0x93,0xFF,0x05,0xC0,0xA5,0x87,0xAA,0x34,0x0F,0x05,0xC1,
+0x2B,0xA2,0x79,0xA4,0x54,0xC0,0x7B,0x44,0x24,0x2E,0x19,0x05,0xC9,0x22,0xA6,0xA5,0x09,0x9E,0xB9,0x6E,0xC0,0x05,0x51,0x05,0x0A,0xC1,0x29,0xC0,0x66,0x31,0x0A,0x3D,
+0x0A,0x29,0x0A,0x13,0xC0,0xAB,0x75,0x8E,0x8B,0x97,0x9C,0xE0,0x10,0xB3,0x42,0x1F,0x18,0xC7,0x9D,0x9A,0x18,0xC2,0x94,0x8B,0x0D,0x18,0xC7,0x06,0x18,0xC7,0x39,0x28,
+0x05,0xC1,0xAA,0x66,0x40,0x19,0x0C,0x05,0xC7,0x10,0x37,0x19,0x0C,0x05,0xC6,0xA9,0x97,0xB1,0x94,0xFE,0x8A,0x21,0xFE,0xB1,0x81,0x3D,0x0A,0xC2,0x05,0x0A,0xC0,0x05,
+0x31,0x29,0x05,0xC2,0x0A,0x05,0x0A,0xFE,0x4A,0x25,0x1D,0xA8,0x55,0x12,0x95,0x9D,0xE1,0xAF,0x54,0x2C,0x18,0xC7,0x06,0x18,0xC2,0x99,0x9B,0x50,0x18,0xC6,0x06,0x18,
+0xC8,0xFE,0x23,0x41,0x19,0x05,0xC0,0x2B,0xAA,0x34,0x93,0xDD,0x05,0xC4,0x10,0x31,0x19,0x14,0x59,0x05,0x10,0x0A,0x05,0xC6,0x2B,0xB2,0x73,0xA2,0xD8,0x3D,0xA2,0x87,
+0xC1,0x3D,0x0A,0xC0,0x66,0x51,0x05,0x0A,0xC1,0x29,0x05,0xC0,0x0A,0x05,0x0A,0x05,0x13,0x1D,0xA8,0x55,0x12,0x95,0x9D,0xE1,0xAB,0x44,0xFE,0x3C,0x62,0x1A,0x18,0xCC,
+0x35,0x18,0xC6,0x9D,0x9A,0x18,0xC8,0xFE,0x0A,0x00,0x93,0xEF,0x05,0xC0,0x10,0xC0,0x05,0xC5,0x2B,0x37,0xA3,0x77,0x37,0x10,0x2E,0x10,0x0F,0x05,0xC1,0x0F,0x05,0xC2,
+0x3C,0xAF,0x75,0xFE,0x99,0x61,0xA1,0xB8,0xC0,0x0A,0x05,0x0A,0x05,0x3D,0x0A,0xC1,0x3D,0x0A,0x05,0xC0,0x0A,0x05,0x0A,0x05,0x3D,0x0A,0xFE,0x4A,0x25,0xC0,0x27,0x92,
+0x9C,0x91,0x9D,0xE2,0x08,0xB7,0x52,0x18,0xCC,0x8F,0x9C,0x0D,0x18,0x9D,0x9A,0x18,0x06,0x18,0x06,0x0D,0xC0,0x18,0x06,0xC0,0x18,0x06,0x0D,0x1A,0x18,0x06,0x95,0x9D,
+0x19,0x14,0x59,0x05,0xAF,0x54,0x0F,0x05,0xC1,0x0F,0x05,0xC6,0x2B,0x31,0x99,0x9A,0x05,0xC5,0xA6,0x87,0xB5,0x83,0x9A,0xF9,0xFE,0xB1,0x81,0xC0,0x6E,0x05,0x0A,0x05,
+0x3D,0x0A,0x9D,0x99,0x05,0x3D,0x05,0x0A,0xC1,0x05,0x31,0x05,0x0A,0xC1,0xAB,0x78,0x99,0x97,0x9D,0xAA,0x5A,0xC1,0xB3,0x84,0xBD,0x86,0xC0,0x90,0x8A,0x8E,0x9A,0xA9,
+0x77,0x05,0xC1,0xA5,0x87,0xB8,0x74,0xBD,0x97,0xA2,0x9A,0x98,0x76,0xC0,0x87,0x9A,0x89,0x9C,0x17,0x05,0xAB,0x86,0xBD,0x84,0xB6,0x89,0x6B,0x22,0x05,0xD3,0xB0,0x95,
+0xFE,0xD6,0xF5,0x0B,0x7A,0x0B,0x0E,0x04,0x34,0x3C,0x8A,0x9A,0x05,0xC0,0xB5,0x84,0xBB,0x86,0x04,0x0B,0xC0,0x9D,0x98,0x96,0x79,0x8A,0x98,0x8C,0x89,0x05,0xE8,0xB0,
+0x74,0xAB,0x94,0x9C,0x7A,0x9A,0x7D,0xAB,0xA6,0xFE,0xF7,0xFA,0xFE,0x63,0x25,0xBB,0x7D,0x0B,0xC0,0x69,0x0B,0xC1,0x04,0x0B,0xC1,0x92,0x86,0x04,0x0E,0x3A,0x0B,0x8F,
+0xAB,0xFE,0x19,0x02,0xA9,0x9A,0x2D,0xAA,0x99,0xA1,0x9A,0x2D,0x36,0x05,0xAC,0x87,0xFE,0xD6,0xD7,0xA9,0x88,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x0B,0x2B,0x19,0x0B,0xC0,
+0x04,0x98,0x9B,0xFE,0x39,0xE4,0xAE,0x8A,0xBD,0x88,0x31,0xC1,0x1B,0x89,0x98,0x85,0x86,0x9E,0x9B,0x25,0x0C,0xA8,0x77,0x0E,0x0B,0x0E,0x0B,0xC0,0x0E,0x19,0x2B,0x0E,
+0x0B,0x12,0x82,0x99,0x99,0x79,0xFE,0xEF,0xBB,0x31,0xC3,0x9B,0x87,0x84,0x74,0xA9,0xAC,0x22,0x8D,0x9D,0xD9,0xB8,0x73,0xFE,0xE7,0x79,0x31,0xC2,0x37,0xFE,0x1B,0x41,
+0x92,0xDF,0x99,0xBB,0xB1,0x31,0xB3,0xBD,0x3D,0x36,0x0C,0xA8,0x77,0x0E,0xC0,0x0B,0x9A,0x99,0x34,0x0B,0x0E,0x8E,0x89,0x33,0xB3,0x89,0x0B,0xFE,0x23,0x41,0xA8,0xDA,
+0x2A,0x31,0x0C,0x86,0x78,0x12,0x0B,0x0E,0x0B,0x3A,0x94,0x76,0x0B,0x0E,0xFE,0x73,0xAD,0x1B,0xA1,0x9A,0x33,0x2D,0x9E,0x86,0x33,0x31,0xC1,0x88,0x86,0x2A,0x33,0xFE,
+0x10,0xC2,0x07,0x89,0xAD,0xDF,0xAE,0x85,0xAD,0x83,0x3F,0xFE,0xEF,0xBB,0x31,0xC3,0x1B,0x9C,0x88,0x3D,0xA9,0x87,0x31,0xC1,0x30,0x0C,0x0B,0xC0,0x0E,0x0B,0x8F,0xA8,
+0x04,0x2B,0x8F,0x8B,0x31,0xC6,0x2D,0x37,0x31,0xCA,0x2D,0x3D,0x0B,0x0E,0xC0,0x0B,0x92,0x86,0x2B,0x0B,0x11,0x33,0xA5,0x9A,0xC4,0x3D,0x21,0x80,0xBC,0xA4,0x76,0x39,
+0x89,0xAF,0xDB,0xBB,0x84,0x21,0x37,0x1B,0x31,0xC7,0x33,0x8D,0x98,0x2A,0x3A,0x0B,0x04,0x0B,0x34,0xC0,0x0B,0x0E,0x37,0x11,0x3D,0xA4,0x8A,0xC0,0x3D,0x91,0x9A,0x2D,
+0x12,0x0B,0x2A,0x36,0x05,0xA9,0x97,0xAA,0x75,0x17,0x05,0xDD,0xBB,0x82,0x9B,0x87,0x0B,0xC2,0x0E,0x0C,0x8F,0x86,0xA3,0x87,0x0B,0xC0,0x04,0x0B,0x0E,0x0B,0x0E,0x0B,
+0xC1,0x34,0x37,0x2D,0x0B,0xC1,0x04,0x0B,0xC1,0x0E,0x0B,0xFE,0x4A,0x86,0x05,0xC3,0xA6,0x87,0xAA,0x75,0x05,0xD9,0x3F,0xB6,0x71,0x9A,0x89,0x9A,0x6E,0x7A,0x1A,0x1D,
+0xC2,0x9D,0xA9,0x0B,0xC0,0x0E,0xC2,0x0B,0x8E,0x99,0x05,0xC4,0xA5,0x87,0x9C,0x9A,0x05,0xC2,0x2B,0x14,0x2B,0xFE,0xBE,0x54,0x12,0x0E,0x12,0x69,0x3C,0x05,0xC5,0x3A,
+0x06,0x05,0xD7,0x20,0xB3,0x83,0x06,0x1D,0x0B,0xFE,0x63,0x25,0x05,0xE0,0x16,0xA6,0x75,0xA0,0x25,0x93,0xEF,0x30,0x12,0x0B,0x0E,0xC2,0x0B,0xC0,0x19,0xFE,0x4A,0x25,
+0x3F,0x11,0x0B,0xC0,0x0E,0x51,0x95,0x79,0x33,0x2A,0xA4,0x87,0x0E,0xC0,0x0B,0xC0,0x14,0x05,0xBC,0x87,0x0C,0x0B,0x0E,0xC1,0x9D,0x88,0xFE,0x4B,0x0A,0x3D,0x0B,0x0E,
+0xC1,0x0B,0x0E,0x3A,0x0E,0x0B,0x0E,0x0B,0x0C,0xFE,0x42,0xA9,0x05,0xE1,0x20,0x29,0x0F,0xA3,0x99,0xA6,0x55,0x05,0xAF,0x44,0x05,0xAF,0x54,0x98,0x89,0x9D,0xAA,0x14,
+0x59,0x05,0xC0,0x19,0xA7,0x66,0xB3,0x53,0xA4,0x63,0x06,0x19,0x05,0xE6,0xB9,0x84,0x97,0x89,0xFE,0x55,0x63,0x9D,0x8A,0x12,0xC2,0xA6,0x88,0xA4,0x77,0xA6,0x86,0x51,
+0x3E,0xFE,0x00,0x40,0x05,0xE5,0xA6,0x87,0xB2,0x74,0x94,0x9C,0x9D,0xC9,0x24,0x3C,0x05,0xE7,0xA8,0x55,0xFE,0x44,0xC5,0xAE,0x72,0xC6,0x06,0xC0,0x18,0xC0,0x8B,0xBF,
+0x19,0x14,0x0A,0x05,0xE3,0xA9,0x97,0xAE,0x65,0x3C,0xAA,0x13,0x1A,0x18,0xC4,0x39,0xFE,0x6B,0xAB,0xA0,0x9A,0xA0,0x54,0x1A,0x18,0x3B,0x19,0x9C,0xAA,0xC3,0xAF,0x54,
+0xFE,0x6E,0x27,0x18,0xC4,0xFE,0x54,0xE7,0xFE,0x6B,0xAB,0x16,0x05,0xFE,0x65,0xA7,0x1A,0x9A,0x89,0xFE,0x0A,0x00,0x93,0xEF,0x62,0xAB,0x44,0x2E,0xA6,0x64,0x39,0xA5,
+0x84,0x2C,0x18,0x9D,0x9A,0x8D,0x9D,0x0F,0x05,0xC1,0x10,0x2E,0x19,0x9D,0xAA,0xAA,0x44,0x08,0x3B,0x39,0x25,0x0D,0x9A,0x87,0xFE,0x23,0x03,0x0F,0x05,0xC1,0x0F,0x10,
+0xFE,0x3C,0x62,0x1A,0x18,0xC3,0x12,0xFE,0x5B,0xAA,0xA3,0x54,0xFE,0x6E,0x26,0x18,0xC0,0x0D,0x95,0x99,0x18,0x06,0x18,0xC1,0x0A,0x10,0x29,0x0A,0x06,0x18,0xC4,0x08,
+0x0F,0x05,0xC1,0x0F,0x28,0x39,0xAE,0x73,0x18,0xC3,0x99,0x9C,0x18,0xC3,0x12,0x0A,0x06,0x18,0xC2,0x08,0x0F,0x05,0xC2,0xAA,0x66,0x10,0x96,0xBB,0x05,0xD5,0xA9,0x85,
+0xAE,0x75,0x95,0xAE,0x42,0xA2,0x98,0xC0,0x26,0xA4,0x87,0x36,0x29,0x0D,0x18,0xC6,0x0D,0x19,0x0F,0x62,0xC1,0xAF,0x53,0xFE,0x65,0xA7,0x35,0x0D,0x18,0xC8,0x3B,0xFE,
+0x22,0x84,0x36,0x1A,0x18,0xC1,0x0E,0x37,0x9C,0x99,0x9C,0xAB,0x05,0xC1,0x15,0x10,0x0A,0x05,0xD5,0xB0,0x95,0x49,0x9A,0x8B,0x26,0x9F,0xB8,0xA0,0xA8,0xA0,0xC7,0x70,
+0x25,0x1A,0x18,0xC7,0x0D,0x89,0xAE,0x0A,0x05,0xC0,0xA5,0x87,0xFE,0x54,0xE7,0x1A,0x0E,0x2C,0x18,0xC6,0x0D,0x84,0xAF,0x0F,0xB2,0x53,0x0D,0x18,0xC2,0x2C,0x0F,0x0C,
+0x05,0xC1,0x14,0xAE,0x44,0x37,0x19,0x0C,0x05,0xD3,0xA9,0x85,0xAF,0x87,0xFE,0x71,0x00,0xA3,0xC8,0x79,0x7B,0x7E,0x9D,0x89,0x0D,0x18,0xC9,0x97,0x9A,0xFE,0x09,0x81,
+0x95,0xDD,0xC1,0xB8,0x21,0x1A,0x18,0x25,0x0A,0xA6,0x88,0x18,0xC4,0x0A,0xFE,0x09,0x81,0x05,0x2B,0x28,0x0D,0x18,0xC1,0x8F,0xAD,0x19,0x14,0x59,0x05,0xC1,0x2B,0x2E,
+0x19,0x05,0xD5,0x13,0xA2,0xD6,0x3D,0xC0,0x29,0x3D,0x29,0x36,0x18,0xC0,0x25,0xFE,0x01,0x60,0x05,0xC4,0x10,0x2E,0x93,0xCC,0x05,0xB7,0x10,0x36,0x1A,0x18,0x3E,0x0F,
+0x05,0xC4,0x31,0x99,0x9A,0x05,0xFE,0x55,0x63,0x36,0x18,0xCB,0x9D,0x9A,0x3E,0xFE,0x00,0x40,0x05,0xAB,0x44,0xFE,0x5D,0xA6,0x18,0x9D,0x9A,0x18,0xC6,0x97,0x9A,0x19,
+0x90,0xCD,0x9A,0xBB,0x05,0xC3,0x10,0x31,0x37,0x14,0x05,0xC4,0x10,0xA4,0x66,0x10,0x2E,0x95,0xBB,0x05,0xC2,0x14,0xFE,0x55,0x63,0xFE,0x4A,0x43,0x05,0xDD,0x2B,0x12,
+0x1A,0x18,0xC9,0x06,0x18,0xC0,0x06,0xFE,0x0A,0xA0,0x12,0x1A,0x18,0xCA,0x06,0x18,0xC3,0x0D,0x3B,0x19,0x05,0xC1,0x10,0x24,0x92,0xDD,0x05,0xC1,0x2B,0x24,0x0F,0x05,
+0x19,0x05,0x0A,0xFE,0x23,0x41,0x1A,0x18,0xC6,0x06,0x18,0xC3,0x0D,0x12,0xFE,0x22,0x84,0x9C,0x76,0x0F,0x0A,0xC0,0x37,0x0E,0x06,0x18,0xC7,0x06,0x18,0xC3,0x92,0x9E,
+0xAE,0x73,0x18,0xC8,0x06,0x18,0xC8,0x3B,0x19,0x05,0xC1,0x2E,0x19,0x05,0xC0,0x2E,0x9B,0x88,0x0F,0x05,0x0A,0x18,0x12,0x19,0x05,0xC1,0x2E,0x37,0x7F,0x0A,0x05,0x19,
+0x06,0x0C,0xC0,0x13,0xC0,0x18,0x8A,0x9E,0x0A,0x05,0xC1,0x38,0x13,0x0F,0x05,0xAA,0x66,0x10,0x9D,0x99,0xC0,0x19,0x9C,0xAB,0x2B,0x1A,0x2C,0x0F,0x0C,0x05,0xC0,0x24,
+0x9B,0x99,0x0F,0x0A,0x05,0x14,0x19,0xA4,0x77,0x06,0x37,0xC0,0x2E,0xFE,0x55,0x63,0xAA,0x77,0x18,0xC6,0x9D,0x9A,0x18,0xC3,0x92,0x9B,0x18,0xC8,0x06,0x18,0xC7,0x99,
+0x9C,0xFE,0x02,0x00,0x0F,0x05,0xC0,0x2B,0xAA,0x34,0x0F,0x05,0xC1,0xA3,0x87,0xA8,0x56,0x59,0xC0,0x28,0x05,0x0C,0x05,0xC4,0x6E,0xC0,0x27,0x8E,0x9C,0x05,0xE0,0x0A,
+0x06,0xFE,0x3C,0x62,0x1A,0x18,0xCC,0x35,0x18,0xC6,0x9D,0x9A,0x18,0xC8,0x13,0x05,0xC1,0x10,0xC0,0x05,0xC5,0x2B,0x37,0x10,0x06,0x18,0x06,0xC0,0x18,0x06,0x0D,0x1A,
+0x18,0x06,0x39,0x19,0x05,0x0A,0x05,0x31,0x0F,0x05,0xC1,0x0F,0x05,0xC6,0x2B,0x31,0x0F,0xBE,0x61,0x96,0x9A,0x8D,0x9D,0xAA,0x78,0xA4,0x87,0xC0,0xA3,0x78,0x22,0x05,
+0xD1,0xAF,0x84,0x98,0x89,0x05,0xF3,0xA6,0x87,0xB1,0x73,0xA8,0x76,0x98,0x9C,0x8A,0x9C,0xA4,0x87,0xBB,0x85,0xBB,0x98,0xA3,0x89,0x7A,0x0B,0x0E,0x9C,0x76,0x91,0x98,
+0x22,0xAA,0x74,0x0E,0xC0,0xFE,0x4A,0xA4,0x07,0xFE,0xF7,0xFB,0x0E,0x0B,0x69,0x0B,0x8F,0xA8,0x83,0x7A,0xFE,0xD6,0xF5,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x2B,0xFE,0x4B,
+0x0A,0x05,0xC0,0xB3,0x85,0xAC,0x85,0x8C,0x8A,0x05,0xE4,0xA7,0x87,0xBB,0x95,0x05,0x29,0xBA,0x99,0x2B,0xC0,0x89,0x88,0x12,0x0B,0x2B,0x1F,0x31,0x05,0xE3,0xA9,0x97,
+0x27,0xB4,0x8C,0x2B,0xA3,0x89,0x0E,0xC0,0x0B,0x0E,0x0B,0xC0,0x93,0x89,0xA3,0x96,0xAA,0x8A,0x04,0x0B,0xC0,0x8A,0x86,0xAD,0x9C,0x0B,0x0E,0xC0,0x0B,0x05,0xB9,0x76,
+0xBD,0xA8,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x2B,0x34,0x0B,0x0E,0x0B,0x9A,0x99,0x34,0x0B,0x0E,0x0B,0xC0,0x95,0x8B,0x07,0x95,0xAD,0xFE,0xD6,0xD7,0xA9,0x88,0x0B,0xC0,
+0x0E,0x0B,0xC0,0x0E,0x0B,0x2B,0x99,0x87,0x0B,0xC0,0x04,0x0C,0xFE,0x39,0xE4,0xAE,0x8A,0xBD,0x88,0xA5,0x9A,0xC1,0x54,0x88,0x84,0x84,0x9C,0xA7,0x8A,0x0C,0x12,0x0E,
+0x0B,0x0E,0x0B,0xC0,0x0E,0x19,0x2B,0x0B,0xC0,0x12,0x82,0x99,0x29,0xFE,0xEF,0xBB,0x31,0xC3,0x33,0x6C,0x31,0xC4,0x1B,0x05,0x37,0x16,0xB3,0x89,0xFE,0xF7,0xDB,0x2A,
+0x31,0xC2,0x0C,0x83,0x00,0xA0,0x58,0x9C,0xCA,0xA4,0x66,0x37,0x30,0xC0,0xBE,0x77,0x0E,0xC0,0x0B,0x0E,0x9A,0x89,0x34,0x0B,0x0E,0x19,0x25,0xFE,0xDE,0xF8,0x88,0x12,
+0x91,0x9A,0xA0,0x9A,0x15,0x3D,0x31,0xC1,0x0C,0x33,0x31,0xC2,0x37,0xFE,0x1B,0x41,0x92,0xDF,0x99,0xBB,0xB1,0x42,0xB3,0xAC,0x3D,0xFE,0x31,0xA5,0x0C,0xA8,0x77,0x0E,
+0xC0,0x0B,0x9A,0x99,0x34,0x0B,0x0E,0x8E,0x89,0x9A,0x8A,0xB3,0x89,0xFE,0x2B,0x24,0x13,0x06,0xAE,0x31,0x2D,0x31,0xC1,0x88,0x86,0xB3,0x89,0x31,0xC2,0x2D,0x12,0x9B,
+0x9A,0x13,0x12,0xFE,0xA5,0x72,0x31,0x30,0x21,0xB2,0x78,0x0E,0xC0,0x0B,0x19,0x9C,0x75,0x0B,0x0E,0x30,0x0C,0x12,0x23,0x91,0x42,0x4A,0xA6,0xDB,0x33,0x31,0xC0,0x33,
+0x21,0x31,0xC0,0x33,0x2D,0x9E,0x86,0x33,0x31,0xC1,0x88,0x86,0x2A,0x33,0xFE,0x10,0xC2,0x07,0x89,0xAD,0xDF,0x3C,0xAD,0x83,0x8E,0x8D,0x0B,0x2D,0xAB,0x96,0x84,0x98,
+0xFE,0x00,0x20,0xB6,0x70,0xA3,0x9C,0x27,0x0E,0x0B,0x3D,0x21,0x33,0xC0,0x11,0xC0,0xA7,0x87,0xA5,0xAA,0xA8,0x77,0x0E,0xC0,0x5A,0x04,0x0B,0xC2,0x93,0x89,0xA9,0x96,
+0x9E,0x9B,0xFE,0x29,0x43,0x27,0x96,0x9C,0xA8,0x84,0x0A,0x05,0xDC,0xAB,0x86,0xFE,0xBE,0x31,0x0E,0x04,0x0E,0xC0,0x5A,0x0E,0x0B,0xC0,0x0E,0x0B,0xC1,0x04,0x0B,0xC4,
+0x34,0x37,0x2D,0x0B,0xC1,0x04,0x0B,0xC2,0x0E,0xC2,0x0B,0x37,0x05,0xC4,0xA3,0x87,0x0E,0xC0,0x0B,0x0E,0x2B,0xFE,0x4A,0x86,0x05,0xC4,0x3A,0x0B,0xC2,0x04,0x0B,0xC1,
+0x0E,0x0B,0xC0,0x00,0x05,0xC0,0xAF,0x87,0x11,0x2B,0x0B,0xC0,0x0E,0x2B,0x0B,0x2A,0xA2,0x97,0x0B,0xC0,0x04,0x0B,0xC1,0x0E,0x0B,0x37,0x17,0x05,0xBC,0x87,0x0C,0x12,
+0x0E,0xC0,0x0B,0x21,0x34,0x0B,0x30,0x12,0x0E,0xC3,0x0B,0xC0,0x19,0xFE,0x4A,0x25,0x3F,0x11,0x0B,0xC0,0x0E,0x3A,0x95,0x79,0x33,0x2A,0x0E,0xC0,0xFE,0x08,0x41,0x30,
+0x12,0x69,0x0E,0x0B,0x0E,0x0B,0xC0,0x11,0x0F,0xFE,0xBE,0x54,0xAD,0x98,0x0E,0x21,0x33,0x11,0x3D,0x0B,0xC1,0x04,0x0A,0x05,0x16,0x0C,0x0B,0x0E,0xC1,0x2B,0xFE,0x4B,
+0x0A,0x3D,0x0B,0x0E,0xC1,0x0B,0x0E,0x3A,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0x0E,0x0B,0x0E,0x0B,0xC0,0x04,0x0B,0xC0,0x9A,0x99,0xFE,0x4B,0x0A,0x0B,0xC0,0x04,
+0x0B,0xC1,0x0E,0x0B,0x0E,0x0B,0x0E,0x2D,0x25,0x05,0x0B,0xC0,0x11,0x3F,0x05,0xE3,0xA9,0x97,0xB2,0x73,0x94,0x4A,0x91,0xED,0x05,0xE3,0x20,0xC0,0x05,0x2E,0xAF,0x40,
+0x99,0xAD,0x06,0x9D,0xAA,0xFE,0x76,0x67,0x52,0x9A,0x87,0x9D,0x8A,0x9B,0xAA,0xC2,0xA6,0x88,0xA4,0x77,0xA7,0x85,0x9D,0x9A,0x3E,0xFE,0x00,0x40,0x05,0xE5,0xA6,0x87,
+0xB2,0x74,0x94,0x9C,0x6B,0xFE,0x76,0x87,0x18,0xC5,0x06,0xC0,0x18,0xC0,0x3B,0xFE,0x00,0xA0,0x05,0x0A,0x05,0xE3,0x16,0xAC,0x75,0x3D,0x41,0x18,0xFE,0x41,0x44,0x2C,
+0x05,0xD7,0x07,0x98,0x47,0xA8,0x65,0x3B,0xA7,0x78,0xA7,0x85,0x0D,0x9A,0x87,0x19,0xFE,0x00,0x60,0x05,0xC1,0x0F,0xA9,0x66,0x12,0x1A,0x18,0xC3,0x12,0xFE,0x5B,0xAA,
+0xA3,0x54,0x06,0x18,0xC0,0x0D,0x95,0x99,0x18,0x06,0x18,0xC1,0x25,0xFE,0x01,0x60,0x97,0xDD,0x05,0xC1,0xA5,0x87,0x2E,0xFE,0x55,0x63,0x06,0x18,0xC4,0x19,0x0F,0x05,
+0xC1,0x0F,0x28,0x39,0x1F,0x18,0xC3,0x0D,0x18,0xC3,0x12,0x0A,0x06,0x18,0xC2,0xFE,0x22,0xC2,0x0F,0x05,0xC2,0x10,0x17,0xFE,0x5D,0xA6,0x8D,0xAD,0xFE,0x00,0x40,0x05,
+0xC0,0x2B,0xFE,0x54,0xE7,0x1A,0x0E,0x2C,0x18,0xC6,0x0D,0x84,0xAF,0x0F,0xB2,0x53,0x0D,0x18,0xC2,0x2C,0x0F,0x63,0x05,0xC1,0x14,0xAE,0x44,0x99,0x99,0x9C,0x99,0x0C,
+0x05,0xD3,0xA9,0x85,0xAF,0x95,0xFE,0x71,0x00,0xA3,0xC8,0x79,0xA3,0x78,0x0C,0x0A,0xAE,0x54,0x99,0x9A,0x98,0xBB,0xC5,0x10,0x9C,0x88,0x2E,0x9B,0x88,0x0A,0x05,0xC3,
+0x0A,0x0F,0xFE,0x23,0x41,0x1A,0x18,0xC8,0x06,0x18,0xC1,0x25,0xFE,0x02,0x00,0x0F,0xFE,0x54,0xE7,0x1A,0x18,0xC7,0x06,0x18,0xC0,0x06,0x39,0x3E,0x05,0x31,0x0F,0x05,
+0xC1,0x0F,0x05,0xD0,0xA9,0x85,0xB0,0xA4,0xFE,0x89,0x40,0xFE,0x5D,0xA5,0xA8,0x76,0x18,0xC5,0x06,0x18,0xC4,0x0E,0x37,0xFE,0x3C,0x62,0x1F,0x18,0xC9,0x06,0x18,0xC0,
+0x06,0x2C,0x25,0x0E,0x18,0xC6,0x06,0x18,0xCB,0x2C,0x0A,0x0C,0x69,0xA8,0x55,0xA7,0x66,0x0A,0x05,0xC0,0xA3,0x87,0xB0,0x34,0x9C,0x76,0x93,0xEF,0x0A,0x05,0x0A,0x0F,
+0x37,0x0A,0x19,0x14,0x0A,0x05,0x31,0x37,0x05,0x24,0x0A,0x05,0xC0,0x14,0xA9,0x66,0x5D,0x19,0x05,0xC1,0x2E,0x9B,0x88,0x7F,0x0A,0x05,0x19,0x06,0x0C,0xC0,0x13,0x0A,
+0x05,0xC1,0x38,0x13,0x0F,0x05,0x15,0x10,0x9D,0x99,0xC0,0x19,0x9C,0xAB,0x0F,0x0C,0x05,0xC0,0x2E,0x9B,0x88,0x0F,0x0A,0x05,0x14,0x19,0xA4,0x77,0x06,0x37,0x05,0xC1,
+0x2B,0x24,0x0F,0x05,0xC1,0x37,0x10,0x06,0xC1,0x05,0x0A,0x05,0x10,0x37,0x19,0x0C,0x05,0xC6,0x3F,0x19,0x14,0x0A,0x05,0x10,0x0F,0x05,0xC6,0x2B,0xB2,0x73,0x10,0xC1,
+0x2E,0x10,0x0F,0x05,0xC1,0x0F,0x05,0xC2,0x3C,0xAF,0x75,0xBD,0x74,0x95,0x7B,0xFE,0xF7,0xFA,0x81,0x75,0x94,0xAD,0x1D,0x5A,0x1D,0xC1,0xA2,0xA5,0xAA,0x74,0xFE,0x32,
+0x27,0x1D,0xC2,0x94,0xA8,0xB6,0x83,0x9D,0x8A,0x1D,0xC2,0x8F,0xBA,0xAB,0x86,0x24,0x22,0x1D,0x52,0x9B,0xA9,0x05,0xC0,0x22,0x27,0x8D,0x8F,0x7B,0xA3,0x99,0x0B,0xC0,
+0x84,0x98,0x05,0x29,0xBA,0x99,0xAE,0x75,0xC0,0x89,0x88,0x85,0x9B,0x0B,0x98,0x87,0xFE,0x39,0xE4,0xBC,0x78,0x2B,0x0B,0xC0,0x7A,0x2B,0x85,0x89,0xBE,0x87,0x8A,0x87,
+0xAD,0x9C,0x0B,0x0E,0xC0,0x0B,0x2B,0x37,0x1F,0xB8,0x99,0x34,0x0B,0x0E,0x0B,0xC0,0x95,0x8B,0x82,0x96,0x90,0x8B,0xAF,0x79,0xBC,0x92,0x04,0x0E,0x51,0x0B,0x37,0xFE,
+0x29,0x43,0xA7,0x8A,0x2D,0xAA,0x99,0x3D,0xFE,0x4A,0xA4,0x8C,0x9E,0xD9,0x0F,0xFE,0xE7,0x5B,0xA5,0x9A,0xC2,0x37,0xFE,0x1B,0x41,0x92,0xDF,0x99,0xBB,0xB3,0x32,0xB1,
+0xBC,0x3D,0xFE,0x31,0xA5,0xFE,0xDE,0xF8,0xA8,0x77,0x0E,0xC0,0x0B,0x9A,0x99,0x34,0x0B,0x0E,0x8E,0x89,0x9A,0x8A,0xB4,0x76,0xFE,0x1B,0x41,0x4A,0xA6,0xDB,0xBD,0xEE,
+0x95,0x87,0xC0,0xA8,0x9B,0x31,0xFE,0x53,0x04,0xFE,0xF7,0xFB,0x9D,0x97,0x0B,0x21,0x37,0x3D,0xA9,0x87,0xC0,0x0E,0xC0,0x3D,0xFE,0x10,0xC1,0x9D,0x89,0x2B,0xB2,0x73,
+0x0E,0x0B,0xC1,0x0E,0x0B,0x04,0x0B,0xC1,0x21,0xFE,0x00,0x20,0xC1,0xB5,0x84,0x3C,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x0E,0x0B,0xC0,0x11,0x05,0xC3,0xA6,0x87,
+0xAA,0x75,0x05,0xDA,0x22,0xA8,0x84,0x1D,0xC0,0xA0,0xB4,0x05,0xC0,0x39,0xA1,0x9A,0x1D,0xC0,0x05,0xAB,0x86,0xB3,0x83,0x0A,0x1D,0x1A,0x05,0x0F,0xC0,0x1D,0xC1,0x20,
+0x36,0x06,0x18,0x1D,0xC0,0xAA,0xA4,0x99,0x88,0x94,0x9E,0x26,0x69,0xA2,0x99,0x27,0xFE,0x31,0xA5,0x26,0x3D,0x26,0x36,0x0B,0x32,0x39,0xAF,0xAD,0xB5,0x85,0x12,0x0B,
+0x04,0x0B,0xC3,0x11,0xFE,0x19,0x02,0x05,0xE3,0xA9,0x97,0xB0,0x75,0x89,0x8C,0xFE,0x23,0x41,0xB9,0x62,0xFE,0x22,0xC2,0x0F,0x05,0xC1,0x0F,0xB6,0x21,0xAD,0x53,0xAE,
+0x73,0x69,0xC3,0x9D,0x9B,0x18,0xC3,0x8F,0xAD,0xA8,0x75,0xA6,0x88,0x18,0xC2,0x08,0x0F,0x05,0xC2,0xAB,0x55,0xC0,0x96,0xBB,0x05,0xD5,0xA9,0x85,0xAE,0x75,0x3D,0x18,
+0xFE,0x22,0x03,0x18,0x1A,0x18,0x0F,0x15,0x1A,0x18,0xC6,0x06,0x18,0xC3,0x0D,0x12,0xC0,0x1A,0x18,0xCB,0x06,0x18,0xC3,0x0D,0x12,0xFE,0x00,0xA0,0x9C,0xAA,0xC1,0xAF,
+0x44,0x19,0x05,0xC2,0x2E,0x05,0x3C,0x19,0x05,0xC1,0x2E,0x99,0xAA,0x05,0xC2,0xAF,0x55,0xA0,0x54,0x05,0xE0,0x2E,0xFE,0x55,0x63,0xAA,0x77,0x18,0xC6,0x06,0x18,0xC3,
+0x92,0x9B,0x18,0xC8,0x06,0x18,0xC7,0x99,0x9C,0xFE,0x02,0x00,0x05,0xC1,0xA5,0x87,0xAA,0x34,0x0F,0x05,0xC1,0xA3,0x87,0x52,0xFE,0x54,0xE7,0x1F,
+};
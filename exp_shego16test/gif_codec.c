@@ -0,0 +1,61 @@
+// gif_codec.c - packed RGB565 animation frames, streaming decoder
+#include "gif_codec.h"
+
+#include <string.h>
+
+// Table slot of a colour; gif2_pack.py uses the same hash
+static inline uint8_t slot(uint16_t c) {
+    return ((c >> 11) * 3 + ((c >> 5) & 63) * 5 + (c & 31) * 7) & 63;
+}
+
+static inline uint16_t pack(int r, int g, int b) {
+    return ((r & 31) << 11) | ((g & 63) << 5) | (b & 31);
+}
+
+void gif_codec_begin(gif_codec_t *d, const uint8_t *src) {
+    d->src = src;
+    d->prev = 0;
+    d->run = 0;
+    memset(d->table, 0, sizeof(d->table));
+}
+
+void gif_codec_decode(gif_codec_t *d, uint16_t *out, uint16_t count) {
+    const uint8_t *p = d->src;
+    uint16_t px = d->prev;
+    uint8_t run = d->run;
+
+    while (count) {
+        if (run) {
+            uint8_t n = run < count ? run : count;
+            run -= n;
+            count -= n;
+            while (n--) *out++ = px;
+            continue;
+        }
+
+        uint8_t op = *p++;
+        if (op < GIF_CODEC_OP_DIFF) {
+            px = d->table[op];
+        } else if (op < GIF_CODEC_OP_LUMA) {
+            px = pack((px >> 11) + ((op >> 4) & 3) - 2, ((px >> 5) & 63) + ((op >> 2) & 3) - 2, (px & 31) + (op & 3) - 2);
+        } else if (op < GIF_CODEC_OP_RUN) {
+            // Arithmetic shift, like the encoder's floor division
+            int dg = (op & 63) - 32;
+            int rb = *p++;
+            px = pack((px >> 11) + (rb >> 4) - 8 + (dg >> 1), ((px >> 5) & 63) + dg, (px & 31) + (rb & 15) - 8 + (dg >> 1));
+        } else if (op == GIF_CODEC_OP_RGB) {
+            px = (p[0] << 8) | p[1];
+            p += 2;
+        } else {
+            run = (op & 63) + 1;
+            continue;
+        }
+        d->table[slot(px)] = px;
+        *out++ = px;
+        count--;
+    }
+
+    d->src = p;
+    d->prev = px;
+    d->run = run;
+}
@@ -0,0 +1,36 @@
+/* gif_codec.h - packed RGB565 animation frames (gif/gif2_pack.py)
+ * A QOI-style byte stream per frame, specialised for RGB565: every pixel is
+ * a run of the previous one, a slot in a 64-entry table of recent colours,
+ * a small per-channel step, a green-led step, or a literal. Frames start
+ * from black with an empty table, so any frame decodes on its own. The
+ * decoder is resumable at any pixel count, which lets display.c decode a
+ * scanline at a time into a small buffer while the previous lines stream.
+ *
+ *   00iiiiii                 INDEX  colour table slot i
+ *   01rrggbb                 DIFF   r, g, b each -2..1 of the previous pixel
+ *   10gggggg rrrrbbbb        LUMA   g -32..31; r and b -8..7 of g/2
+ *   11nnnnnn                 RUN    previous pixel n+1 times (n < 62)
+ *   11111110 hhhhhhhh llllllll  RGB  literal pixel, high byte first
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define GIF_CODEC_OP_INDEX 0x00
+#define GIF_CODEC_OP_DIFF  0x40
+#define GIF_CODEC_OP_LUMA  0x80
+#define GIF_CODEC_OP_RUN   0xC0
+#define GIF_CODEC_OP_RGB   0xFE
+
+typedef struct {
+    const uint8_t *src;
+    uint16_t prev;
+    uint8_t run;  // copies of prev still owed from a RUN
+    uint16_t table[64];
+} gif_codec_t;
+
+// Start decoding the frame at src
+void gif_codec_begin(gif_codec_t *d, const uint8_t *src);
+
+// Decode the next count pixels of the frame into out
+void gif_codec_decode(gif_codec_t *d, uint16_t *out, uint16_t count);
@@ -0,0 +1,66 @@
+// hall_adc.c - RP2040 ADC differential non-linearity correction
+#include "hall_adc.h"
+#include "shego16.h"
+
+#include "hardware/resets.h"
+#include "hardware/structs/adc.h"
+
+uint16_t hall_adc_lut[4096];
+
+static hall_adc_config_t *const config = &kb_config.adc;
+
+void hall_adc_config_defaults(hall_adc_config_t *out) {
+    for (uint8_t i = 0; i < HALL_ADC_WIDE_CODES; i++) {
+        out->extra[i] = HALL_ADC_DNL_DEFAULT;
+    }
+}
+
+// The wide codes take their extra width from all the others, so full scale
+// stays 4096 LSB. In 1/16 LSB, code c starts at c * base / 4096 plus the
+// extra of the wide codes below it. The reading is the centre of the code's
+// range less half an LSB, so a perfect ADC maps code c to c.
+static void build(void) {
+    uint32_t extra_sum = 0;
+    for (uint8_t i = 0; i < HALL_ADC_WIDE_CODES; i++) extra_sum += config->extra[i];
+    uint32_t base = (4096u << HALL_ADC_FRAC_BITS) - extra_sum;
+    uint32_t half = 1u << (HALL_ADC_FRAC_BITS - 1);
+
+    uint32_t lower = 0;
+    uint32_t below = 0;
+    for (uint32_t code = 0; code < 4096; code++) {
+        if ((code & 1023) == 512) below += config->extra[code >> 10];
+        uint32_t upper = (code + 1) * base / 4096 + below;
+        uint32_t centre = (lower + upper) / 2;
+        hall_adc_lut[code] = centre > half ? centre - half : 0;
+        lower = upper;
+    }
+}
+
+void hall_adc_init(void) {
+    build();
+}
+
+void hall_adc_get(hall_adc_config_t *out) {
+    *out = *config;
+}
+
+void hall_adc_set(const hall_adc_config_t *in) {
+    *config = *in;
+    build();
+    kb_config_save();
+}
+
+void hall_adc_hw_init(void) {
+    reset_block(RESETS_RESET_ADC_BITS);
+    unreset_block_wait(RESETS_RESET_ADC_BITS);
+    adc_hw->cs = ADC_CS_EN_BITS;
+    while (!(adc_hw->cs & ADC_CS_READY_BITS)) {
+    }
+}
+
+uint16_t hall_adc_hw_read(uint8_t input) {
+    adc_hw->cs = ADC_CS_EN_BITS | ((uint32_t)input << ADC_CS_AINSEL_LSB) | ADC_CS_START_ONCE_BITS;
+    while (!(adc_hw->cs & ADC_CS_READY_BITS)) {
+    }
+    return (uint16_t)adc_hw->result;
+}
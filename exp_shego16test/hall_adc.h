@@ -0,0 +1,57 @@
+/* hall_adc.h - RP2040 ADC differential non-linearity correction
+ * Codes 512, 1536, 2560 and 3584 are several LSB wider than the rest, so a
+ * slowly moving input sticks on them and the averaged readings show a step
+ * there. Every raw code goes through a 4096-entry table (RAM, one load per
+ * sample) that returns the centre of the code's real input range with
+ * HALL_ADC_FRAC_BITS fraction bits, before oversampling, filtering and
+ * thresholds. The table is built from the extra width of each wide code:
+ * a compile-time default, optionally replaced per unit (raw HID,
+ * tools/adc_dnl.py).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HALL_ADC_FRAC_BITS 4
+#define HALL_ADC_WIDE_CODES 4  // 512, 1536, 2560, 3584
+
+// Extra width of each wide code in 1/16 LSB
+#ifndef HALL_ADC_DNL_DEFAULT
+#define HALL_ADC_DNL_DEFAULT 128
+#endif
+
+typedef struct {
+    uint8_t extra[HALL_ADC_WIDE_CODES];
+} hall_adc_config_t;
+
+void hall_adc_config_defaults(hall_adc_config_t *config);
+
+// Build the table from kb_config; before the first ADC read
+void hall_adc_init(void);
+
+extern uint16_t hall_adc_lut[4096];
+
+// Raw 12-bit code -> corrected reading, HALL_ADC_FRAC_BITS fraction bits
+static inline uint16_t hall_adc_correct(uint16_t code) {
+    return hall_adc_lut[code & 0xFFF];
+}
+
+// Sum of n corrected readings -> rounded average in ADC counts
+static inline uint16_t hall_adc_average(uint32_t sum, uint8_t n) {
+    uint32_t div = (uint32_t)n << HALL_ADC_FRAC_BITS;
+    return (sum + div / 2) / div;
+}
+
+// Per-unit widths (raw HID); the table is rebuilt in place, so samples
+// taken during a change may mix old and new entries for one scan
+void hall_adc_get(hall_adc_config_t *out);
+void hall_adc_set(const hall_adc_config_t *in);
+
+// Direct register access for the DMA engine and the core 1 scanner, which
+// keep the ChibiOS analog driver (analogReadPin) off the ADC. The input
+// pins are set up by the caller.
+void hall_adc_hw_init(void);
+
+// One blocking conversion of ADC input 0..3, raw 12-bit code
+uint16_t hall_adc_hw_read(uint8_t input);
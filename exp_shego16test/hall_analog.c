@@ -0,0 +1,73 @@
+// hall_analog.c - analog key depth for the host (joystick axes, raw HID)
+// Built only with JOYSTICK_ENABLE (post_rules.mk); hall_analog.h has the
+// stand-ins otherwise
+#include "hall_analog.h"
+#include "seqbuf.h"
+#include "shego16.h"
+#include "joystick.h"
+
+static hall_analog_config_t *const config = &kb_config.analog;
+
+static seqbuf_t snapshot_buf;
+static hall_analog_t snapshot_slots[2];
+
+void hall_analog_publish(const hall_analog_t *snapshot) {
+    seqbuf_publish(&snapshot_buf, snapshot_slots, snapshot, sizeof(*snapshot));
+}
+
+bool hall_analog_read(hall_analog_t *out) {
+    return seqbuf_read(&snapshot_buf, snapshot_slots, out, sizeof(*out)) != 0;
+}
+
+_Static_assert(JOYSTICK_AXIS_COUNT == HALL_ANALOG_AXES, "JOYSTICK_AXIS_COUNT must match HALL_ANALOG_AXES");
+
+// Axes are set from the depth snapshots, not from analog pins
+joystick_config_t joystick_axes[JOYSTICK_AXIS_COUNT] = {
+    JOYSTICK_AXIS_VIRTUAL,
+    JOYSTICK_AXIS_VIRTUAL,
+    JOYSTICK_AXIS_VIRTUAL,
+    JOYSTICK_AXIS_VIRTUAL,
+};
+
+static int16_t axis_value(const hall_analog_t *snapshot, uint8_t axis) {
+    int16_t depth = 0;
+    uint8_t pos = config->axis[axis][0];
+    uint8_t neg = config->axis[axis][1];
+    if (pos < HALL_ANALOG_KEYS) depth += snapshot->depth[pos];
+    if (neg < HALL_ANALOG_KEYS) depth -= snapshot->depth[neg];
+    return (int32_t)depth * JOYSTICK_MAX_VALUE / 255;
+}
+
+void hall_analog_task(void) {
+    // Only new snapshots, and only axes that moved, so a resting pad
+    // sends no joystick reports at all
+    static uint32_t seen_gen;
+    static int16_t sent[HALL_ANALOG_AXES];
+    if (snapshot_buf.gen == seen_gen) return;
+
+    hall_analog_t snapshot;
+    seen_gen = seqbuf_read(&snapshot_buf, snapshot_slots, &snapshot, sizeof(snapshot));
+    for (uint8_t axis = 0; axis < HALL_ANALOG_AXES; axis++) {
+        int16_t value = axis_value(&snapshot, axis);
+        if (value == sent[axis]) continue;
+        sent[axis] = value;
+        joystick_set_axis(axis, value);
+    }
+}
+
+bool hall_analog_get_axis(uint8_t axis, uint8_t *pos, uint8_t *neg) {
+    if (axis >= HALL_ANALOG_AXES) return false;
+    *pos = config->axis[axis][0];
+    *neg = config->axis[axis][1];
+    return true;
+}
+
+bool hall_analog_set_axis(uint8_t axis, uint8_t pos, uint8_t neg) {
+    if (axis >= HALL_ANALOG_AXES) return false;
+    if (pos >= HALL_ANALOG_KEYS) pos = HALL_ANALOG_NONE;
+    if (neg >= HALL_ANALOG_KEYS) neg = HALL_ANALOG_NONE;
+    config->axis[axis][0] = pos;
+    config->axis[axis][1] = neg;
+    kb_config_save();
+    return true;
+}
@@ -0,0 +1,85 @@
+/* hall_analog.h - analog key depth for the host
+ * The scanner publishes the depth of every key from each processed scan;
+ * core 0 maps it onto joystick axes (QMK joystick interface) and answers
+ * raw HID depth polls (SHEGO_HID_ANALOG, Wooting-style). No ADC reads of
+ * its own.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+#define HALL_ANALOG_KEYS (MATRIX_ROWS * MATRIX_COLS)  // indexed row * MATRIX_COLS + col
+#define HALL_ANALOG_NONE 0xFF                         // no key on this side of an axis
+
+#ifndef HALL_ANALOG_AXES
+#define HALL_ANALOG_AXES 4
+#endif
+
+typedef struct {
+    uint32_t time_us;                 // sample time of the scan
+    uint8_t depth[HALL_ANALOG_KEYS];  // 0 at rest .. 255 at HALL_TRAVEL_MAX, 0 without a sensor
+} hall_analog_t;
+
+// Axis = depth of pos key - depth of neg key; a single key gives 0..max
+// (throttle), a pair gives -max..max (stick)
+typedef struct {
+    uint8_t axis[HALL_ANALOG_AXES][2];  // [pos, neg] key index or HALL_ANALOG_NONE
+} hall_analog_config_t;
+
+// Default mapping: WASD stick on X/Y, W and S as throttle/brake on Z/RZ.
+// Stored in kb_config with or without JOYSTICK_ENABLE, so a later build
+// with the gamepad finds it.
+static inline void hall_analog_config_defaults(hall_analog_config_t *config) {
+#define HALL_ANALOG_KEY(row, col) ((row) * MATRIX_COLS + (col))
+    static const uint8_t axes[HALL_ANALOG_AXES][2] = {
+        {HALL_ANALOG_KEY(2, 2), HALL_ANALOG_KEY(2, 0)},  // X: D / A
+        {HALL_ANALOG_KEY(2, 1), HALL_ANALOG_KEY(1, 1)},  // Y: S / W
+        {HALL_ANALOG_KEY(1, 1), HALL_ANALOG_NONE},       // Z: W
+        {HALL_ANALOG_KEY(2, 1), HALL_ANALOG_NONE},       // RZ: S
+    };
+#undef HALL_ANALOG_KEY
+    for (uint8_t i = 0; i < HALL_ANALOG_AXES; i++) {
+        config->axis[i][0] = axes[i][0];
+        config->axis[i][1] = axes[i][1];
+    }
+}
+
+#ifdef JOYSTICK_ENABLE
+// Scanner: once per processed scan
+void hall_analog_publish(const hall_analog_t *snapshot);
+
+// Core 0: newest snapshot, false before the first calibrated scan
+bool hall_analog_read(hall_analog_t *out);
+
+// Core 0: push changed axes to the joystick report (housekeeping)
+void hall_analog_task(void);
+
+// Axis mapping accessors (raw HID), saved with kb_config
+bool hall_analog_get_axis(uint8_t axis, uint8_t *pos, uint8_t *neg);
+bool hall_analog_set_axis(uint8_t axis, uint8_t pos, uint8_t neg);
+#else
+// Built without JOYSTICK_ENABLE (rules.mk): nothing is kept, and the raw
+// HID depth and axis commands are refused
+static inline void hall_analog_publish(const hall_analog_t *snapshot) {
+    (void)snapshot;
+}
+static inline bool hall_analog_read(hall_analog_t *out) {
+    (void)out;
+    return false;
+}
+static inline void hall_analog_task(void) {}
+static inline bool hall_analog_get_axis(uint8_t axis, uint8_t *pos, uint8_t *neg) {
+    (void)axis;
+    (void)pos;
+    (void)neg;
+    return false;
+}
+static inline bool hall_analog_set_axis(uint8_t axis, uint8_t pos, uint8_t neg) {
+    (void)axis;
+    (void)pos;
+    (void)neg;
+    return false;
+}
+#endif
@@ -0,0 +1,143 @@
+// hall_calib.c - per-key rest/bottom-out calibration
+#include "quantum.h"
+#include "eeconfig.h"
+#include "print.h"
+#include "hall_calib.h"
+#include "shego16.h"
+
+// Scans averaged at boot to learn the rest level
+#define HALL_CALIB_BOOT_SCANS 64
+
+// Span used until a key has been through a calibration pass, and the
+// smallest span a pass must see before it replaces the stored one
+#define HALL_CALIB_DEFAULT_SPAN 400
+#define HALL_CALIB_MIN_SPAN 100
+
+// A boot level further than span / HALL_CALIB_REST_DRIFT_DIV from the stored
+// rest means the key was held during the capture, not that the rest drifted
+#define HALL_CALIB_REST_DRIFT_DIV 4
+
+// Stored with the rest of the keyboard settings
+static hall_calib_data_t *const calib = &kb_config.calib;
+
+static uint32_t active_channels;
+
+// Boot capture accumulators
+static uint32_t boot_sum[HALL_CHANNELS];
+static uint16_t boot_scans;
+
+// Calibration pass: min/max seen per channel. Flags are set on core 0 and
+// acted on by whichever core scans.
+static uint16_t pass_min[HALL_CHANNELS];
+static uint16_t pass_max[HALL_CHANNELS];
+static volatile bool pass_requested;
+static volatile bool pass_running;
+static volatile bool save_pending;
+static volatile bool cal_dirty;
+static uint16_t cal_generation;
+
+void hall_calib_init(uint32_t active) {
+    active_channels = active;
+    boot_scans = 0;
+    memset(boot_sum, 0, sizeof(boot_sum));
+}
+
+static void derive_travel(hall_travel_cal_t cal[]) {
+    cal_generation++;
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        if (!(active_channels & (1UL << ch))) continue;
+        hall_travel_set_cal(&cal[ch], calib->rest[ch], calib->bottom[ch]);
+    }
+}
+
+static void finish_boot_capture(void) {
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        uint16_t rest = boot_sum[ch] / HALL_CALIB_BOOT_SCANS;
+        // Keep the stored span and move it onto the fresh rest level
+        uint16_t span = calib->bottom[ch] > calib->rest[ch] ? calib->bottom[ch] - calib->rest[ch] : 0;
+        if (span < HALL_CALIB_MIN_SPAN) {
+            span = HALL_CALIB_DEFAULT_SPAN;  // nothing stored yet, take the level as is
+        } else {
+            uint16_t drift = rest > calib->rest[ch] ? rest - calib->rest[ch] : calib->rest[ch] - rest;
+            if (drift > span / HALL_CALIB_REST_DRIFT_DIV) continue;  // held down, keep the stored rest
+        }
+        calib->rest[ch] = rest;
+        calib->bottom[ch] = rest + span > 4095 ? 4095 : rest + span;
+    }
+}
+
+static void finish_pass(void) {
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        if (!(active_channels & (1UL << ch))) continue;
+        if (pass_max[ch] - pass_min[ch] < HALL_CALIB_MIN_SPAN) continue;  // key not exercised
+        calib->rest[ch] = pass_min[ch];
+        calib->bottom[ch] = pass_max[ch];
+    }
+    save_pending = true;
+}
+
+bool hall_calib_update(const uint16_t samples[], hall_travel_cal_t cal[]) {
+    if (boot_scans < HALL_CALIB_BOOT_SCANS) {
+        for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) boot_sum[ch] += samples[ch];
+        if (++boot_scans < HALL_CALIB_BOOT_SCANS) return false;
+        finish_boot_capture();
+        derive_travel(cal);
+        return true;
+    }
+
+    if (pass_requested != pass_running) {
+        if (pass_requested) {
+            memcpy(pass_min, samples, sizeof(pass_min));
+            memcpy(pass_max, samples, sizeof(pass_max));
+        } else {
+            finish_pass();
+            cal_dirty = true;
+        }
+        pass_running = pass_requested;
+    }
+
+    if (pass_running) {
+        for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+            if (samples[ch] < pass_min[ch]) pass_min[ch] = samples[ch];
+            if (samples[ch] > pass_max[ch]) pass_max[ch] = samples[ch];
+        }
+    }
+
+    if (cal_dirty) {
+        cal_dirty = false;
+        derive_travel(cal);
+    }
+    return true;
+}
+
+void hall_calib_toggle(void) {
+    pass_requested = !pass_requested;
+}
+
+bool hall_calib_active(void) {
+    return pass_requested;
+}
+
+void hall_calib_task(void) {
+    if (!save_pending) return;
+    save_pending = false;
+    kb_config_save();
+
+    uprintf("hall_calib: saved\n");
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        if (!(active_channels & (1UL << ch))) continue;
+        uprintf("  ch%u rest=%u bottom=%u\n", ch, calib->rest[ch], calib->bottom[ch]);
+    }
+}
+
+uint16_t hall_calib_generation(void) {
+    return cal_generation;
+}
+
+uint16_t hall_calib_rest(uint8_t ch) {
+    return calib->rest[ch];
+}
+
+uint16_t hall_calib_bottom(uint8_t ch) {
+    return calib->bottom[ch];
+}
@@ -0,0 +1,42 @@
+/* hall_calib.h - per-key rest/bottom-out calibration for the hall sensors
+ * Rest levels are re-captured at every boot, except for keys that read far
+ * from their stored rest (held down while plugging in); the travel span
+ * to bottom-out is learnt in a calibration pass started with CAL_TOGG and kept
+ * in the EEPROM kb datablock. The scanner gets the result as per-key
+ * travel normalization (hall_travel.h).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_engine.h"
+#include "hall_travel.h"
+
+// Persisted layout, part of kb_config_t (shego16.h)
+typedef struct {
+    uint16_t rest[HALL_CHANNELS];
+    uint16_t bottom[HALL_CHANNELS];
+} hall_calib_data_t;
+
+// Start the boot capture from kb_config. active has one bit per populated channel.
+void hall_calib_init(uint32_t active);
+
+// Called once per scan from the scanner with the raw samples. Refreshes
+// cal[] for populated channels whenever calibration changes.
+// Returns false while the boot rest capture is still running.
+bool hall_calib_update(const uint16_t samples[], hall_travel_cal_t cal[]);
+
+// Bumped by hall_calib_update() whenever cal[] was refreshed, so the
+// scanner can rebuild anything derived from it
+uint16_t hall_calib_generation(void);
+
+// Start a calibration pass, or finish the running one and persist it
+void hall_calib_toggle(void);
+bool hall_calib_active(void);
+
+// Core 0 housekeeping: writes EEPROM and reports after a pass finishes
+void hall_calib_task(void);
+
+// Rest / bottom-out ADC counts currently in use for a channel
+uint16_t hall_calib_rest(uint8_t ch);
+uint16_t hall_calib_bottom(uint8_t ch);
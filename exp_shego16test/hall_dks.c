@@ -0,0 +1,105 @@
+// hall_dks.c - Dynamic Keystroke: several actions per key at depth points
+#include <string.h>
+#include "quantum.h"
+#include "hall_dks.h"
+#include "seqbuf.h"
+#include "shego16.h"
+
+// Crossing queue entries (power of two); a crossing is slot << 2 | event
+#ifndef HALL_DKS_QUEUE
+#define HALL_DKS_QUEUE 32
+#endif
+_Static_assert((HALL_DKS_QUEUE & (HALL_DKS_QUEUE - 1)) == 0, "HALL_DKS_QUEUE must be a power of two");
+
+static hall_dks_config_t *const config = &kb_config.dks;
+static volatile uint32_t generation = 1;
+
+static uint8_t queue[HALL_DKS_QUEUE];
+static volatile uint8_t head;
+static volatile uint8_t tail;
+
+void hall_dks_config_defaults(hall_dks_config_t *out) {
+    memset(out, 0, sizeof(*out));
+    for (uint8_t s = 0; s < HALL_DKS_SLOTS; s++) {
+        out->slot[s].key = HALL_DKS_NONE;
+    }
+}
+
+uint32_t hall_dks_generation(void) {
+    return generation;
+}
+
+const hall_dks_slot_t *hall_dks_slot(uint8_t slot) {
+    return &config->slot[slot];
+}
+
+static bool push(uint8_t slot, hall_dks_event_t event) {
+    uint8_t h = head;
+    if (((h + 1) & (HALL_DKS_QUEUE - 1)) == tail) return false;
+    queue[h] = slot << 2 | event;
+    seqbuf_fence();
+    head = (h + 1) & (HALL_DKS_QUEUE - 1);
+    return true;
+}
+
+// A full queue leaves the zone where it was, so the crossing is retried on
+// the next scan instead of lost (a lost release would stick a key)
+void hall_dks_step(hall_dks_key_t *key, uint16_t adc) {
+    while (key->zone < 2 && adc >= key->down[key->zone]) {
+        if (!push(key->slot, key->zone == 0 ? HALL_DKS_DOWN_1 : HALL_DKS_DOWN_2)) return;
+        key->zone++;
+    }
+    while (key->zone > 0 && adc < key->up[key->zone - 1]) {
+        if (!push(key->slot, key->zone == 2 ? HALL_DKS_UP_2 : HALL_DKS_UP_1)) return;
+        key->zone--;
+    }
+}
+
+static void run(const hall_dks_slot_t *slot, hall_dks_event_t event) {
+    for (uint8_t b = 0; b < HALL_DKS_BINDINGS; b++) {
+        uint16_t keycode = slot->keycode[b];
+        if (keycode == KC_NO) continue;
+        switch ((slot->actions[b] >> (event * 2)) & 3) {
+            case HALL_DKS_TAP:
+                tap_code16(keycode);
+                break;
+            case HALL_DKS_PRESS:
+                register_code16(keycode);
+                break;
+            case HALL_DKS_RELEASE:
+                unregister_code16(keycode);
+                break;
+        }
+    }
+}
+
+void hall_dks_task(void) {
+    while (tail != head) {
+        seqbuf_fence();
+        uint8_t entry = queue[tail];
+        tail = (tail + 1) & (HALL_DKS_QUEUE - 1);
+        run(&config->slot[entry >> 2], entry & 3);
+    }
+}
+
+bool hall_dks_get(uint8_t slot, hall_dks_slot_t *out) {
+    if (slot >= HALL_DKS_SLOTS) return false;
+    *out = config->slot[slot];
+    return true;
+}
+
+bool hall_dks_set(uint8_t slot, const hall_dks_slot_t *in) {
+    if (slot >= HALL_DKS_SLOTS) return false;
+
+    // Whatever the old binding holds down would never see its release
+    hall_dks_slot_t *old = &config->slot[slot];
+    for (uint8_t b = 0; b < HALL_DKS_BINDINGS; b++) {
+        if (old->keycode[b] != KC_NO) unregister_code16(old->keycode[b]);
+    }
+
+    *old = *in;
+    if (old->key >= MATRIX_ROWS * MATRIX_COLS) old->key = HALL_DKS_NONE;
+    generation++;
+    kb_config_save();
+    return true;
+}
@@ -0,0 +1,71 @@
+/* hall_dks.h - Dynamic Keystroke: several actions per key at depth points
+ * A slot binds up to HALL_DKS_BINDINGS keycodes to one key. Each keycode
+ * gets an action (tap, press, release) for each of the four crossings of a
+ * stroke: down past point 1, down past point 2, up past point 2, up past
+ * point 1. e.g. tap A at 1.0 mm, press B at 3.5 mm and release it on the
+ * way back up.
+ * The scanner only compares ADC counts against a precomputed list of DKS
+ * keys and queues crossings; core 0 turns them into keycodes. Keys in a slot
+ * are taken out of the matrix, so their keymap keycode does nothing.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HALL_DKS_SLOTS 4
+#define HALL_DKS_BINDINGS 4
+#define HALL_DKS_NONE 0xFF  // slot unused
+#define HALL_DKS_UNIT 2     // point units in 0.01 mm; past the end of travel = bottom-out
+
+typedef enum {
+    HALL_DKS_DOWN_1,
+    HALL_DKS_DOWN_2,
+    HALL_DKS_UP_2,
+    HALL_DKS_UP_1,
+    HALL_DKS_EVENTS
+} hall_dks_event_t;
+
+typedef enum {
+    HALL_DKS_NOTHING,
+    HALL_DKS_TAP,
+    HALL_DKS_PRESS,
+    HALL_DKS_RELEASE
+} hall_dks_action_t;
+
+typedef struct {
+    uint16_t keycode[HALL_DKS_BINDINGS];
+    uint8_t actions[HALL_DKS_BINDINGS];  // 2 bits per hall_dks_event_t, HALL_DKS_DOWN_1 lowest
+    uint8_t key;                         // row * MATRIX_COLS + col, HALL_DKS_NONE = unused
+    uint8_t point[2];                    // depth in HALL_DKS_UNIT; 0 = point not used
+} hall_dks_slot_t;
+
+typedef struct {
+    hall_dks_slot_t slot[HALL_DKS_SLOTS];
+} hall_dks_config_t;
+
+void hall_dks_config_defaults(hall_dks_config_t *config);
+
+// Scanner: one DKS key as evaluated per scan, built from a slot and the
+// key's calibration (shego_adc.c)
+typedef struct {
+    uint8_t ch;         // channel index into samples[]
+    uint8_t slot;
+    uint8_t zone;       // points currently passed, 0..2
+    uint16_t down[2];   // ADC count that passes each point going down
+    uint16_t up[2];     // ... and comes back above it, with hysteresis
+} hall_dks_key_t;
+
+// Bumped on every configuration change; rebuild the key list when it moves
+uint32_t hall_dks_generation(void);
+const hall_dks_slot_t *hall_dks_slot(uint8_t slot);
+
+// Scanner: follow one key's zone and queue the crossings
+void hall_dks_step(hall_dks_key_t *key, uint16_t adc);
+
+// Core 0: run the queued actions (housekeeping)
+void hall_dks_task(void);
+
+// Core 0: slot accessors (raw HID), saved with kb_config
+bool hall_dks_get(uint8_t slot, hall_dks_slot_t *out);
+bool hall_dks_set(uint8_t slot, const hall_dks_slot_t *in);
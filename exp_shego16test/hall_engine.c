@@ -0,0 +1,193 @@
+// hall_engine.c - DMA + ADC round-robin hall-sensor acquisition
+#include "hall_engine.h"
+#include "seqbuf.h"
+#include "hall_filter.h"
+#include "hall_adc.h"
+
+// Channels come from the ChibiOS DMA allocator, which also owns the DMA
+// IRQ and calls back per channel. The registers are programmed through
+// the pico-sdk struct headers only; the hardware_adc/dma/irq libraries are
+// not part of the QMK build.
+#include <hal.h>
+#include "hardware/structs/adc.h"
+#include "hardware/structs/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/timer.h"
+
+// ADC runs at full rate: 96 clocks at 48 MHz per conversion, so one
+// ADC2+ADC3 pair every 4 us
+#define HALL_ENGINE_SAMPLE_US 2
+#define HALL_ENGINE_PAIR_US (2 * HALL_ENGINE_SAMPLE_US)
+
+// Pairs captured per select code. The last HALL_OVERSAMPLE pairs are
+// averaged; the leading ones cover the mux settle time and the DMA IRQ
+// entry latency. An IRQ that comes later than the margin leaves the select
+// lines where they are for one more block.
+#define HALL_ENGINE_MAX_PAIRS 32
+#define HALL_ENGINE_IRQ_MARGIN_US 4
+
+// Mux select lines S0..S3 are GP10..GP13, so one masked write moves all four
+#define MUX_SELECT_SHIFT 10
+#define MUX_SELECT_MASK (0xFu << MUX_SELECT_SHIFT)
+
+// ADC inputs: GP28 = ADC2 (MUX2), GP29 = ADC3 (MUX1)
+#define HALL_ADC_MUX2_INPUT 2
+#define HALL_ADC_RR_MASK ((1u << 2) | (1u << 3))
+
+#define DMA_CTRL_SIZE(size) (DMA_CH0_CTRL_TRIG_DATA_SIZE_VALUE_SIZE_##size << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB)
+#define DMA_CTRL_TREQ(treq) ((uint32_t)(treq) << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)
+#define DMA_CTRL_CHAIN_TO(ch) ((uint32_t)(ch) << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)
+
+// Ping-pong sample blocks. Round-robin starts at ADC2, so each pair is
+// stored as {MUX2, MUX1}. The data channel fills them alternately: at the
+// end of a block it chains to the control channel, which writes the next
+// address from block_addr[] (read ring, 8 bytes) to the data channel's
+// WRITE_ADDR trigger alias. The write pointer never leaves the blocks, however
+// long the IRQ is held off.
+static uint16_t block[2][HALL_ENGINE_MAX_PAIRS * 2];
+static uint32_t block_addr[2] __attribute__((aligned(8)));  // bus addresses, one DMA word each
+static uint8_t data_chan;
+static uint8_t ctrl_chan;
+static uint16_t pairs;
+static uint8_t select_order[HALL_MUX_CHANNELS];
+static uint8_t select_count;
+static uint8_t fill_pos;    // select_order[] position on the select lines
+static uint8_t fill_block;  // block filled at fill_pos since the lines last moved
+
+static hall_snapshot_t building;
+static hall_snapshot_t slots[2];
+static seqbuf_t published;
+static uint32_t consumed_gen;
+static volatile uint32_t scan_count;
+
+static inline void set_select(uint8_t channel) {
+    gpio_put_masked(MUX_SELECT_MASK, (uint32_t)channel << MUX_SELECT_SHIFT);
+}
+
+// Block the data channel is filling and the samples already in it. Read
+// again if the control channel restarted it between the two reads.
+static uint8_t filling_block(uint16_t *done) {
+    uint32_t reload, count;
+    do {
+        reload = dma_hw->ch[ctrl_chan].read_addr;
+        count = dma_hw->ch[data_chan].transfer_count;
+    } while (reload != dma_hw->ch[ctrl_chan].read_addr);
+
+    // The control channel points at the address it loads next
+    uint8_t loaded = reload == (uintptr_t)&block_addr[0] ? 1 : 0;
+    if (count == 0) {
+        // Block finished, restart pending
+        *done = 0;
+        return loaded ^ 1;
+    }
+    *done = 2 * pairs - count;
+    return loaded;
+}
+
+static void harvest_block(uint8_t b, uint8_t pos) {
+    uint8_t channel = select_order[pos];
+    const uint16_t *settled = &block[b][2 * (pairs - HALL_OVERSAMPLE)];
+    uint32_t sum_mux1 = 0, sum_mux2 = 0;
+    for (uint8_t i = 0; i < HALL_OVERSAMPLE; i++) {
+        sum_mux2 += hall_adc_correct(settled[2 * i]);
+        sum_mux1 += hall_adc_correct(settled[2 * i + 1]);
+    }
+    building.adc[HALL_MUX_CHANNELS + channel] = hall_adc_average(sum_mux2, HALL_OVERSAMPLE);
+    building.adc[channel] = hall_adc_average(sum_mux1, HALL_OVERSAMPLE);
+
+    if (pos == select_count - 1) {
+        building.time_us = time_us_32();
+        seqbuf_publish(&published, slots, &building, sizeof(building));
+        scan_count = scan_count + 1;
+    }
+}
+
+// Data channel completion, from the ChibiOS DMA IRQ
+static void hall_engine_dma_done(void *param, uint32_t ct) {
+    (void)param;
+    (void)ct;
+    dma_hw->ints0 = 1u << data_chan;
+
+    uint16_t done;
+    uint8_t filling = filling_block(&done);
+
+    // The other block was filled at fill_pos, unless this handler already
+    // took it (repeated IRQ) or the IRQ was held off past a whole block; the
+    // next completion is harvested instead then
+    if ((filling ^ 1) != fill_block) return;
+    harvest_block(fill_block, fill_pos);
+
+    // Move the select lines for the block now filling if its leading pairs
+    // still cover the settle time, otherwise it repeats fill_pos
+    if (done * HALL_ENGINE_SAMPLE_US <= HALL_ENGINE_IRQ_MARGIN_US) {
+        fill_pos = fill_pos + 1 < select_count ? fill_pos + 1 : 0;
+        set_select(select_order[fill_pos]);
+    }
+    fill_block = filling;
+}
+
+bool hall_engine_init(uint16_t settle_us, const uint8_t selects[], uint8_t count) {
+    // Both channels before the ADC is touched, so a failure leaves it as
+    // hall_adc_hw_init() set it up for the blocking scan
+    const rp_dma_channel_t *data = dmaChannelAlloc(RP_DMA_CHANNEL_ID_ANY, RP_IRQ_DMA0_PRIORITY, hall_engine_dma_done, NULL);
+    const rp_dma_channel_t *ctrl = dmaChannelAlloc(RP_DMA_CHANNEL_ID_ANY, RP_IRQ_DMA0_PRIORITY, NULL, NULL);
+    if (!data || !ctrl) {
+        if (data) dmaChannelFree(data);
+        if (ctrl) dmaChannelFree(ctrl);
+        return false;
+    }
+    data_chan = data->chnidx;
+    ctrl_chan = ctrl->chnidx;
+
+    memcpy(select_order, selects, count);
+    select_count = count;
+
+    pairs = (settle_us + HALL_ENGINE_IRQ_MARGIN_US + HALL_ENGINE_PAIR_US - 1) / HALL_ENGINE_PAIR_US + HALL_OVERSAMPLE;
+    if (pairs > HALL_ENGINE_MAX_PAIRS) pairs = HALL_ENGINE_MAX_PAIRS;
+
+    // Free-running round-robin from ADC2 at full rate, one sample per DREQ
+    adc_hw->div = 0;
+    adc_hw->fcs = ADC_FCS_EN_BITS | ADC_FCS_DREQ_EN_BITS | (1u << ADC_FCS_THRESH_LSB);
+    adc_hw->cs = ADC_CS_EN_BITS | (HALL_ADC_RR_MASK << ADC_CS_RROBIN_LSB) | (HALL_ADC_MUX2_INPUT << ADC_CS_AINSEL_LSB);
+
+    dma_channel_hw_t *data_hw = &dma_hw->ch[data_chan];
+    data_hw->read_addr = (uintptr_t)&adc_hw->fifo;
+    data_hw->write_addr = (uintptr_t)block[0];
+    data_hw->transfer_count = 2 * pairs;
+    data_hw->al1_ctrl = DMA_CH0_CTRL_TRIG_EN_BITS | DMA_CTRL_SIZE(HALFWORD) | DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS |
+                        DMA_CTRL_TREQ(DREQ_ADC) | DMA_CTRL_CHAIN_TO(ctrl_chan);
+
+    // One word per block, block[1] first since the data channel starts in
+    // block[0]. Chaining to itself means no chain.
+    block_addr[0] = (uintptr_t)block[0];
+    block_addr[1] = (uintptr_t)block[1];
+    dma_channel_hw_t *ctrl_hw = &dma_hw->ch[ctrl_chan];
+    ctrl_hw->read_addr = (uintptr_t)&block_addr[1];
+    ctrl_hw->write_addr = (uintptr_t)&data_hw->al2_write_addr_trig;
+    ctrl_hw->transfer_count = 1;
+    ctrl_hw->al1_ctrl = DMA_CH0_CTRL_TRIG_EN_BITS | DMA_CTRL_SIZE(WORD) | DMA_CH0_CTRL_TRIG_INCR_READ_BITS |
+                        (3u << DMA_CH0_CTRL_TRIG_RING_SIZE_LSB) |
+                        DMA_CTRL_TREQ(DMA_CH0_CTRL_TRIG_TREQ_SEL_VALUE_PERMANENT) | DMA_CTRL_CHAIN_TO(ctrl_chan);
+
+    fill_pos = 0;
+    fill_block = 0;
+    set_select(select_order[0]);
+    dmaChannelEnableInterruptX(data);
+    dma_hw->multi_channel_trigger = 1u << data_chan;
+    adc_hw->cs |= ADC_CS_START_MANY_BITS;
+    return true;
+}
+
+bool hall_engine_poll(hall_snapshot_t *out) {
+    if (published.gen == consumed_gen) return false;
+    consumed_gen = seqbuf_read(&published, slots, out, sizeof(*out));
+    return true;
+}
+
+uint32_t hall_engine_scan_count(void) {
+    return scan_count;
+}
+
+uint32_t hall_engine_scan_period_us(void) {
+    return (uint32_t)select_count * pairs * HALL_ENGINE_PAIR_US;
+}
@@ -0,0 +1,39 @@
+/* hall_engine.h - background hall-sensor acquisition for shego_adc.c
+ * The RP2040 ADC free-runs in round-robin over ADC2/ADC3 (GP28/GP29, the two
+ * mux outputs) and DMA ping-pongs the samples between two blocks. Each
+ * completed block advances the shared mux select lines, so the select
+ * cadence is paced by the ADC clock rather than by the QMK main loop.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HALL_MUX_CHANNELS 16
+#define HALL_CHANNELS (2 * HALL_MUX_CHANNELS)
+
+// One complete pass over both muxes. adc[0..15] is MUX1, adc[16..31] MUX2,
+// matching the key_thresholds[] layout in shego_adc.c.
+typedef struct {
+    uint16_t adc[HALL_CHANNELS];
+    uint32_t time_us;  // when the last channel of this pass was captured
+} hall_snapshot_t;
+
+// Start the engine on an ADC enabled by hall_adc_hw_init(), from core 0
+// (the DMA IRQ is the ChibiOS one). settle_us is the measured mux select
+// settle time; the dwell per select code is sized so the averaged pairs
+// land after it. Only the count select codes in selects[] are visited, in
+// that order; channels behind other codes stay 0 in the snapshots.
+// Returns false, with the ADC untouched and no DMA channel held, if two
+// DMA channels could not be allocated.
+bool hall_engine_init(uint16_t settle_us, const uint8_t selects[], uint8_t count);
+
+// Copy the newest complete snapshot into out. Returns false without touching
+// out if nothing newer than the previous call has been published.
+bool hall_engine_poll(hall_snapshot_t *out);
+
+// Number of complete passes published since init
+uint32_t hall_engine_scan_count(void);
+
+// Time of one full pass in microseconds (fixed by the ADC clock)
+uint32_t hall_engine_scan_period_us(void);
@@ -0,0 +1,42 @@
+// hall_events.c - timestamped key transitions from the scanner to QMK
+#include "hall_events.h"
+#include "seqbuf.h"
+
+// Queue entries (power of two)
+#ifndef HALL_EVENT_QUEUE
+#define HALL_EVENT_QUEUE 64
+#endif
+_Static_assert((HALL_EVENT_QUEUE & (HALL_EVENT_QUEUE - 1)) == 0, "HALL_EVENT_QUEUE must be a power of two");
+
+static hall_event_t queue[HALL_EVENT_QUEUE];
+static volatile uint8_t head;
+static volatile uint8_t tail;
+static uint8_t high_water;
+
+bool hall_events_push(uint8_t row, uint8_t col, bool pressed, uint32_t time_us, uint32_t ready_us) {
+    uint8_t h = head;
+    uint8_t depth = (h - tail) & (HALL_EVENT_QUEUE - 1);
+    if (depth == HALL_EVENT_QUEUE - 1) return false;
+    if (depth + 1 > high_water) high_water = depth + 1;
+
+    queue[h] = (hall_event_t){time_us, ready_us, row, col, pressed};
+    seqbuf_fence();
+    head = (h + 1) & (HALL_EVENT_QUEUE - 1);
+    return true;
+}
+
+bool hall_events_peek(hall_event_t *out) {
+    uint8_t t = tail;
+    if (t == head) return false;
+    seqbuf_fence();
+    *out = queue[t];
+    return true;
+}
+
+void hall_events_pop(void) {
+    tail = (tail + 1) & (HALL_EVENT_QUEUE - 1);
+}
+
+uint8_t hall_events_high_water(void) {
+    return high_water;
+}
@@ -0,0 +1,26 @@
+/* hall_events.h - timestamped key transitions from the scanner to QMK
+ * Single producer (the fixed-rate scan tick), single consumer
+ * (matrix_scan_custom()). A full queue never drops: the producer keeps the
+ * transition pending and retries on the next tick.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+    uint32_t time_us;   // sample time of the scan that saw the transition
+    uint32_t ready_us;  // when that scan finished processing
+    uint8_t row;
+    uint8_t col;
+    bool pressed;
+} hall_event_t;
+
+bool hall_events_push(uint8_t row, uint8_t col, bool pressed, uint32_t time_us, uint32_t ready_us);
+
+// Oldest queued event, left in place until hall_events_pop()
+bool hall_events_peek(hall_event_t *out);
+void hall_events_pop(void);
+
+// Deepest the queue has been since boot
+uint8_t hall_events_high_water(void);
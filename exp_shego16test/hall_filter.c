@@ -0,0 +1,69 @@
+// hall_filter.c - integer-only per-channel filtering for the hall samples
+#include <string.h>
+#include "hall_filter.h"
+
+// EMA accumulator keeps this many fractional bits
+#define HALL_EMA_FRAC_BITS 4
+
+typedef struct {
+    uint16_t hist[2];  // previous two inputs for the median
+    uint32_t ema;      // accumulator, HALL_EMA_FRAC_BITS fractional bits
+    uint8_t stages;
+    uint8_t ema_shift;
+    bool primed;       // history seeded from the first sample
+} hall_filter_t;
+
+static hall_filter_t filters[HALL_CHANNELS];
+
+static inline uint16_t median3(uint16_t a, uint16_t b, uint16_t c) {
+    uint16_t lo = a < b ? a : b;
+    uint16_t hi = a < b ? b : a;
+    return c < lo ? lo : (c > hi ? hi : c);
+}
+
+void hall_filter_init(uint32_t active) {
+    memset(filters, 0, sizeof(filters));
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        if (active & (1UL << ch)) {
+            filters[ch].stages = HALL_FILTER_DEFAULT_STAGES;
+            filters[ch].ema_shift = HALL_FILTER_EMA_SHIFT;
+        }
+    }
+}
+
+void hall_filter_set(uint8_t ch, uint8_t stages, uint8_t ema_shift) {
+    if (ch >= HALL_CHANNELS) return;
+    filters[ch].stages = stages;
+    filters[ch].ema_shift = ema_shift;
+    filters[ch].primed = false;
+}
+
+void hall_filter_run(const uint16_t raw[], uint16_t out[]) {
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        hall_filter_t *f = &filters[ch];
+        uint16_t x = raw[ch];
+
+        if (!f->stages) {
+            out[ch] = x;
+            continue;
+        }
+        if (!f->primed) {
+            f->hist[0] = f->hist[1] = x;
+            f->ema = (uint32_t)x << HALL_EMA_FRAC_BITS;
+            f->primed = true;
+        }
+
+        if (f->stages & HALL_FILTER_MEDIAN3) {
+            uint16_t m = median3(f->hist[0], f->hist[1], x);
+            f->hist[0] = f->hist[1];
+            f->hist[1] = x;
+            x = m;
+        }
+        if (f->stages & HALL_FILTER_EMA) {
+            int32_t err = ((int32_t)x << HALL_EMA_FRAC_BITS) - (int32_t)f->ema;
+            f->ema += err >> f->ema_shift;
+            x = f->ema >> HALL_EMA_FRAC_BITS;
+        }
+        out[ch] = x;
+    }
+}
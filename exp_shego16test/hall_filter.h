@@ -0,0 +1,44 @@
+/* hall_filter.h - integer-only per-channel filtering for the hall samples
+ * Runs between the raw ADC samples and calibration/thresholding. Every stage
+ * is integer arithmetic for the Cortex-M0+. Latency cost per stage:
+ *
+ *   HALL_OVERSAMPLE  N reads averaged at acquisition time. Adds (N-1)/2 ADC
+ *                    pair periods (2 us each) inside the scan, no extra scans.
+ *   MEDIAN3          3-tap median over consecutive scans. Kills single-sample
+ *                    spikes, delays a step by 1 scan.
+ *   EMA              acc += (x - acc) >> shift. Mean delay 2^shift - 1 scans
+ *                    (shift 1: 1, shift 2: 3, shift 3: 7).
+ *
+ * tools/filter_bench.py runs the same stages over recorded traces.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_engine.h"
+
+// Samples averaged per channel at acquisition (engine and blocking scan)
+#ifndef HALL_OVERSAMPLE
+#define HALL_OVERSAMPLE 4
+#endif
+
+// Stage flags
+#define HALL_FILTER_MEDIAN3 (1 << 0)
+#define HALL_FILTER_EMA (1 << 1)
+
+// Stages and EMA shift applied to every populated channel at init
+#ifndef HALL_FILTER_DEFAULT_STAGES
+#define HALL_FILTER_DEFAULT_STAGES HALL_FILTER_MEDIAN3
+#endif
+#ifndef HALL_FILTER_EMA_SHIFT
+#define HALL_FILTER_EMA_SHIFT 1
+#endif
+
+// Configure the default stages on the populated channels (bit per channel)
+void hall_filter_init(uint32_t active);
+
+// Per-channel override, e.g. extra smoothing on a noisy sensor
+void hall_filter_set(uint8_t ch, uint8_t stages, uint8_t ema_shift);
+
+// Filter one full pass: out[ch] = filtered raw[ch]; unfiltered channels copy
+void hall_filter_run(const uint16_t raw[], uint16_t out[]);
@@ -0,0 +1,127 @@
+// hall_latency.c - per-stage key latency, threshold crossing to USB report
+#include <string.h>
+#include "quantum.h"
+#include "host.h"
+#include "hardware/timer.h"
+#include "hall_latency.h"
+
+enum { SLOT_IDLE, SLOT_MATRIX, SLOT_RECORD };
+
+typedef struct {
+    uint32_t sample_us;
+    uint32_t ready_us;
+    uint32_t matrix_us;
+    uint32_t record_us;
+    uint8_t state;
+} latency_slot_t;
+
+static latency_slot_t slots[MATRIX_ROWS * MATRIX_COLS];
+static uint8_t recorded;  // slots in SLOT_RECORD
+
+static uint32_t hist[HALL_LATENCY_STAGES][HALL_STATS_BUCKETS];
+static uint32_t traced;
+static uint32_t unreported;
+
+// The USB driver with send_keyboard (and send_nkro) wrapped, see
+// hall_latency_task()
+static host_driver_t *usb_driver;
+static host_driver_t traced_driver;
+
+static void add(hall_latency_stage_t stage, uint32_t us) {
+    hist[stage][hall_stats_bucket(us)]++;
+}
+
+// Every key processed since the last report went out in this one
+static void report_sent(uint32_t queue_us, uint32_t sent_us) {
+    if (!recorded) return;
+    for (uint8_t i = 0; i < MATRIX_ROWS * MATRIX_COLS; i++) {
+        latency_slot_t *slot = &slots[i];
+        if (slot->state != SLOT_RECORD) continue;
+        add(HALL_LATENCY_SCAN, slot->ready_us - slot->sample_us);
+        add(HALL_LATENCY_HANDOFF, slot->matrix_us - slot->ready_us);
+        add(HALL_LATENCY_MATRIX, slot->record_us - slot->matrix_us);
+        add(HALL_LATENCY_KEYMAP, queue_us - slot->record_us);
+        add(HALL_LATENCY_USB, sent_us - queue_us);
+        add(HALL_LATENCY_TOTAL, sent_us - slot->sample_us);
+        slot->state = SLOT_IDLE;
+        traced++;
+    }
+    recorded = 0;
+}
+
+static void traced_send_keyboard(report_keyboard_t *report) {
+    uint32_t queue_us = time_us_32();
+    usb_driver->send_keyboard(report);
+    report_sent(queue_us, time_us_32());
+}
+
+#ifdef NKRO_ENABLE
+// With NKRO on (keymap_config.nkro, VIA can toggle it) key reports go out
+// here instead
+static void traced_send_nkro(report_nkro_t *report) {
+    uint32_t queue_us = time_us_32();
+    usb_driver->send_nkro(report);
+    report_sent(queue_us, time_us_32());
+}
+#endif
+
+void hall_latency_matrix(uint8_t row, uint8_t col, uint32_t sample_us, uint32_t ready_us) {
+    latency_slot_t *slot = &slots[row * MATRIX_COLS + col];
+    if (slot->state == SLOT_RECORD) recorded--;
+    slot->sample_us = sample_us;
+    slot->ready_us = ready_us;
+    slot->matrix_us = time_us_32();
+    slot->state = SLOT_MATRIX;
+}
+
+void hall_latency_record(uint8_t row, uint8_t col) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) return;  // encoders, combos
+    latency_slot_t *slot = &slots[row * MATRIX_COLS + col];
+    if (slot->state != SLOT_MATRIX) return;
+    slot->record_us = time_us_32();
+    slot->state = SLOT_RECORD;
+    recorded++;
+}
+
+void hall_latency_task(void) {
+    // The driver is set by the protocol layer, not necessarily before
+    // keyboard_post_init_kb(); wrap whatever is current
+    host_driver_t *driver = host_get_driver();
+    if (driver && driver != &traced_driver) {
+        usb_driver = driver;
+        traced_driver = *driver;
+        traced_driver.send_keyboard = traced_send_keyboard;
+#ifdef NKRO_ENABLE
+        traced_driver.send_nkro = traced_send_nkro;
+#endif
+        host_set_driver(&traced_driver);
+    }
+
+    // Reports go out from inside process_record; anything still waiting
+    // here (layer keys, custom keycodes, held mod-taps) never made one
+    if (!recorded) return;
+    for (uint8_t i = 0; i < MATRIX_ROWS * MATRIX_COLS; i++) {
+        if (slots[i].state != SLOT_RECORD) continue;
+        slots[i].state = SLOT_IDLE;
+        unreported++;
+    }
+    recorded = 0;
+}
+
+const uint32_t *hall_latency_hist(hall_latency_stage_t stage) {
+    return hist[stage];
+}
+
+uint32_t hall_latency_traced(void) {
+    return traced;
+}
+
+uint32_t hall_latency_unreported(void) {
+    return unreported;
+}
+
+void hall_latency_reset(void) {
+    memset(hist, 0, sizeof(hist));
+    traced = 0;
+    unreported = 0;
+}
@@ -0,0 +1,39 @@
+/* hall_latency.h - per-stage key latency, from the sample that crossed the
+ * threshold to the keyboard report handed to the USB driver
+ * Everything here runs on core 0; the scanner's part travels in as the
+ * sample_us / ready_us stamps of the scan that saw the transition.
+ * Host side: tools/shego_hid.py latency.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hall_stats.h"
+
+typedef enum {
+    HALL_LATENCY_SCAN,     // sample -> scan processed (filter, hysteresis, SOCD)
+    HALL_LATENCY_HANDOFF,  // processed -> matrix_scan_custom() (event queue, core 1)
+    HALL_LATENCY_MATRIX,   // matrix_scan_custom() -> process_record_kb()
+    HALL_LATENCY_KEYMAP,   // process_record_kb() -> report sent, incl. user code and wait_ms
+    HALL_LATENCY_USB,      // inside the driver's send_keyboard / send_nkro (endpoint busy)
+    HALL_LATENCY_TOTAL,    // sample -> report queued
+    HALL_LATENCY_STAGES
+} hall_latency_stage_t;
+
+// matrix_scan_custom(): the key at row/col changed in the matrix handed to
+// QMK; sample_us / ready_us are from the scan that saw it
+void hall_latency_matrix(uint8_t row, uint8_t col, uint32_t sample_us, uint32_t ready_us);
+
+// process_record_kb(), before any user code
+void hall_latency_record(uint8_t row, uint8_t col);
+
+// Housekeeping: hooks the USB driver once it exists and drops records that
+// did not produce a report in this main-loop pass
+void hall_latency_task(void);
+
+// Histogram of one stage, HALL_STATS_BUCKETS entries (same buckets as
+// hall_stats.h)
+const uint32_t *hall_latency_hist(hall_latency_stage_t stage);
+uint32_t hall_latency_traced(void);      // transitions traced to a report
+uint32_t hall_latency_unreported(void);  // records that sent no report
+void hall_latency_reset(void);
@@ -0,0 +1,65 @@
+// hall_log.c - deferred binary event log for the scan hot path
+#include "quantum.h"
+#include "debug.h"
+#include "print.h"
+#include "hardware/timer.h"
+#include "hall_log.h"
+#include "seqbuf.h"
+
+// Records in the ring (power of two), 12 bytes each
+#ifndef HALL_LOG_RING
+#define HALL_LOG_RING 256
+#endif
+_Static_assert((HALL_LOG_RING & (HALL_LOG_RING - 1)) == 0, "HALL_LOG_RING must be a power of two");
+
+// Records formatted per housekeeping pass, keeps core 0 responsive
+#define HALL_LOG_FLUSH_MAX 8
+
+static hall_log_record_t ring[HALL_LOG_RING];
+static volatile uint16_t head;
+static volatile uint16_t tail;
+static volatile uint32_t dropped;
+static uint32_t dropped_reported;
+
+void hall_log(uint8_t event, uint8_t ch, uint16_t adc, uint16_t travel, uint16_t arg) {
+    if (!debug_enable) return;
+
+    uint16_t h = head;
+    uint16_t next = (h + 1) & (HALL_LOG_RING - 1);
+    if (next == tail) {
+        dropped++;
+        return;
+    }
+    ring[h] = (hall_log_record_t){time_us_32(), event, ch, adc, travel, arg};
+    seqbuf_fence();
+    head = next;
+}
+
+static void print_record(const hall_log_record_t *r) {
+    switch (r->event) {
+        case HALL_LOG_PRESS:
+        case HALL_LOG_RELEASE:
+            uprintf("%lu ch%u %s adc=%u travel=%u\n", r->time_us, r->ch,
+                    r->event == HALL_LOG_PRESS ? "PRESS" : "RELEASE", r->adc, r->travel);
+            break;
+        case HALL_LOG_SAMPLE:
+            uprintf("%lu ch%u adc=%u travel=%u thresh=%u\n", r->time_us, r->ch, r->adc, r->travel, r->arg);
+            break;
+    }
+}
+
+void hall_log_task(void) {
+    uint16_t t = tail;
+    for (uint8_t n = 0; n < HALL_LOG_FLUSH_MAX && t != head; n++) {
+        seqbuf_fence();
+        print_record(&ring[t]);
+        t = (t + 1) & (HALL_LOG_RING - 1);
+        tail = t;
+    }
+
+    uint32_t d = dropped;
+    if (d != dropped_reported) {
+        uprintf("hall_log: %lu records dropped\n", d - dropped_reported);
+        dropped_reported = d;
+    }
+}
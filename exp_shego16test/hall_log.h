@@ -0,0 +1,30 @@
+/* hall_log.h - deferred binary event log for the scan hot path
+ * The scanner writes fixed 12-byte records into a RAM ring; core 0 formats
+ * and prints them from housekeeping (hall_log_task()). Logging is on while
+ * QMK's debug_enable is set (DB_TOGG) and costs a handful of stores per
+ * event; a full ring drops records and counts them instead of waiting.
+ * Single producer: only call hall_log() from the scanning core.
+ */
+#pragma once
+
+#include <stdint.h>
+
+typedef enum {
+    HALL_LOG_PRESS,
+    HALL_LOG_RELEASE,
+    HALL_LOG_SAMPLE,  // periodic snapshot, arg = threshold
+} hall_log_event_t;
+
+typedef struct {
+    uint32_t time_us;
+    uint8_t event;
+    uint8_t ch;
+    uint16_t adc;
+    uint16_t travel;
+    uint16_t arg;
+} hall_log_record_t;
+
+void hall_log(uint8_t event, uint8_t ch, uint16_t adc, uint16_t travel, uint16_t arg);
+
+// Core 0 housekeeping: print a bounded number of records and the drop count
+void hall_log_task(void);
@@ -0,0 +1,174 @@
+// hall_midi.c - velocity-sensitive MIDI from the analog keys
+// Built only with MIDI_ENABLE (post_rules.mk); hall_midi.h has the
+// stand-ins otherwise
+#include "hall_midi.h"
+#include "hall_velocity.h"
+#include "hall_analog.h"
+#include "seqbuf.h"
+#include "shego16.h"
+#include "qmk_midi.h"
+
+#ifndef HALL_MIDI_CHANNEL
+#define HALL_MIDI_CHANNEL 0
+#endif
+// Note of MI_C; 48 is QMK's default octave for the MIDI keycodes
+#ifndef HALL_MIDI_BASE_NOTE
+#define HALL_MIDI_BASE_NOTE 48
+#endif
+#ifndef HALL_MIDI_AFTERTOUCH_MS
+#define HALL_MIDI_AFTERTOUCH_MS 2
+#endif
+
+#define NO_NOTE 0xFF
+
+// Queue of note events (power of two), scanner -> core 0
+#ifndef HALL_MIDI_QUEUE
+#define HALL_MIDI_QUEUE 32
+#endif
+_Static_assert((HALL_MIDI_QUEUE & (HALL_MIDI_QUEUE - 1)) == 0, "HALL_MIDI_QUEUE must be a power of two");
+
+typedef struct {
+    uint8_t pos;
+    uint8_t note;
+    uint8_t velocity;  // 0 = note off
+} midi_event_t;
+
+static midi_event_t queue[HALL_MIDI_QUEUE];
+static volatile uint8_t head;
+static volatile uint8_t tail;
+
+// Note keys for the active layers. Bit / index row * MATRIX_COLS + col.
+typedef struct {
+    uint16_t keys;
+    uint8_t note[HALL_ANALOG_KEYS];
+} midi_table_t;
+
+// Published by core 0, consumed by the scanner
+static seqbuf_t table_buf;
+static midi_table_t table_slots[2];
+static bool table_dirty = true;
+
+// Scanner side
+static midi_table_t table;
+static uint32_t table_gen;
+static hall_velocity_t velocity[HALL_ANALOG_KEYS];
+// Note-offs for keys whose note changed while the queue was full. A key's
+// new events wait until its note-off is queued.
+static uint16_t off_pending;
+static uint8_t off_note[HALL_ANALOG_KEYS];
+
+// Core 0 side: note playing per key and its last aftertouch
+static uint8_t playing[HALL_ANALOG_KEYS] = {[0 ... HALL_ANALOG_KEYS - 1] = NO_NOTE};
+static uint8_t pressure_sent[HALL_ANALOG_KEYS];
+
+void hall_midi_refresh(layer_state_t state) {
+    midi_table_t t = {0};
+    layer_state_t layers = state | default_layer_state;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t pos = row * MATRIX_COLS + col;
+            uint16_t keycode = kb_effective_keycode(layers, (keypos_t){.row = row, .col = col});
+            t.note[pos] = NO_NOTE;
+            if (keycode < QK_MIDI_NOTE_C_0 || keycode > QK_MIDI_NOTE_B_5) continue;
+            t.note[pos] = HALL_MIDI_BASE_NOTE + keycode - QK_MIDI_NOTE_C_0;
+            t.keys |= 1u << pos;
+        }
+    }
+
+    seqbuf_publish(&table_buf, table_slots, &t, sizeof(t));
+    table_dirty = false;
+}
+
+void hall_midi_mark_dirty(void) {
+    table_dirty = true;
+}
+
+static bool push(uint8_t pos, uint8_t note, uint8_t vel) {
+    uint8_t h = head;
+    if (((h + 1) & (HALL_MIDI_QUEUE - 1)) == tail) return false;
+    queue[h] = (midi_event_t){pos, note, vel};
+    seqbuf_fence();
+    head = (h + 1) & (HALL_MIDI_QUEUE - 1);
+    return true;
+}
+
+void hall_midi_scan(const uint16_t travel[], uint32_t sample_us, matrix_row_t matrix[]) {
+    if (table_buf.gen != table_gen) {
+        // Keys that stop being notes (or change note) release what they play
+        midi_table_t old = table;
+        table_gen = seqbuf_read(&table_buf, table_slots, &table, sizeof(table));
+        for (uint8_t pos = 0; pos < HALL_ANALOG_KEYS; pos++) {
+            if (!(old.keys & (1u << pos)) || table.note[pos] == old.note[pos]) continue;
+            if (velocity[pos].state == HALL_VELOCITY_ON) {
+                off_note[pos] = old.note[pos];
+                off_pending |= 1u << pos;
+            }
+            velocity[pos].state = HALL_VELOCITY_UP;
+        }
+    }
+    for (uint16_t keys = off_pending; keys; keys &= keys - 1) {
+        uint8_t pos = __builtin_ctz(keys);
+        if (!push(pos, off_note[pos], 0)) break;
+        off_pending &= ~(1u << pos);
+    }
+    if (!table.keys) return;
+
+    for (uint16_t keys = table.keys & ~off_pending; keys; keys &= keys - 1) {
+        uint8_t pos = __builtin_ctz(keys);
+        hall_velocity_t before = velocity[pos];
+        uint8_t vel = 0;
+        hall_velocity_event_t event = hall_velocity_step(&velocity[pos], travel[pos], sample_us, &vel);
+        // A full queue replays the sample next scan instead of losing the note
+        if (event != HALL_VELOCITY_NONE && !push(pos, table.note[pos], event == HALL_VELOCITY_NOTE_ON ? vel : 0)) {
+            velocity[pos] = before;
+        }
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix[row] &= ~(matrix_row_t)((table.keys >> (row * MATRIX_COLS)) & ((1u << MATRIX_COLS) - 1));
+    }
+}
+
+#ifdef HALL_MIDI_AFTERTOUCH
+// Pressure 0..127 from the depth past the note point
+#define NOTE_DEPTH (HALL_VELOCITY_NOTE_TRAVEL * 255 / HALL_TRAVEL_MAX)
+
+static void send_aftertouch(void) {
+    static uint16_t last_ms;
+    if (timer_elapsed(last_ms) < HALL_MIDI_AFTERTOUCH_MS) return;
+    last_ms = timer_read();
+
+    hall_analog_t snapshot;
+    if (!hall_analog_read(&snapshot)) return;
+    for (uint8_t pos = 0; pos < HALL_ANALOG_KEYS; pos++) {
+        if (playing[pos] == NO_NOTE) continue;
+        uint8_t depth = snapshot.depth[pos];
+        uint8_t pressure = depth <= NOTE_DEPTH ? 0 : (depth - NOTE_DEPTH) * 127 / (255 - NOTE_DEPTH);
+        if (pressure == pressure_sent[pos]) continue;
+        pressure_sent[pos] = pressure;
+        midi_send_aftertouch(&midi_device, HALL_MIDI_CHANNEL, playing[pos], pressure);
+    }
+}
+#endif
+
+void hall_midi_task(void) {
+    if (table_dirty) hall_midi_refresh(layer_state);
+
+    while (tail != head) {
+        seqbuf_fence();
+        midi_event_t event = queue[tail];
+        tail = (tail + 1) & (HALL_MIDI_QUEUE - 1);
+        if (event.velocity) {
+            midi_send_noteon(&midi_device, HALL_MIDI_CHANNEL, event.note, event.velocity);
+            playing[event.pos] = event.note;
+            pressure_sent[event.pos] = 0;
+        } else {
+            midi_send_noteoff(&midi_device, HALL_MIDI_CHANNEL, event.note, 0);
+            playing[event.pos] = NO_NOTE;
+        }
+    }
+
+#ifdef HALL_MIDI_AFTERTOUCH
+    send_aftertouch();
+#endif
+}
@@ -0,0 +1,39 @@
+/* hall_midi.h - velocity-sensitive MIDI from the analog keys
+ * Keys whose keycode on the active layers is a QMK MIDI note (MI_C ...)
+ * leave the matrix and play through the scanner instead: note on with a
+ * velocity from travel speed (hall_velocity.h), note off on release and,
+ * with HALL_MIDI_AFTERTOUCH, polyphonic aftertouch from depth past the note
+ * point. Core 0 resolves the keymap the way socd.c does and sends the
+ * messages; every other key types as usual.
+ */
+#pragma once
+
+#include "quantum.h"
+
+#ifdef MIDI_ENABLE
+// Core 0: rebuild the note table for a layer state
+void hall_midi_refresh(layer_state_t state);
+
+// Core 0: keymap changed, rebuild on the next hall_midi_task()
+void hall_midi_mark_dirty(void);
+
+// Core 0: send queued notes and aftertouch (housekeeping)
+void hall_midi_task(void);
+
+// Scanner: run the velocity estimator on the note keys (travel indexed
+// row * MATRIX_COLS + col) and take them out of the matrix
+void hall_midi_scan(const uint16_t travel[], uint32_t sample_us, matrix_row_t matrix[]);
+#else
+// Built without MIDI_ENABLE (rules.mk): no note keys, the velocity
+// estimator is not compiled in and every key stays in the matrix
+static inline void hall_midi_refresh(layer_state_t state) {
+    (void)state;
+}
+static inline void hall_midi_mark_dirty(void) {}
+static inline void hall_midi_task(void) {}
+static inline void hall_midi_scan(const uint16_t travel[], uint32_t sample_us, matrix_row_t matrix[]) {
+    (void)travel;
+    (void)sample_us;
+    (void)matrix;
+}
+#endif
@@ -0,0 +1,71 @@
+// hall_stats.c - scan-loop throughput and latency counters
+#include <stdbool.h>
+#include <string.h>
+#include "hall_stats.h"
+
+static hall_stats_t stats;
+static uint32_t last_start_us;
+static uint32_t window_start_us;
+static uint32_t window_scans;
+static volatile bool reset_requested = true;
+static bool restarted;  // no scan since the last clear
+
+// Apply a clear requested by core 0. Called first in every hook, so the
+// first tick, transition or scan after the request lands in the new counts.
+static void apply_reset(void) {
+    if (!reset_requested) return;
+    reset_requested = false;
+    memset(&stats, 0, sizeof(stats));
+    window_scans = 0;
+    restarted = true;
+}
+
+void hall_stats_scan(uint32_t start_us, uint32_t end_us) {
+    apply_reset();
+    if (restarted) {
+        restarted = false;
+        last_start_us = start_us;
+        window_start_us = start_us;
+    }
+
+    uint32_t scan_us = end_us - start_us;
+    uint32_t gap_us = start_us - last_start_us;
+    last_start_us = start_us;
+
+    stats.scans++;
+    stats.scan_us_sum += scan_us;
+    if (scan_us > stats.scan_us_max) stats.scan_us_max = scan_us;
+    if (gap_us > stats.stall_us_max) stats.stall_us_max = gap_us;
+
+    if (end_us - window_start_us >= 1000000) {
+        stats.scan_rate = stats.scans - window_scans;
+        window_scans = stats.scans;
+        window_start_us = end_us;
+    }
+}
+
+void hall_stats_transition(uint32_t sample_us, uint32_t now_us) {
+    apply_reset();
+    stats.latency[hall_stats_bucket(now_us - sample_us)]++;
+    stats.transitions++;
+}
+
+void hall_stats_tick(uint32_t jitter_us) {
+    apply_reset();
+    stats.ticks++;
+    stats.jitter_us_sum += jitter_us;
+    if (jitter_us > stats.jitter_us_max) stats.jitter_us_max = jitter_us;
+}
+
+void hall_stats_overrun(void) {
+    apply_reset();
+    stats.overruns++;
+}
+
+void hall_stats_read(hall_stats_t *out) {
+    memcpy(out, (const void *)&stats, sizeof(*out));
+}
+
+void hall_stats_reset(void) {
+    reset_requested = true;
+}
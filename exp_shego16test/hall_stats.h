@@ -0,0 +1,47 @@
+/* hall_stats.h - scan-loop throughput and latency counters
+ * Written only by the scanning core, read by core 0 for raw HID (shego_hid.c).
+ * Every field is a single 32-bit word, so a reader can see a mix of two
+ * scans but never a torn value.
+ */
+#pragma once
+
+#include <stdint.h>
+
+// Crossing-to-matrix latency buckets: bucket 0 is < 16 us, bucket i covers
+// [2^(i+3), 2^(i+4)) us, the last one collects everything slower
+#define HALL_STATS_BUCKETS 16
+
+static inline uint8_t hall_stats_bucket(uint32_t us) {
+    if (us < 16) return 0;
+    uint8_t bucket = 31 - __builtin_clz(us) - 3;
+    return bucket < HALL_STATS_BUCKETS ? bucket : HALL_STATS_BUCKETS - 1;
+}
+
+typedef struct {
+    uint32_t scans;         // processed scans since reset
+    uint32_t scan_rate;     // scans in the last full second
+    uint32_t scan_us_sum;   // processing (+ acquisition when blocking), summed
+    uint32_t scan_us_max;   // slowest single scan
+    uint32_t stall_us_max;  // longest gap between two processed scans
+    uint32_t transitions;   // key state changes seen
+    uint32_t ticks;         // fixed-rate scan ticks (HALL_SCAN_RATE_HZ)
+    uint32_t jitter_us_sum; // tick handler start behind its target, summed
+    uint32_t jitter_us_max;
+    uint32_t overruns;      // ticks skipped because a scan ran past them
+    uint32_t latency[HALL_STATS_BUCKETS];
+} hall_stats_t;
+
+// Scanner: one processed scan from start_us (before a blocking acquisition,
+// or once the DMA snapshot is in hand) to end_us
+void hall_stats_scan(uint32_t start_us, uint32_t end_us);
+
+// Scanner: a key changed state; sample_us is when its samples were taken
+void hall_stats_transition(uint32_t sample_us, uint32_t now_us);
+
+// Fixed-rate scheduler: a tick started jitter_us late / a tick was skipped
+void hall_stats_tick(uint32_t jitter_us);
+void hall_stats_overrun(void);
+
+// Core 0: snapshot and clear (the clear is applied by the scanner)
+void hall_stats_read(hall_stats_t *out);
+void hall_stats_reset(void);
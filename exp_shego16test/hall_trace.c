@@ -0,0 +1,179 @@
+// hall_trace.c - raw ADC capture of selected channels over raw HID
+#include <string.h>
+#include "raw_hid.h"
+#include "hall_trace.h"
+#include "hall_engine.h"
+#include "shego_hid.h"
+#include "seqbuf.h"
+
+// Ring entries (power of two), 12 bytes each
+#ifndef HALL_TRACE_RING
+#define HALL_TRACE_RING 1024
+#endif
+_Static_assert((HALL_TRACE_RING & (HALL_TRACE_RING - 1)) == 0, "HALL_TRACE_RING must be a power of two");
+
+// Reports sent per housekeeping pass at most: QMK queues this many raw HID
+// IN reports, so the pass doesn't block on the endpoint
+#ifndef HALL_TRACE_REPORTS_PER_TASK
+#define HALL_TRACE_REPORTS_PER_TASK 4
+#endif
+
+#define TRACE_REPORT_SIZE 32
+#define TRACE_HEADER_SIZE 8
+#define TRACE_TIME_UNIT_US 4
+
+// Samples are 12-bit: the top bit of an entry's first value marks scans
+// dropped (ring full) just before it
+#define TRACE_GAP 0x8000
+#define TRACE_ADC(e, i) ((e)->adc[i] & 0xFFF)
+
+typedef struct {
+    uint32_t time_us;
+    uint16_t adc[HALL_TRACE_MAX_CHANNELS];
+} hall_trace_entry_t;
+
+// Single producer (scanner) / single consumer (core 0)
+static hall_trace_entry_t ring[HALL_TRACE_RING];
+static volatile uint16_t head;
+static volatile uint16_t tail;
+static volatile uint32_t dropped;  // written by the scanner only
+static bool gap;                   // scanner only: the next entry follows dropped scans
+static volatile bool restart;      // set by hall_trace_start(), cleared by the scanner
+
+static volatile bool capturing;
+static uint8_t trace_channels[HALL_TRACE_MAX_CHANNELS];
+static uint8_t trace_count;
+static uint8_t sequence;
+
+bool hall_trace_start(const uint8_t channels[], uint8_t count) {
+    if (!count || count > HALL_TRACE_MAX_CHANNELS) return false;
+    for (uint8_t i = 0; i < count; i++) {
+        if (channels[i] >= HALL_CHANNELS) return false;
+    }
+
+    capturing = false;
+    seqbuf_fence();
+    memcpy(trace_channels, channels, count);
+    trace_count = count;
+    tail = head;
+    sequence = 0;
+    restart = true;
+    seqbuf_fence();
+    capturing = true;
+    return true;
+}
+
+void hall_trace_stop(void) {
+    // Whatever is still buffered keeps draining
+    capturing = false;
+}
+
+uint32_t hall_trace_dropped(void) {
+    // Until the scanner takes the restart, dropped is the last capture's
+    return restart ? 0 : dropped;
+}
+
+uint16_t hall_trace_pending(void) {
+    return (head - tail) & (HALL_TRACE_RING - 1);
+}
+
+bool hall_trace_active(void) {
+    return capturing;
+}
+
+void hall_trace_push(const uint16_t samples[], uint32_t sample_us) {
+    if (!capturing) return;
+
+    // A new capture: the scanner clears its own state
+    if (restart) {
+        restart = false;
+        dropped = 0;
+        gap = false;
+    }
+
+    uint16_t h = head;
+    uint16_t next = (h + 1) & (HALL_TRACE_RING - 1);
+    if (next == tail) {
+        dropped++;
+        gap = true;
+        return;
+    }
+    hall_trace_entry_t *e = &ring[h];
+    e->time_us = sample_us;
+    for (uint8_t i = 0; i < trace_count; i++) e->adc[i] = samples[trace_channels[i]] & 0xFFF;
+    if (gap) e->adc[0] |= TRACE_GAP;
+    gap = false;
+    seqbuf_fence();
+    head = next;
+}
+
+static bool deltas_fit(const hall_trace_entry_t *prev, const hall_trace_entry_t *e, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++) {
+        int16_t d = (int16_t)(TRACE_ADC(e, i) - TRACE_ADC(prev, i));
+        if (d < -128 || d > 127) return false;
+    }
+    return true;
+}
+
+// Pack as many buffered entries as fit into report; returns entries used
+static uint8_t pack_report(uint8_t *report, uint16_t t, uint16_t available) {
+    const hall_trace_entry_t *first = &ring[t];
+    uint8_t n = trace_count;
+    uint8_t pos = TRACE_HEADER_SIZE;
+
+    report[4] = first->time_us;
+    report[5] = first->time_us >> 8;
+    report[6] = first->time_us >> 16;
+    report[7] = first->time_us >> 24;
+    for (uint8_t i = 0; i < n; i += 2) {
+        uint16_t a = TRACE_ADC(first, i);
+        uint16_t b = i + 1 < n ? TRACE_ADC(first, i + 1) : 0;
+        report[pos++] = a;
+        report[pos++] = (a >> 8) | (b << 4);
+        if (i + 1 < n) report[pos++] = b >> 4;
+    }
+
+    uint8_t used = 1;
+    const hall_trace_entry_t *prev = first;
+    uint32_t time_us = first->time_us;  // as the host reconstructs it
+    while (used < available && pos + 1 + n <= TRACE_REPORT_SIZE) {
+        const hall_trace_entry_t *e = &ring[(t + used) & (HALL_TRACE_RING - 1)];
+        uint32_t dt = (e->time_us - time_us + TRACE_TIME_UNIT_US / 2) / TRACE_TIME_UNIT_US;
+        // A gap starts a new report, whose header flags it
+        if ((e->adc[0] & TRACE_GAP) || dt > 255 || !deltas_fit(prev, e, n)) break;
+
+        report[pos++] = dt;
+        for (uint8_t i = 0; i < n; i++) report[pos++] = (uint8_t)(TRACE_ADC(e, i) - TRACE_ADC(prev, i));
+        time_us += dt * TRACE_TIME_UNIT_US;
+        prev = e;
+        used++;
+    }
+    return used;
+}
+
+// Send one report if there is enough for it; false once the ring is drained
+static bool send_report(void) {
+    uint16_t t = tail;
+    uint16_t available = (head - t) & (HALL_TRACE_RING - 1);
+    if (!available) return false;
+
+    // While capturing, wait until a report can be filled
+    uint8_t per_report = 1 + (TRACE_REPORT_SIZE - TRACE_HEADER_SIZE - (trace_count * 3 + 1) / 2) / (1 + trace_count);
+    if (capturing && available < per_report) return false;
+
+    seqbuf_fence();
+    uint8_t report[TRACE_REPORT_SIZE] = {0};
+    report[0] = SHEGO_HID_MAGIC;
+    report[1] = SHEGO_HID_TRACE_DATA;
+    report[2] = sequence++;
+    uint8_t used = pack_report(report, t, available);
+    report[3] = used | (ring[t].adc[0] & TRACE_GAP ? HALL_TRACE_GAP_FLAG : 0);
+    tail = (t + used) & (HALL_TRACE_RING - 1);
+
+    raw_hid_send(report, TRACE_REPORT_SIZE);
+    return true;
+}
+
+void hall_trace_task(void) {
+    for (uint8_t i = 0; i < HALL_TRACE_REPORTS_PER_TASK && send_report(); i++) {}
+}
@@ -0,0 +1,39 @@
+/* hall_trace.h - raw ADC capture of selected channels over raw HID
+ * The scanner pushes the raw (unfiltered) samples of up to
+ * HALL_TRACE_MAX_CHANNELS channels into a RAM ring on every scan, with the
+ * scan's sample timestamp. Core 0 drains the ring from housekeeping into
+ * 32-byte SHEGO_HID_TRACE_DATA reports, so matrix_scan_custom() only pays
+ * for a few stores per scan.
+ *
+ * Report layout:
+ *   [0] SHEGO_HID_MAGIC  [1] SHEGO_HID_TRACE_DATA  [2] sequence
+ *   [3]     entries, | HALL_TRACE_GAP_FLAG if scans were dropped (ring
+ *           full) right before the first entry
+ *   [4..7]  time_us of the first entry
+ *   [8..]   first entry: 12-bit values packed two per three bytes (LE)
+ *           then per entry: time delta in 4 us units (u8), one int8 delta
+ *           per channel against the previous entry
+ * Host side: tools/shego_hid.py trace.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HALL_TRACE_MAX_CHANNELS 4
+#define HALL_TRACE_GAP_FLAG 0x80
+
+// Core 0: start capturing channels[0..count) (sample array indices), or stop
+bool hall_trace_start(const uint8_t channels[], uint8_t count);
+void hall_trace_stop(void);
+
+// Core 0: entries dropped because the ring was full, entries waiting
+uint32_t hall_trace_dropped(void);
+uint16_t hall_trace_pending(void);
+bool hall_trace_active(void);
+
+// Scanner: one full set of raw samples taken at sample_us
+void hall_trace_push(const uint16_t samples[], uint32_t sample_us);
+
+// Core 0 housekeeping: send what is buffered, a few reports per call
+void hall_trace_task(void);
@@ -0,0 +1,52 @@
+/* hall_travel.h - calibrated hall reading to key travel (0.01 mm units)
+ * Each key's sample is normalized against its rest/bottom-out calibration
+ * to a 16.16 fixed-point index into the profile table generated by
+ * tools/gen_travel_lut.py, then interpolated between two entries. One
+ * multiply for the index, one for the interpolation.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifndef HALL_TRAVEL_PROFILE
+#define HALL_TRAVEL_PROFILE HALL_PROFILE_DIPOLE_4MM
+#endif
+
+#include "hall_travel_lut.h"
+
+typedef struct {
+    uint16_t rest;
+    uint32_t scale;  // (HALL_TRAVEL_LUT_STEPS << 16) / (bottom - rest)
+} hall_travel_cal_t;
+
+static inline void hall_travel_set_cal(hall_travel_cal_t *cal, uint16_t rest, uint16_t bottom) {
+    uint16_t span = bottom > rest ? bottom - rest : 1;
+    cal->rest = rest;
+    cal->scale = ((uint32_t)HALL_TRAVEL_LUT_STEPS << 16) / span;
+}
+
+static inline uint16_t hall_travel(const hall_travel_cal_t *cal, uint16_t adc) {
+    if (adc <= cal->rest) return 0;
+    uint32_t pos = (uint32_t)(adc - cal->rest) * cal->scale;
+    uint32_t i = pos >> 16;
+    if (i >= HALL_TRAVEL_LUT_STEPS) return HALL_TRAVEL_MAX;
+    uint16_t a = hall_travel_lut[i];
+    uint16_t b = hall_travel_lut[i + 1];
+    return a + (((uint32_t)(b - a) * (pos & 0xFFFF)) >> 16);
+}
+
+// Smallest ADC count whose travel is beyond the given travel, 4096 if none.
+// Bisection over hall_travel(); meant for calibration time, not per scan.
+static inline uint16_t hall_travel_adc(const hall_travel_cal_t *cal, uint16_t travel) {
+    uint16_t lo = cal->rest;  // hall_travel() is 0 here
+    uint16_t hi = 4096;
+    while (lo + 1 < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (hall_travel(cal, mid) > travel) {
+            hi = mid;
+        } else {
+            lo = mid;
+        }
+    }
+    return hi;
+}
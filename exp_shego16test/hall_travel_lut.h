@@ -0,0 +1,80 @@
+// Auto-generated by tools/gen_travel_lut.py
+// Select a profile with HALL_TRAVEL_PROFILE (see hall_travel.h)
+#pragma once
+#include <stdint.h>
+
+#define HALL_TRAVEL_LUT_STEPS 256
+
+#define HALL_PROFILE_LINEAR_4MM 0
+#define HALL_PROFILE_DIPOLE_4MM 1
+#define HALL_PROFILE_DIPOLE_3_5MM 2
+
+#if HALL_TRAVEL_PROFILE == HALL_PROFILE_LINEAR_4MM
+// linear_4mm: 4.0 mm travel, 0.0 mm gap at bottom-out, falloff 1/d^0
+#define HALL_TRAVEL_MAX 400
+static const uint16_t hall_travel_lut[HALL_TRAVEL_LUT_STEPS + 1] = {
+0,2,3,5,6,8,9,11,12,14,16,17,19,20,22,23,
+25,27,28,30,31,33,34,36,38,39,41,42,44,45,47,48,
+50,52,53,55,56,58,59,61,62,64,66,67,69,70,72,73,
+75,77,78,80,81,83,84,86,88,89,91,92,94,95,97,98,
+100,102,103,105,106,108,109,111,112,114,116,117,119,120,122,123,
+125,127,128,130,131,133,134,136,138,139,141,142,144,145,147,148,
+150,152,153,155,156,158,159,161,162,164,166,167,169,170,172,173,
+175,177,178,180,181,183,184,186,188,189,191,192,194,195,197,198,
+200,202,203,205,206,208,209,211,212,214,216,217,219,220,222,223,
+225,227,228,230,231,233,234,236,238,239,241,242,244,245,247,248,
+250,252,253,255,256,258,259,261,262,264,266,267,269,270,272,273,
+275,277,278,280,281,283,284,286,288,289,291,292,294,295,297,298,
+300,302,303,305,306,308,309,311,312,314,316,317,319,320,322,323,
+325,327,328,330,331,333,334,336,338,339,341,342,344,345,347,348,
+350,352,353,355,356,358,359,361,362,364,366,367,369,370,372,373,
+375,377,378,380,381,383,384,386,388,389,391,392,394,395,397,398,
+400,
+};
+#elif HALL_TRAVEL_PROFILE == HALL_PROFILE_DIPOLE_4MM
+// dipole_4mm: 4.0 mm travel, 1.5 mm gap at bottom-out, falloff 1/d^3
+#define HALL_TRAVEL_MAX 400
+static const uint16_t hall_travel_lut[HALL_TRAVEL_LUT_STEPS + 1] = {
+0,31,56,76,94,109,123,135,145,155,164,172,179,186,192,198,
+204,209,214,219,223,228,232,235,239,242,246,249,252,255,258,260,
+263,266,268,270,273,275,277,279,281,283,285,287,288,290,292,294,
+295,297,298,300,301,303,304,305,307,308,309,311,312,313,314,315,
+317,318,319,320,321,322,323,324,325,326,327,328,329,330,330,331,
+332,333,334,335,335,336,337,338,339,339,340,341,342,342,343,344,
+344,345,346,346,347,348,348,349,349,350,351,351,352,352,353,354,
+354,355,355,356,356,357,357,358,358,359,359,360,360,361,361,362,
+362,363,363,364,364,365,365,365,366,366,367,367,368,368,368,369,
+369,370,370,370,371,371,372,372,372,373,373,373,374,374,375,375,
+375,376,376,376,377,377,377,378,378,378,379,379,379,380,380,380,
+381,381,381,381,382,382,382,383,383,383,384,384,384,384,385,385,
+385,386,386,386,386,387,387,387,387,388,388,388,388,389,389,389,
+390,390,390,390,390,391,391,391,391,392,392,392,392,393,393,393,
+393,394,394,394,394,394,395,395,395,395,396,396,396,396,396,397,
+397,397,397,397,398,398,398,398,398,399,399,399,399,399,400,400,
+400,
+};
+#elif HALL_TRAVEL_PROFILE == HALL_PROFILE_DIPOLE_3_5MM
+// dipole_3_5mm: 3.5 mm travel, 1.2 mm gap at bottom-out, falloff 1/d^3
+#define HALL_TRAVEL_MAX 350
+static const uint16_t hall_travel_lut[HALL_TRAVEL_LUT_STEPS + 1] = {
+0,31,56,76,92,106,118,129,138,147,155,162,168,174,179,185,
+189,194,198,202,206,209,212,216,219,222,224,227,229,232,234,236,
+239,241,243,245,247,248,250,252,254,255,257,258,260,261,262,264,
+265,266,268,269,270,271,272,274,275,276,277,278,279,280,281,282,
+283,283,284,285,286,287,288,289,289,290,291,292,292,293,294,295,
+295,296,297,297,298,299,299,300,300,301,302,302,303,303,304,305,
+305,306,306,307,307,308,308,309,309,310,310,311,311,312,312,313,
+313,313,314,314,315,315,316,316,316,317,317,318,318,318,319,319,
+320,320,320,321,321,321,322,322,323,323,323,324,324,324,325,325,
+325,326,326,326,327,327,327,327,328,328,328,329,329,329,330,330,
+330,330,331,331,331,332,332,332,332,333,333,333,333,334,334,334,
+334,335,335,335,335,336,336,336,336,337,337,337,337,337,338,338,
+338,338,339,339,339,339,339,340,340,340,340,341,341,341,341,341,
+342,342,342,342,342,343,343,343,343,343,344,344,344,344,344,344,
+345,345,345,345,345,346,346,346,346,346,346,347,347,347,347,347,
+347,348,348,348,348,348,348,349,349,349,349,349,349,350,350,350,
+350,
+};
+#else
+#error "Unknown HALL_TRAVEL_PROFILE"
+#endif
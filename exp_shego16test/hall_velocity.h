@@ -0,0 +1,105 @@
+/* hall_velocity.h - note velocity from key travel speed
+ * The time a stroke takes from HALL_VELOCITY_START_TRAVEL to
+ * HALL_VELOCITY_NOTE_TRAVEL is mapped to 1..127 on a log scale
+ * (HALL_VELOCITY_FAST_US and faster = 127, HALL_VELOCITY_SLOW_US and slower
+ * = 1). Both crossing times are interpolated between the two samples around
+ * them, so the estimate is not quantized to the scan period.
+ * Header-only and free of QMK/SDK dependencies; tests/scan_sim.c --velocity
+ * replays captures through it on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+
+// Travel points in 0.01 mm
+#ifndef HALL_VELOCITY_START_TRAVEL
+#define HALL_VELOCITY_START_TRAVEL 40
+#endif
+#ifndef HALL_VELOCITY_NOTE_TRAVEL
+#define HALL_VELOCITY_NOTE_TRAVEL 200
+#endif
+#ifndef HALL_VELOCITY_RELEASE_TRAVEL
+#define HALL_VELOCITY_RELEASE_TRAVEL 150
+#endif
+
+#ifndef HALL_VELOCITY_FAST_US
+#define HALL_VELOCITY_FAST_US 2000
+#endif
+#ifndef HALL_VELOCITY_SLOW_US
+#define HALL_VELOCITY_SLOW_US 120000
+#endif
+
+typedef enum {
+    HALL_VELOCITY_NONE,
+    HALL_VELOCITY_NOTE_ON,
+    HALL_VELOCITY_NOTE_OFF,
+} hall_velocity_event_t;
+
+typedef struct {
+    uint32_t prev_us;
+    uint32_t start_us;  // when the stroke passed HALL_VELOCITY_START_TRAVEL
+    uint16_t prev_travel;
+    uint8_t state;
+} hall_velocity_t;
+
+enum { HALL_VELOCITY_UP, HALL_VELOCITY_TIMING, HALL_VELOCITY_ON };
+
+// log2(x) in 8.8 fixed point, mantissa linearly approximated
+static inline uint32_t hall_velocity_log2(uint32_t x) {
+    if (x == 0) return 0;
+    uint8_t msb = 31 - __builtin_clz(x);
+    return (uint32_t)msb << 8 | (((x << (31 - msb)) >> 23) & 0xFF);
+}
+
+static inline uint8_t hall_velocity_curve(uint32_t dt_us) {
+    uint32_t fast = hall_velocity_log2(HALL_VELOCITY_FAST_US);
+    uint32_t slow = hall_velocity_log2(HALL_VELOCITY_SLOW_US);
+    uint32_t l = hall_velocity_log2(dt_us);
+    if (l <= fast) return 127;
+    if (l >= slow) return 1;
+    return 127 - (l - fast) * 126 / (slow - fast);
+}
+
+// When travel went past point between the previous sample and this one.
+// No interpolation across gaps long enough to overflow the product.
+static inline uint32_t hall_velocity_crossing(const hall_velocity_t *v, uint16_t point, uint16_t travel, uint32_t time_us) {
+    uint32_t dt = time_us - v->prev_us;
+    if (travel <= v->prev_travel || point <= v->prev_travel || dt > 0xFFFF) return time_us;
+    return v->prev_us + dt * (point - v->prev_travel) / (travel - v->prev_travel);
+}
+
+// One sample of one key. Returns the event it caused; *velocity is set on
+// HALL_VELOCITY_NOTE_ON.
+static inline hall_velocity_event_t hall_velocity_step(hall_velocity_t *v, uint16_t travel, uint32_t time_us, uint8_t *velocity) {
+    hall_velocity_event_t event = HALL_VELOCITY_NONE;
+
+    switch (v->state) {
+        case HALL_VELOCITY_UP:
+            if (travel < HALL_VELOCITY_START_TRAVEL) break;
+            v->start_us = hall_velocity_crossing(v, HALL_VELOCITY_START_TRAVEL, travel, time_us);
+            v->state = HALL_VELOCITY_TIMING;
+            // A fast stroke can pass both points between two samples
+            // fall through
+        case HALL_VELOCITY_TIMING:
+            if (travel < HALL_VELOCITY_START_TRAVEL) {
+                v->state = HALL_VELOCITY_UP;  // partial press, no note
+            } else if (travel >= HALL_VELOCITY_NOTE_TRAVEL) {
+                uint32_t note_us = hall_velocity_crossing(v, HALL_VELOCITY_NOTE_TRAVEL, travel, time_us);
+                *velocity = hall_velocity_curve(note_us - v->start_us);
+                v->state = HALL_VELOCITY_ON;
+                event = HALL_VELOCITY_NOTE_ON;
+            }
+            break;
+        case HALL_VELOCITY_ON:
+            if (travel >= HALL_VELOCITY_RELEASE_TRAVEL) break;
+            // Timing for a repeated note starts where the release happened
+            v->state = travel >= HALL_VELOCITY_START_TRAVEL ? HALL_VELOCITY_TIMING : HALL_VELOCITY_UP;
+            v->start_us = time_us;
+            event = HALL_VELOCITY_NOTE_OFF;
+            break;
+    }
+
+    v->prev_us = time_us;
+    v->prev_travel = travel;
+    return event;
+}
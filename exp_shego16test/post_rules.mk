@@ -0,0 +1,8 @@
+# Optional interfaces, opt-in in rules.mk or a keymap's rules.mk. Read after
+# the keymap's rules.mk, so its settings count.
+ifeq ($(strip $(JOYSTICK_ENABLE)), yes)
+    SRC += hall_analog.c
+endif
+ifeq ($(strip $(MIDI_ENABLE)), yes)
+    SRC += hall_midi.c
+endif
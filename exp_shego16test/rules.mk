@@ -12,9 +12,20 @@ LTO_ENABLE = yes
 VIA_ENABLE = yes
 RAW_ENABLE = yes
 
+# Analog key depth as a gamepad and over raw HID (hall_analog.c), no analog
+# pins of its own. Adds a HID gamepad interface, so it is opt-in: set these
+# here or in a keymap's rules.mk (post_rules.mk adds the source).
+# JOYSTICK_ENABLE = yes
+# JOYSTICK_DRIVER = digital
+
+# Velocity-sensitive notes from keys mapped to MIDI keycodes (hall_midi.c).
+# Adds a USB MIDI interface and QMK's MIDI stack, so it is opt-in like the
+# gamepad above.
+# MIDI_ENABLE = yes
+
 # Use extended matrix scanning (not complete custom)
 CUSTOM_MATRIX = lite
-SRC += shego_adc.c display.c uart.c
+SRC += shego_adc.c hall_adc.c hall_engine.c hall_calib.c hall_filter.c socd.c hall_stats.c hall_trace.c hall_log.c hall_events.c hall_latency.c hall_dks.c shego_hid.c display.c gif_codec.c uart.c
 
 # Enable analog for RP2040
 ANALOG_DRIVER_REQUIRED = yes
@@ -0,0 +1,54 @@
+/* seqbuf.h - sequence-counted double buffer for single-producer handoff
+ * The producer (IRQ or the other core) publishes whole records without ever
+ * blocking; the consumer copies the newest one and retries only if the slot
+ * it is copying gets rewritten underneath it. Only plain loads, stores and
+ * fences are used so it works on the Cortex-M0+ without atomic RMW support.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef struct {
+    volatile uint32_t gen;     // generation of the newest published slot, 0 = none
+    volatile uint32_t seq[2];  // odd while the slot is being written
+} seqbuf_t;
+
+#define seqbuf_fence() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+// Producer: copy src into the slot not holding the newest record, then
+// make it the newest. slots points at two consecutive records of size bytes.
+static inline void seqbuf_publish(seqbuf_t *sb, void *slots, const void *src, size_t size) {
+    uint32_t gen  = sb->gen + 1;
+    uint8_t  slot = gen & 1;
+    uint8_t *dst  = (uint8_t *)slots + slot * size;
+
+    sb->seq[slot] = sb->seq[slot] + 1;
+    seqbuf_fence();
+    memcpy(dst, src, size);
+    seqbuf_fence();
+    sb->seq[slot] = sb->seq[slot] + 1;
+    seqbuf_fence();
+    sb->gen = gen;
+}
+
+// Consumer: copy the newest record into dst and return its generation,
+// or 0 if nothing has been published yet.
+static inline uint32_t seqbuf_read(const seqbuf_t *sb, const void *slots, void *dst, size_t size) {
+    for (;;) {
+        uint32_t gen = sb->gen;
+        if (gen == 0) return 0;
+        uint8_t slot = gen & 1;
+
+        // Each publish adds 2 to its slot's count, so the slot still holds
+        // generation gen only if its count is gen + slot: otherwise it is
+        // being written, or the producer has lapped it since gen was read
+        uint32_t seq = sb->seq[slot];
+        seqbuf_fence();
+        if (seq != gen + slot) continue;
+        memcpy(dst, (const uint8_t *)slots + slot * size, size);
+        seqbuf_fence();
+        if (sb->seq[slot] == seq) return gen;
+    }
+}
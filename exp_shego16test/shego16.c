@@ -1,9 +1,53 @@
 #include "raw_hid.h"
+#include "via.h"
 #include "rgb_matrix.h"
 #include "display.h"
+#include "shego16.h"
+#include "shego_adc.h"
+#include "hall_calib.h"
+#include "socd.h"
+#include "shego_hid.h"
+#include "hall_trace.h"
+#include "hall_log.h"
+#include "hall_latency.h"
+#include "hall_midi.h"
+
+_Static_assert(sizeof(kb_config_t) == EECONFIG_KB_DATA_SIZE, "EECONFIG_KB_DATA_SIZE must match kb_config_t");
+
+kb_config_t kb_config;
+
+void kb_config_load(void) {
+    eeconfig_read_kb_datablock(&kb_config);
+    if (kb_config.magic == EECONFIG_KB_DATA_VERSION) return;
+
+    // Calibration defaults are filled in by the boot rest capture
+    memset(&kb_config, 0, sizeof(kb_config));
+    kb_config.magic = EECONFIG_KB_DATA_VERSION;
+    socd_config_defaults(&kb_config.socd);
+    hall_analog_config_defaults(&kb_config.analog);
+    hall_dks_config_defaults(&kb_config.dks);
+    hall_adc_config_defaults(&kb_config.adc);
+}
+
+void kb_config_save(void) {
+    eeconfig_update_kb_datablock(&kb_config);
+}
+
+uint16_t kb_effective_keycode(layer_state_t layers, keypos_t pos) {
+    for (int8_t layer = MAX_LAYER - 1; layer >= 0; layer--) {
+        if (!(layers & ((layer_state_t)1 << layer))) continue;
+        uint16_t keycode = keymap_key_to_keycode(layer, pos);
+        if (keycode != KC_TRNS) return keycode;
+    }
+    return KC_NO;
+}
 
 void raw_hid_receive_kb(uint8_t *data, uint8_t length) {
     // This is the keyboard-level hook (safe with VIA)
+    if (shego_hid_receive(data, length)) {
+        raw_hid_send(data, length);
+        return;
+    }
     for (int i = 0; i < DRIVER_LED_TOTAL && (i*3+2) < length; i++) {
         uint8_t g = data[i*3 + 0];
         uint8_t r = data[i*3 + 1];
@@ -12,9 +56,97 @@ void raw_hid_receive_kb(uint8_t *data, uint8_t length) {
     }
 }
 
+// VIA custom menu (shego16.json "menus"): value id = layer * SOCD_MAX_GROUPS + group
+void via_custom_value_command_kb(uint8_t *data, uint8_t length) {
+    uint8_t *command_id = &data[0];
+    uint8_t *channel_id = &data[1];
+    uint8_t *value_id_and_data = &data[2];
+
+    if (*channel_id != id_custom_channel) {
+        *command_id = id_unhandled;
+        return;
+    }
+
+    uint8_t layer = value_id_and_data[0] / SOCD_MAX_GROUPS;
+    uint8_t group = value_id_and_data[0] % SOCD_MAX_GROUPS;
+    switch (*command_id) {
+        case id_custom_set_value:
+            socd_set_mode(layer, group, value_id_and_data[1]);
+            break;
+        case id_custom_get_value:
+            value_id_and_data[1] = socd_get_mode(layer, group);
+            break;
+        case id_custom_save:
+            kb_config_save();
+            break;
+        default:
+            *command_id = id_unhandled;
+            break;
+    }
+}
+
+bool via_command_kb(uint8_t *data, uint8_t length) {
+    // Keyboard sub-commands (shego_hid.h) never reach VIA
+    if (shego_hid_receive(data, length)) {
+        raw_hid_send(data, length);
+        return true;
+    }
+
+    // Keymap edits can move SOCD and MIDI note keys; let VIA handle the command as usual
+    switch (data[0]) {
+        case id_dynamic_keymap_set_keycode:
+        case id_dynamic_keymap_reset:
+        case id_dynamic_keymap_set_buffer:
+            socd_mark_dirty();
+            hall_midi_mark_dirty();
+            break;
+    }
+    return false;
+}
+
+layer_state_t layer_state_set_kb(layer_state_t state) {
+    state = layer_state_set_user(state);
+    socd_refresh(state);
+    hall_midi_refresh(state);
+    return state;
+}
+
+layer_state_t default_layer_state_set_kb(layer_state_t state) {
+    state = default_layer_state_set_user(state);
+    socd_mark_dirty();
+    hall_midi_mark_dirty();
+    return state;
+}
+
+bool process_record_kb(uint16_t keycode, keyrecord_t *record) {
+    // Stamped before user code so its wait_ms() counts as keymap time
+    hall_latency_record(record->event.key.row, record->event.key.col);
+    if (!process_record_user(keycode, record)) return false;
+
+    switch (keycode) {
+        case RT_TOGG:
+            if (record->event.pressed) {
+                hall_set_rapid_trigger(!hall_rapid_trigger_enabled());
+                uprintf("Rapid Trigger %s\n", hall_rapid_trigger_enabled() ? "on" : "off");
+            }
+            return false;
+        case CAL_TOGG:
+            // Start, press every key fully a few times, then press again to save
+            if (record->event.pressed) {
+                hall_calib_toggle();
+                uprintf("Calibration %s\n", hall_calib_active() ? "started" : "finished");
+            }
+            return false;
+    }
+    return true;
+}
+
 void keyboard_post_init_kb(void) {
     // Inform console that post-init is running and trigger display init/test
     uprintf("Hello from shego16 keyboard\n");
+    // SOCD groups and MIDI note keys follow the keymap, which is readable from here on
+    socd_refresh(layer_state);
+    hall_midi_refresh(layer_state);
     // Temporarily disable RGB to lower current draw while initializing the display
     rgb_matrix_disable_noeeprom();
     // Initialize and test the ST7735 display
@@ -27,6 +159,26 @@ void keyboard_post_init_kb(void) {
 }
 
 void housekeeping_task_kb(void) {
+    // Persist a finished calibration pass
+    hall_calib_task();
+    socd_task();
+
+    // Stream captured ADC samples, if a capture is running
+    hall_trace_task();
+
+    // Print what the scanner logged since the last pass
+    hall_log_task();
+
+    // Close out key records that produced no report
+    hall_latency_task();
+
+    // Dynamic Keystroke actions and MIDI notes queued by the scanner
+    hall_dks_task();
+    hall_midi_task();
+
+    // Key depth to the joystick axes
+    hall_analog_task();
+
     // Update display animation
     display_update_animation();
 }
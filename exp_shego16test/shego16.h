@@ -1,6 +1,36 @@
 #pragma once
 
 #include "quantum.h"
+#include "hall_calib.h"
+#include "socd.h"
+#include "hall_analog.h"
+#include "hall_dks.h"
+#include "hall_adc.h"
 
 // Layout macro moved to keymap.c to avoid QMK warnings
 
+// Keyboard-level keycodes (VIA "customKeycodes" in shego16.json, same order)
+enum shego16_keycodes {
+    RT_TOGG = QK_KB_0,  // Toggle Rapid Trigger
+    CAL_TOGG,           // Start / finish a calibration pass
+};
+
+// Persisted keyboard settings, stored as the whole EEPROM kb datablock
+// (EECONFIG_KB_DATA_SIZE). magic holds EECONFIG_KB_DATA_VERSION so a layout
+// change or a blank datablock falls back to defaults.
+typedef struct {
+    uint16_t magic;
+    hall_calib_data_t calib;
+    socd_config_t socd;
+    hall_analog_config_t analog;
+    hall_dks_config_t dks;
+    hall_adc_config_t adc;
+} kb_config_t;
+
+extern kb_config_t kb_config;
+
+void kb_config_load(void);
+void kb_config_save(void);
+
+// Topmost non-transparent keycode at pos over the given layers
+uint16_t kb_effective_keycode(layer_state_t layers, keypos_t pos);
@@ -7,6 +7,44 @@
 #include "debug.h"
 #include "timer.h"
 #include "print.h"
+#include "hardware/timer.h"
+#include "shego_adc.h"
+#include "hall_engine.h"
+#include "hall_adc.h"
+#include "hall_calib.h"
+#include "hall_travel.h"
+#include "hall_filter.h"
+#include "seqbuf.h"
+#include "socd.h"
+#include "hall_stats.h"
+#include "hall_trace.h"
+#include "hall_log.h"
+#include "hall_events.h"
+#include "hall_latency.h"
+#include "hall_analog.h"
+#include "hall_dks.h"
+#include "hall_midi.h"
+
+// Core 1 has no ChibiOS instance, so both the engine and the core 1 scanner
+// talk to the ADC registers (hall_adc.c) instead of going through
+// analogReadPin()
+#if defined(HALL_DMA_ENGINE) || defined(HALL_CORE1_SCAN)
+#define HALL_DIRECT_ADC
+#endif
+
+#ifdef HALL_CORE1_SCAN
+// Core 1 runs the scan from XIP flash, and nothing parks it while core 0
+// erases or programs flash (kb_config_save(), VIA, EEPROM emulation): the
+// first calibration or saved setting would fault or hang it. The host
+// simulator has no flash and keeps building the configuration.
+#ifndef HALL_HOST_SIM
+#error "HALL_CORE1_SCAN: core 1 executes from flash and is not stopped during flash writes"
+#endif
+#include "hardware/structs/sio.h"
+#define hall_wait_us(us) hall_busy_wait_us(us)
+#else
+#define hall_wait_us(us) wait_us(us)
+#endif
 
 // MUX control pins
 #define MUX_S0 GP10
@@ -17,98 +55,399 @@
 #define MUX2_EN GP15
 #define MUX1_ADC_PIN GP29
 #define MUX2_ADC_PIN GP28
+#define MUX1_ADC_INPUT 3  // GP29 = ADC3
+#define MUX2_ADC_INPUT 2  // GP28 = ADC2
+
+// Scan mode: 1 = keep both muxes enabled and sample GP29/GP28 back-to-back
+// for the same select code, 0 = legacy serialized EN toggling
+#ifndef MUX_PARALLEL_SCAN
+#define MUX_PARALLEL_SCAN 1
+#endif
+
+// Select-line settle time is measured at init and clamped to this range (us)
+#define MUX_SETTLE_MIN_US 5
+#define MUX_SETTLE_MAX_US 100
+#define MUX_SETTLE_MARGIN_US 2
+#define MUX_SETTLE_TOLERANCE 8   // ADC counts from the final reading
+#define MUX_SETTLE_SAMPLES 64
+
+// Only used by the legacy serialized mode, after switching EN lines
+#define MUX_EN_SETTLE_US 100
+
+// Actuation points in 0.01 mm of travel, 0 marks an unpopulated channel
+#ifndef HALL_ACTUATION_TRAVEL
+#define HALL_ACTUATION_TRAVEL 150
+#endif
+static uint16_t key_thresholds[32];
+
+// Release point this far above the actuation point (0.01 mm), and the
+// consecutive samples past a point needed to switch (1 = first sample)
+#ifndef HALL_HYSTERESIS_TRAVEL
+#define HALL_HYSTERESIS_TRAVEL 20
+#endif
+#ifndef HALL_CONFIRM_SAMPLES
+#define HALL_CONFIRM_SAMPLES 1
+#endif
 
-// Hall effect thresholds - temporarily lowered for testing
-static const uint16_t key_thresholds[32] = {
-    // MUX1 thresholds (channels 0-15) - lowered to 400 for testing
-    540, 540, 0, 0, 0, 0, 540, 540, 540, 540, 0, 0, 0, 0, 0, 540,
-    // MUX2 thresholds (channels 0-15) - lowered to 400 for testing
-    540, 540, 0, 0, 0, 0, 540, 540, 540, 540, 0, 0, 0, 0, 540, 540
-};
+// Actuation / release points converted to ADC counts for the current
+// calibration, so the plain threshold path never computes travel
+static uint16_t key_press_adc[32];
+static uint16_t key_release_adc[32];
+static uint16_t key_points_gen;
+
+// Per-key ADC -> travel normalization, refreshed by hall_calib.c
+static hall_travel_cal_t key_cal[32];
+
+// Populated hall sensors as X(mux, select code, row, col, layer 0 keycode). This is
+// the single source for the scan: the key table, the select codes visited
+// and the active channel mask are all derived from it at compile time.
+#define HALL_KEY_TABLE(X) \
+    X(1,  0, 0, 1, KC_2)  /* he2  */ \
+    X(1,  1, 0, 0, KC_1)  /* he3  */ \
+    X(1,  6, 1, 0, KC_Q)  /* he7  */ \
+    X(1,  7, 1, 1, KC_W)  /* he6  */ \
+    X(1,  8, 1, 2, KC_E)  /* he5  */ \
+    X(1,  9, 1, 3, KC_R)  /* he4  */ \
+    X(1, 15, 0, 2, KC_3)  /* he1  */ \
+    X(2,  0, 2, 1, KC_S)  /* he10 */ \
+    X(2,  1, 2, 0, KC_A)  /* he11 */ \
+    X(2,  6, 3, 0, KC_Z)  /* he15 */ \
+    X(2,  7, 3, 1, KC_X)  /* he14 */ \
+    X(2,  8, 3, 2, KC_C)  /* he13 */ \
+    X(2,  9, 3, 3, KC_V)  /* he12 */ \
+    X(2, 14, 2, 3, KC_F)  /* he8  */ \
+    X(2, 15, 2, 2, KC_D)  /* he9  */
+
+// Channel index in the sample arrays: MUX1 0..15, MUX2 16..31
+#define HALL_KEY_CHANNEL(mux, sel) (((mux) - 1) * HALL_MUX_CHANNELS + (sel))
 
-// Map MUX channels to matrix positions
 typedef struct {
-    uint8_t row;
-    uint8_t col;
-    uint16_t keycode;
-} key_mapping_t;
-
-// MUX1 channel mappings
-static const key_mapping_t mux1_keys[16] = {
-    {0, 1, KC_2},   // CH0 -> he2 -> "2"
-    {0, 0, KC_1},   // CH1 -> he3 -> "1" 
-    {255, 255, KC_NO},  // CH2 -> unused
-    {255, 255, KC_NO},  // CH3 -> unused
-    {255, 255, KC_NO},  // CH4 -> unused
-    {255, 255, KC_NO},  // CH5 -> unused
-    {1, 0, KC_Q},   // CH6 -> he7 -> "Q"
-    {1, 1, KC_W},   // CH7 -> he6 -> "W"
-    {1, 2, KC_E},   // CH8 -> he5 -> "E"
-    {1, 3, KC_R},   // CH9 -> he4 -> "R"
-    {255, 255, KC_NO},  // CH10 -> unused
-    {255, 255, KC_NO},  // CH11 -> unused
-    {255, 255, KC_NO},  // CH12 -> unused
-    {255, 255, KC_NO},  // CH13 -> unused
-    {255, 255, KC_NO},  // CH14 -> unused
-    {0, 2, KC_3}    // CH15 -> he1 -> "3"
-};
-
-// MUX2 channel mappings
-static const key_mapping_t mux2_keys[16] = {
-    {2, 1, KC_S},   // CH0 -> he10 -> "S"
-    {2, 0, KC_A},   // CH1 -> he11 -> "A"
-    {255, 255, KC_NO},  // CH2 -> unused
-    {255, 255, KC_NO},  // CH3 -> unused
-    {255, 255, KC_NO},  // CH4 -> unused
-    {255, 255, KC_NO},  // CH5 -> unused
-    {3, 0, KC_Z},   // CH6 -> he15 -> "Z"
-    {3, 1, KC_X},   // CH7 -> he14 -> "X"
-    {3, 2, KC_C},   // CH8 -> he13 -> "C"
-    {3, 3, KC_V},   // CH9 -> he12 -> "V"
-    {255, 255, KC_NO},  // CH10 -> unused
-    {255, 255, KC_NO},  // CH11 -> unused
-    {255, 255, KC_NO},  // CH12 -> unused
-    {255, 255, KC_NO},  // CH13 -> unused
-    {2, 3, KC_F},   // CH14 -> he8 -> "F"
-    {2, 2, KC_D}    // CH15 -> he9 -> "D"
-};
+    uint8_t ch;         // channel index into samples[]
+    uint8_t row;        // matrix row
+    uint8_t pos;        // row * MATRIX_COLS + col (hall_analog.h)
+    matrix_row_t mask;  // matrix column bit
+} hall_key_t;
+
+#define HALL_KEY_ENTRY(mux, sel, row, col, kc) {HALL_KEY_CHANNEL(mux, sel), row, (row) * MATRIX_COLS + (col), (matrix_row_t)1 << (col)},
+#define HALL_KEY_SELECT_BIT(mux, sel, row, col, kc) | (1u << (sel))
+#define HALL_KEY_ACTIVE_BIT(mux, sel, row, col, kc) | (1UL << HALL_KEY_CHANNEL(mux, sel))
+
+static const hall_key_t hall_keys[] = { HALL_KEY_TABLE(HALL_KEY_ENTRY) };
+#define HALL_KEY_COUNT (sizeof(hall_keys) / sizeof(hall_keys[0]))
+#define HALL_SELECT_MASK (0 HALL_KEY_TABLE(HALL_KEY_SELECT_BIT))
+#define HALL_ACTIVE_MASK (0 HALL_KEY_TABLE(HALL_KEY_ACTIVE_BIT))
+
+// Select codes with at least one sensor behind them, in scan order.
+// Expanded from HALL_SELECT_MASK at init; every other code is never visited.
+static uint8_t scan_selects[HALL_MUX_CHANNELS];
+static uint8_t scan_select_count;
 
 // Key state tracking
 static bool key_pressed[32];
-static uint32_t key_timer[32];
-static matrix_row_t matrix_state[MATRIX_ROWS];
+static uint8_t key_confirm[32];   // samples seen past the next switch point
+static uint16_t key_extreme[32];  // Rapid Trigger: deepest travel while pressed, shallowest while released
 
-// SOCD state tracking for A and D keys
-static bool a_pressed = false;
-static bool d_pressed = false;
-static bool a_was_last = false; // Track which was pressed last
+// Dynamic Keystroke keys (hall_dks.h), rebuilt with the switch points
+static hall_dks_key_t dks_keys[HALL_DKS_SLOTS];
+static uint8_t dks_count;
+static matrix_row_t dks_mask[MATRIX_ROWS];  // their matrix bits, always cleared
+static uint32_t dks_gen;
+static matrix_row_t matrix_state[MATRIX_ROWS];
 
-// Debug counter to limit output
+// Processed scans, paces the periodic HALL_LOG_SAMPLE snapshot
 static uint32_t debug_counter = 0;
+#define DEBUG_SNAPSHOT_SCANS 2000
+
+// Rapid Trigger: below the actuation point a key releases as soon as it
+// rises RAPID_TRIGGER_RELEASE_DELTA from its deepest point and re-presses
+// once it goes RAPID_TRIGGER_PRESS_DELTA down again (0.01 mm)
+#ifndef RAPID_TRIGGER_PRESS_DELTA
+#define RAPID_TRIGGER_PRESS_DELTA 30
+#endif
+#ifndef RAPID_TRIGGER_RELEASE_DELTA
+#define RAPID_TRIGGER_RELEASE_DELTA 30
+#endif
+
+#ifdef RAPID_TRIGGER_DEFAULT_ON
+static volatile bool rapid_trigger_enabled = true;
+#else
+static volatile bool rapid_trigger_enabled = false;
+#endif
+
+// Sample time and end of processing of the last processed scan
+static uint32_t last_sample_us;
+static uint32_t last_ready_us;
+
+// Fixed-rate scanning: the scan runs every HALL_SCAN_PERIOD_US on a fixed
+// grid of the 1 MHz timer and hands key transitions to matrix_scan_custom()
+// through hall_events.c. On core 0 a ChibiOS thread above the main loop's
+// priority sleeps between ticks; core 1 spins on the grid.
+#ifdef HALL_SCAN_RATE_HZ
+#if !defined(HALL_DMA_ENGINE) && !defined(HALL_CORE1_SCAN)
+#error "HALL_SCAN_RATE_HZ needs HALL_DMA_ENGINE or HALL_CORE1_SCAN: a blocking scan above the main loop starves it"
+#endif
+#define HALL_SCAN_PERIOD_US (1000000 / HALL_SCAN_RATE_HZ)
+
+static uint32_t scan_target;
+static matrix_row_t scan_rows[MATRIX_ROWS];    // scanner's own matrix
+static matrix_row_t queued_rows[MATRIX_ROWS];  // matrix as described by the queued events
+
+#ifndef HALL_CORE1_SCAN
+static void hall_scan_thread_start(void);
+#endif
+#endif
+
+#if defined(HALL_CORE1_SCAN) && !defined(HALL_SCAN_RATE_HZ)
+// Key state published by core 1, read by matrix_scan_custom() on core 0
+typedef struct {
+    matrix_row_t rows[MATRIX_ROWS];
+    uint32_t scans;
+    uint32_t sample_us;
+    uint32_t ready_us;
+} hall_keystate_t;
+
+static seqbuf_t keystate_buf;
+static hall_keystate_t keystate_slots[2];
+#endif
+
+#ifdef HALL_CORE1_SCAN
+static uint32_t core1_stack[1024];
 
-#define DEBOUNCE_MS 5
-#define HYSTERESIS 20  // Hysteresis to prevent bouncing
+static void hall_core1_main(void);
 
-// Debug output control
-static bool debug_enabled = false;
+// Core 1 has no ChibiOS delays, so it spins on the 1 MHz timer
+static void hall_busy_wait_us(uint32_t us) {
+    uint32_t start = time_us_32();
+    while (time_us_32() - start < us) {
+    }
+}
+
+// Start core 1 at entry on its own stack through the bootrom's FIFO
+// handshake (pico_multicore is not part of the QMK build). Core 1 echoes
+// every word; a wrong echo restarts the sequence.
+static void hall_core1_launch(void (*entry)(void), uint32_t *stack, size_t size) {
+    const uint32_t cmds[] = {0, 0, 1, SCB->VTOR, (uintptr_t)(stack + size / sizeof(uint32_t)), (uintptr_t)entry};
+    uint8_t i = 0;
+    while (i < sizeof(cmds) / sizeof(cmds[0])) {
+        uint32_t cmd = cmds[i];
+        if (cmd == 0) {
+            // Drop stale words before each sync word
+            while (sio_hw->fifo_st & SIO_FIFO_ST_VLD_BITS) (void)sio_hw->fifo_rd;
+            __SEV();
+        }
+        while (!(sio_hw->fifo_st & SIO_FIFO_ST_RDY_BITS)) {
+        }
+        sio_hw->fifo_wr = cmd;
+        __SEV();
+        while (!(sio_hw->fifo_st & SIO_FIFO_ST_VLD_BITS)) __WFE();
+        i = sio_hw->fifo_rd == cmd ? i + 1 : 0;
+    }
+}
+#endif
 
-// Helper for debug printing
-#define debug_print(...) do { if (debug_enabled) uprintf(__VA_ARGS__); } while(0)
+// Measured select-line settle time, see measure_mux_settle_us()
+static uint16_t mux_settle_us = MUX_SETTLE_MAX_US;
 
-// Real ADC reading
+// Latest raw reading per channel, same layout as key_thresholds[]
+static uint16_t adc_samples[HALL_CHANNELS];
+
+#ifdef HALL_DMA_ENGINE
+static hall_snapshot_t snapshot;
+// False if hall_engine_init() got no DMA channels: the blocking scan runs
+// instead, from the main loop
+static bool engine_running;
+#else
+#define engine_running false
+#endif
+
+#ifdef HALL_DIRECT_ADC
+// One-shot read straight from the ADC so the ChibiOS analog driver never
+// claims it. Used by the core 1 blocking scan and, with the engine, for the
+// settle measurement before it starts and the scan if it could not start.
+// DNL-corrected, with
+// HALL_ADC_FRAC_BITS fraction bits (hall_adc.h).
+static uint16_t read_adc_pin(pin_t pin) {
+    return hall_adc_correct(hall_adc_hw_read(pin == MUX1_ADC_PIN ? MUX1_ADC_INPUT : MUX2_ADC_INPUT));
+}
+#else
+// Real ADC reading, DNL-corrected as above
 static uint16_t read_adc_pin(pin_t pin) {
-    return analogReadPin(pin);
+    return hall_adc_correct(analogReadPin(pin));
 }
+#endif
 
 static void select_mux_channel(uint8_t channel) {
     writePin(MUX_S0, (channel & 0x01) ? 1 : 0);
     writePin(MUX_S1, (channel & 0x02) ? 1 : 0);
     writePin(MUX_S2, (channel & 0x04) ? 1 : 0);
     writePin(MUX_S3, (channel & 0x08) ? 1 : 0);
-    wait_us(50);
+}
+
+// Measure how long the mux outputs need after a select change. Each populated
+// channel is entered from its inverted select code (all four lines toggle),
+// sampled back-to-back, and the settle time is the timestamp of the first
+// sample after the last one outside MUX_SETTLE_TOLERANCE of the final value.
+// Both muxes must be enabled when this runs.
+static uint16_t measure_mux_settle_us(void) {
+    uint16_t samples[MUX_SETTLE_SAMPLES];
+    uint32_t stamps[MUX_SETTLE_SAMPLES];
+    uint32_t worst = 0;
+
+    for (uint8_t k = 0; k < HALL_KEY_COUNT; k++) {
+        uint8_t sel = hall_keys[k].ch & (HALL_MUX_CHANNELS - 1);
+        pin_t pin = hall_keys[k].ch < HALL_MUX_CHANNELS ? MUX1_ADC_PIN : MUX2_ADC_PIN;
+
+        select_mux_channel(sel ^ 0x0F);
+        wait_us(MUX_SETTLE_MAX_US);
+
+        uint32_t start = time_us_32();
+        select_mux_channel(sel);
+        for (uint8_t i = 0; i < MUX_SETTLE_SAMPLES; i++) {
+            samples[i] = read_adc_pin(pin);
+            stamps[i] = time_us_32() - start;
+        }
+
+        uint16_t final = samples[MUX_SETTLE_SAMPLES - 1];
+        uint32_t settled = 0;
+        for (uint8_t i = MUX_SETTLE_SAMPLES - 1; i-- > 0;) {
+            int32_t diff = (int32_t)samples[i] - (int32_t)final;
+            if (diff > (MUX_SETTLE_TOLERANCE << HALL_ADC_FRAC_BITS) || diff < -(MUX_SETTLE_TOLERANCE << HALL_ADC_FRAC_BITS)) {
+                settled = stamps[i + 1];
+                break;
+            }
+        }
+        if (settled > worst) worst = settled;
+    }
+
+    worst += MUX_SETTLE_MARGIN_US;
+    if (worst < MUX_SETTLE_MIN_US) worst = MUX_SETTLE_MIN_US;
+    if (worst > MUX_SETTLE_MAX_US) worst = MUX_SETTLE_MAX_US;
+    return (uint16_t)worst;
+}
+
+void hall_set_rapid_trigger(bool enable) {
+    rapid_trigger_enabled = enable;
+}
+
+bool hall_rapid_trigger_enabled(void) {
+    return rapid_trigger_enabled;
+}
+
+// ADC count that passes a DKS point; 4096 (never) for an unused point
+static uint16_t dks_point_adc(uint8_t idx, uint8_t point, uint16_t hysteresis) {
+    if (point == 0) return 4096;
+    uint16_t travel = point * HALL_DKS_UNIT;
+    if (travel > HALL_TRAVEL_MAX - HALL_HYSTERESIS_TRAVEL) travel = HALL_TRAVEL_MAX - HALL_HYSTERESIS_TRAVEL;
+    return hall_travel_adc(&key_cal[idx], travel > hysteresis ? travel - hysteresis : 0);
+}
+
+// Rebuild the DKS key list from the slots. A key keeps its zone when its
+// slot did not change, so a calibration update mid-stroke sends nothing.
+static void update_dks_keys(void) {
+    hall_dks_key_t previous[HALL_DKS_SLOTS];
+    uint8_t previous_count = dks_count;
+    memcpy(previous, dks_keys, sizeof(previous));
+    bool same_slots = dks_gen == hall_dks_generation();
+
+    dks_gen = hall_dks_generation();
+    dks_count = 0;
+    memset(dks_mask, 0, sizeof(dks_mask));
+    for (uint8_t s = 0; s < HALL_DKS_SLOTS; s++) {
+        const hall_dks_slot_t *slot = hall_dks_slot(s);
+        for (uint8_t k = 0; k < HALL_KEY_COUNT; k++) {
+            const hall_key_t *key = &hall_keys[k];
+            if (key->pos != slot->key) continue;
+
+            hall_dks_key_t *dks = &dks_keys[dks_count++];
+            dks->ch = key->ch;
+            dks->slot = s;
+            dks->zone = 0;
+            for (uint8_t i = 0; same_slots && i < previous_count; i++) {
+                if (previous[i].slot == s) dks->zone = previous[i].zone;
+            }
+            for (uint8_t p = 0; p < 2; p++) {
+                dks->down[p] = dks_point_adc(key->ch, slot->point[p], 0);
+                dks->up[p] = dks_point_adc(key->ch, slot->point[p], HALL_HYSTERESIS_TRAVEL);
+            }
+            dks_mask[key->row] |= key->mask;
+            break;
+        }
+    }
+}
+
+// Recompute the ADC switch points after a calibration change
+static void update_key_points(void) {
+    key_points_gen = hall_calib_generation();
+    for (uint8_t k = 0; k < HALL_KEY_COUNT; k++) {
+        uint8_t idx = hall_keys[k].ch;
+        uint16_t release = key_thresholds[idx] > HALL_HYSTERESIS_TRAVEL ? key_thresholds[idx] - HALL_HYSTERESIS_TRAVEL : 0;
+        key_press_adc[idx] = hall_travel_adc(&key_cal[idx], key_thresholds[idx]);
+        key_release_adc[idx] = hall_travel_adc(&key_cal[idx], release);
+    }
+    update_dks_keys();
+}
+
+// Eager threshold state: a key switches on the first sample past its press
+// or release point (or the HALL_CONFIRM_SAMPLES-th in a row). The gap
+// between the two points stops noise at the threshold from chattering.
+static bool hysteresis_state(uint8_t idx, uint16_t adc) {
+    bool pressed = key_pressed[idx];
+    bool crossed = pressed ? adc < key_release_adc[idx] : adc >= key_press_adc[idx];
+
+    if (!crossed) {
+        key_confirm[idx] = 0;
+        return pressed;
+    }
+    if (++key_confirm[idx] < HALL_CONFIRM_SAMPLES) return pressed;
+    key_confirm[idx] = 0;
+    return !pressed;
+}
+
+// Rapid Trigger decision for one key from its travel. At or short of the
+// release point (the actuation point less HALL_HYSTERESIS_TRAVEL) the key is
+// always released; past it, direction changes of more than the deltas toggle
+// it. A key coming down from the release point presses on crossing the
+// actuation point itself, so noise at either point cannot chatter.
+static bool rapid_trigger_state(uint8_t idx, uint16_t travel, uint16_t threshold) {
+    uint16_t extreme = key_extreme[idx];
+    uint16_t release = threshold > HALL_HYSTERESIS_TRAVEL ? threshold - HALL_HYSTERESIS_TRAVEL : 0;
+
+    if (travel <= release) {
+        key_extreme[idx] = travel;
+        return false;
+    }
+
+    if (key_pressed[idx]) {
+        if (travel > extreme) {
+            key_extreme[idx] = travel;
+        } else if (travel + RAPID_TRIGGER_RELEASE_DELTA <= extreme) {
+            key_extreme[idx] = travel;
+            return false;
+        }
+        return true;
+    }
+
+    // Last seen at the release point: wait for the actuation point, keeping
+    // the extreme there until then
+    if (extreme <= release) {
+        if (travel <= threshold) return false;
+        key_extreme[idx] = travel;
+        return true;
+    }
+    if (travel >= extreme + RAPID_TRIGGER_PRESS_DELTA) {
+        key_extreme[idx] = travel;
+        return true;
+    }
+    if (travel < extreme) key_extreme[idx] = travel;
+    return false;
 }
 
 void matrix_init_custom(void) {
+    // Settings first: every ADC read, including the settle measurement,
+    // goes through the correction table
+    kb_config_load();
+    hall_adc_init();
+
     // Setup MUX control pins
     setPinOutput(MUX_S0);
     setPinOutput(MUX_S1);
@@ -117,199 +456,361 @@ void matrix_init_custom(void) {
     setPinOutput(MUX1_EN);
     setPinOutput(MUX2_EN);
     
-    // Disable both MUXes (active low)
-    writePinHigh(MUX1_EN);
-    writePinHigh(MUX2_EN);
-    
     // Initialize ADC pins
     setPinInputHigh(MUX1_ADC_PIN);
     setPinInputHigh(MUX2_ADC_PIN);
-    
+
+#ifdef HALL_DIRECT_ADC
+    palSetLineMode(MUX1_ADC_PIN, PAL_MODE_INPUT_ANALOG);
+    palSetLineMode(MUX2_ADC_PIN, PAL_MODE_INPUT_ANALOG);
+    hall_adc_hw_init();
+#endif
+
+    // Enable both MUXes (active low) to measure the select-line settle time
+    writePinLow(MUX1_EN);
+    writePinLow(MUX2_EN);
+    mux_settle_us = measure_mux_settle_us();
+    uprintf("shego_adc: mux settle %u us\n", mux_settle_us);
+
+    // Expand the compile-time select mask into the scan order
+    scan_select_count = 0;
+    for (uint8_t sel = 0; sel < HALL_MUX_CHANNELS; sel++) {
+        if (HALL_SELECT_MASK & (1u << sel)) scan_selects[scan_select_count++] = sel;
+    }
+
+    // Calibration and filtering only cover populated channels
+    uint32_t active = HALL_ACTIVE_MASK;
+    hall_calib_init(active);
+    hall_filter_init(active);
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        key_thresholds[ch] = (active & (1UL << ch)) ? HALL_ACTUATION_TRAVEL : 0;
+    }
+
     // Initialize state
     for (uint8_t i = 0; i < 32; i++) {
         key_pressed[i] = false;
-        key_timer[i] = 0;
+        key_confirm[i] = 0;
+        key_extreme[i] = 0;
     }
     
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         matrix_state[row] = 0;
     }
-    
+
+#ifdef HALL_DMA_ENGINE
+    // The engine needs both MUXes enabled and owns the select lines from
+    // here. Started on core 0 even with HALL_CORE1_SCAN: its DMA IRQ is
+    // served by ChibiOS.
+    engine_running = hall_engine_init(mux_settle_us, scan_selects, scan_select_count);
+    if (engine_running) {
+        uprintf("shego_adc: DMA engine, %lu us per scan\n", hall_engine_scan_period_us());
+    } else {
+        uprintf("shego_adc: no DMA channels for the engine, blocking scan\n");
+    }
+#endif
+
+#if defined(HALL_CORE1_SCAN)
+    // Core 1 owns all key state from here, and without the engine the
+    // select lines and the ADC as well
+    hall_core1_launch(hall_core1_main, core1_stack, sizeof(core1_stack));
+    uprintf("shego_adc: scanning on core 1\n");
+#else
+#ifdef HALL_SCAN_RATE_HZ
+    // Without the engine a blocking scan in a thread above the main loop
+    // would starve it; matrix_scan_custom() scans instead
+    if (engine_running) {
+        hall_scan_thread_start();
+        uprintf("shego_adc: fixed-rate scan every %u us\n", HALL_SCAN_PERIOD_US);
+        if (hall_engine_scan_period_us() > HALL_SCAN_PERIOD_US) {
+            uprintf("shego_adc: DMA pass is longer than the tick, some ticks reuse the previous pass\n");
+        }
+    }
+#endif
+#if !MUX_PARALLEL_SCAN
+    // Serialized mode enables one MUX at a time during the scan
+    if (!engine_running) {
+        writePinHigh(MUX1_EN);
+        writePinHigh(MUX2_EN);
+    }
+#endif
+#endif
 }
 
-bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+// Blocking scan of both muxes into samples[]
+static void read_all_channels(uint16_t samples[]) {
+    for (uint8_t i = 0; i < scan_select_count; i++) {
+        uint8_t ch = scan_selects[i];
+        select_mux_channel(ch);
+        
+        uint32_t adc1 = 0, adc2 = 0;
+#if MUX_PARALLEL_SCAN
+        // Both MUXes stay enabled and feed separate ADC inputs, so one
+        // settle covers both reads
+        hall_wait_us(mux_settle_us);
+        for (uint8_t n = 0; n < HALL_OVERSAMPLE; n++) {
+            adc1 += read_adc_pin(MUX1_ADC_PIN);
+            adc2 += read_adc_pin(MUX2_ADC_PIN);
+        }
+#else
+        // Read MUX1
+        writePinLow(MUX1_EN);   // Enable MUX1
+        writePinHigh(MUX2_EN);  // Disable MUX2
+        hall_wait_us(mux_settle_us > MUX_EN_SETTLE_US ? mux_settle_us : MUX_EN_SETTLE_US);
+        for (uint8_t n = 0; n < HALL_OVERSAMPLE; n++) adc1 += read_adc_pin(MUX1_ADC_PIN);
+
+        // Read MUX2
+        writePinHigh(MUX1_EN);  // Disable MUX1
+        writePinLow(MUX2_EN);   // Enable MUX2
+        hall_wait_us(MUX_EN_SETTLE_US);
+        for (uint8_t n = 0; n < HALL_OVERSAMPLE; n++) adc2 += read_adc_pin(MUX2_ADC_PIN);
+
+        // Disable both MUXes
+        writePinHigh(MUX1_EN);
+        writePinHigh(MUX2_EN);
+#endif
+
+        samples[ch] = hall_adc_average(adc1, HALL_OVERSAMPLE);
+        samples[HALL_MUX_CHANNELS + ch] = hall_adc_average(adc2, HALL_OVERSAMPLE);
+    }
+}
+
+// Filtering, threshold, debounce and SOCD over one full set of raw samples
+// taken at sample_us.
+static bool process_samples(const uint16_t raw_samples[], matrix_row_t current_matrix[], uint32_t sample_us) {
     bool changed = false;
-    uint32_t now = timer_read32();
+    uint8_t transitions = 0;
+    uint16_t samples[HALL_CHANNELS];
+
+    hall_trace_push(raw_samples, sample_us);
+    hall_filter_run(raw_samples, samples);
+
+    // No keys until the boot rest capture has produced thresholds
+    if (!hall_calib_update(samples, key_cal)) return false;
+    if (key_points_gen != hall_calib_generation()) update_key_points();
+    if (dks_gen != hall_dks_generation()) update_dks_keys();
     
     // Clear matrix
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         current_matrix[row] = 0;
     }
     
-    // Track raw A and D presses before SOCD cleaning
-    bool raw_a_pressed = false;
-    bool raw_d_pressed = false;
-    
-    // Debug output every 2000 scans to reduce spam
-    bool debug_this_scan = (debug_enabled && (debug_counter % 2000 == 0));
-    if (debug_this_scan) {
-        debug_print("\n=== DEBUG SCAN %lu ===\n", debug_counter);
-    }
+    // Snapshot every key now and then; printed later from housekeeping
+    bool debug_this_scan = debug_enable && (debug_counter % DEBUG_SNAPSHOT_SCANS == 0);
 
-    for (uint8_t ch = 0; ch < 16; ch++) {
-        select_mux_channel(ch);
-        
-        // Read MUX1
-        writePinLow(MUX1_EN);   // Enable MUX1
-        writePinHigh(MUX2_EN);  // Disable MUX2
-        wait_us(100);
-        
-        uint16_t adc1 = read_adc_pin(MUX1_ADC_PIN);
-        uint8_t key_idx1 = ch;
-        uint16_t threshold1 = key_thresholds[key_idx1];
-        
-        // Debug output for active channels
-        if (debug_this_scan && threshold1 > 0 && mux1_keys[ch].keycode != KC_NO) {
-            debug_print("MUX1 CH%d: ADC=%d, Thresh=%d, Key=%d\n", 
-                        ch, adc1, threshold1, mux1_keys[ch].keycode);
-        }
+    // Depth of every key for hall_analog.c, from the same samples, and
+    // travel for the MIDI velocity estimator
+    hall_analog_t analog = {.time_us = sample_us};
+    uint16_t key_travel[HALL_ANALOG_KEYS] = {0};
 
-        // Process MUX1 key
-        if (threshold1 > 0 && mux1_keys[ch].keycode != KC_NO && mux1_keys[ch].row != 255) {
-            bool should_press = (adc1 > threshold1);
+    for (uint8_t k = 0; k < HALL_KEY_COUNT; k++) {
+        const hall_key_t *key = &hall_keys[k];
+        uint8_t idx = key->ch;
+        uint16_t adc = samples[idx];
+        uint16_t travel = hall_travel(&key_cal[idx], adc);
 
-            // Detect raw A/D
-            if (mux1_keys[ch].keycode == KC_A && should_press) raw_a_pressed = true;
-            if (mux1_keys[ch].keycode == KC_D && should_press) raw_d_pressed = true;
+        key_travel[key->pos] = travel;
+        analog.depth[key->pos] = travel >= HALL_TRAVEL_MAX ? 255 : (uint32_t)travel * 255 / HALL_TRAVEL_MAX;
 
-            // Debug key state changes
-            if (debug_this_scan && should_press != key_pressed[key_idx1]) {
-                debug_print("MUX1 CH%d Key %d: %s (ADC=%d vs Thresh=%d)\n", 
-                            ch, mux1_keys[ch].keycode, 
-                            should_press ? "PRESS" : "RELEASE", adc1, threshold1);
-            }
+        bool should_press = rapid_trigger_enabled
+                                ? rapid_trigger_state(idx, travel, key_thresholds[idx])
+                                : hysteresis_state(idx, adc);
 
-            // Debounce check
-            if (timer_elapsed32(key_timer[key_idx1]) > DEBOUNCE_MS) {
-                if (should_press != key_pressed[key_idx1]) {
-                    key_pressed[key_idx1] = should_press;
-                    key_timer[key_idx1] = now;
-                    changed = true;
-                }
-            }
-            
-            // Only set non-A/D keys in the matrix here
-            if (key_pressed[key_idx1] && mux1_keys[ch].keycode != KC_A && mux1_keys[ch].keycode != KC_D) {
-                current_matrix[mux1_keys[ch].row] |= (1 << mux1_keys[ch].col);
-            }
-        }
-        
-        // Read MUX2
-        writePinHigh(MUX1_EN);  // Disable MUX1
-        writePinLow(MUX2_EN);   // Enable MUX2
-        wait_us(100);
-        
-        uint16_t adc2 = read_adc_pin(MUX2_ADC_PIN);
-        uint8_t key_idx2 = 16 + ch;
-        uint16_t threshold2 = key_thresholds[key_idx2];
-        
-        // Debug output for active channels
-        if (debug_this_scan && threshold2 > 0 && mux2_keys[ch].keycode != KC_NO) {
-            debug_print("MUX2 CH%d: ADC=%d, Thresh=%d, Key=%d\n", 
-                        ch, adc2, threshold2, mux2_keys[ch].keycode);
+        if (debug_this_scan) hall_log(HALL_LOG_SAMPLE, idx, adc, travel, key_thresholds[idx]);
+
+        if (should_press != key_pressed[idx]) {
+            key_pressed[idx] = should_press;
+            changed = true;
+            transitions++;
+            hall_log(should_press ? HALL_LOG_PRESS : HALL_LOG_RELEASE, idx, adc, travel, 0);
         }
 
-        // Process MUX2 key
-        if (threshold2 > 0 && mux2_keys[ch].keycode != KC_NO && mux2_keys[ch].row != 255) {
-            bool should_press = (adc2 > threshold2);
+        if (key_pressed[idx]) current_matrix[key->row] |= key->mask;
+    }
 
-            // Detect raw A/D
-            if (mux2_keys[ch].keycode == KC_A && should_press) raw_a_pressed = true;
-            if (mux2_keys[ch].keycode == KC_D && should_press) raw_d_pressed = true;
+    // Dynamic Keystroke keys act through hall_dks.c, not the keymap. Keys
+    // without a DKS slot cost nothing here.
+    if (dks_count) {
+        for (uint8_t i = 0; i < dks_count; i++) hall_dks_step(&dks_keys[i], samples[dks_keys[i].ch]);
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) current_matrix[row] &= ~dks_mask[row];
+    }
 
-            // Debug key state changes
-            if (debug_this_scan && should_press != key_pressed[key_idx2]) {
-                debug_print("MUX2 CH%d Key %d: %s (ADC=%d vs Thresh=%d)\n", 
-                            ch, mux2_keys[ch].keycode, 
-                            should_press ? "PRESS" : "RELEASE", adc2, threshold2);
-            }
+    // MIDI note keys play through hall_midi.c
+    hall_midi_scan(key_travel, sample_us, current_matrix);
 
-            // Debounce check
-            if (timer_elapsed32(key_timer[key_idx2]) > DEBOUNCE_MS) {
-                if (should_press != key_pressed[key_idx2]) {
-                    key_pressed[key_idx2] = should_press;
-                    key_timer[key_idx2] = now;
-                    changed = true;
-                }
-            }
-            
-            // Only set non-A/D keys in the matrix here
-            if (key_pressed[key_idx2] && mux2_keys[ch].keycode != KC_A && mux2_keys[ch].keycode != KC_D) {
-                current_matrix[mux2_keys[ch].row] |= (1 << mux2_keys[ch].col);
-            }
-        }
-        
-        // Disable both MUXes
-        writePinHigh(MUX1_EN);
-        writePinHigh(MUX2_EN);
+    // SOCD cleaning for the groups on the active layer (socd.c)
+    socd_resolve(current_matrix);
+    hall_analog_publish(&analog);
+
+    uint32_t done_us = time_us_32();
+    while (transitions--) hall_stats_transition(sample_us, done_us);
+    last_ready_us = done_us;
+    debug_counter++;
+
+    return changed;
+}
+
+// One acquisition + processing pass into rows. Returns false when the DMA
+// engine has no new pass yet (rows untouched).
+static bool scan_once(matrix_row_t rows[], bool *changed) {
+    uint32_t start_us, sample_us;
+#ifdef HALL_DMA_ENGINE
+    if (engine_running) {
+        if (!hall_engine_poll(&snapshot)) return false;
+        start_us = time_us_32();
+        memcpy(adc_samples, snapshot.adc, sizeof(adc_samples));
+        sample_us = snapshot.time_us;
+    } else
+#endif
+    {
+        start_us = time_us_32();
+        sample_us = start_us;
+        read_all_channels(adc_samples);
     }
-    
-    // SOCD cleaning for A and D - Last Input Priority
-    if (raw_a_pressed && raw_d_pressed) {
-        // Both pressed - keep only the last one pressed
-        if (a_was_last) {
-            // A was pressed last, so only output A
-            for (uint8_t ch = 0; ch < 16; ch++) {
-                if (mux1_keys[ch].keycode == KC_A && key_pressed[ch]) {
-                    current_matrix[mux1_keys[ch].row] |= (1 << mux1_keys[ch].col);
-                }
-                if (mux2_keys[ch].keycode == KC_A && key_pressed[16 + ch]) {
-                    current_matrix[mux2_keys[ch].row] |= (1 << mux2_keys[ch].col);
-                }
-            }
-        } else {
-            // D was pressed last, so only output D
-            for (uint8_t ch = 0; ch < 16; ch++) {
-                if (mux1_keys[ch].keycode == KC_D && key_pressed[ch]) {
-                    current_matrix[mux1_keys[ch].row] |= (1 << mux1_keys[ch].col);
-                }
-                if (mux2_keys[ch].keycode == KC_D && key_pressed[16 + ch]) {
-                    current_matrix[mux2_keys[ch].row] |= (1 << mux2_keys[ch].col);
-                }
-            }
+    *changed = process_samples(adc_samples, rows, sample_us);
+    last_sample_us = sample_us;
+    hall_stats_scan(start_us, time_us_32());
+    return true;
+}
+
+#ifdef HALL_SCAN_RATE_HZ
+// Queue every bit where the scanned matrix differs from what the queue
+// already describes. A full queue leaves the rest for the next tick.
+static void queue_transitions(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t diff = scan_rows[row] ^ queued_rows[row];
+        while (diff) {
+            uint8_t col = __builtin_ctz(diff);
+            matrix_row_t bit = (matrix_row_t)1 << col;
+            diff &= diff - 1;
+            if (!hall_events_push(row, col, (scan_rows[row] & bit) != 0, last_sample_us, last_ready_us)) return;
+            queued_rows[row] ^= bit;
         }
-    } else if (raw_a_pressed) {
-        // Only A pressed
-        for (uint8_t ch = 0; ch < 16; ch++) {
-            if (mux1_keys[ch].keycode == KC_A && key_pressed[ch]) {
-                current_matrix[mux1_keys[ch].row] |= (1 << mux1_keys[ch].col);
-            }
-            if (mux2_keys[ch].keycode == KC_A && key_pressed[16 + ch]) {
-                current_matrix[mux2_keys[ch].row] |= (1 << mux2_keys[ch].col);
-            }
+    }
+}
+
+// One tick, due at scan_target
+static void hall_scan_tick(void) {
+    hall_stats_tick(time_us_32() - scan_target);
+
+    bool changed;
+    scan_once(scan_rows, &changed);
+    queue_transitions();
+
+    // Next tick on the fixed grid; ticks already in the past are skipped
+    scan_target += HALL_SCAN_PERIOD_US;
+    while ((int32_t)(time_us_32() - scan_target) >= 0) {
+        scan_target += HALL_SCAN_PERIOD_US;
+        hall_stats_overrun();
+    }
+}
+
+#ifndef HALL_CORE1_SCAN
+// Sleeps are rounded up to CH_CFG_ST_TIMEDELTA, which shows as tick jitter
+static THD_WORKING_AREA(hall_scan_wa, 1024);
+
+static THD_FUNCTION(hall_scan_thread, arg) {
+    (void)arg;
+    chRegSetThreadName("hall_scan");
+    for (;;) {
+        int32_t ahead = (int32_t)(scan_target - time_us_32());
+        if (ahead > 0) chThdSleep(TIME_US2I(ahead));
+        hall_scan_tick();
+    }
+}
+
+static void hall_scan_thread_start(void) {
+    scan_target = time_us_32() + HALL_SCAN_PERIOD_US;
+    chThdCreateStatic(hall_scan_wa, sizeof(hall_scan_wa), NORMALPRIO + 1, hall_scan_thread, NULL);
+}
+#endif
+#endif
+
+#ifndef HALL_SCAN_RATE_HZ
+// Hand every bit that differs between old and new to the latency tracer
+static void trace_changes(const matrix_row_t old[], const matrix_row_t new[], uint32_t sample_us, uint32_t ready_us) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t diff = old[row] ^ new[row];
+        while (diff) {
+            hall_latency_matrix(row, __builtin_ctz(diff), sample_us, ready_us);
+            diff &= diff - 1;
         }
-    } else if (raw_d_pressed) {
-        // Only D pressed  
-        for (uint8_t ch = 0; ch < 16; ch++) {
-            if (mux1_keys[ch].keycode == KC_D && key_pressed[ch]) {
-                current_matrix[mux1_keys[ch].row] |= (1 << mux1_keys[ch].col);
-            }
-            if (mux2_keys[ch].keycode == KC_D && key_pressed[16 + ch]) {
-                current_matrix[mux2_keys[ch].row] |= (1 << mux2_keys[ch].col);
-            }
+    }
+}
+#endif
+
+#ifdef HALL_CORE1_SCAN
+static void hall_core1_main(void) {
+#ifdef HALL_SCAN_RATE_HZ
+    scan_target = time_us_32() + HALL_SCAN_PERIOD_US;
+    for (;;) {
+        while ((int32_t)(scan_target - time_us_32()) > 0) {
         }
+        hall_scan_tick();
     }
-    
-    // Update SOCD state tracking
-    if (raw_a_pressed && !a_pressed) {
-        a_was_last = true; // A was just pressed
+#else
+    static hall_keystate_t state;
+    for (;;) {
+        bool changed;
+        if (!scan_once(state.rows, &changed)) continue;
+        state.scans++;
+        state.sample_us = last_sample_us;
+        state.ready_us = last_ready_us;
+        seqbuf_publish(&keystate_buf, keystate_slots, &state, sizeof(state));
+    }
+#endif
+}
+#endif
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+#if defined(HALL_SCAN_RATE_HZ)
+#ifndef HALL_CORE1_SCAN
+    // No scan thread without the engine: scan here, once per main loop pass
+    if (!engine_running) {
+        bool scanned;
+        scan_once(scan_rows, &scanned);
+        queue_transitions();
     }
-    if (raw_d_pressed && !d_pressed) {
-        a_was_last = false; // D was just pressed
+#endif
+
+    // Replay queued transitions in order. A key changes at most once per
+    // call, so a press and release between two main-loop passes both
+    // reach QMK instead of cancelling out.
+    matrix_row_t touched[MATRIX_ROWS] = {0};
+    hall_event_t event;
+    bool changed = false;
+    while (hall_events_peek(&event)) {
+        matrix_row_t bit = (matrix_row_t)1 << event.col;
+        if (touched[event.row] & bit) break;
+        touched[event.row] |= bit;
+        if (event.pressed) {
+            current_matrix[event.row] |= bit;
+        } else {
+            current_matrix[event.row] &= ~bit;
+        }
+        hall_events_pop();
+        hall_latency_matrix(event.row, event.col, event.time_us, event.ready_us);
+        changed = true;
     }
-    
-    a_pressed = raw_a_pressed;
-    d_pressed = raw_d_pressed;
-    
     return changed;
-}
\ No newline at end of file
+#elif defined(HALL_CORE1_SCAN)
+    // Lock-free: take whatever core 1 published last
+    static uint32_t consumed_gen;
+    hall_keystate_t state;
+    if (keystate_buf.gen == consumed_gen) return false;
+    consumed_gen = seqbuf_read(&keystate_buf, keystate_slots, &state, sizeof(state));
+
+    bool changed = memcmp(current_matrix, state.rows, sizeof(state.rows)) != 0;
+    if (changed) trace_changes(current_matrix, state.rows, state.sample_us, state.ready_us);
+    memcpy(current_matrix, state.rows, sizeof(state.rows));
+    return changed;
+#else
+    // Never blocks with the DMA engine: the previous matrix stays until a
+    // new pass is complete
+    matrix_row_t previous[MATRIX_ROWS];
+    memcpy(previous, current_matrix, sizeof(previous));
+    bool changed = false;
+    scan_once(current_matrix, &changed);
+    if (changed) trace_changes(previous, current_matrix, last_sample_us, last_ready_us);
+    return changed;
+#endif
+}
@@ -0,0 +1,8 @@
+/* shego_adc.h - runtime controls for the hall-effect matrix in shego_adc.c */
+#pragma once
+
+#include <stdbool.h>
+
+// Rapid Trigger (dynamic actuation) on/off for all analog keys
+void hall_set_rapid_trigger(bool enable);
+bool hall_rapid_trigger_enabled(void);
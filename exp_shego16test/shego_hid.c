@@ -0,0 +1,212 @@
+// shego_hid.c - keyboard sub-commands on the raw HID interface
+#include <string.h>
+#include "shego_hid.h"
+#include "hall_stats.h"
+#include "hall_engine.h"
+#include "hall_trace.h"
+#include "hall_events.h"
+#include "hall_latency.h"
+#include "hall_analog.h"
+#include "hall_dks.h"
+#include "hall_adc.h"
+
+static void put_u32(uint8_t *dst, uint32_t value) {
+    dst[0] = value;
+    dst[1] = value >> 8;
+    dst[2] = value >> 16;
+    dst[3] = value >> 24;
+}
+
+static void reply_stats(uint8_t *payload) {
+    hall_stats_t stats;
+    hall_stats_read(&stats);
+
+    put_u32(&payload[0], stats.scans);
+    put_u32(&payload[4], stats.scan_rate);
+    put_u32(&payload[8], stats.scans ? stats.scan_us_sum / stats.scans : 0);
+    put_u32(&payload[12], stats.scan_us_max);
+    put_u32(&payload[16], stats.stall_us_max);
+    put_u32(&payload[20], stats.transitions);
+#ifdef HALL_DMA_ENGINE
+    put_u32(&payload[24], hall_engine_scan_period_us());
+#else
+    put_u32(&payload[24], 0);
+#endif
+}
+
+static void reply_stats_sched(uint8_t *payload) {
+    hall_stats_t stats;
+    hall_stats_read(&stats);
+
+    put_u32(&payload[0], stats.ticks);
+    put_u32(&payload[4], stats.ticks ? stats.jitter_us_sum / stats.ticks : 0);
+    put_u32(&payload[8], stats.jitter_us_max);
+    put_u32(&payload[12], stats.overruns);
+#ifdef HALL_SCAN_RATE_HZ
+    put_u32(&payload[16], 1000000 / HALL_SCAN_RATE_HZ);
+#else
+    put_u32(&payload[16], 0);
+#endif
+    put_u32(&payload[20], hall_events_high_water());
+}
+
+// [0] first bucket, [1] bucket count, then up to 7 counts
+static void reply_stats_hist(uint8_t *payload) {
+    hall_stats_t stats;
+    hall_stats_read(&stats);
+
+    uint8_t first = payload[0] < HALL_STATS_BUCKETS ? payload[0] : HALL_STATS_BUCKETS;
+    uint8_t count = HALL_STATS_BUCKETS - first;
+    if (count > 7) count = 7;
+    payload[0] = first;
+    payload[1] = count;
+    for (uint8_t i = 0; i < count; i++) {
+        put_u32(&payload[2 + i * 4], stats.latency[first + i]);
+    }
+}
+
+// [0] stage, [1] first bucket, [2] bucket count, then up to 6 counts from [4]
+static bool reply_latency(uint8_t *payload) {
+    if (payload[0] >= HALL_LATENCY_STAGES) return false;
+    const uint32_t *hist = hall_latency_hist(payload[0]);
+
+    uint8_t first = payload[1] < HALL_STATS_BUCKETS ? payload[1] : HALL_STATS_BUCKETS;
+    uint8_t count = HALL_STATS_BUCKETS - first;
+    if (count > 6) count = 6;
+    payload[1] = first;
+    payload[2] = count;
+    for (uint8_t i = 0; i < count; i++) {
+        put_u32(&payload[4 + i * 4], hist[first + i]);
+    }
+    return true;
+}
+
+// [0] traced transitions, [4] records without a report, [8] stages, [9] buckets
+static void reply_latency_info(uint8_t *payload) {
+    put_u32(&payload[0], hall_latency_traced());
+    put_u32(&payload[4], hall_latency_unreported());
+    payload[8] = HALL_LATENCY_STAGES;
+    payload[9] = HALL_STATS_BUCKETS;
+}
+
+// [0] dropped entries (u32), [4] entries waiting (u16), [6] capturing
+static void reply_trace_status(uint8_t *payload) {
+    uint16_t pending = hall_trace_pending();
+    put_u32(&payload[0], hall_trace_dropped());
+    payload[4] = pending;
+    payload[5] = pending >> 8;
+    payload[6] = hall_trace_active();
+}
+
+// [0] sample time (u32), [4] depth per key (row * MATRIX_COLS + col), 0..255
+static bool reply_analog(uint8_t *payload) {
+    hall_analog_t snapshot;
+    if (!hall_analog_read(&snapshot)) return false;
+    put_u32(&payload[0], snapshot.time_us);
+    memcpy(&payload[4], snapshot.depth, HALL_ANALOG_KEYS);
+    return true;
+}
+
+// In: [0] axis, [1] non-zero to set, [2] pos key, [3] neg key.
+// Out: the axis mapping after the request.
+static bool reply_analog_axis(uint8_t *payload) {
+    if (payload[1] && !hall_analog_set_axis(payload[0], payload[2], payload[3])) return false;
+    return hall_analog_get_axis(payload[0], &payload[2], &payload[3]);
+}
+
+// Dynamic Keystroke slot: [0] slot, [1] key, [2] point 1, [3] point 2,
+// [4..7] actions per binding, [8..15] keycodes (u16)
+static bool reply_dks_get(uint8_t *payload) {
+    hall_dks_slot_t slot;
+    if (!hall_dks_get(payload[0], &slot)) return false;
+    payload[1] = slot.key;
+    payload[2] = slot.point[0];
+    payload[3] = slot.point[1];
+    for (uint8_t b = 0; b < HALL_DKS_BINDINGS; b++) {
+        payload[4 + b] = slot.actions[b];
+        payload[8 + b * 2] = slot.keycode[b];
+        payload[9 + b * 2] = slot.keycode[b] >> 8;
+    }
+    return true;
+}
+
+static bool reply_dks_set(uint8_t *payload) {
+    hall_dks_slot_t slot;
+    slot.key = payload[1];
+    slot.point[0] = payload[2];
+    slot.point[1] = payload[3];
+    for (uint8_t b = 0; b < HALL_DKS_BINDINGS; b++) {
+        slot.actions[b] = payload[4 + b];
+        slot.keycode[b] = payload[8 + b * 2] | payload[9 + b * 2] << 8;
+    }
+    return hall_dks_set(payload[0], &slot) && reply_dks_get(payload);
+}
+
+// In: [0] non-zero to set, [1..4] extra width per wide code. Out: the widths in use.
+static void reply_adc_dnl(uint8_t *payload) {
+    hall_adc_config_t adc;
+    if (payload[0]) {
+        memcpy(adc.extra, &payload[1], HALL_ADC_WIDE_CODES);
+        hall_adc_set(&adc);
+    }
+    hall_adc_get(&adc);
+    memcpy(&payload[1], adc.extra, HALL_ADC_WIDE_CODES);
+}
+
+bool shego_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 32 || data[0] != SHEGO_HID_MAGIC) return false;
+    if (data[1] < SHEGO_HID_FIRST || data[1] > SHEGO_HID_LAST) return false;
+
+    uint8_t *payload = &data[2];
+    switch (data[1]) {
+        case SHEGO_HID_STATS:
+            reply_stats(payload);
+            break;
+        case SHEGO_HID_STATS_HIST:
+            reply_stats_hist(payload);
+            break;
+        case SHEGO_HID_STATS_SCHED:
+            reply_stats_sched(payload);
+            break;
+        case SHEGO_HID_STATS_RESET:
+            hall_stats_reset();
+            break;
+        case SHEGO_HID_LATENCY:
+            if (!reply_latency(payload)) data[1] = SHEGO_HID_ERROR;
+            break;
+        case SHEGO_HID_LATENCY_INFO:
+            reply_latency_info(payload);
+            break;
+        case SHEGO_HID_LATENCY_RESET:
+            hall_latency_reset();
+            break;
+        case SHEGO_HID_TRACE_START:
+            if (payload[0] > length - 3 || !hall_trace_start(&payload[1], payload[0])) data[1] = SHEGO_HID_ERROR;
+            break;
+        case SHEGO_HID_TRACE_STOP:
+            hall_trace_stop();
+            break;
+        case SHEGO_HID_TRACE_STATUS:
+            reply_trace_status(payload);
+            break;
+        case SHEGO_HID_ANALOG:
+            if (!reply_analog(payload)) data[1] = SHEGO_HID_ERROR;
+            break;
+        case SHEGO_HID_ANALOG_AXIS:
+            if (!reply_analog_axis(payload)) data[1] = SHEGO_HID_ERROR;
+            break;
+        case SHEGO_HID_DKS_GET:
+            if (!reply_dks_get(payload)) data[1] = SHEGO_HID_ERROR;
+            break;
+        case SHEGO_HID_DKS_SET:
+            if (!reply_dks_set(payload)) data[1] = SHEGO_HID_ERROR;
+            break;
+        case SHEGO_HID_ADC_DNL:
+            reply_adc_dnl(payload);
+            break;
+        default:
+            data[1] = SHEGO_HID_ERROR;
+            break;
+    }
+    return true;
+}
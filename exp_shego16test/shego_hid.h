@@ -0,0 +1,42 @@
+/* shego_hid.h - keyboard sub-commands on the raw HID interface
+ * Packets start with SHEGO_HID_MAGIC (shared with the gif uploader protocol)
+ * and a command byte; the reply is the same 32-byte buffer, filled in place.
+ * Host side: tools/shego_hid.py.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SHEGO_HID_MAGIC 0xA5
+
+// Command bytes this module owns. Anything outside (0x10 - 0x1F: the gif
+// uploader, gif_uploader_gui.py) is passed through untouched.
+#define SHEGO_HID_FIRST 0x20
+#define SHEGO_HID_LAST 0x4F
+
+enum shego_hid_command {
+    SHEGO_HID_STATS = 0x20,       // scan summary
+    SHEGO_HID_STATS_HIST = 0x21,  // latency buckets, [2] = first bucket
+    SHEGO_HID_STATS_RESET = 0x22,
+    SHEGO_HID_STATS_SCHED = 0x23,  // fixed-rate scheduler jitter
+    SHEGO_HID_LATENCY = 0x24,      // stage buckets, [2] = stage, [3] = first bucket
+    SHEGO_HID_LATENCY_INFO = 0x25,
+    SHEGO_HID_LATENCY_RESET = 0x26,
+    SHEGO_HID_TRACE_START = 0x30,  // [2] channel count, [3..] channels
+    SHEGO_HID_TRACE_STOP = 0x31,
+    SHEGO_HID_TRACE_STATUS = 0x32,
+    SHEGO_HID_TRACE_DATA = 0x33,   // device -> host only (hall_trace.h)
+    SHEGO_HID_ANALOG = 0x40,       // depth of every key (hall_analog.h)
+    SHEGO_HID_ANALOG_AXIS = 0x41,  // [2] axis, [3] set?, [4] pos key, [5] neg key
+    SHEGO_HID_DKS_GET = 0x42,      // [2] slot
+    SHEGO_HID_DKS_SET = 0x43,      // [2] slot, then the slot as returned by DKS_GET
+    SHEGO_HID_ADC_DNL = 0x44,      // [2] set?, [3..6] wide code extra widths (1/16 LSB)
+};
+
+#define SHEGO_HID_ERROR 0xFF  // replaces the command byte when a command fails or is unknown
+
+// Handle a packet if it carries SHEGO_HID_MAGIC and an owned command byte.
+// Returns false for anything else (gif uploader, RGB streaming, VIA) so the
+// caller can pass it on.
+bool shego_hid_receive(uint8_t *data, uint8_t length);
@@ -0,0 +1,137 @@
+// socd.c - table-driven SOCD groups with per-layer modes
+#include "socd.h"
+#include "shego16.h"
+#include "seqbuf.h"
+
+// Keycode groups; the first keycode of each group wins in SOCD_PRIORITY
+#ifndef SOCD_GROUPS
+#define SOCD_GROUPS {{KC_A, KC_D}, {KC_W, KC_S}}
+#endif
+
+static const uint16_t socd_group_keys[][SOCD_MAX_KEYS] = SOCD_GROUPS;
+#define SOCD_GROUP_COUNT (sizeof(socd_group_keys) / sizeof(socd_group_keys[0]))
+_Static_assert(SOCD_GROUP_COUNT <= SOCD_MAX_GROUPS, "too many SOCD_GROUPS");
+_Static_assert(MATRIX_ROWS * MATRIX_COLS <= 16, "SOCD bitmaps are 16 bits");
+
+// Resolved groups for the active layers. Bit (row * MATRIX_COLS + col).
+typedef struct {
+    uint16_t members[SOCD_MAX_GROUPS];
+    uint16_t priority[SOCD_MAX_GROUPS];
+    uint8_t mode[SOCD_MAX_GROUPS];
+} socd_table_t;
+
+// Published by core 0, consumed by the scanner (possibly on core 1)
+static seqbuf_t table_buf;
+static socd_table_t table_slots[2];
+static bool table_dirty;
+
+// Scanner side
+static socd_table_t table;
+static uint32_t table_gen;
+static uint16_t prev_held[SOCD_MAX_GROUPS];
+static uint16_t last_bit[SOCD_MAX_GROUPS];
+static uint16_t first_bit[SOCD_MAX_GROUPS];
+
+void socd_config_defaults(socd_config_t *config) {
+    memset(config, SOCD_OFF, sizeof(*config));
+    // A/D last-input on every layer, as the board always shipped
+    for (uint8_t layer = 0; layer < SOCD_LAYERS; layer++) {
+        config->mode[layer][0] = SOCD_LAST_INPUT;
+    }
+}
+
+void socd_refresh(layer_state_t state) {
+    socd_table_t t = {0};
+    layer_state_t layers = state | default_layer_state;
+    uint8_t top = get_highest_layer(layers);
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            keypos_t pos = {.row = row, .col = col};
+            uint16_t keycode = kb_effective_keycode(layers, pos);
+            uint16_t bit = 1u << (row * MATRIX_COLS + col);
+            for (uint8_t g = 0; g < SOCD_GROUP_COUNT; g++) {
+                for (uint8_t i = 0; i < SOCD_MAX_KEYS; i++) {
+                    if (socd_group_keys[g][i] == KC_NO || socd_group_keys[g][i] != keycode) continue;
+                    t.members[g] |= bit;
+                    if (i == 0) t.priority[g] |= bit;
+                }
+            }
+        }
+    }
+    for (uint8_t g = 0; g < SOCD_GROUP_COUNT; g++) {
+        t.mode[g] = top < SOCD_LAYERS ? kb_config.socd.mode[top][g] : SOCD_OFF;
+    }
+
+    seqbuf_publish(&table_buf, table_slots, &t, sizeof(t));
+    table_dirty = false;
+}
+
+void socd_mark_dirty(void) {
+    table_dirty = true;
+}
+
+void socd_task(void) {
+    if (table_dirty) socd_refresh(layer_state);
+}
+
+uint8_t socd_get_mode(uint8_t layer, uint8_t group) {
+    if (layer >= SOCD_LAYERS || group >= SOCD_MAX_GROUPS) return SOCD_OFF;
+    return kb_config.socd.mode[layer][group];
+}
+
+void socd_set_mode(uint8_t layer, uint8_t group, uint8_t mode) {
+    if (layer >= SOCD_LAYERS || group >= SOCD_MAX_GROUPS || mode >= SOCD_MODE_COUNT) return;
+    kb_config.socd.mode[layer][group] = mode;
+    socd_mark_dirty();
+}
+
+void socd_resolve(matrix_row_t matrix[]) {
+    if (table_buf.gen != table_gen) {
+        table_gen = seqbuf_read(&table_buf, table_slots, &table, sizeof(table));
+    }
+
+    uint16_t bits = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        bits |= (uint16_t)matrix[row] << (row * MATRIX_COLS);
+    }
+
+    uint16_t drop = 0;
+    for (uint8_t g = 0; g < SOCD_GROUP_COUNT; g++) {
+        uint16_t held = bits & table.members[g];
+        uint16_t pressed = held & ~prev_held[g];
+        prev_held[g] = held;
+
+        // x & -x isolates the lowest set bit
+        if (pressed) last_bit[g] = pressed & -pressed;
+        if (!(held & first_bit[g])) first_bit[g] = pressed ? (pressed & -pressed) : (held & -held);
+
+        if (!(held & (held - 1))) continue;  // fewer than two held
+
+        uint16_t keep;
+        switch (table.mode[g]) {
+            case SOCD_LAST_INPUT:
+                // Once the last key is released the lowest remaining one wins
+                keep = (held & last_bit[g]) ? last_bit[g] : (held & -held);
+                break;
+            case SOCD_FIRST_INPUT:
+                keep = first_bit[g];
+                break;
+            case SOCD_NEUTRAL:
+                keep = 0;
+                break;
+            case SOCD_PRIORITY:
+                keep = (held & table.priority[g]) ? (held & table.priority[g]) : (held & -held);
+                break;
+            default:
+                keep = held;
+                break;
+        }
+        drop |= held & ~keep;
+    }
+
+    if (!drop) return;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix[row] &= ~(matrix_row_t)((drop >> (row * MATRIX_COLS)) & ((1u << MATRIX_COLS) - 1));
+    }
+}
@@ -0,0 +1,43 @@
+/* socd.h - table-driven SOCD (simultaneous opposing cardinal directions)
+ * Groups are lists of keycodes (SOCD_GROUPS). Core 0 resolves them against
+ * the active keymap into matrix bitmaps whenever layers or the keymap change;
+ * the scanner then cleans each freshly built matrix with a handful of mask
+ * operations per group. The mode of every group is configured per layer
+ * (VIA custom menu, persisted with the rest of kb_config).
+ */
+#pragma once
+
+#include "quantum.h"
+
+#define SOCD_MAX_GROUPS 4  // groups stored per layer in kb_config
+#define SOCD_MAX_KEYS 4    // keycodes per group
+#define SOCD_LAYERS 4      // layers with their own SOCD settings
+
+typedef enum {
+    SOCD_OFF,
+    SOCD_LAST_INPUT,   // most recent press wins
+    SOCD_FIRST_INPUT,  // key held first wins until released
+    SOCD_NEUTRAL,      // opposing keys cancel out
+    SOCD_PRIORITY,     // first keycode of the group always wins
+    SOCD_MODE_COUNT
+} socd_mode_t;
+
+typedef struct {
+    uint8_t mode[SOCD_LAYERS][SOCD_MAX_GROUPS];
+} socd_config_t;
+
+void socd_config_defaults(socd_config_t *config);
+
+// Core 0: rebuild the group bitmaps for a layer state
+void socd_refresh(layer_state_t state);
+
+// Core 0: keymap or settings changed, rebuild on the next socd_task()
+void socd_mark_dirty(void);
+void socd_task(void);
+
+// Per-layer mode accessors (VIA)
+uint8_t socd_get_mode(uint8_t layer, uint8_t group);
+void socd_set_mode(uint8_t layer, uint8_t group, uint8_t mode);
+
+// Scanner: clean a freshly built matrix in place
+void socd_resolve(matrix_row_t matrix[]);
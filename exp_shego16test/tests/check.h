@@ -0,0 +1,28 @@
+/* check.h - assertions for the host tests
+ * A failed CHECK prints where and why and the test carries on;
+ * check_report() prints the verdict and gives the exit status.
+ */
+#pragma once
+
+#include <stdio.h>
+
+static unsigned check_failures;
+
+#define CHECK(cond, ...)                                                            \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            check_failures++;                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s: ", __FILE__, __LINE__, #cond); \
+            fprintf(stderr, __VA_ARGS__);                                           \
+            fputc('\n', stderr);                                                    \
+        }                                                                           \
+    } while (0)
+
+static inline int check_report(const char *name) {
+    if (check_failures) {
+        printf("%s: %u checks failed\n", name, check_failures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
@@ -0,0 +1,374 @@
+// host_sim.c - virtual clock, cores and the QMK/ChibiOS mocks (host_sim.h)
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <math.h>
+#include <ucontext.h>
+#include "host_sim.h"
+#include "quantum.h"
+#include "debug.h"
+#include "host.h"
+#include "raw_hid.h"
+#include "qmk_midi.h"
+#include "hardware/timer.h"
+#include "hardware/gpio.h"
+#include "shego16.h"
+#include "hall_engine.h"
+
+#define SIM_STACK_SIZE (256 * 1024)
+
+// Board pins
+#define MUX_SELECT_SHIFT 10
+#define MUX_SELECT_MASK (0xFu << MUX_SELECT_SHIFT)
+#define MUX1_EN_BIT (1u << 14)
+#define MUX2_EN_BIT (1u << 15)
+
+sim_params_t sim_params = {
+    .tau_us = 2.0,
+    .adc_us = 2.0,
+    .gpio_us = 0.1,
+    .poll_us = 0.2,
+    .process_us = 25.0,
+    .irq_us = 1.0,
+    .adc_dnl = HALL_ADC_DNL_DEFAULT,
+};
+
+static double flat_sensor(uint8_t ch, double t) {
+    (void)ch;
+    (void)t;
+    return 2048.0;
+}
+
+static uint16_t default_keycode(uint8_t row, uint8_t col) {
+    (void)row;
+    (void)col;
+    return KC_A;
+}
+
+double (*sim_sensor)(uint8_t ch, double t) = flat_sensor;
+uint16_t (*sim_keycode)(uint8_t row, uint8_t col) = default_keycode;
+void (*sim_config_load)(void);
+void (*sim_midi_note)(uint8_t note, uint8_t velocity);
+void (*sim_raw_hid_send)(const uint8_t *data, uint8_t length);
+bool sim_verbose;
+
+// Clocks and contexts. Core 0 runs the main loop (the process's own
+// context) or the ChibiOS thread; core 1 runs once launched.
+static double cpu_clock[2];
+static uint8_t cpu;
+static ucontext_t main_ctx;
+static ucontext_t thread_ctx;
+static ucontext_t core1_ctx;
+static ucontext_t *cpu_ctx[2] = {&main_ctx, NULL};
+static bool core1_running;
+
+static bool thread_created;
+static double thread_wake;
+static tfunc_t thread_fn;
+static void *thread_arg;
+
+static bool in_irq;
+static double irq_clock;
+
+double sim_now(void) {
+    return in_irq ? irq_clock : cpu_clock[cpu];
+}
+
+void sim_irq_enter(double t) {
+    in_irq = true;
+    irq_clock = t;
+}
+
+void sim_irq_exit(void) {
+    in_irq = false;
+}
+
+static void switch_cpu(uint8_t to) {
+    ucontext_t *from = cpu_ctx[cpu];
+    cpu = to;
+    swapcontext(from, cpu_ctx[to]);
+}
+
+// Let the other core catch up once this one is a quantum ahead
+static void balance(void) {
+    if (!core1_running) return;
+    uint8_t other = cpu ^ 1;
+    if (cpu_clock[cpu] > cpu_clock[other] + SIM_QUANTUM_US) switch_cpu(other);
+}
+
+// Time is spent a quantum at a time so the cores never drift further apart.
+// The scan thread preempts the main loop when its sleep ends; the main
+// loop's remaining time is spent after it sleeps again.
+void sim_cpu(double us) {
+    if (in_irq) return;
+    double left = us;
+    do {
+        uint8_t core = cpu;
+        double step = fmin(left, SIM_QUANTUM_US);
+        if (core == 0 && thread_created && cpu_ctx[0] == &main_ctx && thread_wake < cpu_clock[0] + step) {
+            double run = fmax(0.0, thread_wake - cpu_clock[0]);
+            cpu_clock[0] += run;
+            left -= run;
+            rp2040_sim_advance(cpu_clock[0]);
+            cpu_ctx[0] = &thread_ctx;
+            swapcontext(&main_ctx, &thread_ctx);
+            continue;
+        }
+        cpu_clock[core] += step;
+        left -= step;
+        if (core == 0) rp2040_sim_advance(cpu_clock[0]);
+        balance();
+    } while (left > 1e-9);
+}
+
+static void *sim_stack(void) {
+    void *stack = malloc(SIM_STACK_SIZE);
+    if (!stack) abort();
+    return stack;
+}
+
+static void thread_entry(void) {
+    thread_fn(thread_arg);
+    fprintf(stderr, "host_sim: thread returned\n");
+    exit(1);
+}
+
+thread_t *chThdCreateStatic(void *wsp, size_t size, tprio_t prio, tfunc_t pf, void *arg) {
+    (void)wsp;
+    (void)size;
+    (void)prio;
+    thread_fn = pf;
+    thread_arg = arg;
+    getcontext(&thread_ctx);
+    thread_ctx.uc_stack.ss_sp = sim_stack();
+    thread_ctx.uc_stack.ss_size = SIM_STACK_SIZE;
+    thread_ctx.uc_link = NULL;
+    makecontext(&thread_ctx, thread_entry, 0);
+    thread_created = true;
+    thread_wake = cpu_clock[0];
+    return NULL;
+}
+
+void chThdSleep(sysinterval_t time) {
+    thread_wake = cpu_clock[0] + time;
+    cpu_ctx[0] = &main_ctx;
+    swapcontext(&thread_ctx, &main_ctx);
+}
+
+void chRegSetThreadName(const char *name) {
+    (void)name;
+}
+
+static void (*core1_fn)(void);
+
+static void core1_entry(void) {
+    core1_fn();
+    fprintf(stderr, "host_sim: core 1 returned\n");
+    exit(1);
+}
+
+void sim_core1_start(void (*entry)(void)) {
+    core1_fn = entry;
+    getcontext(&core1_ctx);
+    core1_ctx.uc_stack.ss_sp = sim_stack();
+    core1_ctx.uc_stack.ss_size = SIM_STACK_SIZE;
+    core1_ctx.uc_link = NULL;
+    makecontext(&core1_ctx, core1_entry, 0);
+    cpu_ctx[1] = &core1_ctx;
+    cpu_clock[1] = cpu_clock[0];
+    core1_running = true;
+}
+
+// Analog front end. A disabled mux holds its last level; enabling or
+// reselecting starts a settle from wherever the output was.
+typedef struct {
+    int8_t sel;   // selected channel, -1 while disabled
+    double t_sw;  // last switch
+    double v_sw;  // output level at the switch
+} sim_mux_t;
+
+static sim_mux_t muxes[2] = {{0, -INFINITY, 0.0}, {0, -INFINITY, 0.0}};
+static uint32_t pins;
+
+double sim_mux_output(uint8_t mux, double t) {
+    const sim_mux_t *m = &muxes[mux];
+    if (m->sel < 0) return m->v_sw;
+    double target = sim_sensor(mux * HALL_MUX_CHANNELS + m->sel, t);
+    if (m->t_sw == -INFINITY) return target;
+    return target + (m->v_sw - target) * exp(-(t - m->t_sw) / sim_params.tau_us);
+}
+
+static void set_pins(uint32_t mask, uint32_t value) {
+    double t = sim_now();
+    pins = (pins & ~mask) | (value & mask);
+    for (uint8_t mux = 0; mux < 2; mux++) {
+        bool enabled = !(pins & (mux ? MUX2_EN_BIT : MUX1_EN_BIT));
+        int8_t sel = enabled ? (int8_t)((pins & MUX_SELECT_MASK) >> MUX_SELECT_SHIFT) : -1;
+        sim_mux_t *m = &muxes[mux];
+        if (sel == m->sel) continue;
+        m->v_sw = sim_mux_output(mux, t);
+        m->sel = sel;
+        m->t_sw = t;
+    }
+}
+
+// QMK
+layer_state_t layer_state;
+layer_state_t default_layer_state = 1;
+bool debug_enable;
+struct MidiDevice {
+    uint8_t unused;
+} midi_device;
+
+void setPinOutput(pin_t pin) {
+    (void)pin;
+}
+
+void setPinInputHigh(pin_t pin) {
+    (void)pin;
+}
+
+void palSetLineMode(uint32_t line, uint32_t mode) {
+    (void)line;
+    (void)mode;
+}
+
+void writePin(pin_t pin, bool level) {
+    sim_cpu(sim_params.gpio_us);
+    set_pins(1u << pin, level ? 1u << pin : 0);
+}
+
+void writePinHigh(pin_t pin) {
+    writePin(pin, true);
+}
+
+void writePinLow(pin_t pin) {
+    writePin(pin, false);
+}
+
+void gpio_put_masked(uint32_t mask, uint32_t value) {
+    sim_cpu(sim_params.gpio_us);
+    set_pins(mask, value);
+}
+
+// GP29 = ADC3 (MUX1), GP28 = ADC2 (MUX2)
+uint16_t analogReadPin(pin_t pin) {
+    sim_cpu(sim_params.adc_us);
+    return rp2040_sim_convert(pin == GP29 ? 3 : pin == GP28 ? 2 : 0, sim_now());
+}
+
+void wait_us(uint32_t us) {
+    sim_cpu(us);
+}
+
+void wait_ms(uint32_t ms) {
+    sim_cpu(ms * 1000.0);
+}
+
+uint32_t time_us_32(void) {
+    sim_cpu(sim_params.poll_us);
+    return (uint32_t)(uint64_t)sim_now();
+}
+
+uint32_t timer_read32(void) {
+    sim_cpu(sim_params.poll_us);
+    return (uint32_t)(uint64_t)(sim_now() / 1000.0);
+}
+
+uint16_t timer_read(void) {
+    return (uint16_t)timer_read32();
+}
+
+uint32_t timer_elapsed32(uint32_t last) {
+    return timer_read32() - last;
+}
+
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(timer_read() - last);
+}
+
+// Core 1 spinning on the engine touches no other mock, so the poll is
+// charged here (linked with --wrap=hall_engine_poll)
+bool __real_hall_engine_poll(hall_snapshot_t *out);
+
+bool __wrap_hall_engine_poll(hall_snapshot_t *out) {
+    sim_cpu(sim_params.poll_us);
+    return __real_hall_engine_poll(out);
+}
+
+int uprintf(const char *fmt, ...) {
+    if (!sim_verbose) return 0;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    return n;
+}
+
+void tap_code16(uint16_t keycode) {
+    (void)keycode;
+}
+
+void register_code16(uint16_t keycode) {
+    (void)keycode;
+}
+
+void unregister_code16(uint16_t keycode) {
+    (void)keycode;
+}
+
+void raw_hid_send(uint8_t *data, uint8_t length) {
+    if (sim_raw_hid_send) sim_raw_hid_send(data, length);
+}
+
+host_driver_t *host_get_driver(void) {
+    return NULL;
+}
+
+void host_set_driver(host_driver_t *driver) {
+    (void)driver;
+}
+
+void midi_send_noteon(MidiDevice *device, uint8_t chan, uint8_t num, uint8_t vel) {
+    (void)device;
+    (void)chan;
+    if (sim_midi_note) sim_midi_note(num, vel);
+}
+
+void midi_send_noteoff(MidiDevice *device, uint8_t chan, uint8_t num, uint8_t vel) {
+    (void)device;
+    (void)chan;
+    (void)vel;
+    if (sim_midi_note) sim_midi_note(num, 0);
+}
+
+void midi_send_aftertouch(MidiDevice *device, uint8_t chan, uint8_t note_num, uint8_t amt) {
+    (void)device;
+    (void)chan;
+    (void)note_num;
+    (void)amt;
+}
+
+// Keyboard level (shego16.c, socd.c)
+kb_config_t kb_config;
+
+void kb_config_load(void) {
+    memset(&kb_config, 0, sizeof(kb_config));
+    kb_config.magic = EECONFIG_KB_DATA_VERSION;
+    hall_analog_config_defaults(&kb_config.analog);
+    hall_dks_config_defaults(&kb_config.dks);
+    hall_adc_config_defaults(&kb_config.adc);
+    if (sim_config_load) sim_config_load();
+}
+
+void kb_config_save(void) {}
+
+uint16_t kb_effective_keycode(layer_state_t layers, keypos_t pos) {
+    (void)layers;
+    return sim_keycode(pos.row, pos.col);
+}
+
+void socd_resolve(matrix_row_t matrix[]) {
+    (void)matrix;
+    sim_cpu(sim_params.process_us);
+}
@@ -0,0 +1,76 @@
+/* host_sim.h - a simulated RP2040 board for running the firmware sources on
+ * the host
+ * The mocks in mock/ stand in for QMK, ChibiOS and the pico-sdk headers.
+ * Everything runs on a virtual clock in microseconds: each core is a
+ * coroutine with its own clock, and whichever core gets more than
+ * SIM_QUANTUM_US ahead hands over to the other. A ChibiOS thread preempts
+ * the core 0 main loop once its sleep ends. Every mock call costs the
+ * modelled time in sim_params, so blocking reads, busy-waits and polling
+ * loops advance the clock of the core that makes them.
+ *
+ * The analog front end is the board's: two 16-channel muxes on ADC3 (MUX1,
+ * GP29) and ADC2 (MUX2, GP28), select lines GP10..GP13 and active-low
+ * enables GP14/GP15. A mux output settles towards the selected sensor as a
+ * first-order RC; the sensor levels come from sim_sensor. The ADC has the
+ * RP2040's wide codes (rp2040_sim.c), the DMA engine and the core 1 launch
+ * handshake run against emulated registers.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Most one core's clock may run ahead of the other's
+#define SIM_QUANTUM_US 5.0
+
+typedef struct {
+    double tau_us;      // mux output settle time constant
+    double adc_us;      // one analogReadPin() (QMK driver)
+    double gpio_us;     // one writePin() / gpio_put_masked()
+    double poll_us;     // one timer or engine poll, a WFE
+    double process_us;  // process_samples() work besides the mocked calls, charged in socd_resolve()
+    double irq_us;      // DMA completion to IRQ handler entry
+    uint8_t adc_dnl;    // extra width of the ADC's wide codes, 1/16 LSB
+} sim_params_t;
+
+extern sim_params_t sim_params;
+
+// Sensor level of channel ch (MUX1 0..15, MUX2 16..31) at time t, in ADC
+// counts. Defaults to a flat mid-scale level.
+extern double (*sim_sensor)(uint8_t ch, double t);
+
+// Layer 0 keycode at row/col (kb_effective_keycode()), KC_A by default
+extern uint16_t (*sim_keycode)(uint8_t row, uint8_t col);
+
+// Called from kb_config_load() once the defaults are in place, e.g. to
+// store a calibration
+extern void (*sim_config_load)(void);
+
+// MIDI messages sent by core 0 (velocity 0 = note off)
+extern void (*sim_midi_note)(uint8_t note, uint8_t velocity);
+
+// Raw HID reports sent by the firmware
+extern void (*sim_raw_hid_send)(const uint8_t *data, uint8_t length);
+
+// Print the firmware's uprintf() output on stderr
+extern bool sim_verbose;
+
+// Clock of the running core (or of the IRQ being served), in us
+double sim_now(void);
+
+// The running core spends us of CPU time; lets the other core and due
+// thread wakeups and IRQs run
+void sim_cpu(double us);
+
+// Sensor level behind a mux (0 = MUX1, 1 = MUX2) as its output reads at t
+double sim_mux_output(uint8_t mux, double t);
+
+// rp2040_sim.c: run the free-running ADC, DMA and due IRQs up to core 0
+// time t, and start core 1 (from the SIO launch handshake)
+void rp2040_sim_advance(double t);
+uint16_t rp2040_sim_convert(uint8_t input, double t);
+void sim_core1_start(void (*entry)(void));
+
+// IRQ context: handler time is not modelled, mocks called from it see t
+void sim_irq_enter(double t);
+void sim_irq_exit(void);
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "quantum.h"
+
+extern bool debug_enable;
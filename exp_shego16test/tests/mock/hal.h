@@ -0,0 +1,55 @@
+/* hal.h - ChibiOS pieces used by the scan code, for host builds
+ * The DMA allocator and its IRQ dispatch live in rp2040_sim.c, the thread
+ * and the Cortex-M intrinsics in host_sim.c. System ticks are 1 us.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// DMA (RP2040 LLD)
+typedef void (*rp_dmaisr_t)(void *p, uint32_t ct);
+
+typedef struct {
+    uint8_t chnidx;
+    uint32_t chnmask;
+} rp_dma_channel_t;
+
+#define RP_DMA_CHANNEL_ID_ANY 12U
+#define RP_IRQ_DMA0_PRIORITY 2
+
+const rp_dma_channel_t *dmaChannelAlloc(uint32_t id, uint32_t priority, rp_dmaisr_t func, void *param);
+void dmaChannelFreeI(const rp_dma_channel_t *dmachp);
+void dmaChannelFree(const rp_dma_channel_t *dmachp);
+void dmaChannelEnableInterruptX(const rp_dma_channel_t *dmachp);
+
+// Threads
+typedef int32_t tprio_t;
+typedef uint32_t sysinterval_t;
+typedef struct sim_thread thread_t;
+typedef void (*tfunc_t)(void *arg);
+
+#define NORMALPRIO 128
+#define THD_WORKING_AREA(s, n) uint64_t s[((n) + 7) / 8]
+#define THD_FUNCTION(tname, arg) void tname(void *arg)
+#define TIME_US2I(us) ((sysinterval_t)(us))
+
+thread_t *chThdCreateStatic(void *wsp, size_t size, tprio_t prio, tfunc_t pf, void *arg);
+void chThdSleep(sysinterval_t time);
+void chRegSetThreadName(const char *name);
+
+// PAL
+#define PAL_MODE_INPUT_ANALOG 0
+void palSetLineMode(uint32_t line, uint32_t mode);
+
+// Cortex-M
+typedef struct {
+    uint32_t VTOR;
+} SCB_Type;
+
+extern SCB_Type sim_scb;
+#define SCB (&sim_scb)
+
+void __SEV(void);
+void __WFE(void);
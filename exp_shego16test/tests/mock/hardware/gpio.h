@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stdint.h>
+
+void gpio_put_masked(uint32_t mask, uint32_t value);
@@ -0,0 +1,15 @@
+#pragma once
+
+#define ADC_CS_RROBIN_LSB 16
+#define ADC_CS_RROBIN_BITS 0x001f0000u
+#define ADC_CS_AINSEL_LSB 12
+#define ADC_CS_AINSEL_BITS 0x00007000u
+#define ADC_CS_READY_BITS 0x00000100u
+#define ADC_CS_START_MANY_BITS 0x00000008u
+#define ADC_CS_START_ONCE_BITS 0x00000004u
+#define ADC_CS_EN_BITS 0x00000001u
+
+#define ADC_FCS_THRESH_LSB 24
+#define ADC_FCS_OVER_BITS 0x00000800u
+#define ADC_FCS_DREQ_EN_BITS 0x00000008u
+#define ADC_FCS_EN_BITS 0x00000001u
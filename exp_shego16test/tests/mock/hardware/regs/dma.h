@@ -0,0 +1,20 @@
+#pragma once
+
+#define DMA_CH0_CTRL_TRIG_BUSY_BITS 0x01000000u
+#define DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS 0x00200000u
+#define DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB 15
+#define DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS 0x001f8000u
+#define DMA_CH0_CTRL_TRIG_TREQ_SEL_VALUE_PERMANENT 0x3f
+#define DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB 11
+#define DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS 0x00007800u
+#define DMA_CH0_CTRL_TRIG_RING_SEL_BITS 0x00000400u
+#define DMA_CH0_CTRL_TRIG_RING_SIZE_LSB 6
+#define DMA_CH0_CTRL_TRIG_RING_SIZE_BITS 0x000003c0u
+#define DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS 0x00000020u
+#define DMA_CH0_CTRL_TRIG_INCR_READ_BITS 0x00000010u
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB 2
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS 0x0000000cu
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_VALUE_SIZE_BYTE 0x0
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_VALUE_SIZE_HALFWORD 0x1
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_VALUE_SIZE_WORD 0x2
+#define DMA_CH0_CTRL_TRIG_EN_BITS 0x00000001u
@@ -0,0 +1,3 @@
+#pragma once
+
+#define DREQ_ADC 36
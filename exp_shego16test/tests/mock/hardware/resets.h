@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+#define RESETS_RESET_ADC_BITS 0x00000001u
+
+static inline void reset_block(uint32_t bits) {
+    (void)bits;
+}
+
+static inline void unreset_block_wait(uint32_t bits) {
+    (void)bits;
+}
@@ -0,0 +1,22 @@
+/* Every access through adc_hw first brings the simulated ADC up to the
+ * caller's time (rp2040_sim.c), so polling READY advances conversions.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "hardware/regs/adc.h"
+
+typedef struct {
+    volatile uint32_t cs;
+    volatile uint32_t result;
+    volatile uint32_t fcs;
+    volatile uint32_t fifo;
+    volatile uint32_t div;
+    volatile uint32_t intr;
+    volatile uint32_t inte;
+    volatile uint32_t intf;
+    volatile uint32_t ints;
+} adc_hw_t;
+
+adc_hw_t *sim_adc_hw(void);
+#define adc_hw (sim_adc_hw())
@@ -0,0 +1,52 @@
+/* The register aliases of a channel share storage, as on the chip. CPU
+ * writes never trigger a channel (the scan code starts channels through
+ * multi_channel_trigger); a DMA write to WRITE_ADDR is taken as the
+ * AL2_WRITE_ADDR_TRIG it stands for. Accesses through dma_hw sync the
+ * simulated DMA to the caller's time first (rp2040_sim.c).
+ */
+#pragma once
+
+#include <stdint.h>
+#include "hardware/regs/dma.h"
+#include "hardware/regs/dreq.h"
+
+#define NUM_DMA_CHANNELS 12
+
+typedef struct {
+    union {
+        volatile uint32_t read_addr;
+        volatile uint32_t al1_read_addr;
+        volatile uint32_t al2_read_addr;
+        volatile uint32_t al3_read_addr_trig;
+    };
+    union {
+        volatile uint32_t write_addr;
+        volatile uint32_t al1_write_addr;
+        volatile uint32_t al2_write_addr_trig;
+        volatile uint32_t al3_write_addr;
+    };
+    union {
+        volatile uint32_t transfer_count;
+        volatile uint32_t al1_transfer_count_trig;
+        volatile uint32_t al2_transfer_count;
+        volatile uint32_t al3_transfer_count;
+    };
+    union {
+        volatile uint32_t ctrl_trig;
+        volatile uint32_t al1_ctrl;
+        volatile uint32_t al2_ctrl;
+        volatile uint32_t al3_ctrl;
+    };
+} dma_channel_hw_t;
+
+typedef struct {
+    dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+    volatile uint32_t intr;
+    volatile uint32_t inte0;
+    volatile uint32_t intf0;
+    volatile uint32_t ints0;
+    volatile uint32_t multi_channel_trigger;
+} dma_hw_t;
+
+dma_hw_t *sim_dma_hw(void);
+#define dma_hw (sim_dma_hw())
@@ -0,0 +1,18 @@
+/* Inter-core FIFO only: core 1 answers the bootrom launch handshake
+ * (rp2040_sim.c) and starts at the entry point it was handed.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define SIO_FIFO_ST_RDY_BITS 0x00000002u
+#define SIO_FIFO_ST_VLD_BITS 0x00000001u
+
+typedef struct {
+    volatile uint32_t fifo_st;
+    volatile uint32_t fifo_wr;
+    volatile uint32_t fifo_rd;
+} sio_hw_t;
+
+sio_hw_t *sim_sio_hw(void);
+#define sio_hw (sim_sio_hw())
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stdint.h>
+
+uint32_t time_us_32(void);
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t mods;
+    uint8_t reserved;
+    uint8_t keys[6];
+} report_keyboard_t;
+
+typedef struct {
+    uint8_t report_id;
+    uint8_t mods;
+    uint8_t bits[30];
+} report_nkro_t;
+
+typedef struct {
+    uint8_t (*keyboard_leds)(void);
+    void (*send_keyboard)(report_keyboard_t *report);
+    void (*send_nkro)(report_nkro_t *report);
+    void (*send_mouse)(void *report);
+    void (*send_extra)(void *report);
+} host_driver_t;
+
+host_driver_t *host_get_driver(void);
+void host_set_driver(host_driver_t *driver);
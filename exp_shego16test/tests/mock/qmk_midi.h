@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef struct MidiDevice MidiDevice;
+extern MidiDevice midi_device;
+
+void midi_send_noteon(MidiDevice *device, uint8_t chan, uint8_t num, uint8_t vel);
+void midi_send_noteoff(MidiDevice *device, uint8_t chan, uint8_t num, uint8_t vel);
+void midi_send_aftertouch(MidiDevice *device, uint8_t chan, uint8_t note_num, uint8_t amt);
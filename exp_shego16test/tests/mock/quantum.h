@@ -0,0 +1,83 @@
+/* quantum.h - the slice of QMK the scan code uses, for host builds
+ * Pins, timers and waits are served by host_sim.c on the simulated clock.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <hal.h>
+
+typedef uint32_t pin_t;
+typedef uint8_t matrix_row_t;
+typedef uint32_t layer_state_t;
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+#define GP0 0
+#define GP1 1
+#define GP2 2
+#define GP3 3
+#define GP4 4
+#define GP5 5
+#define GP6 6
+#define GP7 7
+#define GP8 8
+#define GP9 9
+#define GP10 10
+#define GP11 11
+#define GP12 12
+#define GP13 13
+#define GP14 14
+#define GP15 15
+#define GP16 16
+#define GP17 17
+#define GP18 18
+#define GP19 19
+#define GP20 20
+#define GP21 21
+#define GP22 22
+#define GP23 23
+#define GP24 24
+#define GP25 25
+#define GP26 26
+#define GP27 27
+#define GP28 28
+#define GP29 29
+
+#define KC_NO 0x0000
+#define KC_TRNS 0x0001
+#define KC_A 0x0004
+#define QK_KB_0 0x7E00
+#define QK_MIDI_NOTE_C_0 0x7103
+#define QK_MIDI_NOTE_B_5 0x714A
+#define MAX_LAYER 32
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+void setPinOutput(pin_t pin);
+void setPinInputHigh(pin_t pin);
+void writePin(pin_t pin, bool level);
+void writePinHigh(pin_t pin);
+void writePinLow(pin_t pin);
+
+uint16_t analogReadPin(pin_t pin);
+
+void wait_us(uint32_t us);
+void wait_ms(uint32_t ms);
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+
+int uprintf(const char *fmt, ...);
+
+void tap_code16(uint16_t keycode);
+void register_code16(uint16_t keycode);
+void unregister_code16(uint16_t keycode);
@@ -0,0 +1,41 @@
+/* sim_config.h - scan configuration of a host build, applied over config.h
+ * The Makefile picks it with SIM_DMA, SIM_CORE1, SIM_RATE (0/1) and
+ * SIM_PARALLEL; a fixed-rate build keeps config.h's HALL_SCAN_RATE_HZ.
+ */
+#pragma once
+
+// No flash to write, so core 1 may scan (see shego_adc.c)
+#define HALL_HOST_SIM
+
+#ifndef SIM_DMA
+#define SIM_DMA 0
+#endif
+#ifndef SIM_CORE1
+#define SIM_CORE1 0
+#endif
+#ifndef SIM_RATE
+#define SIM_RATE 0
+#endif
+#ifndef SIM_PARALLEL
+#define SIM_PARALLEL 1
+#endif
+
+#undef HALL_DMA_ENGINE
+#if SIM_DMA
+#define HALL_DMA_ENGINE
+#endif
+
+#undef HALL_CORE1_SCAN
+#if SIM_CORE1
+#define HALL_CORE1_SCAN
+#endif
+
+#if !SIM_RATE
+#undef HALL_SCAN_RATE_HZ
+#elif !defined(HALL_SCAN_RATE_HZ)
+#define HALL_SCAN_RATE_HZ 4000
+#endif
+
+#if !SIM_PARALLEL
+#define MUX_PARALLEL_SCAN 0
+#endif
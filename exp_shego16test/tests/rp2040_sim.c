@@ -0,0 +1,371 @@
+// rp2040_sim.c - emulated ADC, DMA and inter-core FIFO registers (host_sim.h)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "host_sim.h"
+#include "hal.h"
+#include "hall_adc.h"
+#include "hardware/structs/adc.h"
+#include "hardware/structs/dma.h"
+#include "hardware/structs/sio.h"
+
+// 96 ADC clocks at 48 MHz
+#define ADC_CONVERSION_US 2.0
+
+// ADC inputs: 2 = GP28 (MUX2), 3 = GP29 (MUX1)
+#define ADC_INPUTS 5
+
+static adc_hw_t adc_regs;
+static dma_hw_t dma_regs;
+static sio_hw_t sio_regs;
+
+// Free-running conversions (START_MANY)
+static bool adc_running;
+static double adc_next;
+
+// Per channel: count reloaded on the next trigger, ChibiOS callback
+static uint32_t dma_reload[NUM_DMA_CHANNELS];
+static rp_dma_channel_t dma_channels[NUM_DMA_CHANNELS];
+static bool dma_allocated[NUM_DMA_CHANNELS];
+static rp_dmaisr_t dma_isr[NUM_DMA_CHANNELS];
+static void *dma_isr_param[NUM_DMA_CHANNELS];
+static bool irq_pending;
+static double irq_due;
+
+// RP2040 quantizer: the four wide codes take their extra width from all
+// the others, the layout hall_adc.c corrects for
+static uint16_t quantize(double level) {
+    uint32_t extra_sum = HALL_ADC_WIDE_CODES * sim_params.adc_dnl;
+    double base = (double)((4096u << HALL_ADC_FRAC_BITS) - extra_sum);
+    double x = level * (1 << HALL_ADC_FRAC_BITS);
+    if (x <= 0) return 0;
+
+    // Upper edge of code c: (c + 1) * base / 4096 plus the wide codes up to c
+    uint16_t lo = 0, hi = 4095;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        uint32_t below = 0;
+        for (uint16_t wide = 512; wide <= mid; wide += 1024) below += sim_params.adc_dnl;
+        if (x < (mid + 1) * base / 4096 + below) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+uint16_t rp2040_sim_convert(uint8_t input, double t) {
+    if (input == 3) return quantize(sim_mux_output(0, t));
+    if (input == 2) return quantize(sim_mux_output(1, t));
+    return 0;
+}
+
+static uint32_t sim_addr(const volatile void *p) {
+    uintptr_t addr = (uintptr_t)p;
+    if (addr > UINT32_MAX) {
+        fprintf(stderr, "rp2040_sim: %p does not fit a DMA address, link with -no-pie\n", (void *)p);
+        exit(1);
+    }
+    return (uint32_t)addr;
+}
+
+// DMA
+
+static void dma_trigger(uint8_t ch);
+
+static uint32_t dma_read(uint32_t addr, uint32_t size) {
+    if (addr == sim_addr(&adc_regs.fifo)) return adc_regs.fifo;
+    uint32_t value = 0;
+    memcpy(&value, (const void *)(uintptr_t)addr, size);
+    return value;
+}
+
+static void dma_write(uint32_t addr, uint32_t value, uint32_t size) {
+    uint32_t regs = sim_addr(&dma_regs.ch[0]);
+    if (addr >= regs && addr < regs + sizeof(dma_regs.ch)) {
+        uint8_t ch = (addr - regs) / sizeof(dma_channel_hw_t);
+        if (addr != sim_addr(&dma_regs.ch[ch].write_addr)) {
+            fprintf(stderr, "rp2040_sim: DMA write to an unsupported DMA register\n");
+            exit(1);
+        }
+        dma_regs.ch[ch].write_addr = value;
+        dma_trigger(ch);
+        return;
+    }
+    memcpy((void *)(uintptr_t)addr, &value, size);
+}
+
+static uint32_t dma_step(uint32_t addr, uint32_t size, bool incr, uint32_t ring_bits) {
+    if (!incr) return addr;
+    uint32_t next = addr + size;
+    if (!ring_bits) return next;
+    uint32_t mask = (1u << ring_bits) - 1;
+    return (addr & ~mask) | (next & mask);
+}
+
+static void dma_complete(uint8_t ch) {
+    dma_channel_hw_t *c = &dma_regs.ch[ch];
+    c->ctrl_trig &= ~DMA_CH0_CTRL_TRIG_BUSY_BITS;
+    if (!(c->ctrl_trig & DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS)) {
+        dma_regs.intr |= 1u << ch;
+        if ((dma_regs.inte0 & (1u << ch)) && !irq_pending) {
+            irq_pending = true;
+            irq_due = sim_now() + sim_params.irq_us;
+        }
+    }
+    uint8_t chain = (c->ctrl_trig & DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) >> DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB;
+    if (chain != ch) dma_trigger(chain);
+}
+
+// One transfer of a busy channel
+static void dma_transfer(uint8_t ch) {
+    dma_channel_hw_t *c = &dma_regs.ch[ch];
+    uint32_t ctrl = c->ctrl_trig;
+    uint32_t size = 1u << ((ctrl & DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS) >> DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB);
+    uint32_t ring = (ctrl & DMA_CH0_CTRL_TRIG_RING_SIZE_BITS) >> DMA_CH0_CTRL_TRIG_RING_SIZE_LSB;
+    bool ring_write = ctrl & DMA_CH0_CTRL_TRIG_RING_SEL_BITS;
+    uint32_t read = c->read_addr;
+    uint32_t write = c->write_addr;
+
+    c->read_addr = dma_step(read, size, ctrl & DMA_CH0_CTRL_TRIG_INCR_READ_BITS, ring_write ? 0 : ring);
+    c->write_addr = dma_step(write, size, ctrl & DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS, ring_write ? ring : 0);
+    c->transfer_count = c->transfer_count - 1;
+    dma_write(write, dma_read(read, size), size);
+    if (c->transfer_count == 0) dma_complete(ch);
+}
+
+static uint8_t dma_treq(uint8_t ch) {
+    return (dma_regs.ch[ch].ctrl_trig & DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS) >> DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB;
+}
+
+static bool dma_busy(uint8_t ch) {
+    return dma_regs.ch[ch].ctrl_trig & DMA_CH0_CTRL_TRIG_BUSY_BITS;
+}
+
+// A finished channel restarts with the count it was last given
+static void dma_trigger(uint8_t ch) {
+    dma_channel_hw_t *c = &dma_regs.ch[ch];
+    if (!(c->ctrl_trig & DMA_CH0_CTRL_TRIG_EN_BITS)) return;
+    if (c->transfer_count == 0) {
+        c->transfer_count = dma_reload[ch];
+    } else {
+        dma_reload[ch] = c->transfer_count;
+    }
+    if (c->transfer_count == 0) return;
+    c->ctrl_trig |= DMA_CH0_CTRL_TRIG_BUSY_BITS;
+    if (dma_treq(ch) != DMA_CH0_CTRL_TRIG_TREQ_SEL_VALUE_PERMANENT) return;
+    while (dma_busy(ch)) dma_transfer(ch);
+}
+
+// A DREQ: one transfer on the busy channel paced by it, if any
+static bool dma_dreq(uint8_t treq) {
+    for (uint8_t ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+        if (!dma_busy(ch) || dma_treq(ch) != treq) continue;
+        dma_transfer(ch);
+        return true;
+    }
+    return false;
+}
+
+// ChibiOS serves the shared DMA IRQ: every pending channel's callback,
+// then the status is clear. Completions while the IRQ was held off show
+// as one.
+static void dma_irq(double t) {
+    irq_pending = false;
+    sim_irq_enter(t);
+    uint32_t pending = dma_regs.intr & dma_regs.inte0;
+    dma_regs.ints0 = pending;
+    for (uint8_t ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+        if ((pending & (1u << ch)) && dma_isr[ch]) dma_isr[ch](dma_isr_param[ch], dma_regs.ch[ch].ctrl_trig);
+    }
+    dma_regs.intr &= ~pending;
+    dma_regs.ints0 = 0;
+    sim_irq_exit();
+}
+
+const rp_dma_channel_t *dmaChannelAlloc(uint32_t id, uint32_t priority, rp_dmaisr_t func, void *param) {
+    (void)priority;
+    for (uint8_t ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+        if (dma_allocated[ch] || (id != RP_DMA_CHANNEL_ID_ANY && id != ch)) continue;
+        dma_allocated[ch] = true;
+        dma_isr[ch] = func;
+        dma_isr_param[ch] = param;
+        dma_channels[ch] = (rp_dma_channel_t){.chnidx = ch, .chnmask = 1u << ch};
+        return &dma_channels[ch];
+    }
+    return NULL;
+}
+
+void dmaChannelFreeI(const rp_dma_channel_t *dmachp) {
+    dma_allocated[dmachp->chnidx] = false;
+    dma_regs.inte0 &= ~dmachp->chnmask;
+}
+
+void dmaChannelFree(const rp_dma_channel_t *dmachp) {
+    dmaChannelFreeI(dmachp);
+}
+
+void dmaChannelEnableInterruptX(const rp_dma_channel_t *dmachp) {
+    dma_regs.inte0 |= dmachp->chnmask;
+}
+
+// ADC
+
+// Next input of the round-robin after input
+static uint8_t adc_next_input(uint8_t input) {
+    uint32_t rrobin = (adc_regs.cs & ADC_CS_RROBIN_BITS) >> ADC_CS_RROBIN_LSB;
+    if (!rrobin) return input;
+    for (uint8_t i = 1; i <= ADC_INPUTS; i++) {
+        uint8_t next = (input + i) % ADC_INPUTS;
+        if (rrobin & (1u << next)) return next;
+    }
+    return input;
+}
+
+// One free-running conversion at t, handed to the DMA through the FIFO.
+// Nothing reads the FIFO without a DREQ here, so an unserved sample is an
+// overflow.
+static void adc_convert_many(double t) {
+    uint8_t input = (adc_regs.cs & ADC_CS_AINSEL_BITS) >> ADC_CS_AINSEL_LSB;
+    uint16_t code = rp2040_sim_convert(input, t);
+    adc_regs.result = code;
+    adc_regs.cs = (adc_regs.cs & ~ADC_CS_AINSEL_BITS) | ((uint32_t)adc_next_input(input) << ADC_CS_AINSEL_LSB);
+    if (!(adc_regs.fcs & ADC_FCS_EN_BITS)) return;
+    adc_regs.fifo = code;
+    if (!(adc_regs.fcs & ADC_FCS_DREQ_EN_BITS) || !dma_dreq(DREQ_ADC)) adc_regs.fcs |= ADC_FCS_OVER_BITS;
+}
+
+static void adc_sync_running(void);
+static void dma_sync(void);
+
+void rp2040_sim_advance(double t) {
+    adc_sync_running();
+    dma_sync();
+    for (;;) {
+        double conversion = adc_running ? adc_next : INFINITY;
+        double irq = irq_pending ? irq_due : INFINITY;
+        if (fmin(conversion, irq) > t) return;
+        if (irq <= conversion) {
+            dma_irq(irq);
+        } else {
+            sim_irq_enter(conversion);
+            adc_convert_many(conversion);
+            sim_irq_exit();
+            adc_next += ADC_CONVERSION_US;
+        }
+    }
+}
+
+// Register writes take effect when the registers are next touched or the
+// clock next moves, at that time
+static void adc_sync_running(void) {
+    uint32_t cs = adc_regs.cs;
+    bool many = (cs & ADC_CS_EN_BITS) && (cs & ADC_CS_START_MANY_BITS);
+    if (many && !adc_running) adc_next = sim_now() + ADC_CONVERSION_US;
+    adc_running = many;
+}
+
+static void adc_sync(void) {
+    uint32_t cs = adc_regs.cs;
+    if (!(cs & ADC_CS_EN_BITS)) {
+        adc_running = false;
+        adc_regs.cs = cs & ~ADC_CS_READY_BITS;
+        return;
+    }
+    if (cs & ADC_CS_START_ONCE_BITS) {
+        adc_regs.cs = cs & ~(ADC_CS_START_ONCE_BITS | ADC_CS_READY_BITS);
+        sim_cpu(ADC_CONVERSION_US);
+        uint8_t input = (cs & ADC_CS_AINSEL_BITS) >> ADC_CS_AINSEL_LSB;
+        adc_regs.result = rp2040_sim_convert(input, sim_now());
+    }
+    adc_sync_running();
+    adc_regs.cs |= ADC_CS_READY_BITS;
+}
+
+adc_hw_t *sim_adc_hw(void) {
+    adc_sync();
+    return &adc_regs;
+}
+
+static void dma_sync(void) {
+    uint32_t trigger = dma_regs.multi_channel_trigger;
+    dma_regs.multi_channel_trigger = 0;
+    for (uint8_t ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
+        if (trigger & (1u << ch)) dma_trigger(ch);
+    }
+}
+
+dma_hw_t *sim_dma_hw(void) {
+    dma_sync();
+    return &dma_regs;
+}
+
+// SIO FIFO and the core 1 bootrom. Core 1 echoes every word of the launch
+// sequence {0, 0, 1, VTOR, SP, entry} and starts at entry after the last.
+// A received word stays at the head of the FIFO for two register accesses,
+// long enough for a status poll and the read that follows it.
+#define SIO_FIFO_IDLE 0xFFFFFFFFu
+#define SIO_LAUNCH_WORDS 6
+
+static uint32_t fifo[8];
+static uint8_t fifo_count;
+static uint8_t fifo_seen;
+static uint32_t launch[SIO_LAUNCH_WORDS];
+static uint8_t launch_count;
+static bool launched;
+
+static void core1_receive(uint32_t word) {
+    static const uint32_t sync[] = {0, 0, 1};
+    if (launched) return;
+    if (fifo_count < sizeof(fifo) / sizeof(fifo[0])) fifo[fifo_count++] = word;
+    if (launch_count < sizeof(sync) / sizeof(sync[0]) && word != sync[launch_count]) {
+        // Out of sequence: a 0 starts it over
+        launch_count = word == 0 ? 1 : 0;
+        return;
+    }
+    launch[launch_count++] = word;
+    if (launch_count < SIO_LAUNCH_WORDS) return;
+
+    launched = true;
+    sim_core1_start((void (*)(void))(uintptr_t)launch[5]);
+}
+
+// A word written to FIFO_WR reaches core 1 at the next access or SEV
+static void sio_deliver(void) {
+    if (sio_regs.fifo_wr == SIO_FIFO_IDLE) return;
+    uint32_t word = sio_regs.fifo_wr;
+    sio_regs.fifo_wr = SIO_FIFO_IDLE;
+    core1_receive(word);
+}
+
+sio_hw_t *sim_sio_hw(void) {
+    static bool init;
+    if (!init) {
+        init = true;
+        sio_regs.fifo_wr = SIO_FIFO_IDLE;
+    }
+    if (fifo_count && fifo_seen >= 2) {
+        memmove(fifo, fifo + 1, --fifo_count * sizeof(fifo[0]));
+        fifo_seen = 0;
+    }
+    sio_deliver();
+    sio_regs.fifo_st = SIO_FIFO_ST_RDY_BITS;
+    if (fifo_count) {
+        sio_regs.fifo_st |= SIO_FIFO_ST_VLD_BITS;
+        sio_regs.fifo_rd = fifo[0];
+        fifo_seen++;
+    }
+    return &sio_regs;
+}
+
+void __SEV(void) {
+    sio_deliver();
+}
+
+void __WFE(void) {
+    sim_cpu(sim_params.poll_us);
+}
+
+SCB_Type sim_scb;
@@ -0,0 +1,647 @@
+// scan_sim.c - the shego_adc.c scan pipeline on the simulated board
+//
+// Runs the real scan code (shego_adc.c, included below for its key table,
+// and the hall_*.c modules) against host_sim.c for comparing scanning
+// changes without flashing the board. The Makefile builds one binary per
+// scan configuration; `make sim` runs them all on the same session.
+//
+// Input is either a synthetic typing session or a recorded capture (CSV
+// rows "time_us,channel,adc", channel as in the firmware sample arrays:
+// MUX1 0..15, MUX2 16..31). Reports the scan period, the longest gap
+// between scans, actuation latency from the true crossing to the
+// scanner's decision, missed presses, chatter and the latency to the matrix
+// QMK sees. With --velocity every key is a MIDI note and the notes sent are
+// compared with the true stroke speed (synthetic) or listed (captures).
+//
+// Ground truth is the fixed actuation point: synthetic sessions know the
+// exact crossings, captures use a centered moving average of the trace.
+// The stored calibration is the signal's own rest/bottom-out; the boot rest
+// capture runs as on the board before the session starts.
+// Actuation, hysteresis, filter and travel profile are the firmware's
+// (config.h, or SIM_DEFS for settings config.h leaves at their defaults).
+//
+// Usage (from tests/): make sim SIM_ARGS="--trace capture.csv --rt"
+//                      build/scan_sim_dma_timer --velocity
+#include "shego_adc.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "hardware/structs/dma.h"
+#include "host_sim.h"
+#include "hall_velocity.h"
+
+#ifndef SIM_NAME
+#define SIM_NAME "config.h"
+#endif
+
+// hall_midi.c's note of key position 0
+#ifndef HALL_MIDI_BASE_NOTE
+#define HALL_MIDI_BASE_NOTE 48
+#endif
+
+// Mux/ADC glitch probability per conversion and its size (ADC counts)
+#define SIM_SPIKE_RATE 0.001
+#define SIM_SPIKE 120.0
+
+// Detections further than this from a true crossing do not match it
+#define SIM_MATCH_WINDOW_US 50e3
+#define SIM_VELOCITY_WINDOW_US 20e3
+
+// Boot rest capture must finish within this
+#define SIM_BOOT_LIMIT_US 1e6
+
+typedef struct {
+    double duration_ms;
+    uint64_t seed;
+    bool rt;
+    double rest;
+    double span;
+    double noise;
+    double loop_us;
+    double stall_ms;
+    double stall_every_ms;
+    int dma_channels;
+    bool velocity;
+    bool header;
+    bool check;
+    const char *trace;
+} sim_options_t;
+
+static sim_options_t opt = {
+    .duration_ms = 1000.0,
+    .seed = 1,
+    .rest = 1900.0,
+    .span = 1400.0,
+    .noise = 6.0,
+    .loop_us = 50.0,
+    .stall_every_ms = 50.0,
+    .dma_channels = NUM_DMA_CHANNELS,
+};
+
+// Growable arrays
+#define PUSH(arr, n, cap, value)                                   \
+    do {                                                           \
+        if ((n) == (cap)) {                                        \
+            (cap) = (cap) ? 2 * (cap) : 64;                        \
+            (arr) = realloc((arr), (cap) * sizeof(*(arr)));        \
+            if (!(arr)) abort();                                   \
+        }                                                          \
+        (arr)[(n)++] = (value);                                    \
+    } while (0)
+
+// Field model of gen_travel_lut.py for HALL_TRAVEL_PROFILE:
+// travel mm, gap at bottom-out mm, falloff exponent
+static const double profiles[][3] = {
+    [HALL_PROFILE_LINEAR_4MM] = {4.0, 0.0, 0},
+    [HALL_PROFILE_DIPOLE_4MM] = {4.0, 1.5, 3},
+    [HALL_PROFILE_DIPOLE_3_5MM] = {3.5, 1.2, 3},
+};
+#define PROFILE profiles[HALL_TRAVEL_PROFILE]
+
+// Reading at travel x scaled so rest = 0 and bottom-out = 1
+static double normalized(double x) {
+    double travel = PROFILE[0], gap = PROFILE[1], n = PROFILE[2];
+    if (n == 0) return x / travel;
+    double f0 = pow(gap + travel, -n);
+    double f1 = pow(gap, -n);
+    return (pow(gap + travel - x, -n) - f0) / (f1 - f0);
+}
+
+// PRNG: xorshift64*, Box-Muller
+static uint64_t rng_state;
+
+static double rng_uniform(double a, double b) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    uint64_t x = rng_state * 0x2545F4914F6CDD1DULL;
+    return a + (b - a) * ((x >> 11) * (1.0 / 9007199254740992.0));
+}
+
+static double rng_gauss(double sigma) {
+    double u = rng_uniform(0.0, 1.0);
+    double v = rng_uniform(0.0, 1.0);
+    return sigma * sqrt(-2.0 * log(u > 0 ? u : 1e-300)) * cos(2 * M_PI * v);
+}
+
+// Session: per channel either piecewise-linear travel (synthetic, mm over
+// us) or the recorded levels (capture), with the true crossings
+typedef struct {
+    double t0, x0, t1, x1;
+} segment_t;
+
+typedef struct {
+    double t;
+    double level;
+} sample_t;
+
+typedef struct {
+    double t;
+    uint8_t ch;
+    bool pressed;
+} crossing_t;
+
+typedef struct {
+    bool used;
+    double rest;
+    double bottom;
+    segment_t *seg;
+    size_t seg_n, seg_cap;
+    sample_t *trace;
+    size_t trace_n, trace_cap;
+    crossing_t *truth;
+    size_t truth_n, truth_cap;
+} session_channel_t;
+
+static session_channel_t session[HALL_CHANNELS];
+static double session_us;
+static double start_us = INFINITY;  // simulated time of session time 0
+
+static void synthetic_session(void) {
+    double travel_mm = PROFILE[0];
+    double act_mm = HALL_ACTUATION_TRAVEL / 100.0;
+    session_us = opt.duration_ms * 1000;
+
+    for (uint8_t k = 0; k < HALL_KEY_COUNT; k++) {
+        uint8_t ch = hall_keys[k].ch;
+        session_channel_t *s = &session[ch];
+        s->used = true;
+        s->rest = opt.rest + floor(rng_uniform(-80, 81));
+        s->bottom = s->rest + opt.span;
+
+        double t = 0, x = 0;
+        while (t < session_us) {
+            double idle = rng_uniform(20e3, 150e3);
+            PUSH(s->seg, s->seg_n, s->seg_cap, ((segment_t){t, x, t + idle, x}));
+            t += idle;
+            double depth = travel_mm * (rng_uniform(0, 1) < 0.15 ? rng_uniform(0.2, 0.35) : rng_uniform(0.6, 1.0));
+            double ramp = rng_uniform(3e3, 12e3);
+            double hold = rng_uniform(0, 1) < 0.3 ? 0.0 : rng_uniform(5e3, 80e3);
+            PUSH(s->seg, s->seg_n, s->seg_cap, ((segment_t){t, 0.0, t + ramp, depth}));
+            if (depth > act_mm) PUSH(s->truth, s->truth_n, s->truth_cap, ((crossing_t){t + ramp * act_mm / depth, ch, true}));
+            t += ramp;
+            PUSH(s->seg, s->seg_n, s->seg_cap, ((segment_t){t, depth, t + hold, depth}));
+            t += hold;
+            PUSH(s->seg, s->seg_n, s->seg_cap, ((segment_t){t, depth, t + ramp, 0.0}));
+            if (depth > act_mm) PUSH(s->truth, s->truth_n, s->truth_cap, ((crossing_t){t + ramp * (1 - act_mm / depth), ch, false}));
+            t += ramp;
+        }
+    }
+}
+
+// Last index with a[i] <= t, 0 if none
+static size_t find(const double *a, size_t n, size_t stride, double t) {
+    size_t lo = 0, hi = n;
+    while (lo + 1 < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (a[mid * stride] <= t) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static double synthetic_travel(const session_channel_t *s, double t) {
+    const segment_t *seg = &s->seg[find(&s->seg[0].t0, s->seg_n, sizeof(segment_t) / sizeof(double), t)];
+    if (t >= seg->t1 || seg->t1 == seg->t0) return seg->x1;
+    return seg->x0 + (seg->x1 - seg->x0) * (t - seg->t0) / (seg->t1 - seg->t0);
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void trace_session(void) {
+    FILE *f = fopen(opt.trace, "r");
+    if (!f) {
+        perror(opt.trace);
+        exit(1);
+    }
+
+    char line[128];
+    double first = INFINITY;
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long time_us;
+        unsigned ch, level;
+        if (sscanf(line, "%lu,%u,%u", &time_us, &ch, &level) != 3 || ch >= HALL_CHANNELS) continue;
+        if (!(HALL_ACTIVE_MASK & (1UL << ch))) continue;
+        session_channel_t *s = &session[ch];
+        s->used = true;
+        PUSH(s->trace, s->trace_n, s->trace_cap, ((sample_t){time_us, level}));
+        if (time_us < first) first = time_us;
+    }
+    fclose(f);
+
+    double act_u = normalized(HALL_ACTUATION_TRAVEL / 100.0);
+    session_us = 0;
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        session_channel_t *s = &session[ch];
+        if (!s->used) continue;
+        size_t n = s->trace_n;
+        for (size_t i = 0; i < n; i++) s->trace[i].t -= first;
+        for (size_t i = 1; i < n; i++) {
+            if (s->trace[i].t < s->trace[i - 1].t) {
+                fprintf(stderr, "%s: channel %u is not in time order\n", opt.trace, ch);
+                exit(1);
+            }
+        }
+        if (s->trace[n - 1].t > session_us) session_us = s->trace[n - 1].t;
+
+        // Centered moving average; rest/bottom-out at its 1% / 99% levels
+        const size_t half = 7;
+        double *smooth = malloc(n * sizeof(double));
+        double *sorted = malloc(n * sizeof(double));
+        for (size_t i = 0; i < n; i++) {
+            size_t a = i > half ? i - half : 0, b = i + half + 1 < n ? i + half + 1 : n;
+            double sum = 0;
+            for (size_t j = a; j < b; j++) sum += s->trace[j].level;
+            smooth[i] = sorted[i] = sum / (b - a);
+        }
+        qsort(sorted, n, sizeof(double), compare_double);
+        s->rest = floor(sorted[n / 100]);
+        s->bottom = floor(fmax(sorted[n - 1 - n / 100], s->rest + 100));
+
+        // Crossings of the actuation point in the smoothed signal
+        bool down = false;
+        for (size_t i = 0; i < n; i++) {
+            bool now = (smooth[i] - s->rest) / (s->bottom - s->rest) > act_u;
+            if (now == down) continue;
+            PUSH(s->truth, s->truth_n, s->truth_cap, ((crossing_t){s->trace[i].t, ch, now}));
+            down = now;
+        }
+        free(smooth);
+        free(sorted);
+    }
+    if (session_us == 0) {
+        fprintf(stderr, "%s: no samples for populated channels\n", opt.trace);
+        exit(1);
+    }
+    opt.duration_ms = session_us / 1000;
+}
+
+// Sensor level at session time t. The session starts once the boot
+// capture is done; until then every key rests without noise, which is what
+// the boot settle measurement needs to see the mux and not the sensor.
+static double session_level(uint8_t ch, double t) {
+    const session_channel_t *s = &session[ch];
+    if (!s->used) return 0.0;
+    if (t < start_us) return opt.trace ? s->trace[0].level : s->rest;
+    t -= start_us;
+
+    if (opt.trace) {
+        const sample_t *a = &s->trace[find(&s->trace[0].t, s->trace_n, sizeof(sample_t) / sizeof(double), t)];
+        if (a == &s->trace[s->trace_n - 1] || t <= a->t) return a->level;
+        return a->level + (a[1].level - a->level) * (t - a->t) / (a[1].t - a->t);
+    }
+
+    double level = s->rest + normalized(synthetic_travel(s, t)) * (s->bottom - s->rest) + rng_gauss(opt.noise);
+    if (rng_uniform(0, 1) < SIM_SPIKE_RATE) level += rng_uniform(0, 1) < 0.5 ? -SIM_SPIKE : SIM_SPIKE;
+    return level;
+}
+
+// The stored calibration, which the boot capture moves onto the measured rest
+static void store_calibration(void) {
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        if (!session[ch].used) continue;
+        kb_config.calib.rest[ch] = (uint16_t)session[ch].rest;
+        kb_config.calib.bottom[ch] = (uint16_t)session[ch].bottom;
+    }
+}
+
+// Detected transitions, session time
+static crossing_t *decided, *matrix_events;
+static size_t decided_n, decided_cap, matrix_n, matrix_cap;
+
+// The scanner's press/release decisions, from process_samples()
+void __real_hall_log(uint8_t event, uint8_t ch, uint16_t adc, uint16_t travel, uint16_t arg);
+
+void __wrap_hall_log(uint8_t event, uint8_t ch, uint16_t adc, uint16_t travel, uint16_t arg) {
+    if (event != HALL_LOG_SAMPLE && sim_now() >= start_us) {
+        PUSH(decided, decided_n, decided_cap, ((crossing_t){sim_now() - start_us, ch, event == HALL_LOG_PRESS}));
+    }
+    __real_hall_log(event, ch, adc, travel, arg);
+}
+
+static const hall_key_t *key_at(uint8_t pos) {
+    for (uint8_t k = 0; k < HALL_KEY_COUNT; k++) {
+        if (hall_keys[k].pos == pos) return &hall_keys[k];
+    }
+    return NULL;
+}
+
+// --velocity: every key plays a note
+typedef struct {
+    double t;
+    uint8_t ch;
+    uint8_t velocity;
+} note_t;
+
+static note_t *notes;
+static size_t notes_n, notes_cap;
+
+static uint16_t midi_keycode(uint8_t row, uint8_t col) {
+    return QK_MIDI_NOTE_C_0 + row * MATRIX_COLS + col;
+}
+
+static void record_note(uint8_t note, uint8_t velocity) {
+    const hall_key_t *key = key_at(note - HALL_MIDI_BASE_NOTE);
+    if (!velocity || !key || sim_now() < start_us) return;
+    PUSH(notes, notes_n, notes_cap, ((note_t){sim_now() - start_us, key->ch, velocity}));
+}
+
+// Session run: boot, boot rest capture, then the session on the main loop
+static void simulate(void) {
+    matrix_row_t matrix[MATRIX_ROWS] = {0};
+    double next_stall = INFINITY;
+
+    // Channels taken by other drivers before the keyboard starts
+    for (int i = opt.dma_channels; i < NUM_DMA_CHANNELS; i++) dmaChannelAlloc(RP_DMA_CHANNEL_ID_ANY, RP_IRQ_DMA0_PRIORITY, NULL, NULL);
+
+    hall_set_rapid_trigger(opt.rt);
+    matrix_init_custom();
+    for (;;) {
+        if (start_us == INFINITY && hall_calib_generation()) {
+            start_us = sim_now();
+            hall_stats_reset();
+            if (opt.stall_ms > 0) next_stall = start_us + opt.stall_every_ms * 1000;
+        }
+        if (start_us == INFINITY && sim_now() > SIM_BOOT_LIMIT_US) {
+            fprintf(stderr, "%s: boot rest capture did not finish\n", SIM_NAME);
+            exit(1);
+        }
+        if (sim_now() >= start_us + session_us) break;
+
+        if (sim_now() >= next_stall) {
+            sim_cpu(opt.stall_ms * 1000);
+            next_stall += opt.stall_every_ms * 1000;
+        }
+
+        matrix_row_t previous[MATRIX_ROWS];
+        memcpy(previous, matrix, sizeof(previous));
+        matrix_scan_custom(matrix);
+        for (uint8_t row = 0; row < MATRIX_ROWS && sim_now() >= start_us; row++) {
+            for (matrix_row_t diff = previous[row] ^ matrix[row]; diff; diff &= diff - 1) {
+                uint8_t col = __builtin_ctz(diff);
+                const hall_key_t *key = key_at(row * MATRIX_COLS + col);
+                if (!key) continue;
+                bool pressed = matrix[row] & (1u << col);
+                PUSH(matrix_events, matrix_n, matrix_cap, ((crossing_t){sim_now() - start_us, key->ch, pressed}));
+            }
+        }
+
+        hall_midi_task();
+        sim_cpu(opt.loop_us);
+    }
+}
+
+// Scoring
+
+typedef struct {
+    double *press, *release;
+    size_t press_n, press_cap, release_n, release_cap;
+    unsigned missed;
+    unsigned spurious;
+} score_t;
+
+static int compare_crossing(const void *a, const void *b) {
+    return compare_double(&((const crossing_t *)a)->t, &((const crossing_t *)b)->t);
+}
+
+// Pair detected transitions with true crossings, per channel. Crossings too
+// close to the end of the session to be matched are ignored.
+static score_t score(crossing_t *events, size_t n) {
+    score_t sc = {0};
+    double end = session_us - SIM_MATCH_WINDOW_US;
+    bool *used = calloc(n ? n : 1, sizeof(bool));
+    qsort(events, n, sizeof(crossing_t), compare_crossing);
+
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        const session_channel_t *s = &session[ch];
+        for (size_t i = 0; i < s->truth_n && s->truth[i].t <= end; i++) {
+            const crossing_t *truth = &s->truth[i];
+            size_t match = n;
+            for (size_t j = 0; j < n; j++) {
+                const crossing_t *e = &events[j];
+                if (used[j] || e->ch != ch || e->pressed != truth->pressed || e->t < truth->t - SIM_MATCH_WINDOW_US) continue;
+                if (e->t <= truth->t + SIM_MATCH_WINDOW_US) match = j;
+                break;
+            }
+            if (match == n) {
+                if (truth->pressed) sc.missed++;
+                continue;
+            }
+            used[match] = true;
+            double latency = events[match].t - truth->t;
+            if (truth->pressed) {
+                PUSH(sc.press, sc.press_n, sc.press_cap, latency);
+            } else {
+                PUSH(sc.release, sc.release_n, sc.release_cap, latency);
+            }
+        }
+    }
+    for (size_t j = 0; j < n; j++) {
+        if (!used[j] && events[j].t <= end) sc.spurious++;
+    }
+    free(used);
+    return sc;
+}
+
+static double mean(const double *v, size_t n) {
+    if (!n) return NAN;
+    double sum = 0;
+    for (size_t i = 0; i < n; i++) sum += v[i];
+    return sum / n;
+}
+
+static double pct(double *v, size_t n, double q) {
+    if (!n) return NAN;
+    qsort(v, n, sizeof(double), compare_double);
+    size_t i = (size_t)(q * n);
+    return v[i < n ? i : n - 1];
+}
+
+static void print_header(void) {
+    unsigned presses = 0;
+    unsigned keys = 0;
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        keys += session[ch].used;
+        for (size_t i = 0; i < session[ch].truth_n; i++) presses += session[ch].truth[i].pressed;
+    }
+    if (opt.trace) {
+        printf("%s: %u channels, %.0f ms\n", opt.trace, keys, opt.duration_ms);
+    } else {
+        printf("synthetic session: %u keys, %.0f ms, seed %llu\n", keys, opt.duration_ms, (unsigned long long)opt.seed);
+    }
+    printf("true presses %u, rapid trigger %s\n", presses, opt.rt ? "on" : "off");
+    if (opt.velocity) {
+        if (!opt.trace) printf("%-16s %6s %7s %9s %8s\n", "config", "notes", "missed", "mean err", "max err");
+        return;
+    }
+    printf("%-16s %8s %8s %9s %6s %6s %8s %7s %8s %7s\n", "config", "scan us", "max gap", "press ms", "p99", "max", "release", "missed",
+           "chatter", "qmk ms");
+}
+
+// Note point crossing and ideal velocity of every synthetic stroke that
+// reaches the note point before end
+static size_t true_strokes(note_t **out, double end) {
+    double start_mm = HALL_VELOCITY_START_TRAVEL / 100.0, note_mm = HALL_VELOCITY_NOTE_TRAVEL / 100.0;
+    size_t n = 0, cap = 0;
+    *out = NULL;
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        const session_channel_t *s = &session[ch];
+        for (size_t i = 0; i < s->seg_n; i++) {
+            const segment_t *seg = &s->seg[i];
+            if (seg->x0 != 0.0 || seg->x1 < note_mm) continue;
+            double speed = seg->x1 / (seg->t1 - seg->t0);  // mm per us
+            double t = seg->t0 + note_mm / speed;
+            if (t < end) PUSH(*out, n, cap, ((note_t){t, ch, hall_velocity_curve((uint32_t)((note_mm - start_mm) / speed))}));
+        }
+    }
+    return n;
+}
+
+static bool report_velocity(void) {
+    if (opt.trace) {
+        // No ground truth in a capture: list what this configuration plays
+        printf("%s: %zu notes\n", SIM_NAME, notes_n);
+        for (size_t i = 0; i < notes_n; i++) {
+            printf("  %10.3f ms  ch %2u  velocity %3u\n", notes[i].t / 1000, notes[i].ch, notes[i].velocity);
+        }
+        return true;
+    }
+
+    note_t *strokes;
+    size_t strokes_n = true_strokes(&strokes, session_us - SIM_VELOCITY_WINDOW_US);
+    unsigned missed = 0, worst = 0, matched = 0;
+    double error_sum = 0;
+    for (size_t i = 0; i < strokes_n; i++) {
+        size_t j = 0;
+        while (j < notes_n && (notes[j].ch != strokes[i].ch || fabs(notes[j].t - strokes[i].t) > SIM_VELOCITY_WINDOW_US)) j++;
+        if (j == notes_n) {
+            missed++;
+            continue;
+        }
+        unsigned error = abs((int)notes[j].velocity - (int)strokes[i].velocity);
+        error_sum += error;
+        if (error > worst) worst = error;
+        matched++;
+    }
+    printf("%-16s %6zu %7u %9.2f %8u\n", SIM_NAME, notes_n, missed, matched ? error_sum / matched : NAN, worst);
+    free(strokes);
+    return missed == 0;
+}
+
+static bool report(void) {
+    hall_stats_t stats;
+    hall_stats_read(&stats);
+    score_t sc = score(decided, decided_n);
+    score_t qmk = score(matrix_events, matrix_n);
+
+    printf("%-16s %8.1f %8u %9.3f %6.3f %6.3f %8.3f %7u %8u %7.3f\n", SIM_NAME, stats.scans ? session_us / stats.scans : NAN,
+           stats.stall_us_max, mean(sc.press, sc.press_n) / 1000, pct(sc.press, sc.press_n, 0.99) / 1000,
+           pct(sc.press, sc.press_n, 1.0) / 1000, mean(sc.release, sc.release_n) / 1000, sc.missed, sc.spurious,
+           mean(qmk.press, qmk.press_n) / 1000);
+    return sc.missed == 0 && sc.spurious == 0;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --trace FILE          capture CSV (time_us,channel,adc) instead of a synthetic session\n"
+            "  --duration MS         synthetic session length (1000)\n"
+            "  --seed N              synthetic session seed (1)\n"
+            "  --rt                  Rapid Trigger on\n"
+            "  --rest N              synthetic rest level, ADC counts (1900)\n"
+            "  --span N              synthetic rest to bottom-out span (1400)\n"
+            "  --noise SIGMA         synthetic noise, ADC counts (6)\n"
+            "  --tau US              mux output settle time constant (2)\n"
+            "  --adc US              one analogReadPin() (2)\n"
+            "  --gpio US             one writePin() (0.1)\n"
+            "  --process-us US       process_samples() work besides the mocked calls (25)\n"
+            "  --loop-us US          rest of the core 0 main loop per pass (50)\n"
+            "  --irq-us US           DMA IRQ entry latency (1)\n"
+            "  --stall-ms MS         core 0 stall, e.g. a display frame (0)\n"
+            "  --stall-every-ms MS   period of the stall (50)\n"
+            "  --dma-channels N      DMA channels left free for the engine (12)\n"
+            "  --velocity            every key a MIDI note; score the velocities\n"
+            "  --header              print the session and table header only\n"
+            "  --check               exit 1 on missed presses or chatter\n"
+            "  -v                    print the firmware's console output\n",
+            prog);
+    exit(2);
+}
+
+static void parse_options(int argc, char **argv) {
+    static const struct option options[] = {
+        {"trace", required_argument, NULL, 't'},          {"duration", required_argument, NULL, 'd'},
+        {"seed", required_argument, NULL, 's'},           {"rt", no_argument, NULL, 'r'},
+        {"rest", required_argument, NULL, 'R'},           {"span", required_argument, NULL, 'S'},
+        {"noise", required_argument, NULL, 'n'},          {"tau", required_argument, NULL, 'T'},
+        {"adc", required_argument, NULL, 'a'},            {"gpio", required_argument, NULL, 'g'},
+        {"process-us", required_argument, NULL, 'p'},     {"loop-us", required_argument, NULL, 'l'},
+        {"irq-us", required_argument, NULL, 'i'},         {"stall-ms", required_argument, NULL, 'm'},
+        {"stall-every-ms", required_argument, NULL, 'e'}, {"dma-channels", required_argument, NULL, 'D'},
+        {"velocity", no_argument, NULL, 'V'},
+        {"header", no_argument, NULL, 'H'},               {"check", no_argument, NULL, 'c'},
+        {"help", no_argument, NULL, 'h'},                 {NULL, 0, NULL, 0},
+    };
+    int c;
+    while ((c = getopt_long(argc, argv, "v", options, NULL)) != -1) {
+        switch (c) {
+            case 't': opt.trace = optarg; break;
+            case 'd': opt.duration_ms = atof(optarg); break;
+            case 's': opt.seed = strtoull(optarg, NULL, 0); break;
+            case 'r': opt.rt = true; break;
+            case 'R': opt.rest = atof(optarg); break;
+            case 'S': opt.span = atof(optarg); break;
+            case 'n': opt.noise = atof(optarg); break;
+            case 'T': sim_params.tau_us = atof(optarg); break;
+            case 'a': sim_params.adc_us = atof(optarg); break;
+            case 'g': sim_params.gpio_us = atof(optarg); break;
+            case 'p': sim_params.process_us = atof(optarg); break;
+            case 'l': opt.loop_us = atof(optarg); break;
+            case 'i': sim_params.irq_us = atof(optarg); break;
+            case 'm': opt.stall_ms = atof(optarg); break;
+            case 'e': opt.stall_every_ms = atof(optarg); break;
+            case 'D': opt.dma_channels = atoi(optarg); break;
+            case 'V': opt.velocity = true; break;
+            case 'H': opt.header = true; break;
+            case 'c': opt.check = true; break;
+            case 'v': sim_verbose = true; break;
+            default: usage(argv[0]);
+        }
+    }
+    if (optind != argc || opt.duration_ms <= 0 || opt.stall_every_ms <= 0 || opt.dma_channels < 0 ||
+        opt.dma_channels > NUM_DMA_CHANNELS)
+        usage(argv[0]);
+}
+
+int main(int argc, char **argv) {
+    parse_options(argc, argv);
+    rng_state = opt.seed * 0x9E3779B97F4A7C15ULL + 1;
+    if (opt.trace) {
+        trace_session();
+    } else {
+        synthetic_session();
+    }
+    if (opt.header) {
+        print_header();
+        return 0;
+    }
+
+    sim_sensor = session_level;
+    sim_config_load = store_calibration;
+    if (opt.velocity) {
+        sim_keycode = midi_keycode;
+        sim_midi_note = record_note;
+    }
+    simulate();
+
+    bool clean = opt.velocity ? report_velocity() : report();
+    return opt.check && !clean ? 1 : 0;
+}
@@ -0,0 +1,136 @@
+// test_engine.c - hall_engine.c on the simulated ADC and DMA
+//
+// Every channel sits at its own level, so a block harvested into the wrong
+// channel shows up as a wrong value. Checks the snapshot handoff (nothing
+// before the first pass, each pass consumed once) and that an IRQ held off
+// past the settle margin, or past whole blocks, neither lets the DMA write
+// outside the blocks nor attributes samples to the wrong select code.
+// With a single DMA channel free, init must fail without keeping it or
+// touching the ADC.
+#include "hall_engine.c"
+
+#include <stdlib.h>
+#include <math.h>
+#include "host_sim.h"
+#include "check.h"
+#include "shego16.h"
+
+#define SETTLE_US 14
+
+// The board's populated select codes; the others must stay 0
+static const uint8_t selects[] = {0, 1, 6, 7, 8, 9, 14, 15};
+
+static double level(uint8_t ch, double t) {
+    (void)t;
+    return ch < HALL_MUX_CHANNELS ? 600 + 97 * ch : 700 + 83 * (ch - HALL_MUX_CHANNELS);
+}
+
+static bool visited(uint8_t sel) {
+    for (uint8_t i = 0; i < sizeof(selects); i++) {
+        if (selects[i] == sel) return true;
+    }
+    return false;
+}
+
+static uint32_t snapshots;
+static uint32_t last_time_us;
+static double last_snapshot_at;
+static double max_gap_us;
+
+static void check_snapshot(const hall_snapshot_t *s) {
+    for (uint8_t ch = 0; ch < HALL_CHANNELS; ch++) {
+        int expected = visited(ch & (HALL_MUX_CHANNELS - 1)) ? (int)level(ch, 0) : 0;
+        CHECK(abs(s->adc[ch] - expected) <= 1, "snapshot %u ch %u: %u, expected %d", snapshots, ch, s->adc[ch], expected);
+    }
+    CHECK(s->time_us <= (uint32_t)sim_now(), "snapshot %u from the future: %lu at %.1f", snapshots, (unsigned long)s->time_us, sim_now());
+    CHECK(!snapshots || s->time_us > last_time_us, "snapshot %u not newer: %lu after %lu", snapshots, (unsigned long)s->time_us,
+          (unsigned long)last_time_us);
+    if (snapshots && sim_now() - last_snapshot_at > max_gap_us) max_gap_us = sim_now() - last_snapshot_at;
+    last_time_us = s->time_us;
+    last_snapshot_at = sim_now();
+    snapshots++;
+}
+
+// Run for us, polling every microsecond like a spinning consumer
+static void run(double us) {
+    uintptr_t lo = (uintptr_t)block, hi = lo + sizeof(block);
+    for (double end = sim_now() + us; sim_now() < end;) {
+        sim_cpu(1);
+        uint32_t write = dma_hw->ch[data_chan].write_addr;
+        CHECK(write >= lo && write <= hi, "DMA write address %#lx outside the blocks at %.1f", (unsigned long)write, sim_now());
+        CHECK(!(adc_hw->fcs & ADC_FCS_OVER_BITS), "ADC FIFO overflow at %.1f", sim_now());
+
+        hall_snapshot_t s;
+        if (!hall_engine_poll(&s)) continue;
+        check_snapshot(&s);
+        CHECK(!hall_engine_poll(&s), "snapshot %u consumed twice", snapshots);
+    }
+}
+
+// One IRQ entered late_us after its block completed; the next scans must
+// still be right and keep coming
+static void late_irq(const char *name, double late_us, double block_us, double period_us) {
+    uint32_t before = snapshots;
+    sim_params.irq_us = late_us;
+    run(block_us);
+    sim_params.irq_us = 1.0;
+    max_gap_us = 0;
+    run(4 * period_us);
+    CHECK(snapshots - before >= 3, "%s: %u passes in %.0f us", name, snapshots - before, 4 * period_us);
+    // The blocks filled while it was held off, and the one it finds
+    // half-filled, repeat the select code they were on
+    double lost_us = (ceil(late_us / block_us) + 1) * block_us;
+    CHECK(max_gap_us <= period_us + lost_us, "%s: %.1f us between passes", name, max_gap_us);
+}
+
+// Init with only one DMA channel left
+static void init_without_channels(void) {
+    const rp_dma_channel_t *taken[NUM_DMA_CHANNELS];
+    uint8_t n = 0;
+    while (n < NUM_DMA_CHANNELS - 1) taken[n++] = dmaChannelAlloc(RP_DMA_CHANNEL_ID_ANY, RP_IRQ_DMA0_PRIORITY, NULL, NULL);
+
+    uint32_t cs = adc_hw->cs, fcs = adc_hw->fcs;
+    CHECK(!hall_engine_init(SETTLE_US, selects, sizeof(selects)), "init succeeded with one DMA channel");
+    CHECK(adc_hw->cs == cs && adc_hw->fcs == fcs, "failed init left the ADC at cs %#lx fcs %#lx", (unsigned long)adc_hw->cs,
+          (unsigned long)adc_hw->fcs);
+
+    const rp_dma_channel_t *last = dmaChannelAlloc(RP_DMA_CHANNEL_ID_ANY, RP_IRQ_DMA0_PRIORITY, NULL, NULL);
+    CHECK(last != NULL, "failed init kept its DMA channel");
+    if (last) dmaChannelFree(last);
+    while (n) dmaChannelFree(taken[--n]);
+}
+
+int main(void) {
+    sim_sensor = level;
+    kb_config_load();
+    hall_adc_init();
+    hall_adc_hw_init();
+    writePinLow(GP14);
+    writePinLow(GP15);
+    init_without_channels();
+    CHECK(hall_engine_init(SETTLE_US, selects, sizeof(selects)), "init failed");
+
+    double period_us = hall_engine_scan_period_us();
+    double block_us = pairs * HALL_ENGINE_PAIR_US;
+    CHECK(pairs >= HALL_OVERSAMPLE + (SETTLE_US + HALL_ENGINE_IRQ_MARGIN_US) / HALL_ENGINE_PAIR_US, "%u pairs per block", pairs);
+    CHECK(period_us == sizeof(selects) * block_us, "pass of %.0f us", period_us);
+
+    // Nothing before the first pass
+    hall_snapshot_t s;
+    CHECK(!hall_engine_poll(&s), "snapshot before any pass");
+    run(period_us / 2);
+    CHECK(snapshots == 0, "%u snapshots after half a pass", snapshots);
+
+    // Every pass consumed once, values per channel
+    max_gap_us = 0;
+    run(10 * period_us);
+    CHECK(snapshots >= 9 && snapshots <= 11, "%u snapshots in 10.5 passes", snapshots);
+    CHECK(snapshots == hall_engine_scan_count(), "%u snapshots for %lu passes", snapshots, (unsigned long)hall_engine_scan_count());
+    CHECK(max_gap_us <= period_us + 2, "%.1f us between passes", max_gap_us);
+
+    late_irq("IRQ past the margin", HALL_ENGINE_IRQ_MARGIN_US + block_us / 2, block_us, period_us);
+    late_irq("IRQ past a block", 1.5 * block_us, block_us, period_us);
+    late_irq("IRQ past two blocks", 2.5 * block_us, block_us, period_us);
+
+    return check_report("test_engine");
+}
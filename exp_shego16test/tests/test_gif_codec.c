@@ -0,0 +1,233 @@
+// test_gif_codec.c - gif_codec.c against the packed animations and a port
+// of the gif2_pack.py encoder
+//
+// The packed headers are replayed the way display.c plays them (frame 0
+// whole, then each entry's rectangles a row at a time) and every frame is
+// compared with the raw frames they were packed from; each entry must use
+// exactly its bytes. Synthetic images go through the encoder port and
+// back, and the decoder is resumed at awkward pixel counts.
+//
+// --bench [passes] times decoding every frame of the main animation.
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gif_codec.h"
+#include "check.h"
+
+#include "gif/gif.h"
+#define gif_delays gif_packed_delays
+#include "gif/gif_packed.h"
+#undef gif_delays
+
+#include "gif/init.h"
+#define init_gif_delays init_gif_packed_delays
+#include "gif/init_packed.h"
+#undef init_gif_delays
+
+#define SIDE 128
+#define PIXELS (SIDE * SIDE)
+#define MAX_RUN 62
+
+typedef struct {
+    const char *name;
+    uint16_t frames;
+    bool wrap;
+    const uint16_t *pixels;  // raw frames, PIXELS each
+    const uint8_t *packed;
+    const uint32_t *offsets;
+    const uint16_t *rect_index;
+    const uint8_t (*rects)[4];
+} anim_t;
+
+static const anim_t anims[] = {
+    {"gif", GIF_FRAMES, GIF_WRAP, gif_pixels, gif_packed, gif_packed_offsets, gif_rect_index, gif_rects},
+    {"init", INIT_GIF_FRAMES, INIT_GIF_WRAP, init_gif_pixels, init_gif_packed, init_gif_packed_offsets, init_gif_rect_index,
+     init_gif_rects},
+};
+
+// Decode entry e over frame, a row of each rectangle at a time; returns the
+// bytes it used
+static size_t play_entry(const anim_t *a, uint16_t e, uint16_t frame[]) {
+    gif_codec_t d;
+    const uint8_t *start = &a->packed[a->offsets[e]];
+    gif_codec_begin(&d, start);
+    for (uint16_t r = a->rect_index[e]; r < a->rect_index[e + 1]; r++) {
+        const uint8_t *rect = a->rects[r];
+        for (uint8_t y = rect[1]; y <= rect[3]; y++) {
+            gif_codec_decode(&d, &frame[y * SIDE + rect[0]], rect[2] - rect[0] + 1);
+        }
+    }
+    return d.src - start;
+}
+
+static void check_anim(const anim_t *a) {
+    static uint16_t frame[PIXELS];
+    uint16_t entries = a->frames + a->wrap;
+    for (uint16_t e = 0; e < entries; e++) {
+        size_t used = play_entry(a, e, frame);
+        size_t size = a->offsets[e + 1] - a->offsets[e];
+        CHECK(used == size, "%s entry %u: decoded %zu of %zu bytes", a->name, e, used, size);
+
+        uint16_t shown = e < a->frames ? e : 0;
+        const uint16_t *expected = &a->pixels[(size_t)shown * PIXELS];
+        for (uint32_t i = 0; i < PIXELS; i++) {
+            if (frame[i] == expected[i]) continue;
+            CHECK(false, "%s entry %u: pixel %lu,%lu is %04X, frame %u has %04X", a->name, e, (unsigned long)(i % SIDE),
+                  (unsigned long)(i / SIDE), frame[i], shown, expected[i]);
+            break;
+        }
+    }
+}
+
+// Port of encode() in gif2_pack.py
+static inline uint8_t slot(uint16_t c) {
+    return ((c >> 11) * 3 + ((c >> 5) & 63) * 5 + (c & 31) * 7) & 63;
+}
+
+static size_t encode(const uint16_t *px, size_t count, uint8_t *out) {
+    uint16_t table[64] = {0};
+    uint16_t prev = 0;
+    uint8_t run = 0;
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint16_t c = px[i];
+        if (c == prev) {
+            if (++run == MAX_RUN) {
+                out[n++] = GIF_CODEC_OP_RUN | (run - 1);
+                run = 0;
+            }
+            continue;
+        }
+        if (run) {
+            out[n++] = GIF_CODEC_OP_RUN | (run - 1);
+            run = 0;
+        }
+
+        uint8_t s = slot(c);
+        if (table[s] == c) {
+            out[n++] = s;
+        } else {
+            table[s] = c;
+            int dr = (c >> 11) - (prev >> 11), dg = ((c >> 5) & 63) - ((prev >> 5) & 63), db = (c & 31) - (prev & 31);
+            int dr_dg = dr - (dg >> 1), db_dg = db - (dg >> 1);
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                out[n++] = GIF_CODEC_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2);
+            } else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+                out[n++] = GIF_CODEC_OP_LUMA | (dg + 32);
+                out[n++] = (dr_dg + 8) << 4 | (db_dg + 8);
+            } else {
+                out[n++] = GIF_CODEC_OP_RGB;
+                out[n++] = c >> 8;
+                out[n++] = c & 0xFF;
+            }
+        }
+        prev = c;
+    }
+    if (run) out[n++] = GIF_CODEC_OP_RUN | (run - 1);
+    return n;
+}
+
+// Encode, then decode in chunks of chunk pixels
+static void round_trip(const char *name, const uint16_t *px, size_t count, uint16_t chunk) {
+    static uint8_t packed[3 * PIXELS];
+    static uint16_t out[PIXELS];
+    size_t size = encode(px, count, packed);
+    CHECK(size <= 3 * count, "%s: %zu bytes for %zu pixels", name, size, count);
+
+    gif_codec_t d;
+    gif_codec_begin(&d, packed);
+    for (size_t i = 0; i < count; i += chunk) {
+        gif_codec_decode(&d, &out[i], count - i < chunk ? count - i : chunk);
+    }
+    CHECK((size_t)(d.src - packed) == size, "%s, chunks of %u: decoded %zu of %zu bytes", name, chunk, (size_t)(d.src - packed), size);
+    for (size_t i = 0; i < count; i++) {
+        if (out[i] == px[i]) continue;
+        CHECK(false, "%s, chunks of %u: pixel %zu is %04X, expected %04X", name, chunk, i, out[i], px[i]);
+        break;
+    }
+}
+
+static uint32_t rng = 1;
+
+static uint16_t random16(void) {
+    rng = rng * 1103515245u + 12345u;
+    return rng >> 16;
+}
+
+static void synthetic(void) {
+    static uint16_t px[PIXELS];
+    static const uint16_t chunks[] = {1, 7, MAX_RUN - 1, MAX_RUN, MAX_RUN + 1, SIDE, PIXELS};
+
+    // Runs either side of the longest RUN op, from black and from a colour
+    size_t n = 0;
+    for (uint16_t len = 1; len <= 3 * MAX_RUN + 1 && n + 2 * len < PIXELS; len++) {
+        for (uint16_t i = 0; i < len; i++) px[n++] = 0;
+        for (uint16_t i = 0; i < len; i++) px[n++] = 0x1234 + len;
+    }
+    for (uint8_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) round_trip("runs", px, n, chunks[c]);
+
+    // Every DIFF and LUMA step from colours near both ends of each channel
+    static const uint16_t bases[] = {0x0000, 0xFFFF, 0x8410, 0x0841, 0xF7DE};
+    n = 0;
+    for (uint8_t b = 0; b < sizeof(bases) / sizeof(bases[0]); b++) {
+        for (int dg = -33; dg <= 32; dg++) {
+            for (int drb = -10; drb <= 9; drb++) {
+                uint16_t base = bases[b];
+                int r = (base >> 11) + drb + (dg >> 1), g = ((base >> 5) & 63) + dg, bl = (base & 31) - drb + (dg >> 1);
+                if (r < 0 || r > 31 || g < 0 || g > 63 || bl < 0 || bl > 31) continue;
+                px[n++] = base;
+                px[n++] = (uint16_t)(r << 11 | g << 5 | bl);
+            }
+        }
+    }
+    for (uint8_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) round_trip("steps", px, n, chunks[c]);
+
+    // Noise (literals and table hits) and a smooth gradient
+    for (uint32_t i = 0; i < PIXELS; i++) px[i] = i % 3 ? random16() : random16() & 0x0841;
+    for (uint8_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) round_trip("noise", px, PIXELS, chunks[c]);
+    for (uint32_t i = 0; i < PIXELS; i++) {
+        uint8_t x = i % SIDE, y = i / SIDE;
+        px[i] = (x >> 2) << 11 | ((x + y) >> 2) << 5 | (y >> 2);
+    }
+    for (uint8_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) round_trip("gradient", px, PIXELS, chunks[c]);
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Host timing only: relative numbers for comparing decoder changes, not
+// the RP2040's speed
+static void bench(unsigned passes) {
+    static uint16_t frame[PIXELS];
+    const anim_t *a = &anims[0];
+    uint64_t pixels = 0;
+    double start = now_s();
+    for (unsigned p = 0; p < passes; p++) {
+        for (uint16_t e = 0; e < a->frames; e++) {
+            play_entry(a, e, frame);
+            for (uint16_t r = a->rect_index[e]; r < a->rect_index[e + 1]; r++) {
+                const uint8_t *rect = a->rects[r];
+                pixels += (rect[2] - rect[0] + 1) * (rect[3] - rect[1] + 1);
+            }
+        }
+    }
+    double s = now_s() - start;
+    size_t bytes = a->offsets[a->frames] - a->offsets[0];
+    printf("gif_codec: %u passes of %u frames (%zu bytes): %.2f ns/pixel, %.1f MB/s in, %.0f us per frame\n", passes, a->frames,
+           bytes, s * 1e9 / pixels, bytes * passes / s / 1e6, s * 1e6 / (passes * a->frames));
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && !strcmp(argv[1], "--bench")) {
+        bench(argc > 2 ? (unsigned)atoi(argv[2]) : 200);
+        return 0;
+    }
+    for (uint8_t i = 0; i < sizeof(anims) / sizeof(anims[0]); i++) check_anim(&anims[i]);
+    synthetic();
+    return check_report("test_gif_codec");
+}
@@ -0,0 +1,134 @@
+// test_rapid_trigger.c - Rapid Trigger decisions replayed from travel traces
+//
+// Feeds rapid_trigger_state() one key's travel per scan, the way
+// process_samples() does, and counts the transitions. Noise smaller than
+// the Rapid Trigger deltas must not toggle a key resting at the actuation
+// point, at the release point or anywhere in between; strokes that reverse
+// by more than the deltas must.
+#include "shego_adc.c"
+
+#include "check.h"
+
+#define KEY 0
+#define THRESHOLD HALL_ACTUATION_TRAVEL
+#define RELEASE (THRESHOLD - HALL_HYSTERESIS_TRAVEL)
+
+// Noise amplitude, under both deltas
+#define NOISE 8
+
+#define TRACE_MAX 8192
+
+typedef struct {
+    uint16_t travel[TRACE_MAX];
+    uint16_t n;
+} trace_t;
+
+typedef struct {
+    uint16_t at;  // trace sample
+    bool pressed;
+} transition_t;
+
+static uint32_t rng = 1;
+
+static int16_t noise(void) {
+    rng = rng * 1103515245u + 12345u;
+    return (int16_t)((rng >> 16) % (2 * NOISE + 1)) - NOISE;
+}
+
+// Straight from the last sample (or 0) to travel in samples steps
+static void ramp(trace_t *t, uint16_t travel, uint16_t samples) {
+    int32_t from = t->n ? t->travel[t->n - 1] : 0;
+    for (uint16_t i = 1; i <= samples && t->n < TRACE_MAX; i++) {
+        t->travel[t->n++] = (uint16_t)(from + ((int32_t)travel - from) * i / samples);
+    }
+}
+
+// Held at travel with noise
+static void hold(trace_t *t, uint16_t travel, uint16_t samples) {
+    for (uint16_t i = 0; i < samples && t->n < TRACE_MAX; i++) {
+        int32_t v = (int32_t)travel + noise();
+        t->travel[t->n++] = (uint16_t)(v < 0 ? 0 : v);
+    }
+}
+
+// Replay from a released key at rest; returns the transitions
+static uint8_t replay(const trace_t *t, transition_t out[], uint8_t max) {
+    uint8_t n = 0;
+    key_pressed[KEY] = false;
+    key_extreme[KEY] = 0;
+    for (uint16_t i = 0; i < t->n; i++) {
+        bool pressed = rapid_trigger_state(KEY, t->travel[i], THRESHOLD);
+        if (pressed == key_pressed[KEY]) continue;
+        key_pressed[KEY] = pressed;
+        if (n < max) out[n] = (transition_t){i, pressed};
+        n++;
+    }
+    return n;
+}
+
+static void expect(const char *name, const trace_t *t, const bool expected[], uint8_t count) {
+    transition_t got[16];
+    uint8_t n = replay(t, got, 16);
+    CHECK(n == count, "%s: %u transitions, expected %u", name, n, count);
+    for (uint8_t i = 0; i < n && i < count; i++) {
+        CHECK(got[i].pressed == expected[i], "%s: transition %u at sample %u is a %s", name, i, got[i].at,
+              got[i].pressed ? "press" : "release");
+    }
+}
+
+int main(void) {
+    static trace_t t;
+
+    // Resting on the actuation point
+    t.n = 0;
+    ramp(&t, THRESHOLD, 20);
+    hold(&t, THRESHOLD, 4000);
+    expect("held at the actuation point", &t, (const bool[]){true}, 1);
+
+    // Let up to the release point and resting there
+    t.n = 0;
+    ramp(&t, 300, 20);
+    ramp(&t, RELEASE, 20);
+    hold(&t, RELEASE, 4000);
+    expect("held at the release point", &t, (const bool[]){true, false}, 2);
+
+    // Resting between the two points, coming from above and from below
+    t.n = 0;
+    ramp(&t, 300, 20);
+    ramp(&t, (THRESHOLD + RELEASE) / 2, 20);
+    hold(&t, (THRESHOLD + RELEASE) / 2, 4000);
+    expect("held between the points from above", &t, (const bool[]){true, false}, 2);
+    t.n = 0;
+    ramp(&t, (THRESHOLD + RELEASE) / 2, 20);
+    hold(&t, (THRESHOLD + RELEASE) / 2, 4000);
+    expect("held between the points from below", &t, NULL, 0);
+
+    // Held down deep
+    t.n = 0;
+    ramp(&t, 300, 20);
+    hold(&t, 300, 4000);
+    expect("held down", &t, (const bool[]){true}, 1);
+
+    // Rapid presses: reversals past the deltas, well above the release point
+    t.n = 0;
+    ramp(&t, 300, 20);
+    for (uint8_t i = 0; i < 5; i++) {
+        ramp(&t, 300 - RAPID_TRIGGER_RELEASE_DELTA - 2 * NOISE, 10);
+        hold(&t, 300 - RAPID_TRIGGER_RELEASE_DELTA - 2 * NOISE, 200);
+        ramp(&t, 300, 10);
+        hold(&t, 300, 200);
+    }
+    ramp(&t, 0, 20);
+    expect("rapid presses", &t, (const bool[]){true, false, true, false, true, false, true, false, true, false, true, false}, 12);
+
+    // A slow stroke releases as soon as it rises the release delta
+    t.n = 0;
+    ramp(&t, 300, 20);
+    ramp(&t, 0, 300);
+    transition_t got[4];
+    uint8_t n = replay(&t, got, 4);
+    CHECK(n == 2 && t.travel[got[1].at] + RAPID_TRIGGER_RELEASE_DELTA + 1 >= 300, "slow stroke: %u transitions, released at %u",
+          n, n == 2 ? t.travel[got[1].at] : 0);
+
+    return check_report("test_rapid_trigger");
+}
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+# adc_dnl.py
+# Host check for the hall_adc.c DNL correction: models an RP2040 ADC whose
+# codes 512, 1536, 2560 and 3584 are wider than the rest, sweeps a noisy
+# input across them, averages HALL_OVERSAMPLE reads like the scan does, and
+# prints the transfer curve error with and without the correction table.
+#
+# With --histogram it instead estimates the per-unit extra widths from a
+# code-density test (CSV "code,count" of raw adc_read() codes for an input
+# ramping slowly and evenly across the range) and prints them for
+# `shego_hid.py dnl --set`.
+#
+# Usage: python adc_dnl.py [--extra 128] [--true-extra 150] [--noise 2] [-o curve.csv]
+#        python adc_dnl.py --histogram codes.csv
+import argparse
+import random
+import sys
+
+FRAC_BITS = 4        # hall_adc.h HALL_ADC_FRAC_BITS
+WIDE_CODES = [512, 1536, 2560, 3584]
+OVERSAMPLE = 4       # hall_filter.h HALL_OVERSAMPLE
+DEFAULT_EXTRA = 128  # hall_adc.h HALL_ADC_DNL_DEFAULT, 1/16 LSB
+
+
+def build_lut(extra):
+    """Mirror of hall_adc.c build()."""
+    base = (4096 << FRAC_BITS) - sum(extra)
+    half = 1 << (FRAC_BITS - 1)
+    lut, lower, below = [], 0, 0
+    for code in range(4096):
+        if code & 1023 == 512:
+            below += extra[code >> 10]
+        upper = (code + 1) * base // 4096 + below
+        centre = (lower + upper) // 2
+        lut.append(centre - half if centre > half else 0)
+        lower = upper
+    return lut
+
+
+def edges(extra_lsb):
+    """Upper input edge (LSB) of every code of the modelled ADC."""
+    width = (4096 - sum(extra_lsb)) / 4096
+    out, x = [], 0.0
+    for code in range(4096):
+        x += width + (extra_lsb[code >> 10] if code & 1023 == 512 else 0.0)
+        out.append(x)
+    return out
+
+
+def convert(upper, v):
+    lo, hi = 0, 4095
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if upper[mid] > v:
+            hi = mid
+        else:
+            lo = mid + 1
+    return lo
+
+
+def average(codes, lut):
+    """Mirror of the oversampled read: sum of corrected codes, rounded."""
+    div = len(codes) << FRAC_BITS
+    return (sum(lut[c] for c in codes) + div // 2) // div
+
+
+def sweep(args):
+    true_extra = [args.true_extra / 16.0] * 4
+    upper = edges(true_extra)
+    identity = [c << FRAC_BITS for c in range(4096)]
+    corrected = build_lut([args.extra] * 4)
+    rnd = random.Random(args.seed)
+
+    rows = []
+    for spike in WIDE_CODES:
+        v = spike - args.span
+        while v < spike + args.span:
+            raw_sum = fix_sum = 0.0
+            for _ in range(args.repeats):
+                codes = [convert(upper, v + rnd.gauss(0, args.noise)) for _ in range(OVERSAMPLE)]
+                raw_sum += average(codes, identity)
+                fix_sum += average(codes, corrected)
+            rows.append((v, raw_sum / args.repeats, fix_sum / args.repeats))
+            v += args.step
+    return rows
+
+
+def report(rows, args):
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write("input_lsb,raw,corrected\n")
+            for v, raw, fix in rows:
+                f.write(f"{v:.3f},{raw:.3f},{fix:.3f}\n")
+        print(f"{len(rows)} points -> {args.output}")
+
+    # The modelled ADC is ideal apart from the wide codes, so the expected
+    # reading is the input itself (less the half-LSB code centre offset)
+    print(f"wide codes {args.true_extra / 16:.1f} LSB extra, table built for {args.extra / 16:.1f}, "
+          f"noise {args.noise} LSB, {OVERSAMPLE}x oversampling")
+    print(f"{'code':>6}  {'max error raw / corrected':>26}  {'away from code':>16}  {'flat run raw / corrected':>25}")
+    for spike in WIDE_CODES:
+        near = [r for r in rows if abs(r[0] - spike) < args.span]
+        away = [r for r in near if abs(r[0] - spike) > args.true_extra / 32 + 2]
+        raw_err = max(abs(raw - (v - 0.5)) for v, raw, _ in near)
+        fix_err = max(abs(fix - (v - 0.5)) for v, _, fix in near)
+        raw_away = max(abs(raw - (v - 0.5)) for v, raw, _ in away)
+        fix_away = max(abs(fix - (v - 0.5)) for v, _, fix in away)
+        print(f"{spike:6d}  {raw_err:11.2f} / {fix_err:5.2f} LSB  {raw_away:7.2f} / {fix_away:4.2f}  "
+              f"{flat_run(near, 1, args):12.1f} / {flat_run(near, 2, args):4.1f} LSB")
+
+
+def flat_run(rows, column, args):
+    """Longest input range over which the mean reading moved less than a
+    quarter of the input: the 'sticky' zone a threshold would sit in."""
+    longest = run = 0.0
+    for a, b in zip(rows, rows[1:]):
+        if b[column] - a[column] < 0.25 * (b[0] - a[0]):
+            run += b[0] - a[0]
+            longest = max(longest, run)
+        else:
+            run = 0.0
+    return longest
+
+
+def from_histogram(path):
+    counts = {}
+    with open(path) as f:
+        for line in f:
+            parts = line.strip().split(",")
+            if len(parts) >= 2 and parts[0].isdigit():
+                counts[int(parts[0])] = int(parts[1])
+    extra = []
+    for spike in WIDE_CODES:
+        neighbours = [counts.get(c, 0) for c in range(spike - 32, spike + 33) if c != spike]
+        mean = sum(neighbours) / len(neighbours) if neighbours else 0
+        if not mean or spike not in counts:
+            raise SystemExit(f"{path}: not enough hits around code {spike}")
+        width = counts[spike] / mean  # in LSB of a normal code
+        extra.append(max(0, min(255, round((width - 1) * 16))))
+        print(f"code {spike}: {width:.2f} LSB wide")
+    print("shego_hid.py dnl --set " + " ".join(str(e) for e in extra))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="RP2040 ADC DNL correction check (hall_adc.c)")
+    ap.add_argument("--extra", type=int, default=DEFAULT_EXTRA,
+                    help="extra width the table is built for, 1/16 LSB")
+    ap.add_argument("--true-extra", type=int, default=DEFAULT_EXTRA,
+                    help="extra width of the modelled ADC's wide codes, 1/16 LSB")
+    ap.add_argument("--noise", type=float, default=2.0, help="input noise sigma in LSB")
+    ap.add_argument("--span", type=float, default=12.0, help="LSB swept either side of each wide code")
+    ap.add_argument("--step", type=float, default=0.1, help="sweep step in LSB")
+    ap.add_argument("--repeats", type=int, default=200, help="oversampled reads averaged per step")
+    ap.add_argument("--seed", type=int, default=1)
+    ap.add_argument("-o", "--output", help="write input,raw,corrected to CSV")
+    ap.add_argument("--histogram", help="estimate per-unit widths from a code,count CSV")
+    args = ap.parse_args()
+
+    if args.histogram:
+        from_histogram(args.histogram)
+    else:
+        report(sweep(args), args)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# filter_bench.py
+# Host benchmark for the hall_filter.c stages: runs the same integer median3
+# and EMA arithmetic over a trace and reports noise against added latency.
+#
+# A trace is a text/CSV file with one raw ADC sample per line (first column
+# used), one line per scan. Without a trace a synthetic press is generated:
+# rest -> bottom-out ramp with gaussian noise and occasional spikes.
+#
+# Usage: python filter_bench.py [trace.csv]
+import random
+import statistics
+import sys
+
+EMA_FRAC_BITS = 4  # hall_filter.c HALL_EMA_FRAC_BITS
+
+
+def median3(a, b, c):
+    return sorted((a, b, c))[1]
+
+
+def run(samples, use_median, ema_shift):
+    """Mirror of hall_filter_run() for one channel."""
+    out = []
+    hist = [samples[0], samples[0]]
+    ema = samples[0] << EMA_FRAC_BITS
+    for x in samples:
+        if use_median:
+            m = median3(hist[0], hist[1], x)
+            hist = [hist[1], x]
+            x = m
+        if ema_shift is not None:
+            ema += ((x << EMA_FRAC_BITS) - ema) >> ema_shift
+            x = ema >> EMA_FRAC_BITS
+        out.append(x)
+    return out
+
+
+def synthetic(seed=1):
+    rnd = random.Random(seed)
+    clean = [1900] * 200 + [1900 + int(1400 * i / 40) for i in range(40)] + [3300] * 200
+    noisy = []
+    for v in clean:
+        v += int(rnd.gauss(0, 6))
+        if rnd.random() < 0.01:
+            v += rnd.choice((-1, 1)) * 120  # mux/ADC spike
+        noisy.append(max(0, min(4095, v)))
+    return clean, noisy
+
+
+def reference(samples, width=15):
+    """Centered moving average, used as ground truth for recorded traces."""
+    half = width // 2
+    ref = []
+    for i in range(len(samples)):
+        window = samples[max(0, i - half):i + half + 1]
+        ref.append(sum(window) / len(window))
+    return ref
+
+
+def lag(ref, out, max_lag=16):
+    """Delay in scans that best aligns out with ref."""
+    best, best_err = 0, None
+    for d in range(max_lag + 1):
+        err = sum((out[i + d] - ref[i]) ** 2 for i in range(len(ref) - d))
+        err /= len(ref) - d
+        if best_err is None or err < best_err:
+            best, best_err = d, err
+    return best
+
+
+def main():
+    if len(sys.argv) > 1:
+        with open(sys.argv[1]) as f:
+            raw = [int(line.split(",")[0]) for line in f if line.strip() and line[0].isdigit()]
+        ref = reference(raw)
+        print(f"{sys.argv[1]}: {len(raw)} samples")
+    else:
+        ref, raw = synthetic()
+        print(f"synthetic press: {len(raw)} samples")
+
+    configs = [("none", False, None), ("median3", True, None)]
+    configs += [(f"ema>>{k}", False, k) for k in (1, 2, 3)]
+    configs += [(f"median3+ema>>{k}", True, k) for k in (1, 2, 3)]
+
+    print(f"{'stages':18s} {'noise (rms)':>12s} {'peak err':>9s} {'lag (scans)':>12s}")
+    for name, med, shift in configs:
+        out = run(raw, med, shift)
+        d = lag(ref, out)
+        resid = [out[i + d] - ref[i] for i in range(len(ref) - d)]
+        rms = statistics.pstdev(resid)
+        peak = max(abs(r) for r in resid)
+        print(f"{name:18s} {rms:12.2f} {peak:9.0f} {d:12d}")
+
+
+if __name__ == "__main__":
+    main()
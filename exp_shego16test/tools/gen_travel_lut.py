@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# gen_travel_lut.py
+# Generates hall_travel_lut.h: per switch/magnet profile lookup tables that
+# map a key's calibrated hall reading to travel in 0.01 mm units.
+#
+# The scanner normalizes each sample against the key's rest/bottom-out
+# calibration to an index 0..LUT_STEPS (16.16 fixed point), then
+# interpolates between two table entries. The table bakes in the
+# non-linear field-vs-distance curve of the magnet.
+#
+# Usage (from tools/): python gen_travel_lut.py [--check] > ../hall_travel_lut.h
+import argparse
+import sys
+
+LUT_STEPS = 256
+
+# name: (total travel mm, magnet-to-sensor gap at bottom-out mm, field falloff exponent)
+# Falloff 3 is an axial dipole; 0 generates a straight line for comparison.
+PROFILES = {
+    "linear_4mm": (4.0, 0.0, 0),
+    "dipole_4mm": (4.0, 1.5, 3),
+    "dipole_3_5mm": (3.5, 1.2, 3),
+}
+
+
+def field(x, travel, gap, n):
+    """Relative field at travel x (0 = rest, travel = bottom-out)."""
+    return 1.0 / (gap + travel - x) ** n
+
+
+def normalized(x, travel, gap, n):
+    """Reading at travel x scaled so rest = 0 and bottom-out = 1."""
+    if n == 0:
+        return x / travel
+    f0 = field(0.0, travel, gap, n)
+    f1 = field(travel, travel, gap, n)
+    return (field(x, travel, gap, n) - f0) / (f1 - f0)
+
+
+def travel_for(u, travel, gap, n):
+    lo, hi = 0.0, travel
+    for _ in range(60):
+        mid = (lo + hi) / 2
+        if normalized(mid, travel, gap, n) < u:
+            lo = mid
+        else:
+            hi = mid
+    return (lo + hi) / 2
+
+
+def build(travel, gap, n):
+    return [round(travel_for(k / LUT_STEPS, travel, gap, n) * 100) for k in range(LUT_STEPS + 1)]
+
+
+def check(name, lut, travel, gap, n):
+    """Worst interpolation error against the model, in 0.01 mm."""
+    worst = 0.0
+    for i in range(LUT_STEPS * 16 + 1):
+        u = i / (LUT_STEPS * 16)
+        pos = u * LUT_STEPS
+        k = min(int(pos), LUT_STEPS - 1)
+        interp = lut[k] + (lut[k + 1] - lut[k]) * (pos - k)
+        worst = max(worst, abs(interp - travel_for(u, travel, gap, n) * 100))
+    print(f"{name}: worst interpolation error {worst:.2f} x0.01 mm", file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Generate hall_travel_lut.h")
+    ap.add_argument("--check", action="store_true", help="report interpolation error per profile on stderr")
+    args = ap.parse_args()
+
+    out = sys.stdout
+    out.write("// Auto-generated by tools/gen_travel_lut.py\n")
+    out.write("// Select a profile with HALL_TRAVEL_PROFILE (see hall_travel.h)\n")
+    out.write("#pragma once\n#include <stdint.h>\n\n")
+    out.write(f"#define HALL_TRAVEL_LUT_STEPS {LUT_STEPS}\n\n")
+    for i, name in enumerate(PROFILES):
+        out.write(f"#define HALL_PROFILE_{name.upper()} {i}\n")
+    out.write("\n")
+    for i, (name, (travel, gap, n)) in enumerate(PROFILES.items()):
+        lut = build(travel, gap, n)
+        if args.check:
+            check(name, lut, travel, gap, n)
+        out.write("#if" if i == 0 else "#elif")
+        out.write(f" HALL_TRAVEL_PROFILE == HALL_PROFILE_{name.upper()}\n")
+        out.write(f"// {name}: {travel} mm travel, {gap} mm gap at bottom-out, falloff 1/d^{n}\n")
+        out.write(f"#define HALL_TRAVEL_MAX {round(travel * 100)}\n")
+        out.write("static const uint16_t hall_travel_lut[HALL_TRAVEL_LUT_STEPS + 1] = {\n")
+        for k in range(0, len(lut), 16):
+            out.write(",".join(str(v) for v in lut[k:k + 16]) + ",\n")
+        out.write("};\n")
+    out.write("#else\n#error \"Unknown HALL_TRAVEL_PROFILE\"\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# scan_timing_model.py
+# Host-side model of one full hall-sensor scan in shego_adc.c.
+# Compares the legacy serialized EN toggling against the parallel dual-mux
+# scan and the DMA engine, using the settle time printed by
+# matrix_init_custom() at boot.
+import argparse
+
+MUX_CHANNELS = 16
+MUX_EN_SETTLE_US = 100  # shego_adc.c legacy mode
+LEGACY_SELECT_SETTLE_US = 50  # old fixed wait in select_mux_channel()
+
+# hall_engine.c: one ADC2+ADC3 pair every 4 us, dwell sized past the settle
+ENGINE_PAIR_US = 4
+ENGINE_IRQ_MARGIN_US = 4
+ENGINE_MAX_PAIRS = 32
+
+
+def legacy_period_us(adc_us, gpio_us):
+    per_ch = (4 * gpio_us + LEGACY_SELECT_SETTLE_US  # select lines
+              + 2 * gpio_us + MUX_EN_SETTLE_US + adc_us  # MUX1
+              + 2 * gpio_us + MUX_EN_SETTLE_US + adc_us  # MUX2
+              + 2 * gpio_us)  # disable both
+    return MUX_CHANNELS * per_ch
+
+
+def serialized_period_us(settle_us, adc_us, gpio_us, channels, oversample):
+    per_ch = (4 * gpio_us
+              + 2 * gpio_us + max(settle_us, MUX_EN_SETTLE_US) + oversample * adc_us
+              + 2 * gpio_us + MUX_EN_SETTLE_US + oversample * adc_us
+              + 2 * gpio_us)
+    return channels * per_ch
+
+
+def parallel_period_us(settle_us, adc_us, gpio_us, channels, oversample):
+    per_ch = 4 * gpio_us + settle_us + 2 * oversample * adc_us
+    return channels * per_ch
+
+
+def engine_pairs(settle_us, oversample):
+    # hall_engine_init(): settle plus IRQ margin rounded up to whole pairs,
+    # then the averaged ones
+    pairs = -(-int(settle_us + ENGINE_IRQ_MARGIN_US) // ENGINE_PAIR_US) + oversample
+    return min(pairs, ENGINE_MAX_PAIRS)
+
+
+def engine_period_us(settle_us, channels, oversample):
+    return channels * engine_pairs(settle_us, oversample) * ENGINE_PAIR_US
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Model shego_adc.c scan period")
+    ap.add_argument("--settle", type=float, default=10.0,
+                    help="measured mux settle in us (boot log 'mux settle')")
+    ap.add_argument("--adc", type=float, default=6.0,
+                    help="cost of one analogReadPin() in us")
+    ap.add_argument("--gpio", type=float, default=0.1,
+                    help="cost of one writePin() in us")
+    ap.add_argument("--channels", type=int, default=8,
+                    help="select codes visited per scan (HALL_SELECT_MASK, 8 on SHEGO16)")
+    ap.add_argument("--oversample", type=int, default=4,
+                    help="reads averaged per channel (HALL_OVERSAMPLE)")
+    args = ap.parse_args()
+
+    rows = [
+        ("legacy (50+100+100 us waits)", legacy_period_us(args.adc, args.gpio)),
+        ("serialized, measured settle",
+         serialized_period_us(args.settle, args.adc, args.gpio, args.channels, args.oversample)),
+        ("parallel dual-mux",
+         parallel_period_us(args.settle, args.adc, args.gpio, args.channels, args.oversample)),
+        (f"DMA engine ({engine_pairs(args.settle, args.oversample)} pairs/code)",
+         engine_period_us(args.settle, args.channels, args.oversample)),
+    ]
+    base = rows[0][1]
+    print(f"settle={args.settle}us adc={args.adc}us gpio={args.gpio}us "
+          f"channels={args.channels} oversample={args.oversample}")
+    for name, period in rows:
+        print(f"{name:32s} {period:9.1f} us/scan {1e6 / period:9.0f} scans/s  x{base / period:5.1f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,420 @@
+#!/usr/bin/env python3
+# shego_hid.py
+# Host CLI for the keyboard sub-commands in shego_hid.c (raw HID, 32-byte
+# packets starting with SHEGO_HID_MAGIC). Needs the hidapi module, same as
+# gif_uploader_gui.py.
+#
+# Usage: python shego_hid.py stats [--reset]
+#        python shego_hid.py latency [--reset]
+#        python shego_hid.py analog [--rate 1000] [--seconds 10] [-o depth.csv]
+#        python shego_hid.py axes [--set AXIS POS NEG]
+#        python shego_hid.py dks [--set SLOT KEY MM1 MM2 KEYCODE:ACTIONS ...]
+#        python shego_hid.py dnl [--set E512 E1536 E2560 E3584]
+#        python shego_hid.py trace --channels 17,1 --seconds 5 -o capture.csv
+import argparse
+import struct
+import sys
+import time
+
+import hid
+
+VID = 0xFADE
+PID = 0x0666
+RAW_USAGE_PAGE = 0xFF60  # QMK raw HID interface
+
+PACKET_SIZE = 32
+SHEGO_HID_MAGIC = 0xA5
+SHEGO_HID_STATS = 0x20
+SHEGO_HID_STATS_HIST = 0x21
+SHEGO_HID_STATS_RESET = 0x22
+SHEGO_HID_STATS_SCHED = 0x23
+SHEGO_HID_LATENCY = 0x24
+SHEGO_HID_LATENCY_INFO = 0x25
+SHEGO_HID_LATENCY_RESET = 0x26
+SHEGO_HID_TRACE_START = 0x30
+SHEGO_HID_TRACE_STOP = 0x31
+SHEGO_HID_TRACE_STATUS = 0x32
+SHEGO_HID_TRACE_DATA = 0x33
+SHEGO_HID_ANALOG = 0x40
+SHEGO_HID_ANALOG_AXIS = 0x41
+SHEGO_HID_DKS_GET = 0x42
+SHEGO_HID_DKS_SET = 0x43
+SHEGO_HID_ADC_DNL = 0x44
+SHEGO_HID_ERROR = 0xFF
+
+HALL_STATS_BUCKETS = 16  # hall_stats.h
+HALL_TRACE_MAX_CHANNELS = 4  # hall_trace.h
+HALL_TRACE_GAP_FLAG = 0x80
+TRACE_TIME_UNIT_US = 4  # hall_trace.c
+# hall_latency_stage_t in hall_latency.h
+LATENCY_STAGES = ["scan", "handoff", "matrix", "keymap", "usb", "total"]
+MATRIX_ROWS = 4  # config.h
+MATRIX_COLS = 4
+ANALOG_KEYS = MATRIX_ROWS * MATRIX_COLS  # hall_analog.h
+ANALOG_NONE = 0xFF
+AXIS_NAMES = ["X", "Y", "Z", "RZ"]
+DKS_SLOTS = 4  # hall_dks.h
+DKS_BINDINGS = 4
+DKS_UNIT_MM = 0.02
+# Action letters per crossing: down past 1, down past 2, up past 2, up past 1
+DKS_ACTIONS = "-tpr"  # nothing, tap, press, release
+ADC_WIDE_CODES = [512, 1536, 2560, 3584]  # hall_adc.h
+
+
+class Keyboard:
+    def __init__(self, vid=VID, pid=PID):
+        path = None
+        for info in hid.enumerate(vid, pid):
+            if info.get("usage_page") == RAW_USAGE_PAGE:
+                path = info["path"]
+                break
+        if path is None:
+            raise SystemExit(f"no raw HID interface for {vid:04X}:{pid:04X}")
+        self.dev = hid.device()
+        self.dev.open_path(path)
+
+    def command(self, cmd, args=b"", timeout_ms=500):
+        """Send one sub-command and return the 30-byte reply payload."""
+        packet = bytearray(PACKET_SIZE)
+        packet[0] = SHEGO_HID_MAGIC
+        packet[1] = cmd
+        packet[2:2 + len(args)] = args
+        # Leading 0 is the report id
+        self.dev.write(b"\x00" + bytes(packet))
+        while True:
+            reply = bytes(self.dev.read(PACKET_SIZE, timeout_ms))
+            if not reply:
+                raise SystemExit(f"no reply to command 0x{cmd:02X}")
+            if reply[0] != SHEGO_HID_MAGIC or reply[1] != cmd and reply[1] != SHEGO_HID_ERROR:
+                continue  # stray VIA / RGB traffic or streamed reports
+            if reply[1] == SHEGO_HID_ERROR:
+                raise SystemExit(f"command 0x{cmd:02X} not supported by firmware")
+            return reply[2:]
+
+
+def bucket_label(i):
+    if i == 0:
+        return "< 16 us"
+    lo = 1 << (i + 3)
+    if i == HALL_STATS_BUCKETS - 1:
+        return f">= {lo} us"
+    return f"{lo}-{(lo << 1) - 1} us"
+
+
+def cmd_stats(kb, args):
+    if args.reset:
+        kb.command(SHEGO_HID_STATS_RESET)
+        print("stats reset")
+        return
+
+    scans, rate, avg_us, max_us, stall_us, transitions, engine_us = \
+        struct.unpack_from("<7I", kb.command(SHEGO_HID_STATS))
+    print(f"scans        {scans}")
+    print(f"scans/s      {rate}")
+    print(f"scan time    avg {avg_us} us, max {max_us} us")
+    print(f"worst stall  {stall_us} us")
+    if engine_us:
+        print(f"DMA pass     {engine_us} us")
+    print(f"transitions  {transitions}")
+
+    ticks, jitter_avg, jitter_max, overruns, period_us, queue_hw = \
+        struct.unpack_from("<6I", kb.command(SHEGO_HID_STATS_SCHED))
+    if period_us:
+        print(f"fixed rate   {period_us} us/tick, {ticks} ticks, {overruns} overrun(s)")
+        print(f"tick jitter  avg {jitter_avg} us, max {jitter_max} us")
+        print(f"event queue  peak depth {queue_hw}")
+
+    counts = []
+    first = 0
+    while first < HALL_STATS_BUCKETS:
+        reply = kb.command(SHEGO_HID_STATS_HIST, bytes([first]))
+        n = reply[1]
+        counts += struct.unpack_from(f"<{n}I", reply, 2)
+        first += n
+    if not transitions:
+        return
+    print("crossing -> matrix latency:")
+    for i, n in enumerate(counts):
+        if n:
+            print(f"  {bucket_label(i):>16}  {n:8}  {100.0 * n / transitions:5.1f}%")
+
+
+def bucket_range(i):
+    """[lo, hi) in us of a hall_stats_bucket(); hi is None for the last."""
+    if i == 0:
+        return 0, 16
+    lo = 1 << (i + 3)
+    return lo, None if i == HALL_STATS_BUCKETS - 1 else lo << 1
+
+
+def percentile(counts, p):
+    """Approximate percentile of a bucketed histogram, linear inside a bucket.
+    Returns (us, open_ended)."""
+    target = sum(counts) * p / 100.0
+    seen = 0
+    for i, n in enumerate(counts):
+        if n and seen + n >= target:
+            lo, hi = bucket_range(i)
+            if hi is None:
+                return lo, True
+            return lo + (hi - lo) * (target - seen) / n, False
+        seen += n
+    return 0, False
+
+
+def fmt_us(value):
+    us, open_ended = value
+    text = f"{us / 1000:.2f} ms" if us >= 1000 else f"{us:.0f} us"
+    return (">= " if open_ended else "") + text
+
+
+def cmd_latency(kb, args):
+    if args.reset:
+        kb.command(SHEGO_HID_LATENCY_RESET)
+        print("latency reset")
+        return
+
+    traced, unreported, stages, buckets = struct.unpack_from("<IIBB", kb.command(SHEGO_HID_LATENCY_INFO))
+    print(f"{traced} transition(s) traced to a USB report, {unreported} key record(s) sent no report")
+    if not traced:
+        return
+    print(f"{'stage':>8}  {'p50':>10}  {'p90':>10}  {'p99':>10}  {'max':>12}")
+    for stage in range(stages):
+        counts = []
+        while len(counts) < buckets:
+            reply = kb.command(SHEGO_HID_LATENCY, bytes([stage, len(counts)]))
+            counts += struct.unpack_from(f"<{reply[2]}I", reply, 4)
+        worst = max((i for i, n in enumerate(counts) if n), default=0)
+        lo, hi = bucket_range(worst)
+        top = f">= {lo} us" if hi is None else f"< {hi} us"
+        name = LATENCY_STAGES[stage] if stage < len(LATENCY_STAGES) else str(stage)
+        print(f"{name:>8}  {fmt_us(percentile(counts, 50)):>10}  {fmt_us(percentile(counts, 90)):>10}  "
+              f"{fmt_us(percentile(counts, 99)):>10}  {top:>12}")
+
+
+def key_name(index):
+    return "-" if index == ANALOG_NONE else f"r{index // MATRIX_COLS}c{index % MATRIX_COLS}"
+
+
+def parse_key(text):
+    """'-' for none, 'r2c0' or a plain index (row * MATRIX_COLS + col)."""
+    if text == "-":
+        return ANALOG_NONE
+    if text.startswith("r") and "c" in text:
+        row, col = text[1:].split("c")
+        return int(row) * MATRIX_COLS + int(col)
+    return int(text)
+
+
+def cmd_analog(kb, args):
+    """Poll key depth like an analog keyboard SDK would, at up to 1 kHz."""
+    period = 1.0 / args.rate
+    out = open(args.output, "w") if args.output else None
+    if out:
+        out.write("time_us," + ",".join(key_name(i) for i in range(ANALOG_KEYS)) + "\n")
+    polls, last_t = 0, None
+    end = time.monotonic() + args.seconds
+    next_poll = time.monotonic()
+    try:
+        while time.monotonic() < end:
+            reply = kb.command(SHEGO_HID_ANALOG)
+            t = struct.unpack_from("<I", reply)[0]
+            depth = reply[4:4 + ANALOG_KEYS]
+            polls += 1
+            if out:
+                if t != last_t:
+                    out.write(f"{t}," + ",".join(str(d) for d in depth) + "\n")
+            else:
+                bars = " ".join(f"{key_name(i)}:{d * 100 // 255:3}%" for i, d in enumerate(depth) if d)
+                print(f"\r{bars or 'all keys up':<110}", end="", flush=True)
+            last_t = t
+            next_poll += period
+            time.sleep(max(0.0, next_poll - time.monotonic()))
+    except KeyboardInterrupt:
+        pass
+    if out:
+        out.close()
+        print(f"{polls} polls -> {args.output}")
+    else:
+        print()
+
+
+def cmd_axes(kb, args):
+    if args.set:
+        axis = AXIS_NAMES.index(args.set[0].upper()) if args.set[0].upper() in AXIS_NAMES else int(args.set[0])
+        kb.command(SHEGO_HID_ANALOG_AXIS, bytes([axis, 1, parse_key(args.set[1]), parse_key(args.set[2])]))
+    for axis, name in enumerate(AXIS_NAMES):
+        reply = kb.command(SHEGO_HID_ANALOG_AXIS, bytes([axis, 0]))
+        print(f"{name:>3}  + {key_name(reply[2]):>5}  - {key_name(reply[3]):>5}")
+
+
+def parse_keycode(text):
+    """Basic keycode: a letter, a digit or a number (0x04 = KC_A)."""
+    if len(text) == 1 and text.isalpha():
+        return 0x04 + ord(text.upper()) - ord("A")
+    if len(text) == 1 and text.isdigit():
+        return 0x27 if text == "0" else 0x1E + int(text) - 1
+    return int(text, 0)
+
+
+def parse_binding(text):
+    """'A:t---' -> (keycode, actions byte); four letters from DKS_ACTIONS."""
+    keycode, actions = text.split(":")
+    if len(actions) != 4 or any(a not in DKS_ACTIONS for a in actions):
+        raise SystemExit(f"actions must be 4 of '{DKS_ACTIONS}': {text}")
+    packed = 0
+    for event, a in enumerate(actions):
+        packed |= DKS_ACTIONS.index(a) << (event * 2)
+    return parse_keycode(keycode), packed
+
+
+def format_actions(packed):
+    return "".join(DKS_ACTIONS[(packed >> (event * 2)) & 3] for event in range(4))
+
+
+def cmd_dks(kb, args):
+    if args.set:
+        if len(args.set) < 4:
+            raise SystemExit("--set needs SLOT KEY MM1 MM2 (use '- 0 0' for KEY MM1 MM2 to clear)")
+        slot, key, mm1, mm2, *bindings = args.set
+        if len(bindings) > DKS_BINDINGS:
+            raise SystemExit(f"at most {DKS_BINDINGS} bindings")
+        points = [min(255, round(float(mm) / DKS_UNIT_MM)) for mm in (mm1, mm2)]
+        packet = bytearray([int(slot), parse_key(key)] + points) + bytes(12)
+        for b, text in enumerate(bindings):
+            keycode, actions = parse_binding(text)
+            packet[4 + b] = actions
+            struct.pack_into("<H", packet, 8 + b * 2, keycode)
+        kb.command(SHEGO_HID_DKS_SET, bytes(packet))
+
+    print("slot  key     point 1  point 2  bindings (down1 down2 up2 up1)")
+    for slot in range(DKS_SLOTS):
+        reply = kb.command(SHEGO_HID_DKS_GET, bytes([slot]))
+        if reply[1] == ANALOG_NONE:
+            print(f"{slot:>4}  -")
+            continue
+        points = [f"{p * DKS_UNIT_MM:.2f} mm" if p else "-" for p in reply[2:4]]
+        keycodes = struct.unpack_from(f"<{DKS_BINDINGS}H", reply, 8)
+        bindings = " ".join(f"0x{kc:04X}:{format_actions(a)}" for kc, a in zip(keycodes, reply[4:8]) if kc)
+        print(f"{slot:>4}  {key_name(reply[1]):<6}  {points[0]:>7}  {points[1]:>7}  {bindings}")
+
+
+def cmd_dnl(kb, args):
+    payload = bytes([1] + args.set) if args.set else bytes([0])
+    reply = kb.command(SHEGO_HID_ADC_DNL, payload)
+    for code, extra in zip(ADC_WIDE_CODES, reply[1:1 + len(ADC_WIDE_CODES)]):
+        print(f"code {code:>4}: {1 + extra / 16:.2f} LSB wide ({extra}/16 extra)")
+
+
+def decode_trace(report, count):
+    """[(time_us, [adc per channel])] from one SHEGO_HID_TRACE_DATA report."""
+    entries = report[3] & ~HALL_TRACE_GAP_FLAG
+    t = struct.unpack_from("<I", report, 4)[0]
+    pos = 8
+    values = []
+    for i in range(0, count, 2):
+        a = report[pos] | (report[pos + 1] & 0x0F) << 8
+        values.append(a)
+        if i + 1 < count:
+            values.append(report[pos + 1] >> 4 | report[pos + 2] << 4)
+            pos += 3
+        else:
+            pos += 2
+    out = [(t, list(values))]
+    for _ in range(entries - 1):
+        t += report[pos] * TRACE_TIME_UNIT_US
+        pos += 1
+        for i in range(count):
+            values[i] += struct.unpack_from("b", report, pos)[0]
+            pos += 1
+        out.append((t, list(values)))
+    return out
+
+
+def cmd_trace(kb, args):
+    channels = [int(c) for c in args.channels.split(",")]
+    if not 1 <= len(channels) <= HALL_TRACE_MAX_CHANNELS:
+        raise SystemExit(f"1 to {HALL_TRACE_MAX_CHANNELS} channels")
+    kb.command(SHEGO_HID_TRACE_START, bytes([len(channels)] + channels))
+
+    rows, lost, gaps = 0, 0, 0
+    last_seq, last_t, wraps = None, None, 0
+    end = time.monotonic() + args.seconds
+    stopped = False
+    with open(args.output, "w") as out:
+        out.write("time_us,channel,adc\n")
+        while True:
+            if not stopped and time.monotonic() >= end:
+                kb.command(SHEGO_HID_TRACE_STOP)
+                stopped = True
+            report = bytes(kb.dev.read(PACKET_SIZE, 200))
+            if not report:
+                if stopped:
+                    break  # ring drained
+                continue
+            if report[0] != SHEGO_HID_MAGIC or report[1] != SHEGO_HID_TRACE_DATA:
+                continue
+            if last_seq is not None:
+                lost += (report[2] - last_seq - 1) & 0xFF
+            last_seq = report[2]
+            if report[3] & HALL_TRACE_GAP_FLAG:
+                gaps += 1
+            for t, values in decode_trace(report, len(channels)):
+                # Unwrap the 32-bit microsecond timer
+                if last_t is not None and t + wraps < last_t - (1 << 31):
+                    wraps += 1 << 32
+                last_t = t + wraps
+                for ch, v in zip(channels, values):
+                    out.write(f"{last_t},{ch},{v}\n")
+                rows += 1
+
+    dropped, pending, _ = struct.unpack_from("<IHB", kb.command(SHEGO_HID_TRACE_STATUS))
+    print(f"{rows} scans of {len(channels)} channel(s) -> {args.output}")
+    if lost or dropped:
+        print(f"lost {lost} report(s) on USB, {dropped} scan(s) dropped on the keyboard in {gaps} gap(s)")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="shego16 raw HID tools")
+    sub = ap.add_subparsers(dest="command", required=True)
+    p = sub.add_parser("stats", help="scan rate, scan time, stalls and latency histogram")
+    p.add_argument("--reset", action="store_true", help="clear the counters instead")
+    p.set_defaults(func=cmd_stats)
+    p = sub.add_parser("latency", help="per-stage crossing -> USB report latency percentiles")
+    p.add_argument("--reset", action="store_true", help="clear the histograms instead")
+    p.set_defaults(func=cmd_latency)
+    p = sub.add_parser("analog", help="poll per-key depth (0..255) over raw HID")
+    p.add_argument("--rate", type=float, default=1000.0, help="polls per second")
+    p.add_argument("--seconds", type=float, default=10.0)
+    p.add_argument("-o", "--output", help="write time_us + one column per key to CSV")
+    p.set_defaults(func=cmd_analog)
+    p = sub.add_parser("axes", help="show or change the key -> joystick axis mapping")
+    p.add_argument("--set", nargs=3, metavar=("AXIS", "POS", "NEG"),
+                   help="axis X/Y/Z/RZ, keys as r<row>c<col>, index or '-'")
+    p.set_defaults(func=cmd_axes)
+    p = sub.add_parser("dks", help="show or set Dynamic Keystroke slots")
+    p.add_argument("--set", nargs="+", metavar="ARG",
+                   help="SLOT KEY MM1 MM2 [KEYCODE:ACTIONS ...], KEY '-' clears the slot; "
+                        "ACTIONS is 4 of - t p r for down past 1, down past 2, up past 2, up past 1 "
+                        "(e.g. 'A:t---' 'B:-p-r'); a point past the end of travel means bottom-out")
+    p.set_defaults(func=cmd_dks)
+    p = sub.add_parser("dnl", help="show or set the ADC wide-code correction (hall_adc.c)")
+    p.add_argument("--set", nargs=4, type=int, metavar="EXTRA",
+                   help="extra width of codes 512 1536 2560 3584 in 1/16 LSB (0 turns it off), "
+                        "e.g. from adc_dnl.py --histogram")
+    p.set_defaults(func=cmd_dnl)
+    p = sub.add_parser("trace", help="capture raw ADC samples to CSV (time_us,channel,adc)")
+    p.add_argument("--channels", required=True,
+                   help="comma-separated sample indices (MUX1 0..15, MUX2 16..31)")
+    p.add_argument("--seconds", type=float, default=5.0)
+    p.add_argument("-o", "--output", default="capture.csv")
+    p.set_defaults(func=cmd_trace)
+    args = ap.parse_args()
+
+    kb = Keyboard()
+    args.func(kb, args)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())